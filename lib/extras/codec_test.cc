@@ -13,9 +13,12 @@
 #include <utility>
 #include <vector>
 
+#include "lib/extras/dec/apng.h"
 #include "lib/extras/dec/decode.h"
 #include "lib/extras/dec/pnm.h"
 #include "lib/extras/enc/encode.h"
+#include "lib/extras/enc/jxl.h"
+#include "lib/jxl/base/cache_aligned.h"
 #include "lib/jxl/base/random.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/test_utils.h"
@@ -444,6 +447,158 @@ TEST(CodecTest, EncodeToPNG) {
                   decoded_ppf.info.bits_per_sample);
 }
 
+TEST(CodecTest, EncodeAPNGFrameByFrame) {
+  std::unique_ptr<Encoder> png_encoder = Encoder::FromExtension(".png");
+  if (!png_encoder || !CanDecodeAPNG()) {
+    fprintf(stderr, "Skipping test because of missing codec support.\n");
+    return;
+  }
+
+  TestImageParams params;
+  params.codec = Codec::kPNG;
+  params.xsize = 37;
+  params.ysize = 19;
+  params.bits_per_sample = 8;
+  params.is_gray = false;
+  params.add_alpha = true;
+  params.big_endian = false;
+  params.add_extra_channels = false;
+  PackedPixelFile ppf_in;
+  CreateTestImage(params, &ppf_in);
+  ppf_in.info.have_animation = JXL_TRUE;
+  ppf_in.info.animation.tps_numerator = 1000;
+  ppf_in.info.animation.tps_denominator = 1;
+  const size_t kNumFrames = 3;
+  for (size_t i = 1; i < kNumFrames; ++i) {
+    PackedFrame frame(params.xsize, params.ysize, params.PixelFormat());
+    FillPackedImage(params.bits_per_sample, &frame.color);
+    // Make the frames differ from each other.
+    static_cast<uint8_t*>(frame.color.pixels())[0] += i;
+    ppf_in.frames.emplace_back(std::move(frame));
+  }
+  for (auto& frame : ppf_in.frames) frame.frame_info.duration = 10;
+
+  EncodedImage encoded;
+  ASSERT_TRUE(png_encoder->Encode(ppf_in, &encoded, nullptr));
+  ASSERT_EQ(encoded.bitstreams.size(), 1);
+  const Span<const uint8_t> png(encoded.bitstreams[0]);
+
+  PackedPixelFile ppf;
+  ASSERT_TRUE(DecodeImageAPNG(png, ColorHints(), &ppf));
+  ASSERT_EQ(ppf.frames.size(), kNumFrames);
+
+  // The frames passed to the callback are the same as the ones decoded at
+  // once.
+  PackedPixelFile header;
+  size_t num_decoded = 0;
+  ASSERT_TRUE(DecodeImageAPNGFrames(
+      png, ColorHints(), &header, nullptr,
+      [&](PackedFrame&& frame) -> Status {
+        EXPECT_EQ(0u, header.frames.size());
+        EXPECT_LT(num_decoded, kNumFrames);
+        if (num_decoded >= kNumFrames) return false;
+        const PackedImage& expected = ppf.frames[num_decoded].color;
+        EXPECT_EQ(expected.pixels_size, frame.color.pixels_size);
+        EXPECT_EQ(0, memcmp(expected.pixels(), frame.color.pixels(),
+                            std::min(expected.pixels_size,
+                                     frame.color.pixels_size)));
+        ++num_decoded;
+        return true;
+      }));
+  EXPECT_EQ(num_decoded, kNumFrames);
+
+  JXLCompressParams jxl_params;
+  std::vector<uint8_t> compressed;
+  ASSERT_TRUE(EncodeImageJXL(jxl_params, ppf, /*jpeg_bytes=*/nullptr,
+                             &compressed));
+  PackedPixelFile ppf_streamed;
+  size_t num_frames = 0;
+  std::vector<uint8_t> streamed;
+  ASSERT_TRUE(EncodeImageJXLFrameByFrame(
+      jxl_params,
+      [&](PackedPixelFile* decoded,
+          const std::function<Status(PackedFrame&&)>& frame_callback) {
+        return DecodeImageAPNGFrames(png, ColorHints(), decoded, nullptr,
+                                     frame_callback);
+      },
+      &ppf_streamed, &num_frames, &streamed));
+  EXPECT_EQ(num_frames, kNumFrames);
+  EXPECT_EQ(ppf_streamed.info.xsize, params.xsize);
+  EXPECT_EQ(ppf_streamed.info.ysize, params.ysize);
+  EXPECT_EQ(compressed, streamed);
+}
+
+TEST(CodecTest, EncodeFrameByFramePeakMemory) {
+  TestImageParams params;
+  params.codec = Codec::kPNG;
+  params.xsize = 128;
+  params.ysize = 128;
+  params.bits_per_sample = 8;
+  params.is_gray = false;
+  params.add_alpha = false;
+  params.big_endian = false;
+  params.add_extra_channels = false;
+  PackedPixelFile header;
+  CreateTestImage(params, &header);
+  header.frames.clear();
+  header.info.have_animation = JXL_TRUE;
+  header.info.animation.tps_numerator = 1000;
+  header.info.animation.tps_denominator = 1;
+  const auto make_frame = [&](size_t i) {
+    PackedFrame frame(params.xsize, params.ysize, params.PixelFormat());
+    FillPackedImage(params.bits_per_sample, &frame.color);
+    static_cast<uint8_t*>(frame.color.pixels())[0] += i;
+    frame.frame_info.duration = 10;
+    return frame;
+  };
+  // Decodes `num_frames` frames without ever holding more than one of them.
+  const auto decoder = [&](size_t num_frames) -> FrameByFrameDecoder {
+    return [&, num_frames](
+               PackedPixelFile* ppf,
+               const std::function<Status(PackedFrame&&)>& frame_callback)
+               -> Status {
+      ppf->info = header.info;
+      ppf->icc = header.icc;
+      ppf->color_encoding = header.color_encoding;
+      for (size_t i = 0; i < num_frames; ++i) {
+        JXL_RETURN_IF_ERROR(frame_callback(make_frame(i)));
+      }
+      return true;
+    };
+  };
+
+  JXLCompressParams jxl_params;
+  jxl_params.AddOption(JXL_ENC_FRAME_SETTING_EFFORT, 3);
+  const auto peak_streamed = [&](size_t num_frames) {
+    PackedPixelFile ppf;
+    size_t num_encoded = 0;
+    std::vector<uint8_t> compressed;
+    CacheAligned::ResetMaxBytesInUse();
+    EXPECT_TRUE(EncodeImageJXLFrameByFrame(jxl_params, decoder(num_frames),
+                                           &ppf, &num_encoded, &compressed));
+    EXPECT_EQ(num_frames, num_encoded);
+    return CacheAligned::ResetMaxBytesInUse();
+  };
+  const size_t kNumFrames = 16;
+  PackedPixelFile ppf;
+  ppf.info = header.info;
+  ppf.icc = header.icc;
+  ppf.color_encoding = header.color_encoding;
+  for (size_t i = 0; i < kNumFrames; ++i) ppf.frames.push_back(make_frame(i));
+  std::vector<uint8_t> compressed;
+  CacheAligned::ResetMaxBytesInUse();
+  ASSERT_TRUE(EncodeImageJXL(jxl_params, ppf, /*jpeg_bytes=*/nullptr,
+                             &compressed));
+  const size_t peak_at_once = CacheAligned::ResetMaxBytesInUse();
+
+  // The encoder holds each input frame as three float planes.
+  const size_t frame_bytes = params.xsize * params.ysize * 3 * sizeof(float);
+  const size_t peak_two_frames = peak_streamed(2);
+  const size_t peak_many_frames = peak_streamed(kNumFrames);
+  EXPECT_LE(peak_many_frames, peak_two_frames + 2 * frame_bytes);
+  EXPECT_GE(peak_at_once, peak_many_frames + (kNumFrames / 2) * frame_bytes);
+}
+
 }  // namespace
 }  // namespace extras
 }  // namespace jxl
@@ -40,6 +40,7 @@
 #include <jxl/encode.h>
 #include <string.h>
 
+#include <functional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -430,6 +431,9 @@ constexpr uint32_t kId_sRGB = 0x42475273;
 constexpr uint32_t kId_gAMA = 0x414D4167;
 constexpr uint32_t kId_cHRM = 0x4D524863;
 constexpr uint32_t kId_eXIf = 0x66495865;
+constexpr uint32_t kId_tEXt = 0x74584574;
+constexpr uint32_t kId_zTXt = 0x7458547A;
+constexpr uint32_t kId_iTXt = 0x74585469;
 
 struct APNGFrame {
   std::vector<uint8_t> pixels;
@@ -559,6 +563,29 @@ int processing_finish(png_structp png_ptr, png_infop info_ptr,
   return 0;
 }
 
+// Returns whether `bytes` has metadata chunks that only become known after
+// the first frame has been decoded.
+bool HasMetadataAfterFirstFrame(const Span<const uint8_t> bytes) {
+  bool seen_idat = false;
+  bool first_frame_done = false;
+  size_t pos = 8;
+  while (pos + 8 <= bytes.size()) {
+    const uint32_t size = png_get_uint_32(bytes.data() + pos);
+    const uint32_t id = LoadLE32(bytes.data() + pos + 4);
+    if (id == kId_IDAT) seen_idat = true;
+    if (seen_idat && (id == kId_fcTL || id == kId_fdAT)) {
+      first_frame_done = true;
+    }
+    if (first_frame_done && (id == kId_eXIf || id == kId_tEXt ||
+                             id == kId_zTXt || id == kId_iTXt)) {
+      return true;
+    }
+    if (id == kId_IEND || size > kMaxPNGChunkSize) break;
+    pos += size + 12;
+  }
+  return false;
+}
+
 }  // namespace
 #endif
 
@@ -570,10 +597,16 @@ bool CanDecodeAPNG() {
 #endif
 }
 
-Status DecodeImageAPNG(const Span<const uint8_t> bytes,
-                       const ColorHints& color_hints, PackedPixelFile* ppf,
-                       const SizeConstraints* constraints) {
 #if JPEGXL_ENABLE_APNG
+namespace {
+
+// Decodes `bytes`, passing each frame to `frame_callback` as soon as it is
+// complete. Only the geometry of the previous frame is needed to turn APNG
+// dispose and blend operations into JPEG XL frames.
+Status DecodeAPNG(const Span<const uint8_t> bytes,
+                  const ColorHints& color_hints, PackedPixelFile* ppf,
+                  const SizeConstraints* constraints,
+                  const std::function<Status(PackedFrame&&)>& frame_callback) {
   Reader r;
   unsigned int id, j, w, h, w0, h0, x0, y0;
   unsigned int delay_num, delay_den, dop, bop, rowbytes, imagesize;
@@ -600,7 +633,118 @@ Status DecodeImageAPNG(const Span<const uint8_t> bytes,
     uint32_t blend_op;
   };
 
-  std::vector<FrameInfo> frames;
+  size_t num_frames = 0;
+  bool has_nontrivial_background = false;
+  bool previous_frame_should_be_cleared = false;
+  size_t px0 = 0, py0 = 0, pxs = 0, pys = 0;
+  enum {
+    DISPOSE_OP_NONE = 0,
+    DISPOSE_OP_BACKGROUND = 1,
+    DISPOSE_OP_PREVIOUS = 2,
+  };
+  enum {
+    BLEND_OP_SOURCE = 0,
+    BLEND_OP_OVER = 1,
+  };
+  const auto add_frame = [&](FrameInfo&& frame, bool have_color) -> Status {
+    JXL_ASSERT(frame.data.xsize == frame.xsize);
+    JXL_ASSERT(frame.data.ysize == frame.ysize);
+    if (num_frames++ == 0) {
+      // Color chunks precede the image data, so the color encoding is final.
+      JXL_RETURN_IF_ERROR(ApplyColorHints(
+          color_hints, have_color, ppf->info.num_color_channels == 1, ppf));
+    }
+
+    // Before encountering a DISPOSE_OP_NONE frame, the canvas is filled with 0,
+    // so DISPOSE_OP_BACKGROUND and DISPOSE_OP_PREVIOUS are equivalent.
+    if (frame.dispose_op == DISPOSE_OP_NONE) {
+      has_nontrivial_background = true;
+    }
+    bool should_blend = frame.blend_op == BLEND_OP_OVER;
+    bool use_for_next_frame =
+        has_nontrivial_background && frame.dispose_op != DISPOSE_OP_PREVIOUS;
+    size_t x0 = frame.x0;
+    size_t y0 = frame.y0;
+    size_t xsize = frame.data.xsize;
+    size_t ysize = frame.data.ysize;
+    PackedImage data = std::move(frame.data);
+    if (previous_frame_should_be_cleared) {
+      if (px0 >= x0 && py0 >= y0 && px0 + pxs <= x0 + xsize &&
+          py0 + pys <= y0 + ysize && frame.blend_op == BLEND_OP_SOURCE &&
+          use_for_next_frame) {
+        // If the previous frame is entirely contained in the current frame and
+        // we are using BLEND_OP_SOURCE, nothing special needs to be done.
+      } else if (px0 == x0 && py0 == y0 && px0 + pxs == x0 + xsize &&
+                 py0 + pys == y0 + ysize && use_for_next_frame) {
+        // If the new frame has the same size as the old one, but we are
+        // blending, we can instead just not blend.
+        should_blend = false;
+      } else if (px0 <= x0 && py0 <= y0 && px0 + pxs >= x0 + xsize &&
+                 py0 + pys >= y0 + ysize && use_for_next_frame) {
+        // If the new frame is contained within the old frame, we can pad the
+        // new frame with zeros and not blend.
+        PackedImage new_data(pxs, pys, data.format);
+        memset(new_data.pixels(), 0, new_data.pixels_size);
+        for (size_t y = 0; y < ysize; y++) {
+          size_t bytes_per_pixel =
+              PackedImage::BitsPerChannel(new_data.format.data_type) *
+              new_data.format.num_channels / 8;
+          memcpy(static_cast<uint8_t*>(new_data.pixels()) +
+                     new_data.stride * (y + y0 - py0) +
+                     bytes_per_pixel * (x0 - px0),
+                 static_cast<const uint8_t*>(data.pixels()) + data.stride * y,
+                 xsize * bytes_per_pixel);
+        }
+
+        x0 = px0;
+        y0 = py0;
+        xsize = pxs;
+        ysize = pys;
+        should_blend = false;
+        data = std::move(new_data);
+      } else {
+        // If all else fails, insert a dummy blank frame with kReplace.
+        PackedImage blank(pxs, pys, data.format);
+        memset(blank.pixels(), 0, blank.pixels_size);
+        PackedFrame pframe(std::move(blank));
+        pframe.frame_info.layer_info.crop_x0 = px0;
+        pframe.frame_info.layer_info.crop_y0 = py0;
+        pframe.frame_info.layer_info.xsize = pxs;
+        pframe.frame_info.layer_info.ysize = pys;
+        pframe.frame_info.duration = 0;
+        bool is_full_size = px0 == 0 && py0 == 0 && pxs == ppf->info.xsize &&
+                            pys == ppf->info.ysize;
+        pframe.frame_info.layer_info.have_crop = is_full_size ? 0 : 1;
+        pframe.frame_info.layer_info.blend_info.blendmode = JXL_BLEND_REPLACE;
+        pframe.frame_info.layer_info.blend_info.source = 1;
+        pframe.frame_info.layer_info.save_as_reference = 1;
+        JXL_RETURN_IF_ERROR(frame_callback(std::move(pframe)));
+      }
+    }
+
+    PackedFrame pframe(std::move(data));
+    pframe.frame_info.layer_info.crop_x0 = x0;
+    pframe.frame_info.layer_info.crop_y0 = y0;
+    pframe.frame_info.layer_info.xsize = xsize;
+    pframe.frame_info.layer_info.ysize = ysize;
+    pframe.frame_info.duration = frame.duration;
+    pframe.frame_info.layer_info.blend_info.blendmode =
+        should_blend ? JXL_BLEND_BLEND : JXL_BLEND_REPLACE;
+    bool is_full_size = x0 == 0 && y0 == 0 && xsize == ppf->info.xsize &&
+                        ysize == ppf->info.ysize;
+    pframe.frame_info.layer_info.have_crop = is_full_size ? 0 : 1;
+    pframe.frame_info.layer_info.blend_info.source = 1;
+    pframe.frame_info.layer_info.blend_info.alpha = 0;
+    pframe.frame_info.layer_info.save_as_reference = use_for_next_frame ? 1 : 0;
+
+    previous_frame_should_be_cleared =
+        has_nontrivial_background && frame.dispose_op == DISPOSE_OP_BACKGROUND;
+    px0 = frame.x0;
+    py0 = frame.y0;
+    pxs = frame.xsize;
+    pys = frame.ysize;
+    return frame_callback(std::move(pframe));
+  };
 
   // Make sure png memory is released in any case.
   auto scope_guard = MakeScopeGuard([&]() {
@@ -653,7 +797,9 @@ Status DecodeImageAPNG(const Span<const uint8_t> bytes,
       while (!r.Eof()) {
         id = read_chunk(&r, &chunk);
         if (!id) break;
-        seenFctl |= (id == kId_fcTL);
+        // The `fcTL` chunk of the default image comes before its `IDAT`
+        // chunks, all other `fcTL` chunks must come after them.
+        seenFctl |= (id == kId_fcTL && hasInfo);
 
         if (id == kId_acTL && !hasInfo && !isAnimated) {
           isAnimated = true;
@@ -666,13 +812,14 @@ Status DecodeImageAPNG(const Span<const uint8_t> bytes,
             if (!processing_finish(png_ptr, info_ptr, &ppf->metadata)) {
               // Allocates the frame buffer.
               uint32_t duration = delay_num * 1000 / delay_den;
-              frames.push_back(FrameInfo{PackedImage(w0, h0, format), duration,
-                                         x0, w0, y0, h0, dop, bop});
-              auto& frame = frames.back().data;
+              FrameInfo frame{PackedImage(w0, h0, format), duration, x0, w0,
+                              y0, h0, dop, bop};
               for (size_t y = 0; y < h0; ++y) {
-                memcpy(static_cast<uint8_t*>(frame.pixels()) + frame.stride * y,
+                memcpy(static_cast<uint8_t*>(frame.data.pixels()) +
+                           frame.data.stride * y,
                        frameRaw.rows[y], bytes_per_pixel * w0);
               }
+              JXL_RETURN_IF_ERROR(add_frame(std::move(frame), have_color));
             } else {
               break;
             }
@@ -866,123 +1013,25 @@ Status DecodeImageAPNG(const Span<const uint8_t> bytes,
         }
       }
     }
-
-    JXL_RETURN_IF_ERROR(ApplyColorHints(
-        color_hints, have_color, ppf->info.num_color_channels == 1, ppf));
   }
 
   if (errorstate) return false;
+  if (num_frames == 0) return JXL_FAILURE("No frames decoded");
+  return true;
+}
 
-  bool has_nontrivial_background = false;
-  bool previous_frame_should_be_cleared = false;
-  enum {
-    DISPOSE_OP_NONE = 0,
-    DISPOSE_OP_BACKGROUND = 1,
-    DISPOSE_OP_PREVIOUS = 2,
-  };
-  enum {
-    BLEND_OP_SOURCE = 0,
-    BLEND_OP_OVER = 1,
-  };
-  for (size_t i = 0; i < frames.size(); i++) {
-    auto& frame = frames[i];
-    JXL_ASSERT(frame.data.xsize == frame.xsize);
-    JXL_ASSERT(frame.data.ysize == frame.ysize);
-
-    // Before encountering a DISPOSE_OP_NONE frame, the canvas is filled with 0,
-    // so DISPOSE_OP_BACKGROUND and DISPOSE_OP_PREVIOUS are equivalent.
-    if (frame.dispose_op == DISPOSE_OP_NONE) {
-      has_nontrivial_background = true;
-    }
-    bool should_blend = frame.blend_op == BLEND_OP_OVER;
-    bool use_for_next_frame =
-        has_nontrivial_background && frame.dispose_op != DISPOSE_OP_PREVIOUS;
-    size_t x0 = frame.x0;
-    size_t y0 = frame.y0;
-    size_t xsize = frame.data.xsize;
-    size_t ysize = frame.data.ysize;
-    if (previous_frame_should_be_cleared) {
-      size_t px0 = frames[i - 1].x0;
-      size_t py0 = frames[i - 1].y0;
-      size_t pxs = frames[i - 1].xsize;
-      size_t pys = frames[i - 1].ysize;
-      if (px0 >= x0 && py0 >= y0 && px0 + pxs <= x0 + xsize &&
-          py0 + pys <= y0 + ysize && frame.blend_op == BLEND_OP_SOURCE &&
-          use_for_next_frame) {
-        // If the previous frame is entirely contained in the current frame and
-        // we are using BLEND_OP_SOURCE, nothing special needs to be done.
-        ppf->frames.emplace_back(std::move(frame.data));
-      } else if (px0 == x0 && py0 == y0 && px0 + pxs == x0 + xsize &&
-                 py0 + pys == y0 + ysize && use_for_next_frame) {
-        // If the new frame has the same size as the old one, but we are
-        // blending, we can instead just not blend.
-        should_blend = false;
-        ppf->frames.emplace_back(std::move(frame.data));
-      } else if (px0 <= x0 && py0 <= y0 && px0 + pxs >= x0 + xsize &&
-                 py0 + pys >= y0 + ysize && use_for_next_frame) {
-        // If the new frame is contained within the old frame, we can pad the
-        // new frame with zeros and not blend.
-        PackedImage new_data(pxs, pys, frame.data.format);
-        memset(new_data.pixels(), 0, new_data.pixels_size);
-        for (size_t y = 0; y < ysize; y++) {
-          size_t bytes_per_pixel =
-              PackedImage::BitsPerChannel(new_data.format.data_type) *
-              new_data.format.num_channels / 8;
-          memcpy(static_cast<uint8_t*>(new_data.pixels()) +
-                     new_data.stride * (y + y0 - py0) +
-                     bytes_per_pixel * (x0 - px0),
-                 static_cast<const uint8_t*>(frame.data.pixels()) +
-                     frame.data.stride * y,
-                 xsize * bytes_per_pixel);
-        }
-
-        x0 = px0;
-        y0 = py0;
-        xsize = pxs;
-        ysize = pys;
-        should_blend = false;
-        ppf->frames.emplace_back(std::move(new_data));
-      } else {
-        // If all else fails, insert a dummy blank frame with kReplace.
-        PackedImage blank(pxs, pys, frame.data.format);
-        memset(blank.pixels(), 0, blank.pixels_size);
-        ppf->frames.emplace_back(std::move(blank));
-        auto& pframe = ppf->frames.back();
-        pframe.frame_info.layer_info.crop_x0 = px0;
-        pframe.frame_info.layer_info.crop_y0 = py0;
-        pframe.frame_info.layer_info.xsize = pxs;
-        pframe.frame_info.layer_info.ysize = pys;
-        pframe.frame_info.duration = 0;
-        bool is_full_size = px0 == 0 && py0 == 0 && pxs == ppf->info.xsize &&
-                            pys == ppf->info.ysize;
-        pframe.frame_info.layer_info.have_crop = is_full_size ? 0 : 1;
-        pframe.frame_info.layer_info.blend_info.blendmode = JXL_BLEND_REPLACE;
-        pframe.frame_info.layer_info.blend_info.source = 1;
-        pframe.frame_info.layer_info.save_as_reference = 1;
-        ppf->frames.emplace_back(std::move(frame.data));
-      }
-    } else {
-      ppf->frames.emplace_back(std::move(frame.data));
-    }
-
-    auto& pframe = ppf->frames.back();
-    pframe.frame_info.layer_info.crop_x0 = x0;
-    pframe.frame_info.layer_info.crop_y0 = y0;
-    pframe.frame_info.layer_info.xsize = xsize;
-    pframe.frame_info.layer_info.ysize = ysize;
-    pframe.frame_info.duration = frame.duration;
-    pframe.frame_info.layer_info.blend_info.blendmode =
-        should_blend ? JXL_BLEND_BLEND : JXL_BLEND_REPLACE;
-    bool is_full_size = x0 == 0 && y0 == 0 && xsize == ppf->info.xsize &&
-                        ysize == ppf->info.ysize;
-    pframe.frame_info.layer_info.have_crop = is_full_size ? 0 : 1;
-    pframe.frame_info.layer_info.blend_info.source = 1;
-    pframe.frame_info.layer_info.blend_info.alpha = 0;
-    pframe.frame_info.layer_info.save_as_reference = use_for_next_frame ? 1 : 0;
+}  // namespace
+#endif
 
-    previous_frame_should_be_cleared =
-        has_nontrivial_background && frame.dispose_op == DISPOSE_OP_BACKGROUND;
-  }
+Status DecodeImageAPNG(const Span<const uint8_t> bytes,
+                       const ColorHints& color_hints, PackedPixelFile* ppf,
+                       const SizeConstraints* constraints) {
+#if JPEGXL_ENABLE_APNG
+  JXL_RETURN_IF_ERROR(DecodeAPNG(bytes, color_hints, ppf, constraints,
+                                 [&](PackedFrame&& frame) -> Status {
+                                   ppf->frames.emplace_back(std::move(frame));
+                                   return true;
+                                 }));
   if (ppf->frames.empty()) return JXL_FAILURE("No frames decoded");
   ppf->frames.back().frame_info.is_last = true;
 
@@ -992,5 +1041,17 @@ Status DecodeImageAPNG(const Span<const uint8_t> bytes,
 #endif
 }
 
+Status DecodeImageAPNGFrames(
+    const Span<const uint8_t> bytes, const ColorHints& color_hints,
+    PackedPixelFile* ppf, const SizeConstraints* constraints,
+    const std::function<Status(PackedFrame&&)>& frame_callback) {
+#if JPEGXL_ENABLE_APNG
+  if (HasMetadataAfterFirstFrame(bytes)) return false;
+  return DecodeAPNG(bytes, color_hints, ppf, constraints, frame_callback);
+#else
+  return false;
+#endif
+}
+
 }  // namespace extras
 }  // namespace jxl
@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 
+#include <functional>
+
 #include "lib/extras/dec/color_hints.h"
 #include "lib/extras/packed_image.h"
 #include "lib/jxl/base/data_parallel.h"
@@ -30,6 +32,16 @@ Status DecodeImageAPNG(Span<const uint8_t> bytes, const ColorHints& color_hints,
                        PackedPixelFile* ppf,
                        const SizeConstraints* constraints = nullptr);
 
+// Decodes `bytes` frame by frame: each frame is passed to `frame_callback` as
+// soon as it is decoded instead of being stored in `ppf->frames`, so that it
+// can be consumed before the next one is decoded. Everything else in `ppf` is
+// final when the callback is first called. Returns false without calling the
+// callback for inputs with metadata chunks after the first frame.
+Status DecodeImageAPNGFrames(
+    Span<const uint8_t> bytes, const ColorHints& color_hints,
+    PackedPixelFile* ppf, const SizeConstraints* constraints,
+    const std::function<Status(PackedFrame&&)>& frame_callback);
+
 }  // namespace extras
 }  // namespace jxl
 
@@ -260,8 +260,13 @@ Status DecodeImageJPG(const Span<const uint8_t> bytes,
       return failure("ApplyColorHints failed");
     }
 
-    ppf->info.xsize = cinfo.image_width;
-    ppf->info.ysize = cinfo.image_height;
+    if (dparams) {
+      cinfo.scale_num = dparams->scale_num;
+      cinfo.scale_denom = dparams->scale_denom;
+    }
+    jpeg_calc_output_dimensions(&cinfo);
+    ppf->info.xsize = cinfo.output_width;
+    ppf->info.ysize = cinfo.output_height;
     // Original data is uint, so exponent_bits_per_sample = 0.
     ppf->info.bits_per_sample = BITS_IN_JSAMPLE;
     JXL_ASSERT(BITS_IN_JSAMPLE == 8 || BITS_IN_JSAMPLE == 16);
@@ -295,10 +300,10 @@ Status DecodeImageJPG(const Span<const uint8_t> bytes,
     };
     ppf->frames.clear();
     // Allocates the frame buffer.
-    ppf->frames.emplace_back(cinfo.image_width, cinfo.image_height, format);
+    ppf->frames.emplace_back(cinfo.output_width, cinfo.output_height, format);
     const auto& frame = ppf->frames.back();
     JXL_ASSERT(sizeof(JSAMPLE) * cinfo.out_color_components *
-                   cinfo.image_width <=
+                   cinfo.output_width <=
                frame.color.stride);
 
     if (cinfo.quantize_colors) {
@@ -310,13 +315,13 @@ Status DecodeImageJPG(const Span<const uint8_t> bytes,
             cinfo.actual_number_of_colors * sizeof(cinfo.colormap[c][0]));
       }
     }
-    for (size_t y = 0; y < cinfo.image_height; ++y) {
+    for (size_t y = 0; y < cinfo.output_height; ++y) {
       JSAMPROW rows[] = {reinterpret_cast<JSAMPLE*>(
           static_cast<uint8_t*>(frame.color.pixels()) +
           frame.color.stride * y)};
       jpeg_read_scanlines(&cinfo, rows, 1);
       msan::UnpoisonMemory(rows[0], sizeof(JSAMPLE) * cinfo.output_components *
-                                        cinfo.image_width);
+                                        cinfo.output_width);
       if (dparams && dparams->num_colors > 0) {
         UnmapColors(rows[0], cinfo.output_width, cinfo.out_color_components,
                     cinfo.colormap, cinfo.actual_number_of_colors);
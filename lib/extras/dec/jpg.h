@@ -30,6 +30,10 @@ struct JPGDecompressParams {
   bool two_pass_quant = false;
   // 0 = none, 1 = ordered, 2 = Floyd-Steinberg
   int dither_mode = 0;
+  // The image is decoded at scale_num / scale_denom of its size, using the
+  // reduced-size IDCTs of the JPEG library.
+  int scale_num = 1;
+  int scale_denom = 1;
 };
 
 // Decodes `bytes` into `ppf`. color_hints are ignored.
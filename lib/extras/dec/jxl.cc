@@ -9,6 +9,10 @@
 #include <jxl/decode_cxx.h>
 #include <jxl/types.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
 #include "lib/extras/dec/color_description.h"
 #include "lib/extras/enc/encode.h"
 #include "lib/jxl/base/printf_macros.h"
@@ -103,6 +107,91 @@ void UpdateBitDepth(JxlBitDepth bit_depth, JxlDataType data_type, T* info) {
   }
 }
 
+// Reports the lifetime of the decoder to
+// JXLDecompressParams::decoder_callback.
+class DecoderCallbackScope {
+ public:
+  DecoderCallbackScope(const std::function<void(JxlDecoder*)>& callback,
+                       JxlDecoder* dec)
+      : callback_(callback) {
+    if (callback_) callback_(dec);
+  }
+  ~DecoderCallbackScope() {
+    if (callback_) callback_(nullptr);
+  }
+
+ private:
+  const std::function<void(JxlDecoder*)>& callback_;
+};
+
+// JxlParallelRunner that runs each parallel stage of the decoder as tasks on
+// an executor. The calling thread works on the stage too, and then only waits
+// for the values that the other tasks already started. Tasks that start after
+// the stage is done return immediately.
+class ExecutorRunner {
+ public:
+  ExecutorRunner(const JXLExecutor& executor, size_t num_workers)
+      : executor_(executor), num_workers_(num_workers) {}
+
+  static JxlParallelRetCode Run(void* runner_opaque, void* jpegxl_opaque,
+                                JxlParallelRunInit init,
+                                JxlParallelRunFunction func,
+                                uint32_t start_range, uint32_t end_range) {
+    ExecutorRunner* self = static_cast<ExecutorRunner*>(runner_opaque);
+    const size_t num_values = end_range - start_range;
+    const size_t num_tasks =
+        std::min(self->num_workers_, num_values == 0 ? 0 : num_values - 1);
+    const JxlParallelRetCode init_ret = init(jpegxl_opaque, num_tasks + 1);
+    if (init_ret != 0) return init_ret;
+    std::shared_ptr<Stage> stage = std::make_shared<Stage>(
+        jpegxl_opaque, func, start_range, end_range);
+    for (size_t i = 0; i < num_tasks; ++i) {
+      self->executor_([stage, i]() { stage->Work(i + 1); });
+    }
+    stage->Work(0);
+    stage->Wait();
+    return 0;
+  }
+
+ private:
+  struct Stage {
+    Stage(void* opaque, JxlParallelRunFunction func, uint32_t start,
+          uint32_t end)
+        : opaque(opaque),
+          func(func),
+          next(start),
+          end(end),
+          remaining(end - start) {}
+
+    void Work(size_t thread) {
+      for (;;) {
+        const uint32_t value = next.fetch_add(1, std::memory_order_relaxed);
+        if (value >= end) return;
+        func(opaque, value, thread);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--remaining == 0) done.notify_all();
+      }
+    }
+
+    void Wait() {
+      std::unique_lock<std::mutex> lock(mutex);
+      done.wait(lock, [this]() { return remaining == 0; });
+    }
+
+    void* const opaque;
+    const JxlParallelRunFunction func;
+    std::atomic<uint32_t> next;
+    const uint32_t end;
+    std::mutex mutex;
+    std::condition_variable done;
+    // Number of values that are not finished yet, protected by mutex.
+    uint32_t remaining;
+  };
+
+  const JXLExecutor executor_;
+  const size_t num_workers_;
+};
+
 }  // namespace
 
 bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
@@ -114,6 +203,7 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
 
   auto decoder = JxlDecoderMake(/*memory_manager=*/nullptr);
   JxlDecoder* dec = decoder.get();
+  DecoderCallbackScope decoder_callback(dparams.decoder_callback, dec);
   ppf->frames.clear();
 
   if (dparams.runner_opaque != nullptr &&
@@ -179,6 +269,10 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
       fprintf(stderr, "JxlDecoderSetRenderSpotColors failed\n");
       return false;
     }
+    if (JXL_DEC_SUCCESS != JxlDecoderSetFastIDCT(dec, dparams.fast_idct)) {
+      fprintf(stderr, "JxlDecoderSetFastIDCT failed\n");
+      return false;
+    }
     if (JXL_DEC_SUCCESS !=
         JxlDecoderSetKeepOrientation(dec, dparams.keep_orientation)) {
       fprintf(stderr, "JxlDecoderSetKeepOrientation failed\n");
@@ -195,6 +289,12 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
       fprintf(stderr, "Decoder failed to set desired intensity target\n");
       return false;
     }
+    if (dparams.preserve_saturation >= 0 &&
+        JXL_DEC_SUCCESS != JxlDecoderSetGamutMapping(
+                               dec, JXL_TRUE, dparams.preserve_saturation)) {
+      fprintf(stderr, "Decoder failed to set gamut mapping\n");
+      return false;
+    }
     if (JXL_DEC_SUCCESS != JxlDecoderSetDecompressBoxes(dec, JXL_TRUE)) {
       fprintf(stderr, "JxlDecoderSetDecompressBoxes failed\n");
       return false;
@@ -209,7 +309,13 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
   BoxProcessor boxes(dec);
   for (;;) {
     JxlDecoderStatus status = JxlDecoderProcessInput(dec);
-    if (status == JXL_DEC_ERROR) {
+    // Stopping on request is not an error, so it is not reported.
+    if (dparams.event_callback && !dparams.event_callback(status)) {
+      return false;
+    }
+    if (status == JXL_DEC_CANCELLED) {
+      return false;
+    } else if (status == JXL_DEC_ERROR) {
       fprintf(stderr, "Failed to decode image\n");
       return false;
     } else if (status == JXL_DEC_NEED_MORE_INPUT) {
@@ -564,5 +670,47 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
   return true;
 }
 
+void JXLAsyncDecode::Cancel() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  cancelled_.store(true, std::memory_order_relaxed);
+  if (dec_ != nullptr) JxlDecoderCancel(dec_);
+}
+
+void JXLAsyncDecode::SetDecoder(JxlDecoder* dec) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  dec_ = dec;
+  // Cancel() may have been called before the decoder existed.
+  if (dec_ != nullptr && IsCancelled()) JxlDecoderCancel(dec_);
+}
+
+std::shared_ptr<JXLAsyncDecode> DecodeImageJXLAsync(
+    const uint8_t* bytes, size_t bytes_size,
+    const JXLDecompressParams& dparams, const JXLExecutor& executor,
+    size_t num_workers,
+    std::function<void(bool, const PackedPixelFile&)> on_done) {
+  std::shared_ptr<JXLAsyncDecode> handle = std::make_shared<JXLAsyncDecode>();
+  handle->result_ = handle->promise_.get_future().share();
+  JXLDecompressParams params = dparams;
+  JXLAsyncDecode* state = handle.get();
+  params.decoder_callback = [state, dparams](JxlDecoder* dec) {
+    state->SetDecoder(dec);
+    if (dparams.decoder_callback) dparams.decoder_callback(dec);
+  };
+  executor([handle, bytes, bytes_size, params, executor, num_workers,
+            on_done]() mutable {
+    ExecutorRunner runner(executor, num_workers);
+    if (params.runner_opaque == nullptr) {
+      params.runner = &ExecutorRunner::Run;
+      params.runner_opaque = &runner;
+    }
+    bool ok = !handle->IsCancelled() &&
+              DecodeImageJXL(bytes, bytes_size, params,
+                             /*decoded_bytes=*/nullptr, &handle->ppf_);
+    if (on_done) on_done(ok, handle->ppf_);
+    handle->promise_.set_value(ok);
+  });
+  return handle;
+}
+
 }  // namespace extras
 }  // namespace jxl
@@ -8,11 +8,17 @@
 
 // Decodes JPEG XL images in memory.
 
+#include <jxl/decode.h>
 #include <jxl/parallel_runner.h>
 #include <jxl/types.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -29,8 +35,13 @@ struct JXLDecompressParams {
   std::string color_space;
   // If set, performs tone mapping to this intensity target luminance.
   float display_nits = 0.0;
+  // If in [0, 1], maps out-of-gamut colors into the output color space with
+  // this weight on saturation (versus luminance) preservation.
+  float preserve_saturation = -1.0f;
   // Whether spot colors are rendered on the image.
   bool render_spotcolors = true;
+  // Whether to use the faster, approximate inverse DCT.
+  bool fast_idct = false;
   // Whether to keep or undo the orientation given in the header.
   bool keep_orientation = false;
 
@@ -60,6 +71,15 @@ struct JXLDecompressParams {
 
   // Controls the effective bit depth of the output pixels.
   JxlBitDepth output_bitdepth = {JXL_BIT_DEPTH_FROM_CODESTREAM, 0, 0};
+
+  // If set, called with each event returned by the decoder, e.g. to report
+  // progress. Decoding stops with failure if it returns false.
+  std::function<bool(JxlDecoderStatus)> event_callback;
+
+  // If set, called with the decoder right after it is created, and with
+  // nullptr before it is destroyed, e.g. to call JxlDecoderCancel() on it from
+  // another thread.
+  std::function<void(JxlDecoder*)> decoder_callback;
 };
 
 bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
@@ -67,6 +87,65 @@ bool DecodeImageJXL(const uint8_t* bytes, size_t bytes_size,
                     PackedPixelFile* ppf,
                     std::vector<uint8_t>* jpeg_bytes = nullptr);
 
+// Runs a task, e.g. by posting it to a thread pool shared by many decodes.
+typedef std::function<void(std::function<void()>)> JXLExecutor;
+
+// Handle of a decode started with DecodeImageJXLAsync().
+class JXLAsyncDecode {
+ public:
+  // Stops the decode with JxlDecoderCancel(); it then completes with failure.
+  // Can be called from any thread.
+  void Cancel();
+  bool IsCancelled() const {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+  // Becomes ready with the result of DecodeImageJXL() when the decode is
+  // finished.
+  std::shared_future<bool> result() const { return result_; }
+
+  // The decoded image, can only be accessed after the decode finished.
+  const PackedPixelFile& ppf() const { return ppf_; }
+
+ private:
+  friend std::shared_ptr<JXLAsyncDecode> DecodeImageJXLAsync(
+      const uint8_t* bytes, size_t bytes_size,
+      const JXLDecompressParams& dparams, const JXLExecutor& executor,
+      size_t num_workers,
+      std::function<void(bool, const PackedPixelFile&)> on_done);
+
+  void SetDecoder(JxlDecoder* dec);
+
+  std::atomic<bool> cancelled_{false};
+  // Protects dec_, which is only set while the decoder exists.
+  std::mutex mutex_;
+  JxlDecoder* dec_ = nullptr;
+  std::promise<bool> promise_;
+  std::shared_future<bool> result_;
+  PackedPixelFile ppf_;
+};
+
+// Convenience wrapper that runs DecodeImageJXL() with tasks on `executor` and
+// returns without waiting for them. This is not a non-blocking decoder: the
+// decoder itself is still driven with the synchronous JxlDecoderProcessInput(),
+// so one task of the executor is occupied until the whole decode is finished,
+// and the input must be complete when the decode starts.
+//
+// Unless dparams sets a parallel runner, each parallel stage of the decoder
+// (e.g. decoding and rendering the groups of a frame) is also split into up to
+// `num_workers` more tasks, so
+// `num_workers` is typically the number of threads of the executor. The
+// driving task works on these stages too, and then only waits for the tasks
+// that already started, so it does not deadlock on a busy executor. The
+// caller must keep `bytes` alive until the decode is finished. If set,
+// `on_done` is called from the driving task with the result and the decoded
+// image before the result of the handle becomes ready.
+std::shared_ptr<JXLAsyncDecode> DecodeImageJXLAsync(
+    const uint8_t* bytes, size_t bytes_size,
+    const JXLDecompressParams& dparams, const JXLExecutor& executor,
+    size_t num_workers,
+    std::function<void(bool, const PackedPixelFile&)> on_done = nullptr);
+
 }  // namespace extras
 }  // namespace jxl
 
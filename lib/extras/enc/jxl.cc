@@ -8,6 +8,12 @@
 #include <jxl/encode.h>
 #include <jxl/encode_cxx.h>
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 #include "lib/jxl/exif.h"
 
 namespace jxl {
@@ -36,12 +42,10 @@ bool SetFrameOptions(const std::vector<JXLOption>& options, size_t frame_index,
   return true;
 }
 
-bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
-                    const std::vector<uint8_t>* jpeg_bytes,
-                    std::vector<uint8_t>* compressed) {
-  auto encoder = JxlEncoderMake(/*memory_manager=*/nullptr);
-  JxlEncoder* enc = encoder.get();
+namespace {
 
+bool InitEncoder(const JXLCompressParams& params, JxlEncoder* enc,
+                 JxlEncoderFrameSettings** settings, size_t* option_idx) {
   if (params.allow_expert_options) {
     JxlEncoderAllowExpertOptions(enc);
   }
@@ -53,26 +57,257 @@ bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
     return false;
   }
 
-  auto settings = JxlEncoderFrameSettingsCreate(enc, nullptr);
-  size_t option_idx = 0;
-  if (!SetFrameOptions(params.options, 0, &option_idx, settings)) {
+  *settings = JxlEncoderFrameSettingsCreate(enc, nullptr);
+  if (!SetFrameOptions(params.options, 0, option_idx, *settings)) {
     return false;
   }
   if (JXL_ENC_SUCCESS !=
-      JxlEncoderSetFrameDistance(settings, params.distance)) {
+      JxlEncoderSetFrameDistance(*settings, params.distance)) {
     fprintf(stderr, "Setting frame distance failed.\n");
     return false;
   }
   if (params.debug_image) {
-    JxlEncoderSetDebugImageCallback(settings, params.debug_image,
+    JxlEncoderSetDebugImageCallback(*settings, params.debug_image,
                                     params.debug_image_opaque);
   }
   if (params.stats) {
-    JxlEncoderCollectStats(settings, params.stats);
+    JxlEncoderCollectStats(*settings, params.stats);
+  }
+  return true;
+}
+
+// Sets everything but the frames of pixel input.
+bool SetImageInfo(const JXLCompressParams& params, const PackedPixelFile& ppf,
+                  bool use_boxes, JxlEncoder* enc,
+                  JxlEncoderFrameSettings* settings) {
+  size_t num_alpha_channels = 0;  // Adjusted below.
+  JxlBasicInfo basic_info = ppf.info;
+  basic_info.xsize *= params.already_downsampled;
+  basic_info.ysize *= params.already_downsampled;
+  if (basic_info.alpha_bits > 0) num_alpha_channels = 1;
+  if (params.intensity_target > 0) {
+    basic_info.intensity_target = params.intensity_target;
+  }
+  basic_info.num_extra_channels =
+      std::max<uint32_t>(num_alpha_channels, ppf.info.num_extra_channels);
+  basic_info.num_color_channels = ppf.info.num_color_channels;
+  const bool lossless = params.distance == 0;
+  basic_info.uses_original_profile = lossless;
+  if (params.override_bitdepth != 0) {
+    basic_info.bits_per_sample = params.override_bitdepth;
+    basic_info.exponent_bits_per_sample =
+        params.override_bitdepth == 32 ? 8 : 0;
+  }
+  if (JXL_ENC_SUCCESS !=
+      JxlEncoderSetCodestreamLevel(enc, params.codestream_level)) {
+    fprintf(stderr, "Setting --codestream_level failed.\n");
+    return false;
+  }
+  if (JXL_ENC_SUCCESS != JxlEncoderSetBasicInfo(enc, &basic_info)) {
+    fprintf(stderr, "JxlEncoderSetBasicInfo() failed.\n");
+    return false;
+  }
+  if (JXL_ENC_SUCCESS !=
+      JxlEncoderSetUpsamplingMode(enc, params.already_downsampled,
+                                  params.upsampling_mode)) {
+    fprintf(stderr, "JxlEncoderSetUpsamplingMode() failed.\n");
+    return false;
+  }
+  if (JXL_ENC_SUCCESS !=
+      JxlEncoderSetFrameBitDepth(settings, &params.input_bitdepth)) {
+    fprintf(stderr, "JxlEncoderSetFrameBitDepth() failed.\n");
+    return false;
+  }
+  if (num_alpha_channels != 0 &&
+      JXL_ENC_SUCCESS != JxlEncoderSetExtraChannelDistance(
+                             settings, 0, params.alpha_distance)) {
+    fprintf(stderr, "Setting alpha distance failed.\n");
+    return false;
+  }
+  if (lossless &&
+      JXL_ENC_SUCCESS != JxlEncoderSetFrameLossless(settings, JXL_TRUE)) {
+    fprintf(stderr, "JxlEncoderSetFrameLossless() failed.\n");
+    return false;
+  }
+  if (!ppf.icc.empty()) {
+    if (JXL_ENC_SUCCESS !=
+        JxlEncoderSetICCProfile(enc, ppf.icc.data(), ppf.icc.size())) {
+      fprintf(stderr, "JxlEncoderSetICCProfile() failed.\n");
+      return false;
+    }
+  } else {
+    if (JXL_ENC_SUCCESS !=
+        JxlEncoderSetColorEncoding(enc, &ppf.color_encoding)) {
+      fprintf(stderr, "JxlEncoderSetColorEncoding() failed.\n");
+      return false;
+    }
+  }
+
+  if (use_boxes) {
+    if (JXL_ENC_SUCCESS != JxlEncoderUseBoxes(enc)) {
+      fprintf(stderr, "JxlEncoderUseBoxes() failed.\n");
+      return false;
+    }
+    // Prepend 4 zero bytes to exif for tiff header offset
+    std::vector<uint8_t> exif_with_offset;
+    bool bigendian;
+    if (IsExif(ppf.metadata.exif, &bigendian)) {
+      exif_with_offset.resize(ppf.metadata.exif.size() + 4);
+      memcpy(exif_with_offset.data() + 4, ppf.metadata.exif.data(),
+             ppf.metadata.exif.size());
+    }
+    const struct BoxInfo {
+      const char* type;
+      const std::vector<uint8_t>& bytes;
+    } boxes[] = {
+        {"Exif", exif_with_offset},
+        {"xml ", ppf.metadata.xmp},
+        {"jumb", ppf.metadata.jumbf},
+        {"xml ", ppf.metadata.iptc},
+    };
+    for (size_t i = 0; i < sizeof boxes / sizeof *boxes; ++i) {
+      const BoxInfo& box = boxes[i];
+      if (!box.bytes.empty() &&
+          JXL_ENC_SUCCESS != JxlEncoderAddBox(enc, box.type, box.bytes.data(),
+                                              box.bytes.size(),
+                                              params.compress_boxes)) {
+        fprintf(stderr, "JxlEncoderAddBox() failed (%s).\n", box.type);
+        return false;
+      }
+    }
+    JxlEncoderCloseBoxes(enc);
   }
+  return true;
+}
 
-  bool use_boxes = !ppf.metadata.exif.empty() || !ppf.metadata.xmp.empty() ||
-                   !ppf.metadata.jumbf.empty() || !ppf.metadata.iptc.empty();
+// Adds the frame with index `num_frame` of pixel input described by `ppf`.
+bool AddFrame(const JXLCompressParams& params, const PackedPixelFile& ppf,
+              const PackedFrame& pframe, size_t num_frame, size_t* option_idx,
+              JxlEncoder* enc, JxlEncoderFrameSettings* settings) {
+  size_t num_alpha_channels = ppf.info.alpha_bits > 0 ? 1 : 0;
+  const jxl::extras::PackedImage& pimage = pframe.color;
+  JxlPixelFormat ppixelformat = pimage.format;
+  if (JXL_ENC_SUCCESS !=
+      JxlEncoderSetFrameHeader(settings, &pframe.frame_info)) {
+    fprintf(stderr, "JxlEncoderSetFrameHeader() failed.\n");
+    return false;
+  }
+  if (!SetFrameOptions(params.options, num_frame, option_idx, settings)) {
+    return false;
+  }
+  if (num_alpha_channels > 0) {
+    JxlExtraChannelInfo extra_channel_info;
+    JxlEncoderInitExtraChannelInfo(JXL_CHANNEL_ALPHA, &extra_channel_info);
+    extra_channel_info.bits_per_sample = ppf.info.alpha_bits;
+    extra_channel_info.exponent_bits_per_sample =
+        ppf.info.alpha_exponent_bits;
+    if (params.premultiply != -1) {
+      if (params.premultiply != 0 && params.premultiply != 1) {
+        fprintf(stderr, "premultiply must be one of: -1, 0, 1.\n");
+        return false;
+      }
+      extra_channel_info.alpha_premultiplied = params.premultiply;
+    }
+    if (JXL_ENC_SUCCESS !=
+        JxlEncoderSetExtraChannelInfo(enc, 0, &extra_channel_info)) {
+      fprintf(stderr, "JxlEncoderSetExtraChannelInfo() failed.\n");
+      return false;
+    }
+    // We take the extra channel blend info frame_info, but don't do
+    // clamping.
+    JxlBlendInfo extra_channel_blend_info =
+        pframe.frame_info.layer_info.blend_info;
+    extra_channel_blend_info.clamp = JXL_FALSE;
+    JxlEncoderSetExtraChannelBlendInfo(settings, 0, &extra_channel_blend_info);
+  }
+  size_t num_interleaved_alpha =
+      (ppixelformat.num_channels - ppf.info.num_color_channels);
+  // Add extra channel info for the rest of the extra channels.
+  for (size_t i = 0; i < ppf.info.num_extra_channels; ++i) {
+    if (i < ppf.extra_channels_info.size()) {
+      const auto& ec_info = ppf.extra_channels_info[i].ec_info;
+      if (JXL_ENC_SUCCESS !=
+          JxlEncoderSetExtraChannelInfo(enc, num_interleaved_alpha + i,
+                                        &ec_info)) {
+        fprintf(stderr, "JxlEncoderSetExtraChannelInfo() failed.\n");
+        return false;
+      }
+    }
+  }
+  if (JXL_ENC_SUCCESS != JxlEncoderAddImageFrame(settings, &ppixelformat,
+                                                 pimage.pixels(),
+                                                 pimage.pixels_size)) {
+    fprintf(stderr, "JxlEncoderAddImageFrame() failed.\n");
+    return false;
+  }
+  // Only set extra channel buffer if it is provided non-interleaved.
+  for (size_t i = 0; i < pframe.extra_channels.size(); ++i) {
+    if (JXL_ENC_SUCCESS !=
+        JxlEncoderSetExtraChannelBuffer(settings, &ppixelformat,
+                                        pframe.extra_channels[i].pixels(),
+                                        pframe.extra_channels[i].stride *
+                                            pframe.extra_channels[i].ysize,
+                                        num_interleaved_alpha + i)) {
+      fprintf(stderr, "JxlEncoderSetExtraChannelBuffer() failed.\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+// Appends all available output of `enc` to `compressed`.
+bool ReadOutput(JxlEncoder* enc, std::vector<uint8_t>* compressed) {
+  size_t offset = compressed->size();
+  compressed->resize(std::max<size_t>(4096, 2 * offset));
+  uint8_t* next_out = compressed->data() + offset;
+  size_t avail_out = compressed->size() - offset;
+  JxlEncoderStatus result = JXL_ENC_NEED_MORE_OUTPUT;
+  while (result == JXL_ENC_NEED_MORE_OUTPUT) {
+    result = JxlEncoderProcessOutput(enc, &next_out, &avail_out);
+    if (result == JXL_ENC_NEED_MORE_OUTPUT) {
+      offset = next_out - compressed->data();
+      compressed->resize(compressed->size() * 2);
+      next_out = compressed->data() + offset;
+      avail_out = compressed->size() - offset;
+    }
+  }
+  compressed->resize(next_out - compressed->data());
+  if (result != JXL_ENC_SUCCESS) {
+    fprintf(stderr, "JxlEncoderProcessOutput failed.\n");
+    return false;
+  }
+  return true;
+}
+
+bool UseBoxes(const PackedPixelFile& ppf) {
+  return !ppf.metadata.exif.empty() || !ppf.metadata.xmp.empty() ||
+         !ppf.metadata.jumbf.empty() || !ppf.metadata.iptc.empty();
+}
+
+// Copies all of `ppf` except its frames to `header`.
+void CopyHeader(const PackedPixelFile& ppf, PackedPixelFile* header) {
+  header->info = ppf.info;
+  header->extra_channels_info = ppf.extra_channels_info;
+  header->icc = ppf.icc;
+  header->color_encoding = ppf.color_encoding;
+  header->orig_icc = ppf.orig_icc;
+  header->metadata = ppf.metadata;
+}
+
+}  // namespace
+
+bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
+                    const std::vector<uint8_t>* jpeg_bytes,
+                    std::vector<uint8_t>* compressed) {
+  auto encoder = JxlEncoderMake(/*memory_manager=*/nullptr);
+  JxlEncoder* enc = encoder.get();
+  JxlEncoderFrameSettings* settings;
+  size_t option_idx = 0;
+  if (!InitEncoder(params, enc, &settings, &option_idx)) {
+    return false;
+  }
+
+  bool use_boxes = UseBoxes(ppf);
   bool use_container = params.use_container || use_boxes ||
                        (jpeg_bytes && params.jpeg_store_metadata);
 
@@ -110,7 +345,8 @@ bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
       } else if (error == JXL_ENC_ERR_JBRD) {
         fprintf(stderr,
                 "JPEG bitstream reconstruction data could not be created. "
-                "Possibly there is too much tail data.\n"
+                "Possibly there is too much tail data, or the JPEG is "
+                "arithmetic coded.\n"
                 "Try using --jpeg_store_metadata 0, to losslessly "
                 "recompress the JPEG image data without bitstream "
                 "reconstruction data.\n");
@@ -120,198 +356,106 @@ bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
       return false;
     }
   } else {
-    size_t num_alpha_channels = 0;  // Adjusted below.
-    JxlBasicInfo basic_info = ppf.info;
-    basic_info.xsize *= params.already_downsampled;
-    basic_info.ysize *= params.already_downsampled;
-    if (basic_info.alpha_bits > 0) num_alpha_channels = 1;
-    if (params.intensity_target > 0) {
-      basic_info.intensity_target = params.intensity_target;
-    }
-    basic_info.num_extra_channels =
-        std::max<uint32_t>(num_alpha_channels, ppf.info.num_extra_channels);
-    basic_info.num_color_channels = ppf.info.num_color_channels;
-    const bool lossless = params.distance == 0;
-    basic_info.uses_original_profile = lossless;
-    if (params.override_bitdepth != 0) {
-      basic_info.bits_per_sample = params.override_bitdepth;
-      basic_info.exponent_bits_per_sample =
-          params.override_bitdepth == 32 ? 8 : 0;
-    }
-    if (JXL_ENC_SUCCESS !=
-        JxlEncoderSetCodestreamLevel(enc, params.codestream_level)) {
-      fprintf(stderr, "Setting --codestream_level failed.\n");
-      return false;
-    }
-    if (JXL_ENC_SUCCESS != JxlEncoderSetBasicInfo(enc, &basic_info)) {
-      fprintf(stderr, "JxlEncoderSetBasicInfo() failed.\n");
-      return false;
-    }
-    if (JXL_ENC_SUCCESS !=
-        JxlEncoderSetUpsamplingMode(enc, params.already_downsampled,
-                                    params.upsampling_mode)) {
-      fprintf(stderr, "JxlEncoderSetUpsamplingMode() failed.\n");
-      return false;
-    }
-    if (JXL_ENC_SUCCESS !=
-        JxlEncoderSetFrameBitDepth(settings, &params.input_bitdepth)) {
-      fprintf(stderr, "JxlEncoderSetFrameBitDepth() failed.\n");
+    if (!SetImageInfo(params, ppf, use_boxes, enc, settings)) {
       return false;
     }
-    if (num_alpha_channels != 0 &&
-        JXL_ENC_SUCCESS != JxlEncoderSetExtraChannelDistance(
-                               settings, 0, params.alpha_distance)) {
-      fprintf(stderr, "Setting alpha distance failed.\n");
-      return false;
-    }
-    if (lossless &&
-        JXL_ENC_SUCCESS != JxlEncoderSetFrameLossless(settings, JXL_TRUE)) {
-      fprintf(stderr, "JxlEncoderSetFrameLossless() failed.\n");
-      return false;
-    }
-    if (!ppf.icc.empty()) {
-      if (JXL_ENC_SUCCESS !=
-          JxlEncoderSetICCProfile(enc, ppf.icc.data(), ppf.icc.size())) {
-        fprintf(stderr, "JxlEncoderSetICCProfile() failed.\n");
-        return false;
-      }
-    } else {
-      if (JXL_ENC_SUCCESS !=
-          JxlEncoderSetColorEncoding(enc, &ppf.color_encoding)) {
-        fprintf(stderr, "JxlEncoderSetColorEncoding() failed.\n");
+    for (size_t num_frame = 0; num_frame < ppf.frames.size(); ++num_frame) {
+      if (!AddFrame(params, ppf, ppf.frames[num_frame], num_frame, &option_idx,
+                    enc, settings)) {
         return false;
       }
     }
+  }
+  JxlEncoderCloseInput(enc);
+  compressed->clear();
+  return ReadOutput(enc, compressed);
+}
 
-    if (use_boxes) {
-      if (JXL_ENC_SUCCESS != JxlEncoderUseBoxes(enc)) {
-        fprintf(stderr, "JxlEncoderUseBoxes() failed.\n");
-        return false;
-      }
-      // Prepend 4 zero bytes to exif for tiff header offset
-      std::vector<uint8_t> exif_with_offset;
-      bool bigendian;
-      if (IsExif(ppf.metadata.exif, &bigendian)) {
-        exif_with_offset.resize(ppf.metadata.exif.size() + 4);
-        memcpy(exif_with_offset.data() + 4, ppf.metadata.exif.data(),
-               ppf.metadata.exif.size());
-      }
-      const struct BoxInfo {
-        const char* type;
-        const std::vector<uint8_t>& bytes;
-      } boxes[] = {
-          {"Exif", exif_with_offset},
-          {"xml ", ppf.metadata.xmp},
-          {"jumb", ppf.metadata.jumbf},
-          {"xml ", ppf.metadata.iptc},
-      };
-      for (size_t i = 0; i < sizeof boxes / sizeof *boxes; ++i) {
-        const BoxInfo& box = boxes[i];
-        if (!box.bytes.empty() &&
-            JXL_ENC_SUCCESS != JxlEncoderAddBox(enc, box.type, box.bytes.data(),
-                                                box.bytes.size(),
-                                                params.compress_boxes)) {
-          fprintf(stderr, "JxlEncoderAddBox() failed (%s).\n", box.type);
-          return false;
-        }
-      }
-      JxlEncoderCloseBoxes(enc);
+bool EncodeImageJXLFrameByFrame(const JXLCompressParams& params,
+                                const FrameByFrameDecoder& decoder,
+                                PackedPixelFile* ppf, size_t* num_frames,
+                                std::vector<uint8_t>* compressed) {
+  // The decoder runs on its own thread and hands over one frame at a time.
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::unique_ptr<PackedFrame> next_frame;
+  bool have_header = false;
+  bool decoder_done = false;
+  bool aborted = false;
+  Status decoder_status = true;
+  PackedPixelFile decoder_ppf;
+  std::thread decoder_thread([&]() {
+    Status status = decoder(
+        &decoder_ppf, [&](PackedFrame&& frame) -> Status {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv.wait(lock, [&] { return !next_frame || aborted; });
+          if (aborted) return false;
+          if (!have_header) {
+            CopyHeader(decoder_ppf, ppf);
+            have_header = true;
+          }
+          next_frame.reset(new PackedFrame(std::move(frame)));
+          cv.notify_all();
+          return true;
+        });
+    std::lock_guard<std::mutex> lock(mutex);
+    decoder_status = status;
+    decoder_done = true;
+    cv.notify_all();
+  });
+  const auto next = [&]() -> std::unique_ptr<PackedFrame> {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return next_frame || decoder_done; });
+    std::unique_ptr<PackedFrame> frame = std::move(next_frame);
+    cv.notify_all();
+    return frame;
+  };
+  const auto finish = [&](bool ok) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      aborted = !ok;
+      cv.notify_all();
     }
+    decoder_thread.join();
+    return ok && static_cast<bool>(decoder_status);
+  };
 
-    for (size_t num_frame = 0; num_frame < ppf.frames.size(); ++num_frame) {
-      const jxl::extras::PackedFrame& pframe = ppf.frames[num_frame];
-      const jxl::extras::PackedImage& pimage = pframe.color;
-      JxlPixelFormat ppixelformat = pimage.format;
+  auto encoder = JxlEncoderMake(/*memory_manager=*/nullptr);
+  JxlEncoder* enc = encoder.get();
+  JxlEncoderFrameSettings* settings;
+  size_t option_idx = 0;
+  *num_frames = 0;
+  compressed->clear();
+  if (!InitEncoder(params, enc, &settings, &option_idx)) {
+    return finish(false);
+  }
+  while (std::unique_ptr<PackedFrame> frame = next()) {
+    if (*num_frames == 0) {
+      // The header is final once the first frame is decoded.
+      bool use_boxes = UseBoxes(*ppf);
+      bool use_container = params.use_container || use_boxes;
       if (JXL_ENC_SUCCESS !=
-          JxlEncoderSetFrameHeader(settings, &pframe.frame_info)) {
-        fprintf(stderr, "JxlEncoderSetFrameHeader() failed.\n");
-        return false;
-      }
-      if (!SetFrameOptions(params.options, num_frame, &option_idx, settings)) {
-        return false;
-      }
-      if (num_alpha_channels > 0) {
-        JxlExtraChannelInfo extra_channel_info;
-        JxlEncoderInitExtraChannelInfo(JXL_CHANNEL_ALPHA, &extra_channel_info);
-        extra_channel_info.bits_per_sample = ppf.info.alpha_bits;
-        extra_channel_info.exponent_bits_per_sample =
-            ppf.info.alpha_exponent_bits;
-        if (params.premultiply != -1) {
-          if (params.premultiply != 0 && params.premultiply != 1) {
-            fprintf(stderr, "premultiply must be one of: -1, 0, 1.\n");
-            return false;
-          }
-          extra_channel_info.alpha_premultiplied = params.premultiply;
-        }
-        if (JXL_ENC_SUCCESS !=
-            JxlEncoderSetExtraChannelInfo(enc, 0, &extra_channel_info)) {
-          fprintf(stderr, "JxlEncoderSetExtraChannelInfo() failed.\n");
-          return false;
-        }
-        // We take the extra channel blend info frame_info, but don't do
-        // clamping.
-        JxlBlendInfo extra_channel_blend_info =
-            pframe.frame_info.layer_info.blend_info;
-        extra_channel_blend_info.clamp = JXL_FALSE;
-        JxlEncoderSetExtraChannelBlendInfo(settings, 0,
-                                           &extra_channel_blend_info);
-      }
-      size_t num_interleaved_alpha =
-          (ppixelformat.num_channels - ppf.info.num_color_channels);
-      // Add extra channel info for the rest of the extra channels.
-      for (size_t i = 0; i < ppf.info.num_extra_channels; ++i) {
-        if (i < ppf.extra_channels_info.size()) {
-          const auto& ec_info = ppf.extra_channels_info[i].ec_info;
-          if (JXL_ENC_SUCCESS !=
-              JxlEncoderSetExtraChannelInfo(enc, num_interleaved_alpha + i,
-                                            &ec_info)) {
-            fprintf(stderr, "JxlEncoderSetExtraChannelInfo() failed.\n");
-            return false;
-          }
-        }
-      }
-      if (JXL_ENC_SUCCESS != JxlEncoderAddImageFrame(settings, &ppixelformat,
-                                                     pimage.pixels(),
-                                                     pimage.pixels_size)) {
-        fprintf(stderr, "JxlEncoderAddImageFrame() failed.\n");
-        return false;
+          JxlEncoderUseContainer(enc, static_cast<int>(use_container))) {
+        fprintf(stderr, "JxlEncoderUseContainer failed.\n");
+        return finish(false);
       }
-      // Only set extra channel buffer if it is provided non-interleaved.
-      for (size_t i = 0; i < pframe.extra_channels.size(); ++i) {
-        if (JXL_ENC_SUCCESS !=
-            JxlEncoderSetExtraChannelBuffer(settings, &ppixelformat,
-                                            pframe.extra_channels[i].pixels(),
-                                            pframe.extra_channels[i].stride *
-                                                pframe.extra_channels[i].ysize,
-                                            num_interleaved_alpha + i)) {
-          fprintf(stderr, "JxlEncoderSetExtraChannelBuffer() failed.\n");
-          return false;
-        }
+      if (!SetImageInfo(params, *ppf, use_boxes, enc, settings)) {
+        return finish(false);
       }
+    } else if (!ReadOutput(enc, compressed)) {
+      // Encodes the previous frame, which is now known not to be the last.
+      return finish(false);
     }
-  }
-  JxlEncoderCloseInput(enc);
-  // Reading compressed output
-  compressed->clear();
-  compressed->resize(4096);
-  uint8_t* next_out = compressed->data();
-  size_t avail_out = compressed->size() - (next_out - compressed->data());
-  JxlEncoderStatus result = JXL_ENC_NEED_MORE_OUTPUT;
-  while (result == JXL_ENC_NEED_MORE_OUTPUT) {
-    result = JxlEncoderProcessOutput(enc, &next_out, &avail_out);
-    if (result == JXL_ENC_NEED_MORE_OUTPUT) {
-      size_t offset = next_out - compressed->data();
-      compressed->resize(compressed->size() * 2);
-      next_out = compressed->data() + offset;
-      avail_out = compressed->size() - offset;
+    if (!AddFrame(params, *ppf, *frame, *num_frames, &option_idx, enc,
+                  settings)) {
+      return finish(false);
     }
+    ++*num_frames;
   }
-  compressed->resize(next_out - compressed->data());
-  if (result != JXL_ENC_SUCCESS) {
-    fprintf(stderr, "JxlEncoderProcessOutput failed.\n");
-    return false;
-  }
-  return true;
+  if (!finish(true)) return false;
+  if (*num_frames == 0) return false;
+  JxlEncoderCloseInput(enc);
+  return ReadOutput(enc, compressed);
 }
 
 }  // namespace extras
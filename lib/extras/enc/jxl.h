@@ -12,9 +12,11 @@
 #include <jxl/types.h>
 #include <stdint.h>
 
+#include <functional>
 #include <vector>
 
 #include "lib/extras/packed_image.h"
+#include "lib/jxl/base/status.h"
 
 namespace jxl {
 namespace extras {
@@ -79,6 +81,24 @@ bool EncodeImageJXL(const JXLCompressParams& params, const PackedPixelFile& ppf,
                     const std::vector<uint8_t>* jpeg_bytes,
                     std::vector<uint8_t>* compressed);
 
+// Decodes an image frame by frame: fills in everything but the frames of
+// `ppf`, and passes each frame to `frame_callback` as soon as it is decoded.
+// See DecodeImageAPNGFrames.
+using FrameByFrameDecoder = std::function<Status(
+    PackedPixelFile* ppf,
+    const std::function<Status(PackedFrame&&)>& frame_callback)>;
+
+// Same as EncodeImageJXL for pixel input, but runs `decoder` on a separate
+// thread and encodes each frame while the next one is being decoded. Peak
+// memory is a few frames instead of the whole decoded image. On success,
+// `ppf` holds everything but the frames of the image. `num_frames` is the
+// number of frames passed to the encoder; if it is 0 after a failure, the
+// caller can still fall back to decoding the whole image.
+bool EncodeImageJXLFrameByFrame(const JXLCompressParams& params,
+                                const FrameByFrameDecoder& decoder,
+                                PackedPixelFile* ppf, size_t* num_frames,
+                                std::vector<uint8_t>* compressed);
+
 }  // namespace extras
 }  // namespace jxl
 
@@ -23,6 +23,9 @@
 #include "lib/jxl/base/span.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/color_encoding_internal.h"
+#include "lib/jxl/jpeg/dec_jpeg_data_writer.h"
+#include "lib/jxl/jpeg/enc_jpeg_data_reader.h"
+#include "lib/jxl/jpeg/jpeg_data.h"
 #include "lib/jxl/test_image.h"
 #include "lib/jxl/test_utils.h"
 #include "lib/jxl/testing.h"
@@ -317,6 +320,97 @@ TEST(JpegliTest, JpegliSetAppData) {
   EXPECT_FALSE(EncodeJpeg(ppf_in, settings, nullptr, &compressed));
 }
 
+// Returns true if a non-zero AC coefficient follows more than 15 zero ones in
+// zig-zag order, which is coded with ZRL symbols.
+bool HasLongZeroRun(const jpeg::JPEGData& jpeg_data) {
+  for (const jpeg::JPEGComponent& c : jpeg_data.components) {
+    for (size_t i = 0; i < c.coeffs.size(); i += kDCTBlockSize) {
+      size_t run = 0;
+      for (size_t k = 1; k < kDCTBlockSize; ++k) {
+        if (c.coeffs[i + jpeg::kJPEGNaturalOrder[k]] == 0) {
+          ++run;
+        } else if (run > 15) {
+          return true;
+        } else {
+          run = 0;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// Returns true if the scan data contains a 0xFF byte, which is followed by a
+// stuffed zero byte.
+bool HasStuffedByte(const std::vector<uint8_t>& compressed) {
+  bool in_scan = false;
+  for (size_t i = 0; i + 1 < compressed.size(); ++i) {
+    if (compressed[i] != 0xFF) continue;
+    if (compressed[i + 1] == 0xDA) in_scan = true;
+    if (in_scan && compressed[i + 1] == 0) return true;
+  }
+  return false;
+}
+
+// jpegli and the JPEG reconstruction in lib/jxl/jpeg share the forming of the
+// Huffman symbols and the byte stuffing, so reconstructing a jpegli output
+// from its coefficients must give back the same bytes.
+TEST(JpegliTest,
+     JXL_TRANSCODE_JPEG_TEST(JpegliReconstructionIsByteIdentical)) {
+  TestImage t;
+  t.SetDimensions(256, 256).SetChannels(3);
+  t.SetAllBitDepths(8).SetEndianness(JXL_NATIVE_ENDIAN);
+  TestImage::Frame frame = t.AddFrame();
+  frame.RandomFill();
+  for (int progressive_level : {0, 2}) {
+    for (bool optimize_coding : {false, true}) {
+      JpegSettings settings;
+      settings.distance = 4.0f;
+      settings.progressive_level = progressive_level;
+      settings.optimize_coding = optimize_coding;
+      std::vector<uint8_t> compressed;
+      ASSERT_TRUE(EncodeJpeg(t.ppf(), settings, nullptr, &compressed));
+      EXPECT_TRUE(HasStuffedByte(compressed));
+
+      jpeg::JPEGData jpeg_data;
+      ASSERT_TRUE(jpeg::ReadJpeg(compressed.data(), compressed.size(),
+                                 jpeg::JpegReadMode::kReadAll, &jpeg_data));
+      EXPECT_TRUE(HasLongZeroRun(jpeg_data));
+      std::vector<uint8_t> reconstructed;
+      ASSERT_TRUE(jpeg::WriteJpeg(
+          jpeg_data, [&](const uint8_t* buf, size_t len) -> size_t {
+            reconstructed.insert(reconstructed.end(), buf, buf + len);
+            return len;
+          }));
+      EXPECT_EQ(compressed, reconstructed);
+    }
+  }
+}
+
+TEST(JpegliTest, LibjpegScaledDecodeTest) {
+  TEST_LIBJPEG_SUPPORT();
+  std::string testimage = "jxl/flower/flower_small.rgb.depth8.ppm";
+  PackedPixelFile ppf0;
+  ASSERT_TRUE(ReadTestImage(testimage, &ppf0));
+
+  std::vector<uint8_t> compressed;
+  ASSERT_TRUE(EncodeWithLibjpeg(ppf0, 90, &compressed));
+
+  for (int scale_denom : {2, 4, 8}) {
+    PackedPixelFile ppf1;
+    JPGDecompressParams dparams;
+    dparams.scale_denom = scale_denom;
+    ASSERT_TRUE(DecodeWithLibjpeg(compressed, &ppf1, &dparams));
+    EXPECT_EQ((ppf0.info.xsize + scale_denom - 1) / scale_denom,
+              ppf1.info.xsize);
+    EXPECT_EQ((ppf0.info.ysize + scale_denom - 1) / scale_denom,
+              ppf1.info.ysize);
+    ASSERT_EQ(1u, ppf1.frames.size());
+    EXPECT_EQ(ppf1.info.xsize, ppf1.frames[0].color.xsize);
+    EXPECT_EQ(ppf1.info.ysize, ppf1.frames[0].color.ysize);
+  }
+}
+
 struct TestConfig {
   int num_colors;
   int passes;
@@ -189,6 +189,19 @@ typedef enum {
    */
   JXL_DEC_BOX_NEED_MORE_OUTPUT = 7,
 
+  /** The estimated work needed to decode the image exceeds the budget set with
+   * @ref JxlDecoderSetWorkBudget. The check happens before the pixels of a
+   * frame are decoded. Like @ref JXL_DEC_ERROR, the decoder cannot be used
+   * anymore until @ref JxlDecoderReset is called.
+   */
+  JXL_DEC_WORK_BUDGET_EXCEEDED = 8,
+
+  /** Decoding was stopped by @ref JxlDecoderCancel. The decoder keeps
+   * returning this status until @ref JxlDecoderReset or @ref JxlDecoderRewind
+   * is called, after which it can be used again.
+   */
+  JXL_DEC_CANCELLED = 9,
+
   /** Informative event by @ref JxlDecoderProcessInput
    * "JxlDecoderProcessInput": Basic information such as image dimensions and
    * extra channels. This event occurs max once per image.
@@ -361,11 +374,15 @@ typedef enum {
  * settings set by a call to
  *  - @ref JxlDecoderSetCoalescing,
  *  - @ref JxlDecoderSetDesiredIntensityTarget,
+ *  - @ref JxlDecoderSetGamutMapping,
  *  - @ref JxlDecoderSetDecompressBoxes,
  *  - @ref JxlDecoderSetKeepOrientation,
  *  - @ref JxlDecoderSetUnpremultiplyAlpha,
  *  - @ref JxlDecoderSetParallelRunner,
- *  - @ref JxlDecoderSetRenderSpotcolors, and
+ *  - @ref JxlDecoderSetParallelPriorityRunner,
+ *  - @ref JxlDecoderSetPriority,
+ *  - @ref JxlDecoderSetRenderSpotcolors,
+ *  - @ref JxlDecoderSetWorkBudget, and
  *  - @ref JxlDecoderSubscribeEvents.
  *
  * @param dec decoder object
@@ -422,6 +439,49 @@ JXL_EXPORT JxlDecoderStatus
 JxlDecoderSetParallelRunner(JxlDecoder* dec, JxlParallelRunner parallel_runner,
                             void* parallel_runner_opaque);
 
+/**
+ * Same as @ref JxlDecoderSetParallelRunner, for a runner that also receives
+ * the priority hint of the decoder (see @ref JxlDecoderSetPriority) on every
+ * call. May only be set before starting decoding.
+ *
+ * @param dec decoder object
+ * @param parallel_runner function pointer to the priority-aware runner. It
+ *     may be NULL to use the default, single-threaded, runner.
+ * @param parallel_runner_opaque opaque pointer for parallel_runner.
+ * @return @ref JXL_DEC_SUCCESS if the runner was set, @ref JXL_DEC_ERROR
+ *     otherwise (the previous runner remains set).
+ */
+JXL_EXPORT JxlDecoderStatus JxlDecoderSetParallelPriorityRunner(
+    JxlDecoder* dec, JxlParallelPriorityRunner parallel_runner,
+    void* parallel_runner_opaque);
+
+/**
+ * Sets the scheduling priority hint of the decoder, see @ref JxlPriority. It
+ * is passed to the runner set with @ref JxlDecoderSetParallelPriorityRunner,
+ * and has no effect with other runners. Takes effect from the next call to
+ * @ref JxlDecoderProcessInput.
+ *
+ * @param dec decoder object
+ * @param priority one of the @ref JxlPriority values
+ * @return @ref JXL_DEC_SUCCESS if the priority was set, @ref JXL_DEC_ERROR
+ *     otherwise.
+ */
+JXL_EXPORT JxlDecoderStatus JxlDecoderSetPriority(JxlDecoder* dec,
+                                                  JxlPriority priority);
+
+/**
+ * Asks the decoder to stop as soon as possible. This is the only decoder
+ * function that may be called from another thread while @ref
+ * JxlDecoderProcessInput is running; it must not race with @ref
+ * JxlDecoderReset or @ref JxlDecoderDestroy. The decoder checks for
+ * cancellation between groups of a frame, so a running @ref
+ * JxlDecoderProcessInput returns @ref JXL_DEC_CANCELLED shortly after, as do
+ * all later calls, until the decoder is reset or rewound.
+ *
+ * @param dec decoder object
+ */
+JXL_EXPORT void JxlDecoderCancel(JxlDecoder* dec);
+
 /**
  * Returns a hint indicating how many more bytes the decoder is expected to
  * need to make @ref JxlDecoderGetBasicInfo available after the next @ref
@@ -519,6 +579,24 @@ JxlDecoderSetUnpremultiplyAlpha(JxlDecoder* dec, JXL_BOOL unpremul_alpha);
 JXL_EXPORT JxlDecoderStatus
 JxlDecoderSetRenderSpotcolors(JxlDecoder* dec, JXL_BOOL render_spotcolors);
 
+/** Enables or disables a faster, approximate inverse DCT for VarDCT frames.
+ * When enabled, the smaller DCTs (8x8 up to 16x16, which are the most common
+ * ones) are inverted with 16-bit fixed-point arithmetic instead of floats.
+ * The result is not conformant: the maximum error of a sample is 2^-6 before
+ * color conversion, which can change 8-bit output values by up to 4 levels.
+ * This is intended for previews and thumbnails. Lossless images, modular
+ * frames and JPEG reconstruction are not affected.
+ *
+ * This function must be called at the beginning, before decoding is
+ * performed.
+ *
+ * @param dec decoder object
+ * @param fast_idct JXL_TRUE to enable, JXL_FALSE to disable (default).
+ * @return @ref JXL_DEC_SUCCESS if no error, @ref JXL_DEC_ERROR otherwise.
+ */
+JXL_EXPORT JxlDecoderStatus JxlDecoderSetFastIDCT(JxlDecoder* dec,
+                                                  JXL_BOOL fast_idct);
+
 /** Enables or disables coalescing of zero-duration frames. By default, frames
  * are returned with coalescing enabled, i.e. all frames have the image
  * dimensions, and are blended if needed. When coalescing is disabled, frames
@@ -684,6 +762,61 @@ JXL_EXPORT JxlDecoderStatus JxlDecoderGetExtraChannelName(const JxlDecoder* dec,
                                                           char* name,
                                                           size_t size);
 
+/** Header information returned by @ref JxlProbe.
+ */
+typedef struct {
+  /** Basic image information, as returned by @ref JxlDecoderGetBasicInfo
+   * with @ref JxlDecoderSetKeepOrientation enabled: xsize, ysize and
+   * orientation are as stored in the codestream.
+   */
+  JxlBasicInfo basic_info;
+
+  /** Whether the color profile of the image is an ICC profile. If so,
+   * color_encoding is not set; use the decoder to get the ICC profile.
+   */
+  JXL_BOOL uses_icc_profile;
+
+  /** The color encoding of the codestream metadata header, as returned by
+   * @ref JxlDecoderGetColorAsEncodedProfile with @ref
+   * JXL_COLOR_PROFILE_TARGET_ORIGINAL. Only set if uses_icc_profile is false.
+   */
+  JxlColorEncoding color_encoding;
+
+  /** Whether frame_header is set. The first frame header can only be probed
+   * if the image has no ICC profile and no preview, and it is JXL_FALSE if the
+   * header is not fully contained in the given bytes.
+   */
+  JXL_BOOL have_frame_header;
+
+  /** Header of the first frame, as returned by @ref JxlDecoderGetFrameHeader
+   * with coalescing disabled and orientation kept.
+   */
+  JxlFrameHeader frame_header;
+} JxlProbeResult;
+
+/**
+ * Reads the image headers from the beginning of a JPEG XL file without a
+ * decoder instance, for quickly inspecting many files. This parses the
+ * container, if any, the codestream size header and image metadata, and the
+ * first frame header when possible, and does not allocate memory for typical
+ * images.
+ *
+ * Only the first codestream box of a container is looked at, so if the
+ * codestream is split over several "jxlp" boxes, the headers must be
+ * contained in the first one. Use the decoder to get extra channel
+ * information, names and ICC profiles.
+ *
+ * @param data the beginning of the file.
+ * @param size size of data in bytes.
+ * @param result struct to copy the information into.
+ * @return @ref JXL_DEC_SUCCESS if the basic info and color encoding are
+ *     available, @ref JXL_DEC_NEED_MORE_INPUT if more bytes of the file are
+ *     needed for that, @ref JXL_DEC_ERROR if the file is not a valid JPEG XL
+ *     file.
+ */
+JXL_EXPORT JxlDecoderStatus JxlProbe(const uint8_t* data, size_t size,
+                                     JxlProbeResult* result);
+
 /** Defines which color profile to get: the profile from the codestream
  * metadata header, which represents the color profile of the original image,
  * or the color profile from the pixel data produced by the decoder. Both are
@@ -820,6 +953,53 @@ JXL_EXPORT JxlDecoderStatus JxlDecoderSetPreferredColorProfile(
 JXL_EXPORT JxlDecoderStatus JxlDecoderSetDesiredIntensityTarget(
     JxlDecoder* dec, float desired_intensity_target);
 
+/** Requests that the decoder map out-of-gamut colors into the gamut of the
+ * output color space instead of leaving them to be clipped. The mapping is done
+ * on linear rows inside the decoder's render pipeline, together with the tone
+ * mapping requested by @ref JxlDecoderSetDesiredIntensityTarget. It only
+ * applies to images that the decoder renders in linear light, i.e. XYB-encoded
+ * images or images with an enum color encoding.
+ * @note As for tone mapping, the exact mapping is not meant to be considered
+ * authoritative and may change from version to version.
+ * @param dec decoder object
+ * @param enabled whether to gamut map even when no tone mapping is needed
+ * @param preserve_saturation in [0, 1]: 0 preserves the luminance of
+ *     out-of-gamut colors at the cost of saturation, 1 preserves saturation at
+ *     the cost of luminance. Also used for the gamut mapping that follows tone
+ *     mapping. The default is 0.1.
+ * @return @ref JXL_DEC_SUCCESS if the preference was set successfully, @ref
+ * JXL_DEC_ERROR otherwise.
+ */
+JXL_EXPORT JxlDecoderStatus JxlDecoderSetGamutMapping(
+    JxlDecoder* dec, JXL_BOOL enabled, float preserve_saturation);
+
+/** Limits the CPU work the decoder is allowed to spend on an image, to protect
+ * against small inputs that are very expensive to decode, such as large
+ * amounts of splines or patches or many restoration filter iterations. The
+ * work of each frame is estimated from its headers before its pixels are
+ * decoded, and decoding stops with @ref JXL_DEC_WORK_BUDGET_EXCEEDED if the
+ * total of all frames so far would exceed the budget.
+ * The unit is a rough count of arithmetic operations; it is not meant to be
+ * exact and may change from version to version. Use @ref
+ * JxlDecoderGetEstimatedWork on trusted images to calibrate a budget.
+ * Must be called before the first call to @ref JxlDecoderProcessInput.
+ *
+ * @param dec decoder object
+ * @param budget maximum estimated work, or 0 for no limit (the default)
+ * @return @ref JXL_DEC_SUCCESS if the budget was set, @ref JXL_DEC_ERROR
+ *     otherwise.
+ */
+JXL_EXPORT JxlDecoderStatus JxlDecoderSetWorkBudget(JxlDecoder* dec,
+                                                    uint64_t budget);
+
+/** Returns the estimated work, in the unit of @ref JxlDecoderSetWorkBudget,
+ * of the frames the decoder has started decoding so far.
+ *
+ * @param dec decoder object
+ * @return the estimated work so far
+ */
+JXL_EXPORT uint64_t JxlDecoderGetEstimatedWork(const JxlDecoder* dec);
+
 /**
  * Sets the desired output color profile of the decoded image either from a
  * color encoding or an ICC profile. Valid calls of this function have either @c
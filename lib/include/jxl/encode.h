@@ -72,6 +72,11 @@ typedef enum {
    */
   JXL_ENC_NEED_MORE_OUTPUT = 2,
 
+  /** Encoding was stopped by JxlEncoderCancel. The encoder keeps returning
+   * this status until JxlEncoderReset is called.
+   */
+  JXL_ENC_CANCELLED = 3,
+
 } JxlEncoderStatus;
 
 /**
@@ -406,6 +411,27 @@ JXL_EXPORT JxlEncoder* JxlEncoderCreate(const JxlMemoryManager* memory_manager);
  */
 JXL_EXPORT void JxlEncoderReset(JxlEncoder* enc);
 
+/**
+ * Keeps the internal working buffers of the encoder (per-block fields,
+ * coefficient images, the color-converted image, computed quantization tables,
+ * per-thread scratch, ...) allocated after each encoded frame, including
+ * across @ref JxlEncoderReset. When encoding a stream of images with the same
+ * dimensions and settings, this avoids reallocating them for every image.
+ * Buffers that do not match the dimensions of the next frame are reallocated.
+ * The encoded output does not depend on this setting.
+ *
+ * By default this setting is disabled. Unlike other settings, it is not
+ * changed by @ref JxlEncoderReset. Disabling it frees the kept buffers.
+ *
+ * @param enc encoder object.
+ * @param reuse true to keep the working buffers between frames and images,
+ * false to free them after each frame.
+ * @return JXL_ENC_SUCCESS if the operation was successful, JXL_ENC_ERROR
+ * otherwise.
+ */
+JXL_EXPORT JxlEncoderStatus JxlEncoderSetReuseAllocations(JxlEncoder* enc,
+                                                          JXL_BOOL reuse);
+
 /**
  * Deinitializes and frees JxlEncoder instance.
  *
@@ -425,8 +451,9 @@ JXL_EXPORT void JxlEncoderDestroy(JxlEncoder* enc);
 JXL_EXPORT void JxlEncoderSetCms(JxlEncoder* enc, JxlCmsInterface cms);
 
 /**
- * Set the parallel runner for multithreading. May only be set before starting
- * encoding.
+ * Set the parallel runner for multithreading. May only be set once until
+ * JxlEncoderReset. If frames were already encoded, it is used from the next
+ * frame on.
  *
  * @param enc encoder object.
  * @param parallel_runner function pointer to runner for multithreading. It may
@@ -440,6 +467,48 @@ JXL_EXPORT JxlEncoderStatus
 JxlEncoderSetParallelRunner(JxlEncoder* enc, JxlParallelRunner parallel_runner,
                             void* parallel_runner_opaque);
 
+/**
+ * Same as JxlEncoderSetParallelRunner, for a runner that also receives the
+ * priority hint of the encoder (see JxlEncoderSetPriority) on every call.
+ * Only one of the two functions may be called until JxlEncoderReset.
+ *
+ * @param enc encoder object.
+ * @param parallel_runner function pointer to the priority-aware runner. It may
+ *        be NULL to use the default, single-threaded, runner.
+ * @param parallel_runner_opaque opaque pointer for parallel_runner.
+ * @return JXL_ENC_SUCCESS if the runner was set, JXL_ENC_ERROR
+ * otherwise (the previous runner remains set).
+ */
+JXL_EXPORT JxlEncoderStatus JxlEncoderSetParallelPriorityRunner(
+    JxlEncoder* enc, JxlParallelPriorityRunner parallel_runner,
+    void* parallel_runner_opaque);
+
+/**
+ * Sets the scheduling priority hint of the encoder, see JxlPriority. It is
+ * passed to the runner set with JxlEncoderSetParallelPriorityRunner, and has no
+ * effect with other runners. Takes effect from the next frame that is encoded.
+ *
+ * @param enc encoder object.
+ * @param priority one of the JxlPriority values.
+ * @return JXL_ENC_SUCCESS if the priority was set, JXL_ENC_ERROR otherwise.
+ */
+JXL_EXPORT JxlEncoderStatus JxlEncoderSetPriority(JxlEncoder* enc,
+                                                  JxlPriority priority);
+
+/**
+ * Asks the encoder to stop as soon as possible. This is the only encoder
+ * function that may be called from another thread while JxlEncoderProcessOutput
+ * or JxlEncoderFlushInput is running; it must not race with JxlEncoderReset or
+ * JxlEncoderDestroy. The encoder checks for cancellation between groups and
+ * between iterations of its costly searches, so a running
+ * JxlEncoderProcessOutput returns JXL_ENC_CANCELLED shortly after, as do all
+ * later calls that encode, until JxlEncoderReset is called. The output
+ * produced so far is incomplete and should be discarded.
+ *
+ * @param enc encoder object.
+ */
+JXL_EXPORT void JxlEncoderCancel(JxlEncoder* enc);
+
 /**
  * Get the (last) error code in case JXL_ENC_ERROR was returned.
  *
@@ -483,6 +552,27 @@ JXL_EXPORT JxlEncoderStatus JxlEncoderProcessOutput(JxlEncoder* enc,
                                                     uint8_t** next_out,
                                                     size_t* avail_out);
 
+/**
+ * Gets an estimate of the number of bytes that @ref JxlEncoderProcessOutput
+ * will output for the frames and boxes added so far, including the container
+ * and codestream headers if they were not output yet. It can be used to size
+ * the output buffer, so that a single call to @ref JxlEncoderProcessOutput
+ * usually suffices.
+ *
+ * The estimate is derived from the uncompressed sample size of the frames, so
+ * it is generous, especially for lossy encoding, but it is not a guarantee:
+ * should the output be larger, @ref JxlEncoderProcessOutput returns @ref
+ * JXL_ENC_NEED_MORE_OUTPUT as usual. The encoder still buffers the encoded
+ * frames internally and copies them to the output buffer, whatever its size.
+ *
+ * @param enc encoder object.
+ * @param size output: estimated output size in bytes.
+ * @return JXL_ENC_SUCCESS if the estimate was computed, JXL_ENC_ERROR if the
+ *     basic info was not set yet.
+ */
+JXL_EXPORT JxlEncoderStatus
+JxlEncoderGetOutputSizeEstimate(const JxlEncoder* enc, size_t* size);
+
 /**
  * Sets the frame information for this frame to the encoder. This includes
  * animation information such as frame duration to store in the frame header.
@@ -588,6 +678,17 @@ JXL_EXPORT JxlEncoderStatus JxlEncoderSetFrameBitDepth(
  * JxlEncoderStoreJPEGMetadata and a single JPEG frame is added, it will be
  * possible to losslessly reconstruct the JPEG codestream.
  *
+ * Both Huffman and arithmetic coded 8-bit JPEGs are accepted, and their DCT
+ * coefficients are preserved exactly. Known limitations of arithmetic coded
+ * JPEGs:
+ *  - the reconstruction metadata can only describe Huffman coding, so @ref
+ *    JxlEncoderStoreJPEGMetadata must be disabled for them, otherwise this
+ *    function fails with JXL_ENC_ERR_JBRD;
+ *  - reading them is about 4.5 times slower than reading Huffman coded JPEGs
+ *    of the same size, because the arithmetic decoder works bit by bit.
+ * 12-bit JPEGs are rejected, whatever their entropy coding, since JPEG XL
+ * stores the coefficients of 8-bit samples only.
+ *
  * If this is the last frame, @ref JxlEncoderCloseInput or @ref
  * JxlEncoderCloseFrames must be called before the next
  * @ref JxlEncoderProcessOutput call.
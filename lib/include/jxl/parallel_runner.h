@@ -57,6 +57,30 @@ typedef int JxlParallelRetCode;
  */
 #define JXL_PARALLEL_RET_RUNNER_ERROR (-1)
 
+/**
+ * Scheduling priority hint of an encoder or decoder instance, set with
+ * JxlEncoderSetPriority or JxlDecoderSetPriority. It tells a parallel runner
+ * that may be shared with other instances how to schedule the work of the
+ * instance.
+ *
+ * The library does not act on the hint itself: it passes it to the runner set
+ * with JxlEncoderSetParallelPriorityRunner or
+ * JxlDecoderSetParallelPriorityRunner on every call, and the runner decides
+ * what to do with it, e.g. run the work of background instances with fewer
+ * threads or after the work of the other instances. A JxlParallelRunner has
+ * no priority parameter, so with such a runner the hint has no effect.
+ */
+typedef enum {
+  /** Background work, which may be delayed or run with fewer threads in favor
+   * of the work of JXL_PRIORITY_NORMAL instances.
+   */
+  JXL_PRIORITY_BACKGROUND = -1,
+
+  /** Default priority.
+   */
+  JXL_PRIORITY_NORMAL = 0,
+} JxlPriority;
+
 /**
  * Parallel run initialization callback. See JxlParallelRunner for details.
  *
@@ -120,6 +144,19 @@ typedef JxlParallelRetCode (*JxlParallelRunner)(
     void* runner_opaque, void* jpegxl_opaque, JxlParallelRunInit init,
     JxlParallelRunFunction func, uint32_t start_range, uint32_t end_range);
 
+/**
+ * Priority-aware variant of JxlParallelRunner, set with
+ * JxlEncoderSetParallelPriorityRunner or JxlDecoderSetParallelPriorityRunner.
+ * It must behave like a JxlParallelRunner with the same arguments, and also
+ * receives the JxlPriority hint of the encoder or decoder instance that makes
+ * the call in @p priority. The runner may use the hint to schedule the calls
+ * of @p func, but all of them must still be made before it returns.
+ */
+typedef JxlParallelRetCode (*JxlParallelPriorityRunner)(
+    void* runner_opaque, JxlPriority priority, void* jpegxl_opaque,
+    JxlParallelRunInit init, JxlParallelRunFunction func, uint32_t start_range,
+    uint32_t end_range);
+
 /* The following is an example of a JxlParallelRunner that doesn't use any
  * multi-threading. Note that this implementation doesn't store any state
  * between multiple calls of the ExampleSequentialRunner function, so the
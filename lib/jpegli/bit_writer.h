@@ -12,6 +12,7 @@
 #include "lib/jpegli/common.h"
 #include "lib/jxl/base/byte_order.h"
 #include "lib/jxl/base/compiler_specific.h"
+#include "lib/jxl/base/jpeg_entropy.h"
 
 namespace jpegli {
 
@@ -33,12 +34,6 @@ bool EmptyBitWriterBuffer(JpegBitWriter* bw);
 
 void JumpToByteBoundary(JpegBitWriter* bw);
 
-// Returns non-zero if and only if x has a zero byte, i.e. one of
-// x & 0xff, x & 0xff00, ..., x & 0xff00000000000000 is zero.
-static JXL_INLINE uint64_t HasZeroByte(uint64_t x) {
-  return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
-}
-
 /**
  * Writes the given byte to the output, writes an extra zero if byte is 0xFF.
  *
@@ -53,24 +48,8 @@ static JXL_INLINE void EmitByte(JpegBitWriter* bw, int byte) {
 static JXL_INLINE void DischargeBitBuffer(JpegBitWriter* bw) {
   // At this point we are ready to emit the bytes of put_buffer to the output.
   // The JPEG format requires that after every 0xff byte in the entropy
-  // coded section, there is a zero byte, therefore we first check if any of
-  // the bytes of put_buffer is 0xFF.
-  if (HasZeroByte(~bw->put_buffer)) {
-    // We have a 0xFF byte somewhere, examine each byte and append a zero
-    // byte if necessary.
-    EmitByte(bw, (bw->put_buffer >> 56) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 48) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 40) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 32) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 24) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 16) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 8) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 0) & 0xFF);
-  } else {
-    // We don't have any 0xFF bytes, output all 8 bytes without checking.
-    StoreBE64(bw->put_buffer, bw->data + bw->pos);
-    bw->pos += 8;
-  }
+  // coded section, there is a zero byte.
+  bw->pos += jxl::StoreBE64Stuffed(bw->put_buffer, bw->data + bw->pos);
 }
 
 static JXL_INLINE void WriteBits(JpegBitWriter* bw, int nbits, uint64_t bits) {
@@ -79,6 +79,7 @@ void InitializeImage(j_decompress_ptr cinfo) {
   m->output_passes_done_ = 0;
   m->xoffset_ = 0;
   m->dequant_ = nullptr;
+  m->dequant_i16_ = nullptr;
 }
 
 void InitializeDecompressParams(j_decompress_ptr cinfo) {
@@ -529,6 +530,8 @@ void AllocateOutputBuffers(j_decompress_ptr cinfo) {
   m->biases_ = Allocate<float>(cinfo, coeffs_per_block, JPOOL_IMAGE_ALIGNED);
   m->dequant_ = Allocate<float>(cinfo, coeffs_per_block, JPOOL_IMAGE_ALIGNED);
   memset(m->dequant_, 0, coeffs_per_block * sizeof(float));
+  m->dequant_i16_ =
+      Allocate<int16_t>(cinfo, coeffs_per_block, JPOOL_IMAGE_ALIGNED);
 }
 
 }  // namespace jpegli
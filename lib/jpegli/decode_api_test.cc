@@ -581,6 +581,51 @@ TEST(DecodeAPITest, AbbreviatedStreams) {
   if (data_stream) free(data_stream);
 }
 
+// 8-bit RGB output of YCbCr images goes through the fused WriteYCbCrToRGB8(),
+// every other output data type goes through the separate color transform and
+// WriteToOutput(). Both must produce the same pixels up to the 8-bit rounding.
+TEST(DecodeAPITest, FusedYCbCrToRGB8) {
+  TestImage input;
+  input.xsize = 217;
+  input.ysize = 129;
+  GeneratePixels(&input);
+  for (int h_samp : {1, 2}) {
+    for (int v_samp : {1, 2}) {
+      CompressParams jparams;
+      jparams.h_sampling = {h_samp, 1, 1};
+      jparams.v_sampling = {v_samp, 1, 1};
+      std::vector<uint8_t> compressed;
+      JXL_CHECK(EncodeWithJpegli(input, jparams, &compressed));
+      for (bool crop : {false, true}) {
+        printf("Decoding with %dx%d chroma subsampling %s\n", h_samp, v_samp,
+               crop ? "with cropped output" : "");
+        TestImage output[2];
+        const JpegliDataType data_types[2] = {JPEGLI_TYPE_UINT8,
+                                              JPEGLI_TYPE_UINT16};
+        for (size_t i = 0; i < 2; ++i) {
+          DecompressParams dparams;
+          dparams.data_type = data_types[i];
+          dparams.crop_output = crop;
+          SourceManager src(compressed.data(), compressed.size(),
+                            dparams.chunk_size);
+          jpeg_decompress_struct cinfo;
+          const auto try_catch_block = [&]() -> bool {
+            ERROR_HANDLER_SETUP(jpegli);
+            jpegli_create_decompress(&cinfo);
+            cinfo.src = reinterpret_cast<jpeg_source_mgr*>(&src);
+            TestAPINonBuffered(jparams, dparams, input, &cinfo, &output[i]);
+            return true;
+          };
+          ASSERT_TRUE(try_catch_block());
+          jpegli_destroy_decompress(&cinfo);
+        }
+        // The 16-bit output is within 0.5 / 65535 of the unrounded value.
+        VerifyOutputImage(output[1], output[0], 0.5f, 0.51f);
+      }
+    }
+  }
+}
+
 class DecodeAPITestParam : public ::testing::TestWithParam<TestConfig> {};
 
 TEST_P(DecodeAPITestParam, TestAPI) {
@@ -738,6 +783,18 @@ std::vector<TestConfig> GenerateTests(bool buffered) {
     }
   }
 
+  // Tests for the integer IDCT.
+  for (JpegIOMode output_mode : {PIXELS, RAW_DATA}) {
+    for (int samp : {1, 2}) {
+      TestConfig config;
+      config.dparams.output_mode = output_mode;
+      config.dparams.dct_method = JDCT_IFAST;
+      config.jparams.h_sampling = {samp, 1, 1};
+      config.jparams.v_sampling = {samp, 1, 1};
+      all_tests.push_back(config);
+    }
+  }
+
   // Tests for partial input.
   for (float size_factor : {0.1f, 0.33f, 0.5f, 0.75f}) {
     for (int progr : {0, 1, 3}) {
@@ -1255,6 +1312,9 @@ std::ostream& operator<<(std::ostream& os, const DecompressParams& dparams) {
   if (!dparams.do_fancy_upsampling) {
     os << "NoFancyUpsampling";
   }
+  if (dparams.dct_method == JDCT_IFAST) {
+    os << "IFastIDCT";
+  }
   if (dparams.scale_num != 1 || dparams.scale_denom != 1) {
     os << "Scale" << dparams.scale_num << "_" << dparams.scale_denom;
   }
@@ -109,8 +109,10 @@ struct jpeg_decomp_master {
 
   void (*inverse_transform[jpegli::kMaxComponents])(
       const int16_t* JXL_RESTRICT qblock, const float* JXL_RESTRICT dequant,
-      const float* JXL_RESTRICT biases, float* JXL_RESTRICT scratch_space,
-      float* JXL_RESTRICT output, size_t output_stride, size_t dctsize);
+      const float* JXL_RESTRICT biases,
+      const int16_t* JXL_RESTRICT dequant_i16,
+      float* JXL_RESTRICT scratch_space, float* JXL_RESTRICT output,
+      size_t output_stride, size_t dctsize);
 
   void (*color_transform)(float* row[jpegli::kMaxComponents], size_t len);
 
@@ -119,6 +121,8 @@ struct jpeg_decomp_master {
   uint8_t* output_scratch_;
   int16_t* smoothing_scratch_;
   float* dequant_;
+  // Dequantization multipliers of the integer IDCT, used for JDCT_IFAST.
+  int16_t* dequant_i16_;
   // 1 = 1pass, 2 = 2pass, 3 = external
   int quant_mode_;
   int quant_pass_;
@@ -92,6 +92,38 @@ TEST(EncodeAPITest, ReuseCinfoSameImageTwice) {
             memcmp(compressed0.data(), compressed1.data(), compressed0.size()));
 }
 
+TEST(EncodeAPITest, OptimizeCodingSmallImages) {
+  // From fewer tokens than the histogram building counts at once to a few
+  // blocks with leftover tokens. Optimized Huffman codes only change the
+  // entropy coding, so all variants must decode to the same image.
+  for (size_t xsize : {1, 2, 7, 8, 9, 17, 33}) {
+    for (J_COLOR_SPACE color_space : {JCS_GRAYSCALE, JCS_RGB}) {
+      TestImage input;
+      input.xsize = xsize;
+      input.ysize = 1 + xsize % 3;
+      input.color_space = color_space;
+      GeneratePixels(&input);
+      TestImage reference;
+      for (int progr : {0, 2}) {
+        for (int optimize : {0, 1}) {
+          CompressParams jparams;
+          jparams.progressive_mode = progr;
+          jparams.optimize_coding = optimize;
+          std::vector<uint8_t> compressed;
+          ASSERT_TRUE(EncodeWithJpegli(input, jparams, &compressed));
+          TestImage output;
+          DecodeWithLibjpeg(jparams, DecompressParams(), compressed, &output);
+          if (reference.pixels.empty()) {
+            reference = output;
+          } else {
+            EXPECT_EQ(reference.pixels, output.pixels);
+          }
+        }
+      }
+    }
+  }
+}
+
 std::vector<TestConfig> GenerateBasicConfigs() {
   std::vector<TestConfig> all_configs;
   for (int samp : {1, 2}) {
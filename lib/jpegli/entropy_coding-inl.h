@@ -10,7 +10,9 @@
 #define LIB_JPEGLI_ENTROPY_CODING_INL_H_
 #endif
 
+#include "lib/jxl/base/bits.h"
 #include "lib/jxl/base/compiler_specific.h"
+#include "lib/jxl/base/jpeg_entropy.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace jpegli {
@@ -21,17 +23,16 @@ namespace {
 using hwy::HWY_NAMESPACE::Abs;
 using hwy::HWY_NAMESPACE::Add;
 using hwy::HWY_NAMESPACE::And;
-using hwy::HWY_NAMESPACE::AndNot;
 using hwy::HWY_NAMESPACE::Compress;
 using hwy::HWY_NAMESPACE::CountTrue;
 using hwy::HWY_NAMESPACE::Eq;
-using hwy::HWY_NAMESPACE::GetLane;
 using hwy::HWY_NAMESPACE::MaskFromVec;
 using hwy::HWY_NAMESPACE::Max;
 using hwy::HWY_NAMESPACE::Not;
 using hwy::HWY_NAMESPACE::Or;
 using hwy::HWY_NAMESPACE::ShiftRight;
 using hwy::HWY_NAMESPACE::Shl;
+using hwy::HWY_NAMESPACE::StoreMaskBits;
 using hwy::HWY_NAMESPACE::Sub;
 
 using DI = HWY_FULL(int32_t);
@@ -116,37 +117,19 @@ JXL_INLINE void ComputeSymbols(const int num_nonzeros,
   }
 }
 
+// Same as jxl::NonZeroMask for a block in zig-zag order, but compares up to
+// 8 coefficients at a time.
 template <typename T>
-int NumNonZero8x8ExceptDC(const T* block) {
-  const HWY_CAPPED(T, 8) di;
-
-  const auto zero = Zero(di);
-  // Add FFFF for every zero coefficient, negate to get #zeros.
-  auto neg_sum_zero = zero;
-  {
-    // First row has DC, so mask
-    const size_t y = 0;
-    HWY_ALIGN const T dc_mask_lanes[8] = {-1};
-
-    for (size_t x = 0; x < 8; x += Lanes(di)) {
-      const auto dc_mask = Load(di, dc_mask_lanes + x);
-
-      // DC counts as zero so we don't include it in nzeros.
-      const auto coef = AndNot(dc_mask, Load(di, &block[y * 8 + x]));
-
-      neg_sum_zero = Add(neg_sum_zero, VecFromMask(di, Eq(coef, zero)));
-    }
+JXL_INLINE uint64_t NonZeroMask(const T* JXL_RESTRICT block) {
+  const HWY_CAPPED(T, 8) d;
+  const auto zero = Zero(d);
+  uint64_t zero_mask = 0;
+  for (size_t k = 0; k < DCTSIZE2; k += Lanes(d)) {
+    uint8_t bits[8] = {0};
+    StoreMaskBits(d, Eq(Load(d, block + k), zero), bits);
+    zero_mask |= static_cast<uint64_t>(bits[0]) << k;
   }
-  // Remaining rows: no mask
-  for (size_t y = 1; y < 8; y++) {
-    for (size_t x = 0; x < 8; x += Lanes(di)) {
-      const auto coef = Load(di, &block[y * 8 + x]);
-      neg_sum_zero = Add(neg_sum_zero, VecFromMask(di, Eq(coef, zero)));
-    }
-  }
-
-  // We want 64 - sum_zero, add because neg_sum_zero is already negated.
-  return kDCTBlockSize + GetLane(SumOfLanes(di, neg_sum_zero));
+  return ~zero_mask;
 }
 
 template <typename T, bool zig_zag_order>
@@ -168,25 +151,20 @@ void ComputeTokensForBlock(const T* block, int last_dc, int dc_ctx, int ac_ctx,
     int dc_mask = (1 << dc_nbits) - 1;
     *next_token++ = Token(dc_ctx, dc_nbits, temp2 & dc_mask);
   }
-  int num_nonzeros = NumNonZero8x8ExceptDC(block);
-  for (int k = 1; k < 64; ++k) {
-    if (num_nonzeros == 0) {
-      *next_token++ = Token(ac_ctx, 0, 0);
-      break;
-    }
-    int r = 0;
-    if (zig_zag_order) {
-      while ((temp = block[k]) == 0) {
-        r++;
-        k++;
-      }
-    } else {
-      while ((temp = block[kJPEGNaturalOrder[k]]) == 0) {
-        r++;
-        k++;
-      }
-    }
-    --num_nonzeros;
+  // Bit k of the mask is set for each non-zero AC coefficient at zig-zag
+  // position k, the zero runs are the gaps between the set bits.
+  uint64_t nonzero_mask = (zig_zag_order
+                               ? NonZeroMask(block)
+                               : jxl::NonZeroMask(block, kJPEGNaturalOrder)) &
+                          ~uint64_t{1};
+  int last_k = 0;
+  while (nonzero_mask != 0) {
+    const int k =
+        static_cast<int>(jxl::Num0BitsBelowLS1Bit_Nonzero(nonzero_mask));
+    nonzero_mask &= nonzero_mask - 1;
+    int r = k - last_k - 1;
+    last_k = k;
+    temp = zig_zag_order ? block[k] : block[kJPEGNaturalOrder[k]];
     if (temp < 0) {
       temp = -temp;
       temp2 = ~temp;
@@ -202,6 +180,9 @@ void ComputeTokensForBlock(const T* block, int last_dc, int dc_ctx, int ac_ctx,
     int symbol = (r << 4u) + ac_nbits;
     *next_token++ = Token(ac_ctx, symbol, temp2 & ac_mask);
   }
+  if (last_k < 63) {
+    *next_token++ = Token(ac_ctx, 0, 0);
+  }
   *tokens_ptr = next_token;
 }
 
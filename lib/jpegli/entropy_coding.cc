@@ -521,15 +521,43 @@ struct Histogram {
 
 void BuildHistograms(j_compress_ptr cinfo, Histogram* histograms) {
   jpeg_comp_master* m = cinfo->master;
+  // Consecutive tokens often have the same context and symbol (e.g. EOB), so
+  // counting them into one histogram serializes on the same counter. Spread
+  // consecutive tokens over independent partial histograms instead and merge
+  // them at the end.
+  constexpr size_t kNumPartials = 4;
+  const size_t num_contexts = m->num_contexts;
+  std::vector<Histogram> partials((kNumPartials - 1) * num_contexts);
+  Histogram* partial[kNumPartials] = {histograms, partials.data(),
+                                      partials.data() + num_contexts,
+                                      partials.data() + 2 * num_contexts};
   size_t num_token_arrays = m->cur_token_array + 1;
   for (size_t i = 0; i < num_token_arrays; ++i) {
-    Token* tokens = m->token_arrays[i].tokens;
+    const Token* tokens = m->token_arrays[i].tokens;
     size_t num_tokens = m->token_arrays[i].num_tokens;
-    for (size_t j = 0; j < num_tokens; ++j) {
+    size_t j = 0;
+    for (; j + kNumPartials <= num_tokens; j += kNumPartials) {
+      const Token t0 = tokens[j];
+      const Token t1 = tokens[j + 1];
+      const Token t2 = tokens[j + 2];
+      const Token t3 = tokens[j + 3];
+      ++partial[0][t0.context].count[t0.symbol];
+      ++partial[1][t1.context].count[t1.symbol];
+      ++partial[2][t2.context].count[t2.symbol];
+      ++partial[3][t3.context].count[t3.symbol];
+    }
+    for (; j < num_tokens; ++j) {
       Token t = tokens[j];
       ++histograms[t.context].count[t.symbol];
     }
   }
+  for (size_t p = 1; p < kNumPartials; ++p) {
+    for (size_t c = 0; c < num_contexts; ++c) {
+      for (size_t k = 0; k < kJpegHuffmanAlphabetSize; ++k) {
+        histograms[c].count[k] += partial[p][c].count[k];
+      }
+    }
+  }
   for (int i = 0; i < cinfo->num_scans; ++i) {
     const jpeg_scan_info& si = cinfo->scan_info[i];
     const ScanTokenInfo& sti = m->scan_token_info[i];
@@ -550,14 +578,14 @@ struct JpegClusteredHistograms {
 };
 
 float HistogramCost(const Histogram& histo) {
-  std::vector<uint32_t> counts(kJpegHuffmanAlphabetSize + 1);
-  std::vector<uint8_t> depths(kJpegHuffmanAlphabetSize + 1);
+  uint32_t counts[kJpegHuffmanAlphabetSize + 1];
+  uint8_t depths[kJpegHuffmanAlphabetSize + 1] = {};
   for (size_t i = 0; i < kJpegHuffmanAlphabetSize; ++i) {
     counts[i] = histo.count[i];
   }
   counts[kJpegHuffmanAlphabetSize] = 1;
-  CreateHuffmanTree(counts.data(), counts.size(), kJpegHuffmanMaxBitLength,
-                    &depths[0]);
+  CreateHuffmanTree(counts, kJpegHuffmanAlphabetSize + 1,
+                    kJpegHuffmanMaxBitLength, &depths[0]);
   size_t header_bits = (1 + kJpegHuffmanMaxBitLength) * 8;
   size_t data_bits = 0;
   for (size_t i = 0; i < kJpegHuffmanAlphabetSize; ++i) {
@@ -6,6 +6,7 @@
 #include "lib/jpegli/idct.h"
 
 #include <cmath>
+#include <limits>
 
 #include "lib/jpegli/decode_internal.h"
 #include "lib/jxl/base/status.h"
@@ -186,6 +187,7 @@ void ComputeScaledIDCT(float* JXL_RESTRICT block0, float* JXL_RESTRICT block1,
 void InverseTransformBlock8x8(const int16_t* JXL_RESTRICT qblock,
                               const float* JXL_RESTRICT dequant,
                               const float* JXL_RESTRICT biases,
+                              const int16_t* JXL_RESTRICT dequant_i16,
                               float* JXL_RESTRICT scratch_space,
                               float* JXL_RESTRICT output, size_t output_stride,
                               size_t dctsize) {
@@ -195,6 +197,120 @@ void InverseTransformBlock8x8(const int16_t* JXL_RESTRICT qblock,
   ComputeScaledIDCT(block0, block1, output, output_stride);
 }
 
+using D16 = HWY_CAPPED(int16_t, 8);
+constexpr D16 d16;
+using V16 = Vec<D16>;
+
+// The integer IDCT outputs pixel values with this many fractional bits, since
+// the final 1/8 normalization is not applied.
+constexpr int kIFastOutputBits = kIFastPass1Bits + 3;
+
+// Multiplies v by c / 2^15, where c is in [0, 2^15).
+JXL_INLINE V16 MulQ15(V16 v, int16_t c) {
+  return MulFixedPoint15(v, Set(d16, c));
+}
+
+// Integer version of the Arai, Agui and Nakajima scaled IDCT, the same
+// factorization as libjpeg's jidctfst.c. The inputs must be prescaled by the
+// AAN scale factors, see ComputeIFastDequantTable().
+void IFastIDCT1D(const int16_t* JXL_RESTRICT from, V16* JXL_RESTRICT out) {
+  // Fractional parts of the multipliers 1.414213562, 1.847759065, 1.082392200
+  // and 2.613125930 in Q15.
+  constexpr int16_t k0_414213562 = 13573;
+  constexpr int16_t k0_847759065 = 27779;
+  constexpr int16_t k0_082392200 = 2700;
+  constexpr int16_t k0_613125930 = 20091;
+  const V16 in0 = Load(d16, from + 0 * 8);
+  const V16 in1 = Load(d16, from + 1 * 8);
+  const V16 in2 = Load(d16, from + 2 * 8);
+  const V16 in3 = Load(d16, from + 3 * 8);
+  const V16 in4 = Load(d16, from + 4 * 8);
+  const V16 in5 = Load(d16, from + 5 * 8);
+  const V16 in6 = Load(d16, from + 6 * 8);
+  const V16 in7 = Load(d16, from + 7 * 8);
+  // Even part.
+  const V16 tmp10 = Add(in0, in4);
+  const V16 tmp11 = Sub(in0, in4);
+  const V16 tmp13 = Add(in2, in6);
+  const V16 d26 = Sub(in2, in6);
+  const V16 tmp12 = Sub(Add(d26, MulQ15(d26, k0_414213562)), tmp13);
+  const V16 tmp0 = Add(tmp10, tmp13);
+  const V16 tmp3 = Sub(tmp10, tmp13);
+  const V16 tmp1 = Add(tmp11, tmp12);
+  const V16 tmp2 = Sub(tmp11, tmp12);
+  // Odd part.
+  const V16 z13 = Add(in5, in3);
+  const V16 z10 = Sub(in5, in3);
+  const V16 z11 = Add(in1, in7);
+  const V16 z12 = Sub(in1, in7);
+  const V16 tmp7 = Add(z11, z13);
+  const V16 d1113 = Sub(z11, z13);
+  const V16 tmp11o = Add(d1113, MulQ15(d1113, k0_414213562));
+  const V16 s1012 = Add(z10, z12);
+  const V16 z5 = Add(s1012, MulQ15(s1012, k0_847759065));
+  const V16 tmp10o = Sub(Add(z12, MulQ15(z12, k0_082392200)), z5);
+  const V16 z10x2 = Add(z10, z10);
+  const V16 tmp12o = Sub(z5, Add(z10x2, MulQ15(z10, k0_613125930)));
+  const V16 tmp6 = Sub(tmp12o, tmp7);
+  const V16 tmp5 = Sub(tmp11o, tmp6);
+  const V16 tmp4 = Add(tmp10o, tmp5);
+  out[0] = Add(tmp0, tmp7);
+  out[7] = Sub(tmp0, tmp7);
+  out[1] = Add(tmp1, tmp6);
+  out[6] = Sub(tmp1, tmp6);
+  out[2] = Add(tmp2, tmp5);
+  out[5] = Sub(tmp2, tmp5);
+  out[4] = Add(tmp3, tmp4);
+  out[3] = Sub(tmp3, tmp4);
+}
+
+// Used for JDCT_IFAST: dequantizes with the 16-bit multipliers in dequant_i16
+// and runs the integer IDCT. The result is clamped to the valid sample range
+// before it is converted to the same float representation as the output of
+// InverseTransformBlock8x8(). As in libjpeg, coefficients of corrupt inputs
+// may overflow the 16-bit intermediates.
+void InverseTransformBlockIFast(const int16_t* JXL_RESTRICT qblock,
+                               const float* JXL_RESTRICT dequant,
+                               const float* JXL_RESTRICT biases,
+                               const int16_t* JXL_RESTRICT dequant_i16,
+                               float* JXL_RESTRICT scratch_space,
+                               float* JXL_RESTRICT output,
+                               size_t output_stride, size_t dctsize) {
+  int16_t* JXL_RESTRICT block0 = reinterpret_cast<int16_t*>(scratch_space);
+  int16_t* JXL_RESTRICT block1 = block0 + DCTSIZE2;
+  for (size_t k = 0; k < DCTSIZE2; k += Lanes(d16)) {
+    const V16 mul = Load(d16, dequant_i16 + k);
+    Store(Mul(LoadU(d16, qblock + k), mul), d16, block0 + k);
+  }
+  Transpose8x8Block(block0, block1);
+  V16 rows[8];
+  for (size_t i = 0; i < 8; i += Lanes(d16)) {
+    IFastIDCT1D(block1 + i, rows);
+    for (size_t k = 0; k < 8; ++k) {
+      Store(rows[k], d16, block0 + k * 8 + i);
+    }
+  }
+  Transpose8x8Block(block0, block1);
+  const V16 vmin = Set(d16, -(128 << kIFastOutputBits));
+  const V16 vmax = Set(d16, 127 << kIFastOutputBits);
+  for (size_t i = 0; i < 8; i += Lanes(d16)) {
+    IFastIDCT1D(block1 + i, rows);
+    for (size_t k = 0; k < 8; ++k) {
+      Store(Min(Max(rows[k], vmin), vmax), d16, block0 + k * 8 + i);
+    }
+  }
+  const Rebind<int32_t, D8> di8;
+  const Rebind<int16_t, D8> di16;
+  const auto scale = Set(d8, 1.0f / (255 << kIFastOutputBits));
+  for (size_t y = 0; y < 8; ++y) {
+    for (size_t x = 0; x < 8; x += Lanes(d8)) {
+      const auto pixels = PromoteTo(di8, Load(di16, block0 + y * 8 + x));
+      StoreU(Mul(ConvertTo(d8, pixels), scale), d8,
+             output + y * output_stride + x);
+    }
+  }
+}
+
 // Computes the N-point IDCT of in[], and stores the result in out[]. The in[]
 // array is at most 8 values long, values in[8:N-1] are assumed to be 0.
 void Compute1dIDCT(float* in, float* out, size_t N) {
@@ -614,6 +730,7 @@ void Compute1dIDCT(float* in, float* out, size_t N) {
 void InverseTransformBlockGeneric(const int16_t* JXL_RESTRICT qblock,
                                   const float* JXL_RESTRICT dequant,
                                   const float* JXL_RESTRICT biases,
+                                  const int16_t* JXL_RESTRICT dequant_i16,
                                   float* JXL_RESTRICT scratch_space,
                                   float* JXL_RESTRICT output,
                                   size_t output_stride, size_t dctsize) {
@@ -674,12 +791,42 @@ HWY_AFTER_NAMESPACE();
 namespace jpegli {
 
 HWY_EXPORT(InverseTransformBlock8x8);
+HWY_EXPORT(InverseTransformBlockIFast);
 HWY_EXPORT(InverseTransformBlockGeneric);
 
+namespace {
+
+// Computes the multipliers of the integer IDCT, which include the AAN scale
+// factors. Returns false if they do not fit into 16 bits.
+bool ComputeIFastDequantTable(const JQUANT_TBL* table, int16_t* dequant_i16) {
+  constexpr double kPi = 3.14159265358979323846;
+  double aan_scales[DCTSIZE];
+  aan_scales[0] = 1.0;
+  for (size_t k = 1; k < DCTSIZE; ++k) {
+    aan_scales[k] = std::cos(k * kPi / 16) * std::sqrt(2.0);
+  }
+  for (size_t k = 0; k < DCTSIZE2; ++k) {
+    const double mul = table->quantval[k] * aan_scales[k / DCTSIZE] *
+                       aan_scales[k % DCTSIZE] * (1 << kIFastPass1Bits);
+    const long val = std::lround(mul);
+    if (val > std::numeric_limits<int16_t>::max()) return false;
+    dequant_i16[k] = static_cast<int16_t>(val);
+  }
+  return true;
+}
+
+}  // namespace
+
 void ChooseInverseTransform(j_decompress_ptr cinfo) {
   jpeg_decomp_master* m = cinfo->master;
   for (int c = 0; c < cinfo->num_components; ++c) {
-    if (m->scaled_dct_size[c] == DCTSIZE) {
+    const JQUANT_TBL* table = cinfo->comp_info[c].quant_table;
+    if (m->scaled_dct_size[c] == DCTSIZE && cinfo->dct_method == JDCT_IFAST &&
+        table != nullptr &&
+        ComputeIFastDequantTable(table, &m->dequant_i16_[c * DCTSIZE2])) {
+      m->inverse_transform[c] =
+          HWY_DYNAMIC_DISPATCH(InverseTransformBlockIFast);
+    } else if (m->scaled_dct_size[c] == DCTSIZE) {
       m->inverse_transform[c] = HWY_DYNAMIC_DISPATCH(InverseTransformBlock8x8);
     } else {
       m->inverse_transform[c] =
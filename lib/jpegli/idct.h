@@ -11,6 +11,10 @@
 
 namespace jpegli {
 
+// Number of fractional bits of the 16-bit dequantized coefficients of the
+// integer IDCT that is used for JDCT_IFAST.
+constexpr int kIFastPass1Bits = 2;
+
 void ChooseInverseTransform(j_decompress_ptr cinfo);
 
 }  // namespace jpegli
@@ -57,6 +57,7 @@ using hwy::HWY_NAMESPACE::Clamp;
 using hwy::HWY_NAMESPACE::Gt;
 using hwy::HWY_NAMESPACE::IfThenElseZero;
 using hwy::HWY_NAMESPACE::Mul;
+using hwy::HWY_NAMESPACE::MulAdd;
 using hwy::HWY_NAMESPACE::NearestInt;
 using hwy::HWY_NAMESPACE::Or;
 using hwy::HWY_NAMESPACE::Rebind;
@@ -277,6 +278,54 @@ void WriteToOutput(j_decompress_ptr cinfo, float* JXL_RESTRICT rows[],
   }
 }
 
+// Fused version of YCbCrToRGB(), DecenterRow() and WriteToOutput() for 8-bit
+// RGB output, which does not write back the intermediate float rows.
+void WriteYCbCrToRGB8(j_decompress_ptr cinfo,
+                      const float* JXL_RESTRICT rows[kMaxComponents],
+                      size_t xoffset, size_t len,
+                      uint8_t* JXL_RESTRICT output) {
+  jpeg_decomp_master* m = cinfo->master;
+  uint8_t* JXL_RESTRICT scratch_space = m->output_scratch_;
+  const HWY_CAPPED(float, 8) df;
+  const Rebind<uint8_t, decltype(df)> du;
+  const float* JXL_RESTRICT row0 = rows[0] + xoffset;
+  const float* JXL_RESTRICT row1 = rows[1] + xoffset;
+  const float* JXL_RESTRICT row2 = rows[2] + xoffset;
+#if JXL_MEMORY_SANITIZER
+  const size_t padding = hwy::RoundUpTo(len, Lanes(df)) - len;
+  for (size_t c = 0; c < 3; ++c) {
+    __msan_unpoison(rows[c] + xoffset + len, sizeof(rows[c][0]) * padding);
+  }
+#endif
+  // Same constants as in YCbCrToRGB().
+  const auto crcr = Set(df, 1.402f);
+  const auto cgcb = Set(df, -0.114f * 1.772f / 0.587f);
+  const auto cgcr = Set(df, -0.299f * 1.402f / 0.587f);
+  const auto cbcb = Set(df, 1.772f);
+  const auto c128 = Set(df, 128.0f / 255);
+  const auto zero = Zero(df);
+  const auto mul = Set(df, 255.0f);
+  for (size_t i = 0; i < len; i += Lanes(df)) {
+    const auto y_vec = LoadU(df, row0 + i);
+    const auto cb_vec = LoadU(df, row1 + i);
+    const auto cr_vec = LoadU(df, row2 + i);
+    const auto r_vec = Add(MulAdd(crcr, cr_vec, y_vec), c128);
+    const auto g_vec =
+        Add(MulAdd(cgcr, cr_vec, MulAdd(cgcb, cb_vec, y_vec)), c128);
+    const auto b_vec = Add(MulAdd(cbcb, cb_vec, y_vec), c128);
+    const auto v0 = Clamp(zero, Mul(r_vec, mul), mul);
+    const auto v1 = Clamp(zero, Mul(g_vec, mul), mul);
+    const auto v2 = Clamp(zero, Mul(b_vec, mul), mul);
+    StoreInterleaved3(DemoteTo(du, NearestInt(v0)),
+                      DemoteTo(du, NearestInt(v1)),
+                      DemoteTo(du, NearestInt(v2)), du, &scratch_space[3 * i]);
+  }
+#if JXL_MEMORY_SANITIZER
+  __msan_poison(scratch_space + 3 * len, 3 * padding);
+#endif
+  memcpy(output, scratch_space, 3 * len);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace jpegli
@@ -289,6 +338,7 @@ namespace jpegli {
 HWY_EXPORT(GatherBlockStats);
 HWY_EXPORT(WriteToOutput);
 HWY_EXPORT(DecenterRow);
+HWY_EXPORT(WriteYCbCrToRGB8);
 
 void GatherBlockStats(const int16_t* JXL_RESTRICT coeffs,
                       const size_t coeffs_size, int32_t* JXL_RESTRICT nonzeros,
@@ -308,8 +358,31 @@ void DecenterRow(float* row, size_t xsize) {
   return HWY_DYNAMIC_DISPATCH(DecenterRow)(row, xsize);
 }
 
+void WriteYCbCrToRGB8(j_decompress_ptr cinfo,
+                      const float* JXL_RESTRICT rows[kMaxComponents],
+                      size_t xoffset, size_t len,
+                      uint8_t* JXL_RESTRICT output) {
+  return HWY_DYNAMIC_DISPATCH(WriteYCbCrToRGB8)(cinfo, rows, xoffset, len,
+                                                output);
+}
+
+// Returns true if the color transform and the output of the current pass can
+// be done with WriteYCbCrToRGB8(). JCS_RGB is the only output color space with
+// more than one channel that ChooseColorTransform() accepts for YCbCr input,
+// so there are no RGBA or BGRA layouts to fuse; they would need their own
+// StoreInterleaved variant once the color transform supports them.
+bool UseFusedYCbCrToRGB8(j_decompress_ptr cinfo) {
+  jpeg_decomp_master* m = cinfo->master;
+  return cinfo->jpeg_color_space == JCS_YCbCr &&
+         cinfo->out_color_space == JCS_RGB &&
+         m->output_data_type_ == JPEGLI_TYPE_UINT8 &&
+         !(cinfo->quantize_colors && m->quant_pass_ == 1);
+}
+
 bool ShouldApplyDequantBiases(j_decompress_ptr cinfo, int ci) {
   const auto& compinfo = cinfo->comp_info[ci];
+  // The integer IDCT does not use the dequantization biases.
+  if (cinfo->dct_method == JDCT_IFAST) return false;
   return (compinfo.h_samp_factor == cinfo->max_h_samp_factor &&
           compinfo.v_samp_factor == cinfo->max_v_samp_factor);
 }
@@ -621,15 +694,15 @@ void DecodeCurrentiMCURow(j_decompress_ptr cinfo) {
       for (size_t bx = 0; bx < compinfo.width_in_blocks; ++bx) {
         if (m->apply_smoothing) {
           PredictSmooth(cinfo, ba[c], c, bx, iy);
-          (*m->inverse_transform[c])(m->smoothing_scratch_, &m->dequant_[k0],
-                                     &m->biases_[k0], m->idct_scratch_,
-                                     &row_out[bx * dctsize], raw_out->stride(),
-                                     dctsize);
+          (*m->inverse_transform[c])(
+              m->smoothing_scratch_, &m->dequant_[k0], &m->biases_[k0],
+              &m->dequant_i16_[k0], m->idct_scratch_, &row_out[bx * dctsize],
+              raw_out->stride(), dctsize);
         } else {
-          (*m->inverse_transform[c])(&row_in[bx * DCTSIZE2], &m->dequant_[k0],
-                                     &m->biases_[k0], m->idct_scratch_,
-                                     &row_out[bx * dctsize], raw_out->stride(),
-                                     dctsize);
+          (*m->inverse_transform[c])(
+              &row_in[bx * DCTSIZE2], &m->dequant_[k0], &m->biases_[k0],
+              &m->dequant_i16_[k0], m->idct_scratch_, &row_out[bx * dctsize],
+              raw_out->stride(), dctsize);
         }
       }
       if (m->streaming_mode_) {
@@ -684,10 +757,15 @@ void ProcessOutput(j_decompress_ptr cinfo, size_t* num_output_rows,
     yend = std::min<size_t>(yend, ybegin + max_output_rows - *num_output_rows);
     size_t yb = (ybegin / vfactor) * vfactor;
     size_t ye = DivCeil(yend, vfactor) * vfactor;
+    const bool fused = UseFusedYCbCrToRGB8(cinfo);
     for (size_t y = yb; y < ye; y += vfactor) {
       for (int c = 0; c < cinfo->num_components; ++c) {
         RowBuffer<float>* raw_out = &m->raw_output_[c];
         RowBuffer<float>* render_out = &m->render_output_[c];
+        if (fused && m->v_factor[c] == 1 && m->h_factor[c] == 1) {
+          // The fused output reads these rows directly from raw_out.
+          continue;
+        }
         int line_groups = vfactor / m->v_factor[c];
         int downsampled_width = output_width / m->h_factor[c];
         size_t yc = y / m->v_factor[c];
@@ -729,21 +807,34 @@ void ProcessOutput(j_decompress_ptr cinfo, size_t* num_output_rows,
       }
       for (int yix = 0; yix < vfactor; ++yix) {
         if (y + yix < ybegin || y + yix >= yend) continue;
-        float* rows[kMaxComponents];
-        int num_all_components =
-            std::max(cinfo->out_color_components, cinfo->num_components);
-        for (int c = 0; c < num_all_components; ++c) {
-          rows[c] = m->render_output_[c].Row(yix);
-        }
-        (*m->color_transform)(rows, output_width);
-        for (int c = 0; c < cinfo->out_color_components; ++c) {
-          // Undo the centering of the sample values around zero.
-          DecenterRow(rows[c], output_width);
-        }
-        if (scanlines) {
-          uint8_t* output = scanlines[*num_output_rows];
-          WriteToOutput(cinfo, rows, m->xoffset_, cinfo->output_width,
-                        cinfo->out_color_components, output);
+        if (fused) {
+          const float* rows[kMaxComponents];
+          for (int c = 0; c < cinfo->num_components; ++c) {
+            rows[c] = (m->v_factor[c] == 1 && m->h_factor[c] == 1)
+                          ? m->raw_output_[c].Row(y + yix)
+                          : m->render_output_[c].Row(yix);
+          }
+          if (scanlines) {
+            WriteYCbCrToRGB8(cinfo, rows, m->xoffset_, cinfo->output_width,
+                             scanlines[*num_output_rows]);
+          }
+        } else {
+          float* rows[kMaxComponents];
+          int num_all_components =
+              std::max(cinfo->out_color_components, cinfo->num_components);
+          for (int c = 0; c < num_all_components; ++c) {
+            rows[c] = m->render_output_[c].Row(yix);
+          }
+          (*m->color_transform)(rows, output_width);
+          for (int c = 0; c < cinfo->out_color_components; ++c) {
+            // Undo the centering of the sample values around zero.
+            DecenterRow(rows[c], output_width);
+          }
+          if (scanlines) {
+            uint8_t* output = scanlines[*num_output_rows];
+            WriteToOutput(cinfo, rows, m->xoffset_, cinfo->output_width,
+                          cinfo->out_color_components, output);
+          }
         }
         JXL_ASSERT(cinfo->output_scanline == y + yix);
         ++cinfo->output_scanline;
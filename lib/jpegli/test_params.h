@@ -150,6 +150,7 @@ struct DecompressParams {
   bool crop_output = false;
   bool do_block_smoothing = false;
   bool do_fancy_upsampling = true;
+  int dct_method = 0;  // JDCT_ISLOW
   bool skip_scans = false;
   int scale_num = 1;
   int scale_denom = 1;
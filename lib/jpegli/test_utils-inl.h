@@ -214,6 +214,7 @@ void SetDecompressParams(const DecompressParams& dparams,
                          j_decompress_ptr cinfo) {
   cinfo->do_block_smoothing = dparams.do_block_smoothing;
   cinfo->do_fancy_upsampling = dparams.do_fancy_upsampling;
+  cinfo->dct_method = (J_DCT_METHOD)dparams.dct_method;
   if (dparams.output_mode == RAW_DATA) {
     cinfo->raw_data_out = TRUE;
   }
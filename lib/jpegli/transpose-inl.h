@@ -103,6 +103,67 @@ static JXL_INLINE void Transpose8x8Block(const float* JXL_RESTRICT from,
 }
 #endif
 
+#if HWY_TARGET != HWY_SCALAR
+static JXL_INLINE void Transpose8x8Block(const int16_t* JXL_RESTRICT from,
+                                         int16_t* JXL_RESTRICT to) {
+  const HWY_CAPPED(int16_t, 8) d;
+  const hwy::HWY_NAMESPACE::Repartition<int32_t, decltype(d)> d32;
+  auto i0 = Load(d, from);
+  auto i1 = Load(d, from + 1 * 8);
+  auto i2 = Load(d, from + 2 * 8);
+  auto i3 = Load(d, from + 3 * 8);
+  auto i4 = Load(d, from + 4 * 8);
+  auto i5 = Load(d, from + 5 * 8);
+  auto i6 = Load(d, from + 6 * 8);
+  auto i7 = Load(d, from + 7 * 8);
+
+  const auto q0 = BitCast(d32, InterleaveLower(d, i0, i1));
+  const auto q1 = BitCast(d32, InterleaveUpper(d, i0, i1));
+  const auto q2 = BitCast(d32, InterleaveLower(d, i2, i3));
+  const auto q3 = BitCast(d32, InterleaveUpper(d, i2, i3));
+  const auto q4 = BitCast(d32, InterleaveLower(d, i4, i5));
+  const auto q5 = BitCast(d32, InterleaveUpper(d, i4, i5));
+  const auto q6 = BitCast(d32, InterleaveLower(d, i6, i7));
+  const auto q7 = BitCast(d32, InterleaveUpper(d, i6, i7));
+
+  const auto r0 = BitCast(d, InterleaveLower(d32, q0, q2));
+  const auto r1 = BitCast(d, InterleaveUpper(d32, q0, q2));
+  const auto r2 = BitCast(d, InterleaveLower(d32, q1, q3));
+  const auto r3 = BitCast(d, InterleaveUpper(d32, q1, q3));
+  const auto r4 = BitCast(d, InterleaveLower(d32, q4, q6));
+  const auto r5 = BitCast(d, InterleaveUpper(d32, q4, q6));
+  const auto r6 = BitCast(d, InterleaveLower(d32, q5, q7));
+  const auto r7 = BitCast(d, InterleaveUpper(d32, q5, q7));
+
+  i0 = ConcatLowerLower(d, r4, r0);
+  i1 = ConcatUpperUpper(d, r4, r0);
+  i2 = ConcatLowerLower(d, r5, r1);
+  i3 = ConcatUpperUpper(d, r5, r1);
+  i4 = ConcatLowerLower(d, r6, r2);
+  i5 = ConcatUpperUpper(d, r6, r2);
+  i6 = ConcatLowerLower(d, r7, r3);
+  i7 = ConcatUpperUpper(d, r7, r3);
+
+  Store(i0, d, to);
+  Store(i1, d, to + 1 * 8);
+  Store(i2, d, to + 2 * 8);
+  Store(i3, d, to + 3 * 8);
+  Store(i4, d, to + 4 * 8);
+  Store(i5, d, to + 5 * 8);
+  Store(i6, d, to + 6 * 8);
+  Store(i7, d, to + 7 * 8);
+}
+#else
+static JXL_INLINE void Transpose8x8Block(const int16_t* JXL_RESTRICT from,
+                                         int16_t* JXL_RESTRICT to) {
+  for (size_t n = 0; n < 8; ++n) {
+    for (size_t m = 0; m < 8; ++m) {
+      to[8 * n + m] = from[8 * m + n];
+    }
+  }
+}
+#endif
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace
 }  // namespace HWY_NAMESPACE
@@ -5,6 +5,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <vector>
 
@@ -16,6 +17,7 @@
 #include "lib/jxl/enc_ans.h"
 #include "lib/jxl/enc_aux_out.h"
 #include "lib/jxl/enc_bit_writer.h"
+#include "lib/jxl/enc_cluster.h"
 #include "lib/jxl/testing.h"
 
 namespace jxl {
@@ -184,6 +186,44 @@ TEST(ANSTest, UintConfigRoundtrip) {
   }
 }
 
+TEST(ANSTest, PrecountedHistogramsMatch) {
+  constexpr size_t kNumContexts = 5;
+  Rng rng(0);
+  std::vector<std::vector<Token>> tokens(7);
+  std::vector<Histogram> histograms(kNumContexts);
+  for (std::vector<Token>& stream : tokens) {
+    for (size_t i = 0; i < 1000; i++) {
+      stream.emplace_back(rng.UniformU(0, kNumContexts),
+                          rng.UniformU(0, 1 << rng.UniformU(0, 12)));
+    }
+    AddTokensToHistograms(stream, &histograms);
+  }
+  std::vector<std::vector<Token>> tokens_copy = tokens;
+
+  BitWriter writer;
+  std::vector<uint8_t> context_map;
+  EntropyEncodingData codes;
+  BuildAndEncodeHistograms(HistogramParams(), kNumContexts, tokens, &codes,
+                           &context_map, &writer, 0, nullptr);
+  BitWriter precounted_writer;
+  std::vector<uint8_t> precounted_context_map;
+  EntropyEncodingData precounted_codes;
+  BuildAndEncodeHistograms(HistogramParams(), kNumContexts, tokens_copy,
+                           &precounted_codes, &precounted_context_map,
+                           &precounted_writer, 0, nullptr, &histograms);
+  EXPECT_EQ(context_map, precounted_context_map);
+  EXPECT_EQ(writer.BitsWritten(), precounted_writer.BitsWritten());
+  for (BitWriter* w : {&writer, &precounted_writer}) {
+    BitWriter::Allotment allotment(w, kBitsPerByte);
+    w->ZeroPadToByte();
+    allotment.ReclaimAndCharge(w, 0, nullptr);
+  }
+  const Span<const uint8_t> bytes = writer.GetSpan();
+  const Span<const uint8_t> precounted_bytes = precounted_writer.GetSpan();
+  ASSERT_EQ(bytes.size(), precounted_bytes.size());
+  EXPECT_EQ(0, memcmp(bytes.data(), precounted_bytes.data(), bytes.size()));
+}
+
 void TestCheckpointing(bool ans, bool lz77) {
   std::vector<std::vector<Token>> input_values(1);
   for (size_t i = 0; i < 1024; i++) {
@@ -11,7 +11,15 @@
 // Disabled: slower than malloc + alignment.
 #define JXL_USE_MMAP 0
 
-#if JXL_USE_MMAP
+// Large allocations are aligned to huge pages and madvise()d, see
+// SetLargeAllocationThreshold.
+#if defined(__linux__)
+#define JXL_USE_HUGE_PAGES 1
+#else
+#define JXL_USE_HUGE_PAGES 0
+#endif
+
+#if JXL_USE_MMAP || JXL_USE_HUGE_PAGES
 #include <sys/mman.h>
 #endif
 
@@ -38,6 +46,45 @@ std::atomic<uint64_t> num_allocations{0};
 std::atomic<uint64_t> bytes_in_use{0};
 std::atomic<uint64_t> max_bytes_in_use{0};
 
+// Initial threshold, in MiB, from the JXL_LARGE_ALLOCATION_MIB environment
+// variable, so that applications and tools can opt in without code changes.
+size_t LargeAllocationThresholdFromEnvironment() {
+  const char* mib = getenv("JXL_LARGE_ALLOCATION_MIB");
+  if (mib == nullptr) return 0;
+  char* end;
+  const unsigned long long value = strtoull(mib, &end, 10);  // NOLINT
+  if (end == mib || *end != '\0' ||
+      value > std::numeric_limits<size_t>::max() >> 20) {
+    return 0;
+  }
+  return static_cast<size_t>(value) << 20;
+}
+
+std::atomic<size_t>& LargeAllocationThresholdStorage() {
+  static std::atomic<size_t> threshold{
+      LargeAllocationThresholdFromEnvironment()};
+  return threshold;
+}
+
+// Returns null or `size` bytes starting at a huge page boundary, which can be
+// released with free().
+void* AllocateHugePageAligned(const size_t size) {
+#if JXL_USE_HUGE_PAGES
+  void* allocated = nullptr;
+  if (posix_memalign(&allocated, CacheAligned::kHugePageSize, size) != 0) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  // Failure only means that the kernel keeps using regular pages.
+  (void)madvise(allocated, size, MADV_HUGEPAGE);
+#endif
+  return allocated;
+#else
+  (void)size;
+  return nullptr;
+#endif
+}
+
 }  // namespace
 
 // Avoids linker errors in pre-C++17 builds.
@@ -45,6 +92,17 @@ constexpr size_t CacheAligned::kPointerSize;
 constexpr size_t CacheAligned::kCacheLineSize;
 constexpr size_t CacheAligned::kAlignment;
 constexpr size_t CacheAligned::kAlias;
+constexpr size_t CacheAligned::kHugePageSize;
+
+void CacheAligned::SetLargeAllocationThreshold(const size_t bytes) {
+  LargeAllocationThresholdStorage().store(bytes, std::memory_order_relaxed);
+}
+
+size_t CacheAligned::LargeAllocationThreshold() {
+  // Without huge pages, large allocations are not special.
+  if (!JXL_USE_HUGE_PAGES) return 0;
+  return LargeAllocationThresholdStorage().load(std::memory_order_relaxed);
+}
 
 void CacheAligned::PrintStats() {
   fprintf(
@@ -53,6 +111,11 @@ void CacheAligned::PrintStats() {
       static_cast<double>(max_bytes_in_use.load(std::memory_order_relaxed)));
 }
 
+size_t CacheAligned::ResetMaxBytesInUse() {
+  return static_cast<size_t>(max_bytes_in_use.exchange(
+      bytes_in_use.load(std::memory_order_acquire), std::memory_order_acq_rel));
+}
+
 size_t CacheAligned::NextOffset() {
   static std::atomic<uint32_t> next{0};
   constexpr uint32_t kGroups = CacheAligned::kAlias / CacheAligned::kAlignment;
@@ -84,15 +147,30 @@ void* CacheAligned::Allocate(const size_t payload_size, size_t offset) {
   if (allocated == MAP_FAILED) return nullptr;
   const uintptr_t aligned = reinterpret_cast<uintptr_t>(allocated);
 #else
-  const size_t allocated_size = kAlias + offset + payload_size;
-  void* allocated = malloc(allocated_size);
-  if (allocated == nullptr) return nullptr;
-  // Always round up even if already aligned - we already asked for kAlias
-  // extra bytes and there's no way to give them back.
-  uintptr_t aligned = reinterpret_cast<uintptr_t>(allocated) + kAlias;
-  static_assert((kAlias & (kAlias - 1)) == 0, "kAlias must be a power of 2");
-  static_assert(kAlias >= kAlignment, "Cannot align to more than kAlias");
-  aligned &= ~(kAlias - 1);
+  size_t allocated_size;
+  void* allocated;
+  uintptr_t aligned;
+  const size_t large_threshold = LargeAllocationThreshold();
+  if (JXL_USE_HUGE_PAGES && large_threshold != 0 &&
+      payload_size >= large_threshold) {
+    // Whole huge pages, so that none of them is shared with other buffers.
+    // The offset within the first page still spreads out cache sets.
+    allocated_size = hwy::RoundUpTo(offset + payload_size, kHugePageSize);
+    allocated = AllocateHugePageAligned(allocated_size);
+    if (allocated == nullptr) return nullptr;
+    aligned = reinterpret_cast<uintptr_t>(allocated);
+    static_assert(kHugePageSize % kAlias == 0, "Huge pages must be aligned");
+  } else {
+    allocated_size = kAlias + offset + payload_size;
+    allocated = malloc(allocated_size);
+    if (allocated == nullptr) return nullptr;
+    // Always round up even if already aligned - we already asked for kAlias
+    // extra bytes and there's no way to give them back.
+    aligned = reinterpret_cast<uintptr_t>(allocated) + kAlias;
+    static_assert((kAlias & (kAlias - 1)) == 0, "kAlias must be a power of 2");
+    static_assert(kAlias >= kAlignment, "Cannot align to more than kAlias");
+    aligned &= ~(kAlias - 1);
+  }
 #endif
 
 #if 0
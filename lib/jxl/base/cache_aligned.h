@@ -21,6 +21,10 @@ namespace jxl {
 class CacheAligned {
  public:
   static void PrintStats();
+  // Returns the maximum number of bytes allocated at the same time since the
+  // previous call (or since startup), and restarts measuring from the number
+  // of bytes currently allocated. For tests of peak memory usage.
+  static size_t ResetMaxBytesInUse();
 
   static constexpr size_t kPointerSize = sizeof(void*);
   static constexpr size_t kCacheLineSize = 64;
@@ -30,6 +34,20 @@ class CacheAligned {
   // preceding stores can occur.
   static constexpr size_t kAlias = 2048;
 
+  // Alignment of large allocations, the size of a (transparent) huge page on
+  // common platforms.
+  static constexpr size_t kHugePageSize = size_t{2} << 20;
+
+  // Allocations of at least `bytes` bytes (0 disables this) are large
+  // buffers, e.g. full-frame planes. On Linux, they are aligned to
+  // kHugePageSize and madvise()d to be backed by transparent huge pages to
+  // reduce TLB misses; elsewhere, the threshold is ignored. The initial value
+  // is taken from the JXL_LARGE_ALLOCATION_MIB environment variable, in MiB,
+  // and is 0 if it is not set. See also FirstTouchImage.
+  static void SetLargeAllocationThreshold(size_t bytes);
+  // Returns 0 on platforms where large allocations are not special.
+  static size_t LargeAllocationThreshold();
+
   // Returns a 'random' (cyclical) offset suitable for Allocate.
   static size_t NextOffset();
 
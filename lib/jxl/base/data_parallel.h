@@ -13,7 +13,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
 #include "lib/jxl/base/bits.h"
+#include "lib/jxl/base/cache_aligned.h"
 #include "lib/jxl/base/status.h"
 #if JXL_COMPILER_MSVC
 // suppress warnings about the const & applied to function types
@@ -25,15 +30,41 @@ namespace jxl {
 class ThreadPool {
  public:
   ThreadPool(JxlParallelRunner runner, void* runner_opaque)
-      : runner_(runner ? runner : &ThreadPool::SequentialRunnerStatic),
-        runner_opaque_(runner ? runner_opaque : static_cast<void*>(this)) {}
+      : ThreadPool(runner, nullptr, runner_opaque) {}
+
+  // At most one of `runner` and `priority_runner` may be set; the latter also
+  // receives priority() on every Run().
+  ThreadPool(JxlParallelRunner runner,
+             JxlParallelPriorityRunner priority_runner, void* runner_opaque)
+      : runner_(runner || priority_runner
+                    ? runner
+                    : &ThreadPool::SequentialRunnerStatic),
+        priority_runner_(priority_runner),
+        runner_opaque_(runner || priority_runner ? runner_opaque
+                                                 : static_cast<void*>(this)) {}
 
   ThreadPool(const ThreadPool&) = delete;
   ThreadPool& operator&(const ThreadPool&) = delete;
 
+  // Null if the pool was created with a JxlParallelPriorityRunner.
   JxlParallelRunner runner() const { return runner_; }
   void* runner_opaque() const { return runner_opaque_; }
 
+  // Flag set, possibly from another thread, when the encoder or decoder that
+  // owns the pool is cancelled. Long-running loops poll it between groups and
+  // iterations, see CheckCancelled.
+  void SetCancelFlag(const std::atomic<bool>* cancelled) {
+    cancelled_ = cancelled;
+  }
+  bool IsCancelled() const {
+    return cancelled_ != nullptr && cancelled_->load(std::memory_order_relaxed);
+  }
+
+  // Scheduling priority hint of the owner, see JxlPriority. Only passed to a
+  // JxlParallelPriorityRunner, which decides how to use it.
+  void SetPriority(JxlPriority priority) { priority_ = priority; }
+  JxlPriority priority() const { return priority_; }
+
   // Runs init_func(num_threads) followed by data_func(task, thread) on worker
   // thread(s) for every task in [begin, end). init_func() must return a Status
   // indicating whether the initialization succeeded.
@@ -47,9 +78,15 @@ class ThreadPool {
              const DataFunc& data_func, const char* caller = "") {
     JXL_ASSERT(begin <= end);
     if (begin == end) return true;
-    RunCallState<InitFunc, DataFunc> call_state(init_func, data_func);
+    RunCallState<InitFunc, DataFunc> call_state(this, init_func, data_func);
     // The runner_ uses the C convention and returns 0 in case of error, so we
     // convert it to a Status.
+    if (priority_runner_ != nullptr) {
+      return (*priority_runner_)(runner_opaque_, priority_,
+                                 static_cast<void*>(&call_state),
+                                 &call_state.CallInitFunc,
+                                 &call_state.CallDataFunc, begin, end) == 0;
+    }
     return (*runner_)(runner_opaque_, static_cast<void*>(&call_state),
                       &call_state.CallInitFunc, &call_state.CallDataFunc, begin,
                       end) == 0;
@@ -58,19 +95,61 @@ class ThreadPool {
   // Use this as init_func when no initialization is needed.
   static Status NoInit(size_t num_threads) { return true; }
 
+  // Number of independent scratch buffers per thread. Data functions that run
+  // within the same Run() call must use different slots for buffers that are
+  // live at the same time.
+  static constexpr size_t kNumScratchSlots = 4;
+
+  // Returns uninitialized, cache-aligned storage for `num` elements of T owned
+  // by `thread` (the index passed to data_func). The storage belongs to the
+  // pool and outlives Run(), so hot data functions can reuse it across tasks,
+  // calls and frames instead of allocating every time. The buffer only grows;
+  // growing invalidates pointers previously returned for the same thread and
+  // slot. Returns nullptr if the allocation fails.
+  // Outside of Run(), only the calling thread may use it, as `thread` 0.
+  template <typename T>
+  T* Scratch(size_t thread, size_t slot, size_t num) {
+    static_assert(std::is_trivial<T>::value, "Scratch is not constructed");
+    JXL_DASSERT(slot < kNumScratchSlots);
+    if (thread >= scratch_.size()) scratch_.resize(thread + 1);
+    ThreadScratch& scratch = scratch_[thread];
+    const size_t bytes = num * sizeof(T);
+    if (bytes > scratch.bytes[slot]) {
+      scratch.mem[slot] = AllocateArray(bytes);
+      scratch.bytes[slot] = scratch.mem[slot] ? bytes : 0;
+    }
+    return reinterpret_cast<T*>(scratch.mem[slot].get());
+  }
+
+  // Takes over the scratch buffers of `other`, for owners that replace their
+  // pool but keep their allocations.
+  void TakeScratch(ThreadPool* other) { scratch_.swap(other->scratch_); }
+
  private:
+  struct ThreadScratch {
+    CacheAlignedUniquePtr mem[kNumScratchSlots];
+    size_t bytes[kNumScratchSlots] = {};
+  };
+
+  // Called before init_func so that data functions never resize scratch_.
+  void PrepareScratch(size_t num_threads) {
+    if (num_threads > scratch_.size()) scratch_.resize(num_threads);
+  }
+
   // class holding the state of a Run() call to pass to the runner_ as an
   // opaque_jpegxl pointer.
   template <class InitFunc, class DataFunc>
   class RunCallState final {
    public:
-    RunCallState(const InitFunc& init_func, const DataFunc& data_func)
-        : init_func_(init_func), data_func_(data_func) {}
+    RunCallState(ThreadPool* pool, const InitFunc& init_func,
+                 const DataFunc& data_func)
+        : pool_(pool), init_func_(init_func), data_func_(data_func) {}
 
     // JxlParallelRunInit interface.
     static int CallInitFunc(void* jpegxl_opaque, size_t num_threads) {
       const auto* self =
           static_cast<RunCallState<InitFunc, DataFunc>*>(jpegxl_opaque);
+      self->pool_->PrepareScratch(num_threads);
       // Returns -1 when the internal init function returns false Status to
       // indicate an error.
       return self->init_func_(num_threads) ? 0 : -1;
@@ -85,6 +164,7 @@ class ThreadPool {
     }
 
    private:
+    ThreadPool* const pool_;
     const InitFunc& init_func_;
     const DataFunc& data_func_;
   };
@@ -95,11 +175,25 @@ class ThreadPool {
       void* runner_opaque, void* jpegxl_opaque, JxlParallelRunInit init,
       JxlParallelRunFunction func, uint32_t start_range, uint32_t end_range);
 
-  // The caller supplied runner function and its opaque void*.
+  // The caller supplied runner function and its opaque void*. Exactly one of
+  // runner_ and priority_runner_ is set.
   const JxlParallelRunner runner_;
+  const JxlParallelPriorityRunner priority_runner_;
   void* const runner_opaque_;
+
+  const std::atomic<bool>* cancelled_ = nullptr;
+  JxlPriority priority_ = JXL_PRIORITY_NORMAL;
+
+  std::vector<ThreadScratch> scratch_;
 };
 
+// Returns StatusCode::kCancelled if the owner of `pool` (which may be null)
+// has been cancelled. This is not an error in the input, so nothing is logged.
+inline Status CheckCancelled(const ThreadPool* pool) {
+  if (pool != nullptr && pool->IsCancelled()) return StatusCode::kCancelled;
+  return true;
+}
+
 template <class InitFunc, class DataFunc>
 Status RunOnPool(ThreadPool* pool, const uint32_t begin, const uint32_t end,
                  const InitFunc& init_func, const DataFunc& data_func,
@@ -0,0 +1,68 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#ifndef LIB_JXL_BASE_JPEG_ENTROPY_H_
+#define LIB_JXL_BASE_JPEG_ENTROPY_H_
+
+// Building blocks of the JPEG Huffman entropy coder shared by the jpegli
+// encoder and the JPEG reconstruction in lib/jxl/jpeg, which must produce
+// byte-identical output.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib/jxl/base/byte_order.h"
+#include "lib/jxl/base/compiler_specific.h"
+
+namespace jxl {
+
+// Returns non-zero if and only if x has a zero byte, i.e. one of
+// x & 0xff, x & 0xff00, ..., x & 0xff00000000000000 is zero.
+static JXL_INLINE uint64_t HasZeroByte(uint64_t x) {
+  return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+}
+
+// Writes the 8 bytes of `word` in big-endian order to `out`, followed by a
+// stuffed zero byte after every 0xFF byte, as required inside JPEG
+// entropy-coded segments. Returns the number of bytes written, i.e. 8 to 16.
+// The caller must make sure that 16 bytes are available at `out`.
+static JXL_INLINE size_t StoreBE64Stuffed(uint64_t word, uint8_t* out) {
+  StoreBE64(word, out);
+  // Common case: a single word-wide test for 0xFF bytes, no per-byte work.
+  if (JXL_LIKELY(!HasZeroByte(~word))) return 8;
+  size_t pos = 0;
+  for (int shift = 56; shift >= 0; shift -= 8) {
+    const uint8_t byte = (word >> shift) & 0xFF;
+    out[pos++] = byte;
+    if (byte == 0xFF) out[pos++] = 0;
+  }
+  return pos;
+}
+
+// Returns a mask with bit k set if and only if the k-th coefficient of the
+// 8x8 block in zig-zag scan order is non-zero. If `order` is nullptr, the
+// block is expected to already be in zig-zag order, otherwise `order[k]` is
+// the natural order index of the k-th zig-zag position. The run lengths of
+// the Huffman run/size symbols then follow from the trailing zero count of
+// the mask instead of from a per-coefficient loop.
+template <typename T>
+static JXL_INLINE uint64_t NonZeroMask(const T* JXL_RESTRICT block,
+                                       const uint32_t* JXL_RESTRICT order) {
+  uint64_t mask = 0;
+  if (order == nullptr) {
+    for (size_t k = 0; k < 64; ++k) {
+      mask |= static_cast<uint64_t>(block[k] != 0) << k;
+    }
+  } else {
+    for (size_t k = 0; k < 64; ++k) {
+      mask |= static_cast<uint64_t>(block[order[k]] != 0) << k;
+    }
+  }
+  return mask;
+}
+
+}  // namespace jxl
+
+#endif  // LIB_JXL_BASE_JPEG_ENTROPY_H_
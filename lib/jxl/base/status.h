@@ -282,6 +282,10 @@ enum class StatusCode : int32_t {
 
   // Fatal-errors (positive values)
   kGenericError = 1,
+  // The estimated work to decode the input exceeds the configured budget.
+  kWorkBudgetExceeded = 2,
+  // The encoder or decoder was cancelled by the application.
+  kCancelled = 3,
 };
 
 // Drop-in replacement for bool that raises compiler warnings if not used
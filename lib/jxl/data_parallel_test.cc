@@ -5,6 +5,8 @@
 
 #include "lib/jxl/base/data_parallel.h"
 
+#include <vector>
+
 #include "lib/jxl/test_utils.h"
 #include "lib/jxl/testing.h"
 
@@ -84,4 +86,31 @@ TEST_F(DataParallelTest, RunnerNotCalledOnEmptyRange) {
   EXPECT_EQ(0, runner_called_);
 }
 
+TEST(DataParallelScratchTest, ScratchPersistsAcrossRuns) {
+  test::ThreadPoolForTests pool_for_tests(4);
+  ThreadPool* pool = &pool_for_tests;
+  std::vector<float*> first(4);
+  std::vector<float*> second(4);
+  const auto fill = [pool](std::vector<float*>* out) {
+    return [pool, out](uint32_t task, size_t thread) {
+      float* mem = pool->Scratch<float>(thread, 0, 256);
+      ASSERT_NE(nullptr, mem);
+      for (size_t i = 0; i < 256; i++) mem[i] = static_cast<float>(task);
+      (*out)[thread] = mem;
+    };
+  };
+  ASSERT_TRUE(
+      RunOnPool(pool, 0, 64, ThreadPool::NoInit, fill(&first), "Scratch"));
+  ASSERT_TRUE(
+      RunOnPool(pool, 0, 64, ThreadPool::NoInit, fill(&second), "Scratch"));
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(first[i], second[i]);
+    if (first[i] == nullptr) continue;
+    // Smaller requests, and other slots, do not disturb the buffer.
+    EXPECT_EQ(first[i], pool->Scratch<float>(i, 0, 16));
+    EXPECT_NE(static_cast<void*>(first[i]),
+              static_cast<void*>(pool->Scratch<int32_t>(i, 1, 256)));
+  }
+}
+
 }  // namespace jxl
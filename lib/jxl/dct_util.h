@@ -7,7 +7,14 @@
 #define LIB_JXL_DCT_UTIL_H_
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "lib/jxl/base/cache_aligned.h"
 #include "lib/jxl/base/compiler_specific.h"
 #include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/status.h"
@@ -38,12 +45,21 @@ class ACImage {
  public:
   virtual ~ACImage() = default;
   virtual ACType Type() const = 0;
+  // Returns a null pointer if the row could not be allocated.
   virtual ACPtr PlaneRow(size_t c, size_t y, size_t xbase) = 0;
   virtual ConstACPtr PlaneRow(size_t c, size_t y, size_t xbase) const = 0;
   virtual size_t PixelsPerRow() const = 0;
+  virtual size_t xsize() const = 0;
+  virtual size_t ysize() const = 0;
   virtual void ZeroFill() = 0;
   virtual void ZeroFillPlane(size_t c) = 0;
   virtual bool IsEmpty() const = 0;
+  // Hints that row y will not be accessed again. Implementations may free its
+  // storage; a later access then sees zero coefficients.
+  virtual void ReleaseRow(size_t y) = 0;
+  // Hints that row y will not be accessed until more data becomes available.
+  // Implementations may keep it in a more compact form until then.
+  virtual void CompactRow(size_t y) = 0;
 };
 
 template <typename T>
@@ -68,6 +84,9 @@ class ACImageT final : public ACImage {
 
   size_t PixelsPerRow() const override { return img_.PixelsPerRow(); }
 
+  size_t xsize() const override { return img_.xsize(); }
+  size_t ysize() const override { return img_.ysize(); }
+
   void ZeroFill() override { ZeroFillImage(&img_); }
 
   void ZeroFillPlane(size_t c) override { ZeroFillImage(&img_.Plane(c)); }
@@ -76,10 +95,142 @@ class ACImageT final : public ACImage {
     return img_.xsize() == 0 || img_.ysize() == 0;
   }
 
+  void ReleaseRow(size_t /*y*/) override {}
+  void CompactRow(size_t /*y*/) override {}
+
+  // See FirstTouchImage; each row holds the coefficients of one group.
+  Status FirstTouch(ThreadPool* pool) {
+    return FirstTouchImage(pool, &img_, /*rows_per_task=*/1);
+  }
+
  private:
   Image3<T> img_;
 };
 
+// ACImage whose rows, e.g. the coefficients of one group, are only allocated
+// on first access, and that can be freed or kept in a compact form when they
+// are not needed. Each row holds the three planes back to back. Accesses to
+// distinct rows may happen concurrently.
+template <typename T>
+class LazyACImageT final : public ACImage {
+ public:
+  LazyACImageT(size_t xsize, size_t ysize)
+      : xsize_(xsize), dense_(ysize), compact_(ysize) {
+    static_assert(
+        std::is_same<T, int16_t>::value || std::is_same<T, int32_t>::value,
+        "ACImage must be either 32- or 16- bit");
+  }
+  ACType Type() const override {
+    return sizeof(T) == 2 ? ACType::k16 : ACType::k32;
+  }
+  ACPtr PlaneRow(size_t c, size_t y, size_t xbase) override {
+    if (JXL_UNLIKELY(!dense_[y]) && !Expand(y)) {
+      return ACPtr(static_cast<T*>(nullptr));
+    }
+    return ACPtr(DenseRow(y) + c * xsize_ + xbase);
+  }
+  // Only valid for rows that were accessed through the non-const PlaneRow and
+  // not released or compacted since.
+  ConstACPtr PlaneRow(size_t c, size_t y, size_t xbase) const override {
+    JXL_DASSERT(dense_[y]);
+    return ConstACPtr(DenseRow(y) + c * xsize_ + xbase);
+  }
+
+  size_t PixelsPerRow() const override { return xsize_; }
+
+  size_t xsize() const override { return xsize_; }
+  size_t ysize() const override { return dense_.size(); }
+
+  void ZeroFill() override {
+    for (size_t y = 0; y < ysize(); y++) ReleaseRow(y);
+  }
+
+  void ZeroFillPlane(size_t c) override {
+    for (size_t y = 0; y < ysize(); y++) {
+      if (!dense_[y] && compact_[y].empty()) continue;
+      if (!dense_[y]) JXL_CHECK(Expand(y));
+      memset(DenseRow(y) + c * xsize_, 0, xsize_ * sizeof(T));
+    }
+  }
+
+  bool IsEmpty() const override { return xsize_ == 0 || ysize() == 0; }
+
+  void ReleaseRow(size_t y) override {
+    dense_[y].reset();
+    std::vector<uint8_t>().swap(compact_[y]);
+  }
+
+  // Replaces the row by a list of (distance to the previous non-zero
+  // coefficient, zig-zag mapped value) varint pairs if that saves at least
+  // half of its memory, which is typical for the low-precision or
+  // low-frequency early passes of a progressive image.
+  void CompactRow(size_t y) override {
+    if (!dense_[y]) return;
+    const T* JXL_RESTRICT row = DenseRow(y);
+    const size_t num = 3 * xsize_;
+    const size_t max_bytes = num * sizeof(T) / 2;
+    std::vector<uint8_t> bytes;
+    size_t last = 0;
+    for (size_t i = 0; i < num; i++) {
+      if (row[i] == 0) continue;
+      if (bytes.size() + 2 * kMaxVarintBytes > max_bytes) return;
+      const int32_t v = row[i];
+      PutVarint(i - last, &bytes);
+      PutVarint((static_cast<uint32_t>(v) << 1) ^ -static_cast<uint32_t>(v < 0),
+                &bytes);
+      last = i + 1;
+    }
+    bytes.shrink_to_fit();
+    compact_[y].swap(bytes);
+    dense_[y].reset();
+  }
+
+ private:
+  static constexpr size_t kMaxVarintBytes = 5;
+
+  static void PutVarint(uint32_t v, std::vector<uint8_t>* out) {
+    while (v >= 0x80) {
+      out->push_back(static_cast<uint8_t>(v | 0x80));
+      v >>= 7;
+    }
+    out->push_back(static_cast<uint8_t>(v));
+  }
+
+  static uint32_t GetVarint(const uint8_t** pos) {
+    uint32_t v = 0;
+    for (int shift = 0;; shift += 7) {
+      const uint8_t b = *(*pos)++;
+      v |= static_cast<uint32_t>(b & 0x7F) << shift;
+      if (b < 0x80) return v;
+    }
+  }
+
+  T* DenseRow(size_t y) const { return reinterpret_cast<T*>(dense_[y].get()); }
+
+  // Returns false, keeping the compact form, if the allocation fails.
+  bool Expand(size_t y) {
+    dense_[y] = AllocateArray(3 * xsize_ * sizeof(T));
+    if (!dense_[y]) return false;
+    T* JXL_RESTRICT row = DenseRow(y);
+    memset(row, 0, 3 * xsize_ * sizeof(T));
+    const uint8_t* pos = compact_[y].data();
+    const uint8_t* end = pos + compact_[y].size();
+    size_t i = 0;
+    while (pos < end) {
+      i += GetVarint(&pos);
+      const uint32_t v = GetVarint(&pos);
+      row[i++] = static_cast<T>(static_cast<int32_t>(v >> 1) ^
+                                -static_cast<int32_t>(v & 1));
+    }
+    std::vector<uint8_t>().swap(compact_[y]);
+    return true;
+  }
+
+  size_t xsize_;
+  std::vector<CacheAlignedUniquePtr> dense_;
+  std::vector<std::vector<uint8_t>> compact_;
+};
+
 }  // namespace jxl
 
 #endif  // LIB_JXL_DCT_UTIL_H_
@@ -86,21 +86,36 @@ class BitReader {
     if (JXL_UNLIKELY(next_byte_ > end_minus_8_)) {
       BoundsCheckedRefill();
     } else {
-      // It's safe to load 64 bits; insert valid (possibly nonzero) bits above
-      // bits_in_buf_. The shift requires bits_in_buf_ < 64.
-      buf_ |= LoadLE64(next_byte_) << bits_in_buf_;
-
-      // Advance by bytes fully absorbed into the buffer.
-      next_byte_ += (63 - bits_in_buf_) >> 3;
-
-      // We absorbed a multiple of 8 bits, so the lower 3 bits of bits_in_buf_
-      // must remain unchanged, otherwise the next refill's shifted bits will
-      // not align with buf_. Set the three upper bits so the result >= 56.
-      bits_in_buf_ |= 56;
-      JXL_DASSERT(56 <= bits_in_buf_ && bits_in_buf_ < 64);
+      RefillUnchecked();
     }
   }
 
+  // Number of input bytes that subsequent refills may absorb before Refill()
+  // has to fall back to the bounds-checked path. A loop that consumes at most
+  // 8 * k bits per iteration may call RefillUnchecked() once per iteration
+  // for (FastRefillBytes() - 8) / k iterations.
+  size_t FastRefillBytes() const {
+    if (next_byte_ > end_minus_8_) return 0;
+    return static_cast<size_t>(end_minus_8_ - next_byte_);
+  }
+
+  // Refill without the bounds check, see FastRefillBytes().
+  JXL_INLINE void RefillUnchecked() {
+    JXL_DASSERT(next_byte_ <= end_minus_8_);
+    // It's safe to load 64 bits; insert valid (possibly nonzero) bits above
+    // bits_in_buf_. The shift requires bits_in_buf_ < 64.
+    buf_ |= LoadLE64(next_byte_) << bits_in_buf_;
+
+    // Advance by bytes fully absorbed into the buffer.
+    next_byte_ += (63 - bits_in_buf_) >> 3;
+
+    // We absorbed a multiple of 8 bits, so the lower 3 bits of bits_in_buf_
+    // must remain unchanged, otherwise the next refill's shifted bits will
+    // not align with buf_. Set the three upper bits so the result >= 56.
+    bits_in_buf_ |= 56;
+    JXL_DASSERT(56 <= bits_in_buf_ && bits_in_buf_ < 64);
+  }
+
   // Returns the bits that would be returned by Read without calling Advance().
   // It is legal to PEEK at more bits than present in the bitstream (required
   // by Huffman), and those bits will be zero.
@@ -265,10 +280,18 @@ class BitReader {
   JXL_NOINLINE void BoundsCheckedRefill() {
     const uint8_t* end = end_minus_8_ + 8;
 
-    // Read whole bytes until we have [56, 64) bits (same as LoadLE64)
-    for (; bits_in_buf_ < 64 - kBitsPerByte; bits_in_buf_ += kBitsPerByte) {
-      if (next_byte_ >= end) break;
-      buf_ |= static_cast<uint64_t>(*next_byte_++) << bits_in_buf_;
+    // Absorb whole bytes until we have [56, 64) bits (same as LoadLE64), with
+    // a single load from a zero-padded copy of the remaining bytes.
+    size_t num_bytes = (63 - bits_in_buf_) >> 3;
+    const size_t remaining =
+        next_byte_ < end ? static_cast<size_t>(end - next_byte_) : 0;
+    if (num_bytes > remaining) num_bytes = remaining;
+    if (num_bytes != 0) {
+      uint8_t tail[8] = {};
+      memcpy(tail, next_byte_, num_bytes);
+      buf_ |= LoadLE64(tail) << bits_in_buf_;
+      next_byte_ += num_bytes;
+      bits_in_buf_ += num_bytes * kBitsPerByte;
     }
     JXL_DASSERT(bits_in_buf_ < 64);
 
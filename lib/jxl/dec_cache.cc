@@ -29,7 +29,11 @@ Status PassesDecoderState::PreparePipeline(ImageBundle* decoded,
                                            PipelineOptions options) {
   const FrameHeader& frame_header = shared->frame_header;
   size_t num_c = 3 + frame_header.nonserialized_metadata->m.num_extra_channels;
-  if (options.render_noise && (frame_header.flags & FrameHeader::kNoise) != 0) {
+  // Noise with zero strength has no effect, so skip generating it.
+  render_noise = options.render_noise &&
+                 (frame_header.flags & FrameHeader::kNoise) != 0 &&
+                 shared->image_features.noise_params.HasAny();
+  if (render_noise) {
     num_c += 3;
   }
 
@@ -111,8 +115,7 @@ Status PassesDecoderState::PreparePipeline(ImageBundle* decoded,
           CeilLog2Nonzero(frame_header.upsampling)));
     }
   }
-  if (options.render_noise && (frame_header.flags & FrameHeader::kNoise) != 0) {
-    builder.AddStage(GetConvolveNoiseStage(num_c - 3));
+  if (render_noise) {
     builder.AddStage(GetAddNoiseStage(shared->image_features.noise_params,
                                       shared->cmap, num_c - 3));
   }
@@ -196,17 +199,24 @@ Status PassesDecoderState::PreparePipeline(ImageBundle* decoded,
     }
 
     auto tone_mapping_stage = GetToneMappingStage(output_encoding_info);
-    if (tone_mapping_stage) {
-      if (!linear) {
-        auto to_linear_stage = GetToLinearStage(output_encoding_info);
-        if (!to_linear_stage) {
+    if (tone_mapping_stage && !linear) {
+      auto to_linear_stage = GetToLinearStage(output_encoding_info);
+      if (to_linear_stage) {
+        builder.AddStage(std::move(to_linear_stage));
+        linear = true;
+      } else {
+        // Gamut mapping on its own is best-effort, tone mapping is not.
+        OutputEncodingInfo tone_mapping_only = output_encoding_info;
+        tone_mapping_only.gamut_mapping = false;
+        if (GetToneMappingStage(tone_mapping_only)) {
           return JXL_FAILURE(
               "attempting to perform tone mapping on colorspace not "
               "convertible to linear");
         }
-        builder.AddStage(std::move(to_linear_stage));
-        linear = true;
+        tone_mapping_stage = nullptr;
       }
+    }
+    if (tone_mapping_stage) {
       builder.AddStage(std::move(tone_mapping_stage));
     }
 
@@ -14,6 +14,8 @@
 
 #include "lib/jxl/ac_strategy.h"
 #include "lib/jxl/base/common.h"  // kMaxNumPasses
+#include "lib/jxl/base/data_parallel.h"
+#include "lib/jxl/base/status.h"
 #include "lib/jxl/coeff_order.h"
 #include "lib/jxl/convolve.h"
 #include "lib/jxl/dec_group_border.h"
@@ -99,6 +101,9 @@ struct PassesDecoderState {
   // Whether to use int16 float-XYB-to-uint8-srgb conversion.
   bool fast_xyb_srgb8_conversion;
 
+  // Whether to use the approximate fixed-point IDCT in DecodeGroupImpl.
+  bool fast_idct = false;
+
   // If true, the RGBA output will be unpremultiplied before writing to the
   // output.
   bool unpremul_alpha;
@@ -111,6 +116,10 @@ struct PassesDecoderState {
   size_t visible_frame_index = 0;
   size_t nonvisible_frame_index = 0;
 
+  // Whether the render pipeline has the random noise input channels, set by
+  // PreparePipeline. False if the noise of the frame has zero strength.
+  bool render_noise = false;
+
   // Keep track of the transform types used.
   std::atomic<uint32_t> used_acs{0};
 
@@ -187,7 +196,10 @@ struct PassesDecoderState {
 // Temp images required for decoding a single group. Reduces memory allocations
 // for large images because we only initialize min(#threads, #groups) instances.
 struct GroupDecCache {
-  void InitOnce(size_t num_passes, size_t used_acs) {
+  // If `pool` is given, the block buffers are taken from the scratch of
+  // `thread` in it, so they survive across frames of the same decoder.
+  Status InitOnce(size_t num_passes, size_t used_acs,
+                  ThreadPool* pool = nullptr, size_t thread = 0) {
     for (size_t i = 0; i < num_passes; i++) {
       if (num_nzeroes[i].xsize() == 0) {
         // Allocate enough for a whole group - partial groups on the
@@ -207,6 +219,21 @@ struct GroupDecCache {
       max_block_area = std::max(area, max_block_area);
     }
 
+    if (pool != nullptr) {
+      // We need 3x float blocks for dequantized coefficients and 4x for
+      // scratch space for transforms, and 3x int32 or int16 blocks for
+      // quantized coefficients.
+      dec_group_block = pool->Scratch<float>(thread, 0, max_block_area * 7);
+      dec_group_qblock = pool->Scratch<int32_t>(thread, 1, max_block_area * 3);
+      dec_group_qblock16 =
+          pool->Scratch<int16_t>(thread, 2, max_block_area * 3);
+      if (!dec_group_block || !dec_group_qblock || !dec_group_qblock16) {
+        return JXL_FAILURE("Failed to allocate group scratch");
+      }
+      scratch_space = dec_group_block + max_block_area * 3;
+      return true;
+    }
+
     if (max_block_area > max_block_area_) {
       max_block_area_ = max_block_area;
       // We need 3x float blocks for dequantized coefficients and 1x for scratch
@@ -221,6 +248,10 @@ struct GroupDecCache {
     scratch_space = dec_group_block + max_block_area_ * 3;
     dec_group_qblock = int32_memory_.get();
     dec_group_qblock16 = int16_memory_.get();
+    if (!dec_group_block || !dec_group_qblock || !dec_group_qblock16) {
+      return JXL_FAILURE("Failed to allocate group scratch");
+    }
+    return true;
   }
 
   void InitDCBufferOnce() {
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <atomic>
 #include <hwy/aligned_allocator.h>
+#include <limits>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -73,6 +74,12 @@ Status DecodeGlobalDCInfo(BitReader* reader, bool is_jpeg,
   state->shared_storage.ac_strategy.FillInvalid();
   return true;
 }
+
+uint64_t SaturatedAdd(uint64_t a, uint64_t b) {
+  return a > std::numeric_limits<uint64_t>::max() - b
+             ? std::numeric_limits<uint64_t>::max()
+             : a + b;
+}
 }  // namespace
 
 Status DecodeFrame(PassesDecoderState* dec_state, ThreadPool* JXL_RESTRICT pool,
@@ -283,14 +290,36 @@ Status FrameDecoder::ProcessDCGlobal(BitReader* br) {
     JXL_RETURN_IF_ERROR(
         jxl::DecodeGlobalDCInfo(br, decoded_->IsJPEG(), dec_state_, pool_));
   }
+  // Everything that determines the cost of the frame is known at this point,
+  // so reject too expensive frames before decoding any pixels, and before
+  // creating the segments of the splines.
+  const uint64_t other_work = ComputeEstimatedWork();
+  uint64_t spline_work = 0;
   // Splines' draw cache uses the color correlation map.
-  if (shared.frame_header.flags & FrameHeader::kSplines) {
+  const bool has_splines = shared.frame_header.flags & FrameHeader::kSplines;
+  if (has_splines) {
+    JXL_RETURN_IF_ERROR(shared.image_features.splines.EstimateWork(
+        frame_dim_.xsize_upsampled, frame_dim_.ysize_upsampled,
+        dec_state_->shared->cmap, &spline_work));
+  }
+  estimated_work_ = SaturatedAdd(other_work, spline_work);
+  if (estimated_work_ > work_budget_) {
+    return JXL_STATUS(StatusCode::kWorkBudgetExceeded,
+                      "Frame needs %" PRIu64 " operations, budget %" PRIu64,
+                      estimated_work_, work_budget_);
+  }
+  if (has_splines) {
+    // The estimate of the splines is not a bound, so the actual work is
+    // counted while drawing.
     JXL_RETURN_IF_ERROR(shared.image_features.splines.InitializeDrawCache(
         frame_dim_.xsize_upsampled, frame_dim_.ysize_upsampled,
-        dec_state_->shared->cmap));
+        dec_state_->shared->cmap, work_budget_ - other_work));
+    estimated_work_ = std::max(
+        estimated_work_,
+        SaturatedAdd(other_work, shared.image_features.splines.DrawWork()));
   }
   Status dec_status = modular_frame_decoder_.DecodeGlobalInfo(
-      br, frame_header_, /*allow_truncated_group=*/false);
+      br, frame_header_, /*allow_truncated_group=*/false, pool_);
   if (dec_status.IsFatalError()) return dec_status;
   if (dec_status) {
     decoded_dc_global_ = true;
@@ -298,6 +327,33 @@ Status FrameDecoder::ProcessDCGlobal(BitReader* br) {
   return dec_status;
 }
 
+uint64_t FrameDecoder::ComputeEstimatedWork() const {
+  const PassesSharedState& shared = dec_state_->shared_storage;
+  const LoopFilter& lf = frame_header_.loop_filter;
+  // Per-sample costs are coarse approximations of the number of arithmetic
+  // operations of each step; only the order of magnitude matters. Accumulate
+  // in double, since the dimensions can be large.
+  double pixels = static_cast<double>(frame_dim_.xsize_padded) *
+                  frame_dim_.ysize_padded;
+  double upsampled_pixels = static_cast<double>(frame_dim_.xsize_upsampled) *
+                            frame_dim_.ysize_upsampled;
+  double work =
+      pixels * 3 * (frame_header_.encoding == FrameEncoding::kVarDCT ? 64 : 32);
+  work += upsampled_pixels * 32 *
+          frame_header_.nonserialized_metadata->m.num_extra_channels;
+  if (lf.gab) work += pixels * 3 * 9;
+  work += pixels * 3 * 40 * lf.epf_iters;
+  if (frame_header_.upsampling != 1) work += upsampled_pixels * 3 * 25;
+  if (frame_header_.flags & FrameHeader::kNoise) {
+    work += upsampled_pixels * 3 * 32;
+  }
+  work += shared.image_features.patches.EstimatedWork();
+  if (work >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  return static_cast<uint64_t>(work);
+}
+
 Status FrameDecoder::ProcessDCGroup(size_t dc_group_id, BitReader* br) {
   const size_t gx = dc_group_id % frame_dim_.xsize_dc_groups;
   const size_t gy = dc_group_id / frame_dim_.xsize_dc_groups;
@@ -389,16 +445,19 @@ Status FrameDecoder::ProcessACGlobal(BitReader* br) {
     // TODO(veluca): figure out the exact limit - 16 should still work with
     // 16-bit buffers, but we are excluding it for safety.
     bool use_16_bit = max_num_bits_ac < 16 && !decoded_->IsJPEG();
+    // With more than one pass, the coefficients of each group are kept
+    // between passes. They are allocated when the group is first decoded and
+    // freed after its last pass (see ProcessACGroup), so that memory usage
+    // follows the number of groups with pending passes.
     bool store = frame_header_.passes.num_passes > 1;
     size_t xs = store ? kGroupDim * kGroupDim : 0;
     size_t ys = store ? frame_dim_.num_groups : 0;
-    if (use_16_bit) {
-      dec_state_->coefficients = make_unique<ACImageT<int16_t>>(xs, ys);
+    if (!store) {
+      dec_state_->coefficients = make_unique<ACImageT<int32_t>>(0, 0);
+    } else if (use_16_bit) {
+      dec_state_->coefficients = make_unique<LazyACImageT<int16_t>>(xs, ys);
     } else {
-      dec_state_->coefficients = make_unique<ACImageT<int32_t>>(xs, ys);
-    }
-    if (store) {
-      dec_state_->coefficients->ZeroFill();
+      dec_state_->coefficients = make_unique<LazyACImageT<int32_t>>(xs, ys);
     }
   }
 
@@ -447,7 +506,8 @@ Status FrameDecoder::ProcessACGlobal(BitReader* br) {
 Status FrameDecoder::ProcessACGroup(size_t ac_group_id,
                                     BitReader* JXL_RESTRICT* br,
                                     size_t num_passes, size_t thread,
-                                    bool force_draw, bool dc_only) {
+                                    bool force_draw, bool dc_only,
+                                    ThreadPool* pool) {
   size_t group_dim = frame_dim_.group_dim;
   const size_t gx = ac_group_id % frame_dim_.xsize_groups;
   const size_t gy = ac_group_id / frame_dim_.xsize_groups;
@@ -465,8 +525,8 @@ Status FrameDecoder::ProcessACGroup(size_t ac_group_id,
   bool should_run_pipeline = true;
 
   if (frame_header_.encoding == FrameEncoding::kVarDCT) {
-    group_dec_caches_[thread].InitOnce(frame_header_.passes.num_passes,
-                                       dec_state_->used_acs);
+    JXL_RETURN_IF_ERROR(group_dec_caches_[thread].InitOnce(
+        frame_header_.passes.num_passes, dec_state_->used_acs, pool_, thread));
     JXL_RETURN_IF_ERROR(DecodeGroup(br, num_passes, ac_group_id, dec_state_,
                                     &group_dec_caches_[thread], thread,
                                     render_pipeline_input, decoded_,
@@ -489,7 +549,7 @@ Status FrameDecoder::ProcessACGroup(size_t ac_group_id,
           mrect, br[i - pass0], minShift, maxShift,
           ModularStreamId::ModularAC(ac_group_id, i),
           /*zerofill=*/false, dec_state_, &render_pipeline_input,
-          /*allow_truncated=*/false, &modular_pass_ready));
+          /*allow_truncated=*/false, &modular_pass_ready, pool));
     } else {
       JXL_RETURN_IF_ERROR(modular_frame_decoder_.DecodeGroup(
           mrect, nullptr, minShift, maxShift,
@@ -501,7 +561,17 @@ Status FrameDecoder::ProcessACGroup(size_t ac_group_id,
   }
   decoded_passes_per_ac_group_[ac_group_id] += num_passes;
 
-  if ((frame_header_.flags & FrameHeader::kNoise) != 0) {
+  if (frame_header_.encoding == FrameEncoding::kVarDCT &&
+      !dec_state_->coefficients->IsEmpty()) {
+    if (decoded_passes_per_ac_group_[ac_group_id] ==
+        frame_header_.passes.num_passes) {
+      dec_state_->coefficients->ReleaseRow(ac_group_id);
+    } else {
+      dec_state_->coefficients->CompactRow(ac_group_id);
+    }
+  }
+
+  if (dec_state_->render_noise) {
     size_t noise_c_start =
         3 + frame_header_.nonserialized_metadata->m.num_extra_channels;
     // When the color channels are downsampled, we need to generate more noise
@@ -628,6 +698,7 @@ Status FrameDecoder::ProcessSections(const SectionInfo* sections, size_t num,
         pool_, 0, dc_group_sec.size(), ThreadPool::NoInit,
         [this, &dc_group_sec, &num, &sections, &section_status, &has_error](
             size_t i, size_t thread) {
+          if (!CheckCancelled(pool_)) return;
           if (dc_group_sec[i] != num) {
             if (!ProcessDCGroup(i, sections[dc_group_sec[i]].br)) {
               has_error = true;
@@ -638,6 +709,7 @@ Status FrameDecoder::ProcessSections(const SectionInfo* sections, size_t num,
         },
         "DecodeDCGroup"));
   }
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool_));
   if (has_error) return JXL_FAILURE("Error in DC group");
 
   if (*std::min_element(decoded_dc_groups_.begin(), decoded_dc_groups_.end()) &&
@@ -649,6 +721,7 @@ Status FrameDecoder::ProcessSections(const SectionInfo* sections, size_t num,
     pipeline_options.render_noise = true;
     JXL_RETURN_IF_ERROR(
         dec_state_->PreparePipeline(decoded_, pipeline_options));
+    dec_state_->fast_idct = fast_idct_;
     FinalizeDC();
     JXL_RETURN_IF_ERROR(AllocateOutput());
     if (progressive_detail_ >= JxlProgressiveDetail::kDC) {
@@ -680,38 +753,61 @@ Status FrameDecoder::ProcessSections(const SectionInfo* sections, size_t num,
       }
     }
 
-    JXL_RETURN_IF_ERROR(RunOnPool(
-        pool_, 0, ac_group_sec.size(),
-        [this](size_t num_threads) {
-          return PrepareStorage(num_threads,
-                                decoded_passes_per_ac_group_.size());
-        },
-        [this, &ac_group_sec, &desired_num_ac_passes, &num, &sections,
-         &section_status, &has_error](size_t g, size_t thread) {
-          if (desired_num_ac_passes[g] == 0) {
-            // no new AC pass, nothing to do
-            return;
-          }
-          (void)num;
-          size_t first_pass = decoded_passes_per_ac_group_[g];
-          BitReader* JXL_RESTRICT readers[kMaxNumPasses];
-          for (size_t i = 0; i < desired_num_ac_passes[g]; i++) {
-            JXL_ASSERT(ac_group_sec[g][first_pass + i] != num);
-            readers[i] = sections[ac_group_sec[g][first_pass + i]].br;
-          }
-          if (!ProcessACGroup(g, readers, desired_num_ac_passes[g],
-                              GetStorageLocation(thread, g),
-                              /*force_draw=*/false, /*dc_only=*/false)) {
-            has_error = true;
-          } else {
-            for (size_t i = 0; i < desired_num_ac_passes[g]; i++) {
-              section_status[ac_group_sec[g][first_pass + i]] =
-                  SectionStatus::kDone;
-            }
-          }
-        },
-        "DecodeGroup"));
+    const auto process_group = [this, &ac_group_sec, &desired_num_ac_passes,
+                                &num, &sections, &section_status, &has_error](
+                                   size_t g, size_t thread, ThreadPool* pool) {
+      if (desired_num_ac_passes[g] == 0) {
+        // no new AC pass, nothing to do
+        return;
+      }
+      if (!CheckCancelled(pool_)) return;
+      (void)num;
+      size_t first_pass = decoded_passes_per_ac_group_[g];
+      BitReader* JXL_RESTRICT readers[kMaxNumPasses];
+      for (size_t i = 0; i < desired_num_ac_passes[g]; i++) {
+        JXL_ASSERT(ac_group_sec[g][first_pass + i] != num);
+        readers[i] = sections[ac_group_sec[g][first_pass + i]].br;
+      }
+      if (!ProcessACGroup(g, readers, desired_num_ac_passes[g], thread,
+                          /*force_draw=*/false, /*dc_only=*/false, pool)) {
+        has_error = true;
+      } else {
+        for (size_t i = 0; i < desired_num_ac_passes[g]; i++) {
+          section_status[ac_group_sec[g][first_pass + i]] =
+              SectionStatus::kDone;
+        }
+      }
+    };
+
+    size_t num_groups_to_decode = 0;
+    size_t last_group = 0;
+    for (size_t g = 0; g < ac_group_sec.size(); g++) {
+      if (desired_num_ac_passes[g] != 0) {
+        num_groups_to_decode++;
+        last_group = g;
+      }
+    }
+    if (num_groups_to_decode == 1 && pool_ != nullptr) {
+      // A single group (e.g. a large modular group, or the only group of the
+      // frame) would keep just one worker busy; decode it on this thread
+      // instead, so that the pool is free to parallelize within the group.
+      JXL_RETURN_IF_ERROR(PrepareStorage(/*num_threads=*/1,
+                                         decoded_passes_per_ac_group_.size()));
+      process_group(last_group, GetStorageLocation(0, last_group), pool_);
+    } else {
+      JXL_RETURN_IF_ERROR(RunOnPool(
+          pool_, 0, ac_group_sec.size(),
+          [this](size_t num_threads) {
+            return PrepareStorage(num_threads,
+                                  decoded_passes_per_ac_group_.size());
+          },
+          [this, &process_group](size_t g, size_t thread) {
+            process_group(g, GetStorageLocation(thread, g), /*pool=*/nullptr);
+          },
+          "DecodeGroup"));
+    }
   }
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool_));
   if (has_error) return JXL_FAILURE("Error in AC group");
 
   MarkSections(sections, num, section_status);
@@ -10,6 +10,8 @@
 #include <jxl/types.h>
 #include <stdint.h>
 
+#include <limits>
+
 #include "lib/jxl/base/compiler_specific.h"
 #include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/span.h"
@@ -47,6 +49,11 @@ class FrameDecoder {
 
   void SetRenderSpotcolors(bool rsc) { render_spotcolors_ = rsc; }
   void SetCoalescing(bool c) { coalescing_ = c; }
+  // Uses the fixed-point IDCT for VarDCT groups, see JxlDecoderSetFastIDCT.
+  void SetFastIDCT(bool fast_idct) { fast_idct_ = fast_idct; }
+  // ProcessSections fails with StatusCode::kWorkBudgetExceeded, before
+  // decoding any pixels, if the estimated work of the frame is larger.
+  void SetWorkBudget(uint64_t budget) { work_budget_ = budget; }
 
   // Read FrameHeader and table of contents from the given BitReader.
   Status InitFrame(BitReader* JXL_RESTRICT br, ImageBundle* decoded,
@@ -120,6 +127,10 @@ class FrameDecoder {
   bool HasDecodedDC() const { return finalized_dc_; }
   bool HasDecodedAll() const { return toc_.size() == num_sections_done_; }
 
+  // Rough number of operations needed to decode and render the frame, or 0
+  // until the DC global section has been decoded.
+  uint64_t EstimatedWork() const { return estimated_work_; }
+
   size_t NumCompletePasses() const {
     return *std::min_element(decoded_passes_per_ac_group_.begin(),
                              decoded_passes_per_ac_group_.end());
@@ -216,6 +227,7 @@ class FrameDecoder {
         dec_state_->output_encoding_info.all_default_opsin &&
         (dec_state_->output_encoding_info.desired_intensity_target ==
          dec_state_->output_encoding_info.orig_intensity_target) &&
+        !dec_state_->output_encoding_info.gamut_mapping &&
         HasFastXYBTosRGB8() && frame_header_.needs_color_transform()) {
       dec_state_->fast_xyb_srgb8_conversion = true;
     }
@@ -235,13 +247,19 @@ class FrameDecoder {
 
  private:
   Status ProcessDCGlobal(BitReader* br);
+  // Returns a rough operation count for decoding and rendering the frame,
+  // based on its header and the already decoded patches; splines are
+  // estimated separately.
+  uint64_t ComputeEstimatedWork() const;
   Status ProcessDCGroup(size_t dc_group_id, BitReader* br);
   void FinalizeDC();
   Status AllocateOutput();
   Status ProcessACGlobal(BitReader* br);
+  // If `pool` is not null, it is used for intra-group parallelism; this
+  // requires that the group is not itself being processed on `pool`.
   Status ProcessACGroup(size_t ac_group_id, BitReader* JXL_RESTRICT* br,
                         size_t num_passes, size_t thread, bool force_draw,
-                        bool dc_only);
+                        bool dc_only, ThreadPool* pool = nullptr);
   void MarkSections(const SectionInfo* sections, size_t num,
                     SectionStatus* section_status);
 
@@ -297,6 +315,9 @@ class FrameDecoder {
   ModularFrameDecoder modular_frame_decoder_;
   bool render_spotcolors_ = true;
   bool coalescing_ = true;
+  bool fast_idct_ = false;
+  uint64_t work_budget_ = std::numeric_limits<uint64_t>::max();
+  uint64_t estimated_work_ = 0;
 
   std::vector<uint8_t> processed_section_;
   std::vector<uint8_t> decoded_passes_per_ac_group_;
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <utility>
 
@@ -34,6 +35,7 @@
 #include "lib/jxl/dec_xyb.h"
 #include "lib/jxl/entropy_coder.h"
 #include "lib/jxl/epf.h"
+#include "lib/jxl/fast_dct-inl.h"
 #include "lib/jxl/quant_weights.h"
 #include "lib/jxl/quantizer-inl.h"
 #include "lib/jxl/quantizer.h"
@@ -90,13 +92,15 @@ void Transpose8x8InPlace(int32_t* JXL_RESTRICT block) {
   }
 }
 
+// Dequantizes the coefficients [k, k + Lanes(d)) of the three channels.
 template <ACType ac_type>
 void DequantLane(Vec<D> scaled_dequant_x, Vec<D> scaled_dequant_y,
                  Vec<D> scaled_dequant_b,
                  const float* JXL_RESTRICT dequant_matrices, size_t size,
                  size_t k, Vec<D> x_cc_mul, Vec<D> b_cc_mul,
                  const float* JXL_RESTRICT biases, ACPtr qblock[3],
-                 float* JXL_RESTRICT block) {
+                 Vec<D>* JXL_RESTRICT dequant_x, Vec<D>* JXL_RESTRICT dequant_y,
+                 Vec<D>* JXL_RESTRICT dequant_b) {
   const auto x_mul = Mul(Load(d, dequant_matrices + k), scaled_dequant_x);
   const auto y_mul =
       Mul(Load(d, dequant_matrices + size + k), scaled_dequant_y);
@@ -119,16 +123,12 @@ void DequantLane(Vec<D> scaled_dequant_x, Vec<D> scaled_dequant_y,
 
   const auto dequant_x_cc =
       Mul(AdjustQuantBias(di, 0, quantized_x_int, biases), x_mul);
-  const auto dequant_y =
-      Mul(AdjustQuantBias(di, 1, quantized_y_int, biases), y_mul);
+  *dequant_y = Mul(AdjustQuantBias(di, 1, quantized_y_int, biases), y_mul);
   const auto dequant_b_cc =
       Mul(AdjustQuantBias(di, 2, quantized_b_int, biases), b_mul);
 
-  const auto dequant_x = MulAdd(x_cc_mul, dequant_y, dequant_x_cc);
-  const auto dequant_b = MulAdd(b_cc_mul, dequant_y, dequant_b_cc);
-  Store(dequant_x, d, block + k);
-  Store(dequant_y, d, block + size + k);
-  Store(dequant_b, d, block + 2 * size + k);
+  *dequant_x = MulAdd(x_cc_mul, *dequant_y, dequant_x_cc);
+  *dequant_b = MulAdd(b_cc_mul, *dequant_y, dequant_b_cc);
 }
 
 template <ACType ac_type>
@@ -150,9 +150,15 @@ void DequantBlock(const AcStrategy& acs, float inv_global_scale, int quant,
   const float* dequant_matrices = quantizer.DequantMatrix(kind, 0);
 
   for (size_t k = 0; k < covered_blocks * kDCTBlockSize; k += Lanes(d)) {
+    Vec<D> dequant_x;
+    Vec<D> dequant_y;
+    Vec<D> dequant_b;
     DequantLane<ac_type>(scaled_dequant_x, scaled_dequant_y, scaled_dequant_b,
                          dequant_matrices, size, k, x_cc_mul, b_cc_mul, biases,
-                         qblock, block);
+                         qblock, &dequant_x, &dequant_y, &dequant_b);
+    Store(dequant_x, d, block + k);
+    Store(dequant_y, d, block + size + k);
+    Store(dequant_b, d, block + 2 * size + k);
   }
   for (size_t c = 0; c < 3; c++) {
     LowestFrequenciesFromDC(acs.Strategy(), dc_row[c] + sbx[c], dc_stride,
@@ -160,6 +166,186 @@ void DequantBlock(const AcStrategy& acs, float inv_global_scale, int quant,
   }
 }
 
+// Whether FastTransformToPixels supports the transform. The rounding error
+// of the fixed-point IDCT grows with the transform size, so only DCTs up to
+// 16x16 are supported; their maximum error is 2^-6 for pixels in [-1, 1],
+// which 8x32 already exceeds.
+bool FastIDCTSupported(const AcStrategy::Type strategy) {
+  using Type = AcStrategy::Type;
+  return strategy == Type::DCT || strategy == Type::DCT16X8 ||
+         strategy == Type::DCT8X16 || strategy == Type::DCT16X16;
+}
+
+// Returns the fixed-point scale of the coefficients of a block whose sum of
+// absolute values is `abs_sum`, for the transforms that FastIDCTSupported
+// accepts: 14 - FastIDCTIntegerBits fractional bits, and more for small sums.
+//
+// Each unit coefficient produces pixels in [-2, 2], which is the range the
+// fixed-point kernels are designed for; the intermediate values of a block
+// whose coefficients have a sum of absolute values of at most 1 are bounded by
+// those of a single unit coefficient. Such blocks (and in particular most
+// blocks of the X channel, whose range is only about +-0.03) are scaled up by
+// a further power of two, which keeps their relative precision.
+float FastIDCTScale(float abs_sum) {
+  constexpr size_t kBits8 = FastIDCTIntegerBits(FastDCTTag<8>());
+  constexpr size_t kBits16 = FastIDCTIntegerBits(FastDCTTag<16>());
+  constexpr size_t kIntegerBits = kBits8 > kBits16 ? kBits8 : kBits16;
+  // Only (almost) all-zero blocks would use more.
+  constexpr size_t kMaxExtraBits = 8;
+  size_t extra_bits = 0;
+  while (extra_bits < kMaxExtraBits && abs_sum * 2 <= 1.0f) {
+    abs_sum *= 2;
+    extra_bits++;
+  }
+  return 1 << (14 - kIntegerBits + extra_bits);
+}
+
+// Fixed-point version of DequantBlock for the transforms that
+// FastIDCTSupported accepts: channel c of `block` receives the dequantized
+// coefficients rounded to int16 with the scale block_scale[c], without going
+// through floats in memory. The first pass over the quantized coefficients
+// only sums up their absolute values to choose the scales; the second one
+// dequantizes them again and stores them.
+template <ACType ac_type>
+void FastDequantBlock(const AcStrategy& acs, float inv_global_scale,
+                      int quant, float x_dm_multiplier, float b_dm_multiplier,
+                      Vec<D> x_cc_mul, Vec<D> b_cc_mul, size_t kind,
+                      size_t size, const Quantizer& quantizer,
+                      const size_t* sbx,
+                      const float* JXL_RESTRICT* JXL_RESTRICT dc_row,
+                      size_t dc_stride, const float* JXL_RESTRICT biases,
+                      ACPtr qblock[3], int16_t* JXL_RESTRICT block,
+                      float* JXL_RESTRICT block_scale,
+                      float* JXL_RESTRICT scratch) {
+  const auto scaled_dequant_s = inv_global_scale / quant;
+
+  const auto scaled_dequant_x = Set(d, scaled_dequant_s * x_dm_multiplier);
+  const auto scaled_dequant_y = Set(d, scaled_dequant_s);
+  const auto scaled_dequant_b = Set(d, scaled_dequant_s * b_dm_multiplier);
+
+  const float* dequant_matrices = quantizer.DequantMatrix(kind, 0);
+
+  // The lowest frequencies go to the top-left corner of the block, where the
+  // dequantized coefficients are zero. They are computed at the same
+  // positions of `llf` as DequantBlock writes them to.
+  const size_t llf_ysize =
+      std::min(acs.covered_blocks_x(), acs.covered_blocks_y());
+  const size_t llf_xsize =
+      std::max(acs.covered_blocks_x(), acs.covered_blocks_y());
+  const size_t llf_stride = llf_xsize * kBlockDim;
+  float* JXL_RESTRICT llf = scratch;
+  for (size_t c = 0; c < 3; c++) {
+    LowestFrequenciesFromDC(acs.Strategy(), dc_row[c] + sbx[c], dc_stride,
+                            llf + c * size, scratch + 3 * size);
+  }
+
+  auto abs_sum_x = Zero(d);
+  auto abs_sum_y = Zero(d);
+  auto abs_sum_b = Zero(d);
+  for (size_t k = 0; k < size; k += Lanes(d)) {
+    Vec<D> dequant_x;
+    Vec<D> dequant_y;
+    Vec<D> dequant_b;
+    DequantLane<ac_type>(scaled_dequant_x, scaled_dequant_y, scaled_dequant_b,
+                         dequant_matrices, size, k, x_cc_mul, b_cc_mul, biases,
+                         qblock, &dequant_x, &dequant_y, &dequant_b);
+    abs_sum_x = Add(abs_sum_x, Abs(dequant_x));
+    abs_sum_y = Add(abs_sum_y, Abs(dequant_y));
+    abs_sum_b = Add(abs_sum_b, Abs(dequant_b));
+  }
+  float abs_sum[3] = {GetLane(SumOfLanes(d, abs_sum_x)),
+                      GetLane(SumOfLanes(d, abs_sum_y)),
+                      GetLane(SumOfLanes(d, abs_sum_b))};
+  for (size_t c = 0; c < 3; c++) {
+    for (size_t y = 0; y < llf_ysize; y++) {
+      for (size_t x = 0; x < llf_xsize; x++) {
+        abs_sum[c] += std::abs(llf[c * size + y * llf_stride + x]);
+      }
+    }
+    block_scale[c] = FastIDCTScale(abs_sum[c]);
+  }
+
+  const auto scale_x = Set(d, block_scale[0]);
+  const auto scale_y = Set(d, block_scale[1]);
+  const auto scale_b = Set(d, block_scale[2]);
+  for (size_t k = 0; k < size; k += Lanes(d)) {
+    Vec<D> dequant_x;
+    Vec<D> dequant_y;
+    Vec<D> dequant_b;
+    DequantLane<ac_type>(scaled_dequant_x, scaled_dequant_y, scaled_dequant_b,
+                         dequant_matrices, size, k, x_cc_mul, b_cc_mul, biases,
+                         qblock, &dequant_x, &dequant_y, &dequant_b);
+    Store(DemoteTo(di16, NearestInt(Mul(dequant_x, scale_x))), di16,
+          block + k);
+    Store(DemoteTo(di16, NearestInt(Mul(dequant_y, scale_y))), di16,
+          block + size + k);
+    Store(DemoteTo(di16, NearestInt(Mul(dequant_b, scale_b))), di16,
+          block + 2 * size + k);
+  }
+  for (size_t c = 0; c < 3; c++) {
+    for (size_t y = 0; y < llf_ysize; y++) {
+      for (size_t x = 0; x < llf_xsize; x++) {
+        const size_t i = c * size + y * llf_stride + x;
+        block[i] = static_cast<int16_t>(std::lrint(
+            Clamp1(llf[i] * block_scale[c], -32768.0f, 32767.0f)));
+      }
+    }
+  }
+}
+
+// Fixed-point version of ComputeScaledIDCT<ROWS, COLS>, for coefficients
+// rounded to int16 with the scale `block_scale` by FastDequantBlock. The
+// coefficients are overwritten.
+template <size_t ROWS, size_t COLS>
+void FastScaledIDCT(int16_t* JXL_RESTRICT coefficients, float block_scale,
+                    float* JXL_RESTRICT pixels, size_t pixels_stride,
+                    int16_t* JXL_RESTRICT scratch_space) {
+  const HWY_CAPPED(float, 8) df;
+  const Rebind<int32_t, decltype(df)> di32;
+  const Rebind<int16_t, decltype(df)> di16;
+  int16_t* JXL_RESTRICT to = scratch_space;
+  int16_t* JXL_RESTRICT tmp = scratch_space + ROWS * COLS;
+  ComputeFastScaledIDCT<ROWS, COLS>()(coefficients, to, COLS, tmp);
+  const auto inv_scale = Set(df, 1.0f / block_scale);
+  for (size_t y = 0; y < ROWS; y++) {
+    for (size_t x = 0; x < COLS; x += Lanes(df)) {
+      const auto p = PromoteTo(di32, Load(di16, to + y * COLS + x));
+      StoreU(Mul(ConvertTo(df, p), inv_scale), df,
+             pixels + y * pixels_stride + x);
+    }
+  }
+}
+
+// Same as TransformToPixels, but with the fixed-point IDCT, for the transforms
+// that FastIDCTSupported accepts.
+void FastTransformToPixels(const AcStrategy::Type strategy,
+                           int16_t* JXL_RESTRICT coefficients,
+                           float block_scale, float* JXL_RESTRICT pixels,
+                           size_t pixels_stride,
+                           int16_t* JXL_RESTRICT scratch_space) {
+  using Type = AcStrategy::Type;
+  switch (strategy) {
+    case Type::DCT:
+      FastScaledIDCT<8, 8>(coefficients, block_scale, pixels, pixels_stride,
+                           scratch_space);
+      return;
+    case Type::DCT16X8:
+      FastScaledIDCT<16, 8>(coefficients, block_scale, pixels, pixels_stride,
+                            scratch_space);
+      return;
+    case Type::DCT8X16:
+      FastScaledIDCT<8, 16>(coefficients, block_scale, pixels, pixels_stride,
+                            scratch_space);
+      return;
+    case Type::DCT16X16:
+      FastScaledIDCT<16, 16>(coefficients, block_scale, pixels, pixels_stride,
+                             scratch_space);
+      return;
+    default:
+      JXL_UNREACHABLE("Unsupported strategy for the fixed-point IDCT");
+  }
+}
+
 Status DecodeGroupImpl(GetBlock* JXL_RESTRICT get_block,
                        GroupDecCache* JXL_RESTRICT group_dec_cache,
                        PassesDecoderState* JXL_RESTRICT dec_state,
@@ -190,6 +376,9 @@ Status DecodeGroupImpl(GetBlock* JXL_RESTRICT get_block,
   ACType ac_type = dec_state->coefficients->Type();
   auto dequant_block = ac_type == ACType::k16 ? DequantBlock<ACType::k16>
                                               : DequantBlock<ACType::k32>;
+  auto fast_dequant_block = ac_type == ACType::k16
+                                ? FastDequantBlock<ACType::k16>
+                                : FastDequantBlock<ACType::k32>;
   // Whether or not coefficients should be stored for future usage, and/or read
   // from past usage.
   bool accumulate = !dec_state->coefficients->IsEmpty();
@@ -312,6 +501,9 @@ Status DecodeGroupImpl(GetBlock* JXL_RESTRICT get_block,
           for (size_t c = 0; c < 3; c++) {
             qblock[c] = dec_state->coefficients->PlaneRow(c, group_idx, offset);
           }
+          if (JXL_UNLIKELY(qblock[0].ptr32 == nullptr)) {
+            return JXL_FAILURE("Failed to allocate AC coefficients");
+          }
         } else {
           // No point in reading from bitstream without accumulating and not
           // drawing.
@@ -393,6 +585,30 @@ Status DecodeGroupImpl(GetBlock* JXL_RESTRICT get_block,
             jpeg_pos[0] =
                 Clamp1<float>(dc_rows[c][sbx[c]] - dcoff[c], -2047, 2047);
           }
+        } else if (dec_state->fast_idct &&
+                   FastIDCTSupported(acs.Strategy())) {
+          int16_t* JXL_RESTRICT block =
+              reinterpret_cast<int16_t*>(group_dec_cache->dec_group_block);
+          float block_scale[3];
+          // Dequantize to fixed-point and add predictions.
+          fast_dequant_block(
+              acs, inv_global_scale, row_quant[bx], dec_state->x_dm_multiplier,
+              dec_state->b_dm_multiplier, x_cc_mul, b_cc_mul, acs.RawStrategy(),
+              size, dec_state->shared->quantizer, sbx, dc_rows, dc_stride,
+              dec_state->output_encoding_info.opsin_params.quant_biases, qblock,
+              block, block_scale, group_dec_cache->scratch_space);
+
+          for (size_t c : {1, 0, 2}) {
+            if ((sbx[c] << hshift[c] != bx) || (sby[c] << vshift[c] != by)) {
+              continue;
+            }
+            // IDCT
+            float* JXL_RESTRICT idct_pos = idct_row[c] + sbx[c] * kBlockDim;
+            FastTransformToPixels(
+                acs.Strategy(), block + c * size, block_scale[c], idct_pos,
+                idct_stride[c],
+                reinterpret_cast<int16_t*>(group_dec_cache->scratch_space));
+          }
         } else {
           HWY_ALIGN float* const block = group_dec_cache->dec_group_block;
           // Dequantize and add predictions.
@@ -778,9 +994,9 @@ Status DecodeGroupForRoundtrip(const std::vector<std::unique_ptr<ACImage>>& ac,
                                AuxOut* aux_out) {
   GetBlockFromEncoder get_block(ac, group_idx,
                                 dec_state->shared->frame_header.passes.shift);
-  group_dec_cache->InitOnce(
+  JXL_RETURN_IF_ERROR(group_dec_cache->InitOnce(
       /*num_passes=*/0,
-      /*used_acs=*/(1u << AcStrategy::kNumValidStrategies) - 1);
+      /*used_acs=*/(1u << AcStrategy::kNumValidStrategies) - 1));
 
   return HWY_DYNAMIC_DISPATCH(DecodeGroupImpl)(
       &get_block, group_dec_cache, dec_state, thread, group_idx,
@@ -25,6 +25,7 @@
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/compressed_dc.h"
 #include "lib/jxl/epf.h"
+#include "lib/jxl/image_ops.h"
 #include "lib/jxl/modular/encoding/encoding.h"
 #include "lib/jxl/modular/modular_image.h"
 #include "lib/jxl/modular/transform/transform.h"
@@ -179,7 +180,8 @@ std::string ModularStreamId::DebugString() const {
 
 Status ModularFrameDecoder::DecodeGlobalInfo(BitReader* reader,
                                              const FrameHeader& frame_header,
-                                             bool allow_truncated_group) {
+                                             bool allow_truncated_group,
+                                             ThreadPool* pool) {
   bool decode_color = frame_header.encoding == FrameEncoding::kModular;
   const auto& metadata = frame_header.nonserialized_metadata->m;
   bool is_gray = metadata.color_encoding.IsGray();
@@ -246,6 +248,10 @@ Status ModularFrameDecoder::DecodeGlobalInfo(BitReader* reader,
       all_same_shift = false;
   }
 
+  for (Channel& ch : gi.channel) {
+    JXL_RETURN_IF_ERROR(FirstTouchImage(pool, &ch.plane));
+  }
+
   JXL_DEBUG_V(6, "DecodeGlobalInfo: full_image (w/o transforms) %s",
               gi.DebugString().c_str());
   ModularOptions options;
@@ -298,7 +304,7 @@ Status ModularFrameDecoder::DecodeGroup(
     const Rect& rect, BitReader* reader, int minShift, int maxShift,
     const ModularStreamId& stream, bool zerofill, PassesDecoderState* dec_state,
     RenderPipelineInput* render_pipeline_input, bool allow_truncated,
-    bool* should_run_pipeline) {
+    bool* should_run_pipeline, ThreadPool* pool) {
   JXL_DEBUG_V(6, "Decoding %s with rect %s and shift bracket %d..%d %s",
               stream.DebugString().c_str(), Description(rect).c_str(), minShift,
               maxShift, zerofill ? "using zerofill" : "");
@@ -355,7 +361,8 @@ Status ModularFrameDecoder::DecodeGroup(
   if (!zerofill) {
     auto status = ModularGenericDecompress(
         reader, gi, /*header=*/nullptr, stream.ID(frame_dim), &options,
-        /*undo_transforms=*/true, &tree, &code, &context_map, allow_truncated);
+        /*undo_transforms=*/true, &tree, &code, &context_map, allow_truncated,
+        pool);
     if (!allow_truncated) JXL_RETURN_IF_ERROR(status);
     if (status.IsFatalError()) return status;
   }
@@ -363,7 +370,7 @@ Status ModularFrameDecoder::DecodeGroup(
   if (!use_full_image) {
     JXL_ASSERT(render_pipeline_input);
     for (auto t : global_transform) {
-      JXL_RETURN_IF_ERROR(t.Inverse(gi, global_header.wp_header));
+      JXL_RETURN_IF_ERROR(t.Inverse(gi, global_header.wp_header, pool));
     }
     JXL_RETURN_IF_ERROR(ModularImageToDecodedRect(gi, dec_state, nullptr,
                                                   *render_pipeline_input,
@@ -707,7 +714,7 @@ Status ModularFrameDecoder::FinalizeDecoding(PassesDecoderState* dec_state,
       [&](size_t num_threads) {
         const auto& frame_header = dec_state->shared->frame_header;
         bool use_group_ids = (frame_header.encoding == FrameEncoding::kVarDCT ||
-                              (frame_header.flags & FrameHeader::kNoise));
+                              dec_state->render_noise);
         return dec_state->render_pipeline->PrepareForThreads(num_threads,
                                                              use_group_ids);
       },
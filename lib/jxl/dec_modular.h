@@ -87,13 +87,20 @@ struct ModularStreamId {
 class ModularFrameDecoder {
  public:
   void Init(const FrameDimensions& frame_dim) { this->frame_dim = frame_dim; }
+  // `pool` is used to first-touch large channels of the full image, see
+  // FirstTouchImage.
   Status DecodeGlobalInfo(BitReader* reader, const FrameHeader& frame_header,
-                          bool allow_truncated_group);
+                          bool allow_truncated_group,
+                          ThreadPool* pool = nullptr);
+  // Decodes the modular data of the group covering `rect`. If `pool` is not
+  // null, it is used to undo the group's transforms in parallel; this is only
+  // valid when the caller itself is not running on `pool`.
   Status DecodeGroup(const Rect& rect, BitReader* reader, int minShift,
                      int maxShift, const ModularStreamId& stream, bool zerofill,
                      PassesDecoderState* dec_state,
                      RenderPipelineInput* render_pipeline_input,
-                     bool allow_truncated, bool* should_run_pipeline = nullptr);
+                     bool allow_truncated, bool* should_run_pipeline = nullptr,
+                     ThreadPool* pool = nullptr);
   // Decodes a VarDCT DC group (`group_id`) from the given `reader`.
   Status DecodeVarDCTDC(size_t group_id, BitReader* reader,
                         PassesDecoderState* dec_state);
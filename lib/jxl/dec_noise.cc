@@ -62,16 +62,24 @@ void RandomImage(Xorshift128Plus* rng, const Rect& rect,
   const HWY_FULL(float) df;
   const size_t N = Lanes(df);
 
+  const HWY_FULL(uint32_t) du;
+  // Entire batches only (avoids exceeding the image padding); the last batch of
+  // each row, which may be partial, is handled separately below.
+  const size_t num_full_batches =
+      xsize == 0 ? 0 : (xsize - 1) / kFloatsPerBatch;
+
   for (size_t y = 0; y < ysize; ++y) {
     float* JXL_RESTRICT row = rect.Row(noise, y);
 
-    size_t x = 0;
-    // Only entire batches (avoids exceeding the image padding).
-    for (; x + kFloatsPerBatch < xsize; x += kFloatsPerBatch) {
-      rng->Fill(batch);
-      for (size_t i = 0; i < kFloatsPerBatch; i += Lanes(df)) {
-        BitsToFloat(reinterpret_cast<const uint32_t*>(batch) + i, row + x + i);
-      }
+    // Generate the random bits of all full batches directly into the row,
+    // then convert them to floats in place.
+    rng->Fill(reinterpret_cast<uint64_t*>(row), num_full_batches);
+    size_t x = num_full_batches * kFloatsPerBatch;
+    for (size_t i = 0; i < x; i += N) {
+      const auto bits = BitCast(du, LoadU(df, row + i));
+      const auto rand12 =
+          BitCast(df, Or(ShiftRight<9>(bits), Set(du, 0x3F800000)));
+      StoreU(rand12, df, row + i);
     }
 
     // Any remaining pixels, rounded up to vectors (safe due to padding).
@@ -187,6 +187,18 @@ int PatchDictionary::GetReferences() const {
   return result;
 }
 
+uint64_t PatchDictionary::EstimatedWork() const {
+  if (positions_.empty()) return 0;
+  // Each position has one blending per color and extra channel.
+  uint64_t blendings_per_position = blendings_.size() / positions_.size();
+  uint64_t work = 0;
+  for (const PatchPosition& pos : positions_) {
+    const PatchReferencePosition& ref = ref_positions_[pos.ref_pos_idx];
+    work += static_cast<uint64_t>(ref.xsize) * ref.ysize;
+  }
+  return work * blendings_per_position;
+}
+
 namespace {
 struct PatchInterval {
   size_t idx;
@@ -115,6 +115,9 @@ class PatchDictionary {
   // bit mask: bits 0-3 indicate reference frame 0-3.
   int GetReferences() const;
 
+  // Number of sample blending operations needed to apply all the patches.
+  uint64_t EstimatedWork() const;
+
   std::vector<size_t> GetPatchesForRow(size_t y) const;
 
  private:
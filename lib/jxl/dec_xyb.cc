@@ -215,6 +215,8 @@ Status OutputEncodingInfo::SetFromMetadata(const CodecMetadata& metadata) {
   orig_color_encoding = metadata.m.color_encoding;
   orig_intensity_target = metadata.m.IntensityTarget();
   desired_intensity_target = orig_intensity_target;
+  gamut_mapping = false;
+  preserve_saturation = 0.1f;
   const auto& im = metadata.transform_data.opsin_inverse_matrix;
   memcpy(orig_inverse_matrix, im.inverse_matrix, sizeof(orig_inverse_matrix));
   default_transform = im.all_default;
@@ -55,6 +55,11 @@ struct OutputEncodingInfo {
   float luminances[3];
   // Used for the HLG inverse OOTF and PQ tone mapping.
   float desired_intensity_target;
+  // Whether to map out-of-gamut colors into the output gamut even when no tone
+  // mapping is needed, and how much to favor saturation over luminance when
+  // doing so (also used after tone mapping).
+  bool gamut_mapping = false;
+  float preserve_saturation = 0.1f;
 
   Status SetFromMetadata(const CodecMetadata& metadata);
   Status MaybeSetColorEncoding(const ColorEncoding& c_desired);
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -408,7 +409,17 @@ struct JxlDecoderStruct {
   bool unpremul_alpha;
   bool render_spotcolors;
   bool coalescing;
+  bool fast_idct;
   float desired_intensity_target;
+  bool gamut_mapping;
+  float preserve_saturation;
+  // Maximum estimated work for all frames of the image, 0 means unlimited.
+  uint64_t work_budget;
+  // Estimated work of the frames before the one in frame_dec.
+  uint64_t work_spent;
+  JxlPriority priority;
+  // Set by JxlDecoderCancel, possibly from another thread.
+  std::atomic<bool> cancelled{false};
 
   // Bitfield, for which informative events (JXL_DEC_BASIC_INFO, etc...) the
   // decoder returns a status. By default, do not return for any of the events,
@@ -738,6 +749,8 @@ void JxlDecoderRewindDecodingState(JxlDecoder* dec) {
 
   dec->passes_state.reset(nullptr);
   dec->frame_dec.reset(nullptr);
+  dec->work_spent = 0;
+  dec->cancelled.store(false, std::memory_order_relaxed);
   dec->next_section = 0;
   dec->section_processed.clear();
 
@@ -769,7 +782,12 @@ void JxlDecoderReset(JxlDecoder* dec) {
   dec->unpremul_alpha = false;
   dec->render_spotcolors = true;
   dec->coalescing = true;
+  dec->fast_idct = false;
   dec->desired_intensity_target = 0;
+  dec->gamut_mapping = false;
+  dec->preserve_saturation = 0.1f;
+  dec->work_budget = 0;
+  dec->priority = JXL_PRIORITY_NORMAL;
   dec->orig_events_wanted = 0;
   dec->events_wanted = 0;
   dec->frame_references.clear();
@@ -871,6 +889,31 @@ JxlDecoderSetParallelRunner(JxlDecoder* dec, JxlParallelRunner parallel_runner,
   return JXL_DEC_SUCCESS;
 }
 
+JxlDecoderStatus JxlDecoderSetParallelPriorityRunner(
+    JxlDecoder* dec, JxlParallelPriorityRunner parallel_runner,
+    void* parallel_runner_opaque) {
+  if (dec->stage != DecoderStage::kInited) {
+    return JXL_API_ERROR(
+        "JxlDecoderSetParallelPriorityRunner must be called before starting");
+  }
+  dec->thread_pool.reset(new jxl::ThreadPool(/*runner=*/nullptr,
+                                             parallel_runner,
+                                             parallel_runner_opaque));
+  return JXL_DEC_SUCCESS;
+}
+
+JxlDecoderStatus JxlDecoderSetPriority(JxlDecoder* dec, JxlPriority priority) {
+  if (priority != JXL_PRIORITY_BACKGROUND && priority != JXL_PRIORITY_NORMAL) {
+    return JXL_API_ERROR("Invalid priority");
+  }
+  dec->priority = priority;
+  return JXL_DEC_SUCCESS;
+}
+
+void JxlDecoderCancel(JxlDecoder* dec) {
+  dec->cancelled.store(true, std::memory_order_relaxed);
+}
+
 size_t JxlDecoderSizeHintBasicInfo(const JxlDecoder* dec) {
   if (dec->got_basic_info) return 0;
   return dec->basic_info_size_hint;
@@ -915,6 +958,14 @@ JxlDecoderStatus JxlDecoderSetRenderSpotcolors(JxlDecoder* dec,
   return JXL_DEC_SUCCESS;
 }
 
+JxlDecoderStatus JxlDecoderSetFastIDCT(JxlDecoder* dec, JXL_BOOL fast_idct) {
+  if (dec->stage != DecoderStage::kInited) {
+    return JXL_API_ERROR("Must set fast_idct option before starting");
+  }
+  dec->fast_idct = !!fast_idct;
+  return JXL_DEC_SUCCESS;
+}
+
 JxlDecoderStatus JxlDecoderSetCoalescing(JxlDecoder* dec, JXL_BOOL coalescing) {
   if (dec->stage != DecoderStage::kInited) {
     return JXL_API_ERROR("Must set coalescing option before starting");
@@ -1094,6 +1145,9 @@ JxlDecoderStatus JxlDecoderReadAllHeaders(JxlDecoder* dec) {
     dec->passes_state->output_encoding_info.desired_intensity_target =
         dec->desired_intensity_target;
   }
+  dec->passes_state->output_encoding_info.gamut_mapping = dec->gamut_mapping;
+  dec->passes_state->output_encoding_info.preserve_saturation =
+      dec->preserve_saturation;
   dec->image_metadata = dec->metadata.m;
 
   return JXL_DEC_SUCCESS;
@@ -1140,6 +1194,14 @@ JxlDecoderStatus JxlDecoderProcessSections(JxlDecoder* dec) {
     // a complete section are provided to the FrameDecoder.
     return JXL_INPUT_ERROR("frame out of bounds");
   }
+  if (status.code() == StatusCode::kWorkBudgetExceeded) {
+    dec->stage = DecoderStage::kError;
+    return JXL_DEC_WORK_BUDGET_EXCEEDED;
+  }
+  if (status.code() == StatusCode::kCancelled) {
+    dec->stage = DecoderStage::kError;
+    return JXL_DEC_CANCELLED;
+  }
   if (!status) {
     return JXL_INPUT_ERROR("frame processing failed");
   }
@@ -1170,6 +1232,8 @@ JxlDecoderStatus JxlDecoderProcessCodestream(JxlDecoder* dec) {
   if (!dec->thread_pool) {
     dec->thread_pool.reset(new jxl::ThreadPool(nullptr, nullptr));
   }
+  dec->thread_pool->SetCancelFlag(&dec->cancelled);
+  dec->thread_pool->SetPriority(dec->priority);
 
   // No matter what events are wanted, the basic info is always required.
   if (!dec->got_basic_info) {
@@ -1240,9 +1304,17 @@ JxlDecoderStatus JxlDecoderProcessCodestream(JxlDecoder* dec) {
       if (!dec->jpeg_decoder.SetImageBundleJpegData(dec->ib.get()))
         return JXL_DEC_ERROR;
 #endif
+      if (dec->frame_dec) {
+        dec->work_spent += dec->frame_dec->EstimatedWork();
+      }
       dec->frame_dec.reset(new FrameDecoder(
           dec->passes_state.get(), dec->metadata, dec->thread_pool.get(),
           /*use_slow_rendering_pipeline=*/false));
+      if (dec->work_budget != 0) {
+        dec->frame_dec->SetWorkBudget(dec->work_budget > dec->work_spent
+                                          ? dec->work_budget - dec->work_spent
+                                          : 0);
+      }
       dec->frame_header.reset(new FrameHeader(&dec->metadata));
       Span<const uint8_t> span;
       JXL_API_RETURN_IF_ERROR(dec->GetCodestreamInput(&span));
@@ -1367,6 +1439,7 @@ JxlDecoderStatus JxlDecoderProcessCodestream(JxlDecoder* dec) {
     if (dec->frame_stage == FrameStage::kTOC) {
       dec->frame_dec->SetRenderSpotcolors(dec->render_spotcolors);
       dec->frame_dec->SetCoalescing(dec->coalescing);
+      dec->frame_dec->SetFastIDCT(dec->fast_idct);
 
       if (!dec->preview_frame &&
           (dec->events_wanted & JXL_DEC_FRAME_PROGRESSION)) {
@@ -2019,6 +2092,10 @@ static JxlDecoderStatus HandleBoxes(JxlDecoder* dec) {
 }
 
 JxlDecoderStatus JxlDecoderProcessInput(JxlDecoder* dec) {
+  if (dec->cancelled.load(std::memory_order_relaxed)) {
+    dec->stage = DecoderStage::kError;
+    return JXL_DEC_CANCELLED;
+  }
   if (dec->stage == DecoderStage::kInited) {
     dec->stage = DecoderStage::kStarted;
   }
@@ -2073,78 +2150,88 @@ JxlDecoderStatus JxlDecoderProcessInput(JxlDecoder* dec) {
 static_assert(sizeof(JxlBasicInfo) == 204,
               "JxlBasicInfo struct size should remain constant");
 
-JxlDecoderStatus JxlDecoderGetBasicInfo(const JxlDecoder* dec,
-                                        JxlBasicInfo* info) {
-  if (!dec->got_basic_info) return JXL_DEC_NEED_MORE_INPUT;
+namespace {
 
-  if (info) {
-    memset(info, 0, sizeof(*info));
+void FillBasicInfo(const jxl::CodecMetadata& metadata, bool have_container,
+                   bool keep_orientation, float desired_intensity_target,
+                   JxlBasicInfo* info) {
+  memset(info, 0, sizeof(*info));
 
-    const jxl::ImageMetadata& meta = dec->metadata.m;
+  const jxl::ImageMetadata& meta = metadata.m;
 
-    info->have_container = dec->have_container;
-    info->xsize = dec->metadata.size.xsize();
-    info->ysize = dec->metadata.size.ysize();
-    info->uses_original_profile = !meta.xyb_encoded;
+  info->have_container = have_container;
+  info->xsize = metadata.size.xsize();
+  info->ysize = metadata.size.ysize();
+  info->uses_original_profile = !meta.xyb_encoded;
 
-    info->bits_per_sample = meta.bit_depth.bits_per_sample;
-    info->exponent_bits_per_sample = meta.bit_depth.exponent_bits_per_sample;
+  info->bits_per_sample = meta.bit_depth.bits_per_sample;
+  info->exponent_bits_per_sample = meta.bit_depth.exponent_bits_per_sample;
 
-    info->have_preview = meta.have_preview;
-    info->have_animation = meta.have_animation;
-    info->orientation = static_cast<JxlOrientation>(meta.orientation);
+  info->have_preview = meta.have_preview;
+  info->have_animation = meta.have_animation;
+  info->orientation = static_cast<JxlOrientation>(meta.orientation);
 
-    if (!dec->keep_orientation) {
-      if (info->orientation >= JXL_ORIENT_TRANSPOSE) {
-        std::swap(info->xsize, info->ysize);
-      }
-      info->orientation = JXL_ORIENT_IDENTITY;
+  if (!keep_orientation) {
+    if (info->orientation >= JXL_ORIENT_TRANSPOSE) {
+      std::swap(info->xsize, info->ysize);
     }
+    info->orientation = JXL_ORIENT_IDENTITY;
+  }
 
-    info->intensity_target = meta.IntensityTarget();
-    if (dec->desired_intensity_target > 0) {
-      info->intensity_target = dec->desired_intensity_target;
-    }
-    info->min_nits = meta.tone_mapping.min_nits;
-    info->relative_to_max_display = meta.tone_mapping.relative_to_max_display;
-    info->linear_below = meta.tone_mapping.linear_below;
-
-    const jxl::ExtraChannelInfo* alpha = meta.Find(jxl::ExtraChannel::kAlpha);
-    if (alpha != nullptr) {
-      info->alpha_bits = alpha->bit_depth.bits_per_sample;
-      info->alpha_exponent_bits = alpha->bit_depth.exponent_bits_per_sample;
-      info->alpha_premultiplied = alpha->alpha_associated;
-    } else {
-      info->alpha_bits = 0;
-      info->alpha_exponent_bits = 0;
-      info->alpha_premultiplied = 0;
-    }
+  info->intensity_target = meta.IntensityTarget();
+  if (desired_intensity_target > 0) {
+    info->intensity_target = desired_intensity_target;
+  }
+  info->min_nits = meta.tone_mapping.min_nits;
+  info->relative_to_max_display = meta.tone_mapping.relative_to_max_display;
+  info->linear_below = meta.tone_mapping.linear_below;
 
-    info->num_color_channels =
-        meta.color_encoding.GetColorSpace() == jxl::ColorSpace::kGray ? 1 : 3;
+  const jxl::ExtraChannelInfo* alpha = meta.Find(jxl::ExtraChannel::kAlpha);
+  if (alpha != nullptr) {
+    info->alpha_bits = alpha->bit_depth.bits_per_sample;
+    info->alpha_exponent_bits = alpha->bit_depth.exponent_bits_per_sample;
+    info->alpha_premultiplied = alpha->alpha_associated;
+  } else {
+    info->alpha_bits = 0;
+    info->alpha_exponent_bits = 0;
+    info->alpha_premultiplied = 0;
+  }
 
-    info->num_extra_channels = meta.num_extra_channels;
+  info->num_color_channels =
+      meta.color_encoding.GetColorSpace() == jxl::ColorSpace::kGray ? 1 : 3;
 
-    if (info->have_preview) {
-      info->preview.xsize = dec->metadata.m.preview_size.xsize();
-      info->preview.ysize = dec->metadata.m.preview_size.ysize();
-    }
+  info->num_extra_channels = meta.num_extra_channels;
 
-    if (info->have_animation) {
-      info->animation.tps_numerator = dec->metadata.m.animation.tps_numerator;
-      info->animation.tps_denominator =
-          dec->metadata.m.animation.tps_denominator;
-      info->animation.num_loops = dec->metadata.m.animation.num_loops;
-      info->animation.have_timecodes = dec->metadata.m.animation.have_timecodes;
-    }
+  if (info->have_preview) {
+    info->preview.xsize = meta.preview_size.xsize();
+    info->preview.ysize = meta.preview_size.ysize();
+  }
 
-    if (meta.have_intrinsic_size) {
-      info->intrinsic_xsize = dec->metadata.m.intrinsic_size.xsize();
-      info->intrinsic_ysize = dec->metadata.m.intrinsic_size.ysize();
-    } else {
-      info->intrinsic_xsize = info->xsize;
-      info->intrinsic_ysize = info->ysize;
-    }
+  if (info->have_animation) {
+    info->animation.tps_numerator = meta.animation.tps_numerator;
+    info->animation.tps_denominator = meta.animation.tps_denominator;
+    info->animation.num_loops = meta.animation.num_loops;
+    info->animation.have_timecodes = meta.animation.have_timecodes;
+  }
+
+  if (meta.have_intrinsic_size) {
+    info->intrinsic_xsize = meta.intrinsic_size.xsize();
+    info->intrinsic_ysize = meta.intrinsic_size.ysize();
+  } else {
+    info->intrinsic_xsize = info->xsize;
+    info->intrinsic_ysize = info->ysize;
+  }
+}
+
+}  // namespace
+
+JxlDecoderStatus JxlDecoderGetBasicInfo(const JxlDecoder* dec,
+                                        JxlBasicInfo* info) {
+  if (!dec->got_basic_info) return JXL_DEC_NEED_MORE_INPUT;
+
+  if (info) {
+    FillBasicInfo(dec->metadata, dec->have_container, dec->keep_orientation,
+                  dec->desired_intensity_target, info);
   }
 
   return JXL_DEC_SUCCESS;
@@ -2615,6 +2702,127 @@ JxlDecoderStatus JxlDecoderGetFrameHeader(const JxlDecoder* dec,
   return JXL_DEC_SUCCESS;
 }
 
+namespace {
+
+// Converts the result of reading a header field bundle in JxlProbe.
+JxlDecoderStatus ProbeStatus(jxl::BitReader* reader, jxl::Status status) {
+  if (!reader->AllReadsWithinBounds()) return JXL_DEC_NEED_MORE_INPUT;
+  return status ? JXL_DEC_SUCCESS : JXL_DEC_ERROR;
+}
+
+JxlDecoderStatus ProbeCodestreamHeaders(jxl::BitReader* reader,
+                                        bool have_container,
+                                        JxlProbeResult* result) {
+  jxl::CodecMetadata metadata;
+  JXL_API_RETURN_IF_ERROR(
+      ProbeStatus(reader, jxl::Bundle::Read(reader, &metadata.size)));
+  JXL_API_RETURN_IF_ERROR(
+      ProbeStatus(reader, jxl::Bundle::Read(reader, &metadata.m)));
+  FillBasicInfo(metadata, have_container, /*keep_orientation=*/true,
+                /*desired_intensity_target=*/0, &result->basic_info);
+  result->uses_icc_profile = metadata.m.color_encoding.WantICC();
+  if (!result->uses_icc_profile) {
+    metadata.m.color_encoding.ToExternal(&result->color_encoding);
+  }
+
+  // Reaching the first frame header would require entropy decoding the ICC
+  // profile or skipping over the preview frame.
+  if (metadata.m.color_encoding.WantICC() || metadata.m.have_preview) {
+    return JXL_DEC_SUCCESS;
+  }
+  metadata.transform_data.nonserialized_xyb_encoded = metadata.m.xyb_encoded;
+  jxl::FrameHeader frame_header(&metadata);
+  // The frame header is optional in the result, so a truncated or invalid one
+  // is not an error here.
+  if (!jxl::Bundle::Read(reader, &metadata.transform_data) ||
+      !reader->JumpToByteBoundary() ||
+      !jxl::Bundle::Read(reader, &frame_header) ||
+      !reader->AllReadsWithinBounds()) {
+    return JXL_DEC_SUCCESS;
+  }
+
+  JxlFrameHeader* header = &result->frame_header;
+  if (metadata.m.have_animation) {
+    header->duration = frame_header.animation_frame.duration;
+    if (metadata.m.animation.have_timecodes) {
+      header->timecode = frame_header.animation_frame.timecode;
+    }
+  }
+  header->name_length = frame_header.name.size();
+  header->is_last = frame_header.is_last;
+  const jxl::FrameDimensions frame_dim = frame_header.ToFrameDimensions();
+  header->layer_info.xsize = frame_dim.xsize_upsampled;
+  header->layer_info.ysize = frame_dim.ysize_upsampled;
+  if (frame_header.custom_size_or_origin) {
+    header->layer_info.crop_x0 = frame_header.frame_origin.x0;
+    header->layer_info.crop_y0 = frame_header.frame_origin.y0;
+    header->layer_info.have_crop = JXL_TRUE;
+  }
+  header->layer_info.blend_info.blendmode =
+      static_cast<JxlBlendMode>(frame_header.blending_info.mode);
+  header->layer_info.blend_info.source = frame_header.blending_info.source;
+  header->layer_info.blend_info.alpha =
+      frame_header.blending_info.alpha_channel;
+  header->layer_info.blend_info.clamp = frame_header.blending_info.clamp;
+  header->layer_info.save_as_reference = frame_header.save_as_reference;
+  result->have_frame_header = JXL_TRUE;
+  return JXL_DEC_SUCCESS;
+}
+
+}  // namespace
+
+JxlDecoderStatus JxlProbe(const uint8_t* data, size_t size,
+                          JxlProbeResult* result) {
+  memset(result, 0, sizeof(*result));
+  size_t pos = 0;
+  JxlSignature signature = ReadSignature(data, size, &pos);
+  if (signature == JXL_SIG_NOT_ENOUGH_BYTES) return JXL_DEC_NEED_MORE_INPUT;
+  if (signature == JXL_SIG_INVALID) return JXL_INPUT_ERROR("invalid signature");
+  const bool have_container = (signature == JXL_SIG_CONTAINER);
+
+  size_t codestream_end = size;
+  if (have_container) {
+    // Find the first non-empty codestream box, only the codestream part in it
+    // is parsed.
+    for (;;) {
+      JxlBoxType type;
+      uint64_t box_size;
+      uint64_t header_size;
+      JXL_API_RETURN_IF_ERROR(ParseBoxHeader(data, size, pos, pos, type,
+                                             &box_size, &header_size));
+      bool available = box_size != 0 && !OutOfBounds(pos, box_size, size);
+      size_t box_end = available ? pos + box_size : size;
+      pos += header_size;
+      if (memcmp(type, "jxlp", 4) == 0) {
+        // Skip the index of the partial codestream box.
+        if (OutOfBounds(pos, 4, box_end)) return JXL_DEC_NEED_MORE_INPUT;
+        pos += 4;
+      }
+      if ((memcmp(type, "jxlc", 4) == 0 || memcmp(type, "jxlp", 4) == 0) &&
+          (!available || box_end > pos)) {
+        codestream_end = box_end;
+        break;
+      }
+      if (box_size == 0) return JXL_INPUT_ERROR("no codestream box");
+      if (!available) return JXL_DEC_NEED_MORE_INPUT;
+      pos = box_end;
+    }
+    if (OutOfBounds(pos, 2, codestream_end)) return JXL_DEC_NEED_MORE_INPUT;
+    if (data[pos] != 0xff || data[pos + 1] != jxl::kCodestreamMarker) {
+      return JXL_INPUT_ERROR("invalid codestream signature");
+    }
+    pos += 2;
+  }
+
+  jxl::BitReader reader(
+      jxl::Span<const uint8_t>(data + pos, codestream_end - pos));
+  JxlDecoderStatus status =
+      ProbeCodestreamHeaders(&reader, have_container, result);
+  (void)reader.AllReadsWithinBounds();
+  (void)reader.Close();
+  return status;
+}
+
 JxlDecoderStatus JxlDecoderGetExtraChannelBlendInfo(const JxlDecoder* dec,
                                                     size_t index,
                                                     JxlBlendInfo* blend_info) {
@@ -2686,6 +2894,30 @@ JxlDecoderStatus JxlDecoderSetDesiredIntensityTarget(
   return JXL_DEC_SUCCESS;
 }
 
+JxlDecoderStatus JxlDecoderSetGamutMapping(JxlDecoder* dec, JXL_BOOL enabled,
+                                           float preserve_saturation) {
+  if (!(preserve_saturation >= 0 && preserve_saturation <= 1)) {
+    return JXL_API_ERROR("preserve_saturation must be in [0, 1]");
+  }
+  dec->gamut_mapping = !!enabled;
+  dec->preserve_saturation = preserve_saturation;
+  return JXL_DEC_SUCCESS;
+}
+
+JxlDecoderStatus JxlDecoderSetWorkBudget(JxlDecoder* dec, uint64_t budget) {
+  if (dec->stage != DecoderStage::kInited) {
+    return JXL_API_ERROR("Must set work budget before starting");
+  }
+  dec->work_budget = budget;
+  return JXL_DEC_SUCCESS;
+}
+
+uint64_t JxlDecoderGetEstimatedWork(const JxlDecoder* dec) {
+  uint64_t work = dec->work_spent;
+  if (dec->frame_dec) work += dec->frame_dec->EstimatedWork();
+  return work;
+}
+
 JxlDecoderStatus JxlDecoderSetBoxBuffer(JxlDecoder* dec, uint8_t* data,
                                         size_t size) {
   if (dec->box_out_buffer_set) {
@@ -0,0 +1,105 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <jxl/decode.h>
+#include <jxl/encode.h>
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "lib/jxl/base/status.h"
+
+namespace jxl {
+namespace {
+
+// Small animated RGBA image in a container, only its headers are read.
+std::vector<uint8_t> EncodeTestImage() {
+  const uint32_t xsize = 64;
+  const uint32_t ysize = 48;
+  JxlEncoder* enc = JxlEncoderCreate(nullptr);
+  JXL_CHECK(JxlEncoderUseContainer(enc, JXL_TRUE) == JXL_ENC_SUCCESS);
+  JxlBasicInfo info;
+  JxlEncoderInitBasicInfo(&info);
+  info.xsize = xsize;
+  info.ysize = ysize;
+  info.num_extra_channels = 1;
+  info.alpha_bits = 8;
+  info.orientation = JXL_ORIENT_ROTATE_90_CW;
+  info.have_animation = JXL_TRUE;
+  info.animation.tps_numerator = 10;
+  info.animation.tps_denominator = 1;
+  JXL_CHECK(JxlEncoderSetBasicInfo(enc, &info) == JXL_ENC_SUCCESS);
+  JxlColorEncoding color_encoding;
+  JxlColorEncodingSetToSRGB(&color_encoding, /*is_gray=*/JXL_FALSE);
+  JXL_CHECK(JxlEncoderSetColorEncoding(enc, &color_encoding) ==
+            JXL_ENC_SUCCESS);
+  JxlEncoderFrameSettings* settings = JxlEncoderFrameSettingsCreate(enc, NULL);
+  JxlFrameHeader header;
+  JxlEncoderInitFrameHeader(&header);
+  header.duration = 1;
+  JXL_CHECK(JxlEncoderSetFrameHeader(settings, &header) == JXL_ENC_SUCCESS);
+  JxlPixelFormat format = {4, JXL_TYPE_UINT8, JXL_NATIVE_ENDIAN, 0};
+  std::vector<uint8_t> pixels(xsize * ysize * 4, 128);
+  JXL_CHECK(JxlEncoderAddImageFrame(settings, &format, pixels.data(),
+                                    pixels.size()) == JXL_ENC_SUCCESS);
+  JxlEncoderCloseInput(enc);
+  std::vector<uint8_t> compressed(4096);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  JXL_CHECK(JxlEncoderProcessOutput(enc, &next_out, &avail_out) ==
+            JXL_ENC_SUCCESS);
+  compressed.resize(next_out - compressed.data());
+  JxlEncoderDestroy(enc);
+  return compressed;
+}
+
+void BM_DecodeHeaders_Probe(benchmark::State& state) {
+  const std::vector<uint8_t> compressed = EncodeTestImage();
+  for (auto _ : state) {
+    JxlProbeResult result;
+    JXL_CHECK(JxlProbe(compressed.data(), compressed.size(), &result) ==
+              JXL_DEC_SUCCESS);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// The same information through a decoder instance, as JxlProbe replaces.
+void BM_DecodeHeaders_Decoder(benchmark::State& state) {
+  const std::vector<uint8_t> compressed = EncodeTestImage();
+  for (auto _ : state) {
+    JxlDecoder* dec = JxlDecoderCreate(nullptr);
+    JXL_CHECK(JxlDecoderSubscribeEvents(dec, JXL_DEC_BASIC_INFO |
+                                                 JXL_DEC_COLOR_ENCODING |
+                                                 JXL_DEC_FRAME) ==
+              JXL_DEC_SUCCESS);
+    JXL_CHECK(JxlDecoderSetCoalescing(dec, JXL_FALSE) == JXL_DEC_SUCCESS);
+    JXL_CHECK(JxlDecoderSetInput(dec, compressed.data(), compressed.size()) ==
+              JXL_DEC_SUCCESS);
+    JxlDecoderCloseInput(dec);
+    JxlBasicInfo info;
+    JxlColorEncoding color_encoding;
+    JxlFrameHeader header;
+    JXL_CHECK(JxlDecoderProcessInput(dec) == JXL_DEC_BASIC_INFO);
+    JXL_CHECK(JxlDecoderGetBasicInfo(dec, &info) == JXL_DEC_SUCCESS);
+    JXL_CHECK(JxlDecoderProcessInput(dec) == JXL_DEC_COLOR_ENCODING);
+    JXL_CHECK(JxlDecoderGetColorAsEncodedProfile(
+                  dec, JXL_COLOR_PROFILE_TARGET_ORIGINAL, &color_encoding) ==
+              JXL_DEC_SUCCESS);
+    JXL_CHECK(JxlDecoderProcessInput(dec) == JXL_DEC_FRAME);
+    JXL_CHECK(JxlDecoderGetFrameHeader(dec, &header) == JXL_DEC_SUCCESS);
+    benchmark::DoNotOptimize(info);
+    benchmark::DoNotOptimize(color_encoding);
+    benchmark::DoNotOptimize(header);
+    JxlDecoderDestroy(dec);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DecodeHeaders_Probe);
+BENCHMARK(BM_DecodeHeaders_Decoder);
+
+}  // namespace
+}  // namespace jxl
@@ -1673,6 +1673,42 @@ TEST(DecodeTest, PixelTestWithICCProfileLossy) {
   JxlDecoderDestroy(dec);
 }
 
+TEST(DecodeTest, FastIDCTTest) {
+  size_t xsize = 123, ysize = 77;
+  std::vector<uint8_t> pixels = jxl::test::GetSomeTestImage(xsize, ysize, 3, 0);
+  jxl::TestCodestreamParams params;
+  jxl::PaddedBytes compressed = jxl::CreateTestJXLCodestream(
+      jxl::Span<const uint8_t>(pixels.data(), pixels.size()), xsize, ysize, 3,
+      params);
+  JxlPixelFormat format = {3, JXL_TYPE_UINT8, JXL_NATIVE_ENDIAN, 0};
+
+  std::vector<uint8_t> pixels_float = jxl::DecodeWithAPI(
+      jxl::Span<const uint8_t>(compressed.data(), compressed.size()), format,
+      /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+
+  JxlDecoder* dec = JxlDecoderCreate(NULL);
+  EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetFastIDCT(dec, JXL_TRUE));
+  std::vector<uint8_t> pixels_fast = jxl::DecodeWithAPI(
+      dec, jxl::Span<const uint8_t>(compressed.data(), compressed.size()),
+      format, /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+  // The option can not be changed once decoding has started.
+  EXPECT_EQ(JXL_DEC_ERROR, JxlDecoderSetFastIDCT(dec, JXL_FALSE));
+  JxlDecoderDestroy(dec);
+
+  ASSERT_EQ(pixels_float.size(), pixels_fast.size());
+  // The rounding of the fixed-point IDCT is visible in the output, which shows
+  // that it was used, ...
+  EXPECT_NE(pixels_float, pixels_fast);
+  // ... but changes the output by at most 4 levels.
+  EXPECT_EQ(0u, jxl::test::ComparePixels(pixels_float.data(),
+                                         pixels_fast.data(), xsize, ysize,
+                                         format, format, 8.0));
+}
+
 std::string ColorDescription(JxlColorEncoding c) {
   jxl::ColorEncoding color_encoding;
   EXPECT_TRUE(color_encoding.FromExternal(c));
@@ -1932,6 +1968,222 @@ TEST(DecodeTest, PixelTestOpaqueSrgbLossy) {
   }
 }
 
+TEST(DecodeTest, GamutMappingTest) {
+  JxlDecoder* dec = JxlDecoderCreate(NULL);
+  EXPECT_EQ(JXL_DEC_ERROR, JxlDecoderSetGamutMapping(dec, JXL_TRUE, -0.5f));
+  EXPECT_EQ(JXL_DEC_ERROR, JxlDecoderSetGamutMapping(dec, JXL_TRUE, 1.5f));
+  EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetGamutMapping(dec, JXL_TRUE, 0.5f));
+
+  size_t xsize = 123, ysize = 77;
+  std::vector<uint8_t> pixels =
+      jxl::test::GetSomeTestImage(xsize, ysize, 3, 0);
+  jxl::TestCodestreamParams params;
+  params.cparams.butteraugli_distance = 8.0f;
+  jxl::PaddedBytes compressed = jxl::CreateTestJXLCodestream(
+      jxl::Span<const uint8_t>(pixels.data(), pixels.size()), xsize, ysize, 3,
+      params);
+
+  // Lossy decoding of saturated colors overshoots the sRGB gamut; with gamut
+  // mapping, no output sample exceeds the peak.
+  JxlPixelFormat format = {3, JXL_TYPE_FLOAT, JXL_LITTLE_ENDIAN, 0};
+  std::vector<uint8_t> pixels2 = jxl::DecodeWithAPI(
+      dec, jxl::Span<const uint8_t>(compressed.data(), compressed.size()),
+      format, /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+  ASSERT_EQ(xsize * ysize * 3 * sizeof(float), pixels2.size());
+  const float* samples = reinterpret_cast<const float*>(pixels2.data());
+  for (size_t i = 0; i < xsize * ysize * 3; ++i) {
+    ASSERT_LE(samples[i], 1.0f + 1e-4f) << i;
+  }
+
+  JxlDecoderDestroy(dec);
+}
+
+TEST(DecodeTest, WorkBudgetTest) {
+  size_t xsize = 123, ysize = 77;
+  std::vector<uint8_t> pixels =
+      jxl::test::GetSomeTestImage(xsize, ysize, 3, 0);
+  jxl::TestCodestreamParams params;
+  jxl::PaddedBytes compressed = jxl::CreateTestJXLCodestream(
+      jxl::Span<const uint8_t>(pixels.data(), pixels.size()), xsize, ysize, 3,
+      params);
+  JxlPixelFormat format = {3, JXL_TYPE_UINT8, JXL_LITTLE_ENDIAN, 0};
+
+  // Without a budget, the image decodes and its work is reported.
+  JxlDecoder* dec = JxlDecoderCreate(NULL);
+  EXPECT_EQ(0u, JxlDecoderGetEstimatedWork(dec));
+  std::vector<uint8_t> pixels2 = jxl::DecodeWithAPI(
+      dec, jxl::Span<const uint8_t>(compressed.data(), compressed.size()),
+      format, /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+  EXPECT_EQ(xsize * ysize * 3, pixels2.size());
+  uint64_t work = JxlDecoderGetEstimatedWork(dec);
+  EXPECT_GE(work, xsize * ysize * 3);
+
+  // A budget that is too small stops decoding before the pixels.
+  JxlDecoderReset(dec);
+  EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetWorkBudget(dec, work - 1));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSubscribeEvents(dec, JXL_DEC_FULL_IMAGE));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSetInput(dec, compressed.data(), compressed.size()));
+  JxlDecoderCloseInput(dec);
+  EXPECT_EQ(JXL_DEC_NEED_IMAGE_OUT_BUFFER, JxlDecoderProcessInput(dec));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSetImageOutBuffer(dec, &format, pixels2.data(),
+                                        pixels2.size()));
+  EXPECT_EQ(JXL_DEC_WORK_BUDGET_EXCEEDED, JxlDecoderProcessInput(dec));
+  EXPECT_EQ(JXL_DEC_ERROR, JxlDecoderProcessInput(dec));
+  EXPECT_EQ(JXL_DEC_ERROR, JxlDecoderSetWorkBudget(dec, work));
+
+  // An exact budget is enough.
+  JxlDecoderReset(dec);
+  EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetWorkBudget(dec, work));
+  pixels2 = jxl::DecodeWithAPI(
+      dec, jxl::Span<const uint8_t>(compressed.data(), compressed.size()),
+      format, /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+  EXPECT_EQ(xsize * ysize * 3, pixels2.size());
+
+  JxlDecoderDestroy(dec);
+}
+
+TEST(DecodeTest, CancelTest) {
+  // Several groups, so that decoding can stop in the middle of the frame.
+  size_t xsize = 400, ysize = 300;
+  std::vector<uint8_t> pixels =
+      jxl::test::GetSomeTestImage(xsize, ysize, 3, 0);
+  jxl::TestCodestreamParams params;
+  jxl::PaddedBytes compressed = jxl::CreateTestJXLCodestream(
+      jxl::Span<const uint8_t>(pixels.data(), pixels.size()), xsize, ysize, 3,
+      params);
+  JxlPixelFormat format = {3, JXL_TYPE_UINT8, JXL_LITTLE_ENDIAN, 0};
+
+  // A decoder cancelled before it starts does not decode anything.
+  JxlDecoder* dec = JxlDecoderCreate(NULL);
+  JxlDecoderCancel(dec);
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSubscribeEvents(dec, JXL_DEC_FULL_IMAGE));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSetInput(dec, compressed.data(), compressed.size()));
+  JxlDecoderCloseInput(dec);
+  EXPECT_EQ(JXL_DEC_CANCELLED, JxlDecoderProcessInput(dec));
+  EXPECT_EQ(JXL_DEC_CANCELLED, JxlDecoderProcessInput(dec));
+
+  // Cancelling from the pixel callback, as another thread would, stops
+  // decoding after the group that is being rendered.
+  JxlDecoderReset(dec);
+  struct CancelState {
+    JxlDecoder* dec;
+    size_t num_rows;
+  } state = {dec, 0};
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSubscribeEvents(dec, JXL_DEC_FULL_IMAGE));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSetInput(dec, compressed.data(), compressed.size()));
+  JxlDecoderCloseInput(dec);
+  EXPECT_EQ(JXL_DEC_NEED_IMAGE_OUT_BUFFER, JxlDecoderProcessInput(dec));
+  EXPECT_EQ(JXL_DEC_SUCCESS,
+            JxlDecoderSetImageOutCallback(
+                dec, &format,
+                [](void* opaque, size_t x, size_t y, size_t num_pixels,
+                   const void* pixels) {
+                  auto* state = static_cast<CancelState*>(opaque);
+                  ++state->num_rows;
+                  JxlDecoderCancel(state->dec);
+                },
+                &state));
+  EXPECT_EQ(JXL_DEC_CANCELLED, JxlDecoderProcessInput(dec));
+  EXPECT_LT(0u, state.num_rows);
+  EXPECT_GT(2 * ysize, state.num_rows);
+
+  // After a reset, the decoder works again.
+  JxlDecoderReset(dec);
+  std::vector<uint8_t> pixels2 = jxl::DecodeWithAPI(
+      dec, jxl::Span<const uint8_t>(compressed.data(), compressed.size()),
+      format, /*use_callback=*/false, /*set_buffer_early=*/false,
+      /*use_resizable_runner=*/false, /*require_boxes=*/false,
+      /*expect_success=*/true);
+  EXPECT_EQ(xsize * ysize * 3, pixels2.size());
+
+  JxlDecoderDestroy(dec);
+}
+
+TEST(DecodeTest, ProbeTest) {
+  size_t xsize = 123, ysize = 77;
+  std::vector<uint8_t> pixels = jxl::test::GetSomeTestImage(xsize, ysize, 4, 0);
+  for (bool add_icc_profile : {false, true}) {
+    for (CodeStreamBoxFormat box_format :
+         {kCSBF_None, kCSBF_Single_Zero_Terminated, kCSBF_Single_Other,
+          kCSBF_Multi_First_Empty}) {
+      jxl::TestCodestreamParams params;
+      params.box_format = box_format;
+      params.orientation = JXL_ORIENT_ROTATE_90_CW;
+      params.add_icc_profile = add_icc_profile;
+      jxl::PaddedBytes compressed = jxl::CreateTestJXLCodestream(
+          jxl::Span<const uint8_t>(pixels.data(), pixels.size()), xsize, ysize,
+          4, params);
+
+      JxlProbeResult result;
+      ASSERT_EQ(JXL_DEC_SUCCESS,
+                JxlProbe(compressed.data(), compressed.size(), &result));
+      EXPECT_EQ(add_icc_profile, result.uses_icc_profile);
+      EXPECT_EQ(!add_icc_profile, result.have_frame_header);
+
+      // The probe matches the decoder with orientation kept and without
+      // coalescing.
+      JxlDecoder* dec = JxlDecoderCreate(nullptr);
+      EXPECT_EQ(JXL_DEC_SUCCESS,
+                JxlDecoderSubscribeEvents(dec, JXL_DEC_BASIC_INFO |
+                                                   JXL_DEC_COLOR_ENCODING |
+                                                   JXL_DEC_FRAME));
+      EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetKeepOrientation(dec, JXL_TRUE));
+      EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderSetCoalescing(dec, JXL_FALSE));
+      EXPECT_EQ(JXL_DEC_SUCCESS,
+                JxlDecoderSetInput(dec, compressed.data(), compressed.size()));
+      JxlDecoderCloseInput(dec);
+      EXPECT_EQ(JXL_DEC_BASIC_INFO, JxlDecoderProcessInput(dec));
+      JxlBasicInfo info;
+      EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderGetBasicInfo(dec, &info));
+      EXPECT_EQ(0, memcmp(&info, &result.basic_info, sizeof(info)));
+      EXPECT_EQ(JXL_DEC_COLOR_ENCODING, JxlDecoderProcessInput(dec));
+      if (!add_icc_profile) {
+        JxlColorEncoding color_encoding;
+        EXPECT_EQ(JXL_DEC_SUCCESS, JxlDecoderGetColorAsEncodedProfile(
+                                       dec, JXL_COLOR_PROFILE_TARGET_ORIGINAL,
+                                       &color_encoding));
+        EXPECT_EQ(ColorDescription(color_encoding),
+                  ColorDescription(result.color_encoding));
+      }
+      EXPECT_EQ(JXL_DEC_FRAME, JxlDecoderProcessInput(dec));
+      if (result.have_frame_header) {
+        JxlFrameHeader frame_header;
+        EXPECT_EQ(JXL_DEC_SUCCESS,
+                  JxlDecoderGetFrameHeader(dec, &frame_header));
+        EXPECT_EQ(0, memcmp(&frame_header, &result.frame_header,
+                            sizeof(frame_header)));
+      }
+      JxlDecoderDestroy(dec);
+
+      // A prefix of the file either needs more input or gives the same basic
+      // info.
+      for (size_t size = 0; size < compressed.size(); ++size) {
+        JxlProbeResult partial;
+        JxlDecoderStatus status = JxlProbe(compressed.data(), size, &partial);
+        if (status == JXL_DEC_SUCCESS) {
+          EXPECT_EQ(0, memcmp(&partial.basic_info, &result.basic_info,
+                              sizeof(result.basic_info)));
+        } else {
+          EXPECT_EQ(JXL_DEC_NEED_MORE_INPUT, status);
+        }
+      }
+    }
+  }
+}
+
 // Opaque image with noise enabled, decoded to RGB8 and RGBA8.
 TEST(DecodeTest, PixelTestOpaqueSrgbLossyNoise) {
   for (unsigned channels = 3; channels <= 4; channels++) {
@@ -355,6 +355,10 @@ float EstimateEntropy(const AcStrategy& acs, float entropy_mul, size_t x,
                       const float* JXL_RESTRICT cmap_factors, float* block,
                       float* scratch_space, uint32_t* quantized) {
   const size_t size = (1 << acs.log2_covered_blocks()) * kDCTBlockSize;
+  // The first kMaxCoeffArea floats of scratch_space hold the quantization
+  // error; the transforms use the rest.
+  float* mem = scratch_space;
+  scratch_space += AcStrategy::kMaxCoeffArea;
 
   // Apply transform.
   for (size_t c = 0; c < 3; c++) {
@@ -403,8 +407,6 @@ float EstimateEntropy(const AcStrategy& acs, float entropy_mul, size_t x,
   float entropy = 0.0f;
   const HWY_CAPPED(float, 8) df8;
 
-  auto mem_alloc = hwy::AllocateAligned<float>(AcStrategy::kMaxCoeffArea);
-  float* mem = mem_alloc.get();
   auto loss = Zero(df8);
   for (size_t c = 0; c < 3; c++) {
     const float* inv_matrix = config.dequant->InvMatrix(acs.RawStrategy(), c);
@@ -791,7 +793,8 @@ void FindBestFirstLevelDivisionForSquare(
 }
 
 void ProcessRectACS(PassesEncoderState* JXL_RESTRICT enc_state,
-                    const ACSConfig& config, const Rect& rect) {
+                    const ACSConfig& config, const Rect& rect,
+                    ThreadPool* pool, size_t thread) {
   // Main philosophy here:
   // 1. First find best 8x8 transform for each area.
   // 2. Merging them into larger transforms where possibly, but
@@ -807,13 +810,14 @@ void ProcessRectACS(PassesEncoderState* JXL_RESTRICT enc_state,
   AcStrategyImage* ac_strategy = &enc_state->shared.ac_strategy;
   const size_t dct_scratch_size =
       3 * (MaxVectorSize() / sizeof(float)) * AcStrategy::kMaxBlockDim;
-  // TODO(veluca): reuse allocations
-  auto mem = hwy::AllocateAligned<float>(5 * AcStrategy::kMaxCoeffArea +
-                                         dct_scratch_size);
-  auto qmem = hwy::AllocateAligned<uint32_t>(AcStrategy::kMaxCoeffArea);
-  uint32_t* JXL_RESTRICT quantized = qmem.get();
-  float* JXL_RESTRICT block = mem.get();
-  float* JXL_RESTRICT scratch_space = mem.get() + 3 * AcStrategy::kMaxCoeffArea;
+  float* mem = pool->Scratch<float>(
+      thread, 0, 6 * AcStrategy::kMaxCoeffArea + dct_scratch_size);
+  uint32_t* qmem =
+      pool->Scratch<uint32_t>(thread, 1, AcStrategy::kMaxCoeffArea);
+  JXL_CHECK(mem != nullptr && qmem != nullptr);
+  uint32_t* JXL_RESTRICT quantized = qmem;
+  float* JXL_RESTRICT block = mem;
+  float* JXL_RESTRICT scratch_space = mem + 3 * AcStrategy::kMaxCoeffArea;
   size_t bx = rect.x0();
   size_t by = rect.y0();
   JXL_ASSERT(rect.xsize() <= 8);
@@ -1099,7 +1103,8 @@ void AcStrategyHeuristics::Init(const Image3F& src,
              enc_state->shared.frame_dim.ysize_blocks);
 }
 
-void AcStrategyHeuristics::ProcessRect(const Rect& rect) {
+void AcStrategyHeuristics::ProcessRect(const Rect& rect, ThreadPool* pool,
+                                       size_t thread) {
   const CompressParams& cparams = enc_state->cparams;
   // In Falcon mode, use DCT8 everywhere and uniform quantization.
   if (cparams.speed_tier >= SpeedTier::kCheetah) {
@@ -1107,7 +1112,7 @@ void AcStrategyHeuristics::ProcessRect(const Rect& rect) {
     return;
   }
   HWY_DYNAMIC_DISPATCH(ProcessRectACS)
-  (enc_state, config, rect);
+  (enc_state, config, rect, pool, thread);
 }
 
 void AcStrategyHeuristics::Finalize(AuxOut* aux_out) {
@@ -58,7 +58,8 @@ struct ACSConfig {
 
 struct AcStrategyHeuristics {
   void Init(const Image3F& src, PassesEncoderState* enc_state);
-  void ProcessRect(const Rect& rect);
+  // Uses the scratch of `thread` in `pool`, the pool running this call.
+  void ProcessRect(const Rect& rect, ThreadPool* pool, size_t thread);
   void Finalize(AuxOut* aux_out);
   ACSConfig config;
   PassesEncoderState* enc_state;
@@ -826,17 +826,17 @@ ImageBundle RoundtripImage(const Image3F& opsin, PassesEncoderState* enc_state,
 
 constexpr int kMaxButteraugliIters = 4;
 
-void FindBestQuantization(const ImageBundle& linear, const Image3F& opsin,
-                          PassesEncoderState* enc_state,
-                          const JxlCmsInterface& cms, ThreadPool* pool,
-                          AuxOut* aux_out) {
+Status FindBestQuantization(const ImageBundle& linear, const Image3F& opsin,
+                            PassesEncoderState* enc_state,
+                            const JxlCmsInterface& cms, ThreadPool* pool,
+                            AuxOut* aux_out) {
   const CompressParams& cparams = enc_state->cparams;
   if (cparams.resampling > 1 &&
       cparams.original_butteraugli_distance <= 4.0 * cparams.resampling) {
     // For downsampled opsin image, the butteraugli based adaptive quantization
     // loop would only make the size bigger without improving the distance much,
     // so in this case we enable it only for very high butteraugli targets.
-    return;
+    return true;
   }
   Quantizer& quantizer = enc_state->shared.quantizer;
   ImageI& raw_quant_field = enc_state->shared.raw_quant_field;
@@ -901,6 +901,7 @@ void FindBestQuantization(const ImageBundle& linear, const Image3F& opsin,
     iters = 2;
   }
   for (int i = 0; i < iters + 1; ++i) {
+    JXL_RETURN_IF_ERROR(CheckCancelled(pool));
     if (JXL_DEBUG_ADAPTIVE_QUANTIZATION) {
       printf("\nQuantization field:\n");
       for (size_t y = 0; y < quant_field.ysize(); ++y) {
@@ -1018,12 +1019,13 @@ void FindBestQuantization(const ImageBundle& linear, const Image3F& opsin,
     }
   }
   quantizer.SetQuantField(initial_quant_dc, quant_field, &raw_quant_field);
+  return true;
 }
 
-void FindBestQuantizationMaxError(const Image3F& opsin,
-                                  PassesEncoderState* enc_state,
-                                  const JxlCmsInterface& cms, ThreadPool* pool,
-                                  AuxOut* aux_out) {
+Status FindBestQuantizationMaxError(const Image3F& opsin,
+                                    PassesEncoderState* enc_state,
+                                    const JxlCmsInterface& cms,
+                                    ThreadPool* pool, AuxOut* aux_out) {
   // TODO(szabadka): Make this work for non-opsin color spaces.
   const CompressParams& cparams = enc_state->cparams;
   Quantizer& quantizer = enc_state->shared.quantizer;
@@ -1041,6 +1043,7 @@ void FindBestQuantizationMaxError(const Image3F& opsin,
                                 1.0f / enc_state->cparams.max_error[2]};
 
   for (int i = 0; i < kMaxButteraugliIters + 1; ++i) {
+    JXL_RETURN_IF_ERROR(CheckCancelled(pool));
     quantizer.SetQuantField(initial_quant_dc, quant_field, &raw_quant_field);
     if (JXL_DEBUG_ADAPTIVE_QUANTIZATION && aux_out) {
       DumpXybImage(cparams, ("ops" + ToString(i)).c_str(), opsin);
@@ -1089,6 +1092,7 @@ void FindBestQuantizationMaxError(const Image3F& opsin,
     }
   }
   quantizer.SetQuantField(initial_quant_dc, quant_field, &raw_quant_field);
+  return true;
 }
 
 }  // namespace
@@ -1167,17 +1171,18 @@ ImageF InitialQuantField(const float butteraugli_target, const Image3F& opsin,
       mask1x1);
 }
 
-void FindBestQuantizer(const ImageBundle* linear, const Image3F& opsin,
-                       PassesEncoderState* enc_state,
-                       const JxlCmsInterface& cms, ThreadPool* pool,
-                       AuxOut* aux_out, double rescale) {
+Status FindBestQuantizer(const ImageBundle* linear, const Image3F& opsin,
+                         PassesEncoderState* enc_state,
+                         const JxlCmsInterface& cms, ThreadPool* pool,
+                         AuxOut* aux_out, double rescale) {
   const CompressParams& cparams = enc_state->cparams;
   if (cparams.max_error_mode) {
-    FindBestQuantizationMaxError(opsin, enc_state, cms, pool, aux_out);
+    return FindBestQuantizationMaxError(opsin, enc_state, cms, pool, aux_out);
   } else if (cparams.speed_tier <= SpeedTier::kKitten) {
     // Normal encoding to a butteraugli score.
-    FindBestQuantization(*linear, opsin, enc_state, cms, pool, aux_out);
+    return FindBestQuantization(*linear, opsin, enc_state, cms, pool, aux_out);
   }
+  return true;
 }
 
 }  // namespace jxl
@@ -50,10 +50,10 @@ void AdjustQuantField(const AcStrategyImage& ac_strategy, const Rect& rect,
 // quant_field. Also computes the dequant_map corresponding to the given
 // dequant_float_map and chosen quantization levels.
 // `linear` is only used in Kitten mode or slower.
-void FindBestQuantizer(const ImageBundle* linear, const Image3F& opsin,
-                       PassesEncoderState* enc_state,
-                       const JxlCmsInterface& cms, ThreadPool* pool,
-                       AuxOut* aux_out, double rescale = 1.0);
+Status FindBestQuantizer(const ImageBundle* linear, const Image3F& opsin,
+                         PassesEncoderState* enc_state,
+                         const JxlCmsInterface& cms, ThreadPool* pool,
+                         AuxOut* aux_out, double rescale = 1.0);
 
 }  // namespace jxl
 
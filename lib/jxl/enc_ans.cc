@@ -695,6 +695,11 @@ class HistogramBuilder {
     histograms_[histo_idx].Add(symbol);
   }
 
+  void AddHistogram(const Histogram& histogram, size_t histo_idx) {
+    JXL_DASSERT(histo_idx < histograms_.size());
+    histograms_[histo_idx].AddHistogram(histogram);
+  }
+
   // NOTE: `layer` is only for clustered_entropy; caller does ReclaimAndCharge.
   size_t BuildAndStoreEntropyCodes(
       const HistogramParams& params,
@@ -1471,13 +1476,22 @@ void ApplyLZ77(const HistogramParams& params, size_t num_contexts,
 }
 }  // namespace
 
-size_t BuildAndEncodeHistograms(const HistogramParams& params,
-                                size_t num_contexts,
-                                std::vector<std::vector<Token>>& tokens,
-                                EntropyEncodingData* codes,
-                                std::vector<uint8_t>* context_map,
-                                BitWriter* writer, size_t layer,
-                                AuxOut* aux_out) {
+void AddTokensToHistograms(const std::vector<Token>& tokens,
+                           std::vector<Histogram>* histograms) {
+  HybridUintConfig uint_config;
+  for (const Token& token : tokens) {
+    JXL_DASSERT(token.context < histograms->size());
+    uint32_t tok, nbits, bits;
+    uint_config.Encode(token.value, &tok, &nbits, &bits);
+    (*histograms)[token.context].Add(tok);
+  }
+}
+
+size_t BuildAndEncodeHistograms(
+    const HistogramParams& params, size_t num_contexts,
+    std::vector<std::vector<Token>>& tokens, EntropyEncodingData* codes,
+    std::vector<uint8_t>* context_map, BitWriter* writer, size_t layer,
+    AuxOut* aux_out, const std::vector<Histogram>* histograms) {
   size_t total_bits = 0;
   codes->lz77.nonserialized_distance_context = num_contexts;
   std::vector<std::vector<Token>> tokens_lz77;
@@ -1526,32 +1540,44 @@ size_t BuildAndEncodeHistograms(const HistogramParams& params,
   if (ans_fuzzer_friendly_) {
     uint_config = HybridUintConfig(10, 0, 0);
   }
-  for (size_t i = 0; i < tokens.size(); ++i) {
-    if (codes->lz77.enabled) {
-      for (size_t j = 0; j < tokens[i].size(); ++j) {
-        const Token& token = tokens[i][j];
-        total_tokens++;
-        uint32_t tok, nbits, bits;
-        (token.is_lz77_length ? codes->lz77.length_uint_config : uint_config)
-            .Encode(token.value, &tok, &nbits, &bits);
-        tok += token.is_lz77_length ? codes->lz77.min_symbol : 0;
-        builder.VisitSymbol(tok, token.context);
-      }
-    } else if (num_contexts == 1) {
-      for (size_t j = 0; j < tokens[i].size(); ++j) {
-        const Token& token = tokens[i][j];
-        total_tokens++;
-        uint32_t tok, nbits, bits;
-        uint_config.Encode(token.value, &tok, &nbits, &bits);
-        builder.VisitSymbol(tok, /*token.context=*/0);
-      }
-    } else {
-      for (size_t j = 0; j < tokens[i].size(); ++j) {
-        const Token& token = tokens[i][j];
-        total_tokens++;
-        uint32_t tok, nbits, bits;
-        uint_config.Encode(token.value, &tok, &nbits, &bits);
-        builder.VisitSymbol(tok, token.context);
+  // Histograms counted by the caller use the default config.
+  if (histograms != nullptr && !codes->lz77.enabled &&
+      params.uint_method != HistogramParams::HybridUintMethod::kContextMap &&
+      params.uint_method != HistogramParams::HybridUintMethod::k000 &&
+      !ans_fuzzer_friendly_) {
+    JXL_ASSERT(histograms->size() == num_contexts);
+    for (size_t c = 0; c < num_contexts; ++c) {
+      builder.AddHistogram((*histograms)[c], c);
+      total_tokens += (*histograms)[c].total_count_;
+    }
+  } else {
+    for (size_t i = 0; i < tokens.size(); ++i) {
+      if (codes->lz77.enabled) {
+        for (size_t j = 0; j < tokens[i].size(); ++j) {
+          const Token& token = tokens[i][j];
+          total_tokens++;
+          uint32_t tok, nbits, bits;
+          (token.is_lz77_length ? codes->lz77.length_uint_config : uint_config)
+              .Encode(token.value, &tok, &nbits, &bits);
+          tok += token.is_lz77_length ? codes->lz77.min_symbol : 0;
+          builder.VisitSymbol(tok, token.context);
+        }
+      } else if (num_contexts == 1) {
+        for (size_t j = 0; j < tokens[i].size(); ++j) {
+          const Token& token = tokens[i][j];
+          total_tokens++;
+          uint32_t tok, nbits, bits;
+          uint_config.Encode(token.value, &tok, &nbits, &bits);
+          builder.VisitSymbol(tok, /*token.context=*/0);
+        }
+      } else {
+        for (size_t j = 0; j < tokens[i].size(); ++j) {
+          const Token& token = tokens[i][j];
+          total_tokens++;
+          uint32_t tok, nbits, bits;
+          uint_config.Encode(token.value, &tok, &nbits, &bits);
+          builder.VisitSymbol(tok, token.context);
+        }
       }
     }
   }
@@ -104,17 +104,25 @@ struct Token {
 // histogram (header bits plus data bits).
 float ANSPopulationCost(const ANSHistBin* data, size_t alphabet_size);
 
+struct Histogram;
+
+// Adds the symbols of `tokens` to the per-context `histograms`, the way
+// BuildAndEncodeHistograms counts them without LZ77 and with the default
+// hybrid uint config. Allows counting independent streams in parallel.
+void AddTokensToHistograms(const std::vector<Token>& tokens,
+                           std::vector<Histogram>* histograms);
+
 // Apply context clustering, compute histograms and encode them. Returns an
 // estimate of the total bits used for encoding the stream. If `writer` ==
 // nullptr, the bit estimate will not take into account the context map (which
-// does not get written if `num_contexts` == 1).
-size_t BuildAndEncodeHistograms(const HistogramParams& params,
-                                size_t num_contexts,
-                                std::vector<std::vector<Token>>& tokens,
-                                EntropyEncodingData* codes,
-                                std::vector<uint8_t>* context_map,
-                                BitWriter* writer, size_t layer,
-                                AuxOut* aux_out);
+// does not get written if `num_contexts` == 1). If `histograms` is not null,
+// it must be the result of AddTokensToHistograms for all of `tokens`, and is
+// used instead of counting the tokens again whenever `params` allow it.
+size_t BuildAndEncodeHistograms(
+    const HistogramParams& params, size_t num_contexts,
+    std::vector<std::vector<Token>>& tokens, EntropyEncodingData* codes,
+    std::vector<uint8_t>* context_map, BitWriter* writer, size_t layer,
+    AuxOut* aux_out, const std::vector<Histogram>* histograms = nullptr);
 
 // Write the tokens to a string.
 void WriteTokens(const std::vector<Token>& tokens,
@@ -48,13 +48,23 @@ Status InitializePassesEncoder(const Image3F& opsin, const JxlCmsInterface& cms,
   enc_state->b_qm_multiplier =
       std::pow(1.25f, shared.frame_header.b_qm_scale - 2.0f);
 
+  // Coefficients left over from a previous frame can only be reused if they
+  // have a row for every group.
+  for (const auto& coeffs : enc_state->coeffs) {
+    if (coeffs->ysize() != shared.frame_dim.num_groups) {
+      enc_state->coeffs.clear();
+      break;
+    }
+  }
   if (enc_state->coeffs.size() < shared.frame_header.passes.num_passes) {
     enc_state->coeffs.reserve(shared.frame_header.passes.num_passes);
     for (size_t i = enc_state->coeffs.size();
          i < shared.frame_header.passes.num_passes; i++) {
       // Allocate enough coefficients for each group on every row.
-      enc_state->coeffs.emplace_back(make_unique<ACImageT<int32_t>>(
-          kGroupDim * kGroupDim, shared.frame_dim.num_groups));
+      auto coeffs = make_unique<ACImageT<int32_t>>(kGroupDim * kGroupDim,
+                                                   shared.frame_dim.num_groups);
+      JXL_RETURN_IF_ERROR(coeffs->FirstTouch(pool));
+      enc_state->coeffs.emplace_back(std::move(coeffs));
     }
   }
   while (enc_state->coeffs.size() > shared.frame_header.passes.num_passes) {
@@ -69,8 +79,8 @@ Status InitializePassesEncoder(const Image3F& opsin, const JxlCmsInterface& cms,
   Image3F dc(shared.frame_dim.xsize_blocks, shared.frame_dim.ysize_blocks);
   JXL_RETURN_IF_ERROR(RunOnPool(
       pool, 0, shared.frame_dim.num_groups, ThreadPool::NoInit,
-      [&](size_t group_idx, size_t _) {
-        ComputeCoefficients(group_idx, enc_state, opsin, &dc);
+      [&](size_t group_idx, size_t thread) {
+        ComputeCoefficients(group_idx, enc_state, opsin, &dc, pool, thread);
       },
       "Compute coeffs"));
 
@@ -200,6 +210,52 @@ Status InitializePassesEncoder(const Image3F& opsin, const JxlCmsInterface& cms,
   return true;
 }
 
+void RecyclePassesEncoderState(PassesEncoderState* enc_state) {
+  PassesSharedState& shared = enc_state->shared;
+  shared.matrices.ResetToDefault();
+  shared.quantizer = Quantizer(&shared.matrices);
+  shared.image_features = ImageFeatures();
+  shared.block_ctx_map = BlockCtxMap();
+  shared.num_histograms = 0;
+  for (size_t i = 0; i < 4; i++) {
+    shared.dc_frames[i] = Image3F();
+    shared.reference_frames[i].frame = ImageBundle();
+    shared.reference_frames[i].ib_is_in_xyb = false;
+  }
+  enc_state->special_frames.clear();
+  enc_state->progressive_splitter = ProgressiveSplitter();
+  enc_state->histogram_idx.clear();
+  enc_state->used_orders.clear();
+  enc_state->x_qm_multiplier = 1.0f;
+  enc_state->b_qm_multiplier = 1.0f;
+  enc_state->heuristics = make_unique<DefaultEncoderHeuristics>();
+}
+
+Status AllocateOpsin(size_t xsize, size_t ysize, ThreadPool* pool,
+                     PassesEncoderState* enc_state, Image3F* opsin) {
+  Image3F& storage = enc_state->opsin_storage;
+  if (storage.xsize() == RoundUpToBlockDim(xsize) &&
+      storage.ysize() == RoundUpToBlockDim(ysize)) {
+    *opsin = std::move(storage);
+  } else {
+    storage = Image3F();
+    *opsin = Image3F(RoundUpToBlockDim(xsize), RoundUpToBlockDim(ysize));
+    JXL_RETURN_IF_ERROR(FirstTouchImage(pool, opsin));
+  }
+  opsin->ShrinkTo(xsize, ysize);
+  return true;
+}
+
+void RecycleOpsin(size_t xsize, size_t ysize, PassesEncoderState* enc_state,
+                  Image3F* opsin) {
+  // An image is never larger than its buffer, so a padded one can be reused
+  // by AllocateOpsin.
+  if (opsin->xsize() == RoundUpToBlockDim(xsize) &&
+      opsin->ysize() == RoundUpToBlockDim(ysize)) {
+    enc_state->opsin_storage = std::move(*opsin);
+  }
+}
+
 void EncCache::InitOnce() {
   if (num_nzeroes.xsize() == 0) {
     num_nzeroes = Image3I(kGroupDimInBlocks, kGroupDimInBlocks);
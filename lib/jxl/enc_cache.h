@@ -31,6 +31,15 @@ namespace jxl {
 
 struct AuxOut;
 
+// Working area for ComputeCoefficients (per-group!)
+struct EncCache {
+  // Allocates memory when first called, shrinks images to current group size.
+  void InitOnce();
+
+  // TokenizeCoefficients
+  Image3I num_nzeroes;
+};
+
 // Contains encoder state.
 struct PassesEncoderState {
   PassesSharedState shared;
@@ -69,6 +78,12 @@ struct PassesEncoderState {
   // Heuristics to be used by the encoder.
   std::unique_ptr<EncoderHeuristics> heuristics =
       make_unique<DefaultEncoderHeuristics>();
+
+  // One per thread of the pool; they only depend on the group size.
+  std::vector<EncCache> group_caches;
+
+  // Buffer of the opsin image of the previous frame, see AllocateOpsin.
+  Image3F opsin_storage;
 };
 
 // Initialize per-frame information.
@@ -79,14 +94,24 @@ Status InitializePassesEncoder(const Image3F& opsin, const JxlCmsInterface& cms,
                                ModularFrameEncoder* modular_frame_encoder,
                                AuxOut* aux_out);
 
-// Working area for ComputeCoefficients (per-group!)
-struct EncCache {
-  // Allocates memory when first called, shrinks images to current group size.
-  void InitOnce();
-
-  // TokenizeCoefficients
-  Image3I num_nzeroes;
-};
+// Prepares a state that was used for a previous frame for encoding a new one.
+// Everything that depends on the previous frame (reference frames, patches,
+// progressive mode, quantization tables, ...) is reset to what a newly
+// constructed state holds, but the per-frame buffers and the computed default
+// quantization tables are kept, to be reused if the new frame has the same
+// dimensions.
+void RecyclePassesEncoderState(PassesEncoderState* enc_state);
+
+// Sets `*opsin` to an image of xsize x ysize that can be padded in place to
+// whole blocks. Takes over the buffer of the previous frame, if it had the
+// same size in blocks, instead of allocating and first-touching a new one.
+Status AllocateOpsin(size_t xsize, size_t ysize, ThreadPool* pool,
+                     PassesEncoderState* enc_state, Image3F* opsin);
+
+// Keeps the buffer of `opsin`, unless it was downsampled or replaced, for the
+// next frame of the same size in blocks.
+void RecycleOpsin(size_t xsize, size_t ysize, PassesEncoderState* enc_state,
+                  Image3F* opsin);
 
 }  // namespace jxl
 
@@ -374,12 +374,14 @@ void CfLHeuristics::ComputeTile(const Rect& r, const Image3F& opsin,
                                 const AcStrategyImage* ac_strategy,
                                 const ImageI* raw_quant_field,
                                 const Quantizer* quantizer, bool fast,
-                                size_t thread, ColorCorrelationMap* cmap) {
+                                ThreadPool* pool, size_t thread,
+                                ColorCorrelationMap* cmap) {
   bool use_dct8 = ac_strategy == nullptr;
+  float* mem = pool->Scratch<float>(thread, 2, ItemsPerThread());
+  JXL_CHECK(mem != nullptr);
   HWY_DYNAMIC_DISPATCH(ComputeTile)
   (opsin, dequant, ac_strategy, raw_quant_field, quantizer, r, fast, use_dct8,
-   &cmap->ytox_map, &cmap->ytob_map, &dc_values,
-   mem.get() + thread * ItemsPerThread());
+   &cmap->ytox_map, &cmap->ytob_map, &dc_values, mem);
 }
 
 void CfLHeuristics::ComputeDC(bool fast, ColorCorrelationMap* cmap) {
@@ -41,22 +41,18 @@ void ColorCorrelationMapEncodeDC(ColorCorrelationMap* map, BitWriter* writer,
 struct CfLHeuristics {
   void Init(const Image3F& opsin);
 
-  void PrepareForThreads(size_t num_threads) {
-    mem = hwy::AllocateAligned<float>(num_threads * ItemsPerThread());
-  }
-
   void ComputeTile(const Rect& r, const Image3F& opsin,
                    const DequantMatrices& dequant,
                    const AcStrategyImage* ac_strategy,
                    const ImageI* raw_quant_field, const Quantizer* quantizer,
-                   bool fast, size_t thread, ColorCorrelationMap* cmap);
+                   bool fast, ThreadPool* pool, size_t thread,
+                   ColorCorrelationMap* cmap);
 
   void ComputeDC(bool fast, ColorCorrelationMap* cmap);
 
   ImageF dc_values;
-  hwy::AlignedFreeUniquePtr<float[]> mem;
 
-  // Working set is too large for stack; allocate dynamically.
+  // Working set is too large for stack; taken from the per-thread scratch.
   static size_t ItemsPerThread() {
     const size_t dct_scratch_size =
         3 * (MaxVectorSize() / sizeof(float)) * AcStrategy::kMaxBlockDim;
@@ -521,7 +521,9 @@ class LossyFrameEncoder {
     shared.num_histograms = 1;
 
     const auto tokenize_group_init = [&](const size_t num_threads) {
-      group_caches_.resize(num_threads);
+      if (enc_state_->group_caches.size() < num_threads) {
+        enc_state_->group_caches.resize(num_threads);
+      }
       return true;
     };
     const auto tokenize_group = [&](const uint32_t group_index,
@@ -537,11 +539,11 @@ class LossyFrameEncoder {
             enc_state_->coeffs[idx_pass]->PlaneRow(2, group_index, 0).ptr32,
         };
         // Ensure group cache is initialized.
-        group_caches_[thread].InitOnce();
+        enc_state_->group_caches[thread].InitOnce();
         TokenizeCoefficients(
             &shared.coeff_orders[idx_pass * shared.coeff_order_size], rect,
             ac_rows, shared.ac_strategy, frame_header->chroma_subsampling,
-            &group_caches_[thread].num_nzeroes,
+            &enc_state_->group_caches[thread].num_nzeroes,
             &enc_state_->passes[idx_pass].ac_tokens[group_index],
             enc_state_->shared.quant_dc, enc_state_->shared.raw_quant_field,
             enc_state_->shared.block_ctx_map);
@@ -582,8 +584,10 @@ class LossyFrameEncoder {
 
     enc_state_->coeffs.clear();
     while (enc_state_->coeffs.size() < enc_state_->passes.size()) {
-      enc_state_->coeffs.emplace_back(make_unique<ACImageT<int32_t>>(
-          kGroupDim * kGroupDim, frame_dim.num_groups));
+      auto coeffs = make_unique<ACImageT<int32_t>>(kGroupDim * kGroupDim,
+                                                   frame_dim.num_groups);
+      JXL_RETURN_IF_ERROR(coeffs->FirstTouch(pool_));
+      enc_state_->coeffs.emplace_back(std::move(coeffs));
     }
 
     // convert JPEG quantization table to a Quantizer object
@@ -884,7 +888,9 @@ class LossyFrameEncoder {
     shared.num_histograms = 1;
 
     const auto tokenize_group_init = [&](const size_t num_threads) {
-      group_caches_.resize(num_threads);
+      if (enc_state_->group_caches.size() < num_threads) {
+        enc_state_->group_caches.resize(num_threads);
+      }
       return true;
     };
     const auto tokenize_group = [&](const uint32_t group_index,
@@ -900,11 +906,11 @@ class LossyFrameEncoder {
             enc_state_->coeffs[idx_pass]->PlaneRow(2, group_index, 0).ptr32,
         };
         // Ensure group cache is initialized.
-        group_caches_[thread].InitOnce();
+        enc_state_->group_caches[thread].InitOnce();
         TokenizeCoefficients(
             &shared.coeff_orders[idx_pass * shared.coeff_order_size], rect,
             ac_rows, shared.ac_strategy, frame_header->chroma_subsampling,
-            &group_caches_[thread].num_nzeroes,
+            &enc_state_->group_caches[thread].num_nzeroes,
             &enc_state_->passes[idx_pass].ac_tokens[group_index],
             enc_state_->shared.quant_dc, enc_state_->shared.raw_quant_field,
             enc_state_->shared.block_ctx_map);
@@ -1031,7 +1037,6 @@ class LossyFrameEncoder {
   JxlCmsInterface cms_;
   ThreadPool* pool_;
   AuxOut* aux_out_;
-  std::vector<EncCache> group_caches_;
   bool doing_jpeg_recompression = false;
 };
 
@@ -1070,6 +1075,20 @@ Status EncodeFrame(const CompressParams& cparams_orig,
                    const ImageBundle& ib, PassesEncoderState* passes_enc_state,
                    const JxlCmsInterface& cms, ThreadPool* pool,
                    BitWriter* writer, AuxOut* aux_out) {
+  std::vector<BitWriter> group_codes;
+  JXL_RETURN_IF_ERROR(EncodeFrame(cparams_orig, frame_info, metadata, ib,
+                                  passes_enc_state, cms, pool, writer,
+                                  &group_codes, aux_out));
+  writer->AppendByteAligned(group_codes);
+  return true;
+}
+
+Status EncodeFrame(const CompressParams& cparams_orig,
+                   const FrameInfo& frame_info, const CodecMetadata* metadata,
+                   const ImageBundle& ib, PassesEncoderState* passes_enc_state,
+                   const JxlCmsInterface& cms, ThreadPool* pool,
+                   BitWriter* writer, std::vector<BitWriter>* group_codes_out,
+                   AuxOut* aux_out) {
   CompressParams cparams = cparams_orig;
   if (cparams.speed_tier == SpeedTier::kGlacier && !cparams.IsLossless()) {
     cparams.speed_tier = SpeedTier::kTortoise;
@@ -1122,6 +1141,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
     JXL_RETURN_IF_ERROR(RunOnPool(
         pool, 0, all_params.size(), ThreadPool::NoInit,
         [&](size_t task, size_t) {
+          if (!CheckCancelled(pool)) return;
           BitWriter w;
           PassesEncoderState state;
           if (!EncodeFrame(all_params[task], frame_info, metadata, ib, &state,
@@ -1132,6 +1152,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
           size[task] = w.BitsWritten();
         },
         "Compress kGlacier"));
+    JXL_RETURN_IF_ERROR(CheckCancelled(pool));
     JXL_RETURN_IF_ERROR(num_errors.load(std::memory_order_relaxed) == 0);
 
     size_t best_idx = 0;
@@ -1145,6 +1166,11 @@ Status EncodeFrame(const CompressParams& cparams_orig,
 
   ib.VerifyMetadata();
 
+  // The VarDCT heuristics take their per-thread scratch from the pool, so use
+  // a sequential one when no pool was given.
+  ThreadPool sequential_pool(nullptr, nullptr);
+  if (pool == nullptr) pool = &sequential_pool;
+
   passes_enc_state->special_frames.clear();
 
   if (cparams.qprogressive_mode) {
@@ -1268,9 +1294,8 @@ Status EncodeFrame(const CompressParams& cparams_orig,
                  cparams, ib) ||
              frame_header->encoding != FrameEncoding::kVarDCT) {
     // Allocating a large enough image avoids a copy when padding.
-    opsin =
-        Image3F(RoundUpToBlockDim(ib.xsize()), RoundUpToBlockDim(ib.ysize()));
-    opsin.ShrinkTo(ib.xsize(), ib.ysize());
+    JXL_RETURN_IF_ERROR(AllocateOpsin(ib.xsize(), ib.ysize(), pool,
+                                      passes_enc_state, &opsin));
 
     const bool want_linear = frame_header->encoding == FrameEncoding::kVarDCT &&
                              cparams.speed_tier <= SpeedTier::kKitten;
@@ -1326,11 +1351,14 @@ Status EncodeFrame(const CompressParams& cparams_orig,
       extra_channels_storage.emplace_back(std::move(d_ec));
     }
   }
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool));
   // needs to happen *AFTER* VarDCT-ComputeEncodingData.
   JXL_RETURN_IF_ERROR(modular_frame_encoder->ComputeEncodingData(
       *frame_header, *ib.metadata(), &opsin, *extra_channels,
       lossy_frame_encoder.State(), cms, pool, aux_out,
       /* do_color=*/frame_header->encoding == FrameEncoding::kModular));
+  RecycleOpsin(ib.xsize(), ib.ysize(), passes_enc_state, &opsin);
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool));
 
   writer->AppendByteAligned(lossy_frame_encoder.State()->special_frames);
   frame_header->UpdateFlag(
@@ -1400,6 +1428,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
 
   const auto process_dc_group = [&](const uint32_t group_index,
                                     const size_t thread) {
+    if (!CheckCancelled(pool)) return;
     AuxOut* my_aux_out = aux_out ? &aux_outs[thread] : nullptr;
     BitWriter* output = get_output(group_index + 1);
     if (frame_header->encoding == FrameEncoding::kVarDCT &&
@@ -1432,6 +1461,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
   JXL_RETURN_IF_ERROR(RunOnPool(pool, 0, frame_dim.num_dc_groups,
                                 resize_aux_outs, process_dc_group,
                                 "EncodeDCGroup"));
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool));
 
   if (frame_header->encoding == FrameEncoding::kVarDCT) {
     JXL_RETURN_IF_ERROR(lossy_frame_encoder.EncodeGlobalACInfo(
@@ -1441,6 +1471,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
   std::atomic<int> num_errors{0};
   const auto process_group = [&](const uint32_t group_index,
                                  const size_t thread) {
+    if (!CheckCancelled(pool)) return;
     AuxOut* my_aux_out = aux_out ? &aux_outs[thread] : nullptr;
 
     for (size_t i = 0; i < num_passes; i++) {
@@ -1465,6 +1496,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
 
   // Resizing aux_outs to 0 also Assimilates the array.
   static_cast<void>(resize_aux_outs(0));
+  JXL_RETURN_IF_ERROR(CheckCancelled(pool));
   JXL_RETURN_IF_ERROR(num_errors.load(std::memory_order_relaxed) == 0);
 
   for (BitWriter& bw : group_codes) {
@@ -1551,7 +1583,7 @@ Status EncodeFrame(const CompressParams& cparams_orig,
 
   JXL_RETURN_IF_ERROR(
       WriteGroupOffsets(group_codes, permutation_ptr, writer, aux_out));
-  writer->AppendByteAligned(group_codes);
+  *group_codes_out = std::move(group_codes);
 
   return true;
 }
@@ -6,6 +6,8 @@
 #ifndef LIB_JXL_ENC_FRAME_H_
 #define LIB_JXL_ENC_FRAME_H_
 
+#include <vector>
+
 #include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/enc_bit_writer.h"
@@ -73,6 +75,18 @@ Status EncodeFrame(const CompressParams& cparams_orig,
                    const JxlCmsInterface& cms, ThreadPool* pool,
                    BitWriter* writer, AuxOut* aux_out);
 
+// Same as above, but leaves the sections of the frame that follow the TOC in
+// `group_codes`, in bitstream order, instead of appending them to `writer`.
+// The frame is the concatenation of `writer` and all of `group_codes`; this
+// lets the caller output the sections without first copying them into one
+// buffer.
+Status EncodeFrame(const CompressParams& cparams_orig,
+                   const FrameInfo& frame_info, const CodecMetadata* metadata,
+                   const ImageBundle& ib, PassesEncoderState* passes_enc_state,
+                   const JxlCmsInterface& cms, ThreadPool* pool,
+                   BitWriter* writer, std::vector<BitWriter>* group_codes,
+                   AuxOut* aux_out);
+
 }  // namespace jxl
 
 #endif  // LIB_JXL_ENC_FRAME_H_
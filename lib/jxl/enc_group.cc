@@ -33,10 +33,14 @@ namespace HWY_NAMESPACE {
 
 // These templates are not found via ADL.
 using hwy::HWY_NAMESPACE::Abs;
+using hwy::HWY_NAMESPACE::Eq;
 using hwy::HWY_NAMESPACE::Ge;
 using hwy::HWY_NAMESPACE::IfThenElse;
 using hwy::HWY_NAMESPACE::IfThenElseZero;
+using hwy::HWY_NAMESPACE::IfThenZeroElse;
 using hwy::HWY_NAMESPACE::MaskFromVec;
+using hwy::HWY_NAMESPACE::Max;
+using hwy::HWY_NAMESPACE::Ne;
 using hwy::HWY_NAMESPACE::Round;
 
 // NOTE: caller takes care of extracting quant from rect of RawQuantField.
@@ -86,6 +90,86 @@ void QuantizeBlockAC(const Quantizer& quantizer, const bool error_diffusion,
   }
 }
 
+void ComputeBlockACStats(size_t c, const float* JXL_RESTRICT qm, float qac,
+                         float qm_multiplier, size_t xsize, size_t ysize,
+                         const float* thresholds,
+                         const float* JXL_RESTRICT block_in,
+                         BlockACStats* stats) {
+  // Gathers the statistics of the quantized block, skipping the LLF
+  // coefficients. Rows are a multiple of kBlockDim long, so vectors never
+  // straddle two rows; lanes are assigned to the left or right half of the
+  // block (and to the high-frequency corner) via masks.
+  HWY_CAPPED(float, kBlockDim) df;
+  // Same rounding as the scalar qm[pos] * qac * qm_multiplier.
+  const auto qacv = Set(df, qac);
+  const auto qm_multiplierv = Set(df, qm_multiplier);
+  const auto half_x = Set(df, static_cast<float>(xsize * kBlockDim / 2));
+  const auto zero = Zero(df);
+  auto sum_of_corner_v = Zero(df);
+  auto sum_of_error_v = Zero(df);
+  auto sum_of_vals_v = Zero(df);
+  for (size_t yfix = 0; yfix < 4; yfix += 2) {
+    const auto thr_left = Set(df, thresholds[yfix]);
+    const auto thr_right = Set(df, thresholds[yfix + 1]);
+    auto nonzeros_left = Zero(df);
+    auto nonzeros_right = Zero(df);
+    auto max_error_left = Zero(df);
+    auto max_error_right = Zero(df);
+    const size_t y_begin = yfix / 2 * ysize * kBlockDim / 2;
+    const size_t y_end = y_begin + ysize * kBlockDim / 2;
+    for (size_t y = y_begin; y < y_end; y++) {
+      const size_t off = y * kBlockDim * xsize;
+      // Lanes before this column are LLF coefficients.
+      const auto first_x = Set(df, static_cast<float>(y < ysize ? xsize : 0));
+      // Lanes from this column on are either in the highest frequency corner
+      // (y >= 7 * ysize, x >= 7 * xsize) or on the last row or column of the
+      // larger corner (x >= 4 * xsize, y >= 4 * ysize).
+      size_t corner_x = xsize * kBlockDim;
+      if (y == ysize * kBlockDim - 1) {
+        corner_x = 4 * xsize;
+      } else if (y >= 7 * ysize) {
+        corner_x = 7 * xsize;
+      } else if (y >= 4 * ysize) {
+        corner_x = xsize * kBlockDim - 1;
+      }
+      const auto corner_xv = Set(df, static_cast<float>(corner_x));
+      for (size_t x = 0; x < xsize * kBlockDim; x += Lanes(df)) {
+        const auto xv = Iota(df, static_cast<float>(x));
+        const auto right = Ge(xv, half_x);
+        const auto thr = IfThenElse(right, thr_right, thr_left);
+        const auto q = Mul(Mul(Load(df, qm + off + x), qacv), qm_multiplierv);
+        const auto val = Mul(Load(df, block_in + off + x), q);
+        const auto v = IfThenElseZero(Ge(Abs(val), thr), Round(val));
+        const auto valid = Ge(xv, first_x);
+        const auto error = IfThenElseZero(valid, Abs(Sub(val, v)));
+        const auto abs_v = IfThenElseZero(valid, Abs(v));
+        sum_of_error_v = Add(sum_of_error_v, error);
+        sum_of_vals_v = Add(sum_of_vals_v, abs_v);
+        nonzeros_left = Add(nonzeros_left, IfThenZeroElse(right, abs_v));
+        nonzeros_right = Add(nonzeros_right, IfThenElseZero(right, abs_v));
+        if (c == 1) {
+          const auto zero_error = IfThenElseZero(Eq(v, zero), error);
+          max_error_left =
+              Max(max_error_left, IfThenZeroElse(right, zero_error));
+          max_error_right =
+              Max(max_error_right, IfThenElseZero(right, zero_error));
+        }
+        const auto nonzero_val = IfThenElseZero(Ne(v, zero), Abs(val));
+        sum_of_corner_v = Add(sum_of_corner_v,
+                              IfThenElseZero(Ge(xv, corner_xv), nonzero_val));
+      }
+    }
+    stats->hf_non_zeros[yfix] = GetLane(SumOfLanes(df, nonzeros_left));
+    stats->hf_non_zeros[yfix + 1] = GetLane(SumOfLanes(df, nonzeros_right));
+    stats->hf_max_error[yfix] = GetLane(MaxOfLanes(df, max_error_left));
+    stats->hf_max_error[yfix + 1] = GetLane(MaxOfLanes(df, max_error_right));
+  }
+  stats->sum_of_highest_freq_row_and_column =
+      GetLane(SumOfLanes(df, sum_of_corner_v));
+  stats->sum_of_error = GetLane(SumOfLanes(df, sum_of_error_v));
+  stats->sum_of_vals = GetLane(SumOfLanes(df, sum_of_vals_v));
+}
+
 void AdjustQuantBlockAC(const Quantizer& quantizer, size_t c,
                         float qm_multiplier, size_t quant_kind, size_t xsize,
                         size_t ysize, float* thresholds,
@@ -114,42 +198,15 @@ void AdjustQuantBlockAC(const Quantizer& quantizer, size_t c,
       }
     }
   }
-  float sum_of_highest_freq_row_and_column = 0;
-  float sum_of_error = 0;
-  float sum_of_vals = 0;
-  float hfNonZeros[4] = {};
-  float hfMaxError[4] = {};
-
-  for (size_t y = 0; y < ysize * kBlockDim; y++) {
-    for (size_t x = 0; x < xsize * kBlockDim; x++) {
-      const size_t pos = y * kBlockDim * xsize + x;
-      if (x < xsize && y < ysize) {
-        continue;
-      }
-      const size_t hfix = (static_cast<size_t>(y >= ysize * kBlockDim / 2) * 2 +
-                           static_cast<size_t>(x >= xsize * kBlockDim / 2));
-      const float val = block_in[pos] * (qm[pos] * qac * qm_multiplier);
-      const float v = (std::abs(val) < thresholds[hfix]) ? 0 : rintf(val);
-      const float error = std::abs(val - v);
-      sum_of_error += error;
-      sum_of_vals += std::abs(v);
-      if (c == 1 && v == 0) {
-        if (hfMaxError[hfix] < error) {
-          hfMaxError[hfix] = error;
-        }
-      }
-      if (v != 0.0f) {
-        hfNonZeros[hfix] += std::abs(v);
-        bool in_corner = y >= 7 * ysize && x >= 7 * xsize;
-        bool on_border =
-            y == ysize * kBlockDim - 1 || x == xsize * kBlockDim - 1;
-        bool in_larger_corner = x >= 4 * xsize && y >= 4 * ysize;
-        if (in_corner || (on_border && in_larger_corner)) {
-          sum_of_highest_freq_row_and_column += std::abs(val);
-        }
-      }
-    }
-  }
+  BlockACStats stats;
+  ComputeBlockACStats(c, qm, qac, qm_multiplier, xsize, ysize, thresholds,
+                      block_in, &stats);
+  const float sum_of_highest_freq_row_and_column =
+      stats.sum_of_highest_freq_row_and_column;
+  float sum_of_error = stats.sum_of_error;
+  float sum_of_vals = stats.sum_of_vals;
+  const float* hfNonZeros = stats.hf_non_zeros;
+  const float* hfMaxError = stats.hf_max_error;
   if (c == 1 && sum_of_vals * 8 < xsize * ysize) {
     static const double kLimit[4] = {
         0.46,
@@ -357,7 +414,8 @@ void QuantizeRoundtripYBlockAC(PassesEncoderState* enc_state, const size_t size,
 }
 
 void ComputeCoefficients(size_t group_idx, PassesEncoderState* enc_state,
-                         const Image3F& opsin, Image3F* dc) {
+                         const Image3F& opsin, Image3F* dc, ThreadPool* pool,
+                         size_t thread) {
   const Rect block_group_rect = enc_state->shared.BlockGroupRect(group_idx);
   const Rect group_rect = enc_state->shared.GroupRect(group_idx);
   const Rect cmap_rect(
@@ -379,11 +437,12 @@ void ComputeCoefficients(size_t group_idx, PassesEncoderState* enc_state,
       3 * (MaxVectorSize() / sizeof(float)) * AcStrategy::kMaxBlockDim;
 
   // TODO(veluca): consider strategies to reduce this memory.
-  auto mem = hwy::AllocateAligned<int32_t>(3 * AcStrategy::kMaxCoeffArea);
-  auto fmem = hwy::AllocateAligned<float>(5 * AcStrategy::kMaxCoeffArea +
-                                          dct_scratch_size);
-  float* JXL_RESTRICT scratch_space =
-      fmem.get() + 3 * AcStrategy::kMaxCoeffArea;
+  int32_t* mem =
+      pool->Scratch<int32_t>(thread, 1, 3 * AcStrategy::kMaxCoeffArea);
+  float* fmem = pool->Scratch<float>(
+      thread, 0, 5 * AcStrategy::kMaxCoeffArea + dct_scratch_size);
+  JXL_CHECK(mem != nullptr && fmem != nullptr);
+  float* JXL_RESTRICT scratch_space = fmem + 3 * AcStrategy::kMaxCoeffArea;
   {
     // Only use error diffusion in Squirrel mode or slower.
     const bool error_diffusion = cparams.speed_tier <= SpeedTier::kSquirrel;
@@ -400,8 +459,8 @@ void ComputeCoefficients(size_t group_idx, PassesEncoderState* enc_state,
       }
     }
 
-    HWY_ALIGN float* coeffs_in = fmem.get();
-    HWY_ALIGN int32_t* quantized = mem.get();
+    HWY_ALIGN float* coeffs_in = fmem;
+    HWY_ALIGN int32_t* quantized = mem;
 
     for (size_t by = 0; by < ysize_blocks; ++by) {
       int32_t* JXL_RESTRICT row_quant_ac =
@@ -501,11 +560,22 @@ HWY_AFTER_NAMESPACE();
 
 #if HWY_ONCE
 namespace jxl {
+HWY_EXPORT(ComputeBlockACStats);
+void ComputeBlockACStats(size_t c, const float* JXL_RESTRICT qm, float qac,
+                         float qm_multiplier, size_t xsize, size_t ysize,
+                         const float* thresholds,
+                         const float* JXL_RESTRICT block_in,
+                         BlockACStats* stats) {
+  return HWY_DYNAMIC_DISPATCH(ComputeBlockACStats)(
+      c, qm, qac, qm_multiplier, xsize, ysize, thresholds, block_in, stats);
+}
+
 HWY_EXPORT(ComputeCoefficients);
 void ComputeCoefficients(size_t group_idx, PassesEncoderState* enc_state,
-                         const Image3F& opsin, Image3F* dc) {
+                         const Image3F& opsin, Image3F* dc, ThreadPool* pool,
+                         size_t thread) {
   return HWY_DYNAMIC_DISPATCH(ComputeCoefficients)(group_idx, enc_state, opsin,
-                                                   dc);
+                                                   dc, pool, thread);
 }
 
 Status EncodeGroupTokenizedCoefficients(size_t group_idx, size_t pass_idx,
@@ -9,6 +9,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "lib/jxl/base/compiler_specific.h"
+#include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/enc_bit_writer.h"
 #include "lib/jxl/image.h"
@@ -18,9 +20,34 @@ namespace jxl {
 struct AuxOut;
 struct PassesEncoderState;
 
-// Fills DC
+// Statistics of the AC coefficients of a block after quantization, which drive
+// the adjustment of its quantization field. Quadrants are indexed by
+// 2 * (in bottom half) + (in right half); the maximum errors are only
+// gathered for the Y channel (c == 1).
+struct BlockACStats {
+  float sum_of_highest_freq_row_and_column = 0;
+  float sum_of_error = 0;
+  float sum_of_vals = 0;
+  float hf_non_zeros[4] = {};
+  float hf_max_error[4] = {};
+};
+
+// Computes the statistics of the block of xsize * ysize 8x8 blocks with
+// coefficients `block_in`, quantized with the inverse quantization matrix
+// `qm` times `qac` times `qm_multiplier` and the dead zone `thresholds` of
+// each quadrant. The LLF coefficients are skipped. Both arrays must be
+// vector-aligned.
+void ComputeBlockACStats(size_t c, const float* JXL_RESTRICT qm, float qac,
+                         float qm_multiplier, size_t xsize, size_t ysize,
+                         const float* thresholds,
+                         const float* JXL_RESTRICT block_in,
+                         BlockACStats* stats);
+
+// Fills DC. Working memory comes from the scratch of `thread` in `pool`, which
+// must be the pool running this call.
 void ComputeCoefficients(size_t group_idx, PassesEncoderState* enc_state,
-                         const Image3F& opsin, Image3F* dc);
+                         const Image3F& opsin, Image3F* dc, ThreadPool* pool,
+                         size_t thread);
 
 Status EncodeGroupTokenizedCoefficients(size_t group_idx, size_t pass_idx,
                                         size_t histogram_idx,
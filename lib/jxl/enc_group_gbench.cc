@@ -0,0 +1,46 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <hwy/aligned_allocator.h>
+
+#include "benchmark/benchmark.h"
+#include "lib/jxl/ac_strategy.h"
+#include "lib/jxl/base/random.h"
+#include "lib/jxl/enc_group.h"
+
+namespace jxl {
+namespace {
+
+// Statistics pass of the encoder's quantization adjustment, for one block of
+// the AC strategy given as argument.
+void BM_BlockACStats(benchmark::State& state) {
+  const AcStrategy acs =
+      AcStrategy::FromRawStrategy(static_cast<uint8_t>(state.range(0)));
+  const size_t xsize = acs.covered_blocks_x();
+  const size_t ysize = acs.covered_blocks_y();
+  const size_t size = xsize * ysize * kDCTBlockSize;
+  auto qm = hwy::AllocateAligned<float>(size);
+  auto block = hwy::AllocateAligned<float>(size);
+  Rng rng(0);
+  for (size_t i = 0; i < size; i++) {
+    qm[i] = rng.UniformF(0.5f, 1.5f);
+    block[i] = rng.UniformF(-1.0f, 1.0f);
+  }
+  const float thresholds[4] = {0.58f, 0.64f, 0.64f, 0.64f};
+  for (auto _ : state) {
+    BlockACStats stats;
+    ComputeBlockACStats(/*c=*/1, qm.get(), /*qac=*/1.0f,
+                        /*qm_multiplier=*/1.0f, xsize, ysize, thresholds,
+                        block.get(), &stats);
+    benchmark::DoNotOptimize(stats);
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK(BM_BlockACStats)
+    ->DenseRange(0, AcStrategy::Type::kNumValidStrategies - 1);
+
+}  // namespace
+}  // namespace jxl
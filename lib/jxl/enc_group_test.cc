@@ -0,0 +1,128 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "lib/jxl/enc_group.h"
+
+#include <algorithm>
+#include <cmath>
+#include <hwy/aligned_allocator.h>
+#include <hwy/tests/hwy_gtest.h>
+
+#include "lib/jxl/ac_strategy.h"
+#include "lib/jxl/base/random.h"
+#include "lib/jxl/testing.h"
+
+namespace jxl {
+namespace {
+
+// The statistics loop of AdjustQuantBlockAC before it was vectorized.
+void ReferenceBlockACStats(size_t c, const float* qm, float qac,
+                           float qm_multiplier, size_t xsize, size_t ysize,
+                           const float* thresholds, const float* block_in,
+                           BlockACStats* stats) {
+  float sum_of_highest_freq_row_and_column = 0;
+  float sum_of_error = 0;
+  float sum_of_vals = 0;
+  float hfNonZeros[4] = {};
+  float hfMaxError[4] = {};
+
+  for (size_t y = 0; y < ysize * kBlockDim; y++) {
+    for (size_t x = 0; x < xsize * kBlockDim; x++) {
+      const size_t pos = y * kBlockDim * xsize + x;
+      if (x < xsize && y < ysize) {
+        continue;
+      }
+      const size_t hfix = (static_cast<size_t>(y >= ysize * kBlockDim / 2) * 2 +
+                           static_cast<size_t>(x >= xsize * kBlockDim / 2));
+      const float val = block_in[pos] * (qm[pos] * qac * qm_multiplier);
+      const float v = (std::abs(val) < thresholds[hfix]) ? 0 : rintf(val);
+      const float error = std::abs(val - v);
+      sum_of_error += error;
+      sum_of_vals += std::abs(v);
+      if (c == 1 && v == 0) {
+        if (hfMaxError[hfix] < error) {
+          hfMaxError[hfix] = error;
+        }
+      }
+      if (v != 0.0f) {
+        hfNonZeros[hfix] += std::abs(v);
+        bool in_corner = y >= 7 * ysize && x >= 7 * xsize;
+        bool on_border =
+            y == ysize * kBlockDim - 1 || x == xsize * kBlockDim - 1;
+        bool in_larger_corner = x >= 4 * xsize && y >= 4 * ysize;
+        if (in_corner || (on_border && in_larger_corner)) {
+          sum_of_highest_freq_row_and_column += std::abs(val);
+        }
+      }
+    }
+  }
+  stats->sum_of_highest_freq_row_and_column =
+      sum_of_highest_freq_row_and_column;
+  stats->sum_of_error = sum_of_error;
+  stats->sum_of_vals = sum_of_vals;
+  std::copy(hfNonZeros, hfNonZeros + 4, stats->hf_non_zeros);
+  std::copy(hfMaxError, hfMaxError + 4, stats->hf_max_error);
+}
+
+// The quantized values are bit-exact with the scalar loop; the sums of
+// non-integer values only differ by summation order, which changes the
+// encoder output by float rounding at most.
+class BlockACStatsTest : public ::hwy::TestWithParamTargetAndT<int> {
+ protected:
+  void Run() {
+    const AcStrategy acs =
+        AcStrategy::FromRawStrategy(static_cast<uint8_t>(GetParam()));
+    const size_t xsize = acs.covered_blocks_x();
+    const size_t ysize = acs.covered_blocks_y();
+    const size_t size = xsize * ysize * kDCTBlockSize;
+    auto qm = hwy::AllocateAligned<float>(size);
+    auto block = hwy::AllocateAligned<float>(size);
+    Rng rng(GetParam() * 65537 + 7);
+    for (size_t i = 0; i < size; i++) {
+      qm[i] = rng.UniformF(0.5f, 1.5f);
+    }
+    const float thresholds[4] = {0.58f, 0.64f, 0.6f, 0.7f};
+    for (size_t c = 0; c < 3; c++) {
+      // From almost empty to dense blocks.
+      for (float scale : {0.3f, 1.0f, 4.0f}) {
+        for (size_t i = 0; i < size; i++) {
+          block[i] = rng.UniformF(-scale, scale);
+        }
+        const float qac = 0.37f * 3;
+        const float qm_multiplier = c == 1 ? 1.0f : 0.93f;
+        BlockACStats expected;
+        ReferenceBlockACStats(c, qm.get(), qac, qm_multiplier, xsize, ysize,
+                              thresholds, block.get(), &expected);
+        BlockACStats actual;
+        ComputeBlockACStats(c, qm.get(), qac, qm_multiplier, xsize, ysize,
+                            thresholds, block.get(), &actual);
+        const auto tolerance = [](float value) {
+          return 1e-3f + 1e-4f * std::abs(value);
+        };
+        EXPECT_NEAR(expected.sum_of_error, actual.sum_of_error,
+                    tolerance(expected.sum_of_error));
+        EXPECT_NEAR(expected.sum_of_highest_freq_row_and_column,
+                    actual.sum_of_highest_freq_row_and_column,
+                    tolerance(expected.sum_of_highest_freq_row_and_column));
+        // Sums of integers do not depend on the order, maxima only on the
+        // contraction of the error computation.
+        EXPECT_EQ(expected.sum_of_vals, actual.sum_of_vals);
+        for (size_t i = 0; i < 4; i++) {
+          EXPECT_EQ(expected.hf_non_zeros[i], actual.hf_non_zeros[i]);
+          EXPECT_NEAR(expected.hf_max_error[i], actual.hf_max_error[i], 1e-6);
+        }
+      }
+    }
+  }
+};
+
+HWY_TARGET_INSTANTIATE_TEST_SUITE_P_T(
+    BlockACStatsTest,
+    ::testing::Range(0, int(AcStrategy::Type::kNumValidStrategies)));
+
+TEST_P(BlockACStatsTest, MatchesScalar) { Run(); }
+
+}  // namespace
+}  // namespace jxl
@@ -25,6 +25,7 @@
 #include "lib/jxl/enc_quant_weights.h"
 #include "lib/jxl/enc_splines.h"
 #include "lib/jxl/enc_xyb.h"
+#include "lib/jxl/image_ops.h"
 
 namespace jxl {
 
@@ -175,7 +176,7 @@ void FindBestDequantMatrices(const CompressParams& cparams,
                              DequantMatrices* dequant_matrices) {
   // TODO(veluca): quant matrices for no-gaborish.
   // TODO(veluca): heuristics for in-bitstream quant tables.
-  *dequant_matrices = DequantMatrices();
+  dequant_matrices->ResetToDefault();
   if (cparams.max_error_mode) {
     // Set numerators of all quantization matrices to constant values.
     float weights[3][1] = {{1.0f / cparams.max_error[0]},
@@ -817,9 +818,9 @@ Status DefaultEncoderHeuristics::LossyFrameHeuristics(
 
   if (!opsin->xsize()) {
     JXL_ASSERT(HandlesColorConversion(cparams, *original_pixels));
-    *opsin = Image3F(RoundUpToBlockDim(original_pixels->xsize()),
-                     RoundUpToBlockDim(original_pixels->ysize()));
-    opsin->ShrinkTo(original_pixels->xsize(), original_pixels->ysize());
+    JXL_RETURN_IF_ERROR(AllocateOpsin(original_pixels->xsize(),
+                                      original_pixels->ysize(), pool,
+                                      enc_state, opsin));
     ToXYB(*original_pixels, pool, opsin, cms, /*linear=*/nullptr);
     PadImageToBlockMultipleInPlace(opsin);
   }
@@ -887,12 +888,12 @@ Status DefaultEncoderHeuristics::LossyFrameHeuristics(
       cfl_heuristics.ComputeTile(r, *opsin, enc_state->shared.matrices,
                                  /*ac_strategy=*/nullptr,
                                  /*raw_quant_field=*/nullptr,
-                                 /*quantizer=*/nullptr, /*fast=*/false, thread,
-                                 &enc_state->shared.cmap);
+                                 /*quantizer=*/nullptr, /*fast=*/false, pool,
+                                 thread, &enc_state->shared.cmap);
     }
 
     // Choose block sizes.
-    acs_heuristics.ProcessRect(r);
+    acs_heuristics.ProcessRect(r, pool, thread);
 
     // Choose amount of post-processing smoothing.
     // TODO(veluca): should this go *after* AdjustQuantField?
@@ -913,7 +914,7 @@ Status DefaultEncoderHeuristics::LossyFrameHeuristics(
       cfl_heuristics.ComputeTile(
           r, *opsin, enc_state->shared.matrices, &enc_state->shared.ac_strategy,
           &enc_state->shared.raw_quant_field, &enc_state->shared.quantizer,
-          /*fast=*/cparams.speed_tier >= SpeedTier::kWombat, thread,
+          /*fast=*/cparams.speed_tier >= SpeedTier::kWombat, pool, thread,
           &enc_state->shared.cmap);
     }
   };
@@ -924,7 +925,6 @@ Status DefaultEncoderHeuristics::LossyFrameHeuristics(
                   kEncTileDimInBlocks),
       [&](const size_t num_threads) {
         ar_heuristics.PrepareForThreads(num_threads);
-        cfl_heuristics.PrepareForThreads(num_threads);
         return true;
       },
       process_tile, "Enc Heuristics"));
@@ -936,7 +936,8 @@ Status DefaultEncoderHeuristics::LossyFrameHeuristics(
   }
 
   // Refine quantization levels.
-  FindBestQuantizer(original_pixels, *opsin, enc_state, cms, pool, aux_out);
+  JXL_RETURN_IF_ERROR(FindBestQuantizer(original_pixels, *opsin, enc_state,
+                                        cms, pool, aux_out));
 
   // Choose a context model that depends on the amount of quantization for AC.
   if (cparams.speed_tier < SpeedTier::kFalcon) {
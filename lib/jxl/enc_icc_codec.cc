@@ -11,15 +11,107 @@
 #include <string>
 #include <vector>
 
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "lib/jxl/enc_icc_codec.cc"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
 #include "lib/jxl/base/byte_order.h"
 #include "lib/jxl/enc_ans.h"
 #include "lib/jxl/enc_aux_out.h"
 #include "lib/jxl/fields.h"
 #include "lib/jxl/icc_codec_common.h"
 
+HWY_BEFORE_NAMESPACE();
 namespace jxl {
+namespace HWY_NAMESPACE {
 namespace {
 
+// These templates are not found via ADL.
+using hwy::HWY_NAMESPACE::Add;
+using hwy::HWY_NAMESPACE::And;
+using hwy::HWY_NAMESPACE::BitCast;
+using hwy::HWY_NAMESPACE::Or;
+using hwy::HWY_NAMESPACE::Repartition;
+using hwy::HWY_NAMESPACE::ShiftLeft;
+using hwy::HWY_NAMESPACE::ShiftRight;
+using hwy::HWY_NAMESPACE::Sub;
+using hwy::HWY_NAMESPACE::Vec;
+
+// Converts lanes between big-endian and native byte order.
+template <class D>
+JXL_INLINE Vec<D> SwapBytes(D /* d */, hwy::SizeTag<1> /* tag */, Vec<D> v) {
+  return v;
+}
+
+template <class D>
+JXL_INLINE Vec<D> SwapBytes(D /* d */, hwy::SizeTag<2> /* tag */, Vec<D> v) {
+  return Or(ShiftLeft<8>(v), ShiftRight<8>(v));
+}
+
+template <class D>
+JXL_INLINE Vec<D> SwapBytes(D d, hwy::SizeTag<4> /* tag */, Vec<D> v) {
+  const auto mask = Set(d, 0x00FF00FFu);
+  v = Or(ShiftLeft<8>(And(v, mask)), And(ShiftRight<8>(v), mask));
+  return Or(ShiftLeft<16>(v), ShiftRight<16>(v));
+}
+
+// Vector part of LinearPredictICC for integers of type T; returns the number
+// of bytes handled. Predictions are computed in the lane type, which matches
+// the prediction modulo 2^32 in the low sizeof(T) bytes; the encoder predicts
+// from the profile itself, so the vectors are independent.
+template <typename T>
+size_t LinearPredictICCVector(const uint8_t* data, size_t start, size_t num,
+                              size_t stride, int order, uint8_t* residuals) {
+  const HWY_FULL(T) d;
+  const Repartition<uint8_t, decltype(d)> d8;
+  const hwy::SizeTag<sizeof(T)> tag;
+  const size_t N = Lanes(d8);
+  size_t i = 0;
+  for (; i + N <= num; i += N) {
+    const uint8_t* p = data + start + i;
+    const auto p1 = SwapBytes(d, tag, BitCast(d, LoadU(d8, p - stride)));
+    auto predicted = p1;
+    if (order == 1) {
+      const auto p2 = SwapBytes(d, tag, BitCast(d, LoadU(d8, p - stride * 2)));
+      predicted = Sub(Add(p1, p1), p2);
+    } else if (order == 2) {
+      const auto p2 = SwapBytes(d, tag, BitCast(d, LoadU(d8, p - stride * 2)));
+      const auto p3 = SwapBytes(d, tag, BitCast(d, LoadU(d8, p - stride * 3)));
+      const auto diff = Sub(p1, p2);
+      predicted = Add(Add(Add(diff, diff), diff), p3);
+    } else if (order != 0) {
+      predicted = Zero(d);
+    }
+    StoreU(Sub(LoadU(d8, p), BitCast(d8, SwapBytes(d, tag, predicted))), d8,
+           residuals + i);
+  }
+  return i;
+}
+
+// De-interleaves Lanes(d) rows of the matrix described at Unshuffle.
+template <class D>
+JXL_INLINE void UnshuffleRows(D d, hwy::SizeTag<2> /* tag */,
+                              const uint8_t* rows, size_t height,
+                              uint8_t* result) {
+  Vec<D> v0, v1;
+  LoadInterleaved2(d, rows, v0, v1);
+  StoreU(v0, d, result);
+  StoreU(v1, d, result + height);
+}
+
+template <class D>
+JXL_INLINE void UnshuffleRows(D d, hwy::SizeTag<4> /* tag */,
+                              const uint8_t* rows, size_t height,
+                              uint8_t* result) {
+  Vec<D> v0, v1, v2, v3;
+  LoadInterleaved4(d, rows, v0, v1, v2, v3);
+  StoreU(v0, d, result);
+  StoreU(v1, d, result + height);
+  StoreU(v2, d, result + 2 * height);
+  StoreU(v3, d, result + 3 * height);
+}
+
 // Unshuffles or de-interleaves bytes, for example with width 2, turns
 // "AaBbCcDc" into "ABCDabcd", this for example de-interleaves UTF-16 bytes into
 // first all the high order bytes, then all the low order bytes.
@@ -30,20 +122,84 @@ namespace {
 // elements at the bottom of the rightmost column. The input is the input matrix
 // in scanline order, the output is the result matrix in scanline order, with
 // missing elements skipped over (this may occur at multiple positions).
-void Unshuffle(uint8_t* data, size_t size, size_t width) {
-  size_t height = (size + width - 1) / width;  // amount of rows of input
-  PaddedBytes result(size);
-  // i = input index, j output index
-  size_t s = 0, j = 0;
-  for (size_t i = 0; i < size; i++) {
-    result[j] = data[i];
-    j += height;
-    if (j >= size) j = ++s;
+template <size_t kWidth>
+void Unshuffle(const uint8_t* data, size_t size, uint8_t* result) {
+  size_t height = (size + kWidth - 1) / kWidth;  // amount of rows of input
+  // Rows of the input matrix that have all kWidth columns filled in.
+  size_t full = size > (kWidth - 1) * height ? size - (kWidth - 1) * height : 0;
+  const HWY_FULL(uint8_t) d;
+  const size_t N = Lanes(d);
+  size_t s = 0;
+  for (; s + N <= full; s += N) {
+    UnshuffleRows(d, hwy::SizeTag<kWidth>(), data + s * kWidth, height,
+                  result + s);
+  }
+  // s + k * height = output index, i input index
+  size_t i = s * kWidth;
+  for (; s < full; s++) {
+    for (size_t k = 0; k < kWidth; k++) {
+      result[s + k * height] = data[i++];
+    }
+  }
+  for (s = full; s < height; s++) {
+    for (size_t k = 0; k < kWidth && s + k * height < size; k++) {
+      result[s + k * height] = data[i++];
+    }
+  }
+}
+
+}  // namespace
+
+void PredictICCRun(const uint8_t* data, size_t start, size_t num,
+                   size_t stride, size_t width, int order,
+                   uint8_t* residuals) {
+  size_t done;
+  if (width == 1) {
+    done = LinearPredictICCVector<uint8_t>(data, start, num, stride, order,
+                                           residuals);
+  } else if (width == 2) {
+    done = LinearPredictICCVector<uint16_t>(data, start, num, stride, order,
+                                            residuals);
+  } else {
+    done = LinearPredictICCVector<uint32_t>(data, start, num, stride, order,
+                                            residuals);
   }
+  // done is a multiple of width, so the tail is predicted the same way.
+  jxl::LinearPredictICC(data, start + done, num - done, stride, width, order,
+                        residuals + done);
+}
+
+void UnshuffleICC(const uint8_t* data, size_t size, size_t width,
+                  uint8_t* result) {
+  if (width == 2) {
+    Unshuffle<2>(data, size, result);
+  } else {
+    Unshuffle<4>(data, size, result);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace jxl
+HWY_AFTER_NAMESPACE();
 
-  for (size_t i = 0; i < size; i++) {
-    data[i] = result[i];
+#if HWY_ONCE
+namespace jxl {
+HWY_EXPORT(PredictICCRun);
+HWY_EXPORT(UnshuffleICC);
+
+namespace {
+
+// Appends the num bytes at data, unshuffled with given width (1, 2 or 4).
+void AppendUnshuffled(const uint8_t* data, size_t num, size_t width,
+                      PaddedBytes* result) {
+  size_t start = result->size();
+  if (width == 1) {
+    result->append(data, data + num);
+    return;
   }
+  result->resize(start + num);
+  HWY_DYNAMIC_DISPATCH(UnshuffleICC)(data, num, width, result->data() + start);
 }
 
 // This is performed by the encoder, the encoder must be able to encode any
@@ -58,14 +214,18 @@ Status PredictAndShuffle(size_t stride, size_t width, int order, size_t num,
     return JXL_FAILURE("Invalid stride");
   }
   if (*pos < stride * 4) return JXL_FAILURE("Too large stride");
-  size_t start = result->size();
-  for (size_t i = 0; i < num; i++) {
-    uint8_t predicted =
-        LinearPredictICCValue(data, *pos, i, stride, width, order);
-    result->push_back(data[*pos + i] - predicted);
+  if (width == 1) {
+    size_t start = result->size();
+    result->resize(start + num);
+    HWY_DYNAMIC_DISPATCH(PredictICCRun)
+    (data, *pos, num, stride, width, order, result->data() + start);
+  } else {
+    PaddedBytes residuals(num);
+    HWY_DYNAMIC_DISPATCH(PredictICCRun)
+    (data, *pos, num, stride, width, order, residuals.data());
+    AppendUnshuffled(residuals.data(), num, width, result);
   }
   *pos += num;
-  if (width > 1) Unshuffle(result->data() + start, num, width);
   return true;
 }
 
@@ -243,9 +403,10 @@ Status PredictICC(const uint8_t* icc, size_t size, PaddedBytes* result) {
       tag = {{0, 0, 0, 0}};  // nonsensical value
     }
 
-    if (commands_add.empty() && data_add.empty() && tagmap.count(pos) &&
+    auto tagmap_it = tagmap.find(pos);
+    if (commands_add.empty() && data_add.empty() && tagmap_it != tagmap.end() &&
         pos + 4 <= size) {
-      size_t index = tagmap[pos];
+      size_t index = tagmap_it->second;
       tag = DecodeKeyword(icc, size, pos);
       tagstart = tagstarts[index];
       tagsize = tagsizes[index];
@@ -258,12 +419,8 @@ Status PredictICC(const uint8_t* icc, size_t size, PaddedBytes* result) {
         pos += 8;
         commands_add.push_back(kCommandShuffle2);
         EncodeVarInt(num, &commands_add);
-        size_t start = data_add.size();
-        for (size_t i = 0; i < num; i++) {
-          data_add.push_back(icc[pos]);
-          pos++;
-        }
-        Unshuffle(data_add.data() + start, num, 2);
+        AppendUnshuffled(icc + pos, num, 2, &data_add);
+        pos += num;
       }
 
       if (tag == kCurvTag && pos + tagsize <= size && tagsize > 8 &&
@@ -371,16 +528,10 @@ Status PredictICC(const uint8_t* icc, size_t size, PaddedBytes* result) {
       if (last0 < last1) {
         commands.push_back(kCommandInsert);
         EncodeVarInt(last1 - last0, &commands);
-        while (last0 < last1) {
-          data.push_back(icc[last0++]);
-        }
-      }
-      for (size_t i = 0; i < commands_add.size(); i++) {
-        commands.push_back(commands_add[i]);
-      }
-      for (size_t i = 0; i < data_add.size(); i++) {
-        data.push_back(data_add[i]);
+        data.append(icc + last0, icc + last1);
       }
+      commands.append(commands_add);
+      data.append(data_add);
       last0 = pos;
     }
     if (commands_add.empty() && data_add.empty()) {
@@ -389,12 +540,8 @@ Status PredictICC(const uint8_t* icc, size_t size, PaddedBytes* result) {
   }
 
   EncodeVarInt(commands.size(), result);
-  for (size_t i = 0; i < commands.size(); i++) {
-    result->push_back(commands[i]);
-  }
-  for (size_t i = 0; i < data.size(); i++) {
-    result->push_back(data[i]);
-  }
+  result->append(commands);
+  result->append(data);
 
   return true;
 }
@@ -426,4 +573,36 @@ Status WriteICC(const IccBytes& icc, BitWriter* JXL_RESTRICT writer,
   return true;
 }
 
+Status ICCWriterCache::WriteICC(const IccBytes& icc,
+                                BitWriter* JXL_RESTRICT writer, size_t layer,
+                                AuxOut* JXL_RESTRICT aux_out) {
+  // Per-layer statistics need the histogram and token bits, so don't bypass
+  // the entropy coder when they are requested.
+  if (aux_out != nullptr) return jxl::WriteICC(icc, writer, layer, aux_out);
+  if (icc.empty() || icc != icc_) {
+    icc_.clear();
+    BitWriter encoded;
+    JXL_RETURN_IF_ERROR(jxl::WriteICC(icc, &encoded, layer, nullptr));
+    encoded_bits_ = encoded.BitsWritten();
+    BitWriter::Allotment allotment(&encoded, kBitsPerByte);
+    encoded.ZeroPadToByte();
+    allotment.ReclaimAndCharge(&encoded, layer, nullptr);
+    encoded_ = std::move(encoded).TakeBytes();
+    icc_ = icc;
+  }
+  // The cached bits are generally not byte aligned in the output.
+  BitWriter::Allotment allotment(writer, encoded_bits_);
+  size_t full_bytes = encoded_bits_ / kBitsPerByte;
+  for (size_t i = 0; i < full_bytes; i++) {
+    writer->Write(kBitsPerByte, encoded_[i]);
+  }
+  size_t tail_bits = encoded_bits_ % kBitsPerByte;
+  if (tail_bits != 0) {
+    writer->Write(tail_bits, encoded_[full_bytes] & ((1u << tail_bits) - 1));
+  }
+  allotment.ReclaimAndCharge(writer, layer, nullptr);
+  return true;
+}
+
 }  // namespace jxl
+#endif  // HWY_ONCE
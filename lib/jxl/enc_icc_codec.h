@@ -27,6 +27,22 @@ struct AuxOut;
 Status WriteICC(const std::vector<uint8_t>& icc, BitWriter* JXL_RESTRICT writer,
                 size_t layer, AuxOut* JXL_RESTRICT aux_out);
 
+// Remembers the encoding of the last ICC profile written through it, so that
+// writing an identical profile again, e.g. for the next image of a reused
+// encoder, skips prediction and entropy coding. The output is the same as that
+// of WriteICC.
+class ICCWriterCache {
+ public:
+  Status WriteICC(const std::vector<uint8_t>& icc,
+                  BitWriter* JXL_RESTRICT writer, size_t layer,
+                  AuxOut* JXL_RESTRICT aux_out);
+
+ private:
+  std::vector<uint8_t> icc_;
+  PaddedBytes encoded_;
+  size_t encoded_bits_ = 0;
+};
+
 // Exposed only for testing
 Status PredictICC(const uint8_t* icc, size_t size, PaddedBytes* result);
 
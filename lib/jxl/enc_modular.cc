@@ -30,6 +30,7 @@
 #include "lib/jxl/enc_patch_dictionary.h"
 #include "lib/jxl/enc_quant_weights.h"
 #include "lib/jxl/frame_header.h"
+#include "lib/jxl/image_ops.h"
 #include "lib/jxl/modular/encoding/context_predict.h"
 #include "lib/jxl/modular/encoding/enc_debug_tree.h"
 #include "lib/jxl/modular/encoding/enc_encoding.h"
@@ -534,6 +535,9 @@ Status ModularFrameEncoder::ComputeEncodingData(
       do_color ? metadata.bit_depth.bits_per_sample + (fp ? 0 : 1) : 0;
   Image& gi = stream_images_[0];
   gi = Image(xsize, ysize, metadata.bit_depth.bits_per_sample, nb_chans);
+  for (Channel& ch : gi.channel) {
+    JXL_RETURN_IF_ERROR(FirstTouchImage(pool, &ch.plane));
+  }
   int c = 0;
   if (cparams_.color_transform == ColorTransform::kXYB &&
       cparams_.modular_mode == true) {
@@ -977,6 +981,7 @@ Status ModularFrameEncoder::PrepareEncoding(const FrameHeader& frame_header,
   stream_headers_.resize(num_streams);
   tokens_.resize(num_streams);
 
+  bool fixed_tree = true;
   if (heuristics->CustomFixedTreeLossless(frame_dim_, &tree_)) {
     // Using a fixed tree.
   } else if (cparams_.speed_tier < SpeedTier::kFalcon ||
@@ -997,6 +1002,7 @@ Status ModularFrameEncoder::PrepareEncoding(const FrameHeader& frame_header,
     }
     // Don't do anything if modular mode does not have any pixels in this image
     if (useful_splits.empty()) return true;
+    fixed_tree = false;
     useful_splits.push_back(tree_splits_.back());
 
     std::atomic_flag invalid_force_wp = ATOMIC_FLAG_INIT;
@@ -1063,9 +1069,11 @@ Status ModularFrameEncoder::PrepareEncoding(const FrameHeader& frame_header,
           // TODO(veluca): parallelize more.
           trees[chunk] =
               LearnTree(std::move(tree_samples), total_pixels,
-                        stream_options_[start], local_multiplier_info, range);
+                        stream_options_[start], local_multiplier_info, range,
+                        pool);
         },
         "LearnTrees"));
+    JXL_RETURN_IF_ERROR(CheckCancelled(pool));
     if (invalid_force_wp.test_and_set(std::memory_order_acq_rel)) {
       return JXL_FAILURE("PrepareEncoding: force_no_wp with {Weighted}");
     }
@@ -1107,9 +1115,21 @@ Status ModularFrameEncoder::PrepareEncoding(const FrameHeader& frame_header,
   } */
 
   image_widths_.resize(num_streams);
+  // With a fixed tree, nothing depends on the statistics of other streams, so
+  // each thread also counts the histograms of the streams it tokenizes, and
+  // the (few) per-thread histograms are merged at the end.
+  const size_t num_contexts = (tree_.size() + 1) / 2;
+  std::vector<std::vector<Histogram>> thread_histograms;
+  const auto init_histograms = [&](const size_t num_threads) {
+    if (fixed_tree) {
+      thread_histograms.assign(num_threads,
+                               std::vector<Histogram>(num_contexts));
+    }
+    return true;
+  };
   JXL_RETURN_IF_ERROR(RunOnPool(
-      pool, 0, num_streams, ThreadPool::NoInit,
-      [&](const uint32_t stream_id, size_t /* thread */) {
+      pool, 0, num_streams, init_histograms,
+      [&](const uint32_t stream_id, size_t thread) {
         AuxOut my_aux_out;
         tokens_[stream_id].clear();
         JXL_CHECK(ModularGenericCompress(
@@ -1120,8 +1140,21 @@ Status ModularFrameEncoder::PrepareEncoding(const FrameHeader& frame_header,
             /*tree=*/&tree_, /*header=*/&stream_headers_[stream_id],
             /*tokens=*/&tokens_[stream_id],
             /*widths=*/&image_widths_[stream_id]));
+        if (fixed_tree) {
+          AddTokensToHistograms(tokens_[stream_id],
+                                &thread_histograms[thread]);
+        }
       },
       "ComputeTokens"));
+  histograms_.clear();
+  if (fixed_tree) {
+    histograms_.resize(num_contexts);
+    for (const std::vector<Histogram>& histograms : thread_histograms) {
+      for (size_t c = 0; c < num_contexts; ++c) {
+        histograms_[c].AddHistogram(histograms[c]);
+      }
+    }
+  }
   return true;
 }
 
@@ -1185,7 +1218,8 @@ Status ModularFrameEncoder::EncodeGlobalInfo(BitWriter* writer,
   params.image_widths = image_widths_;
   // Write histograms.
   BuildAndEncodeHistograms(params, (tree_.size() + 1) / 2, tokens_, &code_,
-                           &context_map_, writer, kLayerModularGlobal, aux_out);
+                           &context_map_, writer, kLayerModularGlobal, aux_out,
+                           histograms_.empty() ? nullptr : &histograms_);
   return true;
 }
 
@@ -10,6 +10,7 @@
 #include "lib/jxl/dec_modular.h"
 #include "lib/jxl/enc_bit_writer.h"
 #include "lib/jxl/enc_cache.h"
+#include "lib/jxl/enc_cluster.h"
 #include "lib/jxl/enc_params.h"
 #include "lib/jxl/frame_header.h"
 #include "lib/jxl/image.h"
@@ -76,6 +77,9 @@ class ModularFrameEncoder {
   std::vector<std::vector<Token>> tree_tokens_;
   std::vector<GroupHeader> stream_headers_;
   std::vector<std::vector<Token>> tokens_;
+  // Per-context histograms of tokens_, counted while tokenizing when the tree
+  // is fixed. Empty if they have to be computed from tokens_.
+  std::vector<Histogram> histograms_;
   EntropyEncodingData code_;
   std::vector<uint8_t> context_map_;
   FrameDimensions frame_dim_;
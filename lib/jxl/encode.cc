@@ -9,6 +9,7 @@
 #include <jxl/types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -32,6 +33,7 @@
 #include "lib/jxl/enc_params.h"
 #include "lib/jxl/encode_internal.h"
 #include "lib/jxl/exif.h"
+#include "lib/jxl/frame_dimensions.h"
 #include "lib/jxl/jpeg/enc_jpeg_data.h"
 #include "lib/jxl/luminance.h"
 #include "lib/jxl/memory_manager_internal.h"
@@ -45,6 +47,8 @@ struct JxlErrorOrStatus {
         return jxl::OkStatus();
       case JXL_ENC_NEED_MORE_OUTPUT:
         return jxl::StatusCode::kNotEnoughBytes;
+      case JXL_ENC_CANCELLED:
+        return jxl::StatusCode::kCancelled;
       default:
         return jxl::StatusCode::kGenericError;
     }
@@ -62,6 +66,10 @@ struct JxlErrorOrStatus {
 
   static JxlErrorOrStatus Error() { return JxlErrorOrStatus(JXL_ENC_ERROR); }
 
+  static JxlErrorOrStatus Cancelled() {
+    return JxlErrorOrStatus(JXL_ENC_CANCELLED);
+  }
+
  private:
   explicit JxlErrorOrStatus(JxlEncoderStatus error) : error_(error) {}
   JxlEncoderStatus error_;
@@ -396,6 +404,30 @@ jxl::Status AppendData(JxlEncoderOutputProcessorWrapper& output_processor,
   return jxl::OkStatus();
 }
 
+jxl::Status JxlEncoderOutputProcessorWrapper::AppendOwnedBytes(
+    jxl::PaddedBytes&& bytes) {
+  JXL_ASSERT(!has_buffer_);
+  if (bytes.empty()) return jxl::OkStatus();
+  if (stop_requested_) return jxl::StatusCode::kNotEnoughBytes;
+  // External processors hand out their own buffers, and bytes that fit in the
+  // output buffer are written there directly; both take exactly one copy.
+  if (external_output_processor_ ||
+      position_ - output_position_ + bytes.size() <= *avail_out_) {
+    return AppendData(*this, bytes);
+  }
+  // The bytes must not overlap a buffer that was written after a Seek.
+  auto it = internal_buffers_.lower_bound(position_);
+  if (it != internal_buffers_.end() && it->first < position_ + bytes.size()) {
+    return AppendData(*this, bytes);
+  }
+  InternalBuffer& buffer =
+      internal_buffers_.emplace(position_, InternalBuffer()).first->second;
+  buffer.written_bytes = bytes.size();
+  buffer.owned_data = std::move(bytes);
+  position_ += buffer.written_bytes;
+  return jxl::OkStatus();
+}
+
 template <typename BoxContents>
 jxl::Status JxlEncoderStruct::AppendBoxWithContents(
     const jxl::BoxType& type, const BoxContents& contents) {
@@ -754,8 +786,8 @@ jxl::Status JxlEncoderStruct::ProcessOneEnqueuedInput() {
     }
     // Only send ICC (at least several hundred bytes) if fields aren't enough.
     if (metadata.m.color_encoding.WantICC()) {
-      if (!jxl::WriteICC(metadata.m.color_encoding.ICC(), &writer,
-                         jxl::kLayerHeader, aux_out)) {
+      if (!icc_writer_cache.WriteICC(metadata.m.color_encoding.ICC(), &writer,
+                                     jxl::kLayerHeader, aux_out)) {
         return JXL_API_ERROR(this, JXL_ENC_ERR_GENERIC,
                              "Failed to write ICC profile");
       }
@@ -873,12 +905,23 @@ jxl::Status JxlEncoderStruct::ProcessOneEnqueuedInput() {
     bool last_frame = frames_closed && !num_queued_frames;
 
     jxl::BitWriter writer;
+    std::vector<jxl::BitWriter> group_codes;
 
     std::function<jxl::Status()> append_frame_codestream;
     size_t codestream_upper_bound = 0;
 
     if (input_frame) {
-      jxl::PassesEncoderState enc_state;
+      if (enc_state) {
+        jxl::RecyclePassesEncoderState(enc_state.get());
+      } else {
+        enc_state =
+            jxl::MemoryManagerMakeUnique<jxl::PassesEncoderState>(
+                &memory_manager);
+        if (!enc_state) {
+          return JXL_API_ERROR(this, JXL_ENC_ERR_OOM,
+                               "Failed to allocate encoder state");
+        }
+      }
 
       frame_index_box.AddFrame(codestream_bytes_written_end_of_frame, duration,
                                input_frame->option_values.frame_index_box);
@@ -937,26 +980,59 @@ jxl::Status JxlEncoderStruct::ProcessOneEnqueuedInput() {
         ib.origin.x0 = input_frame->option_values.header.layer_info.crop_x0;
         ib.origin.y0 = input_frame->option_values.header.layer_info.crop_y0;
       }
+      if (!thread_pool) {
+        // Without a runner, a sequential pool still carries the cancellation
+        // flag; a later JxlEncoderSetParallelRunner or
+        // JxlEncoderSetParallelPriorityRunner replaces it.
+        thread_pool = jxl::MemoryManagerMakeUnique<jxl::ThreadPool>(
+            &memory_manager, nullptr, nullptr);
+        if (!thread_pool) {
+          return JXL_API_ERROR(this, JXL_ENC_ERR_OOM,
+                               "Failed to allocate thread pool");
+        }
+        thread_pool->SetCancelFlag(&cancelled);
+        if (retired_thread_pool) {
+          thread_pool->TakeScratch(retired_thread_pool.get());
+          retired_thread_pool.reset();
+        }
+      }
       JXL_ASSERT(writer.BitsWritten() == 0);
-      if (!jxl::EncodeFrame(input_frame->option_values.cparams, frame_info,
-                            &metadata, input_frame->frame, &enc_state, cms,
-                            thread_pool.get(), &writer,
-                            input_frame->option_values.aux_out)) {
+      jxl::Status status = jxl::EncodeFrame(
+          input_frame->option_values.cparams, frame_info, &metadata,
+          input_frame->frame, enc_state.get(), cms, thread_pool.get(), &writer,
+          &group_codes, input_frame->option_values.aux_out);
+      if (!reuse_allocations || !status) enc_state.reset();
+      if (status.code() == jxl::StatusCode::kCancelled) return status;
+      if (!status) {
         return JXL_API_ERROR(this, JXL_ENC_ERR_GENERIC,
                              "Failed to encode frame");
       }
       codestream_bytes_written_beginning_of_frame =
           codestream_bytes_written_end_of_frame;
-      codestream_bytes_written_end_of_frame +=
-          jxl::DivCeil(writer.BitsWritten(), 8);
+      // The frame is output as the headers and TOC in `writer` followed by
+      // each section in `group_codes`; the sections are moved into the output
+      // instead of being concatenated into one buffer first.
+      size_t frame_size = jxl::DivCeil(writer.BitsWritten(), 8);
+      for (const jxl::BitWriter& group_code : group_codes) {
+        frame_size += jxl::DivCeil(group_code.BitsWritten(), 8);
+      }
+      codestream_bytes_written_end_of_frame += frame_size;
 
       // Possibly bytes already contains the codestream header: in case this is
       // the first frame, and the codestream header was not encoded as jxlp
       // above.
-      bytes.append(std::move(writer).TakeBytes());
-      codestream_upper_bound = bytes.size();
-      append_frame_codestream = [&bytes, this]() {
-        return AppendData(output_processor, bytes);
+      codestream_upper_bound = bytes.size() + frame_size;
+      append_frame_codestream = [&bytes, &writer, &group_codes, this]() {
+        if (!bytes.empty()) {
+          JXL_RETURN_IF_ERROR(AppendData(output_processor, bytes));
+        }
+        JXL_RETURN_IF_ERROR(
+            output_processor.AppendOwnedBytes(std::move(writer).TakeBytes()));
+        for (jxl::BitWriter& group_code : group_codes) {
+          JXL_RETURN_IF_ERROR(output_processor.AppendOwnedBytes(
+              std::move(group_code).TakeBytes()));
+        }
+        return jxl::OkStatus();
       };
     } else {
       JXL_CHECK(fast_lossless_frame);
@@ -1867,7 +1943,11 @@ JxlEncoder* JxlEncoderCreate(const JxlMemoryManager* memory_manager) {
 }
 
 void JxlEncoderReset(JxlEncoder* enc) {
+  if (enc->reuse_allocations && enc->thread_pool) {
+    enc->retired_thread_pool = std::move(enc->thread_pool);
+  }
   enc->thread_pool.reset();
+  enc->parallel_runner_set = false;
   enc->input_queue.clear();
   enc->num_queued_frames = 0;
   enc->num_queued_boxes = 0;
@@ -1886,6 +1966,8 @@ void JxlEncoderReset(JxlEncoder* enc) {
   enc->use_container = false;
   enc->use_boxes = false;
   enc->codestream_level = -1;
+  enc->priority = JXL_PRIORITY_NORMAL;
+  enc->cancelled.store(false, std::memory_order_relaxed);
   enc->output_processor = JxlEncoderOutputProcessorWrapper();
   JxlEncoderInitBasicInfo(&enc->basic_info);
 }
@@ -1901,6 +1983,16 @@ void JxlEncoderDestroy(JxlEncoder* enc) {
 
 JxlEncoderError JxlEncoderGetError(JxlEncoder* enc) { return enc->error; }
 
+JxlEncoderStatus JxlEncoderSetReuseAllocations(JxlEncoder* enc,
+                                              JXL_BOOL reuse) {
+  enc->reuse_allocations = static_cast<bool>(reuse);
+  if (!enc->reuse_allocations) {
+    enc->enc_state.reset();
+    enc->retired_thread_pool.reset();
+  }
+  return JxlErrorOrStatus::Success();
+}
+
 JxlEncoderStatus JxlEncoderUseContainer(JxlEncoder* enc,
                                         JXL_BOOL use_container) {
   if (enc->wrote_bytes) {
@@ -1943,22 +2035,67 @@ void JxlEncoderSetCms(JxlEncoder* enc, JxlCmsInterface cms) {
   enc->cms_set = true;
 }
 
-JxlEncoderStatus JxlEncoderSetParallelRunner(JxlEncoder* enc,
-                                             JxlParallelRunner parallel_runner,
-                                             void* parallel_runner_opaque) {
-  if (enc->thread_pool) {
+namespace {
+
+JxlEncoderStatus SetParallelRunner(
+    JxlEncoder* enc, JxlParallelRunner parallel_runner,
+    JxlParallelPriorityRunner parallel_priority_runner,
+    void* parallel_runner_opaque) {
+  if (enc->parallel_runner_set) {
     return JXL_API_ERROR(enc, JXL_ENC_ERR_API_USAGE,
                          "parallel runner already set");
   }
-  enc->thread_pool = jxl::MemoryManagerMakeUnique<jxl::ThreadPool>(
-      &enc->memory_manager, parallel_runner, parallel_runner_opaque);
-  if (!enc->thread_pool) {
+  auto thread_pool = jxl::MemoryManagerMakeUnique<jxl::ThreadPool>(
+      &enc->memory_manager, parallel_runner, parallel_priority_runner,
+      parallel_runner_opaque);
+  if (!thread_pool) {
     return JXL_API_ERROR(enc, JXL_ENC_ERR_GENERIC,
                          "error setting parallel runner");
   }
+  thread_pool->SetCancelFlag(&enc->cancelled);
+  thread_pool->SetPriority(enc->priority);
+  // Keep the scratch buffers of the sequential pool that encoded the previous
+  // frames, or of the pool retired by JxlEncoderReset.
+  if (enc->thread_pool) {
+    thread_pool->TakeScratch(enc->thread_pool.get());
+  } else if (enc->retired_thread_pool) {
+    thread_pool->TakeScratch(enc->retired_thread_pool.get());
+  }
+  enc->retired_thread_pool.reset();
+  enc->thread_pool = std::move(thread_pool);
+  enc->parallel_runner_set = true;
+  return JxlErrorOrStatus::Success();
+}
+
+}  // namespace
+
+JxlEncoderStatus JxlEncoderSetParallelRunner(JxlEncoder* enc,
+                                             JxlParallelRunner parallel_runner,
+                                             void* parallel_runner_opaque) {
+  return SetParallelRunner(enc, parallel_runner, nullptr,
+                           parallel_runner_opaque);
+}
+
+JxlEncoderStatus JxlEncoderSetParallelPriorityRunner(
+    JxlEncoder* enc, JxlParallelPriorityRunner parallel_runner,
+    void* parallel_runner_opaque) {
+  return SetParallelRunner(enc, nullptr, parallel_runner,
+                           parallel_runner_opaque);
+}
+
+JxlEncoderStatus JxlEncoderSetPriority(JxlEncoder* enc, JxlPriority priority) {
+  if (priority != JXL_PRIORITY_BACKGROUND && priority != JXL_PRIORITY_NORMAL) {
+    return JXL_API_ERROR(enc, JXL_ENC_ERR_API_USAGE, "invalid priority");
+  }
+  enc->priority = priority;
+  if (enc->thread_pool) enc->thread_pool->SetPriority(priority);
   return JxlErrorOrStatus::Success();
 }
 
+void JxlEncoderCancel(JxlEncoder* enc) {
+  enc->cancelled.store(true, std::memory_order_relaxed);
+}
+
 namespace {
 JxlEncoderStatus GetCurrentDimensions(
     const JxlEncoderFrameSettings* frame_settings, size_t& xsize,
@@ -2542,10 +2679,15 @@ JXL_EXPORT JxlEncoderStatus JxlEncoderFlushInput(JxlEncoder* enc) {
                          "Cannot flush input without setting output "
                          "processor with JxlEncoderSetOutputProcessor");
   }
+  if (enc->cancelled.load(std::memory_order_relaxed)) {
+    return JxlErrorOrStatus::Cancelled();
+  }
   while (!enc->input_queue.empty()) {
-    if (!enc->ProcessOneEnqueuedInput()) {
-      return JxlErrorOrStatus::Error();
+    jxl::Status status = enc->ProcessOneEnqueuedInput();
+    if (status.code() == jxl::StatusCode::kCancelled) {
+      return JxlErrorOrStatus::Cancelled();
     }
+    if (!status) return JxlErrorOrStatus::Error();
   }
   return JxlErrorOrStatus::Success();
 }
@@ -2573,10 +2715,15 @@ JxlEncoderStatus JxlEncoderProcessOutput(JxlEncoder* enc, uint8_t** next_out,
                          "Cannot call JxlEncoderProcessOutput after calling "
                          "JxlEncoderSetOutputProcessor");
   }
+  if (enc->cancelled.load(std::memory_order_relaxed)) {
+    return JxlErrorOrStatus::Cancelled();
+  }
   while (*avail_out != 0 && !enc->input_queue.empty()) {
-    if (!enc->ProcessOneEnqueuedInput()) {
-      return JxlErrorOrStatus::Error();
+    jxl::Status status = enc->ProcessOneEnqueuedInput();
+    if (status.code() == jxl::StatusCode::kCancelled) {
+      return JxlErrorOrStatus::Cancelled();
     }
+    if (!status) return JxlErrorOrStatus::Error();
   }
 
   if (!enc->input_queue.empty() || enc->output_processor.HasOutputToWrite()) {
@@ -2585,6 +2732,62 @@ JxlEncoderStatus JxlEncoderProcessOutput(JxlEncoder* enc, uint8_t** next_out,
   return JxlErrorOrStatus::Success();
 }
 
+namespace {
+
+// Estimate of the encoded size of a queued frame: the uncompressed samples
+// with an allowance for entropy coding overhead, plus headers, histograms and
+// TOC per group and per frame. Frames that compress worse than the
+// uncompressed samples plus this allowance exceed it.
+size_t FrameSizeEstimate(const jxl::ImageMetadata& metadata,
+                         const jxl::ImageBundle& frame) {
+  size_t bits_per_pixel = metadata.color_encoding.Channels() *
+                          metadata.bit_depth.bits_per_sample;
+  for (const jxl::ExtraChannelInfo& eci : metadata.extra_channel_info) {
+    bits_per_pixel += eci.bit_depth.bits_per_sample;
+  }
+  size_t num_pixels = frame.xsize() * frame.ysize();
+  size_t sample_bytes = jxl::DivCeil(num_pixels * bits_per_pixel, 8);
+  size_t num_groups = jxl::DivCeil(frame.xsize(), jxl::kGroupDim) *
+                      jxl::DivCeil(frame.ysize(), jxl::kGroupDim);
+  return sample_bytes + sample_bytes / 8 + num_groups * 256 + 4096;
+}
+
+}  // namespace
+
+JxlEncoderStatus JxlEncoderGetOutputSizeEstimate(const JxlEncoder* enc,
+                                                 size_t* size) {
+  if (!enc->basic_info_set) {
+    return JXL_API_ERROR_NOSET("Basic info must be set first");
+  }
+  // Box headers and jxlp counters, frame index entries.
+  constexpr size_t kBoxOverhead = 32;
+  size_t estimate = enc->output_processor.PendingOutputSize();
+  if (!enc->wrote_bytes) {
+    // Signature, ftyp and level boxes, codestream headers and ICC profile,
+    // and JPEG reconstruction data.
+    const jxl::ColorEncoding& c = enc->metadata.m.color_encoding;
+    size_t icc_size = c.WantICC() ? c.ICC().size() : 0;
+    estimate += 1024 + icc_size + icc_size / 8 + enc->jpeg_metadata.size() +
+                2 * kBoxOverhead;
+  }
+  for (const jxl::JxlEncoderQueuedInput& input : enc->input_queue) {
+    if (input.frame) {
+      estimate += FrameSizeEstimate(enc->metadata.m, input.frame->frame);
+    } else if (input.fast_lossless_frame) {
+      estimate +=
+          JxlFastLosslessOutputSize(input.fast_lossless_frame.get()) + 4096;
+    } else if (input.box) {
+      size_t box_size = input.box->contents.size();
+      // Brotli compressed boxes can expand slightly.
+      if (input.box->compress_box) box_size += box_size / 8 + 64;
+      estimate += box_size;
+    }
+    estimate += kBoxOverhead;
+  }
+  *size = estimate;
+  return JxlErrorOrStatus::Success();
+}
+
 JxlEncoderStatus JxlEncoderSetFrameHeader(
     JxlEncoderFrameSettings* frame_settings,
     const JxlFrameHeader* frame_header) {
@@ -13,6 +13,7 @@
 #include <jxl/types.h>
 #include <sys/types.h>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -23,8 +24,10 @@
 #include "lib/jxl/base/padded_bytes.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/enc_aux_out.h"
+#include "lib/jxl/enc_cache.h"
 #include "lib/jxl/enc_fast_lossless.h"
 #include "lib/jxl/enc_frame.h"
+#include "lib/jxl/enc_icc_codec.h"
 #include "lib/jxl/memory_manager_internal.h"
 
 namespace jxl {
@@ -210,6 +213,11 @@ class JxlEncoderOutputProcessorWrapper {
   jxl::StatusOr<JxlOutputProcessorBuffer> GetBuffer(size_t min_size,
                                                     size_t requested_size = 0);
 
+  // Appends `bytes` at the current position. If they have to be buffered
+  // because they do not fit in the output buffer, they are taken over as an
+  // internal buffer instead of being copied into a newly allocated one.
+  jxl::Status AppendOwnedBytes(jxl::PaddedBytes&& bytes);
+
   void Seek(size_t pos);
 
   void SetFinalizedPosition();
@@ -225,6 +233,8 @@ class JxlEncoderOutputProcessorWrapper {
   bool HasOutputToWrite() const {
     return output_position_ < finalized_position_;
   }
+  // Bytes that were already encoded but not yet given to the output.
+  size_t PendingOutputSize() const { return position_ - output_position_; }
 
  private:
   void ReleaseBuffer(size_t bytes_used);
@@ -332,6 +342,10 @@ struct JxlEncoderStruct {
   JxlMemoryManager memory_manager;
   jxl::MemoryManagerUniquePtr<jxl::ThreadPool> thread_pool{
       nullptr, jxl::MemoryManagerDeleteHelper(&memory_manager)};
+  // Whether thread_pool was set by JxlEncoderSetParallelRunner or
+  // JxlEncoderSetParallelPriorityRunner. Otherwise it is a sequential pool
+  // created when the first frame is encoded, which a later runner replaces.
+  bool parallel_runner_set;
   JxlCmsInterface cms;
   bool cms_set;
   std::vector<jxl::MemoryManagerUniquePtr<JxlEncoderFrameSettings>>
@@ -384,6 +398,23 @@ struct JxlEncoderStruct {
   bool intensity_target_set;
   bool allow_expert_options = false;
   int brotli_effort = -1;
+  JxlPriority priority;
+  // Set by JxlEncoderCancel, possibly from another thread.
+  std::atomic<bool> cancelled{false};
+
+  // Set by JxlEncoderSetReuseAllocations; not cleared by JxlEncoderReset.
+  bool reuse_allocations = false;
+  // Encoder state of the last encoded frame, kept around to reuse its buffers
+  // if reuse_allocations is set.
+  jxl::MemoryManagerUniquePtr<jxl::PassesEncoderState> enc_state{
+      nullptr, jxl::MemoryManagerDeleteHelper(&memory_manager)};
+  // Pool dropped by JxlEncoderReset if reuse_allocations is set. It never runs
+  // again; the next pool takes over its per-thread scratch buffers.
+  jxl::MemoryManagerUniquePtr<jxl::ThreadPool> retired_thread_pool{
+      nullptr, jxl::MemoryManagerDeleteHelper(&memory_manager)};
+  // Encoded ICC profile of the last codestream; not cleared by JxlEncoderReset
+  // so that a sequence of images with the same profile encodes it only once.
+  jxl::ICCWriterCache icc_writer_cache;
 
   // Takes the first frame in the input_queue, encodes it, and appends
   // the bytes to the output_byte_queue.
@@ -265,6 +265,266 @@ TEST(EncodeTest, EncoderResetTest) {
                       false);
 }
 
+// Sets the basic info and color encoding of a 3-channel test image of the
+// given size, and returns frame settings to add it with.
+JxlEncoderFrameSettings* SetUpSomeTestImage(size_t xsize, size_t ysize,
+                                            JxlEncoder* enc,
+                                            bool lossless = false) {
+  JxlPixelFormat pixel_format = {3, JXL_TYPE_UINT16, JXL_BIG_ENDIAN, 0};
+  JxlBasicInfo basic_info;
+  jxl::test::JxlBasicInfoSetFromPixelFormat(&basic_info, &pixel_format);
+  basic_info.xsize = xsize;
+  basic_info.ysize = ysize;
+  basic_info.uses_original_profile = lossless;
+  EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetBasicInfo(enc, &basic_info));
+  JxlColorEncoding color_encoding;
+  JxlColorEncodingSetToSRGB(&color_encoding, false);
+  EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetColorEncoding(enc, &color_encoding));
+  JxlEncoderFrameSettings* frame_settings =
+      JxlEncoderFrameSettingsCreate(enc, nullptr);
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetFrameLossless(frame_settings, lossless));
+  return frame_settings;
+}
+
+// Adds the test image set up by SetUpSomeTestImage as a frame.
+void AddSomeTestImage(size_t xsize, size_t ysize,
+                      JxlEncoderFrameSettings* frame_settings) {
+  JxlPixelFormat pixel_format = {3, JXL_TYPE_UINT16, JXL_BIG_ENDIAN, 0};
+  std::vector<uint8_t> pixels = jxl::test::GetSomeTestImage(xsize, ysize, 3, 0);
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderAddImageFrame(frame_settings, &pixel_format,
+                                    pixels.data(), pixels.size()));
+}
+
+std::vector<uint8_t> EncodeSomeTestImage(size_t xsize, size_t ysize,
+                                         JxlEncoder* enc) {
+  AddSomeTestImage(xsize, ysize, SetUpSomeTestImage(xsize, ysize, enc));
+  JxlEncoderCloseInput(enc);
+  std::vector<uint8_t> compressed(64);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  JxlEncoderStatus process_result = JXL_ENC_NEED_MORE_OUTPUT;
+  while (process_result == JXL_ENC_NEED_MORE_OUTPUT) {
+    process_result = JxlEncoderProcessOutput(enc, &next_out, &avail_out);
+    if (process_result == JXL_ENC_NEED_MORE_OUTPUT) {
+      size_t offset = next_out - compressed.data();
+      compressed.resize(compressed.size() * 2);
+      next_out = compressed.data() + offset;
+      avail_out = compressed.size() - offset;
+    }
+  }
+  EXPECT_EQ(JXL_ENC_SUCCESS, process_result);
+  compressed.resize(next_out - compressed.data());
+  return compressed;
+}
+
+TEST(EncodeTest, EncoderReuseAllocationsTest) {
+  JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+  EXPECT_NE(nullptr, enc.get());
+  EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetReuseAllocations(enc.get(), true));
+  // The kept state must not leak into the following images, whether they have
+  // the same size or not.
+  const std::pair<size_t, size_t> sizes[] = {
+      {300, 200}, {300, 200}, {157, 77}, {300, 200}};
+  for (const auto& size : sizes) {
+    JxlEncoderPtr fresh_enc = JxlEncoderMake(nullptr);
+    std::vector<uint8_t> expected =
+        EncodeSomeTestImage(size.first, size.second, fresh_enc.get());
+    std::vector<uint8_t> compressed =
+        EncodeSomeTestImage(size.first, size.second, enc.get());
+    EXPECT_EQ(expected, compressed);
+    JxlEncoderReset(enc.get());
+  }
+  EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetReuseAllocations(enc.get(), false));
+}
+
+namespace {
+
+// Sequential runner that counts its calls. If `cancel` is set, it first
+// cancels `enc`, as another thread would while the encoder is running.
+struct TestRunnerState {
+  JxlEncoder* enc = nullptr;
+  bool cancel = false;
+  size_t num_calls = 0;
+  // Only counted by TestPriorityRunner.
+  size_t num_background_calls = 0;
+};
+
+JxlParallelRetCode TestRunner(void* runner_opaque, void* jpegxl_opaque,
+                              JxlParallelRunInit init,
+                              JxlParallelRunFunction func,
+                              uint32_t start_range, uint32_t end_range) {
+  auto* state = static_cast<TestRunnerState*>(runner_opaque);
+  ++state->num_calls;
+  if (state->cancel) JxlEncoderCancel(state->enc);
+  JxlParallelRetCode ret = init(jpegxl_opaque, 1);
+  if (ret != 0) return ret;
+  for (uint32_t i = start_range; i < end_range; i++) {
+    func(jpegxl_opaque, i, 0);
+  }
+  return 0;
+}
+
+JxlParallelRetCode TestPriorityRunner(void* runner_opaque,
+                                      JxlPriority priority,
+                                      void* jpegxl_opaque,
+                                      JxlParallelRunInit init,
+                                      JxlParallelRunFunction func,
+                                      uint32_t start_range,
+                                      uint32_t end_range) {
+  auto* state = static_cast<TestRunnerState*>(runner_opaque);
+  if (priority == JXL_PRIORITY_BACKGROUND) ++state->num_background_calls;
+  return TestRunner(runner_opaque, jpegxl_opaque, init, func, start_range,
+                    end_range);
+}
+
+}  // namespace
+
+TEST(EncodeTest, PriorityTest) {
+  TestRunnerState state;
+  JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+  std::vector<uint8_t> expected = EncodeSomeTestImage(300, 200, enc.get());
+  EXPECT_LT(0u, state.num_calls);
+
+  // A runner without a priority parameter is used as before.
+  JxlEncoderReset(enc.get());
+  state.num_calls = 0;
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetPriority(enc.get(), JXL_PRIORITY_BACKGROUND));
+  EXPECT_EQ(expected, EncodeSomeTestImage(300, 200, enc.get()));
+  EXPECT_LT(0u, state.num_calls);
+
+  // A priority-aware runner receives the hint on every call.
+  for (JxlPriority priority : {JXL_PRIORITY_NORMAL, JXL_PRIORITY_BACKGROUND}) {
+    JxlEncoderReset(enc.get());
+    state.num_calls = 0;
+    state.num_background_calls = 0;
+    EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetParallelPriorityRunner(
+                                   enc.get(), &TestPriorityRunner, &state));
+    EXPECT_EQ(JXL_ENC_ERROR,
+              JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+    EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderSetPriority(enc.get(), priority));
+    EXPECT_EQ(expected, EncodeSomeTestImage(300, 200, enc.get()));
+    EXPECT_LT(0u, state.num_calls);
+    EXPECT_EQ(priority == JXL_PRIORITY_BACKGROUND ? state.num_calls : 0u,
+              state.num_background_calls);
+  }
+}
+
+TEST(EncodeTest, ParallelRunnerAfterFirstFrameTest) {
+  const size_t xsize = 300, ysize = 200;
+  JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+  JxlEncoderFrameSettings* frame_settings =
+      SetUpSomeTestImage(xsize, ysize, enc.get());
+  std::vector<uint8_t> compressed(1 << 20);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+
+  // The first frame is encoded without a runner.
+  AddSomeTestImage(xsize, ysize, frame_settings);
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+
+  // A runner can still be set for the next frames, but only once.
+  TestRunnerState state;
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+  EXPECT_EQ(JXL_ENC_ERROR,
+            JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+  AddSomeTestImage(xsize, ysize, frame_settings);
+  JxlEncoderCloseInput(enc.get());
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+  EXPECT_LT(0u, state.num_calls);
+}
+
+TEST(EncodeTest, CancelTest) {
+  const size_t xsize = 300, ysize = 200;
+  JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+  TestRunnerState state;
+  state.enc = enc.get();
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderSetParallelRunner(enc.get(), &TestRunner, &state));
+  AddSomeTestImage(xsize, ysize, SetUpSomeTestImage(xsize, ysize, enc.get()));
+  JxlEncoderCloseInput(enc.get());
+
+  // The runner cancels the encoder in the middle of the frame.
+  state.cancel = true;
+  std::vector<uint8_t> compressed(1 << 20);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  EXPECT_EQ(JXL_ENC_CANCELLED,
+            JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+  EXPECT_EQ(JXL_ENC_CANCELLED,
+            JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+
+  // After a reset, the encoder works again.
+  JxlEncoderReset(enc.get());
+  EXPECT_FALSE(EncodeSomeTestImage(xsize, ysize, enc.get()).empty());
+}
+
+TEST(EncodeTest, OutputSizeEstimateTest) {
+  const size_t xsize = 300, ysize = 200;
+  for (bool lossless : {false, true}) {
+    JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+    EXPECT_NE(nullptr, enc.get());
+    size_t estimate;
+    EXPECT_EQ(JXL_ENC_ERROR,
+              JxlEncoderGetOutputSizeEstimate(enc.get(), &estimate));
+    AddSomeTestImage(xsize, ysize,
+                     SetUpSomeTestImage(xsize, ysize, enc.get(), lossless));
+    JxlEncoderCloseInput(enc.get());
+
+    // For this image, a buffer of the estimated size receives all output in a
+    // single call.
+    EXPECT_EQ(JXL_ENC_SUCCESS,
+              JxlEncoderGetOutputSizeEstimate(enc.get(), &estimate));
+    std::vector<uint8_t> compressed(estimate);
+    uint8_t* next_out = compressed.data();
+    size_t avail_out = compressed.size();
+    EXPECT_EQ(JXL_ENC_SUCCESS,
+              JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+    EXPECT_GT(compressed.size(), avail_out);
+    EXPECT_EQ(JXL_ENC_SUCCESS,
+              JxlEncoderGetOutputSizeEstimate(enc.get(), &estimate));
+    EXPECT_EQ(0u, estimate);
+  }
+}
+
+TEST(EncodeTest, OutputProcessorOwnedBytesTest) {
+  JxlEncoderOutputProcessorWrapper output_processor;
+  std::vector<uint8_t> compressed(5);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  EXPECT_TRUE(output_processor.SetAvailOut(&next_out, &avail_out));
+  std::vector<uint8_t> expected;
+  for (size_t size : {12, 0, 3}) {
+    jxl::PaddedBytes bytes(size);
+    for (size_t i = 0; i < size; i++) {
+      bytes[i] = static_cast<uint8_t>(expected.size());
+      expected.push_back(bytes[i]);
+    }
+    EXPECT_TRUE(output_processor.AppendOwnedBytes(std::move(bytes)));
+  }
+  output_processor.SetFinalizedPosition();
+  EXPECT_EQ(0u, avail_out);
+  EXPECT_TRUE(output_processor.HasOutputToWrite());
+
+  // The bytes that did not fit are output once there is room for them.
+  compressed.resize(2 * expected.size());
+  next_out = compressed.data() + 5;
+  avail_out = compressed.size() - 5;
+  EXPECT_TRUE(output_processor.SetAvailOut(&next_out, &avail_out));
+  EXPECT_FALSE(output_processor.HasOutputToWrite());
+  compressed.resize(next_out - compressed.data());
+  EXPECT_EQ(expected, compressed);
+}
+
 TEST(EncodeTest, CmsTest) {
   JxlEncoderPtr enc = JxlEncoderMake(nullptr);
   EXPECT_NE(nullptr, enc.get());
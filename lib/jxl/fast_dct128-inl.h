@@ -3,2135 +3,2135 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
-/* This file is automatically generated. Do not modify it directly. */
-#if HWY_TARGET != HWY_NEON
-#error "only include this file from fast_dct-inl.h"
-#endif
+// Fixed-point IDCT of size 128, only meant to be included by
+// fast_dct_testonly-inl.h.
 
 constexpr size_t FastIDCTIntegerBits(FastDCTTag<128>) { return 2; }
 
-void FastIDCT(FastDCTTag<128>, const int16_t* in, size_t in_stride,
-              int16_t* out, size_t out_stride, size_t count) {
+HWY_MAYBE_UNUSED void FastIDCT(FastDCTTag<128>, const int16_t* in,
+                               size_t in_stride, int16_t* out,
+                               size_t out_stride, size_t count) {
   JXL_ASSERT(count % 8 == 0);
-  for (size_t i = 0; i < count; i += 8) {
-    int16x8_t v0 = vld1q_s16(in + in_stride * 0 + i);
-    int16x8_t v1 = vld1q_s16(in + in_stride * 64 + i);
-    int16x8_t v2 = vaddq_s16(v0, v1);
-    int16x8_t v3 = vld1q_s16(in + in_stride * 32 + i);
-    int16x8_t v4_tmp = vqrdmulhq_n_s16(v3, 13573);
-    int16x8_t v4 = vaddq_s16(v4_tmp, v3);
-    int16x8_t v5 = vld1q_s16(in + in_stride * 96 + i);
-    int16x8_t v6 = vaddq_s16(v5, v3);
-    int16x8_t v7 = vaddq_s16(v4, v6);
-    int16x8_t v8 = vqrdmulhq_n_s16(v7, 17734);
-    int16x8_t v9 = vaddq_s16(v2, v8);
-    int16x8_t v10 = vld1q_s16(in + in_stride * 16 + i);
-    int16x8_t v11_tmp = vqrdmulhq_n_s16(v10, 13573);
-    int16x8_t v11 = vaddq_s16(v11_tmp, v10);
-    int16x8_t v12 = vld1q_s16(in + in_stride * 80 + i);
-    int16x8_t v13 = vld1q_s16(in + in_stride * 48 + i);
-    int16x8_t v14 = vaddq_s16(v12, v13);
-    int16x8_t v15 = vaddq_s16(v11, v14);
-    int16x8_t v16 = vaddq_s16(v13, v10);
-    int16x8_t v17_tmp = vqrdmulhq_n_s16(v16, 13573);
-    int16x8_t v17 = vaddq_s16(v17_tmp, v16);
-    int16x8_t v18 = vld1q_s16(in + in_stride * 112 + i);
-    int16x8_t v19 = vaddq_s16(v18, v12);
-    int16x8_t v20 = vaddq_s16(v19, v16);
-    int16x8_t v21 = vaddq_s16(v17, v20);
-    int16x8_t v22 = vqrdmulhq_n_s16(v21, 17734);
-    int16x8_t v23 = vaddq_s16(v15, v22);
-    int16x8_t v24 = vqrdmulhq_n_s16(v23, 16705);
-    int16x8_t v25 = vaddq_s16(v9, v24);
-    int16x8_t v26 = vld1q_s16(in + in_stride * 8 + i);
-    int16x8_t v27_tmp = vqrdmulhq_n_s16(v26, 13573);
-    int16x8_t v27 = vaddq_s16(v27_tmp, v26);
-    int16x8_t v28 = vld1q_s16(in + in_stride * 72 + i);
-    int16x8_t v29 = vld1q_s16(in + in_stride * 56 + i);
-    int16x8_t v30 = vaddq_s16(v28, v29);
-    int16x8_t v31 = vaddq_s16(v27, v30);
-    int16x8_t v32 = vld1q_s16(in + in_stride * 40 + i);
-    int16x8_t v33 = vld1q_s16(in + in_stride * 24 + i);
-    int16x8_t v34 = vaddq_s16(v32, v33);
-    int16x8_t v35_tmp = vqrdmulhq_n_s16(v34, 13573);
-    int16x8_t v35 = vaddq_s16(v35_tmp, v34);
-    int16x8_t v36 = vld1q_s16(in + in_stride * 104 + i);
-    int16x8_t v37 = vld1q_s16(in + in_stride * 88 + i);
-    int16x8_t v38 = vaddq_s16(v36, v37);
-    int16x8_t v39 = vaddq_s16(v38, v34);
-    int16x8_t v40 = vaddq_s16(v35, v39);
-    int16x8_t v41 = vqrdmulhq_n_s16(v40, 17734);
-    int16x8_t v42 = vaddq_s16(v31, v41);
-    int16x8_t v43 = vaddq_s16(v33, v26);
-    int16x8_t v44_tmp = vqrdmulhq_n_s16(v43, 13573);
-    int16x8_t v44 = vaddq_s16(v44_tmp, v43);
-    int16x8_t v45 = vaddq_s16(v37, v28);
-    int16x8_t v46 = vaddq_s16(v29, v32);
-    int16x8_t v47 = vaddq_s16(v45, v46);
-    int16x8_t v48 = vaddq_s16(v44, v47);
-    int16x8_t v49 = vaddq_s16(v46, v43);
-    int16x8_t v50_tmp = vqrdmulhq_n_s16(v49, 13573);
-    int16x8_t v50 = vaddq_s16(v50_tmp, v49);
-    int16x8_t v51 = vld1q_s16(in + in_stride * 120 + i);
-    int16x8_t v52 = vaddq_s16(v51, v36);
-    int16x8_t v53 = vaddq_s16(v52, v45);
-    int16x8_t v54 = vaddq_s16(v53, v49);
-    int16x8_t v55 = vaddq_s16(v50, v54);
-    int16x8_t v56 = vqrdmulhq_n_s16(v55, 17734);
-    int16x8_t v57 = vaddq_s16(v48, v56);
-    int16x8_t v58 = vqrdmulhq_n_s16(v57, 16705);
-    int16x8_t v59 = vaddq_s16(v42, v58);
-    int16x8_t v60 = vqrdmulhq_n_s16(v59, 16463);
-    int16x8_t v61 = vaddq_s16(v25, v60);
-    int16x8_t v62 = vld1q_s16(in + in_stride * 4 + i);
-    int16x8_t v63_tmp = vqrdmulhq_n_s16(v62, 13573);
-    int16x8_t v63 = vaddq_s16(v63_tmp, v62);
-    int16x8_t v64 = vld1q_s16(in + in_stride * 68 + i);
-    int16x8_t v65 = vld1q_s16(in + in_stride * 60 + i);
-    int16x8_t v66 = vaddq_s16(v64, v65);
-    int16x8_t v67 = vaddq_s16(v63, v66);
-    int16x8_t v68 = vld1q_s16(in + in_stride * 36 + i);
-    int16x8_t v69 = vld1q_s16(in + in_stride * 28 + i);
-    int16x8_t v70 = vaddq_s16(v68, v69);
-    int16x8_t v71_tmp = vqrdmulhq_n_s16(v70, 13573);
-    int16x8_t v71 = vaddq_s16(v71_tmp, v70);
-    int16x8_t v72 = vld1q_s16(in + in_stride * 100 + i);
-    int16x8_t v73 = vld1q_s16(in + in_stride * 92 + i);
-    int16x8_t v74 = vaddq_s16(v72, v73);
-    int16x8_t v75 = vaddq_s16(v74, v70);
-    int16x8_t v76 = vaddq_s16(v71, v75);
-    int16x8_t v77 = vqrdmulhq_n_s16(v76, 17734);
-    int16x8_t v78 = vaddq_s16(v67, v77);
-    int16x8_t v79 = vld1q_s16(in + in_stride * 20 + i);
-    int16x8_t v80 = vld1q_s16(in + in_stride * 12 + i);
-    int16x8_t v81 = vaddq_s16(v79, v80);
-    int16x8_t v82_tmp = vqrdmulhq_n_s16(v81, 13573);
-    int16x8_t v82 = vaddq_s16(v82_tmp, v81);
-    int16x8_t v83 = vld1q_s16(in + in_stride * 84 + i);
-    int16x8_t v84 = vld1q_s16(in + in_stride * 76 + i);
-    int16x8_t v85 = vaddq_s16(v83, v84);
-    int16x8_t v86 = vld1q_s16(in + in_stride * 52 + i);
-    int16x8_t v87 = vld1q_s16(in + in_stride * 44 + i);
-    int16x8_t v88 = vaddq_s16(v86, v87);
-    int16x8_t v89 = vaddq_s16(v85, v88);
-    int16x8_t v90 = vaddq_s16(v82, v89);
-    int16x8_t v91 = vaddq_s16(v88, v81);
-    int16x8_t v92_tmp = vqrdmulhq_n_s16(v91, 13573);
-    int16x8_t v92 = vaddq_s16(v92_tmp, v91);
-    int16x8_t v93 = vld1q_s16(in + in_stride * 116 + i);
-    int16x8_t v94 = vld1q_s16(in + in_stride * 108 + i);
-    int16x8_t v95 = vaddq_s16(v93, v94);
-    int16x8_t v96 = vaddq_s16(v95, v85);
-    int16x8_t v97 = vaddq_s16(v96, v91);
-    int16x8_t v98 = vaddq_s16(v92, v97);
-    int16x8_t v99 = vqrdmulhq_n_s16(v98, 17734);
-    int16x8_t v100 = vaddq_s16(v90, v99);
-    int16x8_t v101 = vqrdmulhq_n_s16(v100, 16705);
-    int16x8_t v102 = vaddq_s16(v78, v101);
-    int16x8_t v103 = vaddq_s16(v80, v62);
-    int16x8_t v104_tmp = vqrdmulhq_n_s16(v103, 13573);
-    int16x8_t v104 = vaddq_s16(v104_tmp, v103);
-    int16x8_t v105 = vaddq_s16(v84, v64);
-    int16x8_t v106 = vaddq_s16(v65, v86);
-    int16x8_t v107 = vaddq_s16(v105, v106);
-    int16x8_t v108 = vaddq_s16(v104, v107);
-    int16x8_t v109 = vaddq_s16(v87, v68);
-    int16x8_t v110 = vaddq_s16(v69, v79);
-    int16x8_t v111 = vaddq_s16(v109, v110);
-    int16x8_t v112_tmp = vqrdmulhq_n_s16(v111, 13573);
-    int16x8_t v112 = vaddq_s16(v112_tmp, v111);
-    int16x8_t v113 = vaddq_s16(v94, v72);
-    int16x8_t v114 = vaddq_s16(v73, v83);
-    int16x8_t v115 = vaddq_s16(v113, v114);
-    int16x8_t v116 = vaddq_s16(v115, v111);
-    int16x8_t v117 = vaddq_s16(v112, v116);
-    int16x8_t v118 = vqrdmulhq_n_s16(v117, 17734);
-    int16x8_t v119 = vaddq_s16(v108, v118);
-    int16x8_t v120 = vaddq_s16(v110, v103);
-    int16x8_t v121_tmp = vqrdmulhq_n_s16(v120, 13573);
-    int16x8_t v121 = vaddq_s16(v121_tmp, v120);
-    int16x8_t v122 = vaddq_s16(v114, v105);
-    int16x8_t v123 = vaddq_s16(v106, v109);
-    int16x8_t v124 = vaddq_s16(v122, v123);
-    int16x8_t v125 = vaddq_s16(v121, v124);
-    int16x8_t v126 = vaddq_s16(v123, v120);
-    int16x8_t v127_tmp = vqrdmulhq_n_s16(v126, 13573);
-    int16x8_t v127 = vaddq_s16(v127_tmp, v126);
-    int16x8_t v128 = vld1q_s16(in + in_stride * 124 + i);
-    int16x8_t v129 = vaddq_s16(v128, v93);
-    int16x8_t v130 = vaddq_s16(v129, v113);
-    int16x8_t v131 = vaddq_s16(v130, v122);
-    int16x8_t v132 = vaddq_s16(v131, v126);
-    int16x8_t v133 = vaddq_s16(v127, v132);
-    int16x8_t v134 = vqrdmulhq_n_s16(v133, 17734);
-    int16x8_t v135 = vaddq_s16(v125, v134);
-    int16x8_t v136 = vqrdmulhq_n_s16(v135, 16705);
-    int16x8_t v137 = vaddq_s16(v119, v136);
-    int16x8_t v138 = vqrdmulhq_n_s16(v137, 16463);
-    int16x8_t v139 = vaddq_s16(v102, v138);
-    int16x8_t v140 = vqrdmulhq_n_s16(v139, 16404);
-    int16x8_t v141 = vaddq_s16(v61, v140);
-    int16x8_t v142 = vld1q_s16(in + in_stride * 2 + i);
-    int16x8_t v143_tmp = vqrdmulhq_n_s16(v142, 13573);
-    int16x8_t v143 = vaddq_s16(v143_tmp, v142);
-    int16x8_t v144 = vld1q_s16(in + in_stride * 66 + i);
-    int16x8_t v145 = vld1q_s16(in + in_stride * 62 + i);
-    int16x8_t v146 = vaddq_s16(v144, v145);
-    int16x8_t v147 = vaddq_s16(v143, v146);
-    int16x8_t v148 = vld1q_s16(in + in_stride * 34 + i);
-    int16x8_t v149 = vld1q_s16(in + in_stride * 30 + i);
-    int16x8_t v150 = vaddq_s16(v148, v149);
-    int16x8_t v151_tmp = vqrdmulhq_n_s16(v150, 13573);
-    int16x8_t v151 = vaddq_s16(v151_tmp, v150);
-    int16x8_t v152 = vld1q_s16(in + in_stride * 98 + i);
-    int16x8_t v153 = vld1q_s16(in + in_stride * 94 + i);
-    int16x8_t v154 = vaddq_s16(v152, v153);
-    int16x8_t v155 = vaddq_s16(v154, v150);
-    int16x8_t v156 = vaddq_s16(v151, v155);
-    int16x8_t v157 = vqrdmulhq_n_s16(v156, 17734);
-    int16x8_t v158 = vaddq_s16(v147, v157);
-    int16x8_t v159 = vld1q_s16(in + in_stride * 18 + i);
-    int16x8_t v160 = vld1q_s16(in + in_stride * 14 + i);
-    int16x8_t v161 = vaddq_s16(v159, v160);
-    int16x8_t v162_tmp = vqrdmulhq_n_s16(v161, 13573);
-    int16x8_t v162 = vaddq_s16(v162_tmp, v161);
-    int16x8_t v163 = vld1q_s16(in + in_stride * 82 + i);
-    int16x8_t v164 = vld1q_s16(in + in_stride * 78 + i);
-    int16x8_t v165 = vaddq_s16(v163, v164);
-    int16x8_t v166 = vld1q_s16(in + in_stride * 50 + i);
-    int16x8_t v167 = vld1q_s16(in + in_stride * 46 + i);
-    int16x8_t v168 = vaddq_s16(v166, v167);
-    int16x8_t v169 = vaddq_s16(v165, v168);
-    int16x8_t v170 = vaddq_s16(v162, v169);
-    int16x8_t v171 = vaddq_s16(v168, v161);
-    int16x8_t v172_tmp = vqrdmulhq_n_s16(v171, 13573);
-    int16x8_t v172 = vaddq_s16(v172_tmp, v171);
-    int16x8_t v173 = vld1q_s16(in + in_stride * 114 + i);
-    int16x8_t v174 = vld1q_s16(in + in_stride * 110 + i);
-    int16x8_t v175 = vaddq_s16(v173, v174);
-    int16x8_t v176 = vaddq_s16(v175, v165);
-    int16x8_t v177 = vaddq_s16(v176, v171);
-    int16x8_t v178 = vaddq_s16(v172, v177);
-    int16x8_t v179 = vqrdmulhq_n_s16(v178, 17734);
-    int16x8_t v180 = vaddq_s16(v170, v179);
-    int16x8_t v181 = vqrdmulhq_n_s16(v180, 16705);
-    int16x8_t v182 = vaddq_s16(v158, v181);
-    int16x8_t v183 = vld1q_s16(in + in_stride * 10 + i);
-    int16x8_t v184 = vld1q_s16(in + in_stride * 6 + i);
-    int16x8_t v185 = vaddq_s16(v183, v184);
-    int16x8_t v186_tmp = vqrdmulhq_n_s16(v185, 13573);
-    int16x8_t v186 = vaddq_s16(v186_tmp, v185);
-    int16x8_t v187 = vld1q_s16(in + in_stride * 74 + i);
-    int16x8_t v188 = vld1q_s16(in + in_stride * 70 + i);
-    int16x8_t v189 = vaddq_s16(v187, v188);
-    int16x8_t v190 = vld1q_s16(in + in_stride * 58 + i);
-    int16x8_t v191 = vld1q_s16(in + in_stride * 54 + i);
-    int16x8_t v192 = vaddq_s16(v190, v191);
-    int16x8_t v193 = vaddq_s16(v189, v192);
-    int16x8_t v194 = vaddq_s16(v186, v193);
-    int16x8_t v195 = vld1q_s16(in + in_stride * 42 + i);
-    int16x8_t v196 = vld1q_s16(in + in_stride * 38 + i);
-    int16x8_t v197 = vaddq_s16(v195, v196);
-    int16x8_t v198 = vld1q_s16(in + in_stride * 26 + i);
-    int16x8_t v199 = vld1q_s16(in + in_stride * 22 + i);
-    int16x8_t v200 = vaddq_s16(v198, v199);
-    int16x8_t v201 = vaddq_s16(v197, v200);
-    int16x8_t v202_tmp = vqrdmulhq_n_s16(v201, 13573);
-    int16x8_t v202 = vaddq_s16(v202_tmp, v201);
-    int16x8_t v203 = vld1q_s16(in + in_stride * 106 + i);
-    int16x8_t v204 = vld1q_s16(in + in_stride * 102 + i);
-    int16x8_t v205 = vaddq_s16(v203, v204);
-    int16x8_t v206 = vld1q_s16(in + in_stride * 90 + i);
-    int16x8_t v207 = vld1q_s16(in + in_stride * 86 + i);
-    int16x8_t v208 = vaddq_s16(v206, v207);
-    int16x8_t v209 = vaddq_s16(v205, v208);
-    int16x8_t v210 = vaddq_s16(v209, v201);
-    int16x8_t v211 = vaddq_s16(v202, v210);
-    int16x8_t v212 = vqrdmulhq_n_s16(v211, 17734);
-    int16x8_t v213 = vaddq_s16(v194, v212);
-    int16x8_t v214 = vaddq_s16(v200, v185);
-    int16x8_t v215_tmp = vqrdmulhq_n_s16(v214, 13573);
-    int16x8_t v215 = vaddq_s16(v215_tmp, v214);
-    int16x8_t v216 = vaddq_s16(v208, v189);
-    int16x8_t v217 = vaddq_s16(v192, v197);
-    int16x8_t v218 = vaddq_s16(v216, v217);
-    int16x8_t v219 = vaddq_s16(v215, v218);
-    int16x8_t v220 = vaddq_s16(v217, v214);
-    int16x8_t v221_tmp = vqrdmulhq_n_s16(v220, 13573);
-    int16x8_t v221 = vaddq_s16(v221_tmp, v220);
-    int16x8_t v222 = vld1q_s16(in + in_stride * 122 + i);
-    int16x8_t v223 = vld1q_s16(in + in_stride * 118 + i);
-    int16x8_t v224 = vaddq_s16(v222, v223);
-    int16x8_t v225 = vaddq_s16(v224, v205);
-    int16x8_t v226 = vaddq_s16(v225, v216);
-    int16x8_t v227 = vaddq_s16(v226, v220);
-    int16x8_t v228 = vaddq_s16(v221, v227);
-    int16x8_t v229 = vqrdmulhq_n_s16(v228, 17734);
-    int16x8_t v230 = vaddq_s16(v219, v229);
-    int16x8_t v231 = vqrdmulhq_n_s16(v230, 16705);
-    int16x8_t v232 = vaddq_s16(v213, v231);
-    int16x8_t v233 = vqrdmulhq_n_s16(v232, 16463);
-    int16x8_t v234 = vaddq_s16(v182, v233);
-    int16x8_t v235 = vaddq_s16(v184, v142);
-    int16x8_t v236_tmp = vqrdmulhq_n_s16(v235, 13573);
-    int16x8_t v236 = vaddq_s16(v236_tmp, v235);
-    int16x8_t v237 = vaddq_s16(v188, v144);
-    int16x8_t v238 = vaddq_s16(v145, v190);
-    int16x8_t v239 = vaddq_s16(v237, v238);
-    int16x8_t v240 = vaddq_s16(v236, v239);
-    int16x8_t v241 = vaddq_s16(v196, v148);
-    int16x8_t v242 = vaddq_s16(v149, v198);
-    int16x8_t v243 = vaddq_s16(v241, v242);
-    int16x8_t v244_tmp = vqrdmulhq_n_s16(v243, 13573);
-    int16x8_t v244 = vaddq_s16(v244_tmp, v243);
-    int16x8_t v245 = vaddq_s16(v204, v152);
-    int16x8_t v246 = vaddq_s16(v153, v206);
-    int16x8_t v247 = vaddq_s16(v245, v246);
-    int16x8_t v248 = vaddq_s16(v247, v243);
-    int16x8_t v249 = vaddq_s16(v244, v248);
-    int16x8_t v250 = vqrdmulhq_n_s16(v249, 17734);
-    int16x8_t v251 = vaddq_s16(v240, v250);
-    int16x8_t v252 = vaddq_s16(v199, v159);
-    int16x8_t v253 = vaddq_s16(v160, v183);
-    int16x8_t v254 = vaddq_s16(v252, v253);
-    int16x8_t v255_tmp = vqrdmulhq_n_s16(v254, 13573);
-    int16x8_t v255 = vaddq_s16(v255_tmp, v254);
-    int16x8_t v256 = vaddq_s16(v207, v163);
-    int16x8_t v257 = vaddq_s16(v164, v187);
-    int16x8_t v258 = vaddq_s16(v256, v257);
-    int16x8_t v259 = vaddq_s16(v191, v166);
-    int16x8_t v260 = vaddq_s16(v167, v195);
-    int16x8_t v261 = vaddq_s16(v259, v260);
-    int16x8_t v262 = vaddq_s16(v258, v261);
-    int16x8_t v263 = vaddq_s16(v255, v262);
-    int16x8_t v264 = vaddq_s16(v261, v254);
-    int16x8_t v265_tmp = vqrdmulhq_n_s16(v264, 13573);
-    int16x8_t v265 = vaddq_s16(v265_tmp, v264);
-    int16x8_t v266 = vaddq_s16(v223, v173);
-    int16x8_t v267 = vaddq_s16(v174, v203);
-    int16x8_t v268 = vaddq_s16(v266, v267);
-    int16x8_t v269 = vaddq_s16(v268, v258);
-    int16x8_t v270 = vaddq_s16(v269, v264);
-    int16x8_t v271 = vaddq_s16(v265, v270);
-    int16x8_t v272 = vqrdmulhq_n_s16(v271, 17734);
-    int16x8_t v273 = vaddq_s16(v263, v272);
-    int16x8_t v274 = vqrdmulhq_n_s16(v273, 16705);
-    int16x8_t v275 = vaddq_s16(v251, v274);
-    int16x8_t v276 = vaddq_s16(v253, v235);
-    int16x8_t v277_tmp = vqrdmulhq_n_s16(v276, 13573);
-    int16x8_t v277 = vaddq_s16(v277_tmp, v276);
-    int16x8_t v278 = vaddq_s16(v257, v237);
-    int16x8_t v279 = vaddq_s16(v238, v259);
-    int16x8_t v280 = vaddq_s16(v278, v279);
-    int16x8_t v281 = vaddq_s16(v277, v280);
-    int16x8_t v282 = vaddq_s16(v260, v241);
-    int16x8_t v283 = vaddq_s16(v242, v252);
-    int16x8_t v284 = vaddq_s16(v282, v283);
-    int16x8_t v285_tmp = vqrdmulhq_n_s16(v284, 13573);
-    int16x8_t v285 = vaddq_s16(v285_tmp, v284);
-    int16x8_t v286 = vaddq_s16(v267, v245);
-    int16x8_t v287 = vaddq_s16(v246, v256);
-    int16x8_t v288 = vaddq_s16(v286, v287);
-    int16x8_t v289 = vaddq_s16(v288, v284);
-    int16x8_t v290 = vaddq_s16(v285, v289);
-    int16x8_t v291 = vqrdmulhq_n_s16(v290, 17734);
-    int16x8_t v292 = vaddq_s16(v281, v291);
-    int16x8_t v293 = vaddq_s16(v283, v276);
-    int16x8_t v294_tmp = vqrdmulhq_n_s16(v293, 13573);
-    int16x8_t v294 = vaddq_s16(v294_tmp, v293);
-    int16x8_t v295 = vaddq_s16(v287, v278);
-    int16x8_t v296 = vaddq_s16(v279, v282);
-    int16x8_t v297 = vaddq_s16(v295, v296);
-    int16x8_t v298 = vaddq_s16(v294, v297);
-    int16x8_t v299 = vaddq_s16(v296, v293);
-    int16x8_t v300_tmp = vqrdmulhq_n_s16(v299, 13573);
-    int16x8_t v300 = vaddq_s16(v300_tmp, v299);
-    int16x8_t v301 = vld1q_s16(in + in_stride * 126 + i);
-    int16x8_t v302 = vaddq_s16(v301, v222);
-    int16x8_t v303 = vaddq_s16(v302, v266);
-    int16x8_t v304 = vaddq_s16(v303, v286);
-    int16x8_t v305 = vaddq_s16(v304, v295);
-    int16x8_t v306 = vaddq_s16(v305, v299);
-    int16x8_t v307 = vaddq_s16(v300, v306);
-    int16x8_t v308 = vqrdmulhq_n_s16(v307, 17734);
-    int16x8_t v309 = vaddq_s16(v298, v308);
-    int16x8_t v310 = vqrdmulhq_n_s16(v309, 16705);
-    int16x8_t v311 = vaddq_s16(v292, v310);
-    int16x8_t v312 = vqrdmulhq_n_s16(v311, 16463);
-    int16x8_t v313 = vaddq_s16(v275, v312);
-    int16x8_t v314 = vqrdmulhq_n_s16(v313, 16404);
-    int16x8_t v315 = vaddq_s16(v234, v314);
-    int16x8_t v316 = vqrdmulhq_n_s16(v315, 16389);
-    int16x8_t v317 = vaddq_s16(v141, v316);
-    int16x8_t v318 = vld1q_s16(in + in_stride * 1 + i);
-    int16x8_t v319_tmp = vqrdmulhq_n_s16(v318, 13573);
-    int16x8_t v319 = vaddq_s16(v319_tmp, v318);
-    int16x8_t v320 = vld1q_s16(in + in_stride * 65 + i);
-    int16x8_t v321 = vld1q_s16(in + in_stride * 63 + i);
-    int16x8_t v322 = vaddq_s16(v320, v321);
-    int16x8_t v323 = vaddq_s16(v319, v322);
-    int16x8_t v324 = vld1q_s16(in + in_stride * 33 + i);
-    int16x8_t v325 = vld1q_s16(in + in_stride * 31 + i);
-    int16x8_t v326 = vaddq_s16(v324, v325);
-    int16x8_t v327_tmp = vqrdmulhq_n_s16(v326, 13573);
-    int16x8_t v327 = vaddq_s16(v327_tmp, v326);
-    int16x8_t v328 = vld1q_s16(in + in_stride * 97 + i);
-    int16x8_t v329 = vld1q_s16(in + in_stride * 95 + i);
-    int16x8_t v330 = vaddq_s16(v328, v329);
-    int16x8_t v331 = vaddq_s16(v330, v326);
-    int16x8_t v332 = vaddq_s16(v327, v331);
-    int16x8_t v333 = vqrdmulhq_n_s16(v332, 17734);
-    int16x8_t v334 = vaddq_s16(v323, v333);
-    int16x8_t v335 = vld1q_s16(in + in_stride * 17 + i);
-    int16x8_t v336 = vld1q_s16(in + in_stride * 15 + i);
-    int16x8_t v337 = vaddq_s16(v335, v336);
-    int16x8_t v338_tmp = vqrdmulhq_n_s16(v337, 13573);
-    int16x8_t v338 = vaddq_s16(v338_tmp, v337);
-    int16x8_t v339 = vld1q_s16(in + in_stride * 81 + i);
-    int16x8_t v340 = vld1q_s16(in + in_stride * 79 + i);
-    int16x8_t v341 = vaddq_s16(v339, v340);
-    int16x8_t v342 = vld1q_s16(in + in_stride * 49 + i);
-    int16x8_t v343 = vld1q_s16(in + in_stride * 47 + i);
-    int16x8_t v344 = vaddq_s16(v342, v343);
-    int16x8_t v345 = vaddq_s16(v341, v344);
-    int16x8_t v346 = vaddq_s16(v338, v345);
-    int16x8_t v347 = vaddq_s16(v344, v337);
-    int16x8_t v348_tmp = vqrdmulhq_n_s16(v347, 13573);
-    int16x8_t v348 = vaddq_s16(v348_tmp, v347);
-    int16x8_t v349 = vld1q_s16(in + in_stride * 113 + i);
-    int16x8_t v350 = vld1q_s16(in + in_stride * 111 + i);
-    int16x8_t v351 = vaddq_s16(v349, v350);
-    int16x8_t v352 = vaddq_s16(v351, v341);
-    int16x8_t v353 = vaddq_s16(v352, v347);
-    int16x8_t v354 = vaddq_s16(v348, v353);
-    int16x8_t v355 = vqrdmulhq_n_s16(v354, 17734);
-    int16x8_t v356 = vaddq_s16(v346, v355);
-    int16x8_t v357 = vqrdmulhq_n_s16(v356, 16705);
-    int16x8_t v358 = vaddq_s16(v334, v357);
-    int16x8_t v359 = vld1q_s16(in + in_stride * 9 + i);
-    int16x8_t v360 = vld1q_s16(in + in_stride * 7 + i);
-    int16x8_t v361 = vaddq_s16(v359, v360);
-    int16x8_t v362_tmp = vqrdmulhq_n_s16(v361, 13573);
-    int16x8_t v362 = vaddq_s16(v362_tmp, v361);
-    int16x8_t v363 = vld1q_s16(in + in_stride * 73 + i);
-    int16x8_t v364 = vld1q_s16(in + in_stride * 71 + i);
-    int16x8_t v365 = vaddq_s16(v363, v364);
-    int16x8_t v366 = vld1q_s16(in + in_stride * 57 + i);
-    int16x8_t v367 = vld1q_s16(in + in_stride * 55 + i);
-    int16x8_t v368 = vaddq_s16(v366, v367);
-    int16x8_t v369 = vaddq_s16(v365, v368);
-    int16x8_t v370 = vaddq_s16(v362, v369);
-    int16x8_t v371 = vld1q_s16(in + in_stride * 41 + i);
-    int16x8_t v372 = vld1q_s16(in + in_stride * 39 + i);
-    int16x8_t v373 = vaddq_s16(v371, v372);
-    int16x8_t v374 = vld1q_s16(in + in_stride * 25 + i);
-    int16x8_t v375 = vld1q_s16(in + in_stride * 23 + i);
-    int16x8_t v376 = vaddq_s16(v374, v375);
-    int16x8_t v377 = vaddq_s16(v373, v376);
-    int16x8_t v378_tmp = vqrdmulhq_n_s16(v377, 13573);
-    int16x8_t v378 = vaddq_s16(v378_tmp, v377);
-    int16x8_t v379 = vld1q_s16(in + in_stride * 105 + i);
-    int16x8_t v380 = vld1q_s16(in + in_stride * 103 + i);
-    int16x8_t v381 = vaddq_s16(v379, v380);
-    int16x8_t v382 = vld1q_s16(in + in_stride * 89 + i);
-    int16x8_t v383 = vld1q_s16(in + in_stride * 87 + i);
-    int16x8_t v384 = vaddq_s16(v382, v383);
-    int16x8_t v385 = vaddq_s16(v381, v384);
-    int16x8_t v386 = vaddq_s16(v385, v377);
-    int16x8_t v387 = vaddq_s16(v378, v386);
-    int16x8_t v388 = vqrdmulhq_n_s16(v387, 17734);
-    int16x8_t v389 = vaddq_s16(v370, v388);
-    int16x8_t v390 = vaddq_s16(v376, v361);
-    int16x8_t v391_tmp = vqrdmulhq_n_s16(v390, 13573);
-    int16x8_t v391 = vaddq_s16(v391_tmp, v390);
-    int16x8_t v392 = vaddq_s16(v384, v365);
-    int16x8_t v393 = vaddq_s16(v368, v373);
-    int16x8_t v394 = vaddq_s16(v392, v393);
-    int16x8_t v395 = vaddq_s16(v391, v394);
-    int16x8_t v396 = vaddq_s16(v393, v390);
-    int16x8_t v397_tmp = vqrdmulhq_n_s16(v396, 13573);
-    int16x8_t v397 = vaddq_s16(v397_tmp, v396);
-    int16x8_t v398 = vld1q_s16(in + in_stride * 121 + i);
-    int16x8_t v399 = vld1q_s16(in + in_stride * 119 + i);
-    int16x8_t v400 = vaddq_s16(v398, v399);
-    int16x8_t v401 = vaddq_s16(v400, v381);
-    int16x8_t v402 = vaddq_s16(v401, v392);
-    int16x8_t v403 = vaddq_s16(v402, v396);
-    int16x8_t v404 = vaddq_s16(v397, v403);
-    int16x8_t v405 = vqrdmulhq_n_s16(v404, 17734);
-    int16x8_t v406 = vaddq_s16(v395, v405);
-    int16x8_t v407 = vqrdmulhq_n_s16(v406, 16705);
-    int16x8_t v408 = vaddq_s16(v389, v407);
-    int16x8_t v409 = vqrdmulhq_n_s16(v408, 16463);
-    int16x8_t v410 = vaddq_s16(v358, v409);
-    int16x8_t v411 = vld1q_s16(in + in_stride * 5 + i);
-    int16x8_t v412 = vld1q_s16(in + in_stride * 3 + i);
-    int16x8_t v413 = vaddq_s16(v411, v412);
-    int16x8_t v414_tmp = vqrdmulhq_n_s16(v413, 13573);
-    int16x8_t v414 = vaddq_s16(v414_tmp, v413);
-    int16x8_t v415 = vld1q_s16(in + in_stride * 69 + i);
-    int16x8_t v416 = vld1q_s16(in + in_stride * 67 + i);
-    int16x8_t v417 = vaddq_s16(v415, v416);
-    int16x8_t v418 = vld1q_s16(in + in_stride * 61 + i);
-    int16x8_t v419 = vld1q_s16(in + in_stride * 59 + i);
-    int16x8_t v420 = vaddq_s16(v418, v419);
-    int16x8_t v421 = vaddq_s16(v417, v420);
-    int16x8_t v422 = vaddq_s16(v414, v421);
-    int16x8_t v423 = vld1q_s16(in + in_stride * 37 + i);
-    int16x8_t v424 = vld1q_s16(in + in_stride * 35 + i);
-    int16x8_t v425 = vaddq_s16(v423, v424);
-    int16x8_t v426 = vld1q_s16(in + in_stride * 29 + i);
-    int16x8_t v427 = vld1q_s16(in + in_stride * 27 + i);
-    int16x8_t v428 = vaddq_s16(v426, v427);
-    int16x8_t v429 = vaddq_s16(v425, v428);
-    int16x8_t v430_tmp = vqrdmulhq_n_s16(v429, 13573);
-    int16x8_t v430 = vaddq_s16(v430_tmp, v429);
-    int16x8_t v431 = vld1q_s16(in + in_stride * 101 + i);
-    int16x8_t v432 = vld1q_s16(in + in_stride * 99 + i);
-    int16x8_t v433 = vaddq_s16(v431, v432);
-    int16x8_t v434 = vld1q_s16(in + in_stride * 93 + i);
-    int16x8_t v435 = vld1q_s16(in + in_stride * 91 + i);
-    int16x8_t v436 = vaddq_s16(v434, v435);
-    int16x8_t v437 = vaddq_s16(v433, v436);
-    int16x8_t v438 = vaddq_s16(v437, v429);
-    int16x8_t v439 = vaddq_s16(v430, v438);
-    int16x8_t v440 = vqrdmulhq_n_s16(v439, 17734);
-    int16x8_t v441 = vaddq_s16(v422, v440);
-    int16x8_t v442 = vld1q_s16(in + in_stride * 21 + i);
-    int16x8_t v443 = vld1q_s16(in + in_stride * 19 + i);
-    int16x8_t v444 = vaddq_s16(v442, v443);
-    int16x8_t v445 = vld1q_s16(in + in_stride * 13 + i);
-    int16x8_t v446 = vld1q_s16(in + in_stride * 11 + i);
-    int16x8_t v447 = vaddq_s16(v445, v446);
-    int16x8_t v448 = vaddq_s16(v444, v447);
-    int16x8_t v449_tmp = vqrdmulhq_n_s16(v448, 13573);
-    int16x8_t v449 = vaddq_s16(v449_tmp, v448);
-    int16x8_t v450 = vld1q_s16(in + in_stride * 85 + i);
-    int16x8_t v451 = vld1q_s16(in + in_stride * 83 + i);
-    int16x8_t v452 = vaddq_s16(v450, v451);
-    int16x8_t v453 = vld1q_s16(in + in_stride * 77 + i);
-    int16x8_t v454 = vld1q_s16(in + in_stride * 75 + i);
-    int16x8_t v455 = vaddq_s16(v453, v454);
-    int16x8_t v456 = vaddq_s16(v452, v455);
-    int16x8_t v457 = vld1q_s16(in + in_stride * 53 + i);
-    int16x8_t v458 = vld1q_s16(in + in_stride * 51 + i);
-    int16x8_t v459 = vaddq_s16(v457, v458);
-    int16x8_t v460 = vld1q_s16(in + in_stride * 45 + i);
-    int16x8_t v461 = vld1q_s16(in + in_stride * 43 + i);
-    int16x8_t v462 = vaddq_s16(v460, v461);
-    int16x8_t v463 = vaddq_s16(v459, v462);
-    int16x8_t v464 = vaddq_s16(v456, v463);
-    int16x8_t v465 = vaddq_s16(v449, v464);
-    int16x8_t v466 = vaddq_s16(v463, v448);
-    int16x8_t v467_tmp = vqrdmulhq_n_s16(v466, 13573);
-    int16x8_t v467 = vaddq_s16(v467_tmp, v466);
-    int16x8_t v468 = vld1q_s16(in + in_stride * 117 + i);
-    int16x8_t v469 = vld1q_s16(in + in_stride * 115 + i);
-    int16x8_t v470 = vaddq_s16(v468, v469);
-    int16x8_t v471 = vld1q_s16(in + in_stride * 109 + i);
-    int16x8_t v472 = vld1q_s16(in + in_stride * 107 + i);
-    int16x8_t v473 = vaddq_s16(v471, v472);
-    int16x8_t v474 = vaddq_s16(v470, v473);
-    int16x8_t v475 = vaddq_s16(v474, v456);
-    int16x8_t v476 = vaddq_s16(v475, v466);
-    int16x8_t v477 = vaddq_s16(v467, v476);
-    int16x8_t v478 = vqrdmulhq_n_s16(v477, 17734);
-    int16x8_t v479 = vaddq_s16(v465, v478);
-    int16x8_t v480 = vqrdmulhq_n_s16(v479, 16705);
-    int16x8_t v481 = vaddq_s16(v441, v480);
-    int16x8_t v482 = vaddq_s16(v447, v413);
-    int16x8_t v483_tmp = vqrdmulhq_n_s16(v482, 13573);
-    int16x8_t v483 = vaddq_s16(v483_tmp, v482);
-    int16x8_t v484 = vaddq_s16(v455, v417);
-    int16x8_t v485 = vaddq_s16(v420, v459);
-    int16x8_t v486 = vaddq_s16(v484, v485);
-    int16x8_t v487 = vaddq_s16(v483, v486);
-    int16x8_t v488 = vaddq_s16(v462, v425);
-    int16x8_t v489 = vaddq_s16(v428, v444);
-    int16x8_t v490 = vaddq_s16(v488, v489);
-    int16x8_t v491_tmp = vqrdmulhq_n_s16(v490, 13573);
-    int16x8_t v491 = vaddq_s16(v491_tmp, v490);
-    int16x8_t v492 = vaddq_s16(v473, v433);
-    int16x8_t v493 = vaddq_s16(v436, v452);
-    int16x8_t v494 = vaddq_s16(v492, v493);
-    int16x8_t v495 = vaddq_s16(v494, v490);
-    int16x8_t v496 = vaddq_s16(v491, v495);
-    int16x8_t v497 = vqrdmulhq_n_s16(v496, 17734);
-    int16x8_t v498 = vaddq_s16(v487, v497);
-    int16x8_t v499 = vaddq_s16(v489, v482);
-    int16x8_t v500_tmp = vqrdmulhq_n_s16(v499, 13573);
-    int16x8_t v500 = vaddq_s16(v500_tmp, v499);
-    int16x8_t v501 = vaddq_s16(v493, v484);
-    int16x8_t v502 = vaddq_s16(v485, v488);
-    int16x8_t v503 = vaddq_s16(v501, v502);
-    int16x8_t v504 = vaddq_s16(v500, v503);
-    int16x8_t v505 = vaddq_s16(v502, v499);
-    int16x8_t v506_tmp = vqrdmulhq_n_s16(v505, 13573);
-    int16x8_t v506 = vaddq_s16(v506_tmp, v505);
-    int16x8_t v507 = vld1q_s16(in + in_stride * 125 + i);
-    int16x8_t v508 = vld1q_s16(in + in_stride * 123 + i);
-    int16x8_t v509 = vaddq_s16(v507, v508);
-    int16x8_t v510 = vaddq_s16(v509, v470);
-    int16x8_t v511 = vaddq_s16(v510, v492);
-    int16x8_t v512 = vaddq_s16(v511, v501);
-    int16x8_t v513 = vaddq_s16(v512, v505);
-    int16x8_t v514 = vaddq_s16(v506, v513);
-    int16x8_t v515 = vqrdmulhq_n_s16(v514, 17734);
-    int16x8_t v516 = vaddq_s16(v504, v515);
-    int16x8_t v517 = vqrdmulhq_n_s16(v516, 16705);
-    int16x8_t v518 = vaddq_s16(v498, v517);
-    int16x8_t v519 = vqrdmulhq_n_s16(v518, 16463);
-    int16x8_t v520 = vaddq_s16(v481, v519);
-    int16x8_t v521 = vqrdmulhq_n_s16(v520, 16404);
-    int16x8_t v522 = vaddq_s16(v410, v521);
-    int16x8_t v523 = vaddq_s16(v412, v318);
-    int16x8_t v524_tmp = vqrdmulhq_n_s16(v523, 13573);
-    int16x8_t v524 = vaddq_s16(v524_tmp, v523);
-    int16x8_t v525 = vaddq_s16(v416, v320);
-    int16x8_t v526 = vaddq_s16(v321, v418);
-    int16x8_t v527 = vaddq_s16(v525, v526);
-    int16x8_t v528 = vaddq_s16(v524, v527);
-    int16x8_t v529 = vaddq_s16(v424, v324);
-    int16x8_t v530 = vaddq_s16(v325, v426);
-    int16x8_t v531 = vaddq_s16(v529, v530);
-    int16x8_t v532_tmp = vqrdmulhq_n_s16(v531, 13573);
-    int16x8_t v532 = vaddq_s16(v532_tmp, v531);
-    int16x8_t v533 = vaddq_s16(v432, v328);
-    int16x8_t v534 = vaddq_s16(v329, v434);
-    int16x8_t v535 = vaddq_s16(v533, v534);
-    int16x8_t v536 = vaddq_s16(v535, v531);
-    int16x8_t v537 = vaddq_s16(v532, v536);
-    int16x8_t v538 = vqrdmulhq_n_s16(v537, 17734);
-    int16x8_t v539 = vaddq_s16(v528, v538);
-    int16x8_t v540 = vaddq_s16(v443, v335);
-    int16x8_t v541 = vaddq_s16(v336, v445);
-    int16x8_t v542 = vaddq_s16(v540, v541);
-    int16x8_t v543_tmp = vqrdmulhq_n_s16(v542, 13573);
-    int16x8_t v543 = vaddq_s16(v543_tmp, v542);
-    int16x8_t v544 = vaddq_s16(v451, v339);
-    int16x8_t v545 = vaddq_s16(v340, v453);
-    int16x8_t v546 = vaddq_s16(v544, v545);
-    int16x8_t v547 = vaddq_s16(v458, v342);
-    int16x8_t v548 = vaddq_s16(v343, v460);
-    int16x8_t v549 = vaddq_s16(v547, v548);
-    int16x8_t v550 = vaddq_s16(v546, v549);
-    int16x8_t v551 = vaddq_s16(v543, v550);
-    int16x8_t v552 = vaddq_s16(v549, v542);
-    int16x8_t v553_tmp = vqrdmulhq_n_s16(v552, 13573);
-    int16x8_t v553 = vaddq_s16(v553_tmp, v552);
-    int16x8_t v554 = vaddq_s16(v469, v349);
-    int16x8_t v555 = vaddq_s16(v350, v471);
-    int16x8_t v556 = vaddq_s16(v554, v555);
-    int16x8_t v557 = vaddq_s16(v556, v546);
-    int16x8_t v558 = vaddq_s16(v557, v552);
-    int16x8_t v559 = vaddq_s16(v553, v558);
-    int16x8_t v560 = vqrdmulhq_n_s16(v559, 17734);
-    int16x8_t v561 = vaddq_s16(v551, v560);
-    int16x8_t v562 = vqrdmulhq_n_s16(v561, 16705);
-    int16x8_t v563 = vaddq_s16(v539, v562);
-    int16x8_t v564 = vaddq_s16(v446, v359);
-    int16x8_t v565 = vaddq_s16(v360, v411);
-    int16x8_t v566 = vaddq_s16(v564, v565);
-    int16x8_t v567_tmp = vqrdmulhq_n_s16(v566, 13573);
-    int16x8_t v567 = vaddq_s16(v567_tmp, v566);
-    int16x8_t v568 = vaddq_s16(v454, v363);
-    int16x8_t v569 = vaddq_s16(v364, v415);
-    int16x8_t v570 = vaddq_s16(v568, v569);
-    int16x8_t v571 = vaddq_s16(v419, v366);
-    int16x8_t v572 = vaddq_s16(v367, v457);
-    int16x8_t v573 = vaddq_s16(v571, v572);
-    int16x8_t v574 = vaddq_s16(v570, v573);
-    int16x8_t v575 = vaddq_s16(v567, v574);
-    int16x8_t v576 = vaddq_s16(v461, v371);
-    int16x8_t v577 = vaddq_s16(v372, v423);
-    int16x8_t v578 = vaddq_s16(v576, v577);
-    int16x8_t v579 = vaddq_s16(v427, v374);
-    int16x8_t v580 = vaddq_s16(v375, v442);
-    int16x8_t v581 = vaddq_s16(v579, v580);
-    int16x8_t v582 = vaddq_s16(v578, v581);
-    int16x8_t v583_tmp = vqrdmulhq_n_s16(v582, 13573);
-    int16x8_t v583 = vaddq_s16(v583_tmp, v582);
-    int16x8_t v584 = vaddq_s16(v472, v379);
-    int16x8_t v585 = vaddq_s16(v380, v431);
-    int16x8_t v586 = vaddq_s16(v584, v585);
-    int16x8_t v587 = vaddq_s16(v435, v382);
-    int16x8_t v588 = vaddq_s16(v383, v450);
-    int16x8_t v589 = vaddq_s16(v587, v588);
-    int16x8_t v590 = vaddq_s16(v586, v589);
-    int16x8_t v591 = vaddq_s16(v590, v582);
-    int16x8_t v592 = vaddq_s16(v583, v591);
-    int16x8_t v593 = vqrdmulhq_n_s16(v592, 17734);
-    int16x8_t v594 = vaddq_s16(v575, v593);
-    int16x8_t v595 = vaddq_s16(v581, v566);
-    int16x8_t v596_tmp = vqrdmulhq_n_s16(v595, 13573);
-    int16x8_t v596 = vaddq_s16(v596_tmp, v595);
-    int16x8_t v597 = vaddq_s16(v589, v570);
-    int16x8_t v598 = vaddq_s16(v573, v578);
-    int16x8_t v599 = vaddq_s16(v597, v598);
-    int16x8_t v600 = vaddq_s16(v596, v599);
-    int16x8_t v601 = vaddq_s16(v598, v595);
-    int16x8_t v602_tmp = vqrdmulhq_n_s16(v601, 13573);
-    int16x8_t v602 = vaddq_s16(v602_tmp, v601);
-    int16x8_t v603 = vaddq_s16(v508, v398);
-    int16x8_t v604 = vaddq_s16(v399, v468);
-    int16x8_t v605 = vaddq_s16(v603, v604);
-    int16x8_t v606 = vaddq_s16(v605, v586);
-    int16x8_t v607 = vaddq_s16(v606, v597);
-    int16x8_t v608 = vaddq_s16(v607, v601);
-    int16x8_t v609 = vaddq_s16(v602, v608);
-    int16x8_t v610 = vqrdmulhq_n_s16(v609, 17734);
-    int16x8_t v611 = vaddq_s16(v600, v610);
-    int16x8_t v612 = vqrdmulhq_n_s16(v611, 16705);
-    int16x8_t v613 = vaddq_s16(v594, v612);
-    int16x8_t v614 = vqrdmulhq_n_s16(v613, 16463);
-    int16x8_t v615 = vaddq_s16(v563, v614);
-    int16x8_t v616 = vaddq_s16(v565, v523);
-    int16x8_t v617_tmp = vqrdmulhq_n_s16(v616, 13573);
-    int16x8_t v617 = vaddq_s16(v617_tmp, v616);
-    int16x8_t v618 = vaddq_s16(v569, v525);
-    int16x8_t v619 = vaddq_s16(v526, v571);
-    int16x8_t v620 = vaddq_s16(v618, v619);
-    int16x8_t v621 = vaddq_s16(v617, v620);
-    int16x8_t v622 = vaddq_s16(v577, v529);
-    int16x8_t v623 = vaddq_s16(v530, v579);
-    int16x8_t v624 = vaddq_s16(v622, v623);
-    int16x8_t v625_tmp = vqrdmulhq_n_s16(v624, 13573);
-    int16x8_t v625 = vaddq_s16(v625_tmp, v624);
-    int16x8_t v626 = vaddq_s16(v585, v533);
-    int16x8_t v627 = vaddq_s16(v534, v587);
-    int16x8_t v628 = vaddq_s16(v626, v627);
-    int16x8_t v629 = vaddq_s16(v628, v624);
-    int16x8_t v630 = vaddq_s16(v625, v629);
-    int16x8_t v631 = vqrdmulhq_n_s16(v630, 17734);
-    int16x8_t v632 = vaddq_s16(v621, v631);
-    int16x8_t v633 = vaddq_s16(v580, v540);
-    int16x8_t v634 = vaddq_s16(v541, v564);
-    int16x8_t v635 = vaddq_s16(v633, v634);
-    int16x8_t v636_tmp = vqrdmulhq_n_s16(v635, 13573);
-    int16x8_t v636 = vaddq_s16(v636_tmp, v635);
-    int16x8_t v637 = vaddq_s16(v588, v544);
-    int16x8_t v638 = vaddq_s16(v545, v568);
-    int16x8_t v639 = vaddq_s16(v637, v638);
-    int16x8_t v640 = vaddq_s16(v572, v547);
-    int16x8_t v641 = vaddq_s16(v548, v576);
-    int16x8_t v642 = vaddq_s16(v640, v641);
-    int16x8_t v643 = vaddq_s16(v639, v642);
-    int16x8_t v644 = vaddq_s16(v636, v643);
-    int16x8_t v645 = vaddq_s16(v642, v635);
-    int16x8_t v646_tmp = vqrdmulhq_n_s16(v645, 13573);
-    int16x8_t v646 = vaddq_s16(v646_tmp, v645);
-    int16x8_t v647 = vaddq_s16(v604, v554);
-    int16x8_t v648 = vaddq_s16(v555, v584);
-    int16x8_t v649 = vaddq_s16(v647, v648);
-    int16x8_t v650 = vaddq_s16(v649, v639);
-    int16x8_t v651 = vaddq_s16(v650, v645);
-    int16x8_t v652 = vaddq_s16(v646, v651);
-    int16x8_t v653 = vqrdmulhq_n_s16(v652, 17734);
-    int16x8_t v654 = vaddq_s16(v644, v653);
-    int16x8_t v655 = vqrdmulhq_n_s16(v654, 16705);
-    int16x8_t v656 = vaddq_s16(v632, v655);
-    int16x8_t v657 = vaddq_s16(v634, v616);
-    int16x8_t v658_tmp = vqrdmulhq_n_s16(v657, 13573);
-    int16x8_t v658 = vaddq_s16(v658_tmp, v657);
-    int16x8_t v659 = vaddq_s16(v638, v618);
-    int16x8_t v660 = vaddq_s16(v619, v640);
-    int16x8_t v661 = vaddq_s16(v659, v660);
-    int16x8_t v662 = vaddq_s16(v658, v661);
-    int16x8_t v663 = vaddq_s16(v641, v622);
-    int16x8_t v664 = vaddq_s16(v623, v633);
-    int16x8_t v665 = vaddq_s16(v663, v664);
-    int16x8_t v666_tmp = vqrdmulhq_n_s16(v665, 13573);
-    int16x8_t v666 = vaddq_s16(v666_tmp, v665);
-    int16x8_t v667 = vaddq_s16(v648, v626);
-    int16x8_t v668 = vaddq_s16(v627, v637);
-    int16x8_t v669 = vaddq_s16(v667, v668);
-    int16x8_t v670 = vaddq_s16(v669, v665);
-    int16x8_t v671 = vaddq_s16(v666, v670);
-    int16x8_t v672 = vqrdmulhq_n_s16(v671, 17734);
-    int16x8_t v673 = vaddq_s16(v662, v672);
-    int16x8_t v674 = vaddq_s16(v664, v657);
-    int16x8_t v675_tmp = vqrdmulhq_n_s16(v674, 13573);
-    int16x8_t v675 = vaddq_s16(v675_tmp, v674);
-    int16x8_t v676 = vaddq_s16(v668, v659);
-    int16x8_t v677 = vaddq_s16(v660, v663);
-    int16x8_t v678 = vaddq_s16(v676, v677);
-    int16x8_t v679 = vaddq_s16(v675, v678);
-    int16x8_t v680 = vaddq_s16(v677, v674);
-    int16x8_t v681_tmp = vqrdmulhq_n_s16(v680, 13573);
-    int16x8_t v681 = vaddq_s16(v681_tmp, v680);
-    int16x8_t v682 = vld1q_s16(in + in_stride * 127 + i);
-    int16x8_t v683 = vaddq_s16(v682, v507);
-    int16x8_t v684 = vaddq_s16(v683, v603);
-    int16x8_t v685 = vaddq_s16(v684, v647);
-    int16x8_t v686 = vaddq_s16(v685, v667);
-    int16x8_t v687 = vaddq_s16(v686, v676);
-    int16x8_t v688 = vaddq_s16(v687, v680);
-    int16x8_t v689 = vaddq_s16(v681, v688);
-    int16x8_t v690 = vqrdmulhq_n_s16(v689, 17734);
-    int16x8_t v691 = vaddq_s16(v679, v690);
-    int16x8_t v692 = vqrdmulhq_n_s16(v691, 16705);
-    int16x8_t v693 = vaddq_s16(v673, v692);
-    int16x8_t v694 = vqrdmulhq_n_s16(v693, 16463);
-    int16x8_t v695 = vaddq_s16(v656, v694);
-    int16x8_t v696 = vqrdmulhq_n_s16(v695, 16404);
-    int16x8_t v697 = vaddq_s16(v615, v696);
-    int16x8_t v698 = vqrdmulhq_n_s16(v697, 16389);
-    int16x8_t v699 = vaddq_s16(v522, v698);
-    int16x8_t v700 = vqrdmulhq_n_s16(v699, 16385);
-    int16x8_t v701 = vaddq_s16(v317, v700);
-    int16x8_t v702 = vsubq_s16(v0, v1);
-    int16x8_t v703 = vsubq_s16(v4, v6);
-    int16x8_t v704_tmp = vqrdmulhq_n_s16(v703, 10045);
-    int16x8_t v704 = vaddq_s16(v704_tmp, v703);
-    int16x8_t v705 = vaddq_s16(v702, v704);
-    int16x8_t v706 = vsubq_s16(v11, v14);
-    int16x8_t v707 = vsubq_s16(v17, v20);
-    int16x8_t v708_tmp = vqrdmulhq_n_s16(v707, 10045);
-    int16x8_t v708 = vaddq_s16(v708_tmp, v707);
-    int16x8_t v709 = vaddq_s16(v706, v708);
-    int16x8_t v710 = vqrdmulhq_n_s16(v709, 19705);
-    int16x8_t v711 = vaddq_s16(v705, v710);
-    int16x8_t v712 = vsubq_s16(v27, v30);
-    int16x8_t v713 = vsubq_s16(v35, v39);
-    int16x8_t v714_tmp = vqrdmulhq_n_s16(v713, 10045);
-    int16x8_t v714 = vaddq_s16(v714_tmp, v713);
-    int16x8_t v715 = vaddq_s16(v712, v714);
-    int16x8_t v716 = vsubq_s16(v44, v47);
-    int16x8_t v717 = vsubq_s16(v50, v54);
-    int16x8_t v718_tmp = vqrdmulhq_n_s16(v717, 10045);
-    int16x8_t v718 = vaddq_s16(v718_tmp, v717);
-    int16x8_t v719 = vaddq_s16(v716, v718);
-    int16x8_t v720 = vqrdmulhq_n_s16(v719, 19705);
-    int16x8_t v721 = vaddq_s16(v715, v720);
-    int16x8_t v722 = vqrdmulhq_n_s16(v721, 17121);
-    int16x8_t v723 = vaddq_s16(v711, v722);
-    int16x8_t v724 = vsubq_s16(v63, v66);
-    int16x8_t v725 = vsubq_s16(v71, v75);
-    int16x8_t v726_tmp = vqrdmulhq_n_s16(v725, 10045);
-    int16x8_t v726 = vaddq_s16(v726_tmp, v725);
-    int16x8_t v727 = vaddq_s16(v724, v726);
-    int16x8_t v728 = vsubq_s16(v82, v89);
-    int16x8_t v729 = vsubq_s16(v92, v97);
-    int16x8_t v730_tmp = vqrdmulhq_n_s16(v729, 10045);
-    int16x8_t v730 = vaddq_s16(v730_tmp, v729);
-    int16x8_t v731 = vaddq_s16(v728, v730);
-    int16x8_t v732 = vqrdmulhq_n_s16(v731, 19705);
-    int16x8_t v733 = vaddq_s16(v727, v732);
-    int16x8_t v734 = vsubq_s16(v104, v107);
-    int16x8_t v735 = vsubq_s16(v112, v116);
-    int16x8_t v736_tmp = vqrdmulhq_n_s16(v735, 10045);
-    int16x8_t v736 = vaddq_s16(v736_tmp, v735);
-    int16x8_t v737 = vaddq_s16(v734, v736);
-    int16x8_t v738 = vsubq_s16(v121, v124);
-    int16x8_t v739 = vsubq_s16(v127, v132);
-    int16x8_t v740_tmp = vqrdmulhq_n_s16(v739, 10045);
-    int16x8_t v740 = vaddq_s16(v740_tmp, v739);
-    int16x8_t v741 = vaddq_s16(v738, v740);
-    int16x8_t v742 = vqrdmulhq_n_s16(v741, 19705);
-    int16x8_t v743 = vaddq_s16(v737, v742);
-    int16x8_t v744 = vqrdmulhq_n_s16(v743, 17121);
-    int16x8_t v745 = vaddq_s16(v733, v744);
-    int16x8_t v746 = vqrdmulhq_n_s16(v745, 16563);
-    int16x8_t v747 = vaddq_s16(v723, v746);
-    int16x8_t v748 = vsubq_s16(v143, v146);
-    int16x8_t v749 = vsubq_s16(v151, v155);
-    int16x8_t v750_tmp = vqrdmulhq_n_s16(v749, 10045);
-    int16x8_t v750 = vaddq_s16(v750_tmp, v749);
-    int16x8_t v751 = vaddq_s16(v748, v750);
-    int16x8_t v752 = vsubq_s16(v162, v169);
-    int16x8_t v753 = vqrdmulhq_n_s16(v752, 19705);
-    int16x8_t v754 = vsubq_s16(v172, v177);
-    int16x8_t v755 = vqrdmulhq_n_s16(v754, 25746);
-    int16x8_t v756 = vaddq_s16(v753, v755);
-    int16x8_t v757 = vaddq_s16(v751, v756);
-    int16x8_t v758 = vsubq_s16(v186, v193);
-    int16x8_t v759 = vsubq_s16(v202, v210);
-    int16x8_t v760_tmp = vqrdmulhq_n_s16(v759, 10045);
-    int16x8_t v760 = vaddq_s16(v760_tmp, v759);
-    int16x8_t v761 = vaddq_s16(v758, v760);
-    int16x8_t v762 = vsubq_s16(v215, v218);
-    int16x8_t v763 = vsubq_s16(v221, v227);
-    int16x8_t v764_tmp = vqrdmulhq_n_s16(v763, 10045);
-    int16x8_t v764 = vaddq_s16(v764_tmp, v763);
-    int16x8_t v765 = vaddq_s16(v762, v764);
-    int16x8_t v766 = vqrdmulhq_n_s16(v765, 19705);
-    int16x8_t v767 = vaddq_s16(v761, v766);
-    int16x8_t v768 = vqrdmulhq_n_s16(v767, 17121);
-    int16x8_t v769 = vaddq_s16(v757, v768);
-    int16x8_t v770 = vsubq_s16(v236, v239);
-    int16x8_t v771 = vsubq_s16(v244, v248);
-    int16x8_t v772_tmp = vqrdmulhq_n_s16(v771, 10045);
-    int16x8_t v772 = vaddq_s16(v772_tmp, v771);
-    int16x8_t v773 = vaddq_s16(v770, v772);
-    int16x8_t v774 = vsubq_s16(v255, v262);
-    int16x8_t v775 = vsubq_s16(v265, v270);
-    int16x8_t v776_tmp = vqrdmulhq_n_s16(v775, 10045);
-    int16x8_t v776 = vaddq_s16(v776_tmp, v775);
-    int16x8_t v777 = vaddq_s16(v774, v776);
-    int16x8_t v778 = vqrdmulhq_n_s16(v777, 19705);
-    int16x8_t v779 = vaddq_s16(v773, v778);
-    int16x8_t v780 = vsubq_s16(v277, v280);
-    int16x8_t v781 = vsubq_s16(v285, v289);
-    int16x8_t v782_tmp = vqrdmulhq_n_s16(v781, 10045);
-    int16x8_t v782 = vaddq_s16(v782_tmp, v781);
-    int16x8_t v783 = vaddq_s16(v780, v782);
-    int16x8_t v784 = vsubq_s16(v294, v297);
-    int16x8_t v785 = vsubq_s16(v300, v306);
-    int16x8_t v786_tmp = vqrdmulhq_n_s16(v785, 10045);
-    int16x8_t v786 = vaddq_s16(v786_tmp, v785);
-    int16x8_t v787 = vaddq_s16(v784, v786);
-    int16x8_t v788 = vqrdmulhq_n_s16(v787, 19705);
-    int16x8_t v789 = vaddq_s16(v783, v788);
-    int16x8_t v790 = vqrdmulhq_n_s16(v789, 17121);
-    int16x8_t v791 = vaddq_s16(v779, v790);
-    int16x8_t v792 = vqrdmulhq_n_s16(v791, 16563);
-    int16x8_t v793 = vaddq_s16(v769, v792);
-    int16x8_t v794 = vqrdmulhq_n_s16(v793, 16429);
-    int16x8_t v795 = vaddq_s16(v747, v794);
-    int16x8_t v796 = vsubq_s16(v319, v322);
-    int16x8_t v797 = vsubq_s16(v327, v331);
-    int16x8_t v798_tmp = vqrdmulhq_n_s16(v797, 10045);
-    int16x8_t v798 = vaddq_s16(v798_tmp, v797);
-    int16x8_t v799 = vaddq_s16(v796, v798);
-    int16x8_t v800 = vsubq_s16(v338, v345);
-    int16x8_t v801 = vsubq_s16(v348, v353);
-    int16x8_t v802_tmp = vqrdmulhq_n_s16(v801, 10045);
-    int16x8_t v802 = vaddq_s16(v802_tmp, v801);
-    int16x8_t v803 = vaddq_s16(v800, v802);
-    int16x8_t v804 = vqrdmulhq_n_s16(v803, 19705);
-    int16x8_t v805 = vaddq_s16(v799, v804);
-    int16x8_t v806 = vsubq_s16(v362, v369);
-    int16x8_t v807 = vsubq_s16(v378, v386);
-    int16x8_t v808_tmp = vqrdmulhq_n_s16(v807, 10045);
-    int16x8_t v808 = vaddq_s16(v808_tmp, v807);
-    int16x8_t v809 = vaddq_s16(v806, v808);
-    int16x8_t v810 = vsubq_s16(v391, v394);
-    int16x8_t v811 = vsubq_s16(v397, v403);
-    int16x8_t v812_tmp = vqrdmulhq_n_s16(v811, 10045);
-    int16x8_t v812 = vaddq_s16(v812_tmp, v811);
-    int16x8_t v813 = vaddq_s16(v810, v812);
-    int16x8_t v814 = vqrdmulhq_n_s16(v813, 19705);
-    int16x8_t v815 = vaddq_s16(v809, v814);
-    int16x8_t v816 = vqrdmulhq_n_s16(v815, 17121);
-    int16x8_t v817 = vaddq_s16(v805, v816);
-    int16x8_t v818 = vsubq_s16(v414, v421);
-    int16x8_t v819 = vsubq_s16(v430, v438);
-    int16x8_t v820_tmp = vqrdmulhq_n_s16(v819, 10045);
-    int16x8_t v820 = vaddq_s16(v820_tmp, v819);
-    int16x8_t v821 = vaddq_s16(v818, v820);
-    int16x8_t v822 = vsubq_s16(v449, v464);
-    int16x8_t v823 = vsubq_s16(v467, v476);
-    int16x8_t v824_tmp = vqrdmulhq_n_s16(v823, 10045);
-    int16x8_t v824 = vaddq_s16(v824_tmp, v823);
-    int16x8_t v825 = vaddq_s16(v822, v824);
-    int16x8_t v826 = vqrdmulhq_n_s16(v825, 19705);
-    int16x8_t v827 = vaddq_s16(v821, v826);
-    int16x8_t v828 = vsubq_s16(v483, v486);
-    int16x8_t v829 = vsubq_s16(v491, v495);
-    int16x8_t v830_tmp = vqrdmulhq_n_s16(v829, 10045);
-    int16x8_t v830 = vaddq_s16(v830_tmp, v829);
-    int16x8_t v831 = vaddq_s16(v828, v830);
-    int16x8_t v832 = vsubq_s16(v500, v503);
-    int16x8_t v833 = vsubq_s16(v506, v513);
-    int16x8_t v834_tmp = vqrdmulhq_n_s16(v833, 10045);
-    int16x8_t v834 = vaddq_s16(v834_tmp, v833);
-    int16x8_t v835 = vaddq_s16(v832, v834);
-    int16x8_t v836 = vqrdmulhq_n_s16(v835, 19705);
-    int16x8_t v837 = vaddq_s16(v831, v836);
-    int16x8_t v838 = vqrdmulhq_n_s16(v837, 17121);
-    int16x8_t v839 = vaddq_s16(v827, v838);
-    int16x8_t v840 = vqrdmulhq_n_s16(v839, 16563);
-    int16x8_t v841 = vaddq_s16(v817, v840);
-    int16x8_t v842 = vsubq_s16(v524, v527);
-    int16x8_t v843 = vsubq_s16(v532, v536);
-    int16x8_t v844_tmp = vqrdmulhq_n_s16(v843, 10045);
-    int16x8_t v844 = vaddq_s16(v844_tmp, v843);
-    int16x8_t v845 = vaddq_s16(v842, v844);
-    int16x8_t v846 = vsubq_s16(v543, v550);
-    int16x8_t v847 = vsubq_s16(v553, v558);
-    int16x8_t v848_tmp = vqrdmulhq_n_s16(v847, 10045);
-    int16x8_t v848 = vaddq_s16(v848_tmp, v847);
-    int16x8_t v849 = vaddq_s16(v846, v848);
-    int16x8_t v850 = vqrdmulhq_n_s16(v849, 19705);
-    int16x8_t v851 = vaddq_s16(v845, v850);
-    int16x8_t v852 = vsubq_s16(v567, v574);
-    int16x8_t v853 = vsubq_s16(v583, v591);
-    int16x8_t v854_tmp = vqrdmulhq_n_s16(v853, 10045);
-    int16x8_t v854 = vaddq_s16(v854_tmp, v853);
-    int16x8_t v855 = vaddq_s16(v852, v854);
-    int16x8_t v856 = vsubq_s16(v596, v599);
-    int16x8_t v857 = vsubq_s16(v602, v608);
-    int16x8_t v858_tmp = vqrdmulhq_n_s16(v857, 10045);
-    int16x8_t v858 = vaddq_s16(v858_tmp, v857);
-    int16x8_t v859 = vaddq_s16(v856, v858);
-    int16x8_t v860 = vqrdmulhq_n_s16(v859, 19705);
-    int16x8_t v861 = vaddq_s16(v855, v860);
-    int16x8_t v862 = vqrdmulhq_n_s16(v861, 17121);
-    int16x8_t v863 = vaddq_s16(v851, v862);
-    int16x8_t v864 = vsubq_s16(v617, v620);
-    int16x8_t v865 = vsubq_s16(v625, v629);
-    int16x8_t v866_tmp = vqrdmulhq_n_s16(v865, 10045);
-    int16x8_t v866 = vaddq_s16(v866_tmp, v865);
-    int16x8_t v867 = vaddq_s16(v864, v866);
-    int16x8_t v868 = vsubq_s16(v636, v643);
-    int16x8_t v869 = vsubq_s16(v646, v651);
-    int16x8_t v870_tmp = vqrdmulhq_n_s16(v869, 10045);
-    int16x8_t v870 = vaddq_s16(v870_tmp, v869);
-    int16x8_t v871 = vaddq_s16(v868, v870);
-    int16x8_t v872 = vqrdmulhq_n_s16(v871, 19705);
-    int16x8_t v873 = vaddq_s16(v867, v872);
-    int16x8_t v874 = vsubq_s16(v658, v661);
-    int16x8_t v875 = vsubq_s16(v666, v670);
-    int16x8_t v876_tmp = vqrdmulhq_n_s16(v875, 10045);
-    int16x8_t v876 = vaddq_s16(v876_tmp, v875);
-    int16x8_t v877 = vaddq_s16(v874, v876);
-    int16x8_t v878 = vsubq_s16(v675, v678);
-    int16x8_t v879 = vsubq_s16(v681, v688);
-    int16x8_t v880_tmp = vqrdmulhq_n_s16(v879, 10045);
-    int16x8_t v880 = vaddq_s16(v880_tmp, v879);
-    int16x8_t v881 = vaddq_s16(v878, v880);
-    int16x8_t v882 = vqrdmulhq_n_s16(v881, 19705);
-    int16x8_t v883 = vaddq_s16(v877, v882);
-    int16x8_t v884 = vqrdmulhq_n_s16(v883, 17121);
-    int16x8_t v885 = vaddq_s16(v873, v884);
-    int16x8_t v886 = vqrdmulhq_n_s16(v885, 16563);
-    int16x8_t v887 = vaddq_s16(v863, v886);
-    int16x8_t v888 = vqrdmulhq_n_s16(v887, 16429);
-    int16x8_t v889 = vaddq_s16(v841, v888);
-    int16x8_t v890 = vqrdmulhq_n_s16(v889, 16395);
-    int16x8_t v891 = vaddq_s16(v795, v890);
-    int16x8_t v892 = vsubq_s16(v702, v704);
-    int16x8_t v893 = vsubq_s16(v706, v708);
-    int16x8_t v894 = vqrdmulhq_n_s16(v893, 29490);
-    int16x8_t v895 = vaddq_s16(v892, v894);
-    int16x8_t v896 = vsubq_s16(v712, v714);
-    int16x8_t v897 = vsubq_s16(v716, v718);
-    int16x8_t v898 = vqrdmulhq_n_s16(v897, 29490);
-    int16x8_t v899 = vaddq_s16(v896, v898);
-    int16x8_t v900 = vqrdmulhq_n_s16(v899, 18578);
-    int16x8_t v901 = vaddq_s16(v895, v900);
-    int16x8_t v902 = vsubq_s16(v724, v726);
-    int16x8_t v903 = vsubq_s16(v728, v730);
-    int16x8_t v904 = vqrdmulhq_n_s16(v903, 29490);
-    int16x8_t v905 = vaddq_s16(v902, v904);
-    int16x8_t v906 = vsubq_s16(v734, v736);
-    int16x8_t v907 = vsubq_s16(v738, v740);
-    int16x8_t v908 = vqrdmulhq_n_s16(v907, 29490);
-    int16x8_t v909 = vaddq_s16(v906, v908);
-    int16x8_t v910 = vqrdmulhq_n_s16(v909, 18578);
-    int16x8_t v911 = vaddq_s16(v905, v910);
-    int16x8_t v912 = vqrdmulhq_n_s16(v911, 16890);
-    int16x8_t v913 = vaddq_s16(v901, v912);
-    int16x8_t v914 = vsubq_s16(v748, v750);
-    int16x8_t v915_tmp = vqrdmulhq_n_s16(v754, 10045);
-    int16x8_t v915 = vaddq_s16(v915_tmp, v754);
-    int16x8_t v916 = vsubq_s16(v752, v915);
-    int16x8_t v917 = vqrdmulhq_n_s16(v916, 29490);
-    int16x8_t v918 = vaddq_s16(v914, v917);
-    int16x8_t v919 = vsubq_s16(v758, v760);
-    int16x8_t v920 = vsubq_s16(v762, v764);
-    int16x8_t v921 = vqrdmulhq_n_s16(v920, 29490);
-    int16x8_t v922 = vaddq_s16(v919, v921);
-    int16x8_t v923 = vqrdmulhq_n_s16(v922, 18578);
-    int16x8_t v924 = vaddq_s16(v918, v923);
-    int16x8_t v925 = vsubq_s16(v770, v772);
-    int16x8_t v926 = vsubq_s16(v774, v776);
-    int16x8_t v927 = vqrdmulhq_n_s16(v926, 29490);
-    int16x8_t v928 = vaddq_s16(v925, v927);
-    int16x8_t v929 = vsubq_s16(v780, v782);
-    int16x8_t v930 = vsubq_s16(v784, v786);
-    int16x8_t v931 = vqrdmulhq_n_s16(v930, 29490);
-    int16x8_t v932 = vaddq_s16(v929, v931);
-    int16x8_t v933 = vqrdmulhq_n_s16(v932, 18578);
-    int16x8_t v934 = vaddq_s16(v928, v933);
-    int16x8_t v935 = vqrdmulhq_n_s16(v934, 16890);
-    int16x8_t v936 = vaddq_s16(v924, v935);
-    int16x8_t v937 = vqrdmulhq_n_s16(v936, 16508);
-    int16x8_t v938 = vaddq_s16(v913, v937);
-    int16x8_t v939 = vsubq_s16(v796, v798);
-    int16x8_t v940 = vsubq_s16(v800, v802);
-    int16x8_t v941 = vqrdmulhq_n_s16(v940, 29490);
-    int16x8_t v942 = vaddq_s16(v939, v941);
-    int16x8_t v943 = vsubq_s16(v806, v808);
-    int16x8_t v944 = vsubq_s16(v810, v812);
-    int16x8_t v945 = vqrdmulhq_n_s16(v944, 29490);
-    int16x8_t v946 = vaddq_s16(v943, v945);
-    int16x8_t v947 = vqrdmulhq_n_s16(v946, 18578);
-    int16x8_t v948 = vaddq_s16(v942, v947);
-    int16x8_t v949 = vsubq_s16(v818, v820);
-    int16x8_t v950 = vsubq_s16(v822, v824);
-    int16x8_t v951 = vqrdmulhq_n_s16(v950, 29490);
-    int16x8_t v952 = vaddq_s16(v949, v951);
-    int16x8_t v953 = vsubq_s16(v828, v830);
-    int16x8_t v954 = vsubq_s16(v832, v834);
-    int16x8_t v955 = vqrdmulhq_n_s16(v954, 29490);
-    int16x8_t v956 = vaddq_s16(v953, v955);
-    int16x8_t v957 = vqrdmulhq_n_s16(v956, 18578);
-    int16x8_t v958 = vaddq_s16(v952, v957);
-    int16x8_t v959 = vqrdmulhq_n_s16(v958, 16890);
-    int16x8_t v960 = vaddq_s16(v948, v959);
-    int16x8_t v961 = vsubq_s16(v842, v844);
-    int16x8_t v962 = vsubq_s16(v846, v848);
-    int16x8_t v963 = vqrdmulhq_n_s16(v962, 29490);
-    int16x8_t v964 = vaddq_s16(v961, v963);
-    int16x8_t v965 = vsubq_s16(v852, v854);
-    int16x8_t v966 = vsubq_s16(v856, v858);
-    int16x8_t v967 = vqrdmulhq_n_s16(v966, 29490);
-    int16x8_t v968 = vaddq_s16(v965, v967);
-    int16x8_t v969 = vqrdmulhq_n_s16(v968, 18578);
-    int16x8_t v970 = vaddq_s16(v964, v969);
-    int16x8_t v971 = vsubq_s16(v864, v866);
-    int16x8_t v972 = vsubq_s16(v868, v870);
-    int16x8_t v973 = vqrdmulhq_n_s16(v972, 29490);
-    int16x8_t v974 = vaddq_s16(v971, v973);
-    int16x8_t v975 = vsubq_s16(v874, v876);
-    int16x8_t v976 = vsubq_s16(v878, v880);
-    int16x8_t v977 = vqrdmulhq_n_s16(v976, 29490);
-    int16x8_t v978 = vaddq_s16(v975, v977);
-    int16x8_t v979 = vqrdmulhq_n_s16(v978, 18578);
-    int16x8_t v980 = vaddq_s16(v974, v979);
-    int16x8_t v981 = vqrdmulhq_n_s16(v980, 16890);
-    int16x8_t v982 = vaddq_s16(v970, v981);
-    int16x8_t v983 = vqrdmulhq_n_s16(v982, 16508);
-    int16x8_t v984 = vaddq_s16(v960, v983);
-    int16x8_t v985 = vqrdmulhq_n_s16(v984, 16415);
-    int16x8_t v986 = vaddq_s16(v938, v985);
-    int16x8_t v987 = vsubq_s16(v2, v8);
-    int16x8_t v988 = vsubq_s16(v15, v22);
-    int16x8_t v989_tmp = vqrdmulhq_n_s16(v988, 18446);
-    int16x8_t v989 = vmlaq_n_s16(v989_tmp, v988, 2);
-    int16x8_t v990 = vaddq_s16(v987, v989);
-    int16x8_t v991 = vsubq_s16(v31, v41);
-    int16x8_t v992 = vsubq_s16(v48, v56);
-    int16x8_t v993_tmp = vqrdmulhq_n_s16(v992, 18446);
-    int16x8_t v993 = vmlaq_n_s16(v993_tmp, v992, 2);
-    int16x8_t v994 = vaddq_s16(v991, v993);
-    int16x8_t v995 = vqrdmulhq_n_s16(v994, 21195);
-    int16x8_t v996 = vaddq_s16(v990, v995);
-    int16x8_t v997 = vsubq_s16(v67, v77);
-    int16x8_t v998 = vsubq_s16(v90, v99);
-    int16x8_t v999_tmp = vqrdmulhq_n_s16(v998, 18446);
-    int16x8_t v999 = vmlaq_n_s16(v999_tmp, v998, 2);
-    int16x8_t v1000 = vaddq_s16(v997, v999);
-    int16x8_t v1001 = vsubq_s16(v108, v118);
-    int16x8_t v1002 = vsubq_s16(v125, v134);
-    int16x8_t v1003_tmp = vqrdmulhq_n_s16(v1002, 18446);
-    int16x8_t v1003 = vmlaq_n_s16(v1003_tmp, v1002, 2);
-    int16x8_t v1004 = vaddq_s16(v1001, v1003);
-    int16x8_t v1005 = vqrdmulhq_n_s16(v1004, 21195);
-    int16x8_t v1006 = vaddq_s16(v1000, v1005);
-    int16x8_t v1007 = vqrdmulhq_n_s16(v1006, 17401);
-    int16x8_t v1008 = vaddq_s16(v996, v1007);
-    int16x8_t v1009 = vsubq_s16(v147, v157);
-    int16x8_t v1010 = vsubq_s16(v170, v179);
-    int16x8_t v1011_tmp = vqrdmulhq_n_s16(v1010, 18446);
-    int16x8_t v1011 = vmlaq_n_s16(v1011_tmp, v1010, 2);
-    int16x8_t v1012 = vaddq_s16(v1009, v1011);
-    int16x8_t v1013 = vsubq_s16(v194, v212);
-    int16x8_t v1014 = vsubq_s16(v219, v229);
-    int16x8_t v1015_tmp = vqrdmulhq_n_s16(v1014, 18446);
-    int16x8_t v1015 = vmlaq_n_s16(v1015_tmp, v1014, 2);
-    int16x8_t v1016 = vaddq_s16(v1013, v1015);
-    int16x8_t v1017 = vqrdmulhq_n_s16(v1016, 21195);
-    int16x8_t v1018 = vaddq_s16(v1012, v1017);
-    int16x8_t v1019 = vsubq_s16(v240, v250);
-    int16x8_t v1020 = vsubq_s16(v263, v272);
-    int16x8_t v1021_tmp = vqrdmulhq_n_s16(v1020, 18446);
-    int16x8_t v1021 = vmlaq_n_s16(v1021_tmp, v1020, 2);
-    int16x8_t v1022 = vaddq_s16(v1019, v1021);
-    int16x8_t v1023 = vsubq_s16(v281, v291);
-    int16x8_t v1024 = vsubq_s16(v298, v308);
-    int16x8_t v1025_tmp = vqrdmulhq_n_s16(v1024, 18446);
-    int16x8_t v1025 = vmlaq_n_s16(v1025_tmp, v1024, 2);
-    int16x8_t v1026 = vaddq_s16(v1023, v1025);
-    int16x8_t v1027 = vqrdmulhq_n_s16(v1026, 21195);
-    int16x8_t v1028 = vaddq_s16(v1022, v1027);
-    int16x8_t v1029 = vqrdmulhq_n_s16(v1028, 17401);
-    int16x8_t v1030 = vaddq_s16(v1018, v1029);
-    int16x8_t v1031 = vqrdmulhq_n_s16(v1030, 16629);
-    int16x8_t v1032 = vaddq_s16(v1008, v1031);
-    int16x8_t v1033 = vsubq_s16(v323, v333);
-    int16x8_t v1034 = vsubq_s16(v346, v355);
-    int16x8_t v1035_tmp = vqrdmulhq_n_s16(v1034, 18446);
-    int16x8_t v1035 = vmlaq_n_s16(v1035_tmp, v1034, 2);
-    int16x8_t v1036 = vaddq_s16(v1033, v1035);
-    int16x8_t v1037 = vsubq_s16(v370, v388);
-    int16x8_t v1038 = vsubq_s16(v395, v405);
-    int16x8_t v1039_tmp = vqrdmulhq_n_s16(v1038, 18446);
-    int16x8_t v1039 = vmlaq_n_s16(v1039_tmp, v1038, 2);
-    int16x8_t v1040 = vaddq_s16(v1037, v1039);
-    int16x8_t v1041 = vqrdmulhq_n_s16(v1040, 21195);
-    int16x8_t v1042 = vaddq_s16(v1036, v1041);
-    int16x8_t v1043 = vsubq_s16(v422, v440);
-    int16x8_t v1044 = vsubq_s16(v465, v478);
-    int16x8_t v1045_tmp = vqrdmulhq_n_s16(v1044, 18446);
-    int16x8_t v1045 = vmlaq_n_s16(v1045_tmp, v1044, 2);
-    int16x8_t v1046 = vaddq_s16(v1043, v1045);
-    int16x8_t v1047 = vsubq_s16(v487, v497);
-    int16x8_t v1048 = vsubq_s16(v504, v515);
-    int16x8_t v1049_tmp = vqrdmulhq_n_s16(v1048, 18446);
-    int16x8_t v1049 = vmlaq_n_s16(v1049_tmp, v1048, 2);
-    int16x8_t v1050 = vaddq_s16(v1047, v1049);
-    int16x8_t v1051 = vqrdmulhq_n_s16(v1050, 21195);
-    int16x8_t v1052 = vaddq_s16(v1046, v1051);
-    int16x8_t v1053 = vqrdmulhq_n_s16(v1052, 17401);
-    int16x8_t v1054 = vaddq_s16(v1042, v1053);
-    int16x8_t v1055 = vsubq_s16(v528, v538);
-    int16x8_t v1056 = vsubq_s16(v551, v560);
-    int16x8_t v1057_tmp = vqrdmulhq_n_s16(v1056, 18446);
-    int16x8_t v1057 = vmlaq_n_s16(v1057_tmp, v1056, 2);
-    int16x8_t v1058 = vaddq_s16(v1055, v1057);
-    int16x8_t v1059 = vsubq_s16(v575, v593);
-    int16x8_t v1060 = vsubq_s16(v600, v610);
-    int16x8_t v1061_tmp = vqrdmulhq_n_s16(v1060, 18446);
-    int16x8_t v1061 = vmlaq_n_s16(v1061_tmp, v1060, 2);
-    int16x8_t v1062 = vaddq_s16(v1059, v1061);
-    int16x8_t v1063 = vqrdmulhq_n_s16(v1062, 21195);
-    int16x8_t v1064 = vaddq_s16(v1058, v1063);
-    int16x8_t v1065 = vsubq_s16(v621, v631);
-    int16x8_t v1066 = vsubq_s16(v644, v653);
-    int16x8_t v1067_tmp = vqrdmulhq_n_s16(v1066, 18446);
-    int16x8_t v1067 = vmlaq_n_s16(v1067_tmp, v1066, 2);
-    int16x8_t v1068 = vaddq_s16(v1065, v1067);
-    int16x8_t v1069 = vsubq_s16(v662, v672);
-    int16x8_t v1070 = vsubq_s16(v679, v690);
-    int16x8_t v1071_tmp = vqrdmulhq_n_s16(v1070, 18446);
-    int16x8_t v1071 = vmlaq_n_s16(v1071_tmp, v1070, 2);
-    int16x8_t v1072 = vaddq_s16(v1069, v1071);
-    int16x8_t v1073 = vqrdmulhq_n_s16(v1072, 21195);
-    int16x8_t v1074 = vaddq_s16(v1068, v1073);
-    int16x8_t v1075 = vqrdmulhq_n_s16(v1074, 17401);
-    int16x8_t v1076 = vaddq_s16(v1064, v1075);
-    int16x8_t v1077 = vqrdmulhq_n_s16(v1076, 16629);
-    int16x8_t v1078 = vaddq_s16(v1054, v1077);
-    int16x8_t v1079 = vqrdmulhq_n_s16(v1078, 16445);
-    int16x8_t v1080 = vaddq_s16(v1032, v1079);
-    int16x8_t v1081 = vsubq_s16(v987, v989);
-    int16x8_t v1082 = vsubq_s16(v991, v993);
-    int16x8_t v1083 = vqrdmulhq_n_s16(v1082, 25826);
-    int16x8_t v1084 = vaddq_s16(v1081, v1083);
-    int16x8_t v1085 = vsubq_s16(v997, v999);
-    int16x8_t v1086 = vsubq_s16(v1001, v1003);
-    int16x8_t v1087 = vqrdmulhq_n_s16(v1086, 25826);
-    int16x8_t v1088 = vaddq_s16(v1085, v1087);
-    int16x8_t v1089 = vqrdmulhq_n_s16(v1088, 18124);
-    int16x8_t v1090 = vaddq_s16(v1084, v1089);
-    int16x8_t v1091 = vsubq_s16(v1009, v1011);
-    int16x8_t v1092 = vsubq_s16(v1013, v1015);
-    int16x8_t v1093 = vqrdmulhq_n_s16(v1092, 25826);
-    int16x8_t v1094 = vaddq_s16(v1091, v1093);
-    int16x8_t v1095 = vsubq_s16(v1019, v1021);
-    int16x8_t v1096 = vsubq_s16(v1023, v1025);
-    int16x8_t v1097 = vqrdmulhq_n_s16(v1096, 25826);
-    int16x8_t v1098 = vaddq_s16(v1095, v1097);
-    int16x8_t v1099 = vqrdmulhq_n_s16(v1098, 18124);
-    int16x8_t v1100 = vaddq_s16(v1094, v1099);
-    int16x8_t v1101 = vqrdmulhq_n_s16(v1100, 16792);
-    int16x8_t v1102 = vaddq_s16(v1090, v1101);
-    int16x8_t v1103 = vsubq_s16(v1033, v1035);
-    int16x8_t v1104 = vsubq_s16(v1037, v1039);
-    int16x8_t v1105 = vqrdmulhq_n_s16(v1104, 25826);
-    int16x8_t v1106 = vaddq_s16(v1103, v1105);
-    int16x8_t v1107 = vsubq_s16(v1043, v1045);
-    int16x8_t v1108 = vsubq_s16(v1047, v1049);
-    int16x8_t v1109 = vqrdmulhq_n_s16(v1108, 25826);
-    int16x8_t v1110 = vaddq_s16(v1107, v1109);
-    int16x8_t v1111 = vqrdmulhq_n_s16(v1110, 18124);
-    int16x8_t v1112 = vaddq_s16(v1106, v1111);
-    int16x8_t v1113 = vsubq_s16(v1055, v1057);
-    int16x8_t v1114 = vsubq_s16(v1059, v1061);
-    int16x8_t v1115 = vqrdmulhq_n_s16(v1114, 25826);
-    int16x8_t v1116 = vaddq_s16(v1113, v1115);
-    int16x8_t v1117 = vsubq_s16(v1065, v1067);
-    int16x8_t v1118 = vsubq_s16(v1069, v1071);
-    int16x8_t v1119 = vqrdmulhq_n_s16(v1118, 25826);
-    int16x8_t v1120 = vaddq_s16(v1117, v1119);
-    int16x8_t v1121 = vqrdmulhq_n_s16(v1120, 18124);
-    int16x8_t v1122 = vaddq_s16(v1116, v1121);
-    int16x8_t v1123 = vqrdmulhq_n_s16(v1122, 16792);
-    int16x8_t v1124 = vaddq_s16(v1112, v1123);
-    int16x8_t v1125 = vqrdmulhq_n_s16(v1124, 16484);
-    int16x8_t v1126 = vaddq_s16(v1102, v1125);
-    int16x8_t v1127 = vsubq_s16(v892, v894);
-    int16x8_t v1128 = vsubq_s16(v896, v898);
-    int16x8_t v1129_tmp = vqrdmulhq_n_s16(v1128, 1988);
-    int16x8_t v1129 = vaddq_s16(v1129_tmp, v1128);
-    int16x8_t v1130 = vaddq_s16(v1127, v1129);
-    int16x8_t v1131 = vsubq_s16(v902, v904);
-    int16x8_t v1132 = vsubq_s16(v906, v908);
-    int16x8_t v1133_tmp = vqrdmulhq_n_s16(v1132, 1988);
-    int16x8_t v1133 = vaddq_s16(v1133_tmp, v1132);
-    int16x8_t v1134 = vaddq_s16(v1131, v1133);
-    int16x8_t v1135 = vqrdmulhq_n_s16(v1134, 19102);
-    int16x8_t v1136 = vaddq_s16(v1130, v1135);
-    int16x8_t v1137 = vsubq_s16(v914, v917);
-    int16x8_t v1138 = vsubq_s16(v919, v921);
-    int16x8_t v1139_tmp = vqrdmulhq_n_s16(v1138, 1988);
-    int16x8_t v1139 = vaddq_s16(v1139_tmp, v1138);
-    int16x8_t v1140 = vaddq_s16(v1137, v1139);
-    int16x8_t v1141 = vsubq_s16(v925, v927);
-    int16x8_t v1142 = vsubq_s16(v929, v931);
-    int16x8_t v1143_tmp = vqrdmulhq_n_s16(v1142, 1988);
-    int16x8_t v1143 = vaddq_s16(v1143_tmp, v1142);
-    int16x8_t v1144 = vaddq_s16(v1141, v1143);
-    int16x8_t v1145 = vqrdmulhq_n_s16(v1144, 19102);
-    int16x8_t v1146 = vaddq_s16(v1140, v1145);
-    int16x8_t v1147 = vqrdmulhq_n_s16(v1146, 17000);
-    int16x8_t v1148 = vaddq_s16(v1136, v1147);
-    int16x8_t v1149 = vsubq_s16(v939, v941);
-    int16x8_t v1150 = vsubq_s16(v943, v945);
-    int16x8_t v1151_tmp = vqrdmulhq_n_s16(v1150, 1988);
-    int16x8_t v1151 = vaddq_s16(v1151_tmp, v1150);
-    int16x8_t v1152 = vaddq_s16(v1149, v1151);
-    int16x8_t v1153 = vsubq_s16(v949, v951);
-    int16x8_t v1154 = vsubq_s16(v953, v955);
-    int16x8_t v1155_tmp = vqrdmulhq_n_s16(v1154, 1988);
-    int16x8_t v1155 = vaddq_s16(v1155_tmp, v1154);
-    int16x8_t v1156 = vaddq_s16(v1153, v1155);
-    int16x8_t v1157 = vqrdmulhq_n_s16(v1156, 19102);
-    int16x8_t v1158 = vaddq_s16(v1152, v1157);
-    int16x8_t v1159 = vsubq_s16(v961, v963);
-    int16x8_t v1160 = vsubq_s16(v965, v967);
-    int16x8_t v1161_tmp = vqrdmulhq_n_s16(v1160, 1988);
-    int16x8_t v1161 = vaddq_s16(v1161_tmp, v1160);
-    int16x8_t v1162 = vaddq_s16(v1159, v1161);
-    int16x8_t v1163 = vsubq_s16(v971, v973);
-    int16x8_t v1164 = vsubq_s16(v975, v977);
-    int16x8_t v1165_tmp = vqrdmulhq_n_s16(v1164, 1988);
-    int16x8_t v1165 = vaddq_s16(v1165_tmp, v1164);
-    int16x8_t v1166 = vaddq_s16(v1163, v1165);
-    int16x8_t v1167 = vqrdmulhq_n_s16(v1166, 19102);
-    int16x8_t v1168 = vaddq_s16(v1162, v1167);
-    int16x8_t v1169 = vqrdmulhq_n_s16(v1168, 17000);
-    int16x8_t v1170 = vaddq_s16(v1158, v1169);
-    int16x8_t v1171 = vqrdmulhq_n_s16(v1170, 16534);
-    int16x8_t v1172 = vaddq_s16(v1148, v1171);
-    int16x8_t v1173 = vsubq_s16(v705, v710);
-    int16x8_t v1174 = vsubq_s16(v715, v720);
-    int16x8_t v1175_tmp = vqrdmulhq_n_s16(v1174, 23673);
-    int16x8_t v1175 = vaddq_s16(v1175_tmp, v1174);
-    int16x8_t v1176 = vaddq_s16(v1173, v1175);
-    int16x8_t v1177 = vsubq_s16(v727, v732);
-    int16x8_t v1178 = vsubq_s16(v737, v742);
-    int16x8_t v1179_tmp = vqrdmulhq_n_s16(v1178, 23673);
-    int16x8_t v1179 = vaddq_s16(v1179_tmp, v1178);
-    int16x8_t v1180 = vaddq_s16(v1177, v1179);
-    int16x8_t v1181 = vqrdmulhq_n_s16(v1180, 20398);
-    int16x8_t v1182 = vaddq_s16(v1176, v1181);
-    int16x8_t v1183 = vsubq_s16(v751, v756);
-    int16x8_t v1184 = vsubq_s16(v761, v766);
-    int16x8_t v1185_tmp = vqrdmulhq_n_s16(v1184, 23673);
-    int16x8_t v1185 = vaddq_s16(v1185_tmp, v1184);
-    int16x8_t v1186 = vaddq_s16(v1183, v1185);
-    int16x8_t v1187 = vsubq_s16(v773, v778);
-    int16x8_t v1188 = vsubq_s16(v783, v788);
-    int16x8_t v1189_tmp = vqrdmulhq_n_s16(v1188, 23673);
-    int16x8_t v1189 = vaddq_s16(v1189_tmp, v1188);
-    int16x8_t v1190 = vaddq_s16(v1187, v1189);
-    int16x8_t v1191 = vqrdmulhq_n_s16(v1190, 20398);
-    int16x8_t v1192 = vaddq_s16(v1186, v1191);
-    int16x8_t v1193 = vqrdmulhq_n_s16(v1192, 17255);
-    int16x8_t v1194 = vaddq_s16(v1182, v1193);
-    int16x8_t v1195 = vsubq_s16(v799, v804);
-    int16x8_t v1196 = vsubq_s16(v809, v814);
-    int16x8_t v1197_tmp = vqrdmulhq_n_s16(v1196, 23673);
-    int16x8_t v1197 = vaddq_s16(v1197_tmp, v1196);
-    int16x8_t v1198 = vaddq_s16(v1195, v1197);
-    int16x8_t v1199 = vsubq_s16(v821, v826);
-    int16x8_t v1200 = vsubq_s16(v831, v836);
-    int16x8_t v1201_tmp = vqrdmulhq_n_s16(v1200, 23673);
-    int16x8_t v1201 = vaddq_s16(v1201_tmp, v1200);
-    int16x8_t v1202 = vaddq_s16(v1199, v1201);
-    int16x8_t v1203 = vqrdmulhq_n_s16(v1202, 20398);
-    int16x8_t v1204 = vaddq_s16(v1198, v1203);
-    int16x8_t v1205 = vsubq_s16(v845, v850);
-    int16x8_t v1206 = vsubq_s16(v855, v860);
-    int16x8_t v1207_tmp = vqrdmulhq_n_s16(v1206, 23673);
-    int16x8_t v1207 = vaddq_s16(v1207_tmp, v1206);
-    int16x8_t v1208 = vaddq_s16(v1205, v1207);
-    int16x8_t v1209 = vsubq_s16(v867, v872);
-    int16x8_t v1210 = vsubq_s16(v877, v882);
-    int16x8_t v1211_tmp = vqrdmulhq_n_s16(v1210, 23673);
-    int16x8_t v1211 = vaddq_s16(v1211_tmp, v1210);
-    int16x8_t v1212 = vaddq_s16(v1209, v1211);
-    int16x8_t v1213 = vqrdmulhq_n_s16(v1212, 20398);
-    int16x8_t v1214 = vaddq_s16(v1208, v1213);
-    int16x8_t v1215 = vqrdmulhq_n_s16(v1214, 17255);
-    int16x8_t v1216 = vaddq_s16(v1204, v1215);
-    int16x8_t v1217 = vqrdmulhq_n_s16(v1216, 16595);
-    int16x8_t v1218 = vaddq_s16(v1194, v1217);
-    int16x8_t v1219 = vsubq_s16(v9, v24);
-    int16x8_t v1220 = vsubq_s16(v42, v58);
-    int16x8_t v1221_tmp = vqrdmulhq_n_s16(v1220, 3314);
-    int16x8_t v1221 = vmlaq_n_s16(v1221_tmp, v1220, 5);
-    int16x8_t v1222 = vaddq_s16(v1219, v1221);
-    int16x8_t v1223 = vsubq_s16(v78, v101);
-    int16x8_t v1224 = vsubq_s16(v119, v136);
-    int16x8_t v1225_tmp = vqrdmulhq_n_s16(v1224, 3314);
-    int16x8_t v1225 = vmlaq_n_s16(v1225_tmp, v1224, 5);
-    int16x8_t v1226 = vaddq_s16(v1223, v1225);
-    int16x8_t v1227 = vqrdmulhq_n_s16(v1226, 22112);
-    int16x8_t v1228 = vaddq_s16(v1222, v1227);
-    int16x8_t v1229 = vsubq_s16(v158, v181);
-    int16x8_t v1230 = vsubq_s16(v213, v231);
-    int16x8_t v1231_tmp = vqrdmulhq_n_s16(v1230, 3314);
-    int16x8_t v1231 = vmlaq_n_s16(v1231_tmp, v1230, 5);
-    int16x8_t v1232 = vaddq_s16(v1229, v1231);
-    int16x8_t v1233 = vsubq_s16(v251, v274);
-    int16x8_t v1234 = vsubq_s16(v292, v310);
-    int16x8_t v1235_tmp = vqrdmulhq_n_s16(v1234, 3314);
-    int16x8_t v1235 = vmlaq_n_s16(v1235_tmp, v1234, 5);
-    int16x8_t v1236 = vaddq_s16(v1233, v1235);
-    int16x8_t v1237 = vqrdmulhq_n_s16(v1236, 22112);
-    int16x8_t v1238 = vaddq_s16(v1232, v1237);
-    int16x8_t v1239 = vqrdmulhq_n_s16(v1238, 17561);
-    int16x8_t v1240 = vaddq_s16(v1228, v1239);
-    int16x8_t v1241 = vsubq_s16(v334, v357);
-    int16x8_t v1242 = vsubq_s16(v389, v407);
-    int16x8_t v1243_tmp = vqrdmulhq_n_s16(v1242, 3314);
-    int16x8_t v1243 = vmlaq_n_s16(v1243_tmp, v1242, 5);
-    int16x8_t v1244 = vaddq_s16(v1241, v1243);
-    int16x8_t v1245 = vsubq_s16(v441, v480);
-    int16x8_t v1246 = vsubq_s16(v498, v517);
-    int16x8_t v1247_tmp = vqrdmulhq_n_s16(v1246, 3314);
-    int16x8_t v1247 = vmlaq_n_s16(v1247_tmp, v1246, 5);
-    int16x8_t v1248 = vaddq_s16(v1245, v1247);
-    int16x8_t v1249 = vqrdmulhq_n_s16(v1248, 22112);
-    int16x8_t v1250 = vaddq_s16(v1244, v1249);
-    int16x8_t v1251 = vsubq_s16(v539, v562);
-    int16x8_t v1252 = vsubq_s16(v594, v612);
-    int16x8_t v1253_tmp = vqrdmulhq_n_s16(v1252, 3314);
-    int16x8_t v1253 = vmlaq_n_s16(v1253_tmp, v1252, 5);
-    int16x8_t v1254 = vaddq_s16(v1251, v1253);
-    int16x8_t v1255 = vsubq_s16(v632, v655);
-    int16x8_t v1256 = vsubq_s16(v673, v692);
-    int16x8_t v1257_tmp = vqrdmulhq_n_s16(v1256, 3314);
-    int16x8_t v1257 = vmlaq_n_s16(v1257_tmp, v1256, 5);
-    int16x8_t v1258 = vaddq_s16(v1255, v1257);
-    int16x8_t v1259 = vqrdmulhq_n_s16(v1258, 22112);
-    int16x8_t v1260 = vaddq_s16(v1254, v1259);
-    int16x8_t v1261 = vqrdmulhq_n_s16(v1260, 17561);
-    int16x8_t v1262 = vaddq_s16(v1250, v1261);
-    int16x8_t v1263 = vqrdmulhq_n_s16(v1262, 16666);
-    int16x8_t v1264 = vaddq_s16(v1240, v1263);
-    int16x8_t v1265 = vsubq_s16(v1219, v1221);
-    int16x8_t v1266 = vsubq_s16(v1223, v1225);
-    int16x8_t v1267 = vqrdmulhq_n_s16(v1266, 24397);
-    int16x8_t v1268 = vaddq_s16(v1265, v1267);
-    int16x8_t v1269 = vsubq_s16(v1229, v1231);
-    int16x8_t v1270 = vsubq_s16(v1233, v1235);
-    int16x8_t v1271 = vqrdmulhq_n_s16(v1270, 24397);
-    int16x8_t v1272 = vaddq_s16(v1269, v1271);
-    int16x8_t v1273 = vqrdmulhq_n_s16(v1272, 17921);
-    int16x8_t v1274 = vaddq_s16(v1268, v1273);
-    int16x8_t v1275 = vsubq_s16(v1241, v1243);
-    int16x8_t v1276 = vsubq_s16(v1245, v1247);
-    int16x8_t v1277 = vqrdmulhq_n_s16(v1276, 24397);
-    int16x8_t v1278 = vaddq_s16(v1275, v1277);
-    int16x8_t v1279 = vsubq_s16(v1251, v1253);
-    int16x8_t v1280 = vsubq_s16(v1255, v1257);
-    int16x8_t v1281 = vqrdmulhq_n_s16(v1280, 24397);
-    int16x8_t v1282 = vaddq_s16(v1279, v1281);
-    int16x8_t v1283 = vqrdmulhq_n_s16(v1282, 17921);
-    int16x8_t v1284 = vaddq_s16(v1278, v1283);
-    int16x8_t v1285 = vqrdmulhq_n_s16(v1284, 16747);
-    int16x8_t v1286 = vaddq_s16(v1274, v1285);
-    int16x8_t v1287 = vsubq_s16(v1173, v1175);
-    int16x8_t v1288 = vsubq_s16(v1177, v1179);
-    int16x8_t v1289 = vqrdmulhq_n_s16(v1288, 27504);
-    int16x8_t v1290 = vaddq_s16(v1287, v1289);
-    int16x8_t v1291 = vsubq_s16(v1183, v1185);
-    int16x8_t v1292 = vsubq_s16(v1187, v1189);
-    int16x8_t v1293 = vqrdmulhq_n_s16(v1292, 27504);
-    int16x8_t v1294 = vaddq_s16(v1291, v1293);
-    int16x8_t v1295 = vqrdmulhq_n_s16(v1294, 18343);
-    int16x8_t v1296 = vaddq_s16(v1290, v1295);
-    int16x8_t v1297 = vsubq_s16(v1195, v1197);
-    int16x8_t v1298 = vsubq_s16(v1199, v1201);
-    int16x8_t v1299 = vqrdmulhq_n_s16(v1298, 27504);
-    int16x8_t v1300 = vaddq_s16(v1297, v1299);
-    int16x8_t v1301 = vsubq_s16(v1205, v1207);
-    int16x8_t v1302 = vsubq_s16(v1209, v1211);
-    int16x8_t v1303 = vqrdmulhq_n_s16(v1302, 27504);
-    int16x8_t v1304 = vaddq_s16(v1301, v1303);
-    int16x8_t v1305 = vqrdmulhq_n_s16(v1304, 18343);
-    int16x8_t v1306 = vaddq_s16(v1300, v1305);
-    int16x8_t v1307 = vqrdmulhq_n_s16(v1306, 16840);
-    int16x8_t v1308 = vaddq_s16(v1296, v1307);
-    int16x8_t v1309 = vsubq_s16(v1127, v1129);
-    int16x8_t v1310 = vsubq_s16(v1131, v1133);
-    int16x8_t v1311 = vqrdmulhq_n_s16(v1310, 31869);
-    int16x8_t v1312 = vaddq_s16(v1309, v1311);
-    int16x8_t v1313 = vsubq_s16(v1137, v1139);
-    int16x8_t v1314 = vsubq_s16(v1141, v1143);
-    int16x8_t v1315 = vqrdmulhq_n_s16(v1314, 31869);
-    int16x8_t v1316 = vaddq_s16(v1313, v1315);
-    int16x8_t v1317 = vqrdmulhq_n_s16(v1316, 18830);
-    int16x8_t v1318 = vaddq_s16(v1312, v1317);
-    int16x8_t v1319 = vsubq_s16(v1149, v1151);
-    int16x8_t v1320 = vsubq_s16(v1153, v1155);
-    int16x8_t v1321 = vqrdmulhq_n_s16(v1320, 31869);
-    int16x8_t v1322 = vaddq_s16(v1319, v1321);
-    int16x8_t v1323 = vsubq_s16(v1159, v1161);
-    int16x8_t v1324 = vsubq_s16(v1163, v1165);
-    int16x8_t v1325 = vqrdmulhq_n_s16(v1324, 31869);
-    int16x8_t v1326 = vaddq_s16(v1323, v1325);
-    int16x8_t v1327 = vqrdmulhq_n_s16(v1326, 18830);
-    int16x8_t v1328 = vaddq_s16(v1322, v1327);
-    int16x8_t v1329 = vqrdmulhq_n_s16(v1328, 16944);
-    int16x8_t v1330 = vaddq_s16(v1318, v1329);
-    int16x8_t v1331 = vsubq_s16(v1081, v1083);
-    int16x8_t v1332 = vsubq_s16(v1085, v1087);
-    int16x8_t v1333_tmp = vqrdmulhq_n_s16(v1332, 5552);
-    int16x8_t v1333 = vaddq_s16(v1333_tmp, v1332);
-    int16x8_t v1334 = vaddq_s16(v1331, v1333);
-    int16x8_t v1335 = vsubq_s16(v1091, v1093);
-    int16x8_t v1336 = vsubq_s16(v1095, v1097);
-    int16x8_t v1337_tmp = vqrdmulhq_n_s16(v1336, 5552);
-    int16x8_t v1337 = vaddq_s16(v1337_tmp, v1336);
-    int16x8_t v1338 = vaddq_s16(v1335, v1337);
-    int16x8_t v1339 = vqrdmulhq_n_s16(v1338, 19393);
-    int16x8_t v1340 = vaddq_s16(v1334, v1339);
-    int16x8_t v1341 = vsubq_s16(v1103, v1105);
-    int16x8_t v1342 = vsubq_s16(v1107, v1109);
-    int16x8_t v1343_tmp = vqrdmulhq_n_s16(v1342, 5552);
-    int16x8_t v1343 = vaddq_s16(v1343_tmp, v1342);
-    int16x8_t v1344 = vaddq_s16(v1341, v1343);
-    int16x8_t v1345 = vsubq_s16(v1113, v1115);
-    int16x8_t v1346 = vsubq_s16(v1117, v1119);
-    int16x8_t v1347_tmp = vqrdmulhq_n_s16(v1346, 5552);
-    int16x8_t v1347 = vaddq_s16(v1347_tmp, v1346);
-    int16x8_t v1348 = vaddq_s16(v1345, v1347);
-    int16x8_t v1349 = vqrdmulhq_n_s16(v1348, 19393);
-    int16x8_t v1350 = vaddq_s16(v1344, v1349);
-    int16x8_t v1351 = vqrdmulhq_n_s16(v1350, 17059);
-    int16x8_t v1352 = vaddq_s16(v1340, v1351);
-    int16x8_t v1353 = vsubq_s16(v990, v995);
-    int16x8_t v1354 = vsubq_s16(v1000, v1005);
-    int16x8_t v1355_tmp = vqrdmulhq_n_s16(v1354, 15865);
-    int16x8_t v1355 = vaddq_s16(v1355_tmp, v1354);
-    int16x8_t v1356 = vaddq_s16(v1353, v1355);
-    int16x8_t v1357 = vsubq_s16(v1012, v1017);
-    int16x8_t v1358 = vsubq_s16(v1022, v1027);
-    int16x8_t v1359_tmp = vqrdmulhq_n_s16(v1358, 15865);
-    int16x8_t v1359 = vaddq_s16(v1359_tmp, v1358);
-    int16x8_t v1360 = vaddq_s16(v1357, v1359);
-    int16x8_t v1361 = vqrdmulhq_n_s16(v1360, 20040);
-    int16x8_t v1362 = vaddq_s16(v1356, v1361);
-    int16x8_t v1363 = vsubq_s16(v1036, v1041);
-    int16x8_t v1364 = vsubq_s16(v1046, v1051);
-    int16x8_t v1365_tmp = vqrdmulhq_n_s16(v1364, 15865);
-    int16x8_t v1365 = vaddq_s16(v1365_tmp, v1364);
-    int16x8_t v1366 = vaddq_s16(v1363, v1365);
-    int16x8_t v1367 = vsubq_s16(v1058, v1063);
-    int16x8_t v1368 = vsubq_s16(v1068, v1073);
-    int16x8_t v1369_tmp = vqrdmulhq_n_s16(v1368, 15865);
-    int16x8_t v1369 = vaddq_s16(v1369_tmp, v1368);
-    int16x8_t v1370 = vaddq_s16(v1367, v1369);
-    int16x8_t v1371 = vqrdmulhq_n_s16(v1370, 20040);
-    int16x8_t v1372 = vaddq_s16(v1366, v1371);
-    int16x8_t v1373 = vqrdmulhq_n_s16(v1372, 17187);
-    int16x8_t v1374 = vaddq_s16(v1362, v1373);
-    int16x8_t v1375 = vsubq_s16(v895, v900);
-    int16x8_t v1376 = vsubq_s16(v905, v910);
-    int16x8_t v1377_tmp = vqrdmulhq_n_s16(v1376, 1893);
-    int16x8_t v1377 = vmlaq_n_s16(v1377_tmp, v1376, 2);
-    int16x8_t v1378 = vaddq_s16(v1375, v1377);
-    int16x8_t v1379 = vsubq_s16(v918, v923);
-    int16x8_t v1380 = vsubq_s16(v928, v933);
-    int16x8_t v1381_tmp = vqrdmulhq_n_s16(v1380, 1893);
-    int16x8_t v1381 = vmlaq_n_s16(v1381_tmp, v1380, 2);
-    int16x8_t v1382 = vaddq_s16(v1379, v1381);
-    int16x8_t v1383 = vqrdmulhq_n_s16(v1382, 20783);
-    int16x8_t v1384 = vaddq_s16(v1378, v1383);
-    int16x8_t v1385 = vsubq_s16(v942, v947);
-    int16x8_t v1386 = vsubq_s16(v952, v957);
-    int16x8_t v1387_tmp = vqrdmulhq_n_s16(v1386, 1893);
-    int16x8_t v1387 = vmlaq_n_s16(v1387_tmp, v1386, 2);
-    int16x8_t v1388 = vaddq_s16(v1385, v1387);
-    int16x8_t v1389 = vsubq_s16(v964, v969);
-    int16x8_t v1390 = vsubq_s16(v974, v979);
-    int16x8_t v1391_tmp = vqrdmulhq_n_s16(v1390, 1893);
-    int16x8_t v1391 = vmlaq_n_s16(v1391_tmp, v1390, 2);
-    int16x8_t v1392 = vaddq_s16(v1389, v1391);
-    int16x8_t v1393 = vqrdmulhq_n_s16(v1392, 20783);
-    int16x8_t v1394 = vaddq_s16(v1388, v1393);
-    int16x8_t v1395 = vqrdmulhq_n_s16(v1394, 17326);
-    int16x8_t v1396 = vaddq_s16(v1384, v1395);
-    int16x8_t v1397 = vsubq_s16(v711, v722);
-    int16x8_t v1398 = vsubq_s16(v733, v744);
-    int16x8_t v1399_tmp = vqrdmulhq_n_s16(v1398, 13357);
-    int16x8_t v1399 = vmlaq_n_s16(v1399_tmp, v1398, 3);
-    int16x8_t v1400 = vaddq_s16(v1397, v1399);
-    int16x8_t v1401 = vsubq_s16(v757, v768);
-    int16x8_t v1402 = vsubq_s16(v779, v790);
-    int16x8_t v1403_tmp = vqrdmulhq_n_s16(v1402, 13357);
-    int16x8_t v1403 = vmlaq_n_s16(v1403_tmp, v1402, 3);
-    int16x8_t v1404 = vaddq_s16(v1401, v1403);
-    int16x8_t v1405 = vqrdmulhq_n_s16(v1404, 21637);
-    int16x8_t v1406 = vaddq_s16(v1400, v1405);
-    int16x8_t v1407 = vsubq_s16(v805, v816);
-    int16x8_t v1408 = vsubq_s16(v827, v838);
-    int16x8_t v1409_tmp = vqrdmulhq_n_s16(v1408, 13357);
-    int16x8_t v1409 = vmlaq_n_s16(v1409_tmp, v1408, 3);
-    int16x8_t v1410 = vaddq_s16(v1407, v1409);
-    int16x8_t v1411 = vsubq_s16(v851, v862);
-    int16x8_t v1412 = vsubq_s16(v873, v884);
-    int16x8_t v1413_tmp = vqrdmulhq_n_s16(v1412, 13357);
-    int16x8_t v1413 = vmlaq_n_s16(v1413_tmp, v1412, 3);
-    int16x8_t v1414 = vaddq_s16(v1411, v1413);
-    int16x8_t v1415 = vqrdmulhq_n_s16(v1414, 21637);
-    int16x8_t v1416 = vaddq_s16(v1410, v1415);
-    int16x8_t v1417 = vqrdmulhq_n_s16(v1416, 17479);
-    int16x8_t v1418 = vaddq_s16(v1406, v1417);
-    int16x8_t v1419 = vsubq_s16(v25, v60);
-    int16x8_t v1420 = vsubq_s16(v102, v138);
-    int16x8_t v1421_tmp = vqrdmulhq_n_s16(v1420, 6226);
-    int16x8_t v1421 = vmlaq_n_s16(v1421_tmp, v1420, 10);
-    int16x8_t v1422 = vaddq_s16(v1419, v1421);
-    int16x8_t v1423 = vsubq_s16(v182, v233);
-    int16x8_t v1424 = vsubq_s16(v275, v312);
-    int16x8_t v1425_tmp = vqrdmulhq_n_s16(v1424, 6226);
-    int16x8_t v1425 = vmlaq_n_s16(v1425_tmp, v1424, 10);
-    int16x8_t v1426 = vaddq_s16(v1423, v1425);
-    int16x8_t v1427 = vqrdmulhq_n_s16(v1426, 22622);
-    int16x8_t v1428 = vaddq_s16(v1422, v1427);
-    int16x8_t v1429 = vsubq_s16(v358, v409);
-    int16x8_t v1430 = vsubq_s16(v481, v519);
-    int16x8_t v1431_tmp = vqrdmulhq_n_s16(v1430, 6226);
-    int16x8_t v1431 = vmlaq_n_s16(v1431_tmp, v1430, 10);
-    int16x8_t v1432 = vaddq_s16(v1429, v1431);
-    int16x8_t v1433 = vsubq_s16(v563, v614);
-    int16x8_t v1434 = vsubq_s16(v656, v694);
-    int16x8_t v1435_tmp = vqrdmulhq_n_s16(v1434, 6226);
-    int16x8_t v1435 = vmlaq_n_s16(v1435_tmp, v1434, 10);
-    int16x8_t v1436 = vaddq_s16(v1433, v1435);
-    int16x8_t v1437 = vqrdmulhq_n_s16(v1436, 22622);
-    int16x8_t v1438 = vaddq_s16(v1432, v1437);
-    int16x8_t v1439 = vqrdmulhq_n_s16(v1438, 17646);
-    int16x8_t v1440 = vaddq_s16(v1428, v1439);
-    int16x8_t v1441 = vsubq_s16(v1419, v1421);
-    int16x8_t v1442 = vsubq_s16(v1423, v1425);
-    int16x8_t v1443 = vqrdmulhq_n_s16(v1442, 23761);
-    int16x8_t v1444 = vaddq_s16(v1441, v1443);
-    int16x8_t v1445 = vsubq_s16(v1429, v1431);
-    int16x8_t v1446 = vsubq_s16(v1433, v1435);
-    int16x8_t v1447 = vqrdmulhq_n_s16(v1446, 23761);
-    int16x8_t v1448 = vaddq_s16(v1445, v1447);
-    int16x8_t v1449 = vqrdmulhq_n_s16(v1448, 17826);
-    int16x8_t v1450 = vaddq_s16(v1444, v1449);
-    int16x8_t v1451 = vsubq_s16(v1397, v1399);
-    int16x8_t v1452 = vsubq_s16(v1401, v1403);
-    int16x8_t v1453 = vqrdmulhq_n_s16(v1452, 25084);
-    int16x8_t v1454 = vaddq_s16(v1451, v1453);
-    int16x8_t v1455 = vsubq_s16(v1407, v1409);
-    int16x8_t v1456 = vsubq_s16(v1411, v1413);
-    int16x8_t v1457 = vqrdmulhq_n_s16(v1456, 25084);
-    int16x8_t v1458 = vaddq_s16(v1455, v1457);
-    int16x8_t v1459 = vqrdmulhq_n_s16(v1458, 18021);
-    int16x8_t v1460 = vaddq_s16(v1454, v1459);
-    int16x8_t v1461 = vsubq_s16(v1375, v1377);
-    int16x8_t v1462 = vsubq_s16(v1379, v1381);
-    int16x8_t v1463 = vqrdmulhq_n_s16(v1462, 26631);
-    int16x8_t v1464 = vaddq_s16(v1461, v1463);
-    int16x8_t v1465 = vsubq_s16(v1385, v1387);
-    int16x8_t v1466 = vsubq_s16(v1389, v1391);
-    int16x8_t v1467 = vqrdmulhq_n_s16(v1466, 26631);
-    int16x8_t v1468 = vaddq_s16(v1465, v1467);
-    int16x8_t v1469 = vqrdmulhq_n_s16(v1468, 18231);
-    int16x8_t v1470 = vaddq_s16(v1464, v1469);
-    int16x8_t v1471 = vsubq_s16(v1353, v1355);
-    int16x8_t v1472 = vsubq_s16(v1357, v1359);
-    int16x8_t v1473 = vqrdmulhq_n_s16(v1472, 28454);
-    int16x8_t v1474 = vaddq_s16(v1471, v1473);
-    int16x8_t v1475 = vsubq_s16(v1363, v1365);
-    int16x8_t v1476 = vsubq_s16(v1367, v1369);
-    int16x8_t v1477 = vqrdmulhq_n_s16(v1476, 28454);
-    int16x8_t v1478 = vaddq_s16(v1475, v1477);
-    int16x8_t v1479 = vqrdmulhq_n_s16(v1478, 18458);
-    int16x8_t v1480 = vaddq_s16(v1474, v1479);
-    int16x8_t v1481 = vsubq_s16(v1331, v1333);
-    int16x8_t v1482 = vsubq_s16(v1335, v1337);
-    int16x8_t v1483 = vqrdmulhq_n_s16(v1482, 30624);
-    int16x8_t v1484 = vaddq_s16(v1481, v1483);
-    int16x8_t v1485 = vsubq_s16(v1341, v1343);
-    int16x8_t v1486 = vsubq_s16(v1345, v1347);
-    int16x8_t v1487 = vqrdmulhq_n_s16(v1486, 30624);
-    int16x8_t v1488 = vaddq_s16(v1485, v1487);
-    int16x8_t v1489 = vqrdmulhq_n_s16(v1488, 18702);
-    int16x8_t v1490 = vaddq_s16(v1484, v1489);
-    int16x8_t v1491 = vsubq_s16(v1309, v1311);
-    int16x8_t v1492 = vsubq_s16(v1313, v1315);
-    int16x8_t v1493_tmp = vqrdmulhq_n_s16(v1492, 472);
-    int16x8_t v1493 = vaddq_s16(v1493_tmp, v1492);
-    int16x8_t v1494 = vaddq_s16(v1491, v1493);
-    int16x8_t v1495 = vsubq_s16(v1319, v1321);
-    int16x8_t v1496 = vsubq_s16(v1323, v1325);
-    int16x8_t v1497_tmp = vqrdmulhq_n_s16(v1496, 472);
-    int16x8_t v1497 = vaddq_s16(v1497_tmp, v1496);
-    int16x8_t v1498 = vaddq_s16(v1495, v1497);
-    int16x8_t v1499 = vqrdmulhq_n_s16(v1498, 18964);
-    int16x8_t v1500 = vaddq_s16(v1494, v1499);
-    int16x8_t v1501 = vsubq_s16(v1287, v1289);
-    int16x8_t v1502 = vsubq_s16(v1291, v1293);
-    int16x8_t v1503_tmp = vqrdmulhq_n_s16(v1502, 3672);
-    int16x8_t v1503 = vaddq_s16(v1503_tmp, v1502);
-    int16x8_t v1504 = vaddq_s16(v1501, v1503);
-    int16x8_t v1505 = vsubq_s16(v1297, v1299);
-    int16x8_t v1506 = vsubq_s16(v1301, v1303);
-    int16x8_t v1507_tmp = vqrdmulhq_n_s16(v1506, 3672);
-    int16x8_t v1507 = vaddq_s16(v1507_tmp, v1506);
-    int16x8_t v1508 = vaddq_s16(v1505, v1507);
-    int16x8_t v1509 = vqrdmulhq_n_s16(v1508, 19245);
-    int16x8_t v1510 = vaddq_s16(v1504, v1509);
-    int16x8_t v1511 = vsubq_s16(v1265, v1267);
-    int16x8_t v1512 = vsubq_s16(v1269, v1271);
-    int16x8_t v1513_tmp = vqrdmulhq_n_s16(v1512, 7662);
-    int16x8_t v1513 = vaddq_s16(v1513_tmp, v1512);
-    int16x8_t v1514 = vaddq_s16(v1511, v1513);
-    int16x8_t v1515 = vsubq_s16(v1275, v1277);
-    int16x8_t v1516 = vsubq_s16(v1279, v1281);
-    int16x8_t v1517_tmp = vqrdmulhq_n_s16(v1516, 7662);
-    int16x8_t v1517 = vaddq_s16(v1517_tmp, v1516);
-    int16x8_t v1518 = vaddq_s16(v1515, v1517);
-    int16x8_t v1519 = vqrdmulhq_n_s16(v1518, 19546);
-    int16x8_t v1520 = vaddq_s16(v1514, v1519);
-    int16x8_t v1521 = vsubq_s16(v1222, v1227);
-    int16x8_t v1522 = vsubq_s16(v1232, v1237);
-    int16x8_t v1523_tmp = vqrdmulhq_n_s16(v1522, 12756);
-    int16x8_t v1523 = vaddq_s16(v1523_tmp, v1522);
-    int16x8_t v1524 = vaddq_s16(v1521, v1523);
-    int16x8_t v1525 = vsubq_s16(v1244, v1249);
-    int16x8_t v1526 = vsubq_s16(v1254, v1259);
-    int16x8_t v1527_tmp = vqrdmulhq_n_s16(v1526, 12756);
-    int16x8_t v1527 = vaddq_s16(v1527_tmp, v1526);
-    int16x8_t v1528 = vaddq_s16(v1525, v1527);
-    int16x8_t v1529 = vqrdmulhq_n_s16(v1528, 19869);
-    int16x8_t v1530 = vaddq_s16(v1524, v1529);
-    int16x8_t v1531 = vsubq_s16(v1176, v1181);
-    int16x8_t v1532 = vsubq_s16(v1186, v1191);
-    int16x8_t v1533_tmp = vqrdmulhq_n_s16(v1532, 19463);
-    int16x8_t v1533 = vaddq_s16(v1533_tmp, v1532);
-    int16x8_t v1534 = vaddq_s16(v1531, v1533);
-    int16x8_t v1535 = vsubq_s16(v1198, v1203);
-    int16x8_t v1536 = vsubq_s16(v1208, v1213);
-    int16x8_t v1537_tmp = vqrdmulhq_n_s16(v1536, 19463);
-    int16x8_t v1537 = vaddq_s16(v1537_tmp, v1536);
-    int16x8_t v1538 = vaddq_s16(v1535, v1537);
-    int16x8_t v1539 = vqrdmulhq_n_s16(v1538, 20216);
-    int16x8_t v1540 = vaddq_s16(v1534, v1539);
-    int16x8_t v1541 = vsubq_s16(v1130, v1135);
-    int16x8_t v1542 = vsubq_s16(v1140, v1145);
-    int16x8_t v1543_tmp = vqrdmulhq_n_s16(v1542, 28661);
-    int16x8_t v1543 = vaddq_s16(v1543_tmp, v1542);
-    int16x8_t v1544 = vaddq_s16(v1541, v1543);
-    int16x8_t v1545 = vsubq_s16(v1152, v1157);
-    int16x8_t v1546 = vsubq_s16(v1162, v1167);
-    int16x8_t v1547_tmp = vqrdmulhq_n_s16(v1546, 28661);
-    int16x8_t v1547 = vaddq_s16(v1547_tmp, v1546);
-    int16x8_t v1548 = vaddq_s16(v1545, v1547);
-    int16x8_t v1549 = vqrdmulhq_n_s16(v1548, 20587);
-    int16x8_t v1550 = vaddq_s16(v1544, v1549);
-    int16x8_t v1551 = vsubq_s16(v1084, v1089);
-    int16x8_t v1552 = vsubq_s16(v1094, v1099);
-    int16x8_t v1553_tmp = vqrdmulhq_n_s16(v1552, 9242);
-    int16x8_t v1553 = vmlaq_n_s16(v1553_tmp, v1552, 2);
-    int16x8_t v1554 = vaddq_s16(v1551, v1553);
-    int16x8_t v1555 = vsubq_s16(v1106, v1111);
-    int16x8_t v1556 = vsubq_s16(v1116, v1121);
-    int16x8_t v1557_tmp = vqrdmulhq_n_s16(v1556, 9242);
-    int16x8_t v1557 = vmlaq_n_s16(v1557_tmp, v1556, 2);
-    int16x8_t v1558 = vaddq_s16(v1555, v1557);
-    int16x8_t v1559 = vqrdmulhq_n_s16(v1558, 20985);
-    int16x8_t v1560 = vaddq_s16(v1554, v1559);
-    int16x8_t v1561 = vsubq_s16(v996, v1007);
-    int16x8_t v1562 = vsubq_s16(v1018, v1029);
-    int16x8_t v1563_tmp = vqrdmulhq_n_s16(v1562, 30298);
-    int16x8_t v1563 = vmlaq_n_s16(v1563_tmp, v1562, 2);
-    int16x8_t v1564 = vaddq_s16(v1561, v1563);
-    int16x8_t v1565 = vsubq_s16(v1042, v1053);
-    int16x8_t v1566 = vsubq_s16(v1064, v1075);
-    int16x8_t v1567_tmp = vqrdmulhq_n_s16(v1566, 30298);
-    int16x8_t v1567 = vmlaq_n_s16(v1567_tmp, v1566, 2);
-    int16x8_t v1568 = vaddq_s16(v1565, v1567);
-    int16x8_t v1569 = vqrdmulhq_n_s16(v1568, 21412);
-    int16x8_t v1570 = vaddq_s16(v1564, v1569);
-    int16x8_t v1571 = vsubq_s16(v901, v912);
-    int16x8_t v1572 = vsubq_s16(v924, v935);
-    int16x8_t v1573_tmp = vqrdmulhq_n_s16(v1572, 2773);
-    int16x8_t v1573 = vmlaq_n_s16(v1573_tmp, v1572, 4);
-    int16x8_t v1574 = vaddq_s16(v1571, v1573);
-    int16x8_t v1575 = vsubq_s16(v948, v959);
-    int16x8_t v1576 = vsubq_s16(v970, v981);
-    int16x8_t v1577_tmp = vqrdmulhq_n_s16(v1576, 2773);
-    int16x8_t v1577 = vmlaq_n_s16(v1577_tmp, v1576, 4);
-    int16x8_t v1578 = vaddq_s16(v1575, v1577);
-    int16x8_t v1579 = vqrdmulhq_n_s16(v1578, 21871);
-    int16x8_t v1580 = vaddq_s16(v1574, v1579);
-    int16x8_t v1581 = vsubq_s16(v723, v746);
-    int16x8_t v1582 = vsubq_s16(v769, v792);
-    int16x8_t v1583_tmp = vqrdmulhq_n_s16(v1582, 26108);
-    int16x8_t v1583 = vmlaq_n_s16(v1583_tmp, v1582, 6);
-    int16x8_t v1584 = vaddq_s16(v1581, v1583);
-    int16x8_t v1585 = vsubq_s16(v817, v840);
-    int16x8_t v1586 = vsubq_s16(v863, v886);
-    int16x8_t v1587_tmp = vqrdmulhq_n_s16(v1586, 26108);
-    int16x8_t v1587 = vmlaq_n_s16(v1587_tmp, v1586, 6);
-    int16x8_t v1588 = vaddq_s16(v1585, v1587);
-    int16x8_t v1589 = vqrdmulhq_n_s16(v1588, 22363);
-    int16x8_t v1590 = vaddq_s16(v1584, v1589);
-    int16x8_t v1591 = vsubq_s16(v61, v140);
-    int16x8_t v1592 = vsubq_s16(v234, v314);
-    int16x8_t v1593_tmp = vqrdmulhq_n_s16(v1592, 12251);
-    int16x8_t v1593 = vmlaq_n_s16(v1593_tmp, v1592, 20);
-    int16x8_t v1594 = vaddq_s16(v1591, v1593);
-    int16x8_t v1595 = vsubq_s16(v410, v521);
-    int16x8_t v1596 = vsubq_s16(v615, v696);
-    int16x8_t v1597_tmp = vqrdmulhq_n_s16(v1596, 12251);
-    int16x8_t v1597 = vmlaq_n_s16(v1597_tmp, v1596, 20);
-    int16x8_t v1598 = vaddq_s16(v1595, v1597);
-    int16x8_t v1599 = vqrdmulhq_n_s16(v1598, 22891);
-    int16x8_t v1600 = vaddq_s16(v1594, v1599);
-    int16x8_t v1601 = vsubq_s16(v1591, v1593);
-    int16x8_t v1602 = vsubq_s16(v1595, v1597);
-    int16x8_t v1603 = vqrdmulhq_n_s16(v1602, 23460);
-    int16x8_t v1604 = vaddq_s16(v1601, v1603);
-    int16x8_t v1605 = vsubq_s16(v1581, v1583);
-    int16x8_t v1606 = vsubq_s16(v1585, v1587);
-    int16x8_t v1607 = vqrdmulhq_n_s16(v1606, 24073);
-    int16x8_t v1608 = vaddq_s16(v1605, v1607);
-    int16x8_t v1609 = vsubq_s16(v1571, v1573);
-    int16x8_t v1610 = vsubq_s16(v1575, v1577);
-    int16x8_t v1611 = vqrdmulhq_n_s16(v1610, 24734);
-    int16x8_t v1612 = vaddq_s16(v1609, v1611);
-    int16x8_t v1613 = vsubq_s16(v1561, v1563);
-    int16x8_t v1614 = vsubq_s16(v1565, v1567);
-    int16x8_t v1615 = vqrdmulhq_n_s16(v1614, 25448);
-    int16x8_t v1616 = vaddq_s16(v1613, v1615);
-    int16x8_t v1617 = vsubq_s16(v1551, v1553);
-    int16x8_t v1618 = vsubq_s16(v1555, v1557);
-    int16x8_t v1619 = vqrdmulhq_n_s16(v1618, 26220);
-    int16x8_t v1620 = vaddq_s16(v1617, v1619);
-    int16x8_t v1621 = vsubq_s16(v1541, v1543);
-    int16x8_t v1622 = vsubq_s16(v1545, v1547);
-    int16x8_t v1623 = vqrdmulhq_n_s16(v1622, 27058);
-    int16x8_t v1624 = vaddq_s16(v1621, v1623);
-    int16x8_t v1625 = vsubq_s16(v1531, v1533);
-    int16x8_t v1626 = vsubq_s16(v1535, v1537);
-    int16x8_t v1627 = vqrdmulhq_n_s16(v1626, 27969);
-    int16x8_t v1628 = vaddq_s16(v1625, v1627);
-    int16x8_t v1629 = vsubq_s16(v1521, v1523);
-    int16x8_t v1630 = vsubq_s16(v1525, v1527);
-    int16x8_t v1631 = vqrdmulhq_n_s16(v1630, 28961);
-    int16x8_t v1632 = vaddq_s16(v1629, v1631);
-    int16x8_t v1633 = vsubq_s16(v1511, v1513);
-    int16x8_t v1634 = vsubq_s16(v1515, v1517);
-    int16x8_t v1635 = vqrdmulhq_n_s16(v1634, 30044);
-    int16x8_t v1636 = vaddq_s16(v1633, v1635);
-    int16x8_t v1637 = vsubq_s16(v1501, v1503);
-    int16x8_t v1638 = vsubq_s16(v1505, v1507);
-    int16x8_t v1639 = vqrdmulhq_n_s16(v1638, 31232);
-    int16x8_t v1640 = vaddq_s16(v1637, v1639);
-    int16x8_t v1641 = vsubq_s16(v1491, v1493);
-    int16x8_t v1642 = vsubq_s16(v1495, v1497);
-    int16x8_t v1643 = vqrdmulhq_n_s16(v1642, 32538);
-    int16x8_t v1644 = vaddq_s16(v1641, v1643);
-    int16x8_t v1645 = vsubq_s16(v1481, v1483);
-    int16x8_t v1646 = vsubq_s16(v1485, v1487);
-    int16x8_t v1647_tmp = vqrdmulhq_n_s16(v1646, 1211);
-    int16x8_t v1647 = vaddq_s16(v1647_tmp, v1646);
-    int16x8_t v1648 = vaddq_s16(v1645, v1647);
-    int16x8_t v1649 = vsubq_s16(v1471, v1473);
-    int16x8_t v1650 = vsubq_s16(v1475, v1477);
-    int16x8_t v1651_tmp = vqrdmulhq_n_s16(v1650, 2808);
-    int16x8_t v1651 = vaddq_s16(v1651_tmp, v1650);
-    int16x8_t v1652 = vaddq_s16(v1649, v1651);
-    int16x8_t v1653 = vsubq_s16(v1461, v1463);
-    int16x8_t v1654 = vsubq_s16(v1465, v1467);
-    int16x8_t v1655_tmp = vqrdmulhq_n_s16(v1654, 4586);
-    int16x8_t v1655 = vaddq_s16(v1655_tmp, v1654);
-    int16x8_t v1656 = vaddq_s16(v1653, v1655);
-    int16x8_t v1657 = vsubq_s16(v1451, v1453);
-    int16x8_t v1658 = vsubq_s16(v1455, v1457);
-    int16x8_t v1659_tmp = vqrdmulhq_n_s16(v1658, 6576);
-    int16x8_t v1659 = vaddq_s16(v1659_tmp, v1658);
-    int16x8_t v1660 = vaddq_s16(v1657, v1659);
-    int16x8_t v1661 = vsubq_s16(v1441, v1443);
-    int16x8_t v1662 = vsubq_s16(v1445, v1447);
-    int16x8_t v1663_tmp = vqrdmulhq_n_s16(v1662, 8817);
-    int16x8_t v1663 = vaddq_s16(v1663_tmp, v1662);
-    int16x8_t v1664 = vaddq_s16(v1661, v1663);
-    int16x8_t v1665 = vsubq_s16(v1422, v1427);
-    int16x8_t v1666 = vsubq_s16(v1432, v1437);
-    int16x8_t v1667_tmp = vqrdmulhq_n_s16(v1666, 11356);
-    int16x8_t v1667 = vaddq_s16(v1667_tmp, v1666);
-    int16x8_t v1668 = vaddq_s16(v1665, v1667);
-    int16x8_t v1669 = vsubq_s16(v1400, v1405);
-    int16x8_t v1670 = vsubq_s16(v1410, v1415);
-    int16x8_t v1671_tmp = vqrdmulhq_n_s16(v1670, 14256);
-    int16x8_t v1671 = vaddq_s16(v1671_tmp, v1670);
-    int16x8_t v1672 = vaddq_s16(v1669, v1671);
-    int16x8_t v1673 = vsubq_s16(v1378, v1383);
-    int16x8_t v1674 = vsubq_s16(v1388, v1393);
-    int16x8_t v1675_tmp = vqrdmulhq_n_s16(v1674, 17596);
-    int16x8_t v1675 = vaddq_s16(v1675_tmp, v1674);
-    int16x8_t v1676 = vaddq_s16(v1673, v1675);
-    int16x8_t v1677 = vsubq_s16(v1356, v1361);
-    int16x8_t v1678 = vsubq_s16(v1366, v1371);
-    int16x8_t v1679_tmp = vqrdmulhq_n_s16(v1678, 21483);
-    int16x8_t v1679 = vaddq_s16(v1679_tmp, v1678);
-    int16x8_t v1680 = vaddq_s16(v1677, v1679);
-    int16x8_t v1681 = vsubq_s16(v1334, v1339);
-    int16x8_t v1682 = vsubq_s16(v1344, v1349);
-    int16x8_t v1683_tmp = vqrdmulhq_n_s16(v1682, 26057);
-    int16x8_t v1683 = vaddq_s16(v1683_tmp, v1682);
-    int16x8_t v1684 = vaddq_s16(v1681, v1683);
-    int16x8_t v1685 = vsubq_s16(v1312, v1317);
-    int16x8_t v1686 = vsubq_s16(v1322, v1327);
-    int16x8_t v1687_tmp = vqrdmulhq_n_s16(v1686, 31517);
-    int16x8_t v1687 = vaddq_s16(v1687_tmp, v1686);
-    int16x8_t v1688 = vaddq_s16(v1685, v1687);
-    int16x8_t v1689 = vsubq_s16(v1290, v1295);
-    int16x8_t v1690 = vsubq_s16(v1300, v1305);
-    int16x8_t v1691_tmp = vqrdmulhq_n_s16(v1690, 5373);
-    int16x8_t v1691 = vmlaq_n_s16(v1691_tmp, v1690, 2);
-    int16x8_t v1692 = vaddq_s16(v1689, v1691);
-    int16x8_t v1693 = vsubq_s16(v1268, v1273);
-    int16x8_t v1694 = vsubq_s16(v1278, v1283);
-    int16x8_t v1695_tmp = vqrdmulhq_n_s16(v1694, 13571);
-    int16x8_t v1695 = vmlaq_n_s16(v1695_tmp, v1694, 2);
-    int16x8_t v1696 = vaddq_s16(v1693, v1695);
-    int16x8_t v1697 = vsubq_s16(v1228, v1239);
-    int16x8_t v1698 = vsubq_s16(v1250, v1261);
-    int16x8_t v1699_tmp = vqrdmulhq_n_s16(v1698, 23975);
-    int16x8_t v1699 = vmlaq_n_s16(v1699_tmp, v1698, 2);
-    int16x8_t v1700 = vaddq_s16(v1697, v1699);
-    int16x8_t v1701 = vsubq_s16(v1182, v1193);
-    int16x8_t v1702 = vsubq_s16(v1204, v1215);
-    int16x8_t v1703_tmp = vqrdmulhq_n_s16(v1702, 4832);
-    int16x8_t v1703 = vmlaq_n_s16(v1703_tmp, v1702, 3);
-    int16x8_t v1704 = vaddq_s16(v1701, v1703);
-    int16x8_t v1705 = vsubq_s16(v1136, v1147);
-    int16x8_t v1706 = vsubq_s16(v1158, v1169);
-    int16x8_t v1707_tmp = vqrdmulhq_n_s16(v1706, 23437);
-    int16x8_t v1707 = vmlaq_n_s16(v1707_tmp, v1706, 3);
-    int16x8_t v1708 = vaddq_s16(v1705, v1707);
-    int16x8_t v1709 = vsubq_s16(v1090, v1101);
-    int16x8_t v1710 = vsubq_s16(v1112, v1123);
-    int16x8_t v1711_tmp = vqrdmulhq_n_s16(v1710, 17573);
-    int16x8_t v1711 = vmlaq_n_s16(v1711_tmp, v1710, 4);
-    int16x8_t v1712 = vaddq_s16(v1709, v1711);
-    int16x8_t v1713 = vsubq_s16(v1008, v1031);
-    int16x8_t v1714 = vsubq_s16(v1054, v1077);
-    int16x8_t v1715_tmp = vqrdmulhq_n_s16(v1714, 27122);
-    int16x8_t v1715 = vmlaq_n_s16(v1715_tmp, v1714, 5);
-    int16x8_t v1716 = vaddq_s16(v1713, v1715);
-    int16x8_t v1717 = vsubq_s16(v913, v937);
-    int16x8_t v1718 = vsubq_s16(v960, v983);
-    int16x8_t v1719_tmp = vqrdmulhq_n_s16(v1718, 5041);
-    int16x8_t v1719 = vmlaq_n_s16(v1719_tmp, v1718, 8);
-    int16x8_t v1720 = vaddq_s16(v1717, v1719);
-    int16x8_t v1721 = vsubq_s16(v747, v794);
-    int16x8_t v1722 = vsubq_s16(v841, v888);
-    int16x8_t v1723_tmp = vqrdmulhq_n_s16(v1722, 19146);
-    int16x8_t v1723 = vmlaq_n_s16(v1723_tmp, v1722, 13);
-    int16x8_t v1724 = vaddq_s16(v1721, v1723);
-    int16x8_t v1725 = vsubq_s16(v141, v316);
-    int16x8_t v1726 = vsubq_s16(v522, v698);
-    int16x8_t v1727_tmp = vqrdmulhq_n_s16(v1726, 24402);
-    int16x8_t v1727 = vmlaq_n_s16(v1727_tmp, v1726, 40);
-    int16x8_t v1728 = vaddq_s16(v1725, v1727);
-    int16x8_t v1729 = vsubq_s16(v1725, v1727);
-    int16x8_t v1730 = vsubq_s16(v1721, v1723);
-    int16x8_t v1731 = vsubq_s16(v1717, v1719);
-    int16x8_t v1732 = vsubq_s16(v1713, v1715);
-    int16x8_t v1733 = vsubq_s16(v1709, v1711);
-    int16x8_t v1734 = vsubq_s16(v1705, v1707);
-    int16x8_t v1735 = vsubq_s16(v1701, v1703);
-    int16x8_t v1736 = vsubq_s16(v1697, v1699);
-    int16x8_t v1737 = vsubq_s16(v1693, v1695);
-    int16x8_t v1738 = vsubq_s16(v1689, v1691);
-    int16x8_t v1739 = vsubq_s16(v1685, v1687);
-    int16x8_t v1740 = vsubq_s16(v1681, v1683);
-    int16x8_t v1741 = vsubq_s16(v1677, v1679);
-    int16x8_t v1742 = vsubq_s16(v1673, v1675);
-    int16x8_t v1743 = vsubq_s16(v1669, v1671);
-    int16x8_t v1744 = vsubq_s16(v1665, v1667);
-    int16x8_t v1745 = vsubq_s16(v1661, v1663);
-    int16x8_t v1746 = vsubq_s16(v1657, v1659);
-    int16x8_t v1747 = vsubq_s16(v1653, v1655);
-    int16x8_t v1748 = vsubq_s16(v1649, v1651);
-    int16x8_t v1749 = vsubq_s16(v1645, v1647);
-    int16x8_t v1750 = vsubq_s16(v1641, v1643);
-    int16x8_t v1751 = vsubq_s16(v1637, v1639);
-    int16x8_t v1752 = vsubq_s16(v1633, v1635);
-    int16x8_t v1753 = vsubq_s16(v1629, v1631);
-    int16x8_t v1754 = vsubq_s16(v1625, v1627);
-    int16x8_t v1755 = vsubq_s16(v1621, v1623);
-    int16x8_t v1756 = vsubq_s16(v1617, v1619);
-    int16x8_t v1757 = vsubq_s16(v1613, v1615);
-    int16x8_t v1758 = vsubq_s16(v1609, v1611);
-    int16x8_t v1759 = vsubq_s16(v1605, v1607);
-    int16x8_t v1760 = vsubq_s16(v1601, v1603);
-    int16x8_t v1761 = vsubq_s16(v1594, v1599);
-    int16x8_t v1762 = vsubq_s16(v1584, v1589);
-    int16x8_t v1763 = vsubq_s16(v1574, v1579);
-    int16x8_t v1764 = vsubq_s16(v1564, v1569);
-    int16x8_t v1765 = vsubq_s16(v1554, v1559);
-    int16x8_t v1766 = vsubq_s16(v1544, v1549);
-    int16x8_t v1767 = vsubq_s16(v1534, v1539);
-    int16x8_t v1768 = vsubq_s16(v1524, v1529);
-    int16x8_t v1769 = vsubq_s16(v1514, v1519);
-    int16x8_t v1770 = vsubq_s16(v1504, v1509);
-    int16x8_t v1771 = vsubq_s16(v1494, v1499);
-    int16x8_t v1772 = vsubq_s16(v1484, v1489);
-    int16x8_t v1773 = vsubq_s16(v1474, v1479);
-    int16x8_t v1774 = vsubq_s16(v1464, v1469);
-    int16x8_t v1775 = vsubq_s16(v1454, v1459);
-    int16x8_t v1776 = vsubq_s16(v1444, v1449);
-    int16x8_t v1777 = vsubq_s16(v1428, v1439);
-    int16x8_t v1778 = vsubq_s16(v1406, v1417);
-    int16x8_t v1779 = vsubq_s16(v1384, v1395);
-    int16x8_t v1780 = vsubq_s16(v1362, v1373);
-    int16x8_t v1781 = vsubq_s16(v1340, v1351);
-    int16x8_t v1782 = vsubq_s16(v1318, v1329);
-    int16x8_t v1783 = vsubq_s16(v1296, v1307);
-    int16x8_t v1784 = vsubq_s16(v1274, v1285);
-    int16x8_t v1785 = vsubq_s16(v1240, v1263);
-    int16x8_t v1786 = vsubq_s16(v1194, v1217);
-    int16x8_t v1787 = vsubq_s16(v1148, v1171);
-    int16x8_t v1788 = vsubq_s16(v1102, v1125);
-    int16x8_t v1789 = vsubq_s16(v1032, v1079);
-    int16x8_t v1790 = vsubq_s16(v938, v985);
-    int16x8_t v1791 = vsubq_s16(v795, v890);
-    int16x8_t v1792 = vsubq_s16(v317, v700);
-    vst1q_s16(out + out_stride * 0 + i, v701);
-    vst1q_s16(out + out_stride * 1 + i, v891);
-    vst1q_s16(out + out_stride * 2 + i, v986);
-    vst1q_s16(out + out_stride * 3 + i, v1080);
-    vst1q_s16(out + out_stride * 4 + i, v1126);
-    vst1q_s16(out + out_stride * 5 + i, v1172);
-    vst1q_s16(out + out_stride * 6 + i, v1218);
-    vst1q_s16(out + out_stride * 7 + i, v1264);
-    vst1q_s16(out + out_stride * 8 + i, v1286);
-    vst1q_s16(out + out_stride * 9 + i, v1308);
-    vst1q_s16(out + out_stride * 10 + i, v1330);
-    vst1q_s16(out + out_stride * 11 + i, v1352);
-    vst1q_s16(out + out_stride * 12 + i, v1374);
-    vst1q_s16(out + out_stride * 13 + i, v1396);
-    vst1q_s16(out + out_stride * 14 + i, v1418);
-    vst1q_s16(out + out_stride * 15 + i, v1440);
-    vst1q_s16(out + out_stride * 16 + i, v1450);
-    vst1q_s16(out + out_stride * 17 + i, v1460);
-    vst1q_s16(out + out_stride * 18 + i, v1470);
-    vst1q_s16(out + out_stride * 19 + i, v1480);
-    vst1q_s16(out + out_stride * 20 + i, v1490);
-    vst1q_s16(out + out_stride * 21 + i, v1500);
-    vst1q_s16(out + out_stride * 22 + i, v1510);
-    vst1q_s16(out + out_stride * 23 + i, v1520);
-    vst1q_s16(out + out_stride * 24 + i, v1530);
-    vst1q_s16(out + out_stride * 25 + i, v1540);
-    vst1q_s16(out + out_stride * 26 + i, v1550);
-    vst1q_s16(out + out_stride * 27 + i, v1560);
-    vst1q_s16(out + out_stride * 28 + i, v1570);
-    vst1q_s16(out + out_stride * 29 + i, v1580);
-    vst1q_s16(out + out_stride * 30 + i, v1590);
-    vst1q_s16(out + out_stride * 31 + i, v1600);
-    vst1q_s16(out + out_stride * 32 + i, v1604);
-    vst1q_s16(out + out_stride * 33 + i, v1608);
-    vst1q_s16(out + out_stride * 34 + i, v1612);
-    vst1q_s16(out + out_stride * 35 + i, v1616);
-    vst1q_s16(out + out_stride * 36 + i, v1620);
-    vst1q_s16(out + out_stride * 37 + i, v1624);
-    vst1q_s16(out + out_stride * 38 + i, v1628);
-    vst1q_s16(out + out_stride * 39 + i, v1632);
-    vst1q_s16(out + out_stride * 40 + i, v1636);
-    vst1q_s16(out + out_stride * 41 + i, v1640);
-    vst1q_s16(out + out_stride * 42 + i, v1644);
-    vst1q_s16(out + out_stride * 43 + i, v1648);
-    vst1q_s16(out + out_stride * 44 + i, v1652);
-    vst1q_s16(out + out_stride * 45 + i, v1656);
-    vst1q_s16(out + out_stride * 46 + i, v1660);
-    vst1q_s16(out + out_stride * 47 + i, v1664);
-    vst1q_s16(out + out_stride * 48 + i, v1668);
-    vst1q_s16(out + out_stride * 49 + i, v1672);
-    vst1q_s16(out + out_stride * 50 + i, v1676);
-    vst1q_s16(out + out_stride * 51 + i, v1680);
-    vst1q_s16(out + out_stride * 52 + i, v1684);
-    vst1q_s16(out + out_stride * 53 + i, v1688);
-    vst1q_s16(out + out_stride * 54 + i, v1692);
-    vst1q_s16(out + out_stride * 55 + i, v1696);
-    vst1q_s16(out + out_stride * 56 + i, v1700);
-    vst1q_s16(out + out_stride * 57 + i, v1704);
-    vst1q_s16(out + out_stride * 58 + i, v1708);
-    vst1q_s16(out + out_stride * 59 + i, v1712);
-    vst1q_s16(out + out_stride * 60 + i, v1716);
-    vst1q_s16(out + out_stride * 61 + i, v1720);
-    vst1q_s16(out + out_stride * 62 + i, v1724);
-    vst1q_s16(out + out_stride * 63 + i, v1728);
-    vst1q_s16(out + out_stride * 64 + i, v1729);
-    vst1q_s16(out + out_stride * 65 + i, v1730);
-    vst1q_s16(out + out_stride * 66 + i, v1731);
-    vst1q_s16(out + out_stride * 67 + i, v1732);
-    vst1q_s16(out + out_stride * 68 + i, v1733);
-    vst1q_s16(out + out_stride * 69 + i, v1734);
-    vst1q_s16(out + out_stride * 70 + i, v1735);
-    vst1q_s16(out + out_stride * 71 + i, v1736);
-    vst1q_s16(out + out_stride * 72 + i, v1737);
-    vst1q_s16(out + out_stride * 73 + i, v1738);
-    vst1q_s16(out + out_stride * 74 + i, v1739);
-    vst1q_s16(out + out_stride * 75 + i, v1740);
-    vst1q_s16(out + out_stride * 76 + i, v1741);
-    vst1q_s16(out + out_stride * 77 + i, v1742);
-    vst1q_s16(out + out_stride * 78 + i, v1743);
-    vst1q_s16(out + out_stride * 79 + i, v1744);
-    vst1q_s16(out + out_stride * 80 + i, v1745);
-    vst1q_s16(out + out_stride * 81 + i, v1746);
-    vst1q_s16(out + out_stride * 82 + i, v1747);
-    vst1q_s16(out + out_stride * 83 + i, v1748);
-    vst1q_s16(out + out_stride * 84 + i, v1749);
-    vst1q_s16(out + out_stride * 85 + i, v1750);
-    vst1q_s16(out + out_stride * 86 + i, v1751);
-    vst1q_s16(out + out_stride * 87 + i, v1752);
-    vst1q_s16(out + out_stride * 88 + i, v1753);
-    vst1q_s16(out + out_stride * 89 + i, v1754);
-    vst1q_s16(out + out_stride * 90 + i, v1755);
-    vst1q_s16(out + out_stride * 91 + i, v1756);
-    vst1q_s16(out + out_stride * 92 + i, v1757);
-    vst1q_s16(out + out_stride * 93 + i, v1758);
-    vst1q_s16(out + out_stride * 94 + i, v1759);
-    vst1q_s16(out + out_stride * 95 + i, v1760);
-    vst1q_s16(out + out_stride * 96 + i, v1761);
-    vst1q_s16(out + out_stride * 97 + i, v1762);
-    vst1q_s16(out + out_stride * 98 + i, v1763);
-    vst1q_s16(out + out_stride * 99 + i, v1764);
-    vst1q_s16(out + out_stride * 100 + i, v1765);
-    vst1q_s16(out + out_stride * 101 + i, v1766);
-    vst1q_s16(out + out_stride * 102 + i, v1767);
-    vst1q_s16(out + out_stride * 103 + i, v1768);
-    vst1q_s16(out + out_stride * 104 + i, v1769);
-    vst1q_s16(out + out_stride * 105 + i, v1770);
-    vst1q_s16(out + out_stride * 106 + i, v1771);
-    vst1q_s16(out + out_stride * 107 + i, v1772);
-    vst1q_s16(out + out_stride * 108 + i, v1773);
-    vst1q_s16(out + out_stride * 109 + i, v1774);
-    vst1q_s16(out + out_stride * 110 + i, v1775);
-    vst1q_s16(out + out_stride * 111 + i, v1776);
-    vst1q_s16(out + out_stride * 112 + i, v1777);
-    vst1q_s16(out + out_stride * 113 + i, v1778);
-    vst1q_s16(out + out_stride * 114 + i, v1779);
-    vst1q_s16(out + out_stride * 115 + i, v1780);
-    vst1q_s16(out + out_stride * 116 + i, v1781);
-    vst1q_s16(out + out_stride * 117 + i, v1782);
-    vst1q_s16(out + out_stride * 118 + i, v1783);
-    vst1q_s16(out + out_stride * 119 + i, v1784);
-    vst1q_s16(out + out_stride * 120 + i, v1785);
-    vst1q_s16(out + out_stride * 121 + i, v1786);
-    vst1q_s16(out + out_stride * 122 + i, v1787);
-    vst1q_s16(out + out_stride * 123 + i, v1788);
-    vst1q_s16(out + out_stride * 124 + i, v1789);
-    vst1q_s16(out + out_stride * 125 + i, v1790);
-    vst1q_s16(out + out_stride * 126 + i, v1791);
-    vst1q_s16(out + out_stride * 127 + i, v1792);
+  const HWY_CAPPED(int16_t, 8) d16;
+  for (size_t i = 0; i < count; i += Lanes(d16)) {
+    auto v0 = LoadU(d16, in + in_stride * 0 + i);
+    auto v1 = LoadU(d16, in + in_stride * 64 + i);
+    auto v2 = Add(v0, v1);
+    auto v3 = LoadU(d16, in + in_stride * 32 + i);
+    auto v4_tmp = MulFixedPoint15(v3, Set(d16, 13573));
+    auto v4 = Add(v4_tmp, v3);
+    auto v5 = LoadU(d16, in + in_stride * 96 + i);
+    auto v6 = Add(v5, v3);
+    auto v7 = Add(v4, v6);
+    auto v8 = MulFixedPoint15(v7, Set(d16, 17734));
+    auto v9 = Add(v2, v8);
+    auto v10 = LoadU(d16, in + in_stride * 16 + i);
+    auto v11_tmp = MulFixedPoint15(v10, Set(d16, 13573));
+    auto v11 = Add(v11_tmp, v10);
+    auto v12 = LoadU(d16, in + in_stride * 80 + i);
+    auto v13 = LoadU(d16, in + in_stride * 48 + i);
+    auto v14 = Add(v12, v13);
+    auto v15 = Add(v11, v14);
+    auto v16 = Add(v13, v10);
+    auto v17_tmp = MulFixedPoint15(v16, Set(d16, 13573));
+    auto v17 = Add(v17_tmp, v16);
+    auto v18 = LoadU(d16, in + in_stride * 112 + i);
+    auto v19 = Add(v18, v12);
+    auto v20 = Add(v19, v16);
+    auto v21 = Add(v17, v20);
+    auto v22 = MulFixedPoint15(v21, Set(d16, 17734));
+    auto v23 = Add(v15, v22);
+    auto v24 = MulFixedPoint15(v23, Set(d16, 16705));
+    auto v25 = Add(v9, v24);
+    auto v26 = LoadU(d16, in + in_stride * 8 + i);
+    auto v27_tmp = MulFixedPoint15(v26, Set(d16, 13573));
+    auto v27 = Add(v27_tmp, v26);
+    auto v28 = LoadU(d16, in + in_stride * 72 + i);
+    auto v29 = LoadU(d16, in + in_stride * 56 + i);
+    auto v30 = Add(v28, v29);
+    auto v31 = Add(v27, v30);
+    auto v32 = LoadU(d16, in + in_stride * 40 + i);
+    auto v33 = LoadU(d16, in + in_stride * 24 + i);
+    auto v34 = Add(v32, v33);
+    auto v35_tmp = MulFixedPoint15(v34, Set(d16, 13573));
+    auto v35 = Add(v35_tmp, v34);
+    auto v36 = LoadU(d16, in + in_stride * 104 + i);
+    auto v37 = LoadU(d16, in + in_stride * 88 + i);
+    auto v38 = Add(v36, v37);
+    auto v39 = Add(v38, v34);
+    auto v40 = Add(v35, v39);
+    auto v41 = MulFixedPoint15(v40, Set(d16, 17734));
+    auto v42 = Add(v31, v41);
+    auto v43 = Add(v33, v26);
+    auto v44_tmp = MulFixedPoint15(v43, Set(d16, 13573));
+    auto v44 = Add(v44_tmp, v43);
+    auto v45 = Add(v37, v28);
+    auto v46 = Add(v29, v32);
+    auto v47 = Add(v45, v46);
+    auto v48 = Add(v44, v47);
+    auto v49 = Add(v46, v43);
+    auto v50_tmp = MulFixedPoint15(v49, Set(d16, 13573));
+    auto v50 = Add(v50_tmp, v49);
+    auto v51 = LoadU(d16, in + in_stride * 120 + i);
+    auto v52 = Add(v51, v36);
+    auto v53 = Add(v52, v45);
+    auto v54 = Add(v53, v49);
+    auto v55 = Add(v50, v54);
+    auto v56 = MulFixedPoint15(v55, Set(d16, 17734));
+    auto v57 = Add(v48, v56);
+    auto v58 = MulFixedPoint15(v57, Set(d16, 16705));
+    auto v59 = Add(v42, v58);
+    auto v60 = MulFixedPoint15(v59, Set(d16, 16463));
+    auto v61 = Add(v25, v60);
+    auto v62 = LoadU(d16, in + in_stride * 4 + i);
+    auto v63_tmp = MulFixedPoint15(v62, Set(d16, 13573));
+    auto v63 = Add(v63_tmp, v62);
+    auto v64 = LoadU(d16, in + in_stride * 68 + i);
+    auto v65 = LoadU(d16, in + in_stride * 60 + i);
+    auto v66 = Add(v64, v65);
+    auto v67 = Add(v63, v66);
+    auto v68 = LoadU(d16, in + in_stride * 36 + i);
+    auto v69 = LoadU(d16, in + in_stride * 28 + i);
+    auto v70 = Add(v68, v69);
+    auto v71_tmp = MulFixedPoint15(v70, Set(d16, 13573));
+    auto v71 = Add(v71_tmp, v70);
+    auto v72 = LoadU(d16, in + in_stride * 100 + i);
+    auto v73 = LoadU(d16, in + in_stride * 92 + i);
+    auto v74 = Add(v72, v73);
+    auto v75 = Add(v74, v70);
+    auto v76 = Add(v71, v75);
+    auto v77 = MulFixedPoint15(v76, Set(d16, 17734));
+    auto v78 = Add(v67, v77);
+    auto v79 = LoadU(d16, in + in_stride * 20 + i);
+    auto v80 = LoadU(d16, in + in_stride * 12 + i);
+    auto v81 = Add(v79, v80);
+    auto v82_tmp = MulFixedPoint15(v81, Set(d16, 13573));
+    auto v82 = Add(v82_tmp, v81);
+    auto v83 = LoadU(d16, in + in_stride * 84 + i);
+    auto v84 = LoadU(d16, in + in_stride * 76 + i);
+    auto v85 = Add(v83, v84);
+    auto v86 = LoadU(d16, in + in_stride * 52 + i);
+    auto v87 = LoadU(d16, in + in_stride * 44 + i);
+    auto v88 = Add(v86, v87);
+    auto v89 = Add(v85, v88);
+    auto v90 = Add(v82, v89);
+    auto v91 = Add(v88, v81);
+    auto v92_tmp = MulFixedPoint15(v91, Set(d16, 13573));
+    auto v92 = Add(v92_tmp, v91);
+    auto v93 = LoadU(d16, in + in_stride * 116 + i);
+    auto v94 = LoadU(d16, in + in_stride * 108 + i);
+    auto v95 = Add(v93, v94);
+    auto v96 = Add(v95, v85);
+    auto v97 = Add(v96, v91);
+    auto v98 = Add(v92, v97);
+    auto v99 = MulFixedPoint15(v98, Set(d16, 17734));
+    auto v100 = Add(v90, v99);
+    auto v101 = MulFixedPoint15(v100, Set(d16, 16705));
+    auto v102 = Add(v78, v101);
+    auto v103 = Add(v80, v62);
+    auto v104_tmp = MulFixedPoint15(v103, Set(d16, 13573));
+    auto v104 = Add(v104_tmp, v103);
+    auto v105 = Add(v84, v64);
+    auto v106 = Add(v65, v86);
+    auto v107 = Add(v105, v106);
+    auto v108 = Add(v104, v107);
+    auto v109 = Add(v87, v68);
+    auto v110 = Add(v69, v79);
+    auto v111 = Add(v109, v110);
+    auto v112_tmp = MulFixedPoint15(v111, Set(d16, 13573));
+    auto v112 = Add(v112_tmp, v111);
+    auto v113 = Add(v94, v72);
+    auto v114 = Add(v73, v83);
+    auto v115 = Add(v113, v114);
+    auto v116 = Add(v115, v111);
+    auto v117 = Add(v112, v116);
+    auto v118 = MulFixedPoint15(v117, Set(d16, 17734));
+    auto v119 = Add(v108, v118);
+    auto v120 = Add(v110, v103);
+    auto v121_tmp = MulFixedPoint15(v120, Set(d16, 13573));
+    auto v121 = Add(v121_tmp, v120);
+    auto v122 = Add(v114, v105);
+    auto v123 = Add(v106, v109);
+    auto v124 = Add(v122, v123);
+    auto v125 = Add(v121, v124);
+    auto v126 = Add(v123, v120);
+    auto v127_tmp = MulFixedPoint15(v126, Set(d16, 13573));
+    auto v127 = Add(v127_tmp, v126);
+    auto v128 = LoadU(d16, in + in_stride * 124 + i);
+    auto v129 = Add(v128, v93);
+    auto v130 = Add(v129, v113);
+    auto v131 = Add(v130, v122);
+    auto v132 = Add(v131, v126);
+    auto v133 = Add(v127, v132);
+    auto v134 = MulFixedPoint15(v133, Set(d16, 17734));
+    auto v135 = Add(v125, v134);
+    auto v136 = MulFixedPoint15(v135, Set(d16, 16705));
+    auto v137 = Add(v119, v136);
+    auto v138 = MulFixedPoint15(v137, Set(d16, 16463));
+    auto v139 = Add(v102, v138);
+    auto v140 = MulFixedPoint15(v139, Set(d16, 16404));
+    auto v141 = Add(v61, v140);
+    auto v142 = LoadU(d16, in + in_stride * 2 + i);
+    auto v143_tmp = MulFixedPoint15(v142, Set(d16, 13573));
+    auto v143 = Add(v143_tmp, v142);
+    auto v144 = LoadU(d16, in + in_stride * 66 + i);
+    auto v145 = LoadU(d16, in + in_stride * 62 + i);
+    auto v146 = Add(v144, v145);
+    auto v147 = Add(v143, v146);
+    auto v148 = LoadU(d16, in + in_stride * 34 + i);
+    auto v149 = LoadU(d16, in + in_stride * 30 + i);
+    auto v150 = Add(v148, v149);
+    auto v151_tmp = MulFixedPoint15(v150, Set(d16, 13573));
+    auto v151 = Add(v151_tmp, v150);
+    auto v152 = LoadU(d16, in + in_stride * 98 + i);
+    auto v153 = LoadU(d16, in + in_stride * 94 + i);
+    auto v154 = Add(v152, v153);
+    auto v155 = Add(v154, v150);
+    auto v156 = Add(v151, v155);
+    auto v157 = MulFixedPoint15(v156, Set(d16, 17734));
+    auto v158 = Add(v147, v157);
+    auto v159 = LoadU(d16, in + in_stride * 18 + i);
+    auto v160 = LoadU(d16, in + in_stride * 14 + i);
+    auto v161 = Add(v159, v160);
+    auto v162_tmp = MulFixedPoint15(v161, Set(d16, 13573));
+    auto v162 = Add(v162_tmp, v161);
+    auto v163 = LoadU(d16, in + in_stride * 82 + i);
+    auto v164 = LoadU(d16, in + in_stride * 78 + i);
+    auto v165 = Add(v163, v164);
+    auto v166 = LoadU(d16, in + in_stride * 50 + i);
+    auto v167 = LoadU(d16, in + in_stride * 46 + i);
+    auto v168 = Add(v166, v167);
+    auto v169 = Add(v165, v168);
+    auto v170 = Add(v162, v169);
+    auto v171 = Add(v168, v161);
+    auto v172_tmp = MulFixedPoint15(v171, Set(d16, 13573));
+    auto v172 = Add(v172_tmp, v171);
+    auto v173 = LoadU(d16, in + in_stride * 114 + i);
+    auto v174 = LoadU(d16, in + in_stride * 110 + i);
+    auto v175 = Add(v173, v174);
+    auto v176 = Add(v175, v165);
+    auto v177 = Add(v176, v171);
+    auto v178 = Add(v172, v177);
+    auto v179 = MulFixedPoint15(v178, Set(d16, 17734));
+    auto v180 = Add(v170, v179);
+    auto v181 = MulFixedPoint15(v180, Set(d16, 16705));
+    auto v182 = Add(v158, v181);
+    auto v183 = LoadU(d16, in + in_stride * 10 + i);
+    auto v184 = LoadU(d16, in + in_stride * 6 + i);
+    auto v185 = Add(v183, v184);
+    auto v186_tmp = MulFixedPoint15(v185, Set(d16, 13573));
+    auto v186 = Add(v186_tmp, v185);
+    auto v187 = LoadU(d16, in + in_stride * 74 + i);
+    auto v188 = LoadU(d16, in + in_stride * 70 + i);
+    auto v189 = Add(v187, v188);
+    auto v190 = LoadU(d16, in + in_stride * 58 + i);
+    auto v191 = LoadU(d16, in + in_stride * 54 + i);
+    auto v192 = Add(v190, v191);
+    auto v193 = Add(v189, v192);
+    auto v194 = Add(v186, v193);
+    auto v195 = LoadU(d16, in + in_stride * 42 + i);
+    auto v196 = LoadU(d16, in + in_stride * 38 + i);
+    auto v197 = Add(v195, v196);
+    auto v198 = LoadU(d16, in + in_stride * 26 + i);
+    auto v199 = LoadU(d16, in + in_stride * 22 + i);
+    auto v200 = Add(v198, v199);
+    auto v201 = Add(v197, v200);
+    auto v202_tmp = MulFixedPoint15(v201, Set(d16, 13573));
+    auto v202 = Add(v202_tmp, v201);
+    auto v203 = LoadU(d16, in + in_stride * 106 + i);
+    auto v204 = LoadU(d16, in + in_stride * 102 + i);
+    auto v205 = Add(v203, v204);
+    auto v206 = LoadU(d16, in + in_stride * 90 + i);
+    auto v207 = LoadU(d16, in + in_stride * 86 + i);
+    auto v208 = Add(v206, v207);
+    auto v209 = Add(v205, v208);
+    auto v210 = Add(v209, v201);
+    auto v211 = Add(v202, v210);
+    auto v212 = MulFixedPoint15(v211, Set(d16, 17734));
+    auto v213 = Add(v194, v212);
+    auto v214 = Add(v200, v185);
+    auto v215_tmp = MulFixedPoint15(v214, Set(d16, 13573));
+    auto v215 = Add(v215_tmp, v214);
+    auto v216 = Add(v208, v189);
+    auto v217 = Add(v192, v197);
+    auto v218 = Add(v216, v217);
+    auto v219 = Add(v215, v218);
+    auto v220 = Add(v217, v214);
+    auto v221_tmp = MulFixedPoint15(v220, Set(d16, 13573));
+    auto v221 = Add(v221_tmp, v220);
+    auto v222 = LoadU(d16, in + in_stride * 122 + i);
+    auto v223 = LoadU(d16, in + in_stride * 118 + i);
+    auto v224 = Add(v222, v223);
+    auto v225 = Add(v224, v205);
+    auto v226 = Add(v225, v216);
+    auto v227 = Add(v226, v220);
+    auto v228 = Add(v221, v227);
+    auto v229 = MulFixedPoint15(v228, Set(d16, 17734));
+    auto v230 = Add(v219, v229);
+    auto v231 = MulFixedPoint15(v230, Set(d16, 16705));
+    auto v232 = Add(v213, v231);
+    auto v233 = MulFixedPoint15(v232, Set(d16, 16463));
+    auto v234 = Add(v182, v233);
+    auto v235 = Add(v184, v142);
+    auto v236_tmp = MulFixedPoint15(v235, Set(d16, 13573));
+    auto v236 = Add(v236_tmp, v235);
+    auto v237 = Add(v188, v144);
+    auto v238 = Add(v145, v190);
+    auto v239 = Add(v237, v238);
+    auto v240 = Add(v236, v239);
+    auto v241 = Add(v196, v148);
+    auto v242 = Add(v149, v198);
+    auto v243 = Add(v241, v242);
+    auto v244_tmp = MulFixedPoint15(v243, Set(d16, 13573));
+    auto v244 = Add(v244_tmp, v243);
+    auto v245 = Add(v204, v152);
+    auto v246 = Add(v153, v206);
+    auto v247 = Add(v245, v246);
+    auto v248 = Add(v247, v243);
+    auto v249 = Add(v244, v248);
+    auto v250 = MulFixedPoint15(v249, Set(d16, 17734));
+    auto v251 = Add(v240, v250);
+    auto v252 = Add(v199, v159);
+    auto v253 = Add(v160, v183);
+    auto v254 = Add(v252, v253);
+    auto v255_tmp = MulFixedPoint15(v254, Set(d16, 13573));
+    auto v255 = Add(v255_tmp, v254);
+    auto v256 = Add(v207, v163);
+    auto v257 = Add(v164, v187);
+    auto v258 = Add(v256, v257);
+    auto v259 = Add(v191, v166);
+    auto v260 = Add(v167, v195);
+    auto v261 = Add(v259, v260);
+    auto v262 = Add(v258, v261);
+    auto v263 = Add(v255, v262);
+    auto v264 = Add(v261, v254);
+    auto v265_tmp = MulFixedPoint15(v264, Set(d16, 13573));
+    auto v265 = Add(v265_tmp, v264);
+    auto v266 = Add(v223, v173);
+    auto v267 = Add(v174, v203);
+    auto v268 = Add(v266, v267);
+    auto v269 = Add(v268, v258);
+    auto v270 = Add(v269, v264);
+    auto v271 = Add(v265, v270);
+    auto v272 = MulFixedPoint15(v271, Set(d16, 17734));
+    auto v273 = Add(v263, v272);
+    auto v274 = MulFixedPoint15(v273, Set(d16, 16705));
+    auto v275 = Add(v251, v274);
+    auto v276 = Add(v253, v235);
+    auto v277_tmp = MulFixedPoint15(v276, Set(d16, 13573));
+    auto v277 = Add(v277_tmp, v276);
+    auto v278 = Add(v257, v237);
+    auto v279 = Add(v238, v259);
+    auto v280 = Add(v278, v279);
+    auto v281 = Add(v277, v280);
+    auto v282 = Add(v260, v241);
+    auto v283 = Add(v242, v252);
+    auto v284 = Add(v282, v283);
+    auto v285_tmp = MulFixedPoint15(v284, Set(d16, 13573));
+    auto v285 = Add(v285_tmp, v284);
+    auto v286 = Add(v267, v245);
+    auto v287 = Add(v246, v256);
+    auto v288 = Add(v286, v287);
+    auto v289 = Add(v288, v284);
+    auto v290 = Add(v285, v289);
+    auto v291 = MulFixedPoint15(v290, Set(d16, 17734));
+    auto v292 = Add(v281, v291);
+    auto v293 = Add(v283, v276);
+    auto v294_tmp = MulFixedPoint15(v293, Set(d16, 13573));
+    auto v294 = Add(v294_tmp, v293);
+    auto v295 = Add(v287, v278);
+    auto v296 = Add(v279, v282);
+    auto v297 = Add(v295, v296);
+    auto v298 = Add(v294, v297);
+    auto v299 = Add(v296, v293);
+    auto v300_tmp = MulFixedPoint15(v299, Set(d16, 13573));
+    auto v300 = Add(v300_tmp, v299);
+    auto v301 = LoadU(d16, in + in_stride * 126 + i);
+    auto v302 = Add(v301, v222);
+    auto v303 = Add(v302, v266);
+    auto v304 = Add(v303, v286);
+    auto v305 = Add(v304, v295);
+    auto v306 = Add(v305, v299);
+    auto v307 = Add(v300, v306);
+    auto v308 = MulFixedPoint15(v307, Set(d16, 17734));
+    auto v309 = Add(v298, v308);
+    auto v310 = MulFixedPoint15(v309, Set(d16, 16705));
+    auto v311 = Add(v292, v310);
+    auto v312 = MulFixedPoint15(v311, Set(d16, 16463));
+    auto v313 = Add(v275, v312);
+    auto v314 = MulFixedPoint15(v313, Set(d16, 16404));
+    auto v315 = Add(v234, v314);
+    auto v316 = MulFixedPoint15(v315, Set(d16, 16389));
+    auto v317 = Add(v141, v316);
+    auto v318 = LoadU(d16, in + in_stride * 1 + i);
+    auto v319_tmp = MulFixedPoint15(v318, Set(d16, 13573));
+    auto v319 = Add(v319_tmp, v318);
+    auto v320 = LoadU(d16, in + in_stride * 65 + i);
+    auto v321 = LoadU(d16, in + in_stride * 63 + i);
+    auto v322 = Add(v320, v321);
+    auto v323 = Add(v319, v322);
+    auto v324 = LoadU(d16, in + in_stride * 33 + i);
+    auto v325 = LoadU(d16, in + in_stride * 31 + i);
+    auto v326 = Add(v324, v325);
+    auto v327_tmp = MulFixedPoint15(v326, Set(d16, 13573));
+    auto v327 = Add(v327_tmp, v326);
+    auto v328 = LoadU(d16, in + in_stride * 97 + i);
+    auto v329 = LoadU(d16, in + in_stride * 95 + i);
+    auto v330 = Add(v328, v329);
+    auto v331 = Add(v330, v326);
+    auto v332 = Add(v327, v331);
+    auto v333 = MulFixedPoint15(v332, Set(d16, 17734));
+    auto v334 = Add(v323, v333);
+    auto v335 = LoadU(d16, in + in_stride * 17 + i);
+    auto v336 = LoadU(d16, in + in_stride * 15 + i);
+    auto v337 = Add(v335, v336);
+    auto v338_tmp = MulFixedPoint15(v337, Set(d16, 13573));
+    auto v338 = Add(v338_tmp, v337);
+    auto v339 = LoadU(d16, in + in_stride * 81 + i);
+    auto v340 = LoadU(d16, in + in_stride * 79 + i);
+    auto v341 = Add(v339, v340);
+    auto v342 = LoadU(d16, in + in_stride * 49 + i);
+    auto v343 = LoadU(d16, in + in_stride * 47 + i);
+    auto v344 = Add(v342, v343);
+    auto v345 = Add(v341, v344);
+    auto v346 = Add(v338, v345);
+    auto v347 = Add(v344, v337);
+    auto v348_tmp = MulFixedPoint15(v347, Set(d16, 13573));
+    auto v348 = Add(v348_tmp, v347);
+    auto v349 = LoadU(d16, in + in_stride * 113 + i);
+    auto v350 = LoadU(d16, in + in_stride * 111 + i);
+    auto v351 = Add(v349, v350);
+    auto v352 = Add(v351, v341);
+    auto v353 = Add(v352, v347);
+    auto v354 = Add(v348, v353);
+    auto v355 = MulFixedPoint15(v354, Set(d16, 17734));
+    auto v356 = Add(v346, v355);
+    auto v357 = MulFixedPoint15(v356, Set(d16, 16705));
+    auto v358 = Add(v334, v357);
+    auto v359 = LoadU(d16, in + in_stride * 9 + i);
+    auto v360 = LoadU(d16, in + in_stride * 7 + i);
+    auto v361 = Add(v359, v360);
+    auto v362_tmp = MulFixedPoint15(v361, Set(d16, 13573));
+    auto v362 = Add(v362_tmp, v361);
+    auto v363 = LoadU(d16, in + in_stride * 73 + i);
+    auto v364 = LoadU(d16, in + in_stride * 71 + i);
+    auto v365 = Add(v363, v364);
+    auto v366 = LoadU(d16, in + in_stride * 57 + i);
+    auto v367 = LoadU(d16, in + in_stride * 55 + i);
+    auto v368 = Add(v366, v367);
+    auto v369 = Add(v365, v368);
+    auto v370 = Add(v362, v369);
+    auto v371 = LoadU(d16, in + in_stride * 41 + i);
+    auto v372 = LoadU(d16, in + in_stride * 39 + i);
+    auto v373 = Add(v371, v372);
+    auto v374 = LoadU(d16, in + in_stride * 25 + i);
+    auto v375 = LoadU(d16, in + in_stride * 23 + i);
+    auto v376 = Add(v374, v375);
+    auto v377 = Add(v373, v376);
+    auto v378_tmp = MulFixedPoint15(v377, Set(d16, 13573));
+    auto v378 = Add(v378_tmp, v377);
+    auto v379 = LoadU(d16, in + in_stride * 105 + i);
+    auto v380 = LoadU(d16, in + in_stride * 103 + i);
+    auto v381 = Add(v379, v380);
+    auto v382 = LoadU(d16, in + in_stride * 89 + i);
+    auto v383 = LoadU(d16, in + in_stride * 87 + i);
+    auto v384 = Add(v382, v383);
+    auto v385 = Add(v381, v384);
+    auto v386 = Add(v385, v377);
+    auto v387 = Add(v378, v386);
+    auto v388 = MulFixedPoint15(v387, Set(d16, 17734));
+    auto v389 = Add(v370, v388);
+    auto v390 = Add(v376, v361);
+    auto v391_tmp = MulFixedPoint15(v390, Set(d16, 13573));
+    auto v391 = Add(v391_tmp, v390);
+    auto v392 = Add(v384, v365);
+    auto v393 = Add(v368, v373);
+    auto v394 = Add(v392, v393);
+    auto v395 = Add(v391, v394);
+    auto v396 = Add(v393, v390);
+    auto v397_tmp = MulFixedPoint15(v396, Set(d16, 13573));
+    auto v397 = Add(v397_tmp, v396);
+    auto v398 = LoadU(d16, in + in_stride * 121 + i);
+    auto v399 = LoadU(d16, in + in_stride * 119 + i);
+    auto v400 = Add(v398, v399);
+    auto v401 = Add(v400, v381);
+    auto v402 = Add(v401, v392);
+    auto v403 = Add(v402, v396);
+    auto v404 = Add(v397, v403);
+    auto v405 = MulFixedPoint15(v404, Set(d16, 17734));
+    auto v406 = Add(v395, v405);
+    auto v407 = MulFixedPoint15(v406, Set(d16, 16705));
+    auto v408 = Add(v389, v407);
+    auto v409 = MulFixedPoint15(v408, Set(d16, 16463));
+    auto v410 = Add(v358, v409);
+    auto v411 = LoadU(d16, in + in_stride * 5 + i);
+    auto v412 = LoadU(d16, in + in_stride * 3 + i);
+    auto v413 = Add(v411, v412);
+    auto v414_tmp = MulFixedPoint15(v413, Set(d16, 13573));
+    auto v414 = Add(v414_tmp, v413);
+    auto v415 = LoadU(d16, in + in_stride * 69 + i);
+    auto v416 = LoadU(d16, in + in_stride * 67 + i);
+    auto v417 = Add(v415, v416);
+    auto v418 = LoadU(d16, in + in_stride * 61 + i);
+    auto v419 = LoadU(d16, in + in_stride * 59 + i);
+    auto v420 = Add(v418, v419);
+    auto v421 = Add(v417, v420);
+    auto v422 = Add(v414, v421);
+    auto v423 = LoadU(d16, in + in_stride * 37 + i);
+    auto v424 = LoadU(d16, in + in_stride * 35 + i);
+    auto v425 = Add(v423, v424);
+    auto v426 = LoadU(d16, in + in_stride * 29 + i);
+    auto v427 = LoadU(d16, in + in_stride * 27 + i);
+    auto v428 = Add(v426, v427);
+    auto v429 = Add(v425, v428);
+    auto v430_tmp = MulFixedPoint15(v429, Set(d16, 13573));
+    auto v430 = Add(v430_tmp, v429);
+    auto v431 = LoadU(d16, in + in_stride * 101 + i);
+    auto v432 = LoadU(d16, in + in_stride * 99 + i);
+    auto v433 = Add(v431, v432);
+    auto v434 = LoadU(d16, in + in_stride * 93 + i);
+    auto v435 = LoadU(d16, in + in_stride * 91 + i);
+    auto v436 = Add(v434, v435);
+    auto v437 = Add(v433, v436);
+    auto v438 = Add(v437, v429);
+    auto v439 = Add(v430, v438);
+    auto v440 = MulFixedPoint15(v439, Set(d16, 17734));
+    auto v441 = Add(v422, v440);
+    auto v442 = LoadU(d16, in + in_stride * 21 + i);
+    auto v443 = LoadU(d16, in + in_stride * 19 + i);
+    auto v444 = Add(v442, v443);
+    auto v445 = LoadU(d16, in + in_stride * 13 + i);
+    auto v446 = LoadU(d16, in + in_stride * 11 + i);
+    auto v447 = Add(v445, v446);
+    auto v448 = Add(v444, v447);
+    auto v449_tmp = MulFixedPoint15(v448, Set(d16, 13573));
+    auto v449 = Add(v449_tmp, v448);
+    auto v450 = LoadU(d16, in + in_stride * 85 + i);
+    auto v451 = LoadU(d16, in + in_stride * 83 + i);
+    auto v452 = Add(v450, v451);
+    auto v453 = LoadU(d16, in + in_stride * 77 + i);
+    auto v454 = LoadU(d16, in + in_stride * 75 + i);
+    auto v455 = Add(v453, v454);
+    auto v456 = Add(v452, v455);
+    auto v457 = LoadU(d16, in + in_stride * 53 + i);
+    auto v458 = LoadU(d16, in + in_stride * 51 + i);
+    auto v459 = Add(v457, v458);
+    auto v460 = LoadU(d16, in + in_stride * 45 + i);
+    auto v461 = LoadU(d16, in + in_stride * 43 + i);
+    auto v462 = Add(v460, v461);
+    auto v463 = Add(v459, v462);
+    auto v464 = Add(v456, v463);
+    auto v465 = Add(v449, v464);
+    auto v466 = Add(v463, v448);
+    auto v467_tmp = MulFixedPoint15(v466, Set(d16, 13573));
+    auto v467 = Add(v467_tmp, v466);
+    auto v468 = LoadU(d16, in + in_stride * 117 + i);
+    auto v469 = LoadU(d16, in + in_stride * 115 + i);
+    auto v470 = Add(v468, v469);
+    auto v471 = LoadU(d16, in + in_stride * 109 + i);
+    auto v472 = LoadU(d16, in + in_stride * 107 + i);
+    auto v473 = Add(v471, v472);
+    auto v474 = Add(v470, v473);
+    auto v475 = Add(v474, v456);
+    auto v476 = Add(v475, v466);
+    auto v477 = Add(v467, v476);
+    auto v478 = MulFixedPoint15(v477, Set(d16, 17734));
+    auto v479 = Add(v465, v478);
+    auto v480 = MulFixedPoint15(v479, Set(d16, 16705));
+    auto v481 = Add(v441, v480);
+    auto v482 = Add(v447, v413);
+    auto v483_tmp = MulFixedPoint15(v482, Set(d16, 13573));
+    auto v483 = Add(v483_tmp, v482);
+    auto v484 = Add(v455, v417);
+    auto v485 = Add(v420, v459);
+    auto v486 = Add(v484, v485);
+    auto v487 = Add(v483, v486);
+    auto v488 = Add(v462, v425);
+    auto v489 = Add(v428, v444);
+    auto v490 = Add(v488, v489);
+    auto v491_tmp = MulFixedPoint15(v490, Set(d16, 13573));
+    auto v491 = Add(v491_tmp, v490);
+    auto v492 = Add(v473, v433);
+    auto v493 = Add(v436, v452);
+    auto v494 = Add(v492, v493);
+    auto v495 = Add(v494, v490);
+    auto v496 = Add(v491, v495);
+    auto v497 = MulFixedPoint15(v496, Set(d16, 17734));
+    auto v498 = Add(v487, v497);
+    auto v499 = Add(v489, v482);
+    auto v500_tmp = MulFixedPoint15(v499, Set(d16, 13573));
+    auto v500 = Add(v500_tmp, v499);
+    auto v501 = Add(v493, v484);
+    auto v502 = Add(v485, v488);
+    auto v503 = Add(v501, v502);
+    auto v504 = Add(v500, v503);
+    auto v505 = Add(v502, v499);
+    auto v506_tmp = MulFixedPoint15(v505, Set(d16, 13573));
+    auto v506 = Add(v506_tmp, v505);
+    auto v507 = LoadU(d16, in + in_stride * 125 + i);
+    auto v508 = LoadU(d16, in + in_stride * 123 + i);
+    auto v509 = Add(v507, v508);
+    auto v510 = Add(v509, v470);
+    auto v511 = Add(v510, v492);
+    auto v512 = Add(v511, v501);
+    auto v513 = Add(v512, v505);
+    auto v514 = Add(v506, v513);
+    auto v515 = MulFixedPoint15(v514, Set(d16, 17734));
+    auto v516 = Add(v504, v515);
+    auto v517 = MulFixedPoint15(v516, Set(d16, 16705));
+    auto v518 = Add(v498, v517);
+    auto v519 = MulFixedPoint15(v518, Set(d16, 16463));
+    auto v520 = Add(v481, v519);
+    auto v521 = MulFixedPoint15(v520, Set(d16, 16404));
+    auto v522 = Add(v410, v521);
+    auto v523 = Add(v412, v318);
+    auto v524_tmp = MulFixedPoint15(v523, Set(d16, 13573));
+    auto v524 = Add(v524_tmp, v523);
+    auto v525 = Add(v416, v320);
+    auto v526 = Add(v321, v418);
+    auto v527 = Add(v525, v526);
+    auto v528 = Add(v524, v527);
+    auto v529 = Add(v424, v324);
+    auto v530 = Add(v325, v426);
+    auto v531 = Add(v529, v530);
+    auto v532_tmp = MulFixedPoint15(v531, Set(d16, 13573));
+    auto v532 = Add(v532_tmp, v531);
+    auto v533 = Add(v432, v328);
+    auto v534 = Add(v329, v434);
+    auto v535 = Add(v533, v534);
+    auto v536 = Add(v535, v531);
+    auto v537 = Add(v532, v536);
+    auto v538 = MulFixedPoint15(v537, Set(d16, 17734));
+    auto v539 = Add(v528, v538);
+    auto v540 = Add(v443, v335);
+    auto v541 = Add(v336, v445);
+    auto v542 = Add(v540, v541);
+    auto v543_tmp = MulFixedPoint15(v542, Set(d16, 13573));
+    auto v543 = Add(v543_tmp, v542);
+    auto v544 = Add(v451, v339);
+    auto v545 = Add(v340, v453);
+    auto v546 = Add(v544, v545);
+    auto v547 = Add(v458, v342);
+    auto v548 = Add(v343, v460);
+    auto v549 = Add(v547, v548);
+    auto v550 = Add(v546, v549);
+    auto v551 = Add(v543, v550);
+    auto v552 = Add(v549, v542);
+    auto v553_tmp = MulFixedPoint15(v552, Set(d16, 13573));
+    auto v553 = Add(v553_tmp, v552);
+    auto v554 = Add(v469, v349);
+    auto v555 = Add(v350, v471);
+    auto v556 = Add(v554, v555);
+    auto v557 = Add(v556, v546);
+    auto v558 = Add(v557, v552);
+    auto v559 = Add(v553, v558);
+    auto v560 = MulFixedPoint15(v559, Set(d16, 17734));
+    auto v561 = Add(v551, v560);
+    auto v562 = MulFixedPoint15(v561, Set(d16, 16705));
+    auto v563 = Add(v539, v562);
+    auto v564 = Add(v446, v359);
+    auto v565 = Add(v360, v411);
+    auto v566 = Add(v564, v565);
+    auto v567_tmp = MulFixedPoint15(v566, Set(d16, 13573));
+    auto v567 = Add(v567_tmp, v566);
+    auto v568 = Add(v454, v363);
+    auto v569 = Add(v364, v415);
+    auto v570 = Add(v568, v569);
+    auto v571 = Add(v419, v366);
+    auto v572 = Add(v367, v457);
+    auto v573 = Add(v571, v572);
+    auto v574 = Add(v570, v573);
+    auto v575 = Add(v567, v574);
+    auto v576 = Add(v461, v371);
+    auto v577 = Add(v372, v423);
+    auto v578 = Add(v576, v577);
+    auto v579 = Add(v427, v374);
+    auto v580 = Add(v375, v442);
+    auto v581 = Add(v579, v580);
+    auto v582 = Add(v578, v581);
+    auto v583_tmp = MulFixedPoint15(v582, Set(d16, 13573));
+    auto v583 = Add(v583_tmp, v582);
+    auto v584 = Add(v472, v379);
+    auto v585 = Add(v380, v431);
+    auto v586 = Add(v584, v585);
+    auto v587 = Add(v435, v382);
+    auto v588 = Add(v383, v450);
+    auto v589 = Add(v587, v588);
+    auto v590 = Add(v586, v589);
+    auto v591 = Add(v590, v582);
+    auto v592 = Add(v583, v591);
+    auto v593 = MulFixedPoint15(v592, Set(d16, 17734));
+    auto v594 = Add(v575, v593);
+    auto v595 = Add(v581, v566);
+    auto v596_tmp = MulFixedPoint15(v595, Set(d16, 13573));
+    auto v596 = Add(v596_tmp, v595);
+    auto v597 = Add(v589, v570);
+    auto v598 = Add(v573, v578);
+    auto v599 = Add(v597, v598);
+    auto v600 = Add(v596, v599);
+    auto v601 = Add(v598, v595);
+    auto v602_tmp = MulFixedPoint15(v601, Set(d16, 13573));
+    auto v602 = Add(v602_tmp, v601);
+    auto v603 = Add(v508, v398);
+    auto v604 = Add(v399, v468);
+    auto v605 = Add(v603, v604);
+    auto v606 = Add(v605, v586);
+    auto v607 = Add(v606, v597);
+    auto v608 = Add(v607, v601);
+    auto v609 = Add(v602, v608);
+    auto v610 = MulFixedPoint15(v609, Set(d16, 17734));
+    auto v611 = Add(v600, v610);
+    auto v612 = MulFixedPoint15(v611, Set(d16, 16705));
+    auto v613 = Add(v594, v612);
+    auto v614 = MulFixedPoint15(v613, Set(d16, 16463));
+    auto v615 = Add(v563, v614);
+    auto v616 = Add(v565, v523);
+    auto v617_tmp = MulFixedPoint15(v616, Set(d16, 13573));
+    auto v617 = Add(v617_tmp, v616);
+    auto v618 = Add(v569, v525);
+    auto v619 = Add(v526, v571);
+    auto v620 = Add(v618, v619);
+    auto v621 = Add(v617, v620);
+    auto v622 = Add(v577, v529);
+    auto v623 = Add(v530, v579);
+    auto v624 = Add(v622, v623);
+    auto v625_tmp = MulFixedPoint15(v624, Set(d16, 13573));
+    auto v625 = Add(v625_tmp, v624);
+    auto v626 = Add(v585, v533);
+    auto v627 = Add(v534, v587);
+    auto v628 = Add(v626, v627);
+    auto v629 = Add(v628, v624);
+    auto v630 = Add(v625, v629);
+    auto v631 = MulFixedPoint15(v630, Set(d16, 17734));
+    auto v632 = Add(v621, v631);
+    auto v633 = Add(v580, v540);
+    auto v634 = Add(v541, v564);
+    auto v635 = Add(v633, v634);
+    auto v636_tmp = MulFixedPoint15(v635, Set(d16, 13573));
+    auto v636 = Add(v636_tmp, v635);
+    auto v637 = Add(v588, v544);
+    auto v638 = Add(v545, v568);
+    auto v639 = Add(v637, v638);
+    auto v640 = Add(v572, v547);
+    auto v641 = Add(v548, v576);
+    auto v642 = Add(v640, v641);
+    auto v643 = Add(v639, v642);
+    auto v644 = Add(v636, v643);
+    auto v645 = Add(v642, v635);
+    auto v646_tmp = MulFixedPoint15(v645, Set(d16, 13573));
+    auto v646 = Add(v646_tmp, v645);
+    auto v647 = Add(v604, v554);
+    auto v648 = Add(v555, v584);
+    auto v649 = Add(v647, v648);
+    auto v650 = Add(v649, v639);
+    auto v651 = Add(v650, v645);
+    auto v652 = Add(v646, v651);
+    auto v653 = MulFixedPoint15(v652, Set(d16, 17734));
+    auto v654 = Add(v644, v653);
+    auto v655 = MulFixedPoint15(v654, Set(d16, 16705));
+    auto v656 = Add(v632, v655);
+    auto v657 = Add(v634, v616);
+    auto v658_tmp = MulFixedPoint15(v657, Set(d16, 13573));
+    auto v658 = Add(v658_tmp, v657);
+    auto v659 = Add(v638, v618);
+    auto v660 = Add(v619, v640);
+    auto v661 = Add(v659, v660);
+    auto v662 = Add(v658, v661);
+    auto v663 = Add(v641, v622);
+    auto v664 = Add(v623, v633);
+    auto v665 = Add(v663, v664);
+    auto v666_tmp = MulFixedPoint15(v665, Set(d16, 13573));
+    auto v666 = Add(v666_tmp, v665);
+    auto v667 = Add(v648, v626);
+    auto v668 = Add(v627, v637);
+    auto v669 = Add(v667, v668);
+    auto v670 = Add(v669, v665);
+    auto v671 = Add(v666, v670);
+    auto v672 = MulFixedPoint15(v671, Set(d16, 17734));
+    auto v673 = Add(v662, v672);
+    auto v674 = Add(v664, v657);
+    auto v675_tmp = MulFixedPoint15(v674, Set(d16, 13573));
+    auto v675 = Add(v675_tmp, v674);
+    auto v676 = Add(v668, v659);
+    auto v677 = Add(v660, v663);
+    auto v678 = Add(v676, v677);
+    auto v679 = Add(v675, v678);
+    auto v680 = Add(v677, v674);
+    auto v681_tmp = MulFixedPoint15(v680, Set(d16, 13573));
+    auto v681 = Add(v681_tmp, v680);
+    auto v682 = LoadU(d16, in + in_stride * 127 + i);
+    auto v683 = Add(v682, v507);
+    auto v684 = Add(v683, v603);
+    auto v685 = Add(v684, v647);
+    auto v686 = Add(v685, v667);
+    auto v687 = Add(v686, v676);
+    auto v688 = Add(v687, v680);
+    auto v689 = Add(v681, v688);
+    auto v690 = MulFixedPoint15(v689, Set(d16, 17734));
+    auto v691 = Add(v679, v690);
+    auto v692 = MulFixedPoint15(v691, Set(d16, 16705));
+    auto v693 = Add(v673, v692);
+    auto v694 = MulFixedPoint15(v693, Set(d16, 16463));
+    auto v695 = Add(v656, v694);
+    auto v696 = MulFixedPoint15(v695, Set(d16, 16404));
+    auto v697 = Add(v615, v696);
+    auto v698 = MulFixedPoint15(v697, Set(d16, 16389));
+    auto v699 = Add(v522, v698);
+    auto v700 = MulFixedPoint15(v699, Set(d16, 16385));
+    auto v701 = Add(v317, v700);
+    auto v702 = Sub(v0, v1);
+    auto v703 = Sub(v4, v6);
+    auto v704_tmp = MulFixedPoint15(v703, Set(d16, 10045));
+    auto v704 = Add(v704_tmp, v703);
+    auto v705 = Add(v702, v704);
+    auto v706 = Sub(v11, v14);
+    auto v707 = Sub(v17, v20);
+    auto v708_tmp = MulFixedPoint15(v707, Set(d16, 10045));
+    auto v708 = Add(v708_tmp, v707);
+    auto v709 = Add(v706, v708);
+    auto v710 = MulFixedPoint15(v709, Set(d16, 19705));
+    auto v711 = Add(v705, v710);
+    auto v712 = Sub(v27, v30);
+    auto v713 = Sub(v35, v39);
+    auto v714_tmp = MulFixedPoint15(v713, Set(d16, 10045));
+    auto v714 = Add(v714_tmp, v713);
+    auto v715 = Add(v712, v714);
+    auto v716 = Sub(v44, v47);
+    auto v717 = Sub(v50, v54);
+    auto v718_tmp = MulFixedPoint15(v717, Set(d16, 10045));
+    auto v718 = Add(v718_tmp, v717);
+    auto v719 = Add(v716, v718);
+    auto v720 = MulFixedPoint15(v719, Set(d16, 19705));
+    auto v721 = Add(v715, v720);
+    auto v722 = MulFixedPoint15(v721, Set(d16, 17121));
+    auto v723 = Add(v711, v722);
+    auto v724 = Sub(v63, v66);
+    auto v725 = Sub(v71, v75);
+    auto v726_tmp = MulFixedPoint15(v725, Set(d16, 10045));
+    auto v726 = Add(v726_tmp, v725);
+    auto v727 = Add(v724, v726);
+    auto v728 = Sub(v82, v89);
+    auto v729 = Sub(v92, v97);
+    auto v730_tmp = MulFixedPoint15(v729, Set(d16, 10045));
+    auto v730 = Add(v730_tmp, v729);
+    auto v731 = Add(v728, v730);
+    auto v732 = MulFixedPoint15(v731, Set(d16, 19705));
+    auto v733 = Add(v727, v732);
+    auto v734 = Sub(v104, v107);
+    auto v735 = Sub(v112, v116);
+    auto v736_tmp = MulFixedPoint15(v735, Set(d16, 10045));
+    auto v736 = Add(v736_tmp, v735);
+    auto v737 = Add(v734, v736);
+    auto v738 = Sub(v121, v124);
+    auto v739 = Sub(v127, v132);
+    auto v740_tmp = MulFixedPoint15(v739, Set(d16, 10045));
+    auto v740 = Add(v740_tmp, v739);
+    auto v741 = Add(v738, v740);
+    auto v742 = MulFixedPoint15(v741, Set(d16, 19705));
+    auto v743 = Add(v737, v742);
+    auto v744 = MulFixedPoint15(v743, Set(d16, 17121));
+    auto v745 = Add(v733, v744);
+    auto v746 = MulFixedPoint15(v745, Set(d16, 16563));
+    auto v747 = Add(v723, v746);
+    auto v748 = Sub(v143, v146);
+    auto v749 = Sub(v151, v155);
+    auto v750_tmp = MulFixedPoint15(v749, Set(d16, 10045));
+    auto v750 = Add(v750_tmp, v749);
+    auto v751 = Add(v748, v750);
+    auto v752 = Sub(v162, v169);
+    auto v753 = MulFixedPoint15(v752, Set(d16, 19705));
+    auto v754 = Sub(v172, v177);
+    auto v755 = MulFixedPoint15(v754, Set(d16, 25746));
+    auto v756 = Add(v753, v755);
+    auto v757 = Add(v751, v756);
+    auto v758 = Sub(v186, v193);
+    auto v759 = Sub(v202, v210);
+    auto v760_tmp = MulFixedPoint15(v759, Set(d16, 10045));
+    auto v760 = Add(v760_tmp, v759);
+    auto v761 = Add(v758, v760);
+    auto v762 = Sub(v215, v218);
+    auto v763 = Sub(v221, v227);
+    auto v764_tmp = MulFixedPoint15(v763, Set(d16, 10045));
+    auto v764 = Add(v764_tmp, v763);
+    auto v765 = Add(v762, v764);
+    auto v766 = MulFixedPoint15(v765, Set(d16, 19705));
+    auto v767 = Add(v761, v766);
+    auto v768 = MulFixedPoint15(v767, Set(d16, 17121));
+    auto v769 = Add(v757, v768);
+    auto v770 = Sub(v236, v239);
+    auto v771 = Sub(v244, v248);
+    auto v772_tmp = MulFixedPoint15(v771, Set(d16, 10045));
+    auto v772 = Add(v772_tmp, v771);
+    auto v773 = Add(v770, v772);
+    auto v774 = Sub(v255, v262);
+    auto v775 = Sub(v265, v270);
+    auto v776_tmp = MulFixedPoint15(v775, Set(d16, 10045));
+    auto v776 = Add(v776_tmp, v775);
+    auto v777 = Add(v774, v776);
+    auto v778 = MulFixedPoint15(v777, Set(d16, 19705));
+    auto v779 = Add(v773, v778);
+    auto v780 = Sub(v277, v280);
+    auto v781 = Sub(v285, v289);
+    auto v782_tmp = MulFixedPoint15(v781, Set(d16, 10045));
+    auto v782 = Add(v782_tmp, v781);
+    auto v783 = Add(v780, v782);
+    auto v784 = Sub(v294, v297);
+    auto v785 = Sub(v300, v306);
+    auto v786_tmp = MulFixedPoint15(v785, Set(d16, 10045));
+    auto v786 = Add(v786_tmp, v785);
+    auto v787 = Add(v784, v786);
+    auto v788 = MulFixedPoint15(v787, Set(d16, 19705));
+    auto v789 = Add(v783, v788);
+    auto v790 = MulFixedPoint15(v789, Set(d16, 17121));
+    auto v791 = Add(v779, v790);
+    auto v792 = MulFixedPoint15(v791, Set(d16, 16563));
+    auto v793 = Add(v769, v792);
+    auto v794 = MulFixedPoint15(v793, Set(d16, 16429));
+    auto v795 = Add(v747, v794);
+    auto v796 = Sub(v319, v322);
+    auto v797 = Sub(v327, v331);
+    auto v798_tmp = MulFixedPoint15(v797, Set(d16, 10045));
+    auto v798 = Add(v798_tmp, v797);
+    auto v799 = Add(v796, v798);
+    auto v800 = Sub(v338, v345);
+    auto v801 = Sub(v348, v353);
+    auto v802_tmp = MulFixedPoint15(v801, Set(d16, 10045));
+    auto v802 = Add(v802_tmp, v801);
+    auto v803 = Add(v800, v802);
+    auto v804 = MulFixedPoint15(v803, Set(d16, 19705));
+    auto v805 = Add(v799, v804);
+    auto v806 = Sub(v362, v369);
+    auto v807 = Sub(v378, v386);
+    auto v808_tmp = MulFixedPoint15(v807, Set(d16, 10045));
+    auto v808 = Add(v808_tmp, v807);
+    auto v809 = Add(v806, v808);
+    auto v810 = Sub(v391, v394);
+    auto v811 = Sub(v397, v403);
+    auto v812_tmp = MulFixedPoint15(v811, Set(d16, 10045));
+    auto v812 = Add(v812_tmp, v811);
+    auto v813 = Add(v810, v812);
+    auto v814 = MulFixedPoint15(v813, Set(d16, 19705));
+    auto v815 = Add(v809, v814);
+    auto v816 = MulFixedPoint15(v815, Set(d16, 17121));
+    auto v817 = Add(v805, v816);
+    auto v818 = Sub(v414, v421);
+    auto v819 = Sub(v430, v438);
+    auto v820_tmp = MulFixedPoint15(v819, Set(d16, 10045));
+    auto v820 = Add(v820_tmp, v819);
+    auto v821 = Add(v818, v820);
+    auto v822 = Sub(v449, v464);
+    auto v823 = Sub(v467, v476);
+    auto v824_tmp = MulFixedPoint15(v823, Set(d16, 10045));
+    auto v824 = Add(v824_tmp, v823);
+    auto v825 = Add(v822, v824);
+    auto v826 = MulFixedPoint15(v825, Set(d16, 19705));
+    auto v827 = Add(v821, v826);
+    auto v828 = Sub(v483, v486);
+    auto v829 = Sub(v491, v495);
+    auto v830_tmp = MulFixedPoint15(v829, Set(d16, 10045));
+    auto v830 = Add(v830_tmp, v829);
+    auto v831 = Add(v828, v830);
+    auto v832 = Sub(v500, v503);
+    auto v833 = Sub(v506, v513);
+    auto v834_tmp = MulFixedPoint15(v833, Set(d16, 10045));
+    auto v834 = Add(v834_tmp, v833);
+    auto v835 = Add(v832, v834);
+    auto v836 = MulFixedPoint15(v835, Set(d16, 19705));
+    auto v837 = Add(v831, v836);
+    auto v838 = MulFixedPoint15(v837, Set(d16, 17121));
+    auto v839 = Add(v827, v838);
+    auto v840 = MulFixedPoint15(v839, Set(d16, 16563));
+    auto v841 = Add(v817, v840);
+    auto v842 = Sub(v524, v527);
+    auto v843 = Sub(v532, v536);
+    auto v844_tmp = MulFixedPoint15(v843, Set(d16, 10045));
+    auto v844 = Add(v844_tmp, v843);
+    auto v845 = Add(v842, v844);
+    auto v846 = Sub(v543, v550);
+    auto v847 = Sub(v553, v558);
+    auto v848_tmp = MulFixedPoint15(v847, Set(d16, 10045));
+    auto v848 = Add(v848_tmp, v847);
+    auto v849 = Add(v846, v848);
+    auto v850 = MulFixedPoint15(v849, Set(d16, 19705));
+    auto v851 = Add(v845, v850);
+    auto v852 = Sub(v567, v574);
+    auto v853 = Sub(v583, v591);
+    auto v854_tmp = MulFixedPoint15(v853, Set(d16, 10045));
+    auto v854 = Add(v854_tmp, v853);
+    auto v855 = Add(v852, v854);
+    auto v856 = Sub(v596, v599);
+    auto v857 = Sub(v602, v608);
+    auto v858_tmp = MulFixedPoint15(v857, Set(d16, 10045));
+    auto v858 = Add(v858_tmp, v857);
+    auto v859 = Add(v856, v858);
+    auto v860 = MulFixedPoint15(v859, Set(d16, 19705));
+    auto v861 = Add(v855, v860);
+    auto v862 = MulFixedPoint15(v861, Set(d16, 17121));
+    auto v863 = Add(v851, v862);
+    auto v864 = Sub(v617, v620);
+    auto v865 = Sub(v625, v629);
+    auto v866_tmp = MulFixedPoint15(v865, Set(d16, 10045));
+    auto v866 = Add(v866_tmp, v865);
+    auto v867 = Add(v864, v866);
+    auto v868 = Sub(v636, v643);
+    auto v869 = Sub(v646, v651);
+    auto v870_tmp = MulFixedPoint15(v869, Set(d16, 10045));
+    auto v870 = Add(v870_tmp, v869);
+    auto v871 = Add(v868, v870);
+    auto v872 = MulFixedPoint15(v871, Set(d16, 19705));
+    auto v873 = Add(v867, v872);
+    auto v874 = Sub(v658, v661);
+    auto v875 = Sub(v666, v670);
+    auto v876_tmp = MulFixedPoint15(v875, Set(d16, 10045));
+    auto v876 = Add(v876_tmp, v875);
+    auto v877 = Add(v874, v876);
+    auto v878 = Sub(v675, v678);
+    auto v879 = Sub(v681, v688);
+    auto v880_tmp = MulFixedPoint15(v879, Set(d16, 10045));
+    auto v880 = Add(v880_tmp, v879);
+    auto v881 = Add(v878, v880);
+    auto v882 = MulFixedPoint15(v881, Set(d16, 19705));
+    auto v883 = Add(v877, v882);
+    auto v884 = MulFixedPoint15(v883, Set(d16, 17121));
+    auto v885 = Add(v873, v884);
+    auto v886 = MulFixedPoint15(v885, Set(d16, 16563));
+    auto v887 = Add(v863, v886);
+    auto v888 = MulFixedPoint15(v887, Set(d16, 16429));
+    auto v889 = Add(v841, v888);
+    auto v890 = MulFixedPoint15(v889, Set(d16, 16395));
+    auto v891 = Add(v795, v890);
+    auto v892 = Sub(v702, v704);
+    auto v893 = Sub(v706, v708);
+    auto v894 = MulFixedPoint15(v893, Set(d16, 29490));
+    auto v895 = Add(v892, v894);
+    auto v896 = Sub(v712, v714);
+    auto v897 = Sub(v716, v718);
+    auto v898 = MulFixedPoint15(v897, Set(d16, 29490));
+    auto v899 = Add(v896, v898);
+    auto v900 = MulFixedPoint15(v899, Set(d16, 18578));
+    auto v901 = Add(v895, v900);
+    auto v902 = Sub(v724, v726);
+    auto v903 = Sub(v728, v730);
+    auto v904 = MulFixedPoint15(v903, Set(d16, 29490));
+    auto v905 = Add(v902, v904);
+    auto v906 = Sub(v734, v736);
+    auto v907 = Sub(v738, v740);
+    auto v908 = MulFixedPoint15(v907, Set(d16, 29490));
+    auto v909 = Add(v906, v908);
+    auto v910 = MulFixedPoint15(v909, Set(d16, 18578));
+    auto v911 = Add(v905, v910);
+    auto v912 = MulFixedPoint15(v911, Set(d16, 16890));
+    auto v913 = Add(v901, v912);
+    auto v914 = Sub(v748, v750);
+    auto v915_tmp = MulFixedPoint15(v754, Set(d16, 10045));
+    auto v915 = Add(v915_tmp, v754);
+    auto v916 = Sub(v752, v915);
+    auto v917 = MulFixedPoint15(v916, Set(d16, 29490));
+    auto v918 = Add(v914, v917);
+    auto v919 = Sub(v758, v760);
+    auto v920 = Sub(v762, v764);
+    auto v921 = MulFixedPoint15(v920, Set(d16, 29490));
+    auto v922 = Add(v919, v921);
+    auto v923 = MulFixedPoint15(v922, Set(d16, 18578));
+    auto v924 = Add(v918, v923);
+    auto v925 = Sub(v770, v772);
+    auto v926 = Sub(v774, v776);
+    auto v927 = MulFixedPoint15(v926, Set(d16, 29490));
+    auto v928 = Add(v925, v927);
+    auto v929 = Sub(v780, v782);
+    auto v930 = Sub(v784, v786);
+    auto v931 = MulFixedPoint15(v930, Set(d16, 29490));
+    auto v932 = Add(v929, v931);
+    auto v933 = MulFixedPoint15(v932, Set(d16, 18578));
+    auto v934 = Add(v928, v933);
+    auto v935 = MulFixedPoint15(v934, Set(d16, 16890));
+    auto v936 = Add(v924, v935);
+    auto v937 = MulFixedPoint15(v936, Set(d16, 16508));
+    auto v938 = Add(v913, v937);
+    auto v939 = Sub(v796, v798);
+    auto v940 = Sub(v800, v802);
+    auto v941 = MulFixedPoint15(v940, Set(d16, 29490));
+    auto v942 = Add(v939, v941);
+    auto v943 = Sub(v806, v808);
+    auto v944 = Sub(v810, v812);
+    auto v945 = MulFixedPoint15(v944, Set(d16, 29490));
+    auto v946 = Add(v943, v945);
+    auto v947 = MulFixedPoint15(v946, Set(d16, 18578));
+    auto v948 = Add(v942, v947);
+    auto v949 = Sub(v818, v820);
+    auto v950 = Sub(v822, v824);
+    auto v951 = MulFixedPoint15(v950, Set(d16, 29490));
+    auto v952 = Add(v949, v951);
+    auto v953 = Sub(v828, v830);
+    auto v954 = Sub(v832, v834);
+    auto v955 = MulFixedPoint15(v954, Set(d16, 29490));
+    auto v956 = Add(v953, v955);
+    auto v957 = MulFixedPoint15(v956, Set(d16, 18578));
+    auto v958 = Add(v952, v957);
+    auto v959 = MulFixedPoint15(v958, Set(d16, 16890));
+    auto v960 = Add(v948, v959);
+    auto v961 = Sub(v842, v844);
+    auto v962 = Sub(v846, v848);
+    auto v963 = MulFixedPoint15(v962, Set(d16, 29490));
+    auto v964 = Add(v961, v963);
+    auto v965 = Sub(v852, v854);
+    auto v966 = Sub(v856, v858);
+    auto v967 = MulFixedPoint15(v966, Set(d16, 29490));
+    auto v968 = Add(v965, v967);
+    auto v969 = MulFixedPoint15(v968, Set(d16, 18578));
+    auto v970 = Add(v964, v969);
+    auto v971 = Sub(v864, v866);
+    auto v972 = Sub(v868, v870);
+    auto v973 = MulFixedPoint15(v972, Set(d16, 29490));
+    auto v974 = Add(v971, v973);
+    auto v975 = Sub(v874, v876);
+    auto v976 = Sub(v878, v880);
+    auto v977 = MulFixedPoint15(v976, Set(d16, 29490));
+    auto v978 = Add(v975, v977);
+    auto v979 = MulFixedPoint15(v978, Set(d16, 18578));
+    auto v980 = Add(v974, v979);
+    auto v981 = MulFixedPoint15(v980, Set(d16, 16890));
+    auto v982 = Add(v970, v981);
+    auto v983 = MulFixedPoint15(v982, Set(d16, 16508));
+    auto v984 = Add(v960, v983);
+    auto v985 = MulFixedPoint15(v984, Set(d16, 16415));
+    auto v986 = Add(v938, v985);
+    auto v987 = Sub(v2, v8);
+    auto v988 = Sub(v15, v22);
+    auto v989_tmp = MulFixedPoint15(v988, Set(d16, 18446));
+    auto v989 = Add(v989_tmp, Mul(v988, Set(d16, 2)));
+    auto v990 = Add(v987, v989);
+    auto v991 = Sub(v31, v41);
+    auto v992 = Sub(v48, v56);
+    auto v993_tmp = MulFixedPoint15(v992, Set(d16, 18446));
+    auto v993 = Add(v993_tmp, Mul(v992, Set(d16, 2)));
+    auto v994 = Add(v991, v993);
+    auto v995 = MulFixedPoint15(v994, Set(d16, 21195));
+    auto v996 = Add(v990, v995);
+    auto v997 = Sub(v67, v77);
+    auto v998 = Sub(v90, v99);
+    auto v999_tmp = MulFixedPoint15(v998, Set(d16, 18446));
+    auto v999 = Add(v999_tmp, Mul(v998, Set(d16, 2)));
+    auto v1000 = Add(v997, v999);
+    auto v1001 = Sub(v108, v118);
+    auto v1002 = Sub(v125, v134);
+    auto v1003_tmp = MulFixedPoint15(v1002, Set(d16, 18446));
+    auto v1003 = Add(v1003_tmp, Mul(v1002, Set(d16, 2)));
+    auto v1004 = Add(v1001, v1003);
+    auto v1005 = MulFixedPoint15(v1004, Set(d16, 21195));
+    auto v1006 = Add(v1000, v1005);
+    auto v1007 = MulFixedPoint15(v1006, Set(d16, 17401));
+    auto v1008 = Add(v996, v1007);
+    auto v1009 = Sub(v147, v157);
+    auto v1010 = Sub(v170, v179);
+    auto v1011_tmp = MulFixedPoint15(v1010, Set(d16, 18446));
+    auto v1011 = Add(v1011_tmp, Mul(v1010, Set(d16, 2)));
+    auto v1012 = Add(v1009, v1011);
+    auto v1013 = Sub(v194, v212);
+    auto v1014 = Sub(v219, v229);
+    auto v1015_tmp = MulFixedPoint15(v1014, Set(d16, 18446));
+    auto v1015 = Add(v1015_tmp, Mul(v1014, Set(d16, 2)));
+    auto v1016 = Add(v1013, v1015);
+    auto v1017 = MulFixedPoint15(v1016, Set(d16, 21195));
+    auto v1018 = Add(v1012, v1017);
+    auto v1019 = Sub(v240, v250);
+    auto v1020 = Sub(v263, v272);
+    auto v1021_tmp = MulFixedPoint15(v1020, Set(d16, 18446));
+    auto v1021 = Add(v1021_tmp, Mul(v1020, Set(d16, 2)));
+    auto v1022 = Add(v1019, v1021);
+    auto v1023 = Sub(v281, v291);
+    auto v1024 = Sub(v298, v308);
+    auto v1025_tmp = MulFixedPoint15(v1024, Set(d16, 18446));
+    auto v1025 = Add(v1025_tmp, Mul(v1024, Set(d16, 2)));
+    auto v1026 = Add(v1023, v1025);
+    auto v1027 = MulFixedPoint15(v1026, Set(d16, 21195));
+    auto v1028 = Add(v1022, v1027);
+    auto v1029 = MulFixedPoint15(v1028, Set(d16, 17401));
+    auto v1030 = Add(v1018, v1029);
+    auto v1031 = MulFixedPoint15(v1030, Set(d16, 16629));
+    auto v1032 = Add(v1008, v1031);
+    auto v1033 = Sub(v323, v333);
+    auto v1034 = Sub(v346, v355);
+    auto v1035_tmp = MulFixedPoint15(v1034, Set(d16, 18446));
+    auto v1035 = Add(v1035_tmp, Mul(v1034, Set(d16, 2)));
+    auto v1036 = Add(v1033, v1035);
+    auto v1037 = Sub(v370, v388);
+    auto v1038 = Sub(v395, v405);
+    auto v1039_tmp = MulFixedPoint15(v1038, Set(d16, 18446));
+    auto v1039 = Add(v1039_tmp, Mul(v1038, Set(d16, 2)));
+    auto v1040 = Add(v1037, v1039);
+    auto v1041 = MulFixedPoint15(v1040, Set(d16, 21195));
+    auto v1042 = Add(v1036, v1041);
+    auto v1043 = Sub(v422, v440);
+    auto v1044 = Sub(v465, v478);
+    auto v1045_tmp = MulFixedPoint15(v1044, Set(d16, 18446));
+    auto v1045 = Add(v1045_tmp, Mul(v1044, Set(d16, 2)));
+    auto v1046 = Add(v1043, v1045);
+    auto v1047 = Sub(v487, v497);
+    auto v1048 = Sub(v504, v515);
+    auto v1049_tmp = MulFixedPoint15(v1048, Set(d16, 18446));
+    auto v1049 = Add(v1049_tmp, Mul(v1048, Set(d16, 2)));
+    auto v1050 = Add(v1047, v1049);
+    auto v1051 = MulFixedPoint15(v1050, Set(d16, 21195));
+    auto v1052 = Add(v1046, v1051);
+    auto v1053 = MulFixedPoint15(v1052, Set(d16, 17401));
+    auto v1054 = Add(v1042, v1053);
+    auto v1055 = Sub(v528, v538);
+    auto v1056 = Sub(v551, v560);
+    auto v1057_tmp = MulFixedPoint15(v1056, Set(d16, 18446));
+    auto v1057 = Add(v1057_tmp, Mul(v1056, Set(d16, 2)));
+    auto v1058 = Add(v1055, v1057);
+    auto v1059 = Sub(v575, v593);
+    auto v1060 = Sub(v600, v610);
+    auto v1061_tmp = MulFixedPoint15(v1060, Set(d16, 18446));
+    auto v1061 = Add(v1061_tmp, Mul(v1060, Set(d16, 2)));
+    auto v1062 = Add(v1059, v1061);
+    auto v1063 = MulFixedPoint15(v1062, Set(d16, 21195));
+    auto v1064 = Add(v1058, v1063);
+    auto v1065 = Sub(v621, v631);
+    auto v1066 = Sub(v644, v653);
+    auto v1067_tmp = MulFixedPoint15(v1066, Set(d16, 18446));
+    auto v1067 = Add(v1067_tmp, Mul(v1066, Set(d16, 2)));
+    auto v1068 = Add(v1065, v1067);
+    auto v1069 = Sub(v662, v672);
+    auto v1070 = Sub(v679, v690);
+    auto v1071_tmp = MulFixedPoint15(v1070, Set(d16, 18446));
+    auto v1071 = Add(v1071_tmp, Mul(v1070, Set(d16, 2)));
+    auto v1072 = Add(v1069, v1071);
+    auto v1073 = MulFixedPoint15(v1072, Set(d16, 21195));
+    auto v1074 = Add(v1068, v1073);
+    auto v1075 = MulFixedPoint15(v1074, Set(d16, 17401));
+    auto v1076 = Add(v1064, v1075);
+    auto v1077 = MulFixedPoint15(v1076, Set(d16, 16629));
+    auto v1078 = Add(v1054, v1077);
+    auto v1079 = MulFixedPoint15(v1078, Set(d16, 16445));
+    auto v1080 = Add(v1032, v1079);
+    auto v1081 = Sub(v987, v989);
+    auto v1082 = Sub(v991, v993);
+    auto v1083 = MulFixedPoint15(v1082, Set(d16, 25826));
+    auto v1084 = Add(v1081, v1083);
+    auto v1085 = Sub(v997, v999);
+    auto v1086 = Sub(v1001, v1003);
+    auto v1087 = MulFixedPoint15(v1086, Set(d16, 25826));
+    auto v1088 = Add(v1085, v1087);
+    auto v1089 = MulFixedPoint15(v1088, Set(d16, 18124));
+    auto v1090 = Add(v1084, v1089);
+    auto v1091 = Sub(v1009, v1011);
+    auto v1092 = Sub(v1013, v1015);
+    auto v1093 = MulFixedPoint15(v1092, Set(d16, 25826));
+    auto v1094 = Add(v1091, v1093);
+    auto v1095 = Sub(v1019, v1021);
+    auto v1096 = Sub(v1023, v1025);
+    auto v1097 = MulFixedPoint15(v1096, Set(d16, 25826));
+    auto v1098 = Add(v1095, v1097);
+    auto v1099 = MulFixedPoint15(v1098, Set(d16, 18124));
+    auto v1100 = Add(v1094, v1099);
+    auto v1101 = MulFixedPoint15(v1100, Set(d16, 16792));
+    auto v1102 = Add(v1090, v1101);
+    auto v1103 = Sub(v1033, v1035);
+    auto v1104 = Sub(v1037, v1039);
+    auto v1105 = MulFixedPoint15(v1104, Set(d16, 25826));
+    auto v1106 = Add(v1103, v1105);
+    auto v1107 = Sub(v1043, v1045);
+    auto v1108 = Sub(v1047, v1049);
+    auto v1109 = MulFixedPoint15(v1108, Set(d16, 25826));
+    auto v1110 = Add(v1107, v1109);
+    auto v1111 = MulFixedPoint15(v1110, Set(d16, 18124));
+    auto v1112 = Add(v1106, v1111);
+    auto v1113 = Sub(v1055, v1057);
+    auto v1114 = Sub(v1059, v1061);
+    auto v1115 = MulFixedPoint15(v1114, Set(d16, 25826));
+    auto v1116 = Add(v1113, v1115);
+    auto v1117 = Sub(v1065, v1067);
+    auto v1118 = Sub(v1069, v1071);
+    auto v1119 = MulFixedPoint15(v1118, Set(d16, 25826));
+    auto v1120 = Add(v1117, v1119);
+    auto v1121 = MulFixedPoint15(v1120, Set(d16, 18124));
+    auto v1122 = Add(v1116, v1121);
+    auto v1123 = MulFixedPoint15(v1122, Set(d16, 16792));
+    auto v1124 = Add(v1112, v1123);
+    auto v1125 = MulFixedPoint15(v1124, Set(d16, 16484));
+    auto v1126 = Add(v1102, v1125);
+    auto v1127 = Sub(v892, v894);
+    auto v1128 = Sub(v896, v898);
+    auto v1129_tmp = MulFixedPoint15(v1128, Set(d16, 1988));
+    auto v1129 = Add(v1129_tmp, v1128);
+    auto v1130 = Add(v1127, v1129);
+    auto v1131 = Sub(v902, v904);
+    auto v1132 = Sub(v906, v908);
+    auto v1133_tmp = MulFixedPoint15(v1132, Set(d16, 1988));
+    auto v1133 = Add(v1133_tmp, v1132);
+    auto v1134 = Add(v1131, v1133);
+    auto v1135 = MulFixedPoint15(v1134, Set(d16, 19102));
+    auto v1136 = Add(v1130, v1135);
+    auto v1137 = Sub(v914, v917);
+    auto v1138 = Sub(v919, v921);
+    auto v1139_tmp = MulFixedPoint15(v1138, Set(d16, 1988));
+    auto v1139 = Add(v1139_tmp, v1138);
+    auto v1140 = Add(v1137, v1139);
+    auto v1141 = Sub(v925, v927);
+    auto v1142 = Sub(v929, v931);
+    auto v1143_tmp = MulFixedPoint15(v1142, Set(d16, 1988));
+    auto v1143 = Add(v1143_tmp, v1142);
+    auto v1144 = Add(v1141, v1143);
+    auto v1145 = MulFixedPoint15(v1144, Set(d16, 19102));
+    auto v1146 = Add(v1140, v1145);
+    auto v1147 = MulFixedPoint15(v1146, Set(d16, 17000));
+    auto v1148 = Add(v1136, v1147);
+    auto v1149 = Sub(v939, v941);
+    auto v1150 = Sub(v943, v945);
+    auto v1151_tmp = MulFixedPoint15(v1150, Set(d16, 1988));
+    auto v1151 = Add(v1151_tmp, v1150);
+    auto v1152 = Add(v1149, v1151);
+    auto v1153 = Sub(v949, v951);
+    auto v1154 = Sub(v953, v955);
+    auto v1155_tmp = MulFixedPoint15(v1154, Set(d16, 1988));
+    auto v1155 = Add(v1155_tmp, v1154);
+    auto v1156 = Add(v1153, v1155);
+    auto v1157 = MulFixedPoint15(v1156, Set(d16, 19102));
+    auto v1158 = Add(v1152, v1157);
+    auto v1159 = Sub(v961, v963);
+    auto v1160 = Sub(v965, v967);
+    auto v1161_tmp = MulFixedPoint15(v1160, Set(d16, 1988));
+    auto v1161 = Add(v1161_tmp, v1160);
+    auto v1162 = Add(v1159, v1161);
+    auto v1163 = Sub(v971, v973);
+    auto v1164 = Sub(v975, v977);
+    auto v1165_tmp = MulFixedPoint15(v1164, Set(d16, 1988));
+    auto v1165 = Add(v1165_tmp, v1164);
+    auto v1166 = Add(v1163, v1165);
+    auto v1167 = MulFixedPoint15(v1166, Set(d16, 19102));
+    auto v1168 = Add(v1162, v1167);
+    auto v1169 = MulFixedPoint15(v1168, Set(d16, 17000));
+    auto v1170 = Add(v1158, v1169);
+    auto v1171 = MulFixedPoint15(v1170, Set(d16, 16534));
+    auto v1172 = Add(v1148, v1171);
+    auto v1173 = Sub(v705, v710);
+    auto v1174 = Sub(v715, v720);
+    auto v1175_tmp = MulFixedPoint15(v1174, Set(d16, 23673));
+    auto v1175 = Add(v1175_tmp, v1174);
+    auto v1176 = Add(v1173, v1175);
+    auto v1177 = Sub(v727, v732);
+    auto v1178 = Sub(v737, v742);
+    auto v1179_tmp = MulFixedPoint15(v1178, Set(d16, 23673));
+    auto v1179 = Add(v1179_tmp, v1178);
+    auto v1180 = Add(v1177, v1179);
+    auto v1181 = MulFixedPoint15(v1180, Set(d16, 20398));
+    auto v1182 = Add(v1176, v1181);
+    auto v1183 = Sub(v751, v756);
+    auto v1184 = Sub(v761, v766);
+    auto v1185_tmp = MulFixedPoint15(v1184, Set(d16, 23673));
+    auto v1185 = Add(v1185_tmp, v1184);
+    auto v1186 = Add(v1183, v1185);
+    auto v1187 = Sub(v773, v778);
+    auto v1188 = Sub(v783, v788);
+    auto v1189_tmp = MulFixedPoint15(v1188, Set(d16, 23673));
+    auto v1189 = Add(v1189_tmp, v1188);
+    auto v1190 = Add(v1187, v1189);
+    auto v1191 = MulFixedPoint15(v1190, Set(d16, 20398));
+    auto v1192 = Add(v1186, v1191);
+    auto v1193 = MulFixedPoint15(v1192, Set(d16, 17255));
+    auto v1194 = Add(v1182, v1193);
+    auto v1195 = Sub(v799, v804);
+    auto v1196 = Sub(v809, v814);
+    auto v1197_tmp = MulFixedPoint15(v1196, Set(d16, 23673));
+    auto v1197 = Add(v1197_tmp, v1196);
+    auto v1198 = Add(v1195, v1197);
+    auto v1199 = Sub(v821, v826);
+    auto v1200 = Sub(v831, v836);
+    auto v1201_tmp = MulFixedPoint15(v1200, Set(d16, 23673));
+    auto v1201 = Add(v1201_tmp, v1200);
+    auto v1202 = Add(v1199, v1201);
+    auto v1203 = MulFixedPoint15(v1202, Set(d16, 20398));
+    auto v1204 = Add(v1198, v1203);
+    auto v1205 = Sub(v845, v850);
+    auto v1206 = Sub(v855, v860);
+    auto v1207_tmp = MulFixedPoint15(v1206, Set(d16, 23673));
+    auto v1207 = Add(v1207_tmp, v1206);
+    auto v1208 = Add(v1205, v1207);
+    auto v1209 = Sub(v867, v872);
+    auto v1210 = Sub(v877, v882);
+    auto v1211_tmp = MulFixedPoint15(v1210, Set(d16, 23673));
+    auto v1211 = Add(v1211_tmp, v1210);
+    auto v1212 = Add(v1209, v1211);
+    auto v1213 = MulFixedPoint15(v1212, Set(d16, 20398));
+    auto v1214 = Add(v1208, v1213);
+    auto v1215 = MulFixedPoint15(v1214, Set(d16, 17255));
+    auto v1216 = Add(v1204, v1215);
+    auto v1217 = MulFixedPoint15(v1216, Set(d16, 16595));
+    auto v1218 = Add(v1194, v1217);
+    auto v1219 = Sub(v9, v24);
+    auto v1220 = Sub(v42, v58);
+    auto v1221_tmp = MulFixedPoint15(v1220, Set(d16, 3314));
+    auto v1221 = Add(v1221_tmp, Mul(v1220, Set(d16, 5)));
+    auto v1222 = Add(v1219, v1221);
+    auto v1223 = Sub(v78, v101);
+    auto v1224 = Sub(v119, v136);
+    auto v1225_tmp = MulFixedPoint15(v1224, Set(d16, 3314));
+    auto v1225 = Add(v1225_tmp, Mul(v1224, Set(d16, 5)));
+    auto v1226 = Add(v1223, v1225);
+    auto v1227 = MulFixedPoint15(v1226, Set(d16, 22112));
+    auto v1228 = Add(v1222, v1227);
+    auto v1229 = Sub(v158, v181);
+    auto v1230 = Sub(v213, v231);
+    auto v1231_tmp = MulFixedPoint15(v1230, Set(d16, 3314));
+    auto v1231 = Add(v1231_tmp, Mul(v1230, Set(d16, 5)));
+    auto v1232 = Add(v1229, v1231);
+    auto v1233 = Sub(v251, v274);
+    auto v1234 = Sub(v292, v310);
+    auto v1235_tmp = MulFixedPoint15(v1234, Set(d16, 3314));
+    auto v1235 = Add(v1235_tmp, Mul(v1234, Set(d16, 5)));
+    auto v1236 = Add(v1233, v1235);
+    auto v1237 = MulFixedPoint15(v1236, Set(d16, 22112));
+    auto v1238 = Add(v1232, v1237);
+    auto v1239 = MulFixedPoint15(v1238, Set(d16, 17561));
+    auto v1240 = Add(v1228, v1239);
+    auto v1241 = Sub(v334, v357);
+    auto v1242 = Sub(v389, v407);
+    auto v1243_tmp = MulFixedPoint15(v1242, Set(d16, 3314));
+    auto v1243 = Add(v1243_tmp, Mul(v1242, Set(d16, 5)));
+    auto v1244 = Add(v1241, v1243);
+    auto v1245 = Sub(v441, v480);
+    auto v1246 = Sub(v498, v517);
+    auto v1247_tmp = MulFixedPoint15(v1246, Set(d16, 3314));
+    auto v1247 = Add(v1247_tmp, Mul(v1246, Set(d16, 5)));
+    auto v1248 = Add(v1245, v1247);
+    auto v1249 = MulFixedPoint15(v1248, Set(d16, 22112));
+    auto v1250 = Add(v1244, v1249);
+    auto v1251 = Sub(v539, v562);
+    auto v1252 = Sub(v594, v612);
+    auto v1253_tmp = MulFixedPoint15(v1252, Set(d16, 3314));
+    auto v1253 = Add(v1253_tmp, Mul(v1252, Set(d16, 5)));
+    auto v1254 = Add(v1251, v1253);
+    auto v1255 = Sub(v632, v655);
+    auto v1256 = Sub(v673, v692);
+    auto v1257_tmp = MulFixedPoint15(v1256, Set(d16, 3314));
+    auto v1257 = Add(v1257_tmp, Mul(v1256, Set(d16, 5)));
+    auto v1258 = Add(v1255, v1257);
+    auto v1259 = MulFixedPoint15(v1258, Set(d16, 22112));
+    auto v1260 = Add(v1254, v1259);
+    auto v1261 = MulFixedPoint15(v1260, Set(d16, 17561));
+    auto v1262 = Add(v1250, v1261);
+    auto v1263 = MulFixedPoint15(v1262, Set(d16, 16666));
+    auto v1264 = Add(v1240, v1263);
+    auto v1265 = Sub(v1219, v1221);
+    auto v1266 = Sub(v1223, v1225);
+    auto v1267 = MulFixedPoint15(v1266, Set(d16, 24397));
+    auto v1268 = Add(v1265, v1267);
+    auto v1269 = Sub(v1229, v1231);
+    auto v1270 = Sub(v1233, v1235);
+    auto v1271 = MulFixedPoint15(v1270, Set(d16, 24397));
+    auto v1272 = Add(v1269, v1271);
+    auto v1273 = MulFixedPoint15(v1272, Set(d16, 17921));
+    auto v1274 = Add(v1268, v1273);
+    auto v1275 = Sub(v1241, v1243);
+    auto v1276 = Sub(v1245, v1247);
+    auto v1277 = MulFixedPoint15(v1276, Set(d16, 24397));
+    auto v1278 = Add(v1275, v1277);
+    auto v1279 = Sub(v1251, v1253);
+    auto v1280 = Sub(v1255, v1257);
+    auto v1281 = MulFixedPoint15(v1280, Set(d16, 24397));
+    auto v1282 = Add(v1279, v1281);
+    auto v1283 = MulFixedPoint15(v1282, Set(d16, 17921));
+    auto v1284 = Add(v1278, v1283);
+    auto v1285 = MulFixedPoint15(v1284, Set(d16, 16747));
+    auto v1286 = Add(v1274, v1285);
+    auto v1287 = Sub(v1173, v1175);
+    auto v1288 = Sub(v1177, v1179);
+    auto v1289 = MulFixedPoint15(v1288, Set(d16, 27504));
+    auto v1290 = Add(v1287, v1289);
+    auto v1291 = Sub(v1183, v1185);
+    auto v1292 = Sub(v1187, v1189);
+    auto v1293 = MulFixedPoint15(v1292, Set(d16, 27504));
+    auto v1294 = Add(v1291, v1293);
+    auto v1295 = MulFixedPoint15(v1294, Set(d16, 18343));
+    auto v1296 = Add(v1290, v1295);
+    auto v1297 = Sub(v1195, v1197);
+    auto v1298 = Sub(v1199, v1201);
+    auto v1299 = MulFixedPoint15(v1298, Set(d16, 27504));
+    auto v1300 = Add(v1297, v1299);
+    auto v1301 = Sub(v1205, v1207);
+    auto v1302 = Sub(v1209, v1211);
+    auto v1303 = MulFixedPoint15(v1302, Set(d16, 27504));
+    auto v1304 = Add(v1301, v1303);
+    auto v1305 = MulFixedPoint15(v1304, Set(d16, 18343));
+    auto v1306 = Add(v1300, v1305);
+    auto v1307 = MulFixedPoint15(v1306, Set(d16, 16840));
+    auto v1308 = Add(v1296, v1307);
+    auto v1309 = Sub(v1127, v1129);
+    auto v1310 = Sub(v1131, v1133);
+    auto v1311 = MulFixedPoint15(v1310, Set(d16, 31869));
+    auto v1312 = Add(v1309, v1311);
+    auto v1313 = Sub(v1137, v1139);
+    auto v1314 = Sub(v1141, v1143);
+    auto v1315 = MulFixedPoint15(v1314, Set(d16, 31869));
+    auto v1316 = Add(v1313, v1315);
+    auto v1317 = MulFixedPoint15(v1316, Set(d16, 18830));
+    auto v1318 = Add(v1312, v1317);
+    auto v1319 = Sub(v1149, v1151);
+    auto v1320 = Sub(v1153, v1155);
+    auto v1321 = MulFixedPoint15(v1320, Set(d16, 31869));
+    auto v1322 = Add(v1319, v1321);
+    auto v1323 = Sub(v1159, v1161);
+    auto v1324 = Sub(v1163, v1165);
+    auto v1325 = MulFixedPoint15(v1324, Set(d16, 31869));
+    auto v1326 = Add(v1323, v1325);
+    auto v1327 = MulFixedPoint15(v1326, Set(d16, 18830));
+    auto v1328 = Add(v1322, v1327);
+    auto v1329 = MulFixedPoint15(v1328, Set(d16, 16944));
+    auto v1330 = Add(v1318, v1329);
+    auto v1331 = Sub(v1081, v1083);
+    auto v1332 = Sub(v1085, v1087);
+    auto v1333_tmp = MulFixedPoint15(v1332, Set(d16, 5552));
+    auto v1333 = Add(v1333_tmp, v1332);
+    auto v1334 = Add(v1331, v1333);
+    auto v1335 = Sub(v1091, v1093);
+    auto v1336 = Sub(v1095, v1097);
+    auto v1337_tmp = MulFixedPoint15(v1336, Set(d16, 5552));
+    auto v1337 = Add(v1337_tmp, v1336);
+    auto v1338 = Add(v1335, v1337);
+    auto v1339 = MulFixedPoint15(v1338, Set(d16, 19393));
+    auto v1340 = Add(v1334, v1339);
+    auto v1341 = Sub(v1103, v1105);
+    auto v1342 = Sub(v1107, v1109);
+    auto v1343_tmp = MulFixedPoint15(v1342, Set(d16, 5552));
+    auto v1343 = Add(v1343_tmp, v1342);
+    auto v1344 = Add(v1341, v1343);
+    auto v1345 = Sub(v1113, v1115);
+    auto v1346 = Sub(v1117, v1119);
+    auto v1347_tmp = MulFixedPoint15(v1346, Set(d16, 5552));
+    auto v1347 = Add(v1347_tmp, v1346);
+    auto v1348 = Add(v1345, v1347);
+    auto v1349 = MulFixedPoint15(v1348, Set(d16, 19393));
+    auto v1350 = Add(v1344, v1349);
+    auto v1351 = MulFixedPoint15(v1350, Set(d16, 17059));
+    auto v1352 = Add(v1340, v1351);
+    auto v1353 = Sub(v990, v995);
+    auto v1354 = Sub(v1000, v1005);
+    auto v1355_tmp = MulFixedPoint15(v1354, Set(d16, 15865));
+    auto v1355 = Add(v1355_tmp, v1354);
+    auto v1356 = Add(v1353, v1355);
+    auto v1357 = Sub(v1012, v1017);
+    auto v1358 = Sub(v1022, v1027);
+    auto v1359_tmp = MulFixedPoint15(v1358, Set(d16, 15865));
+    auto v1359 = Add(v1359_tmp, v1358);
+    auto v1360 = Add(v1357, v1359);
+    auto v1361 = MulFixedPoint15(v1360, Set(d16, 20040));
+    auto v1362 = Add(v1356, v1361);
+    auto v1363 = Sub(v1036, v1041);
+    auto v1364 = Sub(v1046, v1051);
+    auto v1365_tmp = MulFixedPoint15(v1364, Set(d16, 15865));
+    auto v1365 = Add(v1365_tmp, v1364);
+    auto v1366 = Add(v1363, v1365);
+    auto v1367 = Sub(v1058, v1063);
+    auto v1368 = Sub(v1068, v1073);
+    auto v1369_tmp = MulFixedPoint15(v1368, Set(d16, 15865));
+    auto v1369 = Add(v1369_tmp, v1368);
+    auto v1370 = Add(v1367, v1369);
+    auto v1371 = MulFixedPoint15(v1370, Set(d16, 20040));
+    auto v1372 = Add(v1366, v1371);
+    auto v1373 = MulFixedPoint15(v1372, Set(d16, 17187));
+    auto v1374 = Add(v1362, v1373);
+    auto v1375 = Sub(v895, v900);
+    auto v1376 = Sub(v905, v910);
+    auto v1377_tmp = MulFixedPoint15(v1376, Set(d16, 1893));
+    auto v1377 = Add(v1377_tmp, Mul(v1376, Set(d16, 2)));
+    auto v1378 = Add(v1375, v1377);
+    auto v1379 = Sub(v918, v923);
+    auto v1380 = Sub(v928, v933);
+    auto v1381_tmp = MulFixedPoint15(v1380, Set(d16, 1893));
+    auto v1381 = Add(v1381_tmp, Mul(v1380, Set(d16, 2)));
+    auto v1382 = Add(v1379, v1381);
+    auto v1383 = MulFixedPoint15(v1382, Set(d16, 20783));
+    auto v1384 = Add(v1378, v1383);
+    auto v1385 = Sub(v942, v947);
+    auto v1386 = Sub(v952, v957);
+    auto v1387_tmp = MulFixedPoint15(v1386, Set(d16, 1893));
+    auto v1387 = Add(v1387_tmp, Mul(v1386, Set(d16, 2)));
+    auto v1388 = Add(v1385, v1387);
+    auto v1389 = Sub(v964, v969);
+    auto v1390 = Sub(v974, v979);
+    auto v1391_tmp = MulFixedPoint15(v1390, Set(d16, 1893));
+    auto v1391 = Add(v1391_tmp, Mul(v1390, Set(d16, 2)));
+    auto v1392 = Add(v1389, v1391);
+    auto v1393 = MulFixedPoint15(v1392, Set(d16, 20783));
+    auto v1394 = Add(v1388, v1393);
+    auto v1395 = MulFixedPoint15(v1394, Set(d16, 17326));
+    auto v1396 = Add(v1384, v1395);
+    auto v1397 = Sub(v711, v722);
+    auto v1398 = Sub(v733, v744);
+    auto v1399_tmp = MulFixedPoint15(v1398, Set(d16, 13357));
+    auto v1399 = Add(v1399_tmp, Mul(v1398, Set(d16, 3)));
+    auto v1400 = Add(v1397, v1399);
+    auto v1401 = Sub(v757, v768);
+    auto v1402 = Sub(v779, v790);
+    auto v1403_tmp = MulFixedPoint15(v1402, Set(d16, 13357));
+    auto v1403 = Add(v1403_tmp, Mul(v1402, Set(d16, 3)));
+    auto v1404 = Add(v1401, v1403);
+    auto v1405 = MulFixedPoint15(v1404, Set(d16, 21637));
+    auto v1406 = Add(v1400, v1405);
+    auto v1407 = Sub(v805, v816);
+    auto v1408 = Sub(v827, v838);
+    auto v1409_tmp = MulFixedPoint15(v1408, Set(d16, 13357));
+    auto v1409 = Add(v1409_tmp, Mul(v1408, Set(d16, 3)));
+    auto v1410 = Add(v1407, v1409);
+    auto v1411 = Sub(v851, v862);
+    auto v1412 = Sub(v873, v884);
+    auto v1413_tmp = MulFixedPoint15(v1412, Set(d16, 13357));
+    auto v1413 = Add(v1413_tmp, Mul(v1412, Set(d16, 3)));
+    auto v1414 = Add(v1411, v1413);
+    auto v1415 = MulFixedPoint15(v1414, Set(d16, 21637));
+    auto v1416 = Add(v1410, v1415);
+    auto v1417 = MulFixedPoint15(v1416, Set(d16, 17479));
+    auto v1418 = Add(v1406, v1417);
+    auto v1419 = Sub(v25, v60);
+    auto v1420 = Sub(v102, v138);
+    auto v1421_tmp = MulFixedPoint15(v1420, Set(d16, 6226));
+    auto v1421 = Add(v1421_tmp, Mul(v1420, Set(d16, 10)));
+    auto v1422 = Add(v1419, v1421);
+    auto v1423 = Sub(v182, v233);
+    auto v1424 = Sub(v275, v312);
+    auto v1425_tmp = MulFixedPoint15(v1424, Set(d16, 6226));
+    auto v1425 = Add(v1425_tmp, Mul(v1424, Set(d16, 10)));
+    auto v1426 = Add(v1423, v1425);
+    auto v1427 = MulFixedPoint15(v1426, Set(d16, 22622));
+    auto v1428 = Add(v1422, v1427);
+    auto v1429 = Sub(v358, v409);
+    auto v1430 = Sub(v481, v519);
+    auto v1431_tmp = MulFixedPoint15(v1430, Set(d16, 6226));
+    auto v1431 = Add(v1431_tmp, Mul(v1430, Set(d16, 10)));
+    auto v1432 = Add(v1429, v1431);
+    auto v1433 = Sub(v563, v614);
+    auto v1434 = Sub(v656, v694);
+    auto v1435_tmp = MulFixedPoint15(v1434, Set(d16, 6226));
+    auto v1435 = Add(v1435_tmp, Mul(v1434, Set(d16, 10)));
+    auto v1436 = Add(v1433, v1435);
+    auto v1437 = MulFixedPoint15(v1436, Set(d16, 22622));
+    auto v1438 = Add(v1432, v1437);
+    auto v1439 = MulFixedPoint15(v1438, Set(d16, 17646));
+    auto v1440 = Add(v1428, v1439);
+    auto v1441 = Sub(v1419, v1421);
+    auto v1442 = Sub(v1423, v1425);
+    auto v1443 = MulFixedPoint15(v1442, Set(d16, 23761));
+    auto v1444 = Add(v1441, v1443);
+    auto v1445 = Sub(v1429, v1431);
+    auto v1446 = Sub(v1433, v1435);
+    auto v1447 = MulFixedPoint15(v1446, Set(d16, 23761));
+    auto v1448 = Add(v1445, v1447);
+    auto v1449 = MulFixedPoint15(v1448, Set(d16, 17826));
+    auto v1450 = Add(v1444, v1449);
+    auto v1451 = Sub(v1397, v1399);
+    auto v1452 = Sub(v1401, v1403);
+    auto v1453 = MulFixedPoint15(v1452, Set(d16, 25084));
+    auto v1454 = Add(v1451, v1453);
+    auto v1455 = Sub(v1407, v1409);
+    auto v1456 = Sub(v1411, v1413);
+    auto v1457 = MulFixedPoint15(v1456, Set(d16, 25084));
+    auto v1458 = Add(v1455, v1457);
+    auto v1459 = MulFixedPoint15(v1458, Set(d16, 18021));
+    auto v1460 = Add(v1454, v1459);
+    auto v1461 = Sub(v1375, v1377);
+    auto v1462 = Sub(v1379, v1381);
+    auto v1463 = MulFixedPoint15(v1462, Set(d16, 26631));
+    auto v1464 = Add(v1461, v1463);
+    auto v1465 = Sub(v1385, v1387);
+    auto v1466 = Sub(v1389, v1391);
+    auto v1467 = MulFixedPoint15(v1466, Set(d16, 26631));
+    auto v1468 = Add(v1465, v1467);
+    auto v1469 = MulFixedPoint15(v1468, Set(d16, 18231));
+    auto v1470 = Add(v1464, v1469);
+    auto v1471 = Sub(v1353, v1355);
+    auto v1472 = Sub(v1357, v1359);
+    auto v1473 = MulFixedPoint15(v1472, Set(d16, 28454));
+    auto v1474 = Add(v1471, v1473);
+    auto v1475 = Sub(v1363, v1365);
+    auto v1476 = Sub(v1367, v1369);
+    auto v1477 = MulFixedPoint15(v1476, Set(d16, 28454));
+    auto v1478 = Add(v1475, v1477);
+    auto v1479 = MulFixedPoint15(v1478, Set(d16, 18458));
+    auto v1480 = Add(v1474, v1479);
+    auto v1481 = Sub(v1331, v1333);
+    auto v1482 = Sub(v1335, v1337);
+    auto v1483 = MulFixedPoint15(v1482, Set(d16, 30624));
+    auto v1484 = Add(v1481, v1483);
+    auto v1485 = Sub(v1341, v1343);
+    auto v1486 = Sub(v1345, v1347);
+    auto v1487 = MulFixedPoint15(v1486, Set(d16, 30624));
+    auto v1488 = Add(v1485, v1487);
+    auto v1489 = MulFixedPoint15(v1488, Set(d16, 18702));
+    auto v1490 = Add(v1484, v1489);
+    auto v1491 = Sub(v1309, v1311);
+    auto v1492 = Sub(v1313, v1315);
+    auto v1493_tmp = MulFixedPoint15(v1492, Set(d16, 472));
+    auto v1493 = Add(v1493_tmp, v1492);
+    auto v1494 = Add(v1491, v1493);
+    auto v1495 = Sub(v1319, v1321);
+    auto v1496 = Sub(v1323, v1325);
+    auto v1497_tmp = MulFixedPoint15(v1496, Set(d16, 472));
+    auto v1497 = Add(v1497_tmp, v1496);
+    auto v1498 = Add(v1495, v1497);
+    auto v1499 = MulFixedPoint15(v1498, Set(d16, 18964));
+    auto v1500 = Add(v1494, v1499);
+    auto v1501 = Sub(v1287, v1289);
+    auto v1502 = Sub(v1291, v1293);
+    auto v1503_tmp = MulFixedPoint15(v1502, Set(d16, 3672));
+    auto v1503 = Add(v1503_tmp, v1502);
+    auto v1504 = Add(v1501, v1503);
+    auto v1505 = Sub(v1297, v1299);
+    auto v1506 = Sub(v1301, v1303);
+    auto v1507_tmp = MulFixedPoint15(v1506, Set(d16, 3672));
+    auto v1507 = Add(v1507_tmp, v1506);
+    auto v1508 = Add(v1505, v1507);
+    auto v1509 = MulFixedPoint15(v1508, Set(d16, 19245));
+    auto v1510 = Add(v1504, v1509);
+    auto v1511 = Sub(v1265, v1267);
+    auto v1512 = Sub(v1269, v1271);
+    auto v1513_tmp = MulFixedPoint15(v1512, Set(d16, 7662));
+    auto v1513 = Add(v1513_tmp, v1512);
+    auto v1514 = Add(v1511, v1513);
+    auto v1515 = Sub(v1275, v1277);
+    auto v1516 = Sub(v1279, v1281);
+    auto v1517_tmp = MulFixedPoint15(v1516, Set(d16, 7662));
+    auto v1517 = Add(v1517_tmp, v1516);
+    auto v1518 = Add(v1515, v1517);
+    auto v1519 = MulFixedPoint15(v1518, Set(d16, 19546));
+    auto v1520 = Add(v1514, v1519);
+    auto v1521 = Sub(v1222, v1227);
+    auto v1522 = Sub(v1232, v1237);
+    auto v1523_tmp = MulFixedPoint15(v1522, Set(d16, 12756));
+    auto v1523 = Add(v1523_tmp, v1522);
+    auto v1524 = Add(v1521, v1523);
+    auto v1525 = Sub(v1244, v1249);
+    auto v1526 = Sub(v1254, v1259);
+    auto v1527_tmp = MulFixedPoint15(v1526, Set(d16, 12756));
+    auto v1527 = Add(v1527_tmp, v1526);
+    auto v1528 = Add(v1525, v1527);
+    auto v1529 = MulFixedPoint15(v1528, Set(d16, 19869));
+    auto v1530 = Add(v1524, v1529);
+    auto v1531 = Sub(v1176, v1181);
+    auto v1532 = Sub(v1186, v1191);
+    auto v1533_tmp = MulFixedPoint15(v1532, Set(d16, 19463));
+    auto v1533 = Add(v1533_tmp, v1532);
+    auto v1534 = Add(v1531, v1533);
+    auto v1535 = Sub(v1198, v1203);
+    auto v1536 = Sub(v1208, v1213);
+    auto v1537_tmp = MulFixedPoint15(v1536, Set(d16, 19463));
+    auto v1537 = Add(v1537_tmp, v1536);
+    auto v1538 = Add(v1535, v1537);
+    auto v1539 = MulFixedPoint15(v1538, Set(d16, 20216));
+    auto v1540 = Add(v1534, v1539);
+    auto v1541 = Sub(v1130, v1135);
+    auto v1542 = Sub(v1140, v1145);
+    auto v1543_tmp = MulFixedPoint15(v1542, Set(d16, 28661));
+    auto v1543 = Add(v1543_tmp, v1542);
+    auto v1544 = Add(v1541, v1543);
+    auto v1545 = Sub(v1152, v1157);
+    auto v1546 = Sub(v1162, v1167);
+    auto v1547_tmp = MulFixedPoint15(v1546, Set(d16, 28661));
+    auto v1547 = Add(v1547_tmp, v1546);
+    auto v1548 = Add(v1545, v1547);
+    auto v1549 = MulFixedPoint15(v1548, Set(d16, 20587));
+    auto v1550 = Add(v1544, v1549);
+    auto v1551 = Sub(v1084, v1089);
+    auto v1552 = Sub(v1094, v1099);
+    auto v1553_tmp = MulFixedPoint15(v1552, Set(d16, 9242));
+    auto v1553 = Add(v1553_tmp, Mul(v1552, Set(d16, 2)));
+    auto v1554 = Add(v1551, v1553);
+    auto v1555 = Sub(v1106, v1111);
+    auto v1556 = Sub(v1116, v1121);
+    auto v1557_tmp = MulFixedPoint15(v1556, Set(d16, 9242));
+    auto v1557 = Add(v1557_tmp, Mul(v1556, Set(d16, 2)));
+    auto v1558 = Add(v1555, v1557);
+    auto v1559 = MulFixedPoint15(v1558, Set(d16, 20985));
+    auto v1560 = Add(v1554, v1559);
+    auto v1561 = Sub(v996, v1007);
+    auto v1562 = Sub(v1018, v1029);
+    auto v1563_tmp = MulFixedPoint15(v1562, Set(d16, 30298));
+    auto v1563 = Add(v1563_tmp, Mul(v1562, Set(d16, 2)));
+    auto v1564 = Add(v1561, v1563);
+    auto v1565 = Sub(v1042, v1053);
+    auto v1566 = Sub(v1064, v1075);
+    auto v1567_tmp = MulFixedPoint15(v1566, Set(d16, 30298));
+    auto v1567 = Add(v1567_tmp, Mul(v1566, Set(d16, 2)));
+    auto v1568 = Add(v1565, v1567);
+    auto v1569 = MulFixedPoint15(v1568, Set(d16, 21412));
+    auto v1570 = Add(v1564, v1569);
+    auto v1571 = Sub(v901, v912);
+    auto v1572 = Sub(v924, v935);
+    auto v1573_tmp = MulFixedPoint15(v1572, Set(d16, 2773));
+    auto v1573 = Add(v1573_tmp, Mul(v1572, Set(d16, 4)));
+    auto v1574 = Add(v1571, v1573);
+    auto v1575 = Sub(v948, v959);
+    auto v1576 = Sub(v970, v981);
+    auto v1577_tmp = MulFixedPoint15(v1576, Set(d16, 2773));
+    auto v1577 = Add(v1577_tmp, Mul(v1576, Set(d16, 4)));
+    auto v1578 = Add(v1575, v1577);
+    auto v1579 = MulFixedPoint15(v1578, Set(d16, 21871));
+    auto v1580 = Add(v1574, v1579);
+    auto v1581 = Sub(v723, v746);
+    auto v1582 = Sub(v769, v792);
+    auto v1583_tmp = MulFixedPoint15(v1582, Set(d16, 26108));
+    auto v1583 = Add(v1583_tmp, Mul(v1582, Set(d16, 6)));
+    auto v1584 = Add(v1581, v1583);
+    auto v1585 = Sub(v817, v840);
+    auto v1586 = Sub(v863, v886);
+    auto v1587_tmp = MulFixedPoint15(v1586, Set(d16, 26108));
+    auto v1587 = Add(v1587_tmp, Mul(v1586, Set(d16, 6)));
+    auto v1588 = Add(v1585, v1587);
+    auto v1589 = MulFixedPoint15(v1588, Set(d16, 22363));
+    auto v1590 = Add(v1584, v1589);
+    auto v1591 = Sub(v61, v140);
+    auto v1592 = Sub(v234, v314);
+    auto v1593_tmp = MulFixedPoint15(v1592, Set(d16, 12251));
+    auto v1593 = Add(v1593_tmp, Mul(v1592, Set(d16, 20)));
+    auto v1594 = Add(v1591, v1593);
+    auto v1595 = Sub(v410, v521);
+    auto v1596 = Sub(v615, v696);
+    auto v1597_tmp = MulFixedPoint15(v1596, Set(d16, 12251));
+    auto v1597 = Add(v1597_tmp, Mul(v1596, Set(d16, 20)));
+    auto v1598 = Add(v1595, v1597);
+    auto v1599 = MulFixedPoint15(v1598, Set(d16, 22891));
+    auto v1600 = Add(v1594, v1599);
+    auto v1601 = Sub(v1591, v1593);
+    auto v1602 = Sub(v1595, v1597);
+    auto v1603 = MulFixedPoint15(v1602, Set(d16, 23460));
+    auto v1604 = Add(v1601, v1603);
+    auto v1605 = Sub(v1581, v1583);
+    auto v1606 = Sub(v1585, v1587);
+    auto v1607 = MulFixedPoint15(v1606, Set(d16, 24073));
+    auto v1608 = Add(v1605, v1607);
+    auto v1609 = Sub(v1571, v1573);
+    auto v1610 = Sub(v1575, v1577);
+    auto v1611 = MulFixedPoint15(v1610, Set(d16, 24734));
+    auto v1612 = Add(v1609, v1611);
+    auto v1613 = Sub(v1561, v1563);
+    auto v1614 = Sub(v1565, v1567);
+    auto v1615 = MulFixedPoint15(v1614, Set(d16, 25448));
+    auto v1616 = Add(v1613, v1615);
+    auto v1617 = Sub(v1551, v1553);
+    auto v1618 = Sub(v1555, v1557);
+    auto v1619 = MulFixedPoint15(v1618, Set(d16, 26220));
+    auto v1620 = Add(v1617, v1619);
+    auto v1621 = Sub(v1541, v1543);
+    auto v1622 = Sub(v1545, v1547);
+    auto v1623 = MulFixedPoint15(v1622, Set(d16, 27058));
+    auto v1624 = Add(v1621, v1623);
+    auto v1625 = Sub(v1531, v1533);
+    auto v1626 = Sub(v1535, v1537);
+    auto v1627 = MulFixedPoint15(v1626, Set(d16, 27969));
+    auto v1628 = Add(v1625, v1627);
+    auto v1629 = Sub(v1521, v1523);
+    auto v1630 = Sub(v1525, v1527);
+    auto v1631 = MulFixedPoint15(v1630, Set(d16, 28961));
+    auto v1632 = Add(v1629, v1631);
+    auto v1633 = Sub(v1511, v1513);
+    auto v1634 = Sub(v1515, v1517);
+    auto v1635 = MulFixedPoint15(v1634, Set(d16, 30044));
+    auto v1636 = Add(v1633, v1635);
+    auto v1637 = Sub(v1501, v1503);
+    auto v1638 = Sub(v1505, v1507);
+    auto v1639 = MulFixedPoint15(v1638, Set(d16, 31232));
+    auto v1640 = Add(v1637, v1639);
+    auto v1641 = Sub(v1491, v1493);
+    auto v1642 = Sub(v1495, v1497);
+    auto v1643 = MulFixedPoint15(v1642, Set(d16, 32538));
+    auto v1644 = Add(v1641, v1643);
+    auto v1645 = Sub(v1481, v1483);
+    auto v1646 = Sub(v1485, v1487);
+    auto v1647_tmp = MulFixedPoint15(v1646, Set(d16, 1211));
+    auto v1647 = Add(v1647_tmp, v1646);
+    auto v1648 = Add(v1645, v1647);
+    auto v1649 = Sub(v1471, v1473);
+    auto v1650 = Sub(v1475, v1477);
+    auto v1651_tmp = MulFixedPoint15(v1650, Set(d16, 2808));
+    auto v1651 = Add(v1651_tmp, v1650);
+    auto v1652 = Add(v1649, v1651);
+    auto v1653 = Sub(v1461, v1463);
+    auto v1654 = Sub(v1465, v1467);
+    auto v1655_tmp = MulFixedPoint15(v1654, Set(d16, 4586));
+    auto v1655 = Add(v1655_tmp, v1654);
+    auto v1656 = Add(v1653, v1655);
+    auto v1657 = Sub(v1451, v1453);
+    auto v1658 = Sub(v1455, v1457);
+    auto v1659_tmp = MulFixedPoint15(v1658, Set(d16, 6576));
+    auto v1659 = Add(v1659_tmp, v1658);
+    auto v1660 = Add(v1657, v1659);
+    auto v1661 = Sub(v1441, v1443);
+    auto v1662 = Sub(v1445, v1447);
+    auto v1663_tmp = MulFixedPoint15(v1662, Set(d16, 8817));
+    auto v1663 = Add(v1663_tmp, v1662);
+    auto v1664 = Add(v1661, v1663);
+    auto v1665 = Sub(v1422, v1427);
+    auto v1666 = Sub(v1432, v1437);
+    auto v1667_tmp = MulFixedPoint15(v1666, Set(d16, 11356));
+    auto v1667 = Add(v1667_tmp, v1666);
+    auto v1668 = Add(v1665, v1667);
+    auto v1669 = Sub(v1400, v1405);
+    auto v1670 = Sub(v1410, v1415);
+    auto v1671_tmp = MulFixedPoint15(v1670, Set(d16, 14256));
+    auto v1671 = Add(v1671_tmp, v1670);
+    auto v1672 = Add(v1669, v1671);
+    auto v1673 = Sub(v1378, v1383);
+    auto v1674 = Sub(v1388, v1393);
+    auto v1675_tmp = MulFixedPoint15(v1674, Set(d16, 17596));
+    auto v1675 = Add(v1675_tmp, v1674);
+    auto v1676 = Add(v1673, v1675);
+    auto v1677 = Sub(v1356, v1361);
+    auto v1678 = Sub(v1366, v1371);
+    auto v1679_tmp = MulFixedPoint15(v1678, Set(d16, 21483));
+    auto v1679 = Add(v1679_tmp, v1678);
+    auto v1680 = Add(v1677, v1679);
+    auto v1681 = Sub(v1334, v1339);
+    auto v1682 = Sub(v1344, v1349);
+    auto v1683_tmp = MulFixedPoint15(v1682, Set(d16, 26057));
+    auto v1683 = Add(v1683_tmp, v1682);
+    auto v1684 = Add(v1681, v1683);
+    auto v1685 = Sub(v1312, v1317);
+    auto v1686 = Sub(v1322, v1327);
+    auto v1687_tmp = MulFixedPoint15(v1686, Set(d16, 31517));
+    auto v1687 = Add(v1687_tmp, v1686);
+    auto v1688 = Add(v1685, v1687);
+    auto v1689 = Sub(v1290, v1295);
+    auto v1690 = Sub(v1300, v1305);
+    auto v1691_tmp = MulFixedPoint15(v1690, Set(d16, 5373));
+    auto v1691 = Add(v1691_tmp, Mul(v1690, Set(d16, 2)));
+    auto v1692 = Add(v1689, v1691);
+    auto v1693 = Sub(v1268, v1273);
+    auto v1694 = Sub(v1278, v1283);
+    auto v1695_tmp = MulFixedPoint15(v1694, Set(d16, 13571));
+    auto v1695 = Add(v1695_tmp, Mul(v1694, Set(d16, 2)));
+    auto v1696 = Add(v1693, v1695);
+    auto v1697 = Sub(v1228, v1239);
+    auto v1698 = Sub(v1250, v1261);
+    auto v1699_tmp = MulFixedPoint15(v1698, Set(d16, 23975));
+    auto v1699 = Add(v1699_tmp, Mul(v1698, Set(d16, 2)));
+    auto v1700 = Add(v1697, v1699);
+    auto v1701 = Sub(v1182, v1193);
+    auto v1702 = Sub(v1204, v1215);
+    auto v1703_tmp = MulFixedPoint15(v1702, Set(d16, 4832));
+    auto v1703 = Add(v1703_tmp, Mul(v1702, Set(d16, 3)));
+    auto v1704 = Add(v1701, v1703);
+    auto v1705 = Sub(v1136, v1147);
+    auto v1706 = Sub(v1158, v1169);
+    auto v1707_tmp = MulFixedPoint15(v1706, Set(d16, 23437));
+    auto v1707 = Add(v1707_tmp, Mul(v1706, Set(d16, 3)));
+    auto v1708 = Add(v1705, v1707);
+    auto v1709 = Sub(v1090, v1101);
+    auto v1710 = Sub(v1112, v1123);
+    auto v1711_tmp = MulFixedPoint15(v1710, Set(d16, 17573));
+    auto v1711 = Add(v1711_tmp, Mul(v1710, Set(d16, 4)));
+    auto v1712 = Add(v1709, v1711);
+    auto v1713 = Sub(v1008, v1031);
+    auto v1714 = Sub(v1054, v1077);
+    auto v1715_tmp = MulFixedPoint15(v1714, Set(d16, 27122));
+    auto v1715 = Add(v1715_tmp, Mul(v1714, Set(d16, 5)));
+    auto v1716 = Add(v1713, v1715);
+    auto v1717 = Sub(v913, v937);
+    auto v1718 = Sub(v960, v983);
+    auto v1719_tmp = MulFixedPoint15(v1718, Set(d16, 5041));
+    auto v1719 = Add(v1719_tmp, Mul(v1718, Set(d16, 8)));
+    auto v1720 = Add(v1717, v1719);
+    auto v1721 = Sub(v747, v794);
+    auto v1722 = Sub(v841, v888);
+    auto v1723_tmp = MulFixedPoint15(v1722, Set(d16, 19146));
+    auto v1723 = Add(v1723_tmp, Mul(v1722, Set(d16, 13)));
+    auto v1724 = Add(v1721, v1723);
+    auto v1725 = Sub(v141, v316);
+    auto v1726 = Sub(v522, v698);
+    auto v1727_tmp = MulFixedPoint15(v1726, Set(d16, 24402));
+    auto v1727 = Add(v1727_tmp, Mul(v1726, Set(d16, 40)));
+    auto v1728 = Add(v1725, v1727);
+    auto v1729 = Sub(v1725, v1727);
+    auto v1730 = Sub(v1721, v1723);
+    auto v1731 = Sub(v1717, v1719);
+    auto v1732 = Sub(v1713, v1715);
+    auto v1733 = Sub(v1709, v1711);
+    auto v1734 = Sub(v1705, v1707);
+    auto v1735 = Sub(v1701, v1703);
+    auto v1736 = Sub(v1697, v1699);
+    auto v1737 = Sub(v1693, v1695);
+    auto v1738 = Sub(v1689, v1691);
+    auto v1739 = Sub(v1685, v1687);
+    auto v1740 = Sub(v1681, v1683);
+    auto v1741 = Sub(v1677, v1679);
+    auto v1742 = Sub(v1673, v1675);
+    auto v1743 = Sub(v1669, v1671);
+    auto v1744 = Sub(v1665, v1667);
+    auto v1745 = Sub(v1661, v1663);
+    auto v1746 = Sub(v1657, v1659);
+    auto v1747 = Sub(v1653, v1655);
+    auto v1748 = Sub(v1649, v1651);
+    auto v1749 = Sub(v1645, v1647);
+    auto v1750 = Sub(v1641, v1643);
+    auto v1751 = Sub(v1637, v1639);
+    auto v1752 = Sub(v1633, v1635);
+    auto v1753 = Sub(v1629, v1631);
+    auto v1754 = Sub(v1625, v1627);
+    auto v1755 = Sub(v1621, v1623);
+    auto v1756 = Sub(v1617, v1619);
+    auto v1757 = Sub(v1613, v1615);
+    auto v1758 = Sub(v1609, v1611);
+    auto v1759 = Sub(v1605, v1607);
+    auto v1760 = Sub(v1601, v1603);
+    auto v1761 = Sub(v1594, v1599);
+    auto v1762 = Sub(v1584, v1589);
+    auto v1763 = Sub(v1574, v1579);
+    auto v1764 = Sub(v1564, v1569);
+    auto v1765 = Sub(v1554, v1559);
+    auto v1766 = Sub(v1544, v1549);
+    auto v1767 = Sub(v1534, v1539);
+    auto v1768 = Sub(v1524, v1529);
+    auto v1769 = Sub(v1514, v1519);
+    auto v1770 = Sub(v1504, v1509);
+    auto v1771 = Sub(v1494, v1499);
+    auto v1772 = Sub(v1484, v1489);
+    auto v1773 = Sub(v1474, v1479);
+    auto v1774 = Sub(v1464, v1469);
+    auto v1775 = Sub(v1454, v1459);
+    auto v1776 = Sub(v1444, v1449);
+    auto v1777 = Sub(v1428, v1439);
+    auto v1778 = Sub(v1406, v1417);
+    auto v1779 = Sub(v1384, v1395);
+    auto v1780 = Sub(v1362, v1373);
+    auto v1781 = Sub(v1340, v1351);
+    auto v1782 = Sub(v1318, v1329);
+    auto v1783 = Sub(v1296, v1307);
+    auto v1784 = Sub(v1274, v1285);
+    auto v1785 = Sub(v1240, v1263);
+    auto v1786 = Sub(v1194, v1217);
+    auto v1787 = Sub(v1148, v1171);
+    auto v1788 = Sub(v1102, v1125);
+    auto v1789 = Sub(v1032, v1079);
+    auto v1790 = Sub(v938, v985);
+    auto v1791 = Sub(v795, v890);
+    auto v1792 = Sub(v317, v700);
+    StoreU(v701, d16, out + out_stride * 0 + i);
+    StoreU(v891, d16, out + out_stride * 1 + i);
+    StoreU(v986, d16, out + out_stride * 2 + i);
+    StoreU(v1080, d16, out + out_stride * 3 + i);
+    StoreU(v1126, d16, out + out_stride * 4 + i);
+    StoreU(v1172, d16, out + out_stride * 5 + i);
+    StoreU(v1218, d16, out + out_stride * 6 + i);
+    StoreU(v1264, d16, out + out_stride * 7 + i);
+    StoreU(v1286, d16, out + out_stride * 8 + i);
+    StoreU(v1308, d16, out + out_stride * 9 + i);
+    StoreU(v1330, d16, out + out_stride * 10 + i);
+    StoreU(v1352, d16, out + out_stride * 11 + i);
+    StoreU(v1374, d16, out + out_stride * 12 + i);
+    StoreU(v1396, d16, out + out_stride * 13 + i);
+    StoreU(v1418, d16, out + out_stride * 14 + i);
+    StoreU(v1440, d16, out + out_stride * 15 + i);
+    StoreU(v1450, d16, out + out_stride * 16 + i);
+    StoreU(v1460, d16, out + out_stride * 17 + i);
+    StoreU(v1470, d16, out + out_stride * 18 + i);
+    StoreU(v1480, d16, out + out_stride * 19 + i);
+    StoreU(v1490, d16, out + out_stride * 20 + i);
+    StoreU(v1500, d16, out + out_stride * 21 + i);
+    StoreU(v1510, d16, out + out_stride * 22 + i);
+    StoreU(v1520, d16, out + out_stride * 23 + i);
+    StoreU(v1530, d16, out + out_stride * 24 + i);
+    StoreU(v1540, d16, out + out_stride * 25 + i);
+    StoreU(v1550, d16, out + out_stride * 26 + i);
+    StoreU(v1560, d16, out + out_stride * 27 + i);
+    StoreU(v1570, d16, out + out_stride * 28 + i);
+    StoreU(v1580, d16, out + out_stride * 29 + i);
+    StoreU(v1590, d16, out + out_stride * 30 + i);
+    StoreU(v1600, d16, out + out_stride * 31 + i);
+    StoreU(v1604, d16, out + out_stride * 32 + i);
+    StoreU(v1608, d16, out + out_stride * 33 + i);
+    StoreU(v1612, d16, out + out_stride * 34 + i);
+    StoreU(v1616, d16, out + out_stride * 35 + i);
+    StoreU(v1620, d16, out + out_stride * 36 + i);
+    StoreU(v1624, d16, out + out_stride * 37 + i);
+    StoreU(v1628, d16, out + out_stride * 38 + i);
+    StoreU(v1632, d16, out + out_stride * 39 + i);
+    StoreU(v1636, d16, out + out_stride * 40 + i);
+    StoreU(v1640, d16, out + out_stride * 41 + i);
+    StoreU(v1644, d16, out + out_stride * 42 + i);
+    StoreU(v1648, d16, out + out_stride * 43 + i);
+    StoreU(v1652, d16, out + out_stride * 44 + i);
+    StoreU(v1656, d16, out + out_stride * 45 + i);
+    StoreU(v1660, d16, out + out_stride * 46 + i);
+    StoreU(v1664, d16, out + out_stride * 47 + i);
+    StoreU(v1668, d16, out + out_stride * 48 + i);
+    StoreU(v1672, d16, out + out_stride * 49 + i);
+    StoreU(v1676, d16, out + out_stride * 50 + i);
+    StoreU(v1680, d16, out + out_stride * 51 + i);
+    StoreU(v1684, d16, out + out_stride * 52 + i);
+    StoreU(v1688, d16, out + out_stride * 53 + i);
+    StoreU(v1692, d16, out + out_stride * 54 + i);
+    StoreU(v1696, d16, out + out_stride * 55 + i);
+    StoreU(v1700, d16, out + out_stride * 56 + i);
+    StoreU(v1704, d16, out + out_stride * 57 + i);
+    StoreU(v1708, d16, out + out_stride * 58 + i);
+    StoreU(v1712, d16, out + out_stride * 59 + i);
+    StoreU(v1716, d16, out + out_stride * 60 + i);
+    StoreU(v1720, d16, out + out_stride * 61 + i);
+    StoreU(v1724, d16, out + out_stride * 62 + i);
+    StoreU(v1728, d16, out + out_stride * 63 + i);
+    StoreU(v1729, d16, out + out_stride * 64 + i);
+    StoreU(v1730, d16, out + out_stride * 65 + i);
+    StoreU(v1731, d16, out + out_stride * 66 + i);
+    StoreU(v1732, d16, out + out_stride * 67 + i);
+    StoreU(v1733, d16, out + out_stride * 68 + i);
+    StoreU(v1734, d16, out + out_stride * 69 + i);
+    StoreU(v1735, d16, out + out_stride * 70 + i);
+    StoreU(v1736, d16, out + out_stride * 71 + i);
+    StoreU(v1737, d16, out + out_stride * 72 + i);
+    StoreU(v1738, d16, out + out_stride * 73 + i);
+    StoreU(v1739, d16, out + out_stride * 74 + i);
+    StoreU(v1740, d16, out + out_stride * 75 + i);
+    StoreU(v1741, d16, out + out_stride * 76 + i);
+    StoreU(v1742, d16, out + out_stride * 77 + i);
+    StoreU(v1743, d16, out + out_stride * 78 + i);
+    StoreU(v1744, d16, out + out_stride * 79 + i);
+    StoreU(v1745, d16, out + out_stride * 80 + i);
+    StoreU(v1746, d16, out + out_stride * 81 + i);
+    StoreU(v1747, d16, out + out_stride * 82 + i);
+    StoreU(v1748, d16, out + out_stride * 83 + i);
+    StoreU(v1749, d16, out + out_stride * 84 + i);
+    StoreU(v1750, d16, out + out_stride * 85 + i);
+    StoreU(v1751, d16, out + out_stride * 86 + i);
+    StoreU(v1752, d16, out + out_stride * 87 + i);
+    StoreU(v1753, d16, out + out_stride * 88 + i);
+    StoreU(v1754, d16, out + out_stride * 89 + i);
+    StoreU(v1755, d16, out + out_stride * 90 + i);
+    StoreU(v1756, d16, out + out_stride * 91 + i);
+    StoreU(v1757, d16, out + out_stride * 92 + i);
+    StoreU(v1758, d16, out + out_stride * 93 + i);
+    StoreU(v1759, d16, out + out_stride * 94 + i);
+    StoreU(v1760, d16, out + out_stride * 95 + i);
+    StoreU(v1761, d16, out + out_stride * 96 + i);
+    StoreU(v1762, d16, out + out_stride * 97 + i);
+    StoreU(v1763, d16, out + out_stride * 98 + i);
+    StoreU(v1764, d16, out + out_stride * 99 + i);
+    StoreU(v1765, d16, out + out_stride * 100 + i);
+    StoreU(v1766, d16, out + out_stride * 101 + i);
+    StoreU(v1767, d16, out + out_stride * 102 + i);
+    StoreU(v1768, d16, out + out_stride * 103 + i);
+    StoreU(v1769, d16, out + out_stride * 104 + i);
+    StoreU(v1770, d16, out + out_stride * 105 + i);
+    StoreU(v1771, d16, out + out_stride * 106 + i);
+    StoreU(v1772, d16, out + out_stride * 107 + i);
+    StoreU(v1773, d16, out + out_stride * 108 + i);
+    StoreU(v1774, d16, out + out_stride * 109 + i);
+    StoreU(v1775, d16, out + out_stride * 110 + i);
+    StoreU(v1776, d16, out + out_stride * 111 + i);
+    StoreU(v1777, d16, out + out_stride * 112 + i);
+    StoreU(v1778, d16, out + out_stride * 113 + i);
+    StoreU(v1779, d16, out + out_stride * 114 + i);
+    StoreU(v1780, d16, out + out_stride * 115 + i);
+    StoreU(v1781, d16, out + out_stride * 116 + i);
+    StoreU(v1782, d16, out + out_stride * 117 + i);
+    StoreU(v1783, d16, out + out_stride * 118 + i);
+    StoreU(v1784, d16, out + out_stride * 119 + i);
+    StoreU(v1785, d16, out + out_stride * 120 + i);
+    StoreU(v1786, d16, out + out_stride * 121 + i);
+    StoreU(v1787, d16, out + out_stride * 122 + i);
+    StoreU(v1788, d16, out + out_stride * 123 + i);
+    StoreU(v1789, d16, out + out_stride * 124 + i);
+    StoreU(v1790, d16, out + out_stride * 125 + i);
+    StoreU(v1791, d16, out + out_stride * 126 + i);
+    StoreU(v1792, d16, out + out_stride * 127 + i);
   }
 }
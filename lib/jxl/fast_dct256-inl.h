@@ -3,4809 +3,4809 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
-/* This file is automatically generated. Do not modify it directly. */
-#if HWY_TARGET != HWY_NEON
-#error "only include this file from fast_dct-inl.h"
-#endif
+// Fixed-point IDCT of size 256, only meant to be included by
+// fast_dct_testonly-inl.h.
 
 constexpr size_t FastIDCTIntegerBits(FastDCTTag<256>) { return 3; }
 
-void FastIDCT(FastDCTTag<256>, const int16_t* in, size_t in_stride,
-              int16_t* out, size_t out_stride, size_t count) {
+HWY_MAYBE_UNUSED void FastIDCT(FastDCTTag<256>, const int16_t* in,
+                               size_t in_stride, int16_t* out,
+                               size_t out_stride, size_t count) {
   JXL_ASSERT(count % 8 == 0);
-  for (size_t i = 0; i < count; i += 8) {
-    int16x8_t v0 = vld1q_s16(in + in_stride * 0 + i);
-    int16x8_t v1 = vld1q_s16(in + in_stride * 128 + i);
-    int16x8_t v2 = vaddq_s16(v0, v1);
-    int16x8_t v3 = vld1q_s16(in + in_stride * 64 + i);
-    int16x8_t v4_tmp = vqrdmulhq_n_s16(v3, 13573);
-    int16x8_t v4 = vaddq_s16(v4_tmp, v3);
-    int16x8_t v5 = vld1q_s16(in + in_stride * 192 + i);
-    int16x8_t v6 = vaddq_s16(v5, v3);
-    int16x8_t v7 = vaddq_s16(v4, v6);
-    int16x8_t v8 = vqrdmulhq_n_s16(v7, 17734);
-    int16x8_t v9 = vaddq_s16(v2, v8);
-    int16x8_t v10 = vld1q_s16(in + in_stride * 32 + i);
-    int16x8_t v11_tmp = vqrdmulhq_n_s16(v10, 13573);
-    int16x8_t v11 = vaddq_s16(v11_tmp, v10);
-    int16x8_t v12 = vld1q_s16(in + in_stride * 160 + i);
-    int16x8_t v13 = vld1q_s16(in + in_stride * 96 + i);
-    int16x8_t v14 = vaddq_s16(v12, v13);
-    int16x8_t v15 = vaddq_s16(v11, v14);
-    int16x8_t v16 = vaddq_s16(v13, v10);
-    int16x8_t v17_tmp = vqrdmulhq_n_s16(v16, 13573);
-    int16x8_t v17 = vaddq_s16(v17_tmp, v16);
-    int16x8_t v18 = vld1q_s16(in + in_stride * 224 + i);
-    int16x8_t v19 = vaddq_s16(v18, v12);
-    int16x8_t v20 = vaddq_s16(v19, v16);
-    int16x8_t v21 = vaddq_s16(v17, v20);
-    int16x8_t v22 = vqrdmulhq_n_s16(v21, 17734);
-    int16x8_t v23 = vaddq_s16(v15, v22);
-    int16x8_t v24 = vqrdmulhq_n_s16(v23, 16705);
-    int16x8_t v25 = vaddq_s16(v9, v24);
-    int16x8_t v26 = vld1q_s16(in + in_stride * 16 + i);
-    int16x8_t v27_tmp = vqrdmulhq_n_s16(v26, 13573);
-    int16x8_t v27 = vaddq_s16(v27_tmp, v26);
-    int16x8_t v28 = vld1q_s16(in + in_stride * 144 + i);
-    int16x8_t v29 = vld1q_s16(in + in_stride * 112 + i);
-    int16x8_t v30 = vaddq_s16(v28, v29);
-    int16x8_t v31 = vaddq_s16(v27, v30);
-    int16x8_t v32 = vld1q_s16(in + in_stride * 80 + i);
-    int16x8_t v33 = vld1q_s16(in + in_stride * 48 + i);
-    int16x8_t v34 = vaddq_s16(v32, v33);
-    int16x8_t v35_tmp = vqrdmulhq_n_s16(v34, 13573);
-    int16x8_t v35 = vaddq_s16(v35_tmp, v34);
-    int16x8_t v36 = vld1q_s16(in + in_stride * 208 + i);
-    int16x8_t v37 = vld1q_s16(in + in_stride * 176 + i);
-    int16x8_t v38 = vaddq_s16(v36, v37);
-    int16x8_t v39 = vaddq_s16(v38, v34);
-    int16x8_t v40 = vaddq_s16(v35, v39);
-    int16x8_t v41 = vqrdmulhq_n_s16(v40, 17734);
-    int16x8_t v42 = vaddq_s16(v31, v41);
-    int16x8_t v43 = vaddq_s16(v33, v26);
-    int16x8_t v44_tmp = vqrdmulhq_n_s16(v43, 13573);
-    int16x8_t v44 = vaddq_s16(v44_tmp, v43);
-    int16x8_t v45 = vaddq_s16(v37, v28);
-    int16x8_t v46 = vaddq_s16(v29, v32);
-    int16x8_t v47 = vaddq_s16(v45, v46);
-    int16x8_t v48 = vaddq_s16(v44, v47);
-    int16x8_t v49 = vaddq_s16(v46, v43);
-    int16x8_t v50_tmp = vqrdmulhq_n_s16(v49, 13573);
-    int16x8_t v50 = vaddq_s16(v50_tmp, v49);
-    int16x8_t v51 = vld1q_s16(in + in_stride * 240 + i);
-    int16x8_t v52 = vaddq_s16(v51, v36);
-    int16x8_t v53 = vaddq_s16(v52, v45);
-    int16x8_t v54 = vaddq_s16(v53, v49);
-    int16x8_t v55 = vaddq_s16(v50, v54);
-    int16x8_t v56 = vqrdmulhq_n_s16(v55, 17734);
-    int16x8_t v57 = vaddq_s16(v48, v56);
-    int16x8_t v58 = vqrdmulhq_n_s16(v57, 16705);
-    int16x8_t v59 = vaddq_s16(v42, v58);
-    int16x8_t v60 = vqrdmulhq_n_s16(v59, 16463);
-    int16x8_t v61 = vaddq_s16(v25, v60);
-    int16x8_t v62 = vld1q_s16(in + in_stride * 8 + i);
-    int16x8_t v63_tmp = vqrdmulhq_n_s16(v62, 13573);
-    int16x8_t v63 = vaddq_s16(v63_tmp, v62);
-    int16x8_t v64 = vld1q_s16(in + in_stride * 136 + i);
-    int16x8_t v65 = vld1q_s16(in + in_stride * 120 + i);
-    int16x8_t v66 = vaddq_s16(v64, v65);
-    int16x8_t v67 = vaddq_s16(v63, v66);
-    int16x8_t v68 = vld1q_s16(in + in_stride * 72 + i);
-    int16x8_t v69 = vld1q_s16(in + in_stride * 56 + i);
-    int16x8_t v70 = vaddq_s16(v68, v69);
-    int16x8_t v71_tmp = vqrdmulhq_n_s16(v70, 13573);
-    int16x8_t v71 = vaddq_s16(v71_tmp, v70);
-    int16x8_t v72 = vld1q_s16(in + in_stride * 200 + i);
-    int16x8_t v73 = vld1q_s16(in + in_stride * 184 + i);
-    int16x8_t v74 = vaddq_s16(v72, v73);
-    int16x8_t v75 = vaddq_s16(v74, v70);
-    int16x8_t v76 = vaddq_s16(v71, v75);
-    int16x8_t v77 = vqrdmulhq_n_s16(v76, 17734);
-    int16x8_t v78 = vaddq_s16(v67, v77);
-    int16x8_t v79 = vld1q_s16(in + in_stride * 40 + i);
-    int16x8_t v80 = vld1q_s16(in + in_stride * 24 + i);
-    int16x8_t v81 = vaddq_s16(v79, v80);
-    int16x8_t v82_tmp = vqrdmulhq_n_s16(v81, 13573);
-    int16x8_t v82 = vaddq_s16(v82_tmp, v81);
-    int16x8_t v83 = vld1q_s16(in + in_stride * 168 + i);
-    int16x8_t v84 = vld1q_s16(in + in_stride * 152 + i);
-    int16x8_t v85 = vaddq_s16(v83, v84);
-    int16x8_t v86 = vld1q_s16(in + in_stride * 104 + i);
-    int16x8_t v87 = vld1q_s16(in + in_stride * 88 + i);
-    int16x8_t v88 = vaddq_s16(v86, v87);
-    int16x8_t v89 = vaddq_s16(v85, v88);
-    int16x8_t v90 = vaddq_s16(v82, v89);
-    int16x8_t v91 = vaddq_s16(v88, v81);
-    int16x8_t v92_tmp = vqrdmulhq_n_s16(v91, 13573);
-    int16x8_t v92 = vaddq_s16(v92_tmp, v91);
-    int16x8_t v93 = vld1q_s16(in + in_stride * 232 + i);
-    int16x8_t v94 = vld1q_s16(in + in_stride * 216 + i);
-    int16x8_t v95 = vaddq_s16(v93, v94);
-    int16x8_t v96 = vaddq_s16(v95, v85);
-    int16x8_t v97 = vaddq_s16(v96, v91);
-    int16x8_t v98 = vaddq_s16(v92, v97);
-    int16x8_t v99 = vqrdmulhq_n_s16(v98, 17734);
-    int16x8_t v100 = vaddq_s16(v90, v99);
-    int16x8_t v101 = vqrdmulhq_n_s16(v100, 16705);
-    int16x8_t v102 = vaddq_s16(v78, v101);
-    int16x8_t v103 = vaddq_s16(v80, v62);
-    int16x8_t v104_tmp = vqrdmulhq_n_s16(v103, 13573);
-    int16x8_t v104 = vaddq_s16(v104_tmp, v103);
-    int16x8_t v105 = vaddq_s16(v84, v64);
-    int16x8_t v106 = vaddq_s16(v65, v86);
-    int16x8_t v107 = vaddq_s16(v105, v106);
-    int16x8_t v108 = vaddq_s16(v104, v107);
-    int16x8_t v109 = vaddq_s16(v87, v68);
-    int16x8_t v110 = vaddq_s16(v69, v79);
-    int16x8_t v111 = vaddq_s16(v109, v110);
-    int16x8_t v112_tmp = vqrdmulhq_n_s16(v111, 13573);
-    int16x8_t v112 = vaddq_s16(v112_tmp, v111);
-    int16x8_t v113 = vaddq_s16(v94, v72);
-    int16x8_t v114 = vaddq_s16(v73, v83);
-    int16x8_t v115 = vaddq_s16(v113, v114);
-    int16x8_t v116 = vaddq_s16(v115, v111);
-    int16x8_t v117 = vaddq_s16(v112, v116);
-    int16x8_t v118 = vqrdmulhq_n_s16(v117, 17734);
-    int16x8_t v119 = vaddq_s16(v108, v118);
-    int16x8_t v120 = vaddq_s16(v110, v103);
-    int16x8_t v121_tmp = vqrdmulhq_n_s16(v120, 13573);
-    int16x8_t v121 = vaddq_s16(v121_tmp, v120);
-    int16x8_t v122 = vaddq_s16(v114, v105);
-    int16x8_t v123 = vaddq_s16(v106, v109);
-    int16x8_t v124 = vaddq_s16(v122, v123);
-    int16x8_t v125 = vaddq_s16(v121, v124);
-    int16x8_t v126 = vaddq_s16(v123, v120);
-    int16x8_t v127_tmp = vqrdmulhq_n_s16(v126, 13573);
-    int16x8_t v127 = vaddq_s16(v127_tmp, v126);
-    int16x8_t v128 = vld1q_s16(in + in_stride * 248 + i);
-    int16x8_t v129 = vaddq_s16(v128, v93);
-    int16x8_t v130 = vaddq_s16(v129, v113);
-    int16x8_t v131 = vaddq_s16(v130, v122);
-    int16x8_t v132 = vaddq_s16(v131, v126);
-    int16x8_t v133 = vaddq_s16(v127, v132);
-    int16x8_t v134 = vqrdmulhq_n_s16(v133, 17734);
-    int16x8_t v135 = vaddq_s16(v125, v134);
-    int16x8_t v136 = vqrdmulhq_n_s16(v135, 16705);
-    int16x8_t v137 = vaddq_s16(v119, v136);
-    int16x8_t v138 = vqrdmulhq_n_s16(v137, 16463);
-    int16x8_t v139 = vaddq_s16(v102, v138);
-    int16x8_t v140 = vqrdmulhq_n_s16(v139, 16404);
-    int16x8_t v141 = vaddq_s16(v61, v140);
-    int16x8_t v142 = vld1q_s16(in + in_stride * 4 + i);
-    int16x8_t v143_tmp = vqrdmulhq_n_s16(v142, 13573);
-    int16x8_t v143 = vaddq_s16(v143_tmp, v142);
-    int16x8_t v144 = vld1q_s16(in + in_stride * 132 + i);
-    int16x8_t v145 = vld1q_s16(in + in_stride * 124 + i);
-    int16x8_t v146 = vaddq_s16(v144, v145);
-    int16x8_t v147 = vaddq_s16(v143, v146);
-    int16x8_t v148 = vld1q_s16(in + in_stride * 68 + i);
-    int16x8_t v149 = vld1q_s16(in + in_stride * 60 + i);
-    int16x8_t v150 = vaddq_s16(v148, v149);
-    int16x8_t v151_tmp = vqrdmulhq_n_s16(v150, 13573);
-    int16x8_t v151 = vaddq_s16(v151_tmp, v150);
-    int16x8_t v152 = vld1q_s16(in + in_stride * 196 + i);
-    int16x8_t v153 = vld1q_s16(in + in_stride * 188 + i);
-    int16x8_t v154 = vaddq_s16(v152, v153);
-    int16x8_t v155 = vaddq_s16(v154, v150);
-    int16x8_t v156 = vaddq_s16(v151, v155);
-    int16x8_t v157 = vqrdmulhq_n_s16(v156, 17734);
-    int16x8_t v158 = vaddq_s16(v147, v157);
-    int16x8_t v159 = vld1q_s16(in + in_stride * 36 + i);
-    int16x8_t v160 = vld1q_s16(in + in_stride * 28 + i);
-    int16x8_t v161 = vaddq_s16(v159, v160);
-    int16x8_t v162_tmp = vqrdmulhq_n_s16(v161, 13573);
-    int16x8_t v162 = vaddq_s16(v162_tmp, v161);
-    int16x8_t v163 = vld1q_s16(in + in_stride * 164 + i);
-    int16x8_t v164 = vld1q_s16(in + in_stride * 156 + i);
-    int16x8_t v165 = vaddq_s16(v163, v164);
-    int16x8_t v166 = vld1q_s16(in + in_stride * 100 + i);
-    int16x8_t v167 = vld1q_s16(in + in_stride * 92 + i);
-    int16x8_t v168 = vaddq_s16(v166, v167);
-    int16x8_t v169 = vaddq_s16(v165, v168);
-    int16x8_t v170 = vaddq_s16(v162, v169);
-    int16x8_t v171 = vaddq_s16(v168, v161);
-    int16x8_t v172_tmp = vqrdmulhq_n_s16(v171, 13573);
-    int16x8_t v172 = vaddq_s16(v172_tmp, v171);
-    int16x8_t v173 = vld1q_s16(in + in_stride * 228 + i);
-    int16x8_t v174 = vld1q_s16(in + in_stride * 220 + i);
-    int16x8_t v175 = vaddq_s16(v173, v174);
-    int16x8_t v176 = vaddq_s16(v175, v165);
-    int16x8_t v177 = vaddq_s16(v176, v171);
-    int16x8_t v178 = vaddq_s16(v172, v177);
-    int16x8_t v179 = vqrdmulhq_n_s16(v178, 17734);
-    int16x8_t v180 = vaddq_s16(v170, v179);
-    int16x8_t v181 = vqrdmulhq_n_s16(v180, 16705);
-    int16x8_t v182 = vaddq_s16(v158, v181);
-    int16x8_t v183 = vld1q_s16(in + in_stride * 20 + i);
-    int16x8_t v184 = vld1q_s16(in + in_stride * 12 + i);
-    int16x8_t v185 = vaddq_s16(v183, v184);
-    int16x8_t v186_tmp = vqrdmulhq_n_s16(v185, 13573);
-    int16x8_t v186 = vaddq_s16(v186_tmp, v185);
-    int16x8_t v187 = vld1q_s16(in + in_stride * 148 + i);
-    int16x8_t v188 = vld1q_s16(in + in_stride * 140 + i);
-    int16x8_t v189 = vaddq_s16(v187, v188);
-    int16x8_t v190 = vld1q_s16(in + in_stride * 116 + i);
-    int16x8_t v191 = vld1q_s16(in + in_stride * 108 + i);
-    int16x8_t v192 = vaddq_s16(v190, v191);
-    int16x8_t v193 = vaddq_s16(v189, v192);
-    int16x8_t v194 = vaddq_s16(v186, v193);
-    int16x8_t v195 = vld1q_s16(in + in_stride * 84 + i);
-    int16x8_t v196 = vld1q_s16(in + in_stride * 76 + i);
-    int16x8_t v197 = vaddq_s16(v195, v196);
-    int16x8_t v198 = vld1q_s16(in + in_stride * 52 + i);
-    int16x8_t v199 = vld1q_s16(in + in_stride * 44 + i);
-    int16x8_t v200 = vaddq_s16(v198, v199);
-    int16x8_t v201 = vaddq_s16(v197, v200);
-    int16x8_t v202_tmp = vqrdmulhq_n_s16(v201, 13573);
-    int16x8_t v202 = vaddq_s16(v202_tmp, v201);
-    int16x8_t v203 = vld1q_s16(in + in_stride * 212 + i);
-    int16x8_t v204 = vld1q_s16(in + in_stride * 204 + i);
-    int16x8_t v205 = vaddq_s16(v203, v204);
-    int16x8_t v206 = vld1q_s16(in + in_stride * 180 + i);
-    int16x8_t v207 = vld1q_s16(in + in_stride * 172 + i);
-    int16x8_t v208 = vaddq_s16(v206, v207);
-    int16x8_t v209 = vaddq_s16(v205, v208);
-    int16x8_t v210 = vaddq_s16(v209, v201);
-    int16x8_t v211 = vaddq_s16(v202, v210);
-    int16x8_t v212 = vqrdmulhq_n_s16(v211, 17734);
-    int16x8_t v213 = vaddq_s16(v194, v212);
-    int16x8_t v214 = vaddq_s16(v200, v185);
-    int16x8_t v215_tmp = vqrdmulhq_n_s16(v214, 13573);
-    int16x8_t v215 = vaddq_s16(v215_tmp, v214);
-    int16x8_t v216 = vaddq_s16(v208, v189);
-    int16x8_t v217 = vaddq_s16(v192, v197);
-    int16x8_t v218 = vaddq_s16(v216, v217);
-    int16x8_t v219 = vaddq_s16(v215, v218);
-    int16x8_t v220 = vaddq_s16(v217, v214);
-    int16x8_t v221_tmp = vqrdmulhq_n_s16(v220, 13573);
-    int16x8_t v221 = vaddq_s16(v221_tmp, v220);
-    int16x8_t v222 = vld1q_s16(in + in_stride * 244 + i);
-    int16x8_t v223 = vld1q_s16(in + in_stride * 236 + i);
-    int16x8_t v224 = vaddq_s16(v222, v223);
-    int16x8_t v225 = vaddq_s16(v224, v205);
-    int16x8_t v226 = vaddq_s16(v225, v216);
-    int16x8_t v227 = vaddq_s16(v226, v220);
-    int16x8_t v228 = vaddq_s16(v221, v227);
-    int16x8_t v229 = vqrdmulhq_n_s16(v228, 17734);
-    int16x8_t v230 = vaddq_s16(v219, v229);
-    int16x8_t v231 = vqrdmulhq_n_s16(v230, 16705);
-    int16x8_t v232 = vaddq_s16(v213, v231);
-    int16x8_t v233 = vqrdmulhq_n_s16(v232, 16463);
-    int16x8_t v234 = vaddq_s16(v182, v233);
-    int16x8_t v235 = vaddq_s16(v184, v142);
-    int16x8_t v236_tmp = vqrdmulhq_n_s16(v235, 13573);
-    int16x8_t v236 = vaddq_s16(v236_tmp, v235);
-    int16x8_t v237 = vaddq_s16(v188, v144);
-    int16x8_t v238 = vaddq_s16(v145, v190);
-    int16x8_t v239 = vaddq_s16(v237, v238);
-    int16x8_t v240 = vaddq_s16(v236, v239);
-    int16x8_t v241 = vaddq_s16(v196, v148);
-    int16x8_t v242 = vaddq_s16(v149, v198);
-    int16x8_t v243 = vaddq_s16(v241, v242);
-    int16x8_t v244_tmp = vqrdmulhq_n_s16(v243, 13573);
-    int16x8_t v244 = vaddq_s16(v244_tmp, v243);
-    int16x8_t v245 = vaddq_s16(v204, v152);
-    int16x8_t v246 = vaddq_s16(v153, v206);
-    int16x8_t v247 = vaddq_s16(v245, v246);
-    int16x8_t v248 = vaddq_s16(v247, v243);
-    int16x8_t v249 = vaddq_s16(v244, v248);
-    int16x8_t v250 = vqrdmulhq_n_s16(v249, 17734);
-    int16x8_t v251 = vaddq_s16(v240, v250);
-    int16x8_t v252 = vaddq_s16(v199, v159);
-    int16x8_t v253 = vaddq_s16(v160, v183);
-    int16x8_t v254 = vaddq_s16(v252, v253);
-    int16x8_t v255_tmp = vqrdmulhq_n_s16(v254, 13573);
-    int16x8_t v255 = vaddq_s16(v255_tmp, v254);
-    int16x8_t v256 = vaddq_s16(v207, v163);
-    int16x8_t v257 = vaddq_s16(v164, v187);
-    int16x8_t v258 = vaddq_s16(v256, v257);
-    int16x8_t v259 = vaddq_s16(v191, v166);
-    int16x8_t v260 = vaddq_s16(v167, v195);
-    int16x8_t v261 = vaddq_s16(v259, v260);
-    int16x8_t v262 = vaddq_s16(v258, v261);
-    int16x8_t v263 = vaddq_s16(v255, v262);
-    int16x8_t v264 = vaddq_s16(v261, v254);
-    int16x8_t v265_tmp = vqrdmulhq_n_s16(v264, 13573);
-    int16x8_t v265 = vaddq_s16(v265_tmp, v264);
-    int16x8_t v266 = vaddq_s16(v223, v173);
-    int16x8_t v267 = vaddq_s16(v174, v203);
-    int16x8_t v268 = vaddq_s16(v266, v267);
-    int16x8_t v269 = vaddq_s16(v268, v258);
-    int16x8_t v270 = vaddq_s16(v269, v264);
-    int16x8_t v271 = vaddq_s16(v265, v270);
-    int16x8_t v272 = vqrdmulhq_n_s16(v271, 17734);
-    int16x8_t v273 = vaddq_s16(v263, v272);
-    int16x8_t v274 = vqrdmulhq_n_s16(v273, 16705);
-    int16x8_t v275 = vaddq_s16(v251, v274);
-    int16x8_t v276 = vaddq_s16(v253, v235);
-    int16x8_t v277_tmp = vqrdmulhq_n_s16(v276, 13573);
-    int16x8_t v277 = vaddq_s16(v277_tmp, v276);
-    int16x8_t v278 = vaddq_s16(v257, v237);
-    int16x8_t v279 = vaddq_s16(v238, v259);
-    int16x8_t v280 = vaddq_s16(v278, v279);
-    int16x8_t v281 = vaddq_s16(v277, v280);
-    int16x8_t v282 = vaddq_s16(v260, v241);
-    int16x8_t v283 = vaddq_s16(v242, v252);
-    int16x8_t v284 = vaddq_s16(v282, v283);
-    int16x8_t v285_tmp = vqrdmulhq_n_s16(v284, 13573);
-    int16x8_t v285 = vaddq_s16(v285_tmp, v284);
-    int16x8_t v286 = vaddq_s16(v267, v245);
-    int16x8_t v287 = vaddq_s16(v246, v256);
-    int16x8_t v288 = vaddq_s16(v286, v287);
-    int16x8_t v289 = vaddq_s16(v288, v284);
-    int16x8_t v290 = vaddq_s16(v285, v289);
-    int16x8_t v291 = vqrdmulhq_n_s16(v290, 17734);
-    int16x8_t v292 = vaddq_s16(v281, v291);
-    int16x8_t v293 = vaddq_s16(v283, v276);
-    int16x8_t v294_tmp = vqrdmulhq_n_s16(v293, 13573);
-    int16x8_t v294 = vaddq_s16(v294_tmp, v293);
-    int16x8_t v295 = vaddq_s16(v287, v278);
-    int16x8_t v296 = vaddq_s16(v279, v282);
-    int16x8_t v297 = vaddq_s16(v295, v296);
-    int16x8_t v298 = vaddq_s16(v294, v297);
-    int16x8_t v299 = vaddq_s16(v296, v293);
-    int16x8_t v300_tmp = vqrdmulhq_n_s16(v299, 13573);
-    int16x8_t v300 = vaddq_s16(v300_tmp, v299);
-    int16x8_t v301 = vld1q_s16(in + in_stride * 252 + i);
-    int16x8_t v302 = vaddq_s16(v301, v222);
-    int16x8_t v303 = vaddq_s16(v302, v266);
-    int16x8_t v304 = vaddq_s16(v303, v286);
-    int16x8_t v305 = vaddq_s16(v304, v295);
-    int16x8_t v306 = vaddq_s16(v305, v299);
-    int16x8_t v307 = vaddq_s16(v300, v306);
-    int16x8_t v308 = vqrdmulhq_n_s16(v307, 17734);
-    int16x8_t v309 = vaddq_s16(v298, v308);
-    int16x8_t v310 = vqrdmulhq_n_s16(v309, 16705);
-    int16x8_t v311 = vaddq_s16(v292, v310);
-    int16x8_t v312 = vqrdmulhq_n_s16(v311, 16463);
-    int16x8_t v313 = vaddq_s16(v275, v312);
-    int16x8_t v314 = vqrdmulhq_n_s16(v313, 16404);
-    int16x8_t v315 = vaddq_s16(v234, v314);
-    int16x8_t v316 = vqrdmulhq_n_s16(v315, 16389);
-    int16x8_t v317 = vaddq_s16(v141, v316);
-    int16x8_t v318 = vld1q_s16(in + in_stride * 2 + i);
-    int16x8_t v319_tmp = vqrdmulhq_n_s16(v318, 13573);
-    int16x8_t v319 = vaddq_s16(v319_tmp, v318);
-    int16x8_t v320 = vld1q_s16(in + in_stride * 130 + i);
-    int16x8_t v321 = vld1q_s16(in + in_stride * 126 + i);
-    int16x8_t v322 = vaddq_s16(v320, v321);
-    int16x8_t v323 = vaddq_s16(v319, v322);
-    int16x8_t v324 = vld1q_s16(in + in_stride * 66 + i);
-    int16x8_t v325 = vld1q_s16(in + in_stride * 62 + i);
-    int16x8_t v326 = vaddq_s16(v324, v325);
-    int16x8_t v327_tmp = vqrdmulhq_n_s16(v326, 13573);
-    int16x8_t v327 = vaddq_s16(v327_tmp, v326);
-    int16x8_t v328 = vld1q_s16(in + in_stride * 194 + i);
-    int16x8_t v329 = vld1q_s16(in + in_stride * 190 + i);
-    int16x8_t v330 = vaddq_s16(v328, v329);
-    int16x8_t v331 = vaddq_s16(v330, v326);
-    int16x8_t v332 = vaddq_s16(v327, v331);
-    int16x8_t v333 = vqrdmulhq_n_s16(v332, 17734);
-    int16x8_t v334 = vaddq_s16(v323, v333);
-    int16x8_t v335 = vld1q_s16(in + in_stride * 34 + i);
-    int16x8_t v336 = vld1q_s16(in + in_stride * 30 + i);
-    int16x8_t v337 = vaddq_s16(v335, v336);
-    int16x8_t v338_tmp = vqrdmulhq_n_s16(v337, 13573);
-    int16x8_t v338 = vaddq_s16(v338_tmp, v337);
-    int16x8_t v339 = vld1q_s16(in + in_stride * 162 + i);
-    int16x8_t v340 = vld1q_s16(in + in_stride * 158 + i);
-    int16x8_t v341 = vaddq_s16(v339, v340);
-    int16x8_t v342 = vld1q_s16(in + in_stride * 98 + i);
-    int16x8_t v343 = vld1q_s16(in + in_stride * 94 + i);
-    int16x8_t v344 = vaddq_s16(v342, v343);
-    int16x8_t v345 = vaddq_s16(v341, v344);
-    int16x8_t v346 = vaddq_s16(v338, v345);
-    int16x8_t v347 = vaddq_s16(v344, v337);
-    int16x8_t v348_tmp = vqrdmulhq_n_s16(v347, 13573);
-    int16x8_t v348 = vaddq_s16(v348_tmp, v347);
-    int16x8_t v349 = vld1q_s16(in + in_stride * 226 + i);
-    int16x8_t v350 = vld1q_s16(in + in_stride * 222 + i);
-    int16x8_t v351 = vaddq_s16(v349, v350);
-    int16x8_t v352 = vaddq_s16(v351, v341);
-    int16x8_t v353 = vaddq_s16(v352, v347);
-    int16x8_t v354 = vaddq_s16(v348, v353);
-    int16x8_t v355 = vqrdmulhq_n_s16(v354, 17734);
-    int16x8_t v356 = vaddq_s16(v346, v355);
-    int16x8_t v357 = vqrdmulhq_n_s16(v356, 16705);
-    int16x8_t v358 = vaddq_s16(v334, v357);
-    int16x8_t v359 = vld1q_s16(in + in_stride * 18 + i);
-    int16x8_t v360 = vld1q_s16(in + in_stride * 14 + i);
-    int16x8_t v361 = vaddq_s16(v359, v360);
-    int16x8_t v362_tmp = vqrdmulhq_n_s16(v361, 13573);
-    int16x8_t v362 = vaddq_s16(v362_tmp, v361);
-    int16x8_t v363 = vld1q_s16(in + in_stride * 146 + i);
-    int16x8_t v364 = vld1q_s16(in + in_stride * 142 + i);
-    int16x8_t v365 = vaddq_s16(v363, v364);
-    int16x8_t v366 = vld1q_s16(in + in_stride * 114 + i);
-    int16x8_t v367 = vld1q_s16(in + in_stride * 110 + i);
-    int16x8_t v368 = vaddq_s16(v366, v367);
-    int16x8_t v369 = vaddq_s16(v365, v368);
-    int16x8_t v370 = vaddq_s16(v362, v369);
-    int16x8_t v371 = vld1q_s16(in + in_stride * 82 + i);
-    int16x8_t v372 = vld1q_s16(in + in_stride * 78 + i);
-    int16x8_t v373 = vaddq_s16(v371, v372);
-    int16x8_t v374 = vld1q_s16(in + in_stride * 50 + i);
-    int16x8_t v375 = vld1q_s16(in + in_stride * 46 + i);
-    int16x8_t v376 = vaddq_s16(v374, v375);
-    int16x8_t v377 = vaddq_s16(v373, v376);
-    int16x8_t v378_tmp = vqrdmulhq_n_s16(v377, 13573);
-    int16x8_t v378 = vaddq_s16(v378_tmp, v377);
-    int16x8_t v379 = vld1q_s16(in + in_stride * 210 + i);
-    int16x8_t v380 = vld1q_s16(in + in_stride * 206 + i);
-    int16x8_t v381 = vaddq_s16(v379, v380);
-    int16x8_t v382 = vld1q_s16(in + in_stride * 178 + i);
-    int16x8_t v383 = vld1q_s16(in + in_stride * 174 + i);
-    int16x8_t v384 = vaddq_s16(v382, v383);
-    int16x8_t v385 = vaddq_s16(v381, v384);
-    int16x8_t v386 = vaddq_s16(v385, v377);
-    int16x8_t v387 = vaddq_s16(v378, v386);
-    int16x8_t v388 = vqrdmulhq_n_s16(v387, 17734);
-    int16x8_t v389 = vaddq_s16(v370, v388);
-    int16x8_t v390 = vaddq_s16(v376, v361);
-    int16x8_t v391_tmp = vqrdmulhq_n_s16(v390, 13573);
-    int16x8_t v391 = vaddq_s16(v391_tmp, v390);
-    int16x8_t v392 = vaddq_s16(v384, v365);
-    int16x8_t v393 = vaddq_s16(v368, v373);
-    int16x8_t v394 = vaddq_s16(v392, v393);
-    int16x8_t v395 = vaddq_s16(v391, v394);
-    int16x8_t v396 = vaddq_s16(v393, v390);
-    int16x8_t v397_tmp = vqrdmulhq_n_s16(v396, 13573);
-    int16x8_t v397 = vaddq_s16(v397_tmp, v396);
-    int16x8_t v398 = vld1q_s16(in + in_stride * 242 + i);
-    int16x8_t v399 = vld1q_s16(in + in_stride * 238 + i);
-    int16x8_t v400 = vaddq_s16(v398, v399);
-    int16x8_t v401 = vaddq_s16(v400, v381);
-    int16x8_t v402 = vaddq_s16(v401, v392);
-    int16x8_t v403 = vaddq_s16(v402, v396);
-    int16x8_t v404 = vaddq_s16(v397, v403);
-    int16x8_t v405 = vqrdmulhq_n_s16(v404, 17734);
-    int16x8_t v406 = vaddq_s16(v395, v405);
-    int16x8_t v407 = vqrdmulhq_n_s16(v406, 16705);
-    int16x8_t v408 = vaddq_s16(v389, v407);
-    int16x8_t v409 = vqrdmulhq_n_s16(v408, 16463);
-    int16x8_t v410 = vaddq_s16(v358, v409);
-    int16x8_t v411 = vld1q_s16(in + in_stride * 10 + i);
-    int16x8_t v412 = vld1q_s16(in + in_stride * 6 + i);
-    int16x8_t v413 = vaddq_s16(v411, v412);
-    int16x8_t v414_tmp = vqrdmulhq_n_s16(v413, 13573);
-    int16x8_t v414 = vaddq_s16(v414_tmp, v413);
-    int16x8_t v415 = vld1q_s16(in + in_stride * 138 + i);
-    int16x8_t v416 = vld1q_s16(in + in_stride * 134 + i);
-    int16x8_t v417 = vaddq_s16(v415, v416);
-    int16x8_t v418 = vld1q_s16(in + in_stride * 122 + i);
-    int16x8_t v419 = vld1q_s16(in + in_stride * 118 + i);
-    int16x8_t v420 = vaddq_s16(v418, v419);
-    int16x8_t v421 = vaddq_s16(v417, v420);
-    int16x8_t v422 = vaddq_s16(v414, v421);
-    int16x8_t v423 = vld1q_s16(in + in_stride * 74 + i);
-    int16x8_t v424 = vld1q_s16(in + in_stride * 70 + i);
-    int16x8_t v425 = vaddq_s16(v423, v424);
-    int16x8_t v426 = vld1q_s16(in + in_stride * 58 + i);
-    int16x8_t v427 = vld1q_s16(in + in_stride * 54 + i);
-    int16x8_t v428 = vaddq_s16(v426, v427);
-    int16x8_t v429 = vaddq_s16(v425, v428);
-    int16x8_t v430_tmp = vqrdmulhq_n_s16(v429, 13573);
-    int16x8_t v430 = vaddq_s16(v430_tmp, v429);
-    int16x8_t v431 = vld1q_s16(in + in_stride * 202 + i);
-    int16x8_t v432 = vld1q_s16(in + in_stride * 198 + i);
-    int16x8_t v433 = vaddq_s16(v431, v432);
-    int16x8_t v434 = vld1q_s16(in + in_stride * 186 + i);
-    int16x8_t v435 = vld1q_s16(in + in_stride * 182 + i);
-    int16x8_t v436 = vaddq_s16(v434, v435);
-    int16x8_t v437 = vaddq_s16(v433, v436);
-    int16x8_t v438 = vaddq_s16(v437, v429);
-    int16x8_t v439 = vaddq_s16(v430, v438);
-    int16x8_t v440 = vqrdmulhq_n_s16(v439, 17734);
-    int16x8_t v441 = vaddq_s16(v422, v440);
-    int16x8_t v442 = vld1q_s16(in + in_stride * 42 + i);
-    int16x8_t v443 = vld1q_s16(in + in_stride * 38 + i);
-    int16x8_t v444 = vaddq_s16(v442, v443);
-    int16x8_t v445 = vld1q_s16(in + in_stride * 26 + i);
-    int16x8_t v446 = vld1q_s16(in + in_stride * 22 + i);
-    int16x8_t v447 = vaddq_s16(v445, v446);
-    int16x8_t v448 = vaddq_s16(v444, v447);
-    int16x8_t v449_tmp = vqrdmulhq_n_s16(v448, 13573);
-    int16x8_t v449 = vaddq_s16(v449_tmp, v448);
-    int16x8_t v450 = vld1q_s16(in + in_stride * 170 + i);
-    int16x8_t v451 = vld1q_s16(in + in_stride * 166 + i);
-    int16x8_t v452 = vaddq_s16(v450, v451);
-    int16x8_t v453 = vld1q_s16(in + in_stride * 154 + i);
-    int16x8_t v454 = vld1q_s16(in + in_stride * 150 + i);
-    int16x8_t v455 = vaddq_s16(v453, v454);
-    int16x8_t v456 = vaddq_s16(v452, v455);
-    int16x8_t v457 = vld1q_s16(in + in_stride * 106 + i);
-    int16x8_t v458 = vld1q_s16(in + in_stride * 102 + i);
-    int16x8_t v459 = vaddq_s16(v457, v458);
-    int16x8_t v460 = vld1q_s16(in + in_stride * 90 + i);
-    int16x8_t v461 = vld1q_s16(in + in_stride * 86 + i);
-    int16x8_t v462 = vaddq_s16(v460, v461);
-    int16x8_t v463 = vaddq_s16(v459, v462);
-    int16x8_t v464 = vaddq_s16(v456, v463);
-    int16x8_t v465 = vaddq_s16(v449, v464);
-    int16x8_t v466 = vaddq_s16(v463, v448);
-    int16x8_t v467_tmp = vqrdmulhq_n_s16(v466, 13573);
-    int16x8_t v467 = vaddq_s16(v467_tmp, v466);
-    int16x8_t v468 = vld1q_s16(in + in_stride * 234 + i);
-    int16x8_t v469 = vld1q_s16(in + in_stride * 230 + i);
-    int16x8_t v470 = vaddq_s16(v468, v469);
-    int16x8_t v471 = vld1q_s16(in + in_stride * 218 + i);
-    int16x8_t v472 = vld1q_s16(in + in_stride * 214 + i);
-    int16x8_t v473 = vaddq_s16(v471, v472);
-    int16x8_t v474 = vaddq_s16(v470, v473);
-    int16x8_t v475 = vaddq_s16(v474, v456);
-    int16x8_t v476 = vaddq_s16(v475, v466);
-    int16x8_t v477 = vaddq_s16(v467, v476);
-    int16x8_t v478 = vqrdmulhq_n_s16(v477, 17734);
-    int16x8_t v479 = vaddq_s16(v465, v478);
-    int16x8_t v480 = vqrdmulhq_n_s16(v479, 16705);
-    int16x8_t v481 = vaddq_s16(v441, v480);
-    int16x8_t v482 = vaddq_s16(v447, v413);
-    int16x8_t v483_tmp = vqrdmulhq_n_s16(v482, 13573);
-    int16x8_t v483 = vaddq_s16(v483_tmp, v482);
-    int16x8_t v484 = vaddq_s16(v455, v417);
-    int16x8_t v485 = vaddq_s16(v420, v459);
-    int16x8_t v486 = vaddq_s16(v484, v485);
-    int16x8_t v487 = vaddq_s16(v483, v486);
-    int16x8_t v488 = vaddq_s16(v462, v425);
-    int16x8_t v489 = vaddq_s16(v428, v444);
-    int16x8_t v490 = vaddq_s16(v488, v489);
-    int16x8_t v491_tmp = vqrdmulhq_n_s16(v490, 13573);
-    int16x8_t v491 = vaddq_s16(v491_tmp, v490);
-    int16x8_t v492 = vaddq_s16(v473, v433);
-    int16x8_t v493 = vaddq_s16(v436, v452);
-    int16x8_t v494 = vaddq_s16(v492, v493);
-    int16x8_t v495 = vaddq_s16(v494, v490);
-    int16x8_t v496 = vaddq_s16(v491, v495);
-    int16x8_t v497 = vqrdmulhq_n_s16(v496, 17734);
-    int16x8_t v498 = vaddq_s16(v487, v497);
-    int16x8_t v499 = vaddq_s16(v489, v482);
-    int16x8_t v500_tmp = vqrdmulhq_n_s16(v499, 13573);
-    int16x8_t v500 = vaddq_s16(v500_tmp, v499);
-    int16x8_t v501 = vaddq_s16(v493, v484);
-    int16x8_t v502 = vaddq_s16(v485, v488);
-    int16x8_t v503 = vaddq_s16(v501, v502);
-    int16x8_t v504 = vaddq_s16(v500, v503);
-    int16x8_t v505 = vaddq_s16(v502, v499);
-    int16x8_t v506_tmp = vqrdmulhq_n_s16(v505, 13573);
-    int16x8_t v506 = vaddq_s16(v506_tmp, v505);
-    int16x8_t v507 = vld1q_s16(in + in_stride * 250 + i);
-    int16x8_t v508 = vld1q_s16(in + in_stride * 246 + i);
-    int16x8_t v509 = vaddq_s16(v507, v508);
-    int16x8_t v510 = vaddq_s16(v509, v470);
-    int16x8_t v511 = vaddq_s16(v510, v492);
-    int16x8_t v512 = vaddq_s16(v511, v501);
-    int16x8_t v513 = vaddq_s16(v512, v505);
-    int16x8_t v514 = vaddq_s16(v506, v513);
-    int16x8_t v515 = vqrdmulhq_n_s16(v514, 17734);
-    int16x8_t v516 = vaddq_s16(v504, v515);
-    int16x8_t v517 = vqrdmulhq_n_s16(v516, 16705);
-    int16x8_t v518 = vaddq_s16(v498, v517);
-    int16x8_t v519 = vqrdmulhq_n_s16(v518, 16463);
-    int16x8_t v520 = vaddq_s16(v481, v519);
-    int16x8_t v521 = vqrdmulhq_n_s16(v520, 16404);
-    int16x8_t v522 = vaddq_s16(v410, v521);
-    int16x8_t v523 = vaddq_s16(v412, v318);
-    int16x8_t v524_tmp = vqrdmulhq_n_s16(v523, 13573);
-    int16x8_t v524 = vaddq_s16(v524_tmp, v523);
-    int16x8_t v525 = vaddq_s16(v416, v320);
-    int16x8_t v526 = vaddq_s16(v321, v418);
-    int16x8_t v527 = vaddq_s16(v525, v526);
-    int16x8_t v528 = vaddq_s16(v524, v527);
-    int16x8_t v529 = vaddq_s16(v424, v324);
-    int16x8_t v530 = vaddq_s16(v325, v426);
-    int16x8_t v531 = vaddq_s16(v529, v530);
-    int16x8_t v532_tmp = vqrdmulhq_n_s16(v531, 13573);
-    int16x8_t v532 = vaddq_s16(v532_tmp, v531);
-    int16x8_t v533 = vaddq_s16(v432, v328);
-    int16x8_t v534 = vaddq_s16(v329, v434);
-    int16x8_t v535 = vaddq_s16(v533, v534);
-    int16x8_t v536 = vaddq_s16(v535, v531);
-    int16x8_t v537 = vaddq_s16(v532, v536);
-    int16x8_t v538 = vqrdmulhq_n_s16(v537, 17734);
-    int16x8_t v539 = vaddq_s16(v528, v538);
-    int16x8_t v540 = vaddq_s16(v443, v335);
-    int16x8_t v541 = vaddq_s16(v336, v445);
-    int16x8_t v542 = vaddq_s16(v540, v541);
-    int16x8_t v543_tmp = vqrdmulhq_n_s16(v542, 13573);
-    int16x8_t v543 = vaddq_s16(v543_tmp, v542);
-    int16x8_t v544 = vaddq_s16(v451, v339);
-    int16x8_t v545 = vaddq_s16(v340, v453);
-    int16x8_t v546 = vaddq_s16(v544, v545);
-    int16x8_t v547 = vaddq_s16(v458, v342);
-    int16x8_t v548 = vaddq_s16(v343, v460);
-    int16x8_t v549 = vaddq_s16(v547, v548);
-    int16x8_t v550 = vaddq_s16(v546, v549);
-    int16x8_t v551 = vaddq_s16(v543, v550);
-    int16x8_t v552 = vaddq_s16(v549, v542);
-    int16x8_t v553_tmp = vqrdmulhq_n_s16(v552, 13573);
-    int16x8_t v553 = vaddq_s16(v553_tmp, v552);
-    int16x8_t v554 = vaddq_s16(v469, v349);
-    int16x8_t v555 = vaddq_s16(v350, v471);
-    int16x8_t v556 = vaddq_s16(v554, v555);
-    int16x8_t v557 = vaddq_s16(v556, v546);
-    int16x8_t v558 = vaddq_s16(v557, v552);
-    int16x8_t v559 = vaddq_s16(v553, v558);
-    int16x8_t v560 = vqrdmulhq_n_s16(v559, 17734);
-    int16x8_t v561 = vaddq_s16(v551, v560);
-    int16x8_t v562 = vqrdmulhq_n_s16(v561, 16705);
-    int16x8_t v563 = vaddq_s16(v539, v562);
-    int16x8_t v564 = vaddq_s16(v446, v359);
-    int16x8_t v565 = vaddq_s16(v360, v411);
-    int16x8_t v566 = vaddq_s16(v564, v565);
-    int16x8_t v567_tmp = vqrdmulhq_n_s16(v566, 13573);
-    int16x8_t v567 = vaddq_s16(v567_tmp, v566);
-    int16x8_t v568 = vaddq_s16(v454, v363);
-    int16x8_t v569 = vaddq_s16(v364, v415);
-    int16x8_t v570 = vaddq_s16(v568, v569);
-    int16x8_t v571 = vaddq_s16(v419, v366);
-    int16x8_t v572 = vaddq_s16(v367, v457);
-    int16x8_t v573 = vaddq_s16(v571, v572);
-    int16x8_t v574 = vaddq_s16(v570, v573);
-    int16x8_t v575 = vaddq_s16(v567, v574);
-    int16x8_t v576 = vaddq_s16(v461, v371);
-    int16x8_t v577 = vaddq_s16(v372, v423);
-    int16x8_t v578 = vaddq_s16(v576, v577);
-    int16x8_t v579 = vaddq_s16(v427, v374);
-    int16x8_t v580 = vaddq_s16(v375, v442);
-    int16x8_t v581 = vaddq_s16(v579, v580);
-    int16x8_t v582 = vaddq_s16(v578, v581);
-    int16x8_t v583_tmp = vqrdmulhq_n_s16(v582, 13573);
-    int16x8_t v583 = vaddq_s16(v583_tmp, v582);
-    int16x8_t v584 = vaddq_s16(v472, v379);
-    int16x8_t v585 = vaddq_s16(v380, v431);
-    int16x8_t v586 = vaddq_s16(v584, v585);
-    int16x8_t v587 = vaddq_s16(v435, v382);
-    int16x8_t v588 = vaddq_s16(v383, v450);
-    int16x8_t v589 = vaddq_s16(v587, v588);
-    int16x8_t v590 = vaddq_s16(v586, v589);
-    int16x8_t v591 = vaddq_s16(v590, v582);
-    int16x8_t v592 = vaddq_s16(v583, v591);
-    int16x8_t v593 = vqrdmulhq_n_s16(v592, 17734);
-    int16x8_t v594 = vaddq_s16(v575, v593);
-    int16x8_t v595 = vaddq_s16(v581, v566);
-    int16x8_t v596_tmp = vqrdmulhq_n_s16(v595, 13573);
-    int16x8_t v596 = vaddq_s16(v596_tmp, v595);
-    int16x8_t v597 = vaddq_s16(v589, v570);
-    int16x8_t v598 = vaddq_s16(v573, v578);
-    int16x8_t v599 = vaddq_s16(v597, v598);
-    int16x8_t v600 = vaddq_s16(v596, v599);
-    int16x8_t v601 = vaddq_s16(v598, v595);
-    int16x8_t v602_tmp = vqrdmulhq_n_s16(v601, 13573);
-    int16x8_t v602 = vaddq_s16(v602_tmp, v601);
-    int16x8_t v603 = vaddq_s16(v508, v398);
-    int16x8_t v604 = vaddq_s16(v399, v468);
-    int16x8_t v605 = vaddq_s16(v603, v604);
-    int16x8_t v606 = vaddq_s16(v605, v586);
-    int16x8_t v607 = vaddq_s16(v606, v597);
-    int16x8_t v608 = vaddq_s16(v607, v601);
-    int16x8_t v609 = vaddq_s16(v602, v608);
-    int16x8_t v610 = vqrdmulhq_n_s16(v609, 17734);
-    int16x8_t v611 = vaddq_s16(v600, v610);
-    int16x8_t v612 = vqrdmulhq_n_s16(v611, 16705);
-    int16x8_t v613 = vaddq_s16(v594, v612);
-    int16x8_t v614 = vqrdmulhq_n_s16(v613, 16463);
-    int16x8_t v615 = vaddq_s16(v563, v614);
-    int16x8_t v616 = vaddq_s16(v565, v523);
-    int16x8_t v617_tmp = vqrdmulhq_n_s16(v616, 13573);
-    int16x8_t v617 = vaddq_s16(v617_tmp, v616);
-    int16x8_t v618 = vaddq_s16(v569, v525);
-    int16x8_t v619 = vaddq_s16(v526, v571);
-    int16x8_t v620 = vaddq_s16(v618, v619);
-    int16x8_t v621 = vaddq_s16(v617, v620);
-    int16x8_t v622 = vaddq_s16(v577, v529);
-    int16x8_t v623 = vaddq_s16(v530, v579);
-    int16x8_t v624 = vaddq_s16(v622, v623);
-    int16x8_t v625_tmp = vqrdmulhq_n_s16(v624, 13573);
-    int16x8_t v625 = vaddq_s16(v625_tmp, v624);
-    int16x8_t v626 = vaddq_s16(v585, v533);
-    int16x8_t v627 = vaddq_s16(v534, v587);
-    int16x8_t v628 = vaddq_s16(v626, v627);
-    int16x8_t v629 = vaddq_s16(v628, v624);
-    int16x8_t v630 = vaddq_s16(v625, v629);
-    int16x8_t v631 = vqrdmulhq_n_s16(v630, 17734);
-    int16x8_t v632 = vaddq_s16(v621, v631);
-    int16x8_t v633 = vaddq_s16(v580, v540);
-    int16x8_t v634 = vaddq_s16(v541, v564);
-    int16x8_t v635 = vaddq_s16(v633, v634);
-    int16x8_t v636_tmp = vqrdmulhq_n_s16(v635, 13573);
-    int16x8_t v636 = vaddq_s16(v636_tmp, v635);
-    int16x8_t v637 = vaddq_s16(v588, v544);
-    int16x8_t v638 = vaddq_s16(v545, v568);
-    int16x8_t v639 = vaddq_s16(v637, v638);
-    int16x8_t v640 = vaddq_s16(v572, v547);
-    int16x8_t v641 = vaddq_s16(v548, v576);
-    int16x8_t v642 = vaddq_s16(v640, v641);
-    int16x8_t v643 = vaddq_s16(v639, v642);
-    int16x8_t v644 = vaddq_s16(v636, v643);
-    int16x8_t v645 = vaddq_s16(v642, v635);
-    int16x8_t v646_tmp = vqrdmulhq_n_s16(v645, 13573);
-    int16x8_t v646 = vaddq_s16(v646_tmp, v645);
-    int16x8_t v647 = vaddq_s16(v604, v554);
-    int16x8_t v648 = vaddq_s16(v555, v584);
-    int16x8_t v649 = vaddq_s16(v647, v648);
-    int16x8_t v650 = vaddq_s16(v649, v639);
-    int16x8_t v651 = vaddq_s16(v650, v645);
-    int16x8_t v652 = vaddq_s16(v646, v651);
-    int16x8_t v653 = vqrdmulhq_n_s16(v652, 17734);
-    int16x8_t v654 = vaddq_s16(v644, v653);
-    int16x8_t v655 = vqrdmulhq_n_s16(v654, 16705);
-    int16x8_t v656 = vaddq_s16(v632, v655);
-    int16x8_t v657 = vaddq_s16(v634, v616);
-    int16x8_t v658_tmp = vqrdmulhq_n_s16(v657, 13573);
-    int16x8_t v658 = vaddq_s16(v658_tmp, v657);
-    int16x8_t v659 = vaddq_s16(v638, v618);
-    int16x8_t v660 = vaddq_s16(v619, v640);
-    int16x8_t v661 = vaddq_s16(v659, v660);
-    int16x8_t v662 = vaddq_s16(v658, v661);
-    int16x8_t v663 = vaddq_s16(v641, v622);
-    int16x8_t v664 = vaddq_s16(v623, v633);
-    int16x8_t v665 = vaddq_s16(v663, v664);
-    int16x8_t v666_tmp = vqrdmulhq_n_s16(v665, 13573);
-    int16x8_t v666 = vaddq_s16(v666_tmp, v665);
-    int16x8_t v667 = vaddq_s16(v648, v626);
-    int16x8_t v668 = vaddq_s16(v627, v637);
-    int16x8_t v669 = vaddq_s16(v667, v668);
-    int16x8_t v670 = vaddq_s16(v669, v665);
-    int16x8_t v671 = vaddq_s16(v666, v670);
-    int16x8_t v672 = vqrdmulhq_n_s16(v671, 17734);
-    int16x8_t v673 = vaddq_s16(v662, v672);
-    int16x8_t v674 = vaddq_s16(v664, v657);
-    int16x8_t v675_tmp = vqrdmulhq_n_s16(v674, 13573);
-    int16x8_t v675 = vaddq_s16(v675_tmp, v674);
-    int16x8_t v676 = vaddq_s16(v668, v659);
-    int16x8_t v677 = vaddq_s16(v660, v663);
-    int16x8_t v678 = vaddq_s16(v676, v677);
-    int16x8_t v679 = vaddq_s16(v675, v678);
-    int16x8_t v680 = vaddq_s16(v677, v674);
-    int16x8_t v681_tmp = vqrdmulhq_n_s16(v680, 13573);
-    int16x8_t v681 = vaddq_s16(v681_tmp, v680);
-    int16x8_t v682 = vld1q_s16(in + in_stride * 254 + i);
-    int16x8_t v683 = vaddq_s16(v682, v507);
-    int16x8_t v684 = vaddq_s16(v683, v603);
-    int16x8_t v685 = vaddq_s16(v684, v647);
-    int16x8_t v686 = vaddq_s16(v685, v667);
-    int16x8_t v687 = vaddq_s16(v686, v676);
-    int16x8_t v688 = vaddq_s16(v687, v680);
-    int16x8_t v689 = vaddq_s16(v681, v688);
-    int16x8_t v690 = vqrdmulhq_n_s16(v689, 17734);
-    int16x8_t v691 = vaddq_s16(v679, v690);
-    int16x8_t v692 = vqrdmulhq_n_s16(v691, 16705);
-    int16x8_t v693 = vaddq_s16(v673, v692);
-    int16x8_t v694 = vqrdmulhq_n_s16(v693, 16463);
-    int16x8_t v695 = vaddq_s16(v656, v694);
-    int16x8_t v696 = vqrdmulhq_n_s16(v695, 16404);
-    int16x8_t v697 = vaddq_s16(v615, v696);
-    int16x8_t v698 = vqrdmulhq_n_s16(v697, 16389);
-    int16x8_t v699 = vaddq_s16(v522, v698);
-    int16x8_t v700 = vqrdmulhq_n_s16(v699, 16385);
-    int16x8_t v701 = vaddq_s16(v317, v700);
-    int16x8_t v702 = vld1q_s16(in + in_stride * 1 + i);
-    int16x8_t v703_tmp = vqrdmulhq_n_s16(v702, 13573);
-    int16x8_t v703 = vaddq_s16(v703_tmp, v702);
-    int16x8_t v704 = vld1q_s16(in + in_stride * 129 + i);
-    int16x8_t v705 = vld1q_s16(in + in_stride * 127 + i);
-    int16x8_t v706 = vaddq_s16(v704, v705);
-    int16x8_t v707 = vaddq_s16(v703, v706);
-    int16x8_t v708 = vld1q_s16(in + in_stride * 65 + i);
-    int16x8_t v709 = vld1q_s16(in + in_stride * 63 + i);
-    int16x8_t v710 = vaddq_s16(v708, v709);
-    int16x8_t v711_tmp = vqrdmulhq_n_s16(v710, 13573);
-    int16x8_t v711 = vaddq_s16(v711_tmp, v710);
-    int16x8_t v712 = vld1q_s16(in + in_stride * 193 + i);
-    int16x8_t v713 = vld1q_s16(in + in_stride * 191 + i);
-    int16x8_t v714 = vaddq_s16(v712, v713);
-    int16x8_t v715 = vaddq_s16(v714, v710);
-    int16x8_t v716 = vaddq_s16(v711, v715);
-    int16x8_t v717 = vqrdmulhq_n_s16(v716, 17734);
-    int16x8_t v718 = vaddq_s16(v707, v717);
-    int16x8_t v719 = vld1q_s16(in + in_stride * 33 + i);
-    int16x8_t v720 = vld1q_s16(in + in_stride * 31 + i);
-    int16x8_t v721 = vaddq_s16(v719, v720);
-    int16x8_t v722_tmp = vqrdmulhq_n_s16(v721, 13573);
-    int16x8_t v722 = vaddq_s16(v722_tmp, v721);
-    int16x8_t v723 = vld1q_s16(in + in_stride * 161 + i);
-    int16x8_t v724 = vld1q_s16(in + in_stride * 159 + i);
-    int16x8_t v725 = vaddq_s16(v723, v724);
-    int16x8_t v726 = vld1q_s16(in + in_stride * 97 + i);
-    int16x8_t v727 = vld1q_s16(in + in_stride * 95 + i);
-    int16x8_t v728 = vaddq_s16(v726, v727);
-    int16x8_t v729 = vaddq_s16(v725, v728);
-    int16x8_t v730 = vaddq_s16(v722, v729);
-    int16x8_t v731 = vaddq_s16(v728, v721);
-    int16x8_t v732_tmp = vqrdmulhq_n_s16(v731, 13573);
-    int16x8_t v732 = vaddq_s16(v732_tmp, v731);
-    int16x8_t v733 = vld1q_s16(in + in_stride * 225 + i);
-    int16x8_t v734 = vld1q_s16(in + in_stride * 223 + i);
-    int16x8_t v735 = vaddq_s16(v733, v734);
-    int16x8_t v736 = vaddq_s16(v735, v725);
-    int16x8_t v737 = vaddq_s16(v736, v731);
-    int16x8_t v738 = vaddq_s16(v732, v737);
-    int16x8_t v739 = vqrdmulhq_n_s16(v738, 17734);
-    int16x8_t v740 = vaddq_s16(v730, v739);
-    int16x8_t v741 = vqrdmulhq_n_s16(v740, 16705);
-    int16x8_t v742 = vaddq_s16(v718, v741);
-    int16x8_t v743 = vld1q_s16(in + in_stride * 17 + i);
-    int16x8_t v744 = vld1q_s16(in + in_stride * 15 + i);
-    int16x8_t v745 = vaddq_s16(v743, v744);
-    int16x8_t v746_tmp = vqrdmulhq_n_s16(v745, 13573);
-    int16x8_t v746 = vaddq_s16(v746_tmp, v745);
-    int16x8_t v747 = vld1q_s16(in + in_stride * 145 + i);
-    int16x8_t v748 = vld1q_s16(in + in_stride * 143 + i);
-    int16x8_t v749 = vaddq_s16(v747, v748);
-    int16x8_t v750 = vld1q_s16(in + in_stride * 113 + i);
-    int16x8_t v751 = vld1q_s16(in + in_stride * 111 + i);
-    int16x8_t v752 = vaddq_s16(v750, v751);
-    int16x8_t v753 = vaddq_s16(v749, v752);
-    int16x8_t v754 = vaddq_s16(v746, v753);
-    int16x8_t v755 = vld1q_s16(in + in_stride * 81 + i);
-    int16x8_t v756 = vld1q_s16(in + in_stride * 79 + i);
-    int16x8_t v757 = vaddq_s16(v755, v756);
-    int16x8_t v758 = vld1q_s16(in + in_stride * 49 + i);
-    int16x8_t v759 = vld1q_s16(in + in_stride * 47 + i);
-    int16x8_t v760 = vaddq_s16(v758, v759);
-    int16x8_t v761 = vaddq_s16(v757, v760);
-    int16x8_t v762_tmp = vqrdmulhq_n_s16(v761, 13573);
-    int16x8_t v762 = vaddq_s16(v762_tmp, v761);
-    int16x8_t v763 = vld1q_s16(in + in_stride * 209 + i);
-    int16x8_t v764 = vld1q_s16(in + in_stride * 207 + i);
-    int16x8_t v765 = vaddq_s16(v763, v764);
-    int16x8_t v766 = vld1q_s16(in + in_stride * 177 + i);
-    int16x8_t v767 = vld1q_s16(in + in_stride * 175 + i);
-    int16x8_t v768 = vaddq_s16(v766, v767);
-    int16x8_t v769 = vaddq_s16(v765, v768);
-    int16x8_t v770 = vaddq_s16(v769, v761);
-    int16x8_t v771 = vaddq_s16(v762, v770);
-    int16x8_t v772 = vqrdmulhq_n_s16(v771, 17734);
-    int16x8_t v773 = vaddq_s16(v754, v772);
-    int16x8_t v774 = vaddq_s16(v760, v745);
-    int16x8_t v775_tmp = vqrdmulhq_n_s16(v774, 13573);
-    int16x8_t v775 = vaddq_s16(v775_tmp, v774);
-    int16x8_t v776 = vaddq_s16(v768, v749);
-    int16x8_t v777 = vaddq_s16(v752, v757);
-    int16x8_t v778 = vaddq_s16(v776, v777);
-    int16x8_t v779 = vaddq_s16(v775, v778);
-    int16x8_t v780 = vaddq_s16(v777, v774);
-    int16x8_t v781_tmp = vqrdmulhq_n_s16(v780, 13573);
-    int16x8_t v781 = vaddq_s16(v781_tmp, v780);
-    int16x8_t v782 = vld1q_s16(in + in_stride * 241 + i);
-    int16x8_t v783 = vld1q_s16(in + in_stride * 239 + i);
-    int16x8_t v784 = vaddq_s16(v782, v783);
-    int16x8_t v785 = vaddq_s16(v784, v765);
-    int16x8_t v786 = vaddq_s16(v785, v776);
-    int16x8_t v787 = vaddq_s16(v786, v780);
-    int16x8_t v788 = vaddq_s16(v781, v787);
-    int16x8_t v789 = vqrdmulhq_n_s16(v788, 17734);
-    int16x8_t v790 = vaddq_s16(v779, v789);
-    int16x8_t v791 = vqrdmulhq_n_s16(v790, 16705);
-    int16x8_t v792 = vaddq_s16(v773, v791);
-    int16x8_t v793 = vqrdmulhq_n_s16(v792, 16463);
-    int16x8_t v794 = vaddq_s16(v742, v793);
-    int16x8_t v795 = vld1q_s16(in + in_stride * 9 + i);
-    int16x8_t v796 = vld1q_s16(in + in_stride * 7 + i);
-    int16x8_t v797 = vaddq_s16(v795, v796);
-    int16x8_t v798_tmp = vqrdmulhq_n_s16(v797, 13573);
-    int16x8_t v798 = vaddq_s16(v798_tmp, v797);
-    int16x8_t v799 = vld1q_s16(in + in_stride * 137 + i);
-    int16x8_t v800 = vld1q_s16(in + in_stride * 135 + i);
-    int16x8_t v801 = vaddq_s16(v799, v800);
-    int16x8_t v802 = vld1q_s16(in + in_stride * 121 + i);
-    int16x8_t v803 = vld1q_s16(in + in_stride * 119 + i);
-    int16x8_t v804 = vaddq_s16(v802, v803);
-    int16x8_t v805 = vaddq_s16(v801, v804);
-    int16x8_t v806 = vaddq_s16(v798, v805);
-    int16x8_t v807 = vld1q_s16(in + in_stride * 73 + i);
-    int16x8_t v808 = vld1q_s16(in + in_stride * 71 + i);
-    int16x8_t v809 = vaddq_s16(v807, v808);
-    int16x8_t v810 = vld1q_s16(in + in_stride * 57 + i);
-    int16x8_t v811 = vld1q_s16(in + in_stride * 55 + i);
-    int16x8_t v812 = vaddq_s16(v810, v811);
-    int16x8_t v813 = vaddq_s16(v809, v812);
-    int16x8_t v814_tmp = vqrdmulhq_n_s16(v813, 13573);
-    int16x8_t v814 = vaddq_s16(v814_tmp, v813);
-    int16x8_t v815 = vld1q_s16(in + in_stride * 201 + i);
-    int16x8_t v816 = vld1q_s16(in + in_stride * 199 + i);
-    int16x8_t v817 = vaddq_s16(v815, v816);
-    int16x8_t v818 = vld1q_s16(in + in_stride * 185 + i);
-    int16x8_t v819 = vld1q_s16(in + in_stride * 183 + i);
-    int16x8_t v820 = vaddq_s16(v818, v819);
-    int16x8_t v821 = vaddq_s16(v817, v820);
-    int16x8_t v822 = vaddq_s16(v821, v813);
-    int16x8_t v823 = vaddq_s16(v814, v822);
-    int16x8_t v824 = vqrdmulhq_n_s16(v823, 17734);
-    int16x8_t v825 = vaddq_s16(v806, v824);
-    int16x8_t v826 = vld1q_s16(in + in_stride * 41 + i);
-    int16x8_t v827 = vld1q_s16(in + in_stride * 39 + i);
-    int16x8_t v828 = vaddq_s16(v826, v827);
-    int16x8_t v829 = vld1q_s16(in + in_stride * 25 + i);
-    int16x8_t v830 = vld1q_s16(in + in_stride * 23 + i);
-    int16x8_t v831 = vaddq_s16(v829, v830);
-    int16x8_t v832 = vaddq_s16(v828, v831);
-    int16x8_t v833_tmp = vqrdmulhq_n_s16(v832, 13573);
-    int16x8_t v833 = vaddq_s16(v833_tmp, v832);
-    int16x8_t v834 = vld1q_s16(in + in_stride * 169 + i);
-    int16x8_t v835 = vld1q_s16(in + in_stride * 167 + i);
-    int16x8_t v836 = vaddq_s16(v834, v835);
-    int16x8_t v837 = vld1q_s16(in + in_stride * 153 + i);
-    int16x8_t v838 = vld1q_s16(in + in_stride * 151 + i);
-    int16x8_t v839 = vaddq_s16(v837, v838);
-    int16x8_t v840 = vaddq_s16(v836, v839);
-    int16x8_t v841 = vld1q_s16(in + in_stride * 105 + i);
-    int16x8_t v842 = vld1q_s16(in + in_stride * 103 + i);
-    int16x8_t v843 = vaddq_s16(v841, v842);
-    int16x8_t v844 = vld1q_s16(in + in_stride * 89 + i);
-    int16x8_t v845 = vld1q_s16(in + in_stride * 87 + i);
-    int16x8_t v846 = vaddq_s16(v844, v845);
-    int16x8_t v847 = vaddq_s16(v843, v846);
-    int16x8_t v848 = vaddq_s16(v840, v847);
-    int16x8_t v849 = vaddq_s16(v833, v848);
-    int16x8_t v850 = vaddq_s16(v847, v832);
-    int16x8_t v851_tmp = vqrdmulhq_n_s16(v850, 13573);
-    int16x8_t v851 = vaddq_s16(v851_tmp, v850);
-    int16x8_t v852 = vld1q_s16(in + in_stride * 233 + i);
-    int16x8_t v853 = vld1q_s16(in + in_stride * 231 + i);
-    int16x8_t v854 = vaddq_s16(v852, v853);
-    int16x8_t v855 = vld1q_s16(in + in_stride * 217 + i);
-    int16x8_t v856 = vld1q_s16(in + in_stride * 215 + i);
-    int16x8_t v857 = vaddq_s16(v855, v856);
-    int16x8_t v858 = vaddq_s16(v854, v857);
-    int16x8_t v859 = vaddq_s16(v858, v840);
-    int16x8_t v860 = vaddq_s16(v859, v850);
-    int16x8_t v861 = vaddq_s16(v851, v860);
-    int16x8_t v862 = vqrdmulhq_n_s16(v861, 17734);
-    int16x8_t v863 = vaddq_s16(v849, v862);
-    int16x8_t v864 = vqrdmulhq_n_s16(v863, 16705);
-    int16x8_t v865 = vaddq_s16(v825, v864);
-    int16x8_t v866 = vaddq_s16(v831, v797);
-    int16x8_t v867_tmp = vqrdmulhq_n_s16(v866, 13573);
-    int16x8_t v867 = vaddq_s16(v867_tmp, v866);
-    int16x8_t v868 = vaddq_s16(v839, v801);
-    int16x8_t v869 = vaddq_s16(v804, v843);
-    int16x8_t v870 = vaddq_s16(v868, v869);
-    int16x8_t v871 = vaddq_s16(v867, v870);
-    int16x8_t v872 = vaddq_s16(v846, v809);
-    int16x8_t v873 = vaddq_s16(v812, v828);
-    int16x8_t v874 = vaddq_s16(v872, v873);
-    int16x8_t v875_tmp = vqrdmulhq_n_s16(v874, 13573);
-    int16x8_t v875 = vaddq_s16(v875_tmp, v874);
-    int16x8_t v876 = vaddq_s16(v857, v817);
-    int16x8_t v877 = vaddq_s16(v820, v836);
-    int16x8_t v878 = vaddq_s16(v876, v877);
-    int16x8_t v879 = vaddq_s16(v878, v874);
-    int16x8_t v880 = vaddq_s16(v875, v879);
-    int16x8_t v881 = vqrdmulhq_n_s16(v880, 17734);
-    int16x8_t v882 = vaddq_s16(v871, v881);
-    int16x8_t v883 = vaddq_s16(v873, v866);
-    int16x8_t v884_tmp = vqrdmulhq_n_s16(v883, 13573);
-    int16x8_t v884 = vaddq_s16(v884_tmp, v883);
-    int16x8_t v885 = vaddq_s16(v877, v868);
-    int16x8_t v886 = vaddq_s16(v869, v872);
-    int16x8_t v887 = vaddq_s16(v885, v886);
-    int16x8_t v888 = vaddq_s16(v884, v887);
-    int16x8_t v889 = vaddq_s16(v886, v883);
-    int16x8_t v890_tmp = vqrdmulhq_n_s16(v889, 13573);
-    int16x8_t v890 = vaddq_s16(v890_tmp, v889);
-    int16x8_t v891 = vld1q_s16(in + in_stride * 249 + i);
-    int16x8_t v892 = vld1q_s16(in + in_stride * 247 + i);
-    int16x8_t v893 = vaddq_s16(v891, v892);
-    int16x8_t v894 = vaddq_s16(v893, v854);
-    int16x8_t v895 = vaddq_s16(v894, v876);
-    int16x8_t v896 = vaddq_s16(v895, v885);
-    int16x8_t v897 = vaddq_s16(v896, v889);
-    int16x8_t v898 = vaddq_s16(v890, v897);
-    int16x8_t v899 = vqrdmulhq_n_s16(v898, 17734);
-    int16x8_t v900 = vaddq_s16(v888, v899);
-    int16x8_t v901 = vqrdmulhq_n_s16(v900, 16705);
-    int16x8_t v902 = vaddq_s16(v882, v901);
-    int16x8_t v903 = vqrdmulhq_n_s16(v902, 16463);
-    int16x8_t v904 = vaddq_s16(v865, v903);
-    int16x8_t v905 = vqrdmulhq_n_s16(v904, 16404);
-    int16x8_t v906 = vaddq_s16(v794, v905);
-    int16x8_t v907 = vld1q_s16(in + in_stride * 5 + i);
-    int16x8_t v908 = vld1q_s16(in + in_stride * 3 + i);
-    int16x8_t v909 = vaddq_s16(v907, v908);
-    int16x8_t v910_tmp = vqrdmulhq_n_s16(v909, 13573);
-    int16x8_t v910 = vaddq_s16(v910_tmp, v909);
-    int16x8_t v911 = vld1q_s16(in + in_stride * 133 + i);
-    int16x8_t v912 = vld1q_s16(in + in_stride * 131 + i);
-    int16x8_t v913 = vaddq_s16(v911, v912);
-    int16x8_t v914 = vld1q_s16(in + in_stride * 125 + i);
-    int16x8_t v915 = vld1q_s16(in + in_stride * 123 + i);
-    int16x8_t v916 = vaddq_s16(v914, v915);
-    int16x8_t v917 = vaddq_s16(v913, v916);
-    int16x8_t v918 = vaddq_s16(v910, v917);
-    int16x8_t v919 = vld1q_s16(in + in_stride * 69 + i);
-    int16x8_t v920 = vld1q_s16(in + in_stride * 67 + i);
-    int16x8_t v921 = vaddq_s16(v919, v920);
-    int16x8_t v922 = vld1q_s16(in + in_stride * 61 + i);
-    int16x8_t v923 = vld1q_s16(in + in_stride * 59 + i);
-    int16x8_t v924 = vaddq_s16(v922, v923);
-    int16x8_t v925 = vaddq_s16(v921, v924);
-    int16x8_t v926_tmp = vqrdmulhq_n_s16(v925, 13573);
-    int16x8_t v926 = vaddq_s16(v926_tmp, v925);
-    int16x8_t v927 = vld1q_s16(in + in_stride * 197 + i);
-    int16x8_t v928 = vld1q_s16(in + in_stride * 195 + i);
-    int16x8_t v929 = vaddq_s16(v927, v928);
-    int16x8_t v930 = vld1q_s16(in + in_stride * 189 + i);
-    int16x8_t v931 = vld1q_s16(in + in_stride * 187 + i);
-    int16x8_t v932 = vaddq_s16(v930, v931);
-    int16x8_t v933 = vaddq_s16(v929, v932);
-    int16x8_t v934 = vaddq_s16(v933, v925);
-    int16x8_t v935 = vaddq_s16(v926, v934);
-    int16x8_t v936 = vqrdmulhq_n_s16(v935, 17734);
-    int16x8_t v937 = vaddq_s16(v918, v936);
-    int16x8_t v938 = vld1q_s16(in + in_stride * 37 + i);
-    int16x8_t v939 = vld1q_s16(in + in_stride * 35 + i);
-    int16x8_t v940 = vaddq_s16(v938, v939);
-    int16x8_t v941 = vld1q_s16(in + in_stride * 29 + i);
-    int16x8_t v942 = vld1q_s16(in + in_stride * 27 + i);
-    int16x8_t v943 = vaddq_s16(v941, v942);
-    int16x8_t v944 = vaddq_s16(v940, v943);
-    int16x8_t v945_tmp = vqrdmulhq_n_s16(v944, 13573);
-    int16x8_t v945 = vaddq_s16(v945_tmp, v944);
-    int16x8_t v946 = vld1q_s16(in + in_stride * 165 + i);
-    int16x8_t v947 = vld1q_s16(in + in_stride * 163 + i);
-    int16x8_t v948 = vaddq_s16(v946, v947);
-    int16x8_t v949 = vld1q_s16(in + in_stride * 157 + i);
-    int16x8_t v950 = vld1q_s16(in + in_stride * 155 + i);
-    int16x8_t v951 = vaddq_s16(v949, v950);
-    int16x8_t v952 = vaddq_s16(v948, v951);
-    int16x8_t v953 = vld1q_s16(in + in_stride * 101 + i);
-    int16x8_t v954 = vld1q_s16(in + in_stride * 99 + i);
-    int16x8_t v955 = vaddq_s16(v953, v954);
-    int16x8_t v956 = vld1q_s16(in + in_stride * 93 + i);
-    int16x8_t v957 = vld1q_s16(in + in_stride * 91 + i);
-    int16x8_t v958 = vaddq_s16(v956, v957);
-    int16x8_t v959 = vaddq_s16(v955, v958);
-    int16x8_t v960 = vaddq_s16(v952, v959);
-    int16x8_t v961 = vaddq_s16(v945, v960);
-    int16x8_t v962 = vaddq_s16(v959, v944);
-    int16x8_t v963_tmp = vqrdmulhq_n_s16(v962, 13573);
-    int16x8_t v963 = vaddq_s16(v963_tmp, v962);
-    int16x8_t v964 = vld1q_s16(in + in_stride * 229 + i);
-    int16x8_t v965 = vld1q_s16(in + in_stride * 227 + i);
-    int16x8_t v966 = vaddq_s16(v964, v965);
-    int16x8_t v967 = vld1q_s16(in + in_stride * 221 + i);
-    int16x8_t v968 = vld1q_s16(in + in_stride * 219 + i);
-    int16x8_t v969 = vaddq_s16(v967, v968);
-    int16x8_t v970 = vaddq_s16(v966, v969);
-    int16x8_t v971 = vaddq_s16(v970, v952);
-    int16x8_t v972 = vaddq_s16(v971, v962);
-    int16x8_t v973 = vaddq_s16(v963, v972);
-    int16x8_t v974 = vqrdmulhq_n_s16(v973, 17734);
-    int16x8_t v975 = vaddq_s16(v961, v974);
-    int16x8_t v976 = vqrdmulhq_n_s16(v975, 16705);
-    int16x8_t v977 = vaddq_s16(v937, v976);
-    int16x8_t v978 = vld1q_s16(in + in_stride * 21 + i);
-    int16x8_t v979 = vld1q_s16(in + in_stride * 19 + i);
-    int16x8_t v980 = vaddq_s16(v978, v979);
-    int16x8_t v981 = vld1q_s16(in + in_stride * 13 + i);
-    int16x8_t v982 = vld1q_s16(in + in_stride * 11 + i);
-    int16x8_t v983 = vaddq_s16(v981, v982);
-    int16x8_t v984 = vaddq_s16(v980, v983);
-    int16x8_t v985_tmp = vqrdmulhq_n_s16(v984, 13573);
-    int16x8_t v985 = vaddq_s16(v985_tmp, v984);
-    int16x8_t v986 = vld1q_s16(in + in_stride * 149 + i);
-    int16x8_t v987 = vld1q_s16(in + in_stride * 147 + i);
-    int16x8_t v988 = vaddq_s16(v986, v987);
-    int16x8_t v989 = vld1q_s16(in + in_stride * 141 + i);
-    int16x8_t v990 = vld1q_s16(in + in_stride * 139 + i);
-    int16x8_t v991 = vaddq_s16(v989, v990);
-    int16x8_t v992 = vaddq_s16(v988, v991);
-    int16x8_t v993 = vld1q_s16(in + in_stride * 117 + i);
-    int16x8_t v994 = vld1q_s16(in + in_stride * 115 + i);
-    int16x8_t v995 = vaddq_s16(v993, v994);
-    int16x8_t v996 = vld1q_s16(in + in_stride * 109 + i);
-    int16x8_t v997 = vld1q_s16(in + in_stride * 107 + i);
-    int16x8_t v998 = vaddq_s16(v996, v997);
-    int16x8_t v999 = vaddq_s16(v995, v998);
-    int16x8_t v1000 = vaddq_s16(v992, v999);
-    int16x8_t v1001 = vaddq_s16(v985, v1000);
-    int16x8_t v1002 = vld1q_s16(in + in_stride * 85 + i);
-    int16x8_t v1003 = vld1q_s16(in + in_stride * 83 + i);
-    int16x8_t v1004 = vaddq_s16(v1002, v1003);
-    int16x8_t v1005 = vld1q_s16(in + in_stride * 77 + i);
-    int16x8_t v1006 = vld1q_s16(in + in_stride * 75 + i);
-    int16x8_t v1007 = vaddq_s16(v1005, v1006);
-    int16x8_t v1008 = vaddq_s16(v1004, v1007);
-    int16x8_t v1009 = vld1q_s16(in + in_stride * 53 + i);
-    int16x8_t v1010 = vld1q_s16(in + in_stride * 51 + i);
-    int16x8_t v1011 = vaddq_s16(v1009, v1010);
-    int16x8_t v1012 = vld1q_s16(in + in_stride * 45 + i);
-    int16x8_t v1013 = vld1q_s16(in + in_stride * 43 + i);
-    int16x8_t v1014 = vaddq_s16(v1012, v1013);
-    int16x8_t v1015 = vaddq_s16(v1011, v1014);
-    int16x8_t v1016 = vaddq_s16(v1008, v1015);
-    int16x8_t v1017_tmp = vqrdmulhq_n_s16(v1016, 13573);
-    int16x8_t v1017 = vaddq_s16(v1017_tmp, v1016);
-    int16x8_t v1018 = vld1q_s16(in + in_stride * 213 + i);
-    int16x8_t v1019 = vld1q_s16(in + in_stride * 211 + i);
-    int16x8_t v1020 = vaddq_s16(v1018, v1019);
-    int16x8_t v1021 = vld1q_s16(in + in_stride * 205 + i);
-    int16x8_t v1022 = vld1q_s16(in + in_stride * 203 + i);
-    int16x8_t v1023 = vaddq_s16(v1021, v1022);
-    int16x8_t v1024 = vaddq_s16(v1020, v1023);
-    int16x8_t v1025 = vld1q_s16(in + in_stride * 181 + i);
-    int16x8_t v1026 = vld1q_s16(in + in_stride * 179 + i);
-    int16x8_t v1027 = vaddq_s16(v1025, v1026);
-    int16x8_t v1028 = vld1q_s16(in + in_stride * 173 + i);
-    int16x8_t v1029 = vld1q_s16(in + in_stride * 171 + i);
-    int16x8_t v1030 = vaddq_s16(v1028, v1029);
-    int16x8_t v1031 = vaddq_s16(v1027, v1030);
-    int16x8_t v1032 = vaddq_s16(v1024, v1031);
-    int16x8_t v1033 = vaddq_s16(v1032, v1016);
-    int16x8_t v1034 = vaddq_s16(v1017, v1033);
-    int16x8_t v1035 = vqrdmulhq_n_s16(v1034, 17734);
-    int16x8_t v1036 = vaddq_s16(v1001, v1035);
-    int16x8_t v1037 = vaddq_s16(v1015, v984);
-    int16x8_t v1038_tmp = vqrdmulhq_n_s16(v1037, 13573);
-    int16x8_t v1038 = vaddq_s16(v1038_tmp, v1037);
-    int16x8_t v1039 = vaddq_s16(v1031, v992);
-    int16x8_t v1040 = vaddq_s16(v999, v1008);
-    int16x8_t v1041 = vaddq_s16(v1039, v1040);
-    int16x8_t v1042 = vaddq_s16(v1038, v1041);
-    int16x8_t v1043 = vaddq_s16(v1040, v1037);
-    int16x8_t v1044_tmp = vqrdmulhq_n_s16(v1043, 13573);
-    int16x8_t v1044 = vaddq_s16(v1044_tmp, v1043);
-    int16x8_t v1045 = vld1q_s16(in + in_stride * 245 + i);
-    int16x8_t v1046 = vld1q_s16(in + in_stride * 243 + i);
-    int16x8_t v1047 = vaddq_s16(v1045, v1046);
-    int16x8_t v1048 = vld1q_s16(in + in_stride * 237 + i);
-    int16x8_t v1049 = vld1q_s16(in + in_stride * 235 + i);
-    int16x8_t v1050 = vaddq_s16(v1048, v1049);
-    int16x8_t v1051 = vaddq_s16(v1047, v1050);
-    int16x8_t v1052 = vaddq_s16(v1051, v1024);
-    int16x8_t v1053 = vaddq_s16(v1052, v1039);
-    int16x8_t v1054 = vaddq_s16(v1053, v1043);
-    int16x8_t v1055 = vaddq_s16(v1044, v1054);
-    int16x8_t v1056 = vqrdmulhq_n_s16(v1055, 17734);
-    int16x8_t v1057 = vaddq_s16(v1042, v1056);
-    int16x8_t v1058 = vqrdmulhq_n_s16(v1057, 16705);
-    int16x8_t v1059 = vaddq_s16(v1036, v1058);
-    int16x8_t v1060 = vqrdmulhq_n_s16(v1059, 16463);
-    int16x8_t v1061 = vaddq_s16(v977, v1060);
-    int16x8_t v1062 = vaddq_s16(v983, v909);
-    int16x8_t v1063_tmp = vqrdmulhq_n_s16(v1062, 13573);
-    int16x8_t v1063 = vaddq_s16(v1063_tmp, v1062);
-    int16x8_t v1064 = vaddq_s16(v991, v913);
-    int16x8_t v1065 = vaddq_s16(v916, v995);
-    int16x8_t v1066 = vaddq_s16(v1064, v1065);
-    int16x8_t v1067 = vaddq_s16(v1063, v1066);
-    int16x8_t v1068 = vaddq_s16(v1007, v921);
-    int16x8_t v1069 = vaddq_s16(v924, v1011);
-    int16x8_t v1070 = vaddq_s16(v1068, v1069);
-    int16x8_t v1071_tmp = vqrdmulhq_n_s16(v1070, 13573);
-    int16x8_t v1071 = vaddq_s16(v1071_tmp, v1070);
-    int16x8_t v1072 = vaddq_s16(v1023, v929);
-    int16x8_t v1073 = vaddq_s16(v932, v1027);
-    int16x8_t v1074 = vaddq_s16(v1072, v1073);
-    int16x8_t v1075 = vaddq_s16(v1074, v1070);
-    int16x8_t v1076 = vaddq_s16(v1071, v1075);
-    int16x8_t v1077 = vqrdmulhq_n_s16(v1076, 17734);
-    int16x8_t v1078 = vaddq_s16(v1067, v1077);
-    int16x8_t v1079 = vaddq_s16(v1014, v940);
-    int16x8_t v1080 = vaddq_s16(v943, v980);
-    int16x8_t v1081 = vaddq_s16(v1079, v1080);
-    int16x8_t v1082_tmp = vqrdmulhq_n_s16(v1081, 13573);
-    int16x8_t v1082 = vaddq_s16(v1082_tmp, v1081);
-    int16x8_t v1083 = vaddq_s16(v1030, v948);
-    int16x8_t v1084 = vaddq_s16(v951, v988);
-    int16x8_t v1085 = vaddq_s16(v1083, v1084);
-    int16x8_t v1086 = vaddq_s16(v998, v955);
-    int16x8_t v1087 = vaddq_s16(v958, v1004);
-    int16x8_t v1088 = vaddq_s16(v1086, v1087);
-    int16x8_t v1089 = vaddq_s16(v1085, v1088);
-    int16x8_t v1090 = vaddq_s16(v1082, v1089);
-    int16x8_t v1091 = vaddq_s16(v1088, v1081);
-    int16x8_t v1092_tmp = vqrdmulhq_n_s16(v1091, 13573);
-    int16x8_t v1092 = vaddq_s16(v1092_tmp, v1091);
-    int16x8_t v1093 = vaddq_s16(v1050, v966);
-    int16x8_t v1094 = vaddq_s16(v969, v1020);
-    int16x8_t v1095 = vaddq_s16(v1093, v1094);
-    int16x8_t v1096 = vaddq_s16(v1095, v1085);
-    int16x8_t v1097 = vaddq_s16(v1096, v1091);
-    int16x8_t v1098 = vaddq_s16(v1092, v1097);
-    int16x8_t v1099 = vqrdmulhq_n_s16(v1098, 17734);
-    int16x8_t v1100 = vaddq_s16(v1090, v1099);
-    int16x8_t v1101 = vqrdmulhq_n_s16(v1100, 16705);
-    int16x8_t v1102 = vaddq_s16(v1078, v1101);
-    int16x8_t v1103 = vaddq_s16(v1080, v1062);
-    int16x8_t v1104_tmp = vqrdmulhq_n_s16(v1103, 13573);
-    int16x8_t v1104 = vaddq_s16(v1104_tmp, v1103);
-    int16x8_t v1105 = vaddq_s16(v1084, v1064);
-    int16x8_t v1106 = vaddq_s16(v1065, v1086);
-    int16x8_t v1107 = vaddq_s16(v1105, v1106);
-    int16x8_t v1108 = vaddq_s16(v1104, v1107);
-    int16x8_t v1109 = vaddq_s16(v1087, v1068);
-    int16x8_t v1110 = vaddq_s16(v1069, v1079);
-    int16x8_t v1111 = vaddq_s16(v1109, v1110);
-    int16x8_t v1112_tmp = vqrdmulhq_n_s16(v1111, 13573);
-    int16x8_t v1112 = vaddq_s16(v1112_tmp, v1111);
-    int16x8_t v1113 = vaddq_s16(v1094, v1072);
-    int16x8_t v1114 = vaddq_s16(v1073, v1083);
-    int16x8_t v1115 = vaddq_s16(v1113, v1114);
-    int16x8_t v1116 = vaddq_s16(v1115, v1111);
-    int16x8_t v1117 = vaddq_s16(v1112, v1116);
-    int16x8_t v1118 = vqrdmulhq_n_s16(v1117, 17734);
-    int16x8_t v1119 = vaddq_s16(v1108, v1118);
-    int16x8_t v1120 = vaddq_s16(v1110, v1103);
-    int16x8_t v1121_tmp = vqrdmulhq_n_s16(v1120, 13573);
-    int16x8_t v1121 = vaddq_s16(v1121_tmp, v1120);
-    int16x8_t v1122 = vaddq_s16(v1114, v1105);
-    int16x8_t v1123 = vaddq_s16(v1106, v1109);
-    int16x8_t v1124 = vaddq_s16(v1122, v1123);
-    int16x8_t v1125 = vaddq_s16(v1121, v1124);
-    int16x8_t v1126 = vaddq_s16(v1123, v1120);
-    int16x8_t v1127_tmp = vqrdmulhq_n_s16(v1126, 13573);
-    int16x8_t v1127 = vaddq_s16(v1127_tmp, v1126);
-    int16x8_t v1128 = vld1q_s16(in + in_stride * 253 + i);
-    int16x8_t v1129 = vld1q_s16(in + in_stride * 251 + i);
-    int16x8_t v1130 = vaddq_s16(v1128, v1129);
-    int16x8_t v1131 = vaddq_s16(v1130, v1047);
-    int16x8_t v1132 = vaddq_s16(v1131, v1093);
-    int16x8_t v1133 = vaddq_s16(v1132, v1113);
-    int16x8_t v1134 = vaddq_s16(v1133, v1122);
-    int16x8_t v1135 = vaddq_s16(v1134, v1126);
-    int16x8_t v1136 = vaddq_s16(v1127, v1135);
-    int16x8_t v1137 = vqrdmulhq_n_s16(v1136, 17734);
-    int16x8_t v1138 = vaddq_s16(v1125, v1137);
-    int16x8_t v1139 = vqrdmulhq_n_s16(v1138, 16705);
-    int16x8_t v1140 = vaddq_s16(v1119, v1139);
-    int16x8_t v1141 = vqrdmulhq_n_s16(v1140, 16463);
-    int16x8_t v1142 = vaddq_s16(v1102, v1141);
-    int16x8_t v1143 = vqrdmulhq_n_s16(v1142, 16404);
-    int16x8_t v1144 = vaddq_s16(v1061, v1143);
-    int16x8_t v1145 = vqrdmulhq_n_s16(v1144, 16389);
-    int16x8_t v1146 = vaddq_s16(v906, v1145);
-    int16x8_t v1147 = vaddq_s16(v908, v702);
-    int16x8_t v1148_tmp = vqrdmulhq_n_s16(v1147, 13573);
-    int16x8_t v1148 = vaddq_s16(v1148_tmp, v1147);
-    int16x8_t v1149 = vaddq_s16(v912, v704);
-    int16x8_t v1150 = vaddq_s16(v705, v914);
-    int16x8_t v1151 = vaddq_s16(v1149, v1150);
-    int16x8_t v1152 = vaddq_s16(v1148, v1151);
-    int16x8_t v1153 = vaddq_s16(v920, v708);
-    int16x8_t v1154 = vaddq_s16(v709, v922);
-    int16x8_t v1155 = vaddq_s16(v1153, v1154);
-    int16x8_t v1156_tmp = vqrdmulhq_n_s16(v1155, 13573);
-    int16x8_t v1156 = vaddq_s16(v1156_tmp, v1155);
-    int16x8_t v1157 = vaddq_s16(v928, v712);
-    int16x8_t v1158 = vaddq_s16(v713, v930);
-    int16x8_t v1159 = vaddq_s16(v1157, v1158);
-    int16x8_t v1160 = vaddq_s16(v1159, v1155);
-    int16x8_t v1161 = vaddq_s16(v1156, v1160);
-    int16x8_t v1162 = vqrdmulhq_n_s16(v1161, 17734);
-    int16x8_t v1163 = vaddq_s16(v1152, v1162);
-    int16x8_t v1164 = vaddq_s16(v939, v719);
-    int16x8_t v1165 = vaddq_s16(v720, v941);
-    int16x8_t v1166 = vaddq_s16(v1164, v1165);
-    int16x8_t v1167_tmp = vqrdmulhq_n_s16(v1166, 13573);
-    int16x8_t v1167 = vaddq_s16(v1167_tmp, v1166);
-    int16x8_t v1168 = vaddq_s16(v947, v723);
-    int16x8_t v1169 = vaddq_s16(v724, v949);
-    int16x8_t v1170 = vaddq_s16(v1168, v1169);
-    int16x8_t v1171 = vaddq_s16(v954, v726);
-    int16x8_t v1172 = vaddq_s16(v727, v956);
-    int16x8_t v1173 = vaddq_s16(v1171, v1172);
-    int16x8_t v1174 = vaddq_s16(v1170, v1173);
-    int16x8_t v1175 = vaddq_s16(v1167, v1174);
-    int16x8_t v1176 = vaddq_s16(v1173, v1166);
-    int16x8_t v1177_tmp = vqrdmulhq_n_s16(v1176, 13573);
-    int16x8_t v1177 = vaddq_s16(v1177_tmp, v1176);
-    int16x8_t v1178 = vaddq_s16(v965, v733);
-    int16x8_t v1179 = vaddq_s16(v734, v967);
-    int16x8_t v1180 = vaddq_s16(v1178, v1179);
-    int16x8_t v1181 = vaddq_s16(v1180, v1170);
-    int16x8_t v1182 = vaddq_s16(v1181, v1176);
-    int16x8_t v1183 = vaddq_s16(v1177, v1182);
-    int16x8_t v1184 = vqrdmulhq_n_s16(v1183, 17734);
-    int16x8_t v1185 = vaddq_s16(v1175, v1184);
-    int16x8_t v1186 = vqrdmulhq_n_s16(v1185, 16705);
-    int16x8_t v1187 = vaddq_s16(v1163, v1186);
-    int16x8_t v1188 = vaddq_s16(v979, v743);
-    int16x8_t v1189 = vaddq_s16(v744, v981);
-    int16x8_t v1190 = vaddq_s16(v1188, v1189);
-    int16x8_t v1191_tmp = vqrdmulhq_n_s16(v1190, 13573);
-    int16x8_t v1191 = vaddq_s16(v1191_tmp, v1190);
-    int16x8_t v1192 = vaddq_s16(v987, v747);
-    int16x8_t v1193 = vaddq_s16(v748, v989);
-    int16x8_t v1194 = vaddq_s16(v1192, v1193);
-    int16x8_t v1195 = vaddq_s16(v994, v750);
-    int16x8_t v1196 = vaddq_s16(v751, v996);
-    int16x8_t v1197 = vaddq_s16(v1195, v1196);
-    int16x8_t v1198 = vaddq_s16(v1194, v1197);
-    int16x8_t v1199 = vaddq_s16(v1191, v1198);
-    int16x8_t v1200 = vaddq_s16(v1003, v755);
-    int16x8_t v1201 = vaddq_s16(v756, v1005);
-    int16x8_t v1202 = vaddq_s16(v1200, v1201);
-    int16x8_t v1203 = vaddq_s16(v1010, v758);
-    int16x8_t v1204 = vaddq_s16(v759, v1012);
-    int16x8_t v1205 = vaddq_s16(v1203, v1204);
-    int16x8_t v1206 = vaddq_s16(v1202, v1205);
-    int16x8_t v1207_tmp = vqrdmulhq_n_s16(v1206, 13573);
-    int16x8_t v1207 = vaddq_s16(v1207_tmp, v1206);
-    int16x8_t v1208 = vaddq_s16(v1019, v763);
-    int16x8_t v1209 = vaddq_s16(v764, v1021);
-    int16x8_t v1210 = vaddq_s16(v1208, v1209);
-    int16x8_t v1211 = vaddq_s16(v1026, v766);
-    int16x8_t v1212 = vaddq_s16(v767, v1028);
-    int16x8_t v1213 = vaddq_s16(v1211, v1212);
-    int16x8_t v1214 = vaddq_s16(v1210, v1213);
-    int16x8_t v1215 = vaddq_s16(v1214, v1206);
-    int16x8_t v1216 = vaddq_s16(v1207, v1215);
-    int16x8_t v1217 = vqrdmulhq_n_s16(v1216, 17734);
-    int16x8_t v1218 = vaddq_s16(v1199, v1217);
-    int16x8_t v1219 = vaddq_s16(v1205, v1190);
-    int16x8_t v1220_tmp = vqrdmulhq_n_s16(v1219, 13573);
-    int16x8_t v1220 = vaddq_s16(v1220_tmp, v1219);
-    int16x8_t v1221 = vaddq_s16(v1213, v1194);
-    int16x8_t v1222 = vaddq_s16(v1197, v1202);
-    int16x8_t v1223 = vaddq_s16(v1221, v1222);
-    int16x8_t v1224 = vaddq_s16(v1220, v1223);
-    int16x8_t v1225 = vaddq_s16(v1222, v1219);
-    int16x8_t v1226_tmp = vqrdmulhq_n_s16(v1225, 13573);
-    int16x8_t v1226 = vaddq_s16(v1226_tmp, v1225);
-    int16x8_t v1227 = vaddq_s16(v1046, v782);
-    int16x8_t v1228 = vaddq_s16(v783, v1048);
-    int16x8_t v1229 = vaddq_s16(v1227, v1228);
-    int16x8_t v1230 = vaddq_s16(v1229, v1210);
-    int16x8_t v1231 = vaddq_s16(v1230, v1221);
-    int16x8_t v1232 = vaddq_s16(v1231, v1225);
-    int16x8_t v1233 = vaddq_s16(v1226, v1232);
-    int16x8_t v1234 = vqrdmulhq_n_s16(v1233, 17734);
-    int16x8_t v1235 = vaddq_s16(v1224, v1234);
-    int16x8_t v1236 = vqrdmulhq_n_s16(v1235, 16705);
-    int16x8_t v1237 = vaddq_s16(v1218, v1236);
-    int16x8_t v1238 = vqrdmulhq_n_s16(v1237, 16463);
-    int16x8_t v1239 = vaddq_s16(v1187, v1238);
-    int16x8_t v1240 = vaddq_s16(v982, v795);
-    int16x8_t v1241 = vaddq_s16(v796, v907);
-    int16x8_t v1242 = vaddq_s16(v1240, v1241);
-    int16x8_t v1243_tmp = vqrdmulhq_n_s16(v1242, 13573);
-    int16x8_t v1243 = vaddq_s16(v1243_tmp, v1242);
-    int16x8_t v1244 = vaddq_s16(v990, v799);
-    int16x8_t v1245 = vaddq_s16(v800, v911);
-    int16x8_t v1246 = vaddq_s16(v1244, v1245);
-    int16x8_t v1247 = vaddq_s16(v915, v802);
-    int16x8_t v1248 = vaddq_s16(v803, v993);
-    int16x8_t v1249 = vaddq_s16(v1247, v1248);
-    int16x8_t v1250 = vaddq_s16(v1246, v1249);
-    int16x8_t v1251 = vaddq_s16(v1243, v1250);
-    int16x8_t v1252 = vaddq_s16(v1006, v807);
-    int16x8_t v1253 = vaddq_s16(v808, v919);
-    int16x8_t v1254 = vaddq_s16(v1252, v1253);
-    int16x8_t v1255 = vaddq_s16(v923, v810);
-    int16x8_t v1256 = vaddq_s16(v811, v1009);
-    int16x8_t v1257 = vaddq_s16(v1255, v1256);
-    int16x8_t v1258 = vaddq_s16(v1254, v1257);
-    int16x8_t v1259_tmp = vqrdmulhq_n_s16(v1258, 13573);
-    int16x8_t v1259 = vaddq_s16(v1259_tmp, v1258);
-    int16x8_t v1260 = vaddq_s16(v1022, v815);
-    int16x8_t v1261 = vaddq_s16(v816, v927);
-    int16x8_t v1262 = vaddq_s16(v1260, v1261);
-    int16x8_t v1263 = vaddq_s16(v931, v818);
-    int16x8_t v1264 = vaddq_s16(v819, v1025);
-    int16x8_t v1265 = vaddq_s16(v1263, v1264);
-    int16x8_t v1266 = vaddq_s16(v1262, v1265);
-    int16x8_t v1267 = vaddq_s16(v1266, v1258);
-    int16x8_t v1268 = vaddq_s16(v1259, v1267);
-    int16x8_t v1269 = vqrdmulhq_n_s16(v1268, 17734);
-    int16x8_t v1270 = vaddq_s16(v1251, v1269);
-    int16x8_t v1271 = vaddq_s16(v1013, v826);
-    int16x8_t v1272 = vaddq_s16(v827, v938);
-    int16x8_t v1273 = vaddq_s16(v1271, v1272);
-    int16x8_t v1274 = vaddq_s16(v942, v829);
-    int16x8_t v1275 = vaddq_s16(v830, v978);
-    int16x8_t v1276 = vaddq_s16(v1274, v1275);
-    int16x8_t v1277 = vaddq_s16(v1273, v1276);
-    int16x8_t v1278_tmp = vqrdmulhq_n_s16(v1277, 13573);
-    int16x8_t v1278 = vaddq_s16(v1278_tmp, v1277);
-    int16x8_t v1279 = vaddq_s16(v1029, v834);
-    int16x8_t v1280 = vaddq_s16(v835, v946);
-    int16x8_t v1281 = vaddq_s16(v1279, v1280);
-    int16x8_t v1282 = vaddq_s16(v950, v837);
-    int16x8_t v1283 = vaddq_s16(v838, v986);
-    int16x8_t v1284 = vaddq_s16(v1282, v1283);
-    int16x8_t v1285 = vaddq_s16(v1281, v1284);
-    int16x8_t v1286 = vaddq_s16(v997, v841);
-    int16x8_t v1287 = vaddq_s16(v842, v953);
-    int16x8_t v1288 = vaddq_s16(v1286, v1287);
-    int16x8_t v1289 = vaddq_s16(v957, v844);
-    int16x8_t v1290 = vaddq_s16(v845, v1002);
-    int16x8_t v1291 = vaddq_s16(v1289, v1290);
-    int16x8_t v1292 = vaddq_s16(v1288, v1291);
-    int16x8_t v1293 = vaddq_s16(v1285, v1292);
-    int16x8_t v1294 = vaddq_s16(v1278, v1293);
-    int16x8_t v1295 = vaddq_s16(v1292, v1277);
-    int16x8_t v1296_tmp = vqrdmulhq_n_s16(v1295, 13573);
-    int16x8_t v1296 = vaddq_s16(v1296_tmp, v1295);
-    int16x8_t v1297 = vaddq_s16(v1049, v852);
-    int16x8_t v1298 = vaddq_s16(v853, v964);
-    int16x8_t v1299 = vaddq_s16(v1297, v1298);
-    int16x8_t v1300 = vaddq_s16(v968, v855);
-    int16x8_t v1301 = vaddq_s16(v856, v1018);
-    int16x8_t v1302 = vaddq_s16(v1300, v1301);
-    int16x8_t v1303 = vaddq_s16(v1299, v1302);
-    int16x8_t v1304 = vaddq_s16(v1303, v1285);
-    int16x8_t v1305 = vaddq_s16(v1304, v1295);
-    int16x8_t v1306 = vaddq_s16(v1296, v1305);
-    int16x8_t v1307 = vqrdmulhq_n_s16(v1306, 17734);
-    int16x8_t v1308 = vaddq_s16(v1294, v1307);
-    int16x8_t v1309 = vqrdmulhq_n_s16(v1308, 16705);
-    int16x8_t v1310 = vaddq_s16(v1270, v1309);
-    int16x8_t v1311 = vaddq_s16(v1276, v1242);
-    int16x8_t v1312_tmp = vqrdmulhq_n_s16(v1311, 13573);
-    int16x8_t v1312 = vaddq_s16(v1312_tmp, v1311);
-    int16x8_t v1313 = vaddq_s16(v1284, v1246);
-    int16x8_t v1314 = vaddq_s16(v1249, v1288);
-    int16x8_t v1315 = vaddq_s16(v1313, v1314);
-    int16x8_t v1316 = vaddq_s16(v1312, v1315);
-    int16x8_t v1317 = vaddq_s16(v1291, v1254);
-    int16x8_t v1318 = vaddq_s16(v1257, v1273);
-    int16x8_t v1319 = vaddq_s16(v1317, v1318);
-    int16x8_t v1320_tmp = vqrdmulhq_n_s16(v1319, 13573);
-    int16x8_t v1320 = vaddq_s16(v1320_tmp, v1319);
-    int16x8_t v1321 = vaddq_s16(v1302, v1262);
-    int16x8_t v1322 = vaddq_s16(v1265, v1281);
-    int16x8_t v1323 = vaddq_s16(v1321, v1322);
-    int16x8_t v1324 = vaddq_s16(v1323, v1319);
-    int16x8_t v1325 = vaddq_s16(v1320, v1324);
-    int16x8_t v1326 = vqrdmulhq_n_s16(v1325, 17734);
-    int16x8_t v1327 = vaddq_s16(v1316, v1326);
-    int16x8_t v1328 = vaddq_s16(v1318, v1311);
-    int16x8_t v1329_tmp = vqrdmulhq_n_s16(v1328, 13573);
-    int16x8_t v1329 = vaddq_s16(v1329_tmp, v1328);
-    int16x8_t v1330 = vaddq_s16(v1322, v1313);
-    int16x8_t v1331 = vaddq_s16(v1314, v1317);
-    int16x8_t v1332 = vaddq_s16(v1330, v1331);
-    int16x8_t v1333 = vaddq_s16(v1329, v1332);
-    int16x8_t v1334 = vaddq_s16(v1331, v1328);
-    int16x8_t v1335_tmp = vqrdmulhq_n_s16(v1334, 13573);
-    int16x8_t v1335 = vaddq_s16(v1335_tmp, v1334);
-    int16x8_t v1336 = vaddq_s16(v1129, v891);
-    int16x8_t v1337 = vaddq_s16(v892, v1045);
-    int16x8_t v1338 = vaddq_s16(v1336, v1337);
-    int16x8_t v1339 = vaddq_s16(v1338, v1299);
-    int16x8_t v1340 = vaddq_s16(v1339, v1321);
-    int16x8_t v1341 = vaddq_s16(v1340, v1330);
-    int16x8_t v1342 = vaddq_s16(v1341, v1334);
-    int16x8_t v1343 = vaddq_s16(v1335, v1342);
-    int16x8_t v1344 = vqrdmulhq_n_s16(v1343, 17734);
-    int16x8_t v1345 = vaddq_s16(v1333, v1344);
-    int16x8_t v1346 = vqrdmulhq_n_s16(v1345, 16705);
-    int16x8_t v1347 = vaddq_s16(v1327, v1346);
-    int16x8_t v1348 = vqrdmulhq_n_s16(v1347, 16463);
-    int16x8_t v1349 = vaddq_s16(v1310, v1348);
-    int16x8_t v1350 = vqrdmulhq_n_s16(v1349, 16404);
-    int16x8_t v1351 = vaddq_s16(v1239, v1350);
-    int16x8_t v1352 = vaddq_s16(v1241, v1147);
-    int16x8_t v1353_tmp = vqrdmulhq_n_s16(v1352, 13573);
-    int16x8_t v1353 = vaddq_s16(v1353_tmp, v1352);
-    int16x8_t v1354 = vaddq_s16(v1245, v1149);
-    int16x8_t v1355 = vaddq_s16(v1150, v1247);
-    int16x8_t v1356 = vaddq_s16(v1354, v1355);
-    int16x8_t v1357 = vaddq_s16(v1353, v1356);
-    int16x8_t v1358 = vaddq_s16(v1253, v1153);
-    int16x8_t v1359 = vaddq_s16(v1154, v1255);
-    int16x8_t v1360 = vaddq_s16(v1358, v1359);
-    int16x8_t v1361_tmp = vqrdmulhq_n_s16(v1360, 13573);
-    int16x8_t v1361 = vaddq_s16(v1361_tmp, v1360);
-    int16x8_t v1362 = vaddq_s16(v1261, v1157);
-    int16x8_t v1363 = vaddq_s16(v1158, v1263);
-    int16x8_t v1364 = vaddq_s16(v1362, v1363);
-    int16x8_t v1365 = vaddq_s16(v1364, v1360);
-    int16x8_t v1366 = vaddq_s16(v1361, v1365);
-    int16x8_t v1367 = vqrdmulhq_n_s16(v1366, 17734);
-    int16x8_t v1368 = vaddq_s16(v1357, v1367);
-    int16x8_t v1369 = vaddq_s16(v1272, v1164);
-    int16x8_t v1370 = vaddq_s16(v1165, v1274);
-    int16x8_t v1371 = vaddq_s16(v1369, v1370);
-    int16x8_t v1372_tmp = vqrdmulhq_n_s16(v1371, 13573);
-    int16x8_t v1372 = vaddq_s16(v1372_tmp, v1371);
-    int16x8_t v1373 = vaddq_s16(v1280, v1168);
-    int16x8_t v1374 = vaddq_s16(v1169, v1282);
-    int16x8_t v1375 = vaddq_s16(v1373, v1374);
-    int16x8_t v1376 = vaddq_s16(v1287, v1171);
-    int16x8_t v1377 = vaddq_s16(v1172, v1289);
-    int16x8_t v1378 = vaddq_s16(v1376, v1377);
-    int16x8_t v1379 = vaddq_s16(v1375, v1378);
-    int16x8_t v1380 = vaddq_s16(v1372, v1379);
-    int16x8_t v1381 = vaddq_s16(v1378, v1371);
-    int16x8_t v1382_tmp = vqrdmulhq_n_s16(v1381, 13573);
-    int16x8_t v1382 = vaddq_s16(v1382_tmp, v1381);
-    int16x8_t v1383 = vaddq_s16(v1298, v1178);
-    int16x8_t v1384 = vaddq_s16(v1179, v1300);
-    int16x8_t v1385 = vaddq_s16(v1383, v1384);
-    int16x8_t v1386 = vaddq_s16(v1385, v1375);
-    int16x8_t v1387 = vaddq_s16(v1386, v1381);
-    int16x8_t v1388 = vaddq_s16(v1382, v1387);
-    int16x8_t v1389 = vqrdmulhq_n_s16(v1388, 17734);
-    int16x8_t v1390 = vaddq_s16(v1380, v1389);
-    int16x8_t v1391 = vqrdmulhq_n_s16(v1390, 16705);
-    int16x8_t v1392 = vaddq_s16(v1368, v1391);
-    int16x8_t v1393 = vaddq_s16(v1275, v1188);
-    int16x8_t v1394 = vaddq_s16(v1189, v1240);
-    int16x8_t v1395 = vaddq_s16(v1393, v1394);
-    int16x8_t v1396_tmp = vqrdmulhq_n_s16(v1395, 13573);
-    int16x8_t v1396 = vaddq_s16(v1396_tmp, v1395);
-    int16x8_t v1397 = vaddq_s16(v1283, v1192);
-    int16x8_t v1398 = vaddq_s16(v1193, v1244);
-    int16x8_t v1399 = vaddq_s16(v1397, v1398);
-    int16x8_t v1400 = vaddq_s16(v1248, v1195);
-    int16x8_t v1401 = vaddq_s16(v1196, v1286);
-    int16x8_t v1402 = vaddq_s16(v1400, v1401);
-    int16x8_t v1403 = vaddq_s16(v1399, v1402);
-    int16x8_t v1404 = vaddq_s16(v1396, v1403);
-    int16x8_t v1405 = vaddq_s16(v1290, v1200);
-    int16x8_t v1406 = vaddq_s16(v1201, v1252);
-    int16x8_t v1407 = vaddq_s16(v1405, v1406);
-    int16x8_t v1408 = vaddq_s16(v1256, v1203);
-    int16x8_t v1409 = vaddq_s16(v1204, v1271);
-    int16x8_t v1410 = vaddq_s16(v1408, v1409);
-    int16x8_t v1411 = vaddq_s16(v1407, v1410);
-    int16x8_t v1412_tmp = vqrdmulhq_n_s16(v1411, 13573);
-    int16x8_t v1412 = vaddq_s16(v1412_tmp, v1411);
-    int16x8_t v1413 = vaddq_s16(v1301, v1208);
-    int16x8_t v1414 = vaddq_s16(v1209, v1260);
-    int16x8_t v1415 = vaddq_s16(v1413, v1414);
-    int16x8_t v1416 = vaddq_s16(v1264, v1211);
-    int16x8_t v1417 = vaddq_s16(v1212, v1279);
-    int16x8_t v1418 = vaddq_s16(v1416, v1417);
-    int16x8_t v1419 = vaddq_s16(v1415, v1418);
-    int16x8_t v1420 = vaddq_s16(v1419, v1411);
-    int16x8_t v1421 = vaddq_s16(v1412, v1420);
-    int16x8_t v1422 = vqrdmulhq_n_s16(v1421, 17734);
-    int16x8_t v1423 = vaddq_s16(v1404, v1422);
-    int16x8_t v1424 = vaddq_s16(v1410, v1395);
-    int16x8_t v1425_tmp = vqrdmulhq_n_s16(v1424, 13573);
-    int16x8_t v1425 = vaddq_s16(v1425_tmp, v1424);
-    int16x8_t v1426 = vaddq_s16(v1418, v1399);
-    int16x8_t v1427 = vaddq_s16(v1402, v1407);
-    int16x8_t v1428 = vaddq_s16(v1426, v1427);
-    int16x8_t v1429 = vaddq_s16(v1425, v1428);
-    int16x8_t v1430 = vaddq_s16(v1427, v1424);
-    int16x8_t v1431_tmp = vqrdmulhq_n_s16(v1430, 13573);
-    int16x8_t v1431 = vaddq_s16(v1431_tmp, v1430);
-    int16x8_t v1432 = vaddq_s16(v1337, v1227);
-    int16x8_t v1433 = vaddq_s16(v1228, v1297);
-    int16x8_t v1434 = vaddq_s16(v1432, v1433);
-    int16x8_t v1435 = vaddq_s16(v1434, v1415);
-    int16x8_t v1436 = vaddq_s16(v1435, v1426);
-    int16x8_t v1437 = vaddq_s16(v1436, v1430);
-    int16x8_t v1438 = vaddq_s16(v1431, v1437);
-    int16x8_t v1439 = vqrdmulhq_n_s16(v1438, 17734);
-    int16x8_t v1440 = vaddq_s16(v1429, v1439);
-    int16x8_t v1441 = vqrdmulhq_n_s16(v1440, 16705);
-    int16x8_t v1442 = vaddq_s16(v1423, v1441);
-    int16x8_t v1443 = vqrdmulhq_n_s16(v1442, 16463);
-    int16x8_t v1444 = vaddq_s16(v1392, v1443);
-    int16x8_t v1445 = vaddq_s16(v1394, v1352);
-    int16x8_t v1446_tmp = vqrdmulhq_n_s16(v1445, 13573);
-    int16x8_t v1446 = vaddq_s16(v1446_tmp, v1445);
-    int16x8_t v1447 = vaddq_s16(v1398, v1354);
-    int16x8_t v1448 = vaddq_s16(v1355, v1400);
-    int16x8_t v1449 = vaddq_s16(v1447, v1448);
-    int16x8_t v1450 = vaddq_s16(v1446, v1449);
-    int16x8_t v1451 = vaddq_s16(v1406, v1358);
-    int16x8_t v1452 = vaddq_s16(v1359, v1408);
-    int16x8_t v1453 = vaddq_s16(v1451, v1452);
-    int16x8_t v1454_tmp = vqrdmulhq_n_s16(v1453, 13573);
-    int16x8_t v1454 = vaddq_s16(v1454_tmp, v1453);
-    int16x8_t v1455 = vaddq_s16(v1414, v1362);
-    int16x8_t v1456 = vaddq_s16(v1363, v1416);
-    int16x8_t v1457 = vaddq_s16(v1455, v1456);
-    int16x8_t v1458 = vaddq_s16(v1457, v1453);
-    int16x8_t v1459 = vaddq_s16(v1454, v1458);
-    int16x8_t v1460 = vqrdmulhq_n_s16(v1459, 17734);
-    int16x8_t v1461 = vaddq_s16(v1450, v1460);
-    int16x8_t v1462 = vaddq_s16(v1409, v1369);
-    int16x8_t v1463 = vaddq_s16(v1370, v1393);
-    int16x8_t v1464 = vaddq_s16(v1462, v1463);
-    int16x8_t v1465_tmp = vqrdmulhq_n_s16(v1464, 13573);
-    int16x8_t v1465 = vaddq_s16(v1465_tmp, v1464);
-    int16x8_t v1466 = vaddq_s16(v1417, v1373);
-    int16x8_t v1467 = vaddq_s16(v1374, v1397);
-    int16x8_t v1468 = vaddq_s16(v1466, v1467);
-    int16x8_t v1469 = vaddq_s16(v1401, v1376);
-    int16x8_t v1470 = vaddq_s16(v1377, v1405);
-    int16x8_t v1471 = vaddq_s16(v1469, v1470);
-    int16x8_t v1472 = vaddq_s16(v1468, v1471);
-    int16x8_t v1473 = vaddq_s16(v1465, v1472);
-    int16x8_t v1474 = vaddq_s16(v1471, v1464);
-    int16x8_t v1475_tmp = vqrdmulhq_n_s16(v1474, 13573);
-    int16x8_t v1475 = vaddq_s16(v1475_tmp, v1474);
-    int16x8_t v1476 = vaddq_s16(v1433, v1383);
-    int16x8_t v1477 = vaddq_s16(v1384, v1413);
-    int16x8_t v1478 = vaddq_s16(v1476, v1477);
-    int16x8_t v1479 = vaddq_s16(v1478, v1468);
-    int16x8_t v1480 = vaddq_s16(v1479, v1474);
-    int16x8_t v1481 = vaddq_s16(v1475, v1480);
-    int16x8_t v1482 = vqrdmulhq_n_s16(v1481, 17734);
-    int16x8_t v1483 = vaddq_s16(v1473, v1482);
-    int16x8_t v1484 = vqrdmulhq_n_s16(v1483, 16705);
-    int16x8_t v1485 = vaddq_s16(v1461, v1484);
-    int16x8_t v1486 = vaddq_s16(v1463, v1445);
-    int16x8_t v1487_tmp = vqrdmulhq_n_s16(v1486, 13573);
-    int16x8_t v1487 = vaddq_s16(v1487_tmp, v1486);
-    int16x8_t v1488 = vaddq_s16(v1467, v1447);
-    int16x8_t v1489 = vaddq_s16(v1448, v1469);
-    int16x8_t v1490 = vaddq_s16(v1488, v1489);
-    int16x8_t v1491 = vaddq_s16(v1487, v1490);
-    int16x8_t v1492 = vaddq_s16(v1470, v1451);
-    int16x8_t v1493 = vaddq_s16(v1452, v1462);
-    int16x8_t v1494 = vaddq_s16(v1492, v1493);
-    int16x8_t v1495_tmp = vqrdmulhq_n_s16(v1494, 13573);
-    int16x8_t v1495 = vaddq_s16(v1495_tmp, v1494);
-    int16x8_t v1496 = vaddq_s16(v1477, v1455);
-    int16x8_t v1497 = vaddq_s16(v1456, v1466);
-    int16x8_t v1498 = vaddq_s16(v1496, v1497);
-    int16x8_t v1499 = vaddq_s16(v1498, v1494);
-    int16x8_t v1500 = vaddq_s16(v1495, v1499);
-    int16x8_t v1501 = vqrdmulhq_n_s16(v1500, 17734);
-    int16x8_t v1502 = vaddq_s16(v1491, v1501);
-    int16x8_t v1503 = vaddq_s16(v1493, v1486);
-    int16x8_t v1504_tmp = vqrdmulhq_n_s16(v1503, 13573);
-    int16x8_t v1504 = vaddq_s16(v1504_tmp, v1503);
-    int16x8_t v1505 = vaddq_s16(v1497, v1488);
-    int16x8_t v1506 = vaddq_s16(v1489, v1492);
-    int16x8_t v1507 = vaddq_s16(v1505, v1506);
-    int16x8_t v1508 = vaddq_s16(v1504, v1507);
-    int16x8_t v1509 = vaddq_s16(v1506, v1503);
-    int16x8_t v1510_tmp = vqrdmulhq_n_s16(v1509, 13573);
-    int16x8_t v1510 = vaddq_s16(v1510_tmp, v1509);
-    int16x8_t v1511 = vld1q_s16(in + in_stride * 255 + i);
-    int16x8_t v1512 = vaddq_s16(v1511, v1128);
-    int16x8_t v1513 = vaddq_s16(v1512, v1336);
-    int16x8_t v1514 = vaddq_s16(v1513, v1432);
-    int16x8_t v1515 = vaddq_s16(v1514, v1476);
-    int16x8_t v1516 = vaddq_s16(v1515, v1496);
-    int16x8_t v1517 = vaddq_s16(v1516, v1505);
-    int16x8_t v1518 = vaddq_s16(v1517, v1509);
-    int16x8_t v1519 = vaddq_s16(v1510, v1518);
-    int16x8_t v1520 = vqrdmulhq_n_s16(v1519, 17734);
-    int16x8_t v1521 = vaddq_s16(v1508, v1520);
-    int16x8_t v1522 = vqrdmulhq_n_s16(v1521, 16705);
-    int16x8_t v1523 = vaddq_s16(v1502, v1522);
-    int16x8_t v1524 = vqrdmulhq_n_s16(v1523, 16463);
-    int16x8_t v1525 = vaddq_s16(v1485, v1524);
-    int16x8_t v1526 = vqrdmulhq_n_s16(v1525, 16404);
-    int16x8_t v1527 = vaddq_s16(v1444, v1526);
-    int16x8_t v1528 = vqrdmulhq_n_s16(v1527, 16389);
-    int16x8_t v1529 = vaddq_s16(v1351, v1528);
-    int16x8_t v1530 = vqrdmulhq_n_s16(v1529, 16385);
-    int16x8_t v1531 = vaddq_s16(v1146, v1530);
-    int16x8_t v1532 = vqrdmulhq_n_s16(v1531, 16384);
-    int16x8_t v1533 = vaddq_s16(v701, v1532);
-    int16x8_t v1534 = vsubq_s16(v0, v1);
-    int16x8_t v1535 = vsubq_s16(v4, v6);
-    int16x8_t v1536_tmp = vqrdmulhq_n_s16(v1535, 10045);
-    int16x8_t v1536 = vaddq_s16(v1536_tmp, v1535);
-    int16x8_t v1537 = vaddq_s16(v1534, v1536);
-    int16x8_t v1538 = vsubq_s16(v11, v14);
-    int16x8_t v1539 = vsubq_s16(v17, v20);
-    int16x8_t v1540_tmp = vqrdmulhq_n_s16(v1539, 10045);
-    int16x8_t v1540 = vaddq_s16(v1540_tmp, v1539);
-    int16x8_t v1541 = vaddq_s16(v1538, v1540);
-    int16x8_t v1542 = vqrdmulhq_n_s16(v1541, 19705);
-    int16x8_t v1543 = vaddq_s16(v1537, v1542);
-    int16x8_t v1544 = vsubq_s16(v27, v30);
-    int16x8_t v1545 = vsubq_s16(v35, v39);
-    int16x8_t v1546_tmp = vqrdmulhq_n_s16(v1545, 10045);
-    int16x8_t v1546 = vaddq_s16(v1546_tmp, v1545);
-    int16x8_t v1547 = vaddq_s16(v1544, v1546);
-    int16x8_t v1548 = vsubq_s16(v44, v47);
-    int16x8_t v1549 = vsubq_s16(v50, v54);
-    int16x8_t v1550_tmp = vqrdmulhq_n_s16(v1549, 10045);
-    int16x8_t v1550 = vaddq_s16(v1550_tmp, v1549);
-    int16x8_t v1551 = vaddq_s16(v1548, v1550);
-    int16x8_t v1552 = vqrdmulhq_n_s16(v1551, 19705);
-    int16x8_t v1553 = vaddq_s16(v1547, v1552);
-    int16x8_t v1554 = vqrdmulhq_n_s16(v1553, 17121);
-    int16x8_t v1555 = vaddq_s16(v1543, v1554);
-    int16x8_t v1556 = vsubq_s16(v63, v66);
-    int16x8_t v1557 = vsubq_s16(v71, v75);
-    int16x8_t v1558_tmp = vqrdmulhq_n_s16(v1557, 10045);
-    int16x8_t v1558 = vaddq_s16(v1558_tmp, v1557);
-    int16x8_t v1559 = vaddq_s16(v1556, v1558);
-    int16x8_t v1560 = vsubq_s16(v82, v89);
-    int16x8_t v1561 = vsubq_s16(v92, v97);
-    int16x8_t v1562_tmp = vqrdmulhq_n_s16(v1561, 10045);
-    int16x8_t v1562 = vaddq_s16(v1562_tmp, v1561);
-    int16x8_t v1563 = vaddq_s16(v1560, v1562);
-    int16x8_t v1564 = vqrdmulhq_n_s16(v1563, 19705);
-    int16x8_t v1565 = vaddq_s16(v1559, v1564);
-    int16x8_t v1566 = vsubq_s16(v104, v107);
-    int16x8_t v1567 = vsubq_s16(v112, v116);
-    int16x8_t v1568_tmp = vqrdmulhq_n_s16(v1567, 10045);
-    int16x8_t v1568 = vaddq_s16(v1568_tmp, v1567);
-    int16x8_t v1569 = vaddq_s16(v1566, v1568);
-    int16x8_t v1570 = vsubq_s16(v121, v124);
-    int16x8_t v1571 = vsubq_s16(v127, v132);
-    int16x8_t v1572_tmp = vqrdmulhq_n_s16(v1571, 10045);
-    int16x8_t v1572 = vaddq_s16(v1572_tmp, v1571);
-    int16x8_t v1573 = vaddq_s16(v1570, v1572);
-    int16x8_t v1574 = vqrdmulhq_n_s16(v1573, 19705);
-    int16x8_t v1575 = vaddq_s16(v1569, v1574);
-    int16x8_t v1576 = vqrdmulhq_n_s16(v1575, 17121);
-    int16x8_t v1577 = vaddq_s16(v1565, v1576);
-    int16x8_t v1578 = vqrdmulhq_n_s16(v1577, 16563);
-    int16x8_t v1579 = vaddq_s16(v1555, v1578);
-    int16x8_t v1580 = vsubq_s16(v143, v146);
-    int16x8_t v1581 = vsubq_s16(v151, v155);
-    int16x8_t v1582_tmp = vqrdmulhq_n_s16(v1581, 10045);
-    int16x8_t v1582 = vaddq_s16(v1582_tmp, v1581);
-    int16x8_t v1583 = vaddq_s16(v1580, v1582);
-    int16x8_t v1584 = vsubq_s16(v162, v169);
-    int16x8_t v1585 = vsubq_s16(v172, v177);
-    int16x8_t v1586_tmp = vqrdmulhq_n_s16(v1585, 10045);
-    int16x8_t v1586 = vaddq_s16(v1586_tmp, v1585);
-    int16x8_t v1587 = vaddq_s16(v1584, v1586);
-    int16x8_t v1588 = vqrdmulhq_n_s16(v1587, 19705);
-    int16x8_t v1589 = vaddq_s16(v1583, v1588);
-    int16x8_t v1590 = vsubq_s16(v186, v193);
-    int16x8_t v1591 = vsubq_s16(v202, v210);
-    int16x8_t v1592_tmp = vqrdmulhq_n_s16(v1591, 10045);
-    int16x8_t v1592 = vaddq_s16(v1592_tmp, v1591);
-    int16x8_t v1593 = vaddq_s16(v1590, v1592);
-    int16x8_t v1594 = vsubq_s16(v215, v218);
-    int16x8_t v1595 = vsubq_s16(v221, v227);
-    int16x8_t v1596_tmp = vqrdmulhq_n_s16(v1595, 10045);
-    int16x8_t v1596 = vaddq_s16(v1596_tmp, v1595);
-    int16x8_t v1597 = vaddq_s16(v1594, v1596);
-    int16x8_t v1598 = vqrdmulhq_n_s16(v1597, 19705);
-    int16x8_t v1599 = vaddq_s16(v1593, v1598);
-    int16x8_t v1600 = vqrdmulhq_n_s16(v1599, 17121);
-    int16x8_t v1601 = vaddq_s16(v1589, v1600);
-    int16x8_t v1602 = vsubq_s16(v236, v239);
-    int16x8_t v1603 = vsubq_s16(v244, v248);
-    int16x8_t v1604_tmp = vqrdmulhq_n_s16(v1603, 10045);
-    int16x8_t v1604 = vaddq_s16(v1604_tmp, v1603);
-    int16x8_t v1605 = vaddq_s16(v1602, v1604);
-    int16x8_t v1606 = vsubq_s16(v255, v262);
-    int16x8_t v1607 = vsubq_s16(v265, v270);
-    int16x8_t v1608_tmp = vqrdmulhq_n_s16(v1607, 10045);
-    int16x8_t v1608 = vaddq_s16(v1608_tmp, v1607);
-    int16x8_t v1609 = vaddq_s16(v1606, v1608);
-    int16x8_t v1610 = vqrdmulhq_n_s16(v1609, 19705);
-    int16x8_t v1611 = vaddq_s16(v1605, v1610);
-    int16x8_t v1612 = vsubq_s16(v277, v280);
-    int16x8_t v1613 = vsubq_s16(v285, v289);
-    int16x8_t v1614_tmp = vqrdmulhq_n_s16(v1613, 10045);
-    int16x8_t v1614 = vaddq_s16(v1614_tmp, v1613);
-    int16x8_t v1615 = vaddq_s16(v1612, v1614);
-    int16x8_t v1616 = vsubq_s16(v294, v297);
-    int16x8_t v1617 = vsubq_s16(v300, v306);
-    int16x8_t v1618_tmp = vqrdmulhq_n_s16(v1617, 10045);
-    int16x8_t v1618 = vaddq_s16(v1618_tmp, v1617);
-    int16x8_t v1619 = vaddq_s16(v1616, v1618);
-    int16x8_t v1620 = vqrdmulhq_n_s16(v1619, 19705);
-    int16x8_t v1621 = vaddq_s16(v1615, v1620);
-    int16x8_t v1622 = vqrdmulhq_n_s16(v1621, 17121);
-    int16x8_t v1623 = vaddq_s16(v1611, v1622);
-    int16x8_t v1624 = vqrdmulhq_n_s16(v1623, 16563);
-    int16x8_t v1625 = vaddq_s16(v1601, v1624);
-    int16x8_t v1626 = vqrdmulhq_n_s16(v1625, 16429);
-    int16x8_t v1627 = vaddq_s16(v1579, v1626);
-    int16x8_t v1628 = vsubq_s16(v319, v322);
-    int16x8_t v1629 = vsubq_s16(v327, v331);
-    int16x8_t v1630_tmp = vqrdmulhq_n_s16(v1629, 10045);
-    int16x8_t v1630 = vaddq_s16(v1630_tmp, v1629);
-    int16x8_t v1631 = vaddq_s16(v1628, v1630);
-    int16x8_t v1632 = vsubq_s16(v338, v345);
-    int16x8_t v1633 = vsubq_s16(v348, v353);
-    int16x8_t v1634_tmp = vqrdmulhq_n_s16(v1633, 10045);
-    int16x8_t v1634 = vaddq_s16(v1634_tmp, v1633);
-    int16x8_t v1635 = vaddq_s16(v1632, v1634);
-    int16x8_t v1636 = vqrdmulhq_n_s16(v1635, 19705);
-    int16x8_t v1637 = vaddq_s16(v1631, v1636);
-    int16x8_t v1638 = vsubq_s16(v362, v369);
-    int16x8_t v1639 = vsubq_s16(v378, v386);
-    int16x8_t v1640_tmp = vqrdmulhq_n_s16(v1639, 10045);
-    int16x8_t v1640 = vaddq_s16(v1640_tmp, v1639);
-    int16x8_t v1641 = vaddq_s16(v1638, v1640);
-    int16x8_t v1642 = vsubq_s16(v391, v394);
-    int16x8_t v1643 = vsubq_s16(v397, v403);
-    int16x8_t v1644_tmp = vqrdmulhq_n_s16(v1643, 10045);
-    int16x8_t v1644 = vaddq_s16(v1644_tmp, v1643);
-    int16x8_t v1645 = vaddq_s16(v1642, v1644);
-    int16x8_t v1646 = vqrdmulhq_n_s16(v1645, 19705);
-    int16x8_t v1647 = vaddq_s16(v1641, v1646);
-    int16x8_t v1648 = vqrdmulhq_n_s16(v1647, 17121);
-    int16x8_t v1649 = vaddq_s16(v1637, v1648);
-    int16x8_t v1650 = vsubq_s16(v414, v421);
-    int16x8_t v1651 = vsubq_s16(v430, v438);
-    int16x8_t v1652_tmp = vqrdmulhq_n_s16(v1651, 10045);
-    int16x8_t v1652 = vaddq_s16(v1652_tmp, v1651);
-    int16x8_t v1653 = vaddq_s16(v1650, v1652);
-    int16x8_t v1654 = vsubq_s16(v449, v464);
-    int16x8_t v1655 = vsubq_s16(v467, v476);
-    int16x8_t v1656_tmp = vqrdmulhq_n_s16(v1655, 10045);
-    int16x8_t v1656 = vaddq_s16(v1656_tmp, v1655);
-    int16x8_t v1657 = vaddq_s16(v1654, v1656);
-    int16x8_t v1658 = vqrdmulhq_n_s16(v1657, 19705);
-    int16x8_t v1659 = vaddq_s16(v1653, v1658);
-    int16x8_t v1660 = vsubq_s16(v483, v486);
-    int16x8_t v1661 = vsubq_s16(v491, v495);
-    int16x8_t v1662_tmp = vqrdmulhq_n_s16(v1661, 10045);
-    int16x8_t v1662 = vaddq_s16(v1662_tmp, v1661);
-    int16x8_t v1663 = vaddq_s16(v1660, v1662);
-    int16x8_t v1664 = vsubq_s16(v500, v503);
-    int16x8_t v1665 = vsubq_s16(v506, v513);
-    int16x8_t v1666_tmp = vqrdmulhq_n_s16(v1665, 10045);
-    int16x8_t v1666 = vaddq_s16(v1666_tmp, v1665);
-    int16x8_t v1667 = vaddq_s16(v1664, v1666);
-    int16x8_t v1668 = vqrdmulhq_n_s16(v1667, 19705);
-    int16x8_t v1669 = vaddq_s16(v1663, v1668);
-    int16x8_t v1670 = vqrdmulhq_n_s16(v1669, 17121);
-    int16x8_t v1671 = vaddq_s16(v1659, v1670);
-    int16x8_t v1672 = vqrdmulhq_n_s16(v1671, 16563);
-    int16x8_t v1673 = vaddq_s16(v1649, v1672);
-    int16x8_t v1674 = vsubq_s16(v524, v527);
-    int16x8_t v1675 = vsubq_s16(v532, v536);
-    int16x8_t v1676_tmp = vqrdmulhq_n_s16(v1675, 10045);
-    int16x8_t v1676 = vaddq_s16(v1676_tmp, v1675);
-    int16x8_t v1677 = vaddq_s16(v1674, v1676);
-    int16x8_t v1678 = vsubq_s16(v543, v550);
-    int16x8_t v1679 = vsubq_s16(v553, v558);
-    int16x8_t v1680_tmp = vqrdmulhq_n_s16(v1679, 10045);
-    int16x8_t v1680 = vaddq_s16(v1680_tmp, v1679);
-    int16x8_t v1681 = vaddq_s16(v1678, v1680);
-    int16x8_t v1682 = vqrdmulhq_n_s16(v1681, 19705);
-    int16x8_t v1683 = vaddq_s16(v1677, v1682);
-    int16x8_t v1684 = vsubq_s16(v567, v574);
-    int16x8_t v1685 = vsubq_s16(v583, v591);
-    int16x8_t v1686_tmp = vqrdmulhq_n_s16(v1685, 10045);
-    int16x8_t v1686 = vaddq_s16(v1686_tmp, v1685);
-    int16x8_t v1687 = vaddq_s16(v1684, v1686);
-    int16x8_t v1688 = vsubq_s16(v596, v599);
-    int16x8_t v1689 = vsubq_s16(v602, v608);
-    int16x8_t v1690_tmp = vqrdmulhq_n_s16(v1689, 10045);
-    int16x8_t v1690 = vaddq_s16(v1690_tmp, v1689);
-    int16x8_t v1691 = vaddq_s16(v1688, v1690);
-    int16x8_t v1692 = vqrdmulhq_n_s16(v1691, 19705);
-    int16x8_t v1693 = vaddq_s16(v1687, v1692);
-    int16x8_t v1694 = vqrdmulhq_n_s16(v1693, 17121);
-    int16x8_t v1695 = vaddq_s16(v1683, v1694);
-    int16x8_t v1696 = vsubq_s16(v617, v620);
-    int16x8_t v1697 = vsubq_s16(v625, v629);
-    int16x8_t v1698_tmp = vqrdmulhq_n_s16(v1697, 10045);
-    int16x8_t v1698 = vaddq_s16(v1698_tmp, v1697);
-    int16x8_t v1699 = vaddq_s16(v1696, v1698);
-    int16x8_t v1700 = vsubq_s16(v636, v643);
-    int16x8_t v1701 = vsubq_s16(v646, v651);
-    int16x8_t v1702_tmp = vqrdmulhq_n_s16(v1701, 10045);
-    int16x8_t v1702 = vaddq_s16(v1702_tmp, v1701);
-    int16x8_t v1703 = vaddq_s16(v1700, v1702);
-    int16x8_t v1704 = vqrdmulhq_n_s16(v1703, 19705);
-    int16x8_t v1705 = vaddq_s16(v1699, v1704);
-    int16x8_t v1706 = vsubq_s16(v658, v661);
-    int16x8_t v1707 = vsubq_s16(v666, v670);
-    int16x8_t v1708_tmp = vqrdmulhq_n_s16(v1707, 10045);
-    int16x8_t v1708 = vaddq_s16(v1708_tmp, v1707);
-    int16x8_t v1709 = vaddq_s16(v1706, v1708);
-    int16x8_t v1710 = vsubq_s16(v675, v678);
-    int16x8_t v1711 = vsubq_s16(v681, v688);
-    int16x8_t v1712_tmp = vqrdmulhq_n_s16(v1711, 10045);
-    int16x8_t v1712 = vaddq_s16(v1712_tmp, v1711);
-    int16x8_t v1713 = vaddq_s16(v1710, v1712);
-    int16x8_t v1714 = vqrdmulhq_n_s16(v1713, 19705);
-    int16x8_t v1715 = vaddq_s16(v1709, v1714);
-    int16x8_t v1716 = vqrdmulhq_n_s16(v1715, 17121);
-    int16x8_t v1717 = vaddq_s16(v1705, v1716);
-    int16x8_t v1718 = vqrdmulhq_n_s16(v1717, 16563);
-    int16x8_t v1719 = vaddq_s16(v1695, v1718);
-    int16x8_t v1720 = vqrdmulhq_n_s16(v1719, 16429);
-    int16x8_t v1721 = vaddq_s16(v1673, v1720);
-    int16x8_t v1722 = vqrdmulhq_n_s16(v1721, 16395);
-    int16x8_t v1723 = vaddq_s16(v1627, v1722);
-    int16x8_t v1724 = vsubq_s16(v703, v706);
-    int16x8_t v1725 = vsubq_s16(v711, v715);
-    int16x8_t v1726_tmp = vqrdmulhq_n_s16(v1725, 10045);
-    int16x8_t v1726 = vaddq_s16(v1726_tmp, v1725);
-    int16x8_t v1727 = vaddq_s16(v1724, v1726);
-    int16x8_t v1728 = vsubq_s16(v722, v729);
-    int16x8_t v1729 = vsubq_s16(v732, v737);
-    int16x8_t v1730_tmp = vqrdmulhq_n_s16(v1729, 10045);
-    int16x8_t v1730 = vaddq_s16(v1730_tmp, v1729);
-    int16x8_t v1731 = vaddq_s16(v1728, v1730);
-    int16x8_t v1732 = vqrdmulhq_n_s16(v1731, 19705);
-    int16x8_t v1733 = vaddq_s16(v1727, v1732);
-    int16x8_t v1734 = vsubq_s16(v746, v753);
-    int16x8_t v1735 = vsubq_s16(v762, v770);
-    int16x8_t v1736_tmp = vqrdmulhq_n_s16(v1735, 10045);
-    int16x8_t v1736 = vaddq_s16(v1736_tmp, v1735);
-    int16x8_t v1737 = vaddq_s16(v1734, v1736);
-    int16x8_t v1738 = vsubq_s16(v775, v778);
-    int16x8_t v1739 = vsubq_s16(v781, v787);
-    int16x8_t v1740_tmp = vqrdmulhq_n_s16(v1739, 10045);
-    int16x8_t v1740 = vaddq_s16(v1740_tmp, v1739);
-    int16x8_t v1741 = vaddq_s16(v1738, v1740);
-    int16x8_t v1742 = vqrdmulhq_n_s16(v1741, 19705);
-    int16x8_t v1743 = vaddq_s16(v1737, v1742);
-    int16x8_t v1744 = vqrdmulhq_n_s16(v1743, 17121);
-    int16x8_t v1745 = vaddq_s16(v1733, v1744);
-    int16x8_t v1746 = vsubq_s16(v798, v805);
-    int16x8_t v1747 = vsubq_s16(v814, v822);
-    int16x8_t v1748_tmp = vqrdmulhq_n_s16(v1747, 10045);
-    int16x8_t v1748 = vaddq_s16(v1748_tmp, v1747);
-    int16x8_t v1749 = vaddq_s16(v1746, v1748);
-    int16x8_t v1750 = vsubq_s16(v833, v848);
-    int16x8_t v1751 = vsubq_s16(v851, v860);
-    int16x8_t v1752_tmp = vqrdmulhq_n_s16(v1751, 10045);
-    int16x8_t v1752 = vaddq_s16(v1752_tmp, v1751);
-    int16x8_t v1753 = vaddq_s16(v1750, v1752);
-    int16x8_t v1754 = vqrdmulhq_n_s16(v1753, 19705);
-    int16x8_t v1755 = vaddq_s16(v1749, v1754);
-    int16x8_t v1756 = vsubq_s16(v867, v870);
-    int16x8_t v1757 = vsubq_s16(v875, v879);
-    int16x8_t v1758_tmp = vqrdmulhq_n_s16(v1757, 10045);
-    int16x8_t v1758 = vaddq_s16(v1758_tmp, v1757);
-    int16x8_t v1759 = vaddq_s16(v1756, v1758);
-    int16x8_t v1760 = vsubq_s16(v884, v887);
-    int16x8_t v1761 = vsubq_s16(v890, v897);
-    int16x8_t v1762_tmp = vqrdmulhq_n_s16(v1761, 10045);
-    int16x8_t v1762 = vaddq_s16(v1762_tmp, v1761);
-    int16x8_t v1763 = vaddq_s16(v1760, v1762);
-    int16x8_t v1764 = vqrdmulhq_n_s16(v1763, 19705);
-    int16x8_t v1765 = vaddq_s16(v1759, v1764);
-    int16x8_t v1766 = vqrdmulhq_n_s16(v1765, 17121);
-    int16x8_t v1767 = vaddq_s16(v1755, v1766);
-    int16x8_t v1768 = vqrdmulhq_n_s16(v1767, 16563);
-    int16x8_t v1769 = vaddq_s16(v1745, v1768);
-    int16x8_t v1770 = vsubq_s16(v910, v917);
-    int16x8_t v1771 = vsubq_s16(v926, v934);
-    int16x8_t v1772_tmp = vqrdmulhq_n_s16(v1771, 10045);
-    int16x8_t v1772 = vaddq_s16(v1772_tmp, v1771);
-    int16x8_t v1773 = vaddq_s16(v1770, v1772);
-    int16x8_t v1774 = vsubq_s16(v945, v960);
-    int16x8_t v1775 = vsubq_s16(v963, v972);
-    int16x8_t v1776_tmp = vqrdmulhq_n_s16(v1775, 10045);
-    int16x8_t v1776 = vaddq_s16(v1776_tmp, v1775);
-    int16x8_t v1777 = vaddq_s16(v1774, v1776);
-    int16x8_t v1778 = vqrdmulhq_n_s16(v1777, 19705);
-    int16x8_t v1779 = vaddq_s16(v1773, v1778);
-    int16x8_t v1780 = vsubq_s16(v985, v1000);
-    int16x8_t v1781 = vsubq_s16(v1017, v1033);
-    int16x8_t v1782_tmp = vqrdmulhq_n_s16(v1781, 10045);
-    int16x8_t v1782 = vaddq_s16(v1782_tmp, v1781);
-    int16x8_t v1783 = vaddq_s16(v1780, v1782);
-    int16x8_t v1784 = vsubq_s16(v1038, v1041);
-    int16x8_t v1785 = vsubq_s16(v1044, v1054);
-    int16x8_t v1786_tmp = vqrdmulhq_n_s16(v1785, 10045);
-    int16x8_t v1786 = vaddq_s16(v1786_tmp, v1785);
-    int16x8_t v1787 = vaddq_s16(v1784, v1786);
-    int16x8_t v1788 = vqrdmulhq_n_s16(v1787, 19705);
-    int16x8_t v1789 = vaddq_s16(v1783, v1788);
-    int16x8_t v1790 = vqrdmulhq_n_s16(v1789, 17121);
-    int16x8_t v1791 = vaddq_s16(v1779, v1790);
-    int16x8_t v1792 = vsubq_s16(v1063, v1066);
-    int16x8_t v1793 = vsubq_s16(v1071, v1075);
-    int16x8_t v1794_tmp = vqrdmulhq_n_s16(v1793, 10045);
-    int16x8_t v1794 = vaddq_s16(v1794_tmp, v1793);
-    int16x8_t v1795 = vaddq_s16(v1792, v1794);
-    int16x8_t v1796 = vsubq_s16(v1082, v1089);
-    int16x8_t v1797 = vsubq_s16(v1092, v1097);
-    int16x8_t v1798_tmp = vqrdmulhq_n_s16(v1797, 10045);
-    int16x8_t v1798 = vaddq_s16(v1798_tmp, v1797);
-    int16x8_t v1799 = vaddq_s16(v1796, v1798);
-    int16x8_t v1800 = vqrdmulhq_n_s16(v1799, 19705);
-    int16x8_t v1801 = vaddq_s16(v1795, v1800);
-    int16x8_t v1802 = vsubq_s16(v1104, v1107);
-    int16x8_t v1803 = vsubq_s16(v1112, v1116);
-    int16x8_t v1804_tmp = vqrdmulhq_n_s16(v1803, 10045);
-    int16x8_t v1804 = vaddq_s16(v1804_tmp, v1803);
-    int16x8_t v1805 = vaddq_s16(v1802, v1804);
-    int16x8_t v1806 = vsubq_s16(v1121, v1124);
-    int16x8_t v1807 = vsubq_s16(v1127, v1135);
-    int16x8_t v1808_tmp = vqrdmulhq_n_s16(v1807, 10045);
-    int16x8_t v1808 = vaddq_s16(v1808_tmp, v1807);
-    int16x8_t v1809 = vaddq_s16(v1806, v1808);
-    int16x8_t v1810 = vqrdmulhq_n_s16(v1809, 19705);
-    int16x8_t v1811 = vaddq_s16(v1805, v1810);
-    int16x8_t v1812 = vqrdmulhq_n_s16(v1811, 17121);
-    int16x8_t v1813 = vaddq_s16(v1801, v1812);
-    int16x8_t v1814 = vqrdmulhq_n_s16(v1813, 16563);
-    int16x8_t v1815 = vaddq_s16(v1791, v1814);
-    int16x8_t v1816 = vqrdmulhq_n_s16(v1815, 16429);
-    int16x8_t v1817 = vaddq_s16(v1769, v1816);
-    int16x8_t v1818 = vsubq_s16(v1148, v1151);
-    int16x8_t v1819 = vsubq_s16(v1156, v1160);
-    int16x8_t v1820_tmp = vqrdmulhq_n_s16(v1819, 10045);
-    int16x8_t v1820 = vaddq_s16(v1820_tmp, v1819);
-    int16x8_t v1821 = vaddq_s16(v1818, v1820);
-    int16x8_t v1822 = vsubq_s16(v1167, v1174);
-    int16x8_t v1823 = vsubq_s16(v1177, v1182);
-    int16x8_t v1824_tmp = vqrdmulhq_n_s16(v1823, 10045);
-    int16x8_t v1824 = vaddq_s16(v1824_tmp, v1823);
-    int16x8_t v1825 = vaddq_s16(v1822, v1824);
-    int16x8_t v1826 = vqrdmulhq_n_s16(v1825, 19705);
-    int16x8_t v1827 = vaddq_s16(v1821, v1826);
-    int16x8_t v1828 = vsubq_s16(v1191, v1198);
-    int16x8_t v1829 = vsubq_s16(v1207, v1215);
-    int16x8_t v1830_tmp = vqrdmulhq_n_s16(v1829, 10045);
-    int16x8_t v1830 = vaddq_s16(v1830_tmp, v1829);
-    int16x8_t v1831 = vaddq_s16(v1828, v1830);
-    int16x8_t v1832 = vsubq_s16(v1220, v1223);
-    int16x8_t v1833 = vsubq_s16(v1226, v1232);
-    int16x8_t v1834_tmp = vqrdmulhq_n_s16(v1833, 10045);
-    int16x8_t v1834 = vaddq_s16(v1834_tmp, v1833);
-    int16x8_t v1835 = vaddq_s16(v1832, v1834);
-    int16x8_t v1836 = vqrdmulhq_n_s16(v1835, 19705);
-    int16x8_t v1837 = vaddq_s16(v1831, v1836);
-    int16x8_t v1838 = vqrdmulhq_n_s16(v1837, 17121);
-    int16x8_t v1839 = vaddq_s16(v1827, v1838);
-    int16x8_t v1840 = vsubq_s16(v1243, v1250);
-    int16x8_t v1841 = vsubq_s16(v1259, v1267);
-    int16x8_t v1842_tmp = vqrdmulhq_n_s16(v1841, 10045);
-    int16x8_t v1842 = vaddq_s16(v1842_tmp, v1841);
-    int16x8_t v1843 = vaddq_s16(v1840, v1842);
-    int16x8_t v1844 = vsubq_s16(v1278, v1293);
-    int16x8_t v1845 = vsubq_s16(v1296, v1305);
-    int16x8_t v1846_tmp = vqrdmulhq_n_s16(v1845, 10045);
-    int16x8_t v1846 = vaddq_s16(v1846_tmp, v1845);
-    int16x8_t v1847 = vaddq_s16(v1844, v1846);
-    int16x8_t v1848 = vqrdmulhq_n_s16(v1847, 19705);
-    int16x8_t v1849 = vaddq_s16(v1843, v1848);
-    int16x8_t v1850 = vsubq_s16(v1312, v1315);
-    int16x8_t v1851 = vsubq_s16(v1320, v1324);
-    int16x8_t v1852_tmp = vqrdmulhq_n_s16(v1851, 10045);
-    int16x8_t v1852 = vaddq_s16(v1852_tmp, v1851);
-    int16x8_t v1853 = vaddq_s16(v1850, v1852);
-    int16x8_t v1854 = vsubq_s16(v1329, v1332);
-    int16x8_t v1855 = vsubq_s16(v1335, v1342);
-    int16x8_t v1856_tmp = vqrdmulhq_n_s16(v1855, 10045);
-    int16x8_t v1856 = vaddq_s16(v1856_tmp, v1855);
-    int16x8_t v1857 = vaddq_s16(v1854, v1856);
-    int16x8_t v1858 = vqrdmulhq_n_s16(v1857, 19705);
-    int16x8_t v1859 = vaddq_s16(v1853, v1858);
-    int16x8_t v1860 = vqrdmulhq_n_s16(v1859, 17121);
-    int16x8_t v1861 = vaddq_s16(v1849, v1860);
-    int16x8_t v1862 = vqrdmulhq_n_s16(v1861, 16563);
-    int16x8_t v1863 = vaddq_s16(v1839, v1862);
-    int16x8_t v1864 = vsubq_s16(v1353, v1356);
-    int16x8_t v1865 = vsubq_s16(v1361, v1365);
-    int16x8_t v1866_tmp = vqrdmulhq_n_s16(v1865, 10045);
-    int16x8_t v1866 = vaddq_s16(v1866_tmp, v1865);
-    int16x8_t v1867 = vaddq_s16(v1864, v1866);
-    int16x8_t v1868 = vsubq_s16(v1372, v1379);
-    int16x8_t v1869 = vsubq_s16(v1382, v1387);
-    int16x8_t v1870_tmp = vqrdmulhq_n_s16(v1869, 10045);
-    int16x8_t v1870 = vaddq_s16(v1870_tmp, v1869);
-    int16x8_t v1871 = vaddq_s16(v1868, v1870);
-    int16x8_t v1872 = vqrdmulhq_n_s16(v1871, 19705);
-    int16x8_t v1873 = vaddq_s16(v1867, v1872);
-    int16x8_t v1874 = vsubq_s16(v1396, v1403);
-    int16x8_t v1875 = vsubq_s16(v1412, v1420);
-    int16x8_t v1876_tmp = vqrdmulhq_n_s16(v1875, 10045);
-    int16x8_t v1876 = vaddq_s16(v1876_tmp, v1875);
-    int16x8_t v1877 = vaddq_s16(v1874, v1876);
-    int16x8_t v1878 = vsubq_s16(v1425, v1428);
-    int16x8_t v1879 = vsubq_s16(v1431, v1437);
-    int16x8_t v1880_tmp = vqrdmulhq_n_s16(v1879, 10045);
-    int16x8_t v1880 = vaddq_s16(v1880_tmp, v1879);
-    int16x8_t v1881 = vaddq_s16(v1878, v1880);
-    int16x8_t v1882 = vqrdmulhq_n_s16(v1881, 19705);
-    int16x8_t v1883 = vaddq_s16(v1877, v1882);
-    int16x8_t v1884 = vqrdmulhq_n_s16(v1883, 17121);
-    int16x8_t v1885 = vaddq_s16(v1873, v1884);
-    int16x8_t v1886 = vsubq_s16(v1446, v1449);
-    int16x8_t v1887 = vsubq_s16(v1454, v1458);
-    int16x8_t v1888_tmp = vqrdmulhq_n_s16(v1887, 10045);
-    int16x8_t v1888 = vaddq_s16(v1888_tmp, v1887);
-    int16x8_t v1889 = vaddq_s16(v1886, v1888);
-    int16x8_t v1890 = vsubq_s16(v1465, v1472);
-    int16x8_t v1891 = vsubq_s16(v1475, v1480);
-    int16x8_t v1892_tmp = vqrdmulhq_n_s16(v1891, 10045);
-    int16x8_t v1892 = vaddq_s16(v1892_tmp, v1891);
-    int16x8_t v1893 = vaddq_s16(v1890, v1892);
-    int16x8_t v1894 = vqrdmulhq_n_s16(v1893, 19705);
-    int16x8_t v1895 = vaddq_s16(v1889, v1894);
-    int16x8_t v1896 = vsubq_s16(v1487, v1490);
-    int16x8_t v1897 = vsubq_s16(v1495, v1499);
-    int16x8_t v1898_tmp = vqrdmulhq_n_s16(v1897, 10045);
-    int16x8_t v1898 = vaddq_s16(v1898_tmp, v1897);
-    int16x8_t v1899 = vaddq_s16(v1896, v1898);
-    int16x8_t v1900 = vsubq_s16(v1504, v1507);
-    int16x8_t v1901 = vsubq_s16(v1510, v1518);
-    int16x8_t v1902_tmp = vqrdmulhq_n_s16(v1901, 10045);
-    int16x8_t v1902 = vaddq_s16(v1902_tmp, v1901);
-    int16x8_t v1903 = vaddq_s16(v1900, v1902);
-    int16x8_t v1904 = vqrdmulhq_n_s16(v1903, 19705);
-    int16x8_t v1905 = vaddq_s16(v1899, v1904);
-    int16x8_t v1906 = vqrdmulhq_n_s16(v1905, 17121);
-    int16x8_t v1907 = vaddq_s16(v1895, v1906);
-    int16x8_t v1908 = vqrdmulhq_n_s16(v1907, 16563);
-    int16x8_t v1909 = vaddq_s16(v1885, v1908);
-    int16x8_t v1910 = vqrdmulhq_n_s16(v1909, 16429);
-    int16x8_t v1911 = vaddq_s16(v1863, v1910);
-    int16x8_t v1912 = vqrdmulhq_n_s16(v1911, 16395);
-    int16x8_t v1913 = vaddq_s16(v1817, v1912);
-    int16x8_t v1914 = vqrdmulhq_n_s16(v1913, 16387);
-    int16x8_t v1915 = vaddq_s16(v1723, v1914);
-    int16x8_t v1916 = vsubq_s16(v1534, v1536);
-    int16x8_t v1917 = vsubq_s16(v1538, v1540);
-    int16x8_t v1918 = vqrdmulhq_n_s16(v1917, 29490);
-    int16x8_t v1919 = vaddq_s16(v1916, v1918);
-    int16x8_t v1920 = vsubq_s16(v1544, v1546);
-    int16x8_t v1921 = vsubq_s16(v1548, v1550);
-    int16x8_t v1922 = vqrdmulhq_n_s16(v1921, 29490);
-    int16x8_t v1923 = vaddq_s16(v1920, v1922);
-    int16x8_t v1924 = vqrdmulhq_n_s16(v1923, 18578);
-    int16x8_t v1925 = vaddq_s16(v1919, v1924);
-    int16x8_t v1926 = vsubq_s16(v1556, v1558);
-    int16x8_t v1927 = vsubq_s16(v1560, v1562);
-    int16x8_t v1928 = vqrdmulhq_n_s16(v1927, 29490);
-    int16x8_t v1929 = vaddq_s16(v1926, v1928);
-    int16x8_t v1930 = vsubq_s16(v1566, v1568);
-    int16x8_t v1931 = vsubq_s16(v1570, v1572);
-    int16x8_t v1932 = vqrdmulhq_n_s16(v1931, 29490);
-    int16x8_t v1933 = vaddq_s16(v1930, v1932);
-    int16x8_t v1934 = vqrdmulhq_n_s16(v1933, 18578);
-    int16x8_t v1935 = vaddq_s16(v1929, v1934);
-    int16x8_t v1936 = vqrdmulhq_n_s16(v1935, 16890);
-    int16x8_t v1937 = vaddq_s16(v1925, v1936);
-    int16x8_t v1938 = vsubq_s16(v1580, v1582);
-    int16x8_t v1939 = vsubq_s16(v1584, v1586);
-    int16x8_t v1940 = vqrdmulhq_n_s16(v1939, 29490);
-    int16x8_t v1941 = vaddq_s16(v1938, v1940);
-    int16x8_t v1942 = vsubq_s16(v1590, v1592);
-    int16x8_t v1943 = vsubq_s16(v1594, v1596);
-    int16x8_t v1944 = vqrdmulhq_n_s16(v1943, 29490);
-    int16x8_t v1945 = vaddq_s16(v1942, v1944);
-    int16x8_t v1946 = vqrdmulhq_n_s16(v1945, 18578);
-    int16x8_t v1947 = vaddq_s16(v1941, v1946);
-    int16x8_t v1948 = vsubq_s16(v1602, v1604);
-    int16x8_t v1949 = vsubq_s16(v1606, v1608);
-    int16x8_t v1950 = vqrdmulhq_n_s16(v1949, 29490);
-    int16x8_t v1951 = vaddq_s16(v1948, v1950);
-    int16x8_t v1952 = vsubq_s16(v1612, v1614);
-    int16x8_t v1953 = vsubq_s16(v1616, v1618);
-    int16x8_t v1954 = vqrdmulhq_n_s16(v1953, 29490);
-    int16x8_t v1955 = vaddq_s16(v1952, v1954);
-    int16x8_t v1956 = vqrdmulhq_n_s16(v1955, 18578);
-    int16x8_t v1957 = vaddq_s16(v1951, v1956);
-    int16x8_t v1958 = vqrdmulhq_n_s16(v1957, 16890);
-    int16x8_t v1959 = vaddq_s16(v1947, v1958);
-    int16x8_t v1960 = vqrdmulhq_n_s16(v1959, 16508);
-    int16x8_t v1961 = vaddq_s16(v1937, v1960);
-    int16x8_t v1962 = vsubq_s16(v1628, v1630);
-    int16x8_t v1963 = vsubq_s16(v1632, v1634);
-    int16x8_t v1964 = vqrdmulhq_n_s16(v1963, 29490);
-    int16x8_t v1965 = vaddq_s16(v1962, v1964);
-    int16x8_t v1966 = vsubq_s16(v1638, v1640);
-    int16x8_t v1967 = vsubq_s16(v1642, v1644);
-    int16x8_t v1968 = vqrdmulhq_n_s16(v1967, 29490);
-    int16x8_t v1969 = vaddq_s16(v1966, v1968);
-    int16x8_t v1970 = vqrdmulhq_n_s16(v1969, 18578);
-    int16x8_t v1971 = vaddq_s16(v1965, v1970);
-    int16x8_t v1972 = vsubq_s16(v1650, v1652);
-    int16x8_t v1973 = vsubq_s16(v1654, v1656);
-    int16x8_t v1974 = vqrdmulhq_n_s16(v1973, 29490);
-    int16x8_t v1975 = vaddq_s16(v1972, v1974);
-    int16x8_t v1976 = vsubq_s16(v1660, v1662);
-    int16x8_t v1977 = vsubq_s16(v1664, v1666);
-    int16x8_t v1978 = vqrdmulhq_n_s16(v1977, 29490);
-    int16x8_t v1979 = vaddq_s16(v1976, v1978);
-    int16x8_t v1980 = vqrdmulhq_n_s16(v1979, 18578);
-    int16x8_t v1981 = vaddq_s16(v1975, v1980);
-    int16x8_t v1982 = vqrdmulhq_n_s16(v1981, 16890);
-    int16x8_t v1983 = vaddq_s16(v1971, v1982);
-    int16x8_t v1984 = vsubq_s16(v1674, v1676);
-    int16x8_t v1985 = vsubq_s16(v1678, v1680);
-    int16x8_t v1986 = vqrdmulhq_n_s16(v1985, 29490);
-    int16x8_t v1987 = vaddq_s16(v1984, v1986);
-    int16x8_t v1988 = vsubq_s16(v1684, v1686);
-    int16x8_t v1989 = vsubq_s16(v1688, v1690);
-    int16x8_t v1990 = vqrdmulhq_n_s16(v1989, 29490);
-    int16x8_t v1991 = vaddq_s16(v1988, v1990);
-    int16x8_t v1992 = vqrdmulhq_n_s16(v1991, 18578);
-    int16x8_t v1993 = vaddq_s16(v1987, v1992);
-    int16x8_t v1994 = vsubq_s16(v1696, v1698);
-    int16x8_t v1995 = vsubq_s16(v1700, v1702);
-    int16x8_t v1996 = vqrdmulhq_n_s16(v1995, 29490);
-    int16x8_t v1997 = vaddq_s16(v1994, v1996);
-    int16x8_t v1998 = vsubq_s16(v1706, v1708);
-    int16x8_t v1999 = vsubq_s16(v1710, v1712);
-    int16x8_t v2000 = vqrdmulhq_n_s16(v1999, 29490);
-    int16x8_t v2001 = vaddq_s16(v1998, v2000);
-    int16x8_t v2002 = vqrdmulhq_n_s16(v2001, 18578);
-    int16x8_t v2003 = vaddq_s16(v1997, v2002);
-    int16x8_t v2004 = vqrdmulhq_n_s16(v2003, 16890);
-    int16x8_t v2005 = vaddq_s16(v1993, v2004);
-    int16x8_t v2006 = vqrdmulhq_n_s16(v2005, 16508);
-    int16x8_t v2007 = vaddq_s16(v1983, v2006);
-    int16x8_t v2008 = vqrdmulhq_n_s16(v2007, 16415);
-    int16x8_t v2009 = vaddq_s16(v1961, v2008);
-    int16x8_t v2010 = vsubq_s16(v1724, v1726);
-    int16x8_t v2011 = vsubq_s16(v1728, v1730);
-    int16x8_t v2012 = vqrdmulhq_n_s16(v2011, 29490);
-    int16x8_t v2013 = vaddq_s16(v2010, v2012);
-    int16x8_t v2014 = vsubq_s16(v1734, v1736);
-    int16x8_t v2015 = vsubq_s16(v1738, v1740);
-    int16x8_t v2016 = vqrdmulhq_n_s16(v2015, 29490);
-    int16x8_t v2017 = vaddq_s16(v2014, v2016);
-    int16x8_t v2018 = vqrdmulhq_n_s16(v2017, 18578);
-    int16x8_t v2019 = vaddq_s16(v2013, v2018);
-    int16x8_t v2020 = vsubq_s16(v1746, v1748);
-    int16x8_t v2021 = vsubq_s16(v1750, v1752);
-    int16x8_t v2022 = vqrdmulhq_n_s16(v2021, 29490);
-    int16x8_t v2023 = vaddq_s16(v2020, v2022);
-    int16x8_t v2024 = vsubq_s16(v1756, v1758);
-    int16x8_t v2025 = vsubq_s16(v1760, v1762);
-    int16x8_t v2026 = vqrdmulhq_n_s16(v2025, 29490);
-    int16x8_t v2027 = vaddq_s16(v2024, v2026);
-    int16x8_t v2028 = vqrdmulhq_n_s16(v2027, 18578);
-    int16x8_t v2029 = vaddq_s16(v2023, v2028);
-    int16x8_t v2030 = vqrdmulhq_n_s16(v2029, 16890);
-    int16x8_t v2031 = vaddq_s16(v2019, v2030);
-    int16x8_t v2032 = vsubq_s16(v1770, v1772);
-    int16x8_t v2033 = vsubq_s16(v1774, v1776);
-    int16x8_t v2034 = vqrdmulhq_n_s16(v2033, 29490);
-    int16x8_t v2035 = vaddq_s16(v2032, v2034);
-    int16x8_t v2036 = vsubq_s16(v1780, v1782);
-    int16x8_t v2037 = vsubq_s16(v1784, v1786);
-    int16x8_t v2038 = vqrdmulhq_n_s16(v2037, 29490);
-    int16x8_t v2039 = vaddq_s16(v2036, v2038);
-    int16x8_t v2040 = vqrdmulhq_n_s16(v2039, 18578);
-    int16x8_t v2041 = vaddq_s16(v2035, v2040);
-    int16x8_t v2042 = vsubq_s16(v1792, v1794);
-    int16x8_t v2043 = vsubq_s16(v1796, v1798);
-    int16x8_t v2044 = vqrdmulhq_n_s16(v2043, 29490);
-    int16x8_t v2045 = vaddq_s16(v2042, v2044);
-    int16x8_t v2046 = vsubq_s16(v1802, v1804);
-    int16x8_t v2047 = vsubq_s16(v1806, v1808);
-    int16x8_t v2048 = vqrdmulhq_n_s16(v2047, 29490);
-    int16x8_t v2049 = vaddq_s16(v2046, v2048);
-    int16x8_t v2050 = vqrdmulhq_n_s16(v2049, 18578);
-    int16x8_t v2051 = vaddq_s16(v2045, v2050);
-    int16x8_t v2052 = vqrdmulhq_n_s16(v2051, 16890);
-    int16x8_t v2053 = vaddq_s16(v2041, v2052);
-    int16x8_t v2054 = vqrdmulhq_n_s16(v2053, 16508);
-    int16x8_t v2055 = vaddq_s16(v2031, v2054);
-    int16x8_t v2056 = vsubq_s16(v1818, v1820);
-    int16x8_t v2057 = vsubq_s16(v1822, v1824);
-    int16x8_t v2058 = vqrdmulhq_n_s16(v2057, 29490);
-    int16x8_t v2059 = vaddq_s16(v2056, v2058);
-    int16x8_t v2060 = vsubq_s16(v1828, v1830);
-    int16x8_t v2061 = vsubq_s16(v1832, v1834);
-    int16x8_t v2062 = vqrdmulhq_n_s16(v2061, 29490);
-    int16x8_t v2063 = vaddq_s16(v2060, v2062);
-    int16x8_t v2064 = vqrdmulhq_n_s16(v2063, 18578);
-    int16x8_t v2065 = vaddq_s16(v2059, v2064);
-    int16x8_t v2066 = vsubq_s16(v1840, v1842);
-    int16x8_t v2067 = vsubq_s16(v1844, v1846);
-    int16x8_t v2068 = vqrdmulhq_n_s16(v2067, 29490);
-    int16x8_t v2069 = vaddq_s16(v2066, v2068);
-    int16x8_t v2070 = vsubq_s16(v1850, v1852);
-    int16x8_t v2071 = vqrdmulhq_n_s16(v2070, 18578);
-    int16x8_t v2072 = vsubq_s16(v1854, v1856);
-    int16x8_t v2073 = vqrdmulhq_n_s16(v2072, 16719);
-    int16x8_t v2074 = vaddq_s16(v2071, v2073);
-    int16x8_t v2075 = vaddq_s16(v2069, v2074);
-    int16x8_t v2076 = vqrdmulhq_n_s16(v2075, 16890);
-    int16x8_t v2077 = vaddq_s16(v2065, v2076);
-    int16x8_t v2078 = vsubq_s16(v1864, v1866);
-    int16x8_t v2079 = vsubq_s16(v1868, v1870);
-    int16x8_t v2080 = vqrdmulhq_n_s16(v2079, 29490);
-    int16x8_t v2081 = vaddq_s16(v2078, v2080);
-    int16x8_t v2082 = vsubq_s16(v1874, v1876);
-    int16x8_t v2083 = vsubq_s16(v1878, v1880);
-    int16x8_t v2084 = vqrdmulhq_n_s16(v2083, 29490);
-    int16x8_t v2085 = vaddq_s16(v2082, v2084);
-    int16x8_t v2086 = vqrdmulhq_n_s16(v2085, 18578);
-    int16x8_t v2087 = vaddq_s16(v2081, v2086);
-    int16x8_t v2088 = vsubq_s16(v1886, v1888);
-    int16x8_t v2089 = vsubq_s16(v1890, v1892);
-    int16x8_t v2090 = vqrdmulhq_n_s16(v2089, 29490);
-    int16x8_t v2091 = vaddq_s16(v2088, v2090);
-    int16x8_t v2092 = vsubq_s16(v1896, v1898);
-    int16x8_t v2093 = vsubq_s16(v1900, v1902);
-    int16x8_t v2094 = vqrdmulhq_n_s16(v2093, 29490);
-    int16x8_t v2095 = vaddq_s16(v2092, v2094);
-    int16x8_t v2096 = vqrdmulhq_n_s16(v2095, 18578);
-    int16x8_t v2097 = vaddq_s16(v2091, v2096);
-    int16x8_t v2098 = vqrdmulhq_n_s16(v2097, 16890);
-    int16x8_t v2099 = vaddq_s16(v2087, v2098);
-    int16x8_t v2100 = vqrdmulhq_n_s16(v2099, 16508);
-    int16x8_t v2101 = vaddq_s16(v2077, v2100);
-    int16x8_t v2102 = vqrdmulhq_n_s16(v2101, 16415);
-    int16x8_t v2103 = vaddq_s16(v2055, v2102);
-    int16x8_t v2104 = vqrdmulhq_n_s16(v2103, 16392);
-    int16x8_t v2105 = vaddq_s16(v2009, v2104);
-    int16x8_t v2106 = vsubq_s16(v2, v8);
-    int16x8_t v2107 = vsubq_s16(v15, v22);
-    int16x8_t v2108_tmp = vqrdmulhq_n_s16(v2107, 18446);
-    int16x8_t v2108 = vmlaq_n_s16(v2108_tmp, v2107, 2);
-    int16x8_t v2109 = vaddq_s16(v2106, v2108);
-    int16x8_t v2110 = vsubq_s16(v31, v41);
-    int16x8_t v2111 = vsubq_s16(v48, v56);
-    int16x8_t v2112_tmp = vqrdmulhq_n_s16(v2111, 18446);
-    int16x8_t v2112 = vmlaq_n_s16(v2112_tmp, v2111, 2);
-    int16x8_t v2113 = vaddq_s16(v2110, v2112);
-    int16x8_t v2114 = vqrdmulhq_n_s16(v2113, 21195);
-    int16x8_t v2115 = vaddq_s16(v2109, v2114);
-    int16x8_t v2116 = vsubq_s16(v67, v77);
-    int16x8_t v2117 = vsubq_s16(v90, v99);
-    int16x8_t v2118_tmp = vqrdmulhq_n_s16(v2117, 18446);
-    int16x8_t v2118 = vmlaq_n_s16(v2118_tmp, v2117, 2);
-    int16x8_t v2119 = vaddq_s16(v2116, v2118);
-    int16x8_t v2120 = vsubq_s16(v108, v118);
-    int16x8_t v2121 = vsubq_s16(v125, v134);
-    int16x8_t v2122_tmp = vqrdmulhq_n_s16(v2121, 18446);
-    int16x8_t v2122 = vmlaq_n_s16(v2122_tmp, v2121, 2);
-    int16x8_t v2123 = vaddq_s16(v2120, v2122);
-    int16x8_t v2124 = vqrdmulhq_n_s16(v2123, 21195);
-    int16x8_t v2125 = vaddq_s16(v2119, v2124);
-    int16x8_t v2126 = vqrdmulhq_n_s16(v2125, 17401);
-    int16x8_t v2127 = vaddq_s16(v2115, v2126);
-    int16x8_t v2128 = vsubq_s16(v147, v157);
-    int16x8_t v2129 = vsubq_s16(v170, v179);
-    int16x8_t v2130_tmp = vqrdmulhq_n_s16(v2129, 18446);
-    int16x8_t v2130 = vmlaq_n_s16(v2130_tmp, v2129, 2);
-    int16x8_t v2131 = vaddq_s16(v2128, v2130);
-    int16x8_t v2132 = vsubq_s16(v194, v212);
-    int16x8_t v2133 = vsubq_s16(v219, v229);
-    int16x8_t v2134_tmp = vqrdmulhq_n_s16(v2133, 18446);
-    int16x8_t v2134 = vmlaq_n_s16(v2134_tmp, v2133, 2);
-    int16x8_t v2135 = vaddq_s16(v2132, v2134);
-    int16x8_t v2136 = vqrdmulhq_n_s16(v2135, 21195);
-    int16x8_t v2137 = vaddq_s16(v2131, v2136);
-    int16x8_t v2138 = vsubq_s16(v240, v250);
-    int16x8_t v2139 = vsubq_s16(v263, v272);
-    int16x8_t v2140_tmp = vqrdmulhq_n_s16(v2139, 18446);
-    int16x8_t v2140 = vmlaq_n_s16(v2140_tmp, v2139, 2);
-    int16x8_t v2141 = vaddq_s16(v2138, v2140);
-    int16x8_t v2142 = vsubq_s16(v281, v291);
-    int16x8_t v2143 = vsubq_s16(v298, v308);
-    int16x8_t v2144_tmp = vqrdmulhq_n_s16(v2143, 18446);
-    int16x8_t v2144 = vmlaq_n_s16(v2144_tmp, v2143, 2);
-    int16x8_t v2145 = vaddq_s16(v2142, v2144);
-    int16x8_t v2146 = vqrdmulhq_n_s16(v2145, 21195);
-    int16x8_t v2147 = vaddq_s16(v2141, v2146);
-    int16x8_t v2148 = vqrdmulhq_n_s16(v2147, 17401);
-    int16x8_t v2149 = vaddq_s16(v2137, v2148);
-    int16x8_t v2150 = vqrdmulhq_n_s16(v2149, 16629);
-    int16x8_t v2151 = vaddq_s16(v2127, v2150);
-    int16x8_t v2152 = vsubq_s16(v323, v333);
-    int16x8_t v2153 = vsubq_s16(v346, v355);
-    int16x8_t v2154_tmp = vqrdmulhq_n_s16(v2153, 18446);
-    int16x8_t v2154 = vmlaq_n_s16(v2154_tmp, v2153, 2);
-    int16x8_t v2155 = vaddq_s16(v2152, v2154);
-    int16x8_t v2156 = vsubq_s16(v370, v388);
-    int16x8_t v2157 = vsubq_s16(v395, v405);
-    int16x8_t v2158_tmp = vqrdmulhq_n_s16(v2157, 18446);
-    int16x8_t v2158 = vmlaq_n_s16(v2158_tmp, v2157, 2);
-    int16x8_t v2159 = vaddq_s16(v2156, v2158);
-    int16x8_t v2160 = vqrdmulhq_n_s16(v2159, 21195);
-    int16x8_t v2161 = vaddq_s16(v2155, v2160);
-    int16x8_t v2162 = vsubq_s16(v422, v440);
-    int16x8_t v2163 = vsubq_s16(v465, v478);
-    int16x8_t v2164_tmp = vqrdmulhq_n_s16(v2163, 18446);
-    int16x8_t v2164 = vmlaq_n_s16(v2164_tmp, v2163, 2);
-    int16x8_t v2165 = vaddq_s16(v2162, v2164);
-    int16x8_t v2166 = vsubq_s16(v487, v497);
-    int16x8_t v2167 = vsubq_s16(v504, v515);
-    int16x8_t v2168_tmp = vqrdmulhq_n_s16(v2167, 18446);
-    int16x8_t v2168 = vmlaq_n_s16(v2168_tmp, v2167, 2);
-    int16x8_t v2169 = vaddq_s16(v2166, v2168);
-    int16x8_t v2170 = vqrdmulhq_n_s16(v2169, 21195);
-    int16x8_t v2171 = vaddq_s16(v2165, v2170);
-    int16x8_t v2172 = vqrdmulhq_n_s16(v2171, 17401);
-    int16x8_t v2173 = vaddq_s16(v2161, v2172);
-    int16x8_t v2174 = vsubq_s16(v528, v538);
-    int16x8_t v2175 = vsubq_s16(v551, v560);
-    int16x8_t v2176_tmp = vqrdmulhq_n_s16(v2175, 18446);
-    int16x8_t v2176 = vmlaq_n_s16(v2176_tmp, v2175, 2);
-    int16x8_t v2177 = vaddq_s16(v2174, v2176);
-    int16x8_t v2178 = vsubq_s16(v575, v593);
-    int16x8_t v2179 = vsubq_s16(v600, v610);
-    int16x8_t v2180_tmp = vqrdmulhq_n_s16(v2179, 18446);
-    int16x8_t v2180 = vmlaq_n_s16(v2180_tmp, v2179, 2);
-    int16x8_t v2181 = vaddq_s16(v2178, v2180);
-    int16x8_t v2182 = vqrdmulhq_n_s16(v2181, 21195);
-    int16x8_t v2183 = vaddq_s16(v2177, v2182);
-    int16x8_t v2184 = vsubq_s16(v621, v631);
-    int16x8_t v2185 = vsubq_s16(v644, v653);
-    int16x8_t v2186_tmp = vqrdmulhq_n_s16(v2185, 18446);
-    int16x8_t v2186 = vmlaq_n_s16(v2186_tmp, v2185, 2);
-    int16x8_t v2187 = vaddq_s16(v2184, v2186);
-    int16x8_t v2188 = vsubq_s16(v662, v672);
-    int16x8_t v2189 = vsubq_s16(v679, v690);
-    int16x8_t v2190_tmp = vqrdmulhq_n_s16(v2189, 18446);
-    int16x8_t v2190 = vmlaq_n_s16(v2190_tmp, v2189, 2);
-    int16x8_t v2191 = vaddq_s16(v2188, v2190);
-    int16x8_t v2192 = vqrdmulhq_n_s16(v2191, 21195);
-    int16x8_t v2193 = vaddq_s16(v2187, v2192);
-    int16x8_t v2194 = vqrdmulhq_n_s16(v2193, 17401);
-    int16x8_t v2195 = vaddq_s16(v2183, v2194);
-    int16x8_t v2196 = vqrdmulhq_n_s16(v2195, 16629);
-    int16x8_t v2197 = vaddq_s16(v2173, v2196);
-    int16x8_t v2198 = vqrdmulhq_n_s16(v2197, 16445);
-    int16x8_t v2199 = vaddq_s16(v2151, v2198);
-    int16x8_t v2200 = vsubq_s16(v707, v717);
-    int16x8_t v2201 = vsubq_s16(v730, v739);
-    int16x8_t v2202_tmp = vqrdmulhq_n_s16(v2201, 18446);
-    int16x8_t v2202 = vmlaq_n_s16(v2202_tmp, v2201, 2);
-    int16x8_t v2203 = vaddq_s16(v2200, v2202);
-    int16x8_t v2204 = vsubq_s16(v754, v772);
-    int16x8_t v2205 = vsubq_s16(v779, v789);
-    int16x8_t v2206_tmp = vqrdmulhq_n_s16(v2205, 18446);
-    int16x8_t v2206 = vmlaq_n_s16(v2206_tmp, v2205, 2);
-    int16x8_t v2207 = vaddq_s16(v2204, v2206);
-    int16x8_t v2208 = vqrdmulhq_n_s16(v2207, 21195);
-    int16x8_t v2209 = vaddq_s16(v2203, v2208);
-    int16x8_t v2210 = vsubq_s16(v806, v824);
-    int16x8_t v2211 = vsubq_s16(v849, v862);
-    int16x8_t v2212_tmp = vqrdmulhq_n_s16(v2211, 18446);
-    int16x8_t v2212 = vmlaq_n_s16(v2212_tmp, v2211, 2);
-    int16x8_t v2213 = vaddq_s16(v2210, v2212);
-    int16x8_t v2214 = vsubq_s16(v871, v881);
-    int16x8_t v2215 = vsubq_s16(v888, v899);
-    int16x8_t v2216_tmp = vqrdmulhq_n_s16(v2215, 18446);
-    int16x8_t v2216 = vmlaq_n_s16(v2216_tmp, v2215, 2);
-    int16x8_t v2217 = vaddq_s16(v2214, v2216);
-    int16x8_t v2218 = vqrdmulhq_n_s16(v2217, 21195);
-    int16x8_t v2219 = vaddq_s16(v2213, v2218);
-    int16x8_t v2220 = vqrdmulhq_n_s16(v2219, 17401);
-    int16x8_t v2221 = vaddq_s16(v2209, v2220);
-    int16x8_t v2222 = vsubq_s16(v918, v936);
-    int16x8_t v2223 = vsubq_s16(v961, v974);
-    int16x8_t v2224_tmp = vqrdmulhq_n_s16(v2223, 18446);
-    int16x8_t v2224 = vmlaq_n_s16(v2224_tmp, v2223, 2);
-    int16x8_t v2225 = vaddq_s16(v2222, v2224);
-    int16x8_t v2226 = vsubq_s16(v1001, v1035);
-    int16x8_t v2227 = vsubq_s16(v1042, v1056);
-    int16x8_t v2228_tmp = vqrdmulhq_n_s16(v2227, 18446);
-    int16x8_t v2228 = vmlaq_n_s16(v2228_tmp, v2227, 2);
-    int16x8_t v2229 = vaddq_s16(v2226, v2228);
-    int16x8_t v2230 = vqrdmulhq_n_s16(v2229, 21195);
-    int16x8_t v2231 = vaddq_s16(v2225, v2230);
-    int16x8_t v2232 = vsubq_s16(v1067, v1077);
-    int16x8_t v2233 = vsubq_s16(v1090, v1099);
-    int16x8_t v2234_tmp = vqrdmulhq_n_s16(v2233, 18446);
-    int16x8_t v2234 = vmlaq_n_s16(v2234_tmp, v2233, 2);
-    int16x8_t v2235 = vaddq_s16(v2232, v2234);
-    int16x8_t v2236 = vsubq_s16(v1108, v1118);
-    int16x8_t v2237 = vsubq_s16(v1125, v1137);
-    int16x8_t v2238_tmp = vqrdmulhq_n_s16(v2237, 18446);
-    int16x8_t v2238 = vmlaq_n_s16(v2238_tmp, v2237, 2);
-    int16x8_t v2239 = vaddq_s16(v2236, v2238);
-    int16x8_t v2240 = vqrdmulhq_n_s16(v2239, 21195);
-    int16x8_t v2241 = vaddq_s16(v2235, v2240);
-    int16x8_t v2242 = vqrdmulhq_n_s16(v2241, 17401);
-    int16x8_t v2243 = vaddq_s16(v2231, v2242);
-    int16x8_t v2244 = vqrdmulhq_n_s16(v2243, 16629);
-    int16x8_t v2245 = vaddq_s16(v2221, v2244);
-    int16x8_t v2246 = vsubq_s16(v1152, v1162);
-    int16x8_t v2247 = vsubq_s16(v1175, v1184);
-    int16x8_t v2248_tmp = vqrdmulhq_n_s16(v2247, 18446);
-    int16x8_t v2248 = vmlaq_n_s16(v2248_tmp, v2247, 2);
-    int16x8_t v2249 = vaddq_s16(v2246, v2248);
-    int16x8_t v2250 = vsubq_s16(v1199, v1217);
-    int16x8_t v2251 = vsubq_s16(v1224, v1234);
-    int16x8_t v2252_tmp = vqrdmulhq_n_s16(v2251, 18446);
-    int16x8_t v2252 = vmlaq_n_s16(v2252_tmp, v2251, 2);
-    int16x8_t v2253 = vaddq_s16(v2250, v2252);
-    int16x8_t v2254 = vqrdmulhq_n_s16(v2253, 21195);
-    int16x8_t v2255 = vaddq_s16(v2249, v2254);
-    int16x8_t v2256 = vsubq_s16(v1251, v1269);
-    int16x8_t v2257 = vsubq_s16(v1294, v1307);
-    int16x8_t v2258_tmp = vqrdmulhq_n_s16(v2257, 18446);
-    int16x8_t v2258 = vmlaq_n_s16(v2258_tmp, v2257, 2);
-    int16x8_t v2259 = vaddq_s16(v2256, v2258);
-    int16x8_t v2260 = vsubq_s16(v1316, v1326);
-    int16x8_t v2261 = vsubq_s16(v1333, v1344);
-    int16x8_t v2262_tmp = vqrdmulhq_n_s16(v2261, 18446);
-    int16x8_t v2262 = vmlaq_n_s16(v2262_tmp, v2261, 2);
-    int16x8_t v2263 = vaddq_s16(v2260, v2262);
-    int16x8_t v2264 = vqrdmulhq_n_s16(v2263, 21195);
-    int16x8_t v2265 = vaddq_s16(v2259, v2264);
-    int16x8_t v2266 = vqrdmulhq_n_s16(v2265, 17401);
-    int16x8_t v2267 = vaddq_s16(v2255, v2266);
-    int16x8_t v2268 = vsubq_s16(v1357, v1367);
-    int16x8_t v2269 = vsubq_s16(v1380, v1389);
-    int16x8_t v2270_tmp = vqrdmulhq_n_s16(v2269, 18446);
-    int16x8_t v2270 = vmlaq_n_s16(v2270_tmp, v2269, 2);
-    int16x8_t v2271 = vaddq_s16(v2268, v2270);
-    int16x8_t v2272 = vsubq_s16(v1404, v1422);
-    int16x8_t v2273 = vsubq_s16(v1429, v1439);
-    int16x8_t v2274_tmp = vqrdmulhq_n_s16(v2273, 18446);
-    int16x8_t v2274 = vmlaq_n_s16(v2274_tmp, v2273, 2);
-    int16x8_t v2275 = vaddq_s16(v2272, v2274);
-    int16x8_t v2276 = vqrdmulhq_n_s16(v2275, 21195);
-    int16x8_t v2277 = vaddq_s16(v2271, v2276);
-    int16x8_t v2278 = vsubq_s16(v1450, v1460);
-    int16x8_t v2279 = vsubq_s16(v1473, v1482);
-    int16x8_t v2280_tmp = vqrdmulhq_n_s16(v2279, 18446);
-    int16x8_t v2280 = vmlaq_n_s16(v2280_tmp, v2279, 2);
-    int16x8_t v2281 = vaddq_s16(v2278, v2280);
-    int16x8_t v2282 = vsubq_s16(v1491, v1501);
-    int16x8_t v2283 = vsubq_s16(v1508, v1520);
-    int16x8_t v2284_tmp = vqrdmulhq_n_s16(v2283, 18446);
-    int16x8_t v2284 = vmlaq_n_s16(v2284_tmp, v2283, 2);
-    int16x8_t v2285 = vaddq_s16(v2282, v2284);
-    int16x8_t v2286 = vqrdmulhq_n_s16(v2285, 21195);
-    int16x8_t v2287 = vaddq_s16(v2281, v2286);
-    int16x8_t v2288 = vqrdmulhq_n_s16(v2287, 17401);
-    int16x8_t v2289 = vaddq_s16(v2277, v2288);
-    int16x8_t v2290 = vqrdmulhq_n_s16(v2289, 16629);
-    int16x8_t v2291 = vaddq_s16(v2267, v2290);
-    int16x8_t v2292 = vqrdmulhq_n_s16(v2291, 16445);
-    int16x8_t v2293 = vaddq_s16(v2245, v2292);
-    int16x8_t v2294 = vqrdmulhq_n_s16(v2293, 16399);
-    int16x8_t v2295 = vaddq_s16(v2199, v2294);
-    int16x8_t v2296 = vsubq_s16(v2106, v2108);
-    int16x8_t v2297 = vsubq_s16(v2110, v2112);
-    int16x8_t v2298 = vqrdmulhq_n_s16(v2297, 25826);
-    int16x8_t v2299 = vaddq_s16(v2296, v2298);
-    int16x8_t v2300 = vsubq_s16(v2116, v2118);
-    int16x8_t v2301 = vsubq_s16(v2120, v2122);
-    int16x8_t v2302 = vqrdmulhq_n_s16(v2301, 25826);
-    int16x8_t v2303 = vaddq_s16(v2300, v2302);
-    int16x8_t v2304 = vqrdmulhq_n_s16(v2303, 18124);
-    int16x8_t v2305 = vaddq_s16(v2299, v2304);
-    int16x8_t v2306 = vsubq_s16(v2128, v2130);
-    int16x8_t v2307 = vsubq_s16(v2132, v2134);
-    int16x8_t v2308 = vqrdmulhq_n_s16(v2307, 25826);
-    int16x8_t v2309 = vaddq_s16(v2306, v2308);
-    int16x8_t v2310 = vsubq_s16(v2138, v2140);
-    int16x8_t v2311 = vsubq_s16(v2142, v2144);
-    int16x8_t v2312 = vqrdmulhq_n_s16(v2311, 25826);
-    int16x8_t v2313 = vaddq_s16(v2310, v2312);
-    int16x8_t v2314 = vqrdmulhq_n_s16(v2313, 18124);
-    int16x8_t v2315 = vaddq_s16(v2309, v2314);
-    int16x8_t v2316 = vqrdmulhq_n_s16(v2315, 16792);
-    int16x8_t v2317 = vaddq_s16(v2305, v2316);
-    int16x8_t v2318 = vsubq_s16(v2152, v2154);
-    int16x8_t v2319 = vsubq_s16(v2156, v2158);
-    int16x8_t v2320 = vqrdmulhq_n_s16(v2319, 25826);
-    int16x8_t v2321 = vaddq_s16(v2318, v2320);
-    int16x8_t v2322 = vsubq_s16(v2162, v2164);
-    int16x8_t v2323 = vsubq_s16(v2166, v2168);
-    int16x8_t v2324 = vqrdmulhq_n_s16(v2323, 25826);
-    int16x8_t v2325 = vaddq_s16(v2322, v2324);
-    int16x8_t v2326 = vqrdmulhq_n_s16(v2325, 18124);
-    int16x8_t v2327 = vaddq_s16(v2321, v2326);
-    int16x8_t v2328 = vsubq_s16(v2174, v2176);
-    int16x8_t v2329 = vsubq_s16(v2178, v2180);
-    int16x8_t v2330 = vqrdmulhq_n_s16(v2329, 25826);
-    int16x8_t v2331 = vaddq_s16(v2328, v2330);
-    int16x8_t v2332 = vsubq_s16(v2184, v2186);
-    int16x8_t v2333 = vsubq_s16(v2188, v2190);
-    int16x8_t v2334 = vqrdmulhq_n_s16(v2333, 25826);
-    int16x8_t v2335 = vaddq_s16(v2332, v2334);
-    int16x8_t v2336 = vqrdmulhq_n_s16(v2335, 18124);
-    int16x8_t v2337 = vaddq_s16(v2331, v2336);
-    int16x8_t v2338 = vqrdmulhq_n_s16(v2337, 16792);
-    int16x8_t v2339 = vaddq_s16(v2327, v2338);
-    int16x8_t v2340 = vqrdmulhq_n_s16(v2339, 16484);
-    int16x8_t v2341 = vaddq_s16(v2317, v2340);
-    int16x8_t v2342 = vsubq_s16(v2200, v2202);
-    int16x8_t v2343 = vsubq_s16(v2204, v2206);
-    int16x8_t v2344 = vqrdmulhq_n_s16(v2343, 25826);
-    int16x8_t v2345 = vaddq_s16(v2342, v2344);
-    int16x8_t v2346 = vsubq_s16(v2210, v2212);
-    int16x8_t v2347 = vsubq_s16(v2214, v2216);
-    int16x8_t v2348 = vqrdmulhq_n_s16(v2347, 25826);
-    int16x8_t v2349 = vaddq_s16(v2346, v2348);
-    int16x8_t v2350 = vqrdmulhq_n_s16(v2349, 18124);
-    int16x8_t v2351 = vaddq_s16(v2345, v2350);
-    int16x8_t v2352 = vsubq_s16(v2222, v2224);
-    int16x8_t v2353 = vsubq_s16(v2226, v2228);
-    int16x8_t v2354 = vqrdmulhq_n_s16(v2353, 25826);
-    int16x8_t v2355 = vaddq_s16(v2352, v2354);
-    int16x8_t v2356 = vsubq_s16(v2232, v2234);
-    int16x8_t v2357 = vsubq_s16(v2236, v2238);
-    int16x8_t v2358 = vqrdmulhq_n_s16(v2357, 25826);
-    int16x8_t v2359 = vaddq_s16(v2356, v2358);
-    int16x8_t v2360 = vqrdmulhq_n_s16(v2359, 18124);
-    int16x8_t v2361 = vaddq_s16(v2355, v2360);
-    int16x8_t v2362 = vqrdmulhq_n_s16(v2361, 16792);
-    int16x8_t v2363 = vaddq_s16(v2351, v2362);
-    int16x8_t v2364 = vsubq_s16(v2246, v2248);
-    int16x8_t v2365 = vsubq_s16(v2250, v2252);
-    int16x8_t v2366 = vqrdmulhq_n_s16(v2365, 25826);
-    int16x8_t v2367 = vaddq_s16(v2364, v2366);
-    int16x8_t v2368 = vsubq_s16(v2256, v2258);
-    int16x8_t v2369 = vsubq_s16(v2260, v2262);
-    int16x8_t v2370 = vqrdmulhq_n_s16(v2369, 25826);
-    int16x8_t v2371 = vaddq_s16(v2368, v2370);
-    int16x8_t v2372 = vqrdmulhq_n_s16(v2371, 18124);
-    int16x8_t v2373 = vaddq_s16(v2367, v2372);
-    int16x8_t v2374 = vsubq_s16(v2268, v2270);
-    int16x8_t v2375 = vsubq_s16(v2272, v2274);
-    int16x8_t v2376 = vqrdmulhq_n_s16(v2375, 25826);
-    int16x8_t v2377 = vaddq_s16(v2374, v2376);
-    int16x8_t v2378 = vsubq_s16(v2278, v2280);
-    int16x8_t v2379 = vsubq_s16(v2282, v2284);
-    int16x8_t v2380 = vqrdmulhq_n_s16(v2379, 25826);
-    int16x8_t v2381 = vaddq_s16(v2378, v2380);
-    int16x8_t v2382 = vqrdmulhq_n_s16(v2381, 18124);
-    int16x8_t v2383 = vaddq_s16(v2377, v2382);
-    int16x8_t v2384 = vqrdmulhq_n_s16(v2383, 16792);
-    int16x8_t v2385 = vaddq_s16(v2373, v2384);
-    int16x8_t v2386 = vqrdmulhq_n_s16(v2385, 16484);
-    int16x8_t v2387 = vaddq_s16(v2363, v2386);
-    int16x8_t v2388 = vqrdmulhq_n_s16(v2387, 16409);
-    int16x8_t v2389 = vaddq_s16(v2341, v2388);
-    int16x8_t v2390 = vsubq_s16(v1916, v1918);
-    int16x8_t v2391 = vsubq_s16(v1920, v1922);
-    int16x8_t v2392_tmp = vqrdmulhq_n_s16(v2391, 1988);
-    int16x8_t v2392 = vaddq_s16(v2392_tmp, v2391);
-    int16x8_t v2393 = vaddq_s16(v2390, v2392);
-    int16x8_t v2394 = vsubq_s16(v1926, v1928);
-    int16x8_t v2395 = vsubq_s16(v1930, v1932);
-    int16x8_t v2396_tmp = vqrdmulhq_n_s16(v2395, 1988);
-    int16x8_t v2396 = vaddq_s16(v2396_tmp, v2395);
-    int16x8_t v2397 = vaddq_s16(v2394, v2396);
-    int16x8_t v2398 = vqrdmulhq_n_s16(v2397, 19102);
-    int16x8_t v2399 = vaddq_s16(v2393, v2398);
-    int16x8_t v2400 = vsubq_s16(v1938, v1940);
-    int16x8_t v2401 = vsubq_s16(v1942, v1944);
-    int16x8_t v2402_tmp = vqrdmulhq_n_s16(v2401, 1988);
-    int16x8_t v2402 = vaddq_s16(v2402_tmp, v2401);
-    int16x8_t v2403 = vaddq_s16(v2400, v2402);
-    int16x8_t v2404 = vsubq_s16(v1948, v1950);
-    int16x8_t v2405 = vsubq_s16(v1952, v1954);
-    int16x8_t v2406_tmp = vqrdmulhq_n_s16(v2405, 1988);
-    int16x8_t v2406 = vaddq_s16(v2406_tmp, v2405);
-    int16x8_t v2407 = vaddq_s16(v2404, v2406);
-    int16x8_t v2408 = vqrdmulhq_n_s16(v2407, 19102);
-    int16x8_t v2409 = vaddq_s16(v2403, v2408);
-    int16x8_t v2410 = vqrdmulhq_n_s16(v2409, 17000);
-    int16x8_t v2411 = vaddq_s16(v2399, v2410);
-    int16x8_t v2412 = vsubq_s16(v1962, v1964);
-    int16x8_t v2413 = vsubq_s16(v1966, v1968);
-    int16x8_t v2414_tmp = vqrdmulhq_n_s16(v2413, 1988);
-    int16x8_t v2414 = vaddq_s16(v2414_tmp, v2413);
-    int16x8_t v2415 = vaddq_s16(v2412, v2414);
-    int16x8_t v2416 = vsubq_s16(v1972, v1974);
-    int16x8_t v2417 = vsubq_s16(v1976, v1978);
-    int16x8_t v2418_tmp = vqrdmulhq_n_s16(v2417, 1988);
-    int16x8_t v2418 = vaddq_s16(v2418_tmp, v2417);
-    int16x8_t v2419 = vaddq_s16(v2416, v2418);
-    int16x8_t v2420 = vqrdmulhq_n_s16(v2419, 19102);
-    int16x8_t v2421 = vaddq_s16(v2415, v2420);
-    int16x8_t v2422 = vsubq_s16(v1984, v1986);
-    int16x8_t v2423 = vsubq_s16(v1988, v1990);
-    int16x8_t v2424_tmp = vqrdmulhq_n_s16(v2423, 1988);
-    int16x8_t v2424 = vaddq_s16(v2424_tmp, v2423);
-    int16x8_t v2425 = vaddq_s16(v2422, v2424);
-    int16x8_t v2426 = vsubq_s16(v1994, v1996);
-    int16x8_t v2427 = vsubq_s16(v1998, v2000);
-    int16x8_t v2428_tmp = vqrdmulhq_n_s16(v2427, 1988);
-    int16x8_t v2428 = vaddq_s16(v2428_tmp, v2427);
-    int16x8_t v2429 = vaddq_s16(v2426, v2428);
-    int16x8_t v2430 = vqrdmulhq_n_s16(v2429, 19102);
-    int16x8_t v2431 = vaddq_s16(v2425, v2430);
-    int16x8_t v2432 = vqrdmulhq_n_s16(v2431, 17000);
-    int16x8_t v2433 = vaddq_s16(v2421, v2432);
-    int16x8_t v2434 = vqrdmulhq_n_s16(v2433, 16534);
-    int16x8_t v2435 = vaddq_s16(v2411, v2434);
-    int16x8_t v2436 = vsubq_s16(v2010, v2012);
-    int16x8_t v2437 = vsubq_s16(v2014, v2016);
-    int16x8_t v2438_tmp = vqrdmulhq_n_s16(v2437, 1988);
-    int16x8_t v2438 = vaddq_s16(v2438_tmp, v2437);
-    int16x8_t v2439 = vaddq_s16(v2436, v2438);
-    int16x8_t v2440 = vsubq_s16(v2020, v2022);
-    int16x8_t v2441 = vsubq_s16(v2024, v2026);
-    int16x8_t v2442_tmp = vqrdmulhq_n_s16(v2441, 1988);
-    int16x8_t v2442 = vaddq_s16(v2442_tmp, v2441);
-    int16x8_t v2443 = vaddq_s16(v2440, v2442);
-    int16x8_t v2444 = vqrdmulhq_n_s16(v2443, 19102);
-    int16x8_t v2445 = vaddq_s16(v2439, v2444);
-    int16x8_t v2446 = vsubq_s16(v2032, v2034);
-    int16x8_t v2447 = vsubq_s16(v2036, v2038);
-    int16x8_t v2448_tmp = vqrdmulhq_n_s16(v2447, 1988);
-    int16x8_t v2448 = vaddq_s16(v2448_tmp, v2447);
-    int16x8_t v2449 = vaddq_s16(v2446, v2448);
-    int16x8_t v2450 = vsubq_s16(v2042, v2044);
-    int16x8_t v2451 = vsubq_s16(v2046, v2048);
-    int16x8_t v2452_tmp = vqrdmulhq_n_s16(v2451, 1988);
-    int16x8_t v2452 = vaddq_s16(v2452_tmp, v2451);
-    int16x8_t v2453 = vaddq_s16(v2450, v2452);
-    int16x8_t v2454 = vqrdmulhq_n_s16(v2453, 19102);
-    int16x8_t v2455 = vaddq_s16(v2449, v2454);
-    int16x8_t v2456 = vqrdmulhq_n_s16(v2455, 17000);
-    int16x8_t v2457 = vaddq_s16(v2445, v2456);
-    int16x8_t v2458 = vsubq_s16(v2056, v2058);
-    int16x8_t v2459 = vsubq_s16(v2060, v2062);
-    int16x8_t v2460_tmp = vqrdmulhq_n_s16(v2459, 1988);
-    int16x8_t v2460 = vaddq_s16(v2460_tmp, v2459);
-    int16x8_t v2461 = vaddq_s16(v2458, v2460);
-    int16x8_t v2462 = vsubq_s16(v2066, v2068);
-    int16x8_t v2463 = vqrdmulhq_n_s16(v2072, 29490);
-    int16x8_t v2464 = vsubq_s16(v2070, v2463);
-    int16x8_t v2465_tmp = vqrdmulhq_n_s16(v2464, 1988);
-    int16x8_t v2465 = vaddq_s16(v2465_tmp, v2464);
-    int16x8_t v2466 = vaddq_s16(v2462, v2465);
-    int16x8_t v2467 = vqrdmulhq_n_s16(v2466, 19102);
-    int16x8_t v2468 = vaddq_s16(v2461, v2467);
-    int16x8_t v2469 = vsubq_s16(v2078, v2080);
-    int16x8_t v2470 = vsubq_s16(v2082, v2084);
-    int16x8_t v2471_tmp = vqrdmulhq_n_s16(v2470, 1988);
-    int16x8_t v2471 = vaddq_s16(v2471_tmp, v2470);
-    int16x8_t v2472 = vaddq_s16(v2469, v2471);
-    int16x8_t v2473 = vsubq_s16(v2088, v2090);
-    int16x8_t v2474 = vsubq_s16(v2092, v2094);
-    int16x8_t v2475_tmp = vqrdmulhq_n_s16(v2474, 1988);
-    int16x8_t v2475 = vaddq_s16(v2475_tmp, v2474);
-    int16x8_t v2476 = vaddq_s16(v2473, v2475);
-    int16x8_t v2477 = vqrdmulhq_n_s16(v2476, 19102);
-    int16x8_t v2478 = vaddq_s16(v2472, v2477);
-    int16x8_t v2479 = vqrdmulhq_n_s16(v2478, 17000);
-    int16x8_t v2480 = vaddq_s16(v2468, v2479);
-    int16x8_t v2481 = vqrdmulhq_n_s16(v2480, 16534);
-    int16x8_t v2482 = vaddq_s16(v2457, v2481);
-    int16x8_t v2483 = vqrdmulhq_n_s16(v2482, 16421);
-    int16x8_t v2484 = vaddq_s16(v2435, v2483);
-    int16x8_t v2485 = vsubq_s16(v1537, v1542);
-    int16x8_t v2486 = vsubq_s16(v1547, v1552);
-    int16x8_t v2487_tmp = vqrdmulhq_n_s16(v2486, 23673);
-    int16x8_t v2487 = vaddq_s16(v2487_tmp, v2486);
-    int16x8_t v2488 = vaddq_s16(v2485, v2487);
-    int16x8_t v2489 = vsubq_s16(v1559, v1564);
-    int16x8_t v2490 = vsubq_s16(v1569, v1574);
-    int16x8_t v2491_tmp = vqrdmulhq_n_s16(v2490, 23673);
-    int16x8_t v2491 = vaddq_s16(v2491_tmp, v2490);
-    int16x8_t v2492 = vaddq_s16(v2489, v2491);
-    int16x8_t v2493 = vqrdmulhq_n_s16(v2492, 20398);
-    int16x8_t v2494 = vaddq_s16(v2488, v2493);
-    int16x8_t v2495 = vsubq_s16(v1583, v1588);
-    int16x8_t v2496 = vsubq_s16(v1593, v1598);
-    int16x8_t v2497_tmp = vqrdmulhq_n_s16(v2496, 23673);
-    int16x8_t v2497 = vaddq_s16(v2497_tmp, v2496);
-    int16x8_t v2498 = vaddq_s16(v2495, v2497);
-    int16x8_t v2499 = vsubq_s16(v1605, v1610);
-    int16x8_t v2500 = vsubq_s16(v1615, v1620);
-    int16x8_t v2501_tmp = vqrdmulhq_n_s16(v2500, 23673);
-    int16x8_t v2501 = vaddq_s16(v2501_tmp, v2500);
-    int16x8_t v2502 = vaddq_s16(v2499, v2501);
-    int16x8_t v2503 = vqrdmulhq_n_s16(v2502, 20398);
-    int16x8_t v2504 = vaddq_s16(v2498, v2503);
-    int16x8_t v2505 = vqrdmulhq_n_s16(v2504, 17255);
-    int16x8_t v2506 = vaddq_s16(v2494, v2505);
-    int16x8_t v2507 = vsubq_s16(v1631, v1636);
-    int16x8_t v2508 = vsubq_s16(v1641, v1646);
-    int16x8_t v2509_tmp = vqrdmulhq_n_s16(v2508, 23673);
-    int16x8_t v2509 = vaddq_s16(v2509_tmp, v2508);
-    int16x8_t v2510 = vaddq_s16(v2507, v2509);
-    int16x8_t v2511 = vsubq_s16(v1653, v1658);
-    int16x8_t v2512 = vsubq_s16(v1663, v1668);
-    int16x8_t v2513_tmp = vqrdmulhq_n_s16(v2512, 23673);
-    int16x8_t v2513 = vaddq_s16(v2513_tmp, v2512);
-    int16x8_t v2514 = vaddq_s16(v2511, v2513);
-    int16x8_t v2515 = vqrdmulhq_n_s16(v2514, 20398);
-    int16x8_t v2516 = vaddq_s16(v2510, v2515);
-    int16x8_t v2517 = vsubq_s16(v1677, v1682);
-    int16x8_t v2518 = vsubq_s16(v1687, v1692);
-    int16x8_t v2519_tmp = vqrdmulhq_n_s16(v2518, 23673);
-    int16x8_t v2519 = vaddq_s16(v2519_tmp, v2518);
-    int16x8_t v2520 = vaddq_s16(v2517, v2519);
-    int16x8_t v2521 = vsubq_s16(v1699, v1704);
-    int16x8_t v2522 = vsubq_s16(v1709, v1714);
-    int16x8_t v2523_tmp = vqrdmulhq_n_s16(v2522, 23673);
-    int16x8_t v2523 = vaddq_s16(v2523_tmp, v2522);
-    int16x8_t v2524 = vaddq_s16(v2521, v2523);
-    int16x8_t v2525 = vqrdmulhq_n_s16(v2524, 20398);
-    int16x8_t v2526 = vaddq_s16(v2520, v2525);
-    int16x8_t v2527 = vqrdmulhq_n_s16(v2526, 17255);
-    int16x8_t v2528 = vaddq_s16(v2516, v2527);
-    int16x8_t v2529 = vqrdmulhq_n_s16(v2528, 16595);
-    int16x8_t v2530 = vaddq_s16(v2506, v2529);
-    int16x8_t v2531 = vsubq_s16(v1727, v1732);
-    int16x8_t v2532 = vsubq_s16(v1737, v1742);
-    int16x8_t v2533_tmp = vqrdmulhq_n_s16(v2532, 23673);
-    int16x8_t v2533 = vaddq_s16(v2533_tmp, v2532);
-    int16x8_t v2534 = vaddq_s16(v2531, v2533);
-    int16x8_t v2535 = vsubq_s16(v1749, v1754);
-    int16x8_t v2536 = vsubq_s16(v1759, v1764);
-    int16x8_t v2537_tmp = vqrdmulhq_n_s16(v2536, 23673);
-    int16x8_t v2537 = vaddq_s16(v2537_tmp, v2536);
-    int16x8_t v2538 = vaddq_s16(v2535, v2537);
-    int16x8_t v2539 = vqrdmulhq_n_s16(v2538, 20398);
-    int16x8_t v2540 = vaddq_s16(v2534, v2539);
-    int16x8_t v2541 = vsubq_s16(v1773, v1778);
-    int16x8_t v2542 = vsubq_s16(v1783, v1788);
-    int16x8_t v2543_tmp = vqrdmulhq_n_s16(v2542, 23673);
-    int16x8_t v2543 = vaddq_s16(v2543_tmp, v2542);
-    int16x8_t v2544 = vaddq_s16(v2541, v2543);
-    int16x8_t v2545 = vsubq_s16(v1795, v1800);
-    int16x8_t v2546 = vsubq_s16(v1805, v1810);
-    int16x8_t v2547_tmp = vqrdmulhq_n_s16(v2546, 23673);
-    int16x8_t v2547 = vaddq_s16(v2547_tmp, v2546);
-    int16x8_t v2548 = vaddq_s16(v2545, v2547);
-    int16x8_t v2549 = vqrdmulhq_n_s16(v2548, 20398);
-    int16x8_t v2550 = vaddq_s16(v2544, v2549);
-    int16x8_t v2551 = vqrdmulhq_n_s16(v2550, 17255);
-    int16x8_t v2552 = vaddq_s16(v2540, v2551);
-    int16x8_t v2553 = vsubq_s16(v1821, v1826);
-    int16x8_t v2554 = vsubq_s16(v1831, v1836);
-    int16x8_t v2555_tmp = vqrdmulhq_n_s16(v2554, 23673);
-    int16x8_t v2555 = vaddq_s16(v2555_tmp, v2554);
-    int16x8_t v2556 = vaddq_s16(v2553, v2555);
-    int16x8_t v2557 = vsubq_s16(v1843, v1848);
-    int16x8_t v2558 = vsubq_s16(v1853, v1858);
-    int16x8_t v2559_tmp = vqrdmulhq_n_s16(v2558, 23673);
-    int16x8_t v2559 = vaddq_s16(v2559_tmp, v2558);
-    int16x8_t v2560 = vaddq_s16(v2557, v2559);
-    int16x8_t v2561 = vqrdmulhq_n_s16(v2560, 20398);
-    int16x8_t v2562 = vaddq_s16(v2556, v2561);
-    int16x8_t v2563 = vsubq_s16(v1867, v1872);
-    int16x8_t v2564 = vsubq_s16(v1877, v1882);
-    int16x8_t v2565_tmp = vqrdmulhq_n_s16(v2564, 23673);
-    int16x8_t v2565 = vaddq_s16(v2565_tmp, v2564);
-    int16x8_t v2566 = vaddq_s16(v2563, v2565);
-    int16x8_t v2567 = vsubq_s16(v1889, v1894);
-    int16x8_t v2568 = vsubq_s16(v1899, v1904);
-    int16x8_t v2569_tmp = vqrdmulhq_n_s16(v2568, 23673);
-    int16x8_t v2569 = vaddq_s16(v2569_tmp, v2568);
-    int16x8_t v2570 = vaddq_s16(v2567, v2569);
-    int16x8_t v2571 = vqrdmulhq_n_s16(v2570, 20398);
-    int16x8_t v2572 = vaddq_s16(v2566, v2571);
-    int16x8_t v2573 = vqrdmulhq_n_s16(v2572, 17255);
-    int16x8_t v2574 = vaddq_s16(v2562, v2573);
-    int16x8_t v2575 = vqrdmulhq_n_s16(v2574, 16595);
-    int16x8_t v2576 = vaddq_s16(v2552, v2575);
-    int16x8_t v2577 = vqrdmulhq_n_s16(v2576, 16436);
-    int16x8_t v2578 = vaddq_s16(v2530, v2577);
-    int16x8_t v2579 = vsubq_s16(v9, v24);
-    int16x8_t v2580 = vsubq_s16(v42, v58);
-    int16x8_t v2581_tmp = vqrdmulhq_n_s16(v2580, 3314);
-    int16x8_t v2581 = vmlaq_n_s16(v2581_tmp, v2580, 5);
-    int16x8_t v2582 = vaddq_s16(v2579, v2581);
-    int16x8_t v2583 = vsubq_s16(v78, v101);
-    int16x8_t v2584 = vsubq_s16(v119, v136);
-    int16x8_t v2585_tmp = vqrdmulhq_n_s16(v2584, 3314);
-    int16x8_t v2585 = vmlaq_n_s16(v2585_tmp, v2584, 5);
-    int16x8_t v2586 = vaddq_s16(v2583, v2585);
-    int16x8_t v2587 = vqrdmulhq_n_s16(v2586, 22112);
-    int16x8_t v2588 = vaddq_s16(v2582, v2587);
-    int16x8_t v2589 = vsubq_s16(v158, v181);
-    int16x8_t v2590 = vsubq_s16(v213, v231);
-    int16x8_t v2591_tmp = vqrdmulhq_n_s16(v2590, 3314);
-    int16x8_t v2591 = vmlaq_n_s16(v2591_tmp, v2590, 5);
-    int16x8_t v2592 = vaddq_s16(v2589, v2591);
-    int16x8_t v2593 = vsubq_s16(v251, v274);
-    int16x8_t v2594 = vsubq_s16(v292, v310);
-    int16x8_t v2595_tmp = vqrdmulhq_n_s16(v2594, 3314);
-    int16x8_t v2595 = vmlaq_n_s16(v2595_tmp, v2594, 5);
-    int16x8_t v2596 = vaddq_s16(v2593, v2595);
-    int16x8_t v2597 = vqrdmulhq_n_s16(v2596, 22112);
-    int16x8_t v2598 = vaddq_s16(v2592, v2597);
-    int16x8_t v2599 = vqrdmulhq_n_s16(v2598, 17561);
-    int16x8_t v2600 = vaddq_s16(v2588, v2599);
-    int16x8_t v2601 = vsubq_s16(v334, v357);
-    int16x8_t v2602 = vsubq_s16(v389, v407);
-    int16x8_t v2603_tmp = vqrdmulhq_n_s16(v2602, 3314);
-    int16x8_t v2603 = vmlaq_n_s16(v2603_tmp, v2602, 5);
-    int16x8_t v2604 = vaddq_s16(v2601, v2603);
-    int16x8_t v2605 = vsubq_s16(v441, v480);
-    int16x8_t v2606 = vsubq_s16(v498, v517);
-    int16x8_t v2607_tmp = vqrdmulhq_n_s16(v2606, 3314);
-    int16x8_t v2607 = vmlaq_n_s16(v2607_tmp, v2606, 5);
-    int16x8_t v2608 = vaddq_s16(v2605, v2607);
-    int16x8_t v2609 = vqrdmulhq_n_s16(v2608, 22112);
-    int16x8_t v2610 = vaddq_s16(v2604, v2609);
-    int16x8_t v2611 = vsubq_s16(v539, v562);
-    int16x8_t v2612 = vsubq_s16(v594, v612);
-    int16x8_t v2613_tmp = vqrdmulhq_n_s16(v2612, 3314);
-    int16x8_t v2613 = vmlaq_n_s16(v2613_tmp, v2612, 5);
-    int16x8_t v2614 = vaddq_s16(v2611, v2613);
-    int16x8_t v2615 = vsubq_s16(v632, v655);
-    int16x8_t v2616 = vsubq_s16(v673, v692);
-    int16x8_t v2617_tmp = vqrdmulhq_n_s16(v2616, 3314);
-    int16x8_t v2617 = vmlaq_n_s16(v2617_tmp, v2616, 5);
-    int16x8_t v2618 = vaddq_s16(v2615, v2617);
-    int16x8_t v2619 = vqrdmulhq_n_s16(v2618, 22112);
-    int16x8_t v2620 = vaddq_s16(v2614, v2619);
-    int16x8_t v2621 = vqrdmulhq_n_s16(v2620, 17561);
-    int16x8_t v2622 = vaddq_s16(v2610, v2621);
-    int16x8_t v2623 = vqrdmulhq_n_s16(v2622, 16666);
-    int16x8_t v2624 = vaddq_s16(v2600, v2623);
-    int16x8_t v2625 = vsubq_s16(v718, v741);
-    int16x8_t v2626 = vsubq_s16(v773, v791);
-    int16x8_t v2627_tmp = vqrdmulhq_n_s16(v2626, 3314);
-    int16x8_t v2627 = vmlaq_n_s16(v2627_tmp, v2626, 5);
-    int16x8_t v2628 = vaddq_s16(v2625, v2627);
-    int16x8_t v2629 = vsubq_s16(v825, v864);
-    int16x8_t v2630 = vsubq_s16(v882, v901);
-    int16x8_t v2631_tmp = vqrdmulhq_n_s16(v2630, 3314);
-    int16x8_t v2631 = vmlaq_n_s16(v2631_tmp, v2630, 5);
-    int16x8_t v2632 = vaddq_s16(v2629, v2631);
-    int16x8_t v2633 = vqrdmulhq_n_s16(v2632, 22112);
-    int16x8_t v2634 = vaddq_s16(v2628, v2633);
-    int16x8_t v2635 = vsubq_s16(v937, v976);
-    int16x8_t v2636 = vsubq_s16(v1036, v1058);
-    int16x8_t v2637_tmp = vqrdmulhq_n_s16(v2636, 3314);
-    int16x8_t v2637 = vmlaq_n_s16(v2637_tmp, v2636, 5);
-    int16x8_t v2638 = vaddq_s16(v2635, v2637);
-    int16x8_t v2639 = vsubq_s16(v1078, v1101);
-    int16x8_t v2640 = vsubq_s16(v1119, v1139);
-    int16x8_t v2641_tmp = vqrdmulhq_n_s16(v2640, 3314);
-    int16x8_t v2641 = vmlaq_n_s16(v2641_tmp, v2640, 5);
-    int16x8_t v2642 = vaddq_s16(v2639, v2641);
-    int16x8_t v2643 = vqrdmulhq_n_s16(v2642, 22112);
-    int16x8_t v2644 = vaddq_s16(v2638, v2643);
-    int16x8_t v2645 = vqrdmulhq_n_s16(v2644, 17561);
-    int16x8_t v2646 = vaddq_s16(v2634, v2645);
-    int16x8_t v2647 = vsubq_s16(v1163, v1186);
-    int16x8_t v2648 = vsubq_s16(v1218, v1236);
-    int16x8_t v2649_tmp = vqrdmulhq_n_s16(v2648, 3314);
-    int16x8_t v2649 = vmlaq_n_s16(v2649_tmp, v2648, 5);
-    int16x8_t v2650 = vaddq_s16(v2647, v2649);
-    int16x8_t v2651 = vsubq_s16(v1270, v1309);
-    int16x8_t v2652 = vsubq_s16(v1327, v1346);
-    int16x8_t v2653_tmp = vqrdmulhq_n_s16(v2652, 3314);
-    int16x8_t v2653 = vmlaq_n_s16(v2653_tmp, v2652, 5);
-    int16x8_t v2654 = vaddq_s16(v2651, v2653);
-    int16x8_t v2655 = vqrdmulhq_n_s16(v2654, 22112);
-    int16x8_t v2656 = vaddq_s16(v2650, v2655);
-    int16x8_t v2657 = vsubq_s16(v1368, v1391);
-    int16x8_t v2658 = vsubq_s16(v1423, v1441);
-    int16x8_t v2659_tmp = vqrdmulhq_n_s16(v2658, 3314);
-    int16x8_t v2659 = vmlaq_n_s16(v2659_tmp, v2658, 5);
-    int16x8_t v2660 = vaddq_s16(v2657, v2659);
-    int16x8_t v2661 = vsubq_s16(v1461, v1484);
-    int16x8_t v2662 = vsubq_s16(v1502, v1522);
-    int16x8_t v2663_tmp = vqrdmulhq_n_s16(v2662, 3314);
-    int16x8_t v2663 = vmlaq_n_s16(v2663_tmp, v2662, 5);
-    int16x8_t v2664 = vaddq_s16(v2661, v2663);
-    int16x8_t v2665 = vqrdmulhq_n_s16(v2664, 22112);
-    int16x8_t v2666 = vaddq_s16(v2660, v2665);
-    int16x8_t v2667 = vqrdmulhq_n_s16(v2666, 17561);
-    int16x8_t v2668 = vaddq_s16(v2656, v2667);
-    int16x8_t v2669 = vqrdmulhq_n_s16(v2668, 16666);
-    int16x8_t v2670 = vaddq_s16(v2646, v2669);
-    int16x8_t v2671 = vqrdmulhq_n_s16(v2670, 16454);
-    int16x8_t v2672 = vaddq_s16(v2624, v2671);
-    int16x8_t v2673 = vsubq_s16(v2579, v2581);
-    int16x8_t v2674 = vsubq_s16(v2583, v2585);
-    int16x8_t v2675 = vqrdmulhq_n_s16(v2674, 24397);
-    int16x8_t v2676 = vaddq_s16(v2673, v2675);
-    int16x8_t v2677 = vsubq_s16(v2589, v2591);
-    int16x8_t v2678 = vsubq_s16(v2593, v2595);
-    int16x8_t v2679 = vqrdmulhq_n_s16(v2678, 24397);
-    int16x8_t v2680 = vaddq_s16(v2677, v2679);
-    int16x8_t v2681 = vqrdmulhq_n_s16(v2680, 17921);
-    int16x8_t v2682 = vaddq_s16(v2676, v2681);
-    int16x8_t v2683 = vsubq_s16(v2601, v2603);
-    int16x8_t v2684 = vsubq_s16(v2605, v2607);
-    int16x8_t v2685 = vqrdmulhq_n_s16(v2684, 24397);
-    int16x8_t v2686 = vaddq_s16(v2683, v2685);
-    int16x8_t v2687 = vsubq_s16(v2611, v2613);
-    int16x8_t v2688 = vsubq_s16(v2615, v2617);
-    int16x8_t v2689 = vqrdmulhq_n_s16(v2688, 24397);
-    int16x8_t v2690 = vaddq_s16(v2687, v2689);
-    int16x8_t v2691 = vqrdmulhq_n_s16(v2690, 17921);
-    int16x8_t v2692 = vaddq_s16(v2686, v2691);
-    int16x8_t v2693 = vqrdmulhq_n_s16(v2692, 16747);
-    int16x8_t v2694 = vaddq_s16(v2682, v2693);
-    int16x8_t v2695 = vsubq_s16(v2625, v2627);
-    int16x8_t v2696 = vsubq_s16(v2629, v2631);
-    int16x8_t v2697 = vqrdmulhq_n_s16(v2696, 24397);
-    int16x8_t v2698 = vaddq_s16(v2695, v2697);
-    int16x8_t v2699 = vsubq_s16(v2635, v2637);
-    int16x8_t v2700 = vsubq_s16(v2639, v2641);
-    int16x8_t v2701 = vqrdmulhq_n_s16(v2700, 24397);
-    int16x8_t v2702 = vaddq_s16(v2699, v2701);
-    int16x8_t v2703 = vqrdmulhq_n_s16(v2702, 17921);
-    int16x8_t v2704 = vaddq_s16(v2698, v2703);
-    int16x8_t v2705 = vsubq_s16(v2647, v2649);
-    int16x8_t v2706 = vsubq_s16(v2651, v2653);
-    int16x8_t v2707 = vqrdmulhq_n_s16(v2706, 24397);
-    int16x8_t v2708 = vaddq_s16(v2705, v2707);
-    int16x8_t v2709 = vsubq_s16(v2657, v2659);
-    int16x8_t v2710 = vsubq_s16(v2661, v2663);
-    int16x8_t v2711 = vqrdmulhq_n_s16(v2710, 24397);
-    int16x8_t v2712 = vaddq_s16(v2709, v2711);
-    int16x8_t v2713 = vqrdmulhq_n_s16(v2712, 17921);
-    int16x8_t v2714 = vaddq_s16(v2708, v2713);
-    int16x8_t v2715 = vqrdmulhq_n_s16(v2714, 16747);
-    int16x8_t v2716 = vaddq_s16(v2704, v2715);
-    int16x8_t v2717 = vqrdmulhq_n_s16(v2716, 16474);
-    int16x8_t v2718 = vaddq_s16(v2694, v2717);
-    int16x8_t v2719 = vsubq_s16(v2485, v2487);
-    int16x8_t v2720 = vsubq_s16(v2489, v2491);
-    int16x8_t v2721 = vqrdmulhq_n_s16(v2720, 27504);
-    int16x8_t v2722 = vaddq_s16(v2719, v2721);
-    int16x8_t v2723 = vsubq_s16(v2495, v2497);
-    int16x8_t v2724 = vsubq_s16(v2499, v2501);
-    int16x8_t v2725 = vqrdmulhq_n_s16(v2724, 27504);
-    int16x8_t v2726 = vaddq_s16(v2723, v2725);
-    int16x8_t v2727 = vqrdmulhq_n_s16(v2726, 18343);
-    int16x8_t v2728 = vaddq_s16(v2722, v2727);
-    int16x8_t v2729 = vsubq_s16(v2507, v2509);
-    int16x8_t v2730 = vsubq_s16(v2511, v2513);
-    int16x8_t v2731 = vqrdmulhq_n_s16(v2730, 27504);
-    int16x8_t v2732 = vaddq_s16(v2729, v2731);
-    int16x8_t v2733 = vsubq_s16(v2517, v2519);
-    int16x8_t v2734 = vsubq_s16(v2521, v2523);
-    int16x8_t v2735 = vqrdmulhq_n_s16(v2734, 27504);
-    int16x8_t v2736 = vaddq_s16(v2733, v2735);
-    int16x8_t v2737 = vqrdmulhq_n_s16(v2736, 18343);
-    int16x8_t v2738 = vaddq_s16(v2732, v2737);
-    int16x8_t v2739 = vqrdmulhq_n_s16(v2738, 16840);
-    int16x8_t v2740 = vaddq_s16(v2728, v2739);
-    int16x8_t v2741 = vsubq_s16(v2531, v2533);
-    int16x8_t v2742 = vsubq_s16(v2535, v2537);
-    int16x8_t v2743 = vqrdmulhq_n_s16(v2742, 27504);
-    int16x8_t v2744 = vaddq_s16(v2741, v2743);
-    int16x8_t v2745 = vsubq_s16(v2541, v2543);
-    int16x8_t v2746 = vsubq_s16(v2545, v2547);
-    int16x8_t v2747 = vqrdmulhq_n_s16(v2746, 27504);
-    int16x8_t v2748 = vaddq_s16(v2745, v2747);
-    int16x8_t v2749 = vqrdmulhq_n_s16(v2748, 18343);
-    int16x8_t v2750 = vaddq_s16(v2744, v2749);
-    int16x8_t v2751 = vsubq_s16(v2553, v2555);
-    int16x8_t v2752 = vsubq_s16(v2557, v2559);
-    int16x8_t v2753 = vqrdmulhq_n_s16(v2752, 27504);
-    int16x8_t v2754 = vaddq_s16(v2751, v2753);
-    int16x8_t v2755 = vsubq_s16(v2563, v2565);
-    int16x8_t v2756 = vsubq_s16(v2567, v2569);
-    int16x8_t v2757 = vqrdmulhq_n_s16(v2756, 27504);
-    int16x8_t v2758 = vaddq_s16(v2755, v2757);
-    int16x8_t v2759 = vqrdmulhq_n_s16(v2758, 18343);
-    int16x8_t v2760 = vaddq_s16(v2754, v2759);
-    int16x8_t v2761 = vqrdmulhq_n_s16(v2760, 16840);
-    int16x8_t v2762 = vaddq_s16(v2750, v2761);
-    int16x8_t v2763 = vqrdmulhq_n_s16(v2762, 16496);
-    int16x8_t v2764 = vaddq_s16(v2740, v2763);
-    int16x8_t v2765 = vsubq_s16(v2390, v2392);
-    int16x8_t v2766 = vsubq_s16(v2394, v2396);
-    int16x8_t v2767 = vqrdmulhq_n_s16(v2766, 31869);
-    int16x8_t v2768 = vaddq_s16(v2765, v2767);
-    int16x8_t v2769 = vsubq_s16(v2400, v2402);
-    int16x8_t v2770 = vsubq_s16(v2404, v2406);
-    int16x8_t v2771 = vqrdmulhq_n_s16(v2770, 31869);
-    int16x8_t v2772 = vaddq_s16(v2769, v2771);
-    int16x8_t v2773 = vqrdmulhq_n_s16(v2772, 18830);
-    int16x8_t v2774 = vaddq_s16(v2768, v2773);
-    int16x8_t v2775 = vsubq_s16(v2412, v2414);
-    int16x8_t v2776 = vsubq_s16(v2416, v2418);
-    int16x8_t v2777 = vqrdmulhq_n_s16(v2776, 31869);
-    int16x8_t v2778 = vaddq_s16(v2775, v2777);
-    int16x8_t v2779 = vsubq_s16(v2422, v2424);
-    int16x8_t v2780 = vsubq_s16(v2426, v2428);
-    int16x8_t v2781 = vqrdmulhq_n_s16(v2780, 31869);
-    int16x8_t v2782 = vaddq_s16(v2779, v2781);
-    int16x8_t v2783 = vqrdmulhq_n_s16(v2782, 18830);
-    int16x8_t v2784 = vaddq_s16(v2778, v2783);
-    int16x8_t v2785 = vqrdmulhq_n_s16(v2784, 16944);
-    int16x8_t v2786 = vaddq_s16(v2774, v2785);
-    int16x8_t v2787 = vsubq_s16(v2436, v2438);
-    int16x8_t v2788 = vsubq_s16(v2440, v2442);
-    int16x8_t v2789 = vqrdmulhq_n_s16(v2788, 31869);
-    int16x8_t v2790 = vaddq_s16(v2787, v2789);
-    int16x8_t v2791 = vsubq_s16(v2446, v2448);
-    int16x8_t v2792 = vsubq_s16(v2450, v2452);
-    int16x8_t v2793 = vqrdmulhq_n_s16(v2792, 31869);
-    int16x8_t v2794 = vaddq_s16(v2791, v2793);
-    int16x8_t v2795 = vqrdmulhq_n_s16(v2794, 18830);
-    int16x8_t v2796 = vaddq_s16(v2790, v2795);
-    int16x8_t v2797 = vsubq_s16(v2458, v2460);
-    int16x8_t v2798 = vsubq_s16(v2462, v2465);
-    int16x8_t v2799 = vqrdmulhq_n_s16(v2798, 31869);
-    int16x8_t v2800 = vaddq_s16(v2797, v2799);
-    int16x8_t v2801 = vsubq_s16(v2469, v2471);
-    int16x8_t v2802 = vsubq_s16(v2473, v2475);
-    int16x8_t v2803 = vqrdmulhq_n_s16(v2802, 31869);
-    int16x8_t v2804 = vaddq_s16(v2801, v2803);
-    int16x8_t v2805 = vqrdmulhq_n_s16(v2804, 18830);
-    int16x8_t v2806 = vaddq_s16(v2800, v2805);
-    int16x8_t v2807 = vqrdmulhq_n_s16(v2806, 16944);
-    int16x8_t v2808 = vaddq_s16(v2796, v2807);
-    int16x8_t v2809 = vqrdmulhq_n_s16(v2808, 16521);
-    int16x8_t v2810 = vaddq_s16(v2786, v2809);
-    int16x8_t v2811 = vsubq_s16(v2296, v2298);
-    int16x8_t v2812 = vsubq_s16(v2300, v2302);
-    int16x8_t v2813_tmp = vqrdmulhq_n_s16(v2812, 5552);
-    int16x8_t v2813 = vaddq_s16(v2813_tmp, v2812);
-    int16x8_t v2814 = vaddq_s16(v2811, v2813);
-    int16x8_t v2815 = vsubq_s16(v2306, v2308);
-    int16x8_t v2816 = vsubq_s16(v2310, v2312);
-    int16x8_t v2817_tmp = vqrdmulhq_n_s16(v2816, 5552);
-    int16x8_t v2817 = vaddq_s16(v2817_tmp, v2816);
-    int16x8_t v2818 = vaddq_s16(v2815, v2817);
-    int16x8_t v2819 = vqrdmulhq_n_s16(v2818, 19393);
-    int16x8_t v2820 = vaddq_s16(v2814, v2819);
-    int16x8_t v2821 = vsubq_s16(v2318, v2320);
-    int16x8_t v2822 = vsubq_s16(v2322, v2324);
-    int16x8_t v2823_tmp = vqrdmulhq_n_s16(v2822, 5552);
-    int16x8_t v2823 = vaddq_s16(v2823_tmp, v2822);
-    int16x8_t v2824 = vaddq_s16(v2821, v2823);
-    int16x8_t v2825 = vsubq_s16(v2328, v2330);
-    int16x8_t v2826 = vsubq_s16(v2332, v2334);
-    int16x8_t v2827_tmp = vqrdmulhq_n_s16(v2826, 5552);
-    int16x8_t v2827 = vaddq_s16(v2827_tmp, v2826);
-    int16x8_t v2828 = vaddq_s16(v2825, v2827);
-    int16x8_t v2829 = vqrdmulhq_n_s16(v2828, 19393);
-    int16x8_t v2830 = vaddq_s16(v2824, v2829);
-    int16x8_t v2831 = vqrdmulhq_n_s16(v2830, 17059);
-    int16x8_t v2832 = vaddq_s16(v2820, v2831);
-    int16x8_t v2833 = vsubq_s16(v2342, v2344);
-    int16x8_t v2834 = vsubq_s16(v2346, v2348);
-    int16x8_t v2835_tmp = vqrdmulhq_n_s16(v2834, 5552);
-    int16x8_t v2835 = vaddq_s16(v2835_tmp, v2834);
-    int16x8_t v2836 = vaddq_s16(v2833, v2835);
-    int16x8_t v2837 = vsubq_s16(v2352, v2354);
-    int16x8_t v2838 = vsubq_s16(v2356, v2358);
-    int16x8_t v2839_tmp = vqrdmulhq_n_s16(v2838, 5552);
-    int16x8_t v2839 = vaddq_s16(v2839_tmp, v2838);
-    int16x8_t v2840 = vaddq_s16(v2837, v2839);
-    int16x8_t v2841 = vqrdmulhq_n_s16(v2840, 19393);
-    int16x8_t v2842 = vaddq_s16(v2836, v2841);
-    int16x8_t v2843 = vsubq_s16(v2364, v2366);
-    int16x8_t v2844 = vsubq_s16(v2368, v2370);
-    int16x8_t v2845_tmp = vqrdmulhq_n_s16(v2844, 5552);
-    int16x8_t v2845 = vaddq_s16(v2845_tmp, v2844);
-    int16x8_t v2846 = vaddq_s16(v2843, v2845);
-    int16x8_t v2847 = vsubq_s16(v2374, v2376);
-    int16x8_t v2848 = vsubq_s16(v2378, v2380);
-    int16x8_t v2849_tmp = vqrdmulhq_n_s16(v2848, 5552);
-    int16x8_t v2849 = vaddq_s16(v2849_tmp, v2848);
-    int16x8_t v2850 = vaddq_s16(v2847, v2849);
-    int16x8_t v2851 = vqrdmulhq_n_s16(v2850, 19393);
-    int16x8_t v2852 = vaddq_s16(v2846, v2851);
-    int16x8_t v2853 = vqrdmulhq_n_s16(v2852, 17059);
-    int16x8_t v2854 = vaddq_s16(v2842, v2853);
-    int16x8_t v2855 = vqrdmulhq_n_s16(v2854, 16549);
-    int16x8_t v2856 = vaddq_s16(v2832, v2855);
-    int16x8_t v2857 = vsubq_s16(v2109, v2114);
-    int16x8_t v2858 = vsubq_s16(v2119, v2124);
-    int16x8_t v2859_tmp = vqrdmulhq_n_s16(v2858, 15865);
-    int16x8_t v2859 = vaddq_s16(v2859_tmp, v2858);
-    int16x8_t v2860 = vaddq_s16(v2857, v2859);
-    int16x8_t v2861 = vsubq_s16(v2131, v2136);
-    int16x8_t v2862 = vsubq_s16(v2141, v2146);
-    int16x8_t v2863_tmp = vqrdmulhq_n_s16(v2862, 15865);
-    int16x8_t v2863 = vaddq_s16(v2863_tmp, v2862);
-    int16x8_t v2864 = vaddq_s16(v2861, v2863);
-    int16x8_t v2865 = vqrdmulhq_n_s16(v2864, 20040);
-    int16x8_t v2866 = vaddq_s16(v2860, v2865);
-    int16x8_t v2867 = vsubq_s16(v2155, v2160);
-    int16x8_t v2868 = vsubq_s16(v2165, v2170);
-    int16x8_t v2869_tmp = vqrdmulhq_n_s16(v2868, 15865);
-    int16x8_t v2869 = vaddq_s16(v2869_tmp, v2868);
-    int16x8_t v2870 = vaddq_s16(v2867, v2869);
-    int16x8_t v2871 = vsubq_s16(v2177, v2182);
-    int16x8_t v2872 = vsubq_s16(v2187, v2192);
-    int16x8_t v2873_tmp = vqrdmulhq_n_s16(v2872, 15865);
-    int16x8_t v2873 = vaddq_s16(v2873_tmp, v2872);
-    int16x8_t v2874 = vaddq_s16(v2871, v2873);
-    int16x8_t v2875 = vqrdmulhq_n_s16(v2874, 20040);
-    int16x8_t v2876 = vaddq_s16(v2870, v2875);
-    int16x8_t v2877 = vqrdmulhq_n_s16(v2876, 17187);
-    int16x8_t v2878 = vaddq_s16(v2866, v2877);
-    int16x8_t v2879 = vsubq_s16(v2203, v2208);
-    int16x8_t v2880 = vsubq_s16(v2213, v2218);
-    int16x8_t v2881_tmp = vqrdmulhq_n_s16(v2880, 15865);
-    int16x8_t v2881 = vaddq_s16(v2881_tmp, v2880);
-    int16x8_t v2882 = vaddq_s16(v2879, v2881);
-    int16x8_t v2883 = vsubq_s16(v2225, v2230);
-    int16x8_t v2884 = vsubq_s16(v2235, v2240);
-    int16x8_t v2885_tmp = vqrdmulhq_n_s16(v2884, 15865);
-    int16x8_t v2885 = vaddq_s16(v2885_tmp, v2884);
-    int16x8_t v2886 = vaddq_s16(v2883, v2885);
-    int16x8_t v2887 = vqrdmulhq_n_s16(v2886, 20040);
-    int16x8_t v2888 = vaddq_s16(v2882, v2887);
-    int16x8_t v2889 = vsubq_s16(v2249, v2254);
-    int16x8_t v2890 = vsubq_s16(v2259, v2264);
-    int16x8_t v2891_tmp = vqrdmulhq_n_s16(v2890, 15865);
-    int16x8_t v2891 = vaddq_s16(v2891_tmp, v2890);
-    int16x8_t v2892 = vaddq_s16(v2889, v2891);
-    int16x8_t v2893 = vsubq_s16(v2271, v2276);
-    int16x8_t v2894 = vsubq_s16(v2281, v2286);
-    int16x8_t v2895_tmp = vqrdmulhq_n_s16(v2894, 15865);
-    int16x8_t v2895 = vaddq_s16(v2895_tmp, v2894);
-    int16x8_t v2896 = vaddq_s16(v2893, v2895);
-    int16x8_t v2897 = vqrdmulhq_n_s16(v2896, 20040);
-    int16x8_t v2898 = vaddq_s16(v2892, v2897);
-    int16x8_t v2899 = vqrdmulhq_n_s16(v2898, 17187);
-    int16x8_t v2900 = vaddq_s16(v2888, v2899);
-    int16x8_t v2901 = vqrdmulhq_n_s16(v2900, 16579);
-    int16x8_t v2902 = vaddq_s16(v2878, v2901);
-    int16x8_t v2903 = vsubq_s16(v1919, v1924);
-    int16x8_t v2904 = vsubq_s16(v1929, v1934);
-    int16x8_t v2905_tmp = vqrdmulhq_n_s16(v2904, 1893);
-    int16x8_t v2905 = vmlaq_n_s16(v2905_tmp, v2904, 2);
-    int16x8_t v2906 = vaddq_s16(v2903, v2905);
-    int16x8_t v2907 = vsubq_s16(v1941, v1946);
-    int16x8_t v2908 = vsubq_s16(v1951, v1956);
-    int16x8_t v2909_tmp = vqrdmulhq_n_s16(v2908, 1893);
-    int16x8_t v2909 = vmlaq_n_s16(v2909_tmp, v2908, 2);
-    int16x8_t v2910 = vaddq_s16(v2907, v2909);
-    int16x8_t v2911 = vqrdmulhq_n_s16(v2910, 20783);
-    int16x8_t v2912 = vaddq_s16(v2906, v2911);
-    int16x8_t v2913 = vsubq_s16(v1965, v1970);
-    int16x8_t v2914 = vsubq_s16(v1975, v1980);
-    int16x8_t v2915_tmp = vqrdmulhq_n_s16(v2914, 1893);
-    int16x8_t v2915 = vmlaq_n_s16(v2915_tmp, v2914, 2);
-    int16x8_t v2916 = vaddq_s16(v2913, v2915);
-    int16x8_t v2917 = vsubq_s16(v1987, v1992);
-    int16x8_t v2918 = vsubq_s16(v1997, v2002);
-    int16x8_t v2919_tmp = vqrdmulhq_n_s16(v2918, 1893);
-    int16x8_t v2919 = vmlaq_n_s16(v2919_tmp, v2918, 2);
-    int16x8_t v2920 = vaddq_s16(v2917, v2919);
-    int16x8_t v2921 = vqrdmulhq_n_s16(v2920, 20783);
-    int16x8_t v2922 = vaddq_s16(v2916, v2921);
-    int16x8_t v2923 = vqrdmulhq_n_s16(v2922, 17326);
-    int16x8_t v2924 = vaddq_s16(v2912, v2923);
-    int16x8_t v2925 = vsubq_s16(v2013, v2018);
-    int16x8_t v2926 = vsubq_s16(v2023, v2028);
-    int16x8_t v2927_tmp = vqrdmulhq_n_s16(v2926, 1893);
-    int16x8_t v2927 = vmlaq_n_s16(v2927_tmp, v2926, 2);
-    int16x8_t v2928 = vaddq_s16(v2925, v2927);
-    int16x8_t v2929 = vsubq_s16(v2035, v2040);
-    int16x8_t v2930 = vsubq_s16(v2045, v2050);
-    int16x8_t v2931_tmp = vqrdmulhq_n_s16(v2930, 1893);
-    int16x8_t v2931 = vmlaq_n_s16(v2931_tmp, v2930, 2);
-    int16x8_t v2932 = vaddq_s16(v2929, v2931);
-    int16x8_t v2933 = vqrdmulhq_n_s16(v2932, 20783);
-    int16x8_t v2934 = vaddq_s16(v2928, v2933);
-    int16x8_t v2935 = vsubq_s16(v2059, v2064);
-    int16x8_t v2936 = vsubq_s16(v2069, v2074);
-    int16x8_t v2937_tmp = vqrdmulhq_n_s16(v2936, 1893);
-    int16x8_t v2937 = vmlaq_n_s16(v2937_tmp, v2936, 2);
-    int16x8_t v2938 = vaddq_s16(v2935, v2937);
-    int16x8_t v2939 = vsubq_s16(v2081, v2086);
-    int16x8_t v2940 = vsubq_s16(v2091, v2096);
-    int16x8_t v2941_tmp = vqrdmulhq_n_s16(v2940, 1893);
-    int16x8_t v2941 = vmlaq_n_s16(v2941_tmp, v2940, 2);
-    int16x8_t v2942 = vaddq_s16(v2939, v2941);
-    int16x8_t v2943 = vqrdmulhq_n_s16(v2942, 20783);
-    int16x8_t v2944 = vaddq_s16(v2938, v2943);
-    int16x8_t v2945 = vqrdmulhq_n_s16(v2944, 17326);
-    int16x8_t v2946 = vaddq_s16(v2934, v2945);
-    int16x8_t v2947 = vqrdmulhq_n_s16(v2946, 16611);
-    int16x8_t v2948 = vaddq_s16(v2924, v2947);
-    int16x8_t v2949 = vsubq_s16(v1543, v1554);
-    int16x8_t v2950 = vsubq_s16(v1565, v1576);
-    int16x8_t v2951_tmp = vqrdmulhq_n_s16(v2950, 13357);
-    int16x8_t v2951 = vmlaq_n_s16(v2951_tmp, v2950, 3);
-    int16x8_t v2952 = vaddq_s16(v2949, v2951);
-    int16x8_t v2953 = vsubq_s16(v1589, v1600);
-    int16x8_t v2954 = vsubq_s16(v1611, v1622);
-    int16x8_t v2955_tmp = vqrdmulhq_n_s16(v2954, 13357);
-    int16x8_t v2955 = vmlaq_n_s16(v2955_tmp, v2954, 3);
-    int16x8_t v2956 = vaddq_s16(v2953, v2955);
-    int16x8_t v2957 = vqrdmulhq_n_s16(v2956, 21637);
-    int16x8_t v2958 = vaddq_s16(v2952, v2957);
-    int16x8_t v2959 = vsubq_s16(v1637, v1648);
-    int16x8_t v2960 = vsubq_s16(v1659, v1670);
-    int16x8_t v2961_tmp = vqrdmulhq_n_s16(v2960, 13357);
-    int16x8_t v2961 = vmlaq_n_s16(v2961_tmp, v2960, 3);
-    int16x8_t v2962 = vaddq_s16(v2959, v2961);
-    int16x8_t v2963 = vsubq_s16(v1683, v1694);
-    int16x8_t v2964 = vsubq_s16(v1705, v1716);
-    int16x8_t v2965_tmp = vqrdmulhq_n_s16(v2964, 13357);
-    int16x8_t v2965 = vmlaq_n_s16(v2965_tmp, v2964, 3);
-    int16x8_t v2966 = vaddq_s16(v2963, v2965);
-    int16x8_t v2967 = vqrdmulhq_n_s16(v2966, 21637);
-    int16x8_t v2968 = vaddq_s16(v2962, v2967);
-    int16x8_t v2969 = vqrdmulhq_n_s16(v2968, 17479);
-    int16x8_t v2970 = vaddq_s16(v2958, v2969);
-    int16x8_t v2971 = vsubq_s16(v1733, v1744);
-    int16x8_t v2972 = vsubq_s16(v1755, v1766);
-    int16x8_t v2973_tmp = vqrdmulhq_n_s16(v2972, 13357);
-    int16x8_t v2973 = vmlaq_n_s16(v2973_tmp, v2972, 3);
-    int16x8_t v2974 = vaddq_s16(v2971, v2973);
-    int16x8_t v2975 = vsubq_s16(v1779, v1790);
-    int16x8_t v2976 = vsubq_s16(v1801, v1812);
-    int16x8_t v2977_tmp = vqrdmulhq_n_s16(v2976, 13357);
-    int16x8_t v2977 = vmlaq_n_s16(v2977_tmp, v2976, 3);
-    int16x8_t v2978 = vaddq_s16(v2975, v2977);
-    int16x8_t v2979 = vqrdmulhq_n_s16(v2978, 21637);
-    int16x8_t v2980 = vaddq_s16(v2974, v2979);
-    int16x8_t v2981 = vsubq_s16(v1827, v1838);
-    int16x8_t v2982 = vsubq_s16(v1849, v1860);
-    int16x8_t v2983_tmp = vqrdmulhq_n_s16(v2982, 13357);
-    int16x8_t v2983 = vmlaq_n_s16(v2983_tmp, v2982, 3);
-    int16x8_t v2984 = vaddq_s16(v2981, v2983);
-    int16x8_t v2985 = vsubq_s16(v1873, v1884);
-    int16x8_t v2986 = vsubq_s16(v1895, v1906);
-    int16x8_t v2987_tmp = vqrdmulhq_n_s16(v2986, 13357);
-    int16x8_t v2987 = vmlaq_n_s16(v2987_tmp, v2986, 3);
-    int16x8_t v2988 = vaddq_s16(v2985, v2987);
-    int16x8_t v2989 = vqrdmulhq_n_s16(v2988, 21637);
-    int16x8_t v2990 = vaddq_s16(v2984, v2989);
-    int16x8_t v2991 = vqrdmulhq_n_s16(v2990, 17479);
-    int16x8_t v2992 = vaddq_s16(v2980, v2991);
-    int16x8_t v2993 = vqrdmulhq_n_s16(v2992, 16647);
-    int16x8_t v2994 = vaddq_s16(v2970, v2993);
-    int16x8_t v2995 = vsubq_s16(v25, v60);
-    int16x8_t v2996 = vsubq_s16(v102, v138);
-    int16x8_t v2997_tmp = vqrdmulhq_n_s16(v2996, 6226);
-    int16x8_t v2997 = vmlaq_n_s16(v2997_tmp, v2996, 10);
-    int16x8_t v2998 = vaddq_s16(v2995, v2997);
-    int16x8_t v2999 = vsubq_s16(v182, v233);
-    int16x8_t v3000 = vsubq_s16(v275, v312);
-    int16x8_t v3001_tmp = vqrdmulhq_n_s16(v3000, 6226);
-    int16x8_t v3001 = vmlaq_n_s16(v3001_tmp, v3000, 10);
-    int16x8_t v3002 = vaddq_s16(v2999, v3001);
-    int16x8_t v3003 = vqrdmulhq_n_s16(v3002, 22622);
-    int16x8_t v3004 = vaddq_s16(v2998, v3003);
-    int16x8_t v3005 = vsubq_s16(v358, v409);
-    int16x8_t v3006 = vsubq_s16(v481, v519);
-    int16x8_t v3007_tmp = vqrdmulhq_n_s16(v3006, 6226);
-    int16x8_t v3007 = vmlaq_n_s16(v3007_tmp, v3006, 10);
-    int16x8_t v3008 = vaddq_s16(v3005, v3007);
-    int16x8_t v3009 = vsubq_s16(v563, v614);
-    int16x8_t v3010 = vsubq_s16(v656, v694);
-    int16x8_t v3011_tmp = vqrdmulhq_n_s16(v3010, 6226);
-    int16x8_t v3011 = vmlaq_n_s16(v3011_tmp, v3010, 10);
-    int16x8_t v3012 = vaddq_s16(v3009, v3011);
-    int16x8_t v3013 = vqrdmulhq_n_s16(v3012, 22622);
-    int16x8_t v3014 = vaddq_s16(v3008, v3013);
-    int16x8_t v3015 = vqrdmulhq_n_s16(v3014, 17646);
-    int16x8_t v3016 = vaddq_s16(v3004, v3015);
-    int16x8_t v3017 = vsubq_s16(v742, v793);
-    int16x8_t v3018 = vsubq_s16(v865, v903);
-    int16x8_t v3019_tmp = vqrdmulhq_n_s16(v3018, 6226);
-    int16x8_t v3019 = vmlaq_n_s16(v3019_tmp, v3018, 10);
-    int16x8_t v3020 = vaddq_s16(v3017, v3019);
-    int16x8_t v3021 = vsubq_s16(v977, v1060);
-    int16x8_t v3022 = vsubq_s16(v1102, v1141);
-    int16x8_t v3023_tmp = vqrdmulhq_n_s16(v3022, 6226);
-    int16x8_t v3023 = vmlaq_n_s16(v3023_tmp, v3022, 10);
-    int16x8_t v3024 = vaddq_s16(v3021, v3023);
-    int16x8_t v3025 = vqrdmulhq_n_s16(v3024, 22622);
-    int16x8_t v3026 = vaddq_s16(v3020, v3025);
-    int16x8_t v3027 = vsubq_s16(v1187, v1238);
-    int16x8_t v3028 = vsubq_s16(v1310, v1348);
-    int16x8_t v3029_tmp = vqrdmulhq_n_s16(v3028, 6226);
-    int16x8_t v3029 = vmlaq_n_s16(v3029_tmp, v3028, 10);
-    int16x8_t v3030 = vaddq_s16(v3027, v3029);
-    int16x8_t v3031 = vsubq_s16(v1392, v1443);
-    int16x8_t v3032 = vsubq_s16(v1485, v1524);
-    int16x8_t v3033_tmp = vqrdmulhq_n_s16(v3032, 6226);
-    int16x8_t v3033 = vmlaq_n_s16(v3033_tmp, v3032, 10);
-    int16x8_t v3034 = vaddq_s16(v3031, v3033);
-    int16x8_t v3035 = vqrdmulhq_n_s16(v3034, 22622);
-    int16x8_t v3036 = vaddq_s16(v3030, v3035);
-    int16x8_t v3037 = vqrdmulhq_n_s16(v3036, 17646);
-    int16x8_t v3038 = vaddq_s16(v3026, v3037);
-    int16x8_t v3039 = vqrdmulhq_n_s16(v3038, 16685);
-    int16x8_t v3040 = vaddq_s16(v3016, v3039);
-    int16x8_t v3041 = vsubq_s16(v2995, v2997);
-    int16x8_t v3042 = vsubq_s16(v2999, v3001);
-    int16x8_t v3043 = vqrdmulhq_n_s16(v3042, 23761);
-    int16x8_t v3044 = vaddq_s16(v3041, v3043);
-    int16x8_t v3045 = vsubq_s16(v3005, v3007);
-    int16x8_t v3046 = vsubq_s16(v3009, v3011);
-    int16x8_t v3047 = vqrdmulhq_n_s16(v3046, 23761);
-    int16x8_t v3048 = vaddq_s16(v3045, v3047);
-    int16x8_t v3049 = vqrdmulhq_n_s16(v3048, 17826);
-    int16x8_t v3050 = vaddq_s16(v3044, v3049);
-    int16x8_t v3051 = vsubq_s16(v3017, v3019);
-    int16x8_t v3052 = vsubq_s16(v3021, v3023);
-    int16x8_t v3053 = vqrdmulhq_n_s16(v3052, 23761);
-    int16x8_t v3054 = vaddq_s16(v3051, v3053);
-    int16x8_t v3055 = vsubq_s16(v3027, v3029);
-    int16x8_t v3056 = vsubq_s16(v3031, v3033);
-    int16x8_t v3057 = vqrdmulhq_n_s16(v3056, 23761);
-    int16x8_t v3058 = vaddq_s16(v3055, v3057);
-    int16x8_t v3059 = vqrdmulhq_n_s16(v3058, 17826);
-    int16x8_t v3060 = vaddq_s16(v3054, v3059);
-    int16x8_t v3061 = vqrdmulhq_n_s16(v3060, 16726);
-    int16x8_t v3062 = vaddq_s16(v3050, v3061);
-    int16x8_t v3063 = vsubq_s16(v2949, v2951);
-    int16x8_t v3064 = vsubq_s16(v2953, v2955);
-    int16x8_t v3065 = vqrdmulhq_n_s16(v3064, 25084);
-    int16x8_t v3066 = vaddq_s16(v3063, v3065);
-    int16x8_t v3067 = vsubq_s16(v2959, v2961);
-    int16x8_t v3068 = vsubq_s16(v2963, v2965);
-    int16x8_t v3069 = vqrdmulhq_n_s16(v3068, 25084);
-    int16x8_t v3070 = vaddq_s16(v3067, v3069);
-    int16x8_t v3071 = vqrdmulhq_n_s16(v3070, 18021);
-    int16x8_t v3072 = vaddq_s16(v3066, v3071);
-    int16x8_t v3073 = vsubq_s16(v2971, v2973);
-    int16x8_t v3074 = vsubq_s16(v2975, v2977);
-    int16x8_t v3075 = vqrdmulhq_n_s16(v3074, 25084);
-    int16x8_t v3076 = vaddq_s16(v3073, v3075);
-    int16x8_t v3077 = vsubq_s16(v2981, v2983);
-    int16x8_t v3078 = vsubq_s16(v2985, v2987);
-    int16x8_t v3079 = vqrdmulhq_n_s16(v3078, 25084);
-    int16x8_t v3080 = vaddq_s16(v3077, v3079);
-    int16x8_t v3081 = vqrdmulhq_n_s16(v3080, 18021);
-    int16x8_t v3082 = vaddq_s16(v3076, v3081);
-    int16x8_t v3083 = vqrdmulhq_n_s16(v3082, 16769);
-    int16x8_t v3084 = vaddq_s16(v3072, v3083);
-    int16x8_t v3085 = vsubq_s16(v2903, v2905);
-    int16x8_t v3086 = vsubq_s16(v2907, v2909);
-    int16x8_t v3087 = vqrdmulhq_n_s16(v3086, 26631);
-    int16x8_t v3088 = vaddq_s16(v3085, v3087);
-    int16x8_t v3089 = vsubq_s16(v2913, v2915);
-    int16x8_t v3090 = vsubq_s16(v2917, v2919);
-    int16x8_t v3091 = vqrdmulhq_n_s16(v3090, 26631);
-    int16x8_t v3092 = vaddq_s16(v3089, v3091);
-    int16x8_t v3093 = vqrdmulhq_n_s16(v3092, 18231);
-    int16x8_t v3094 = vaddq_s16(v3088, v3093);
-    int16x8_t v3095 = vsubq_s16(v2925, v2927);
-    int16x8_t v3096 = vsubq_s16(v2929, v2931);
-    int16x8_t v3097 = vqrdmulhq_n_s16(v3096, 26631);
-    int16x8_t v3098 = vaddq_s16(v3095, v3097);
-    int16x8_t v3099 = vsubq_s16(v2935, v2937);
-    int16x8_t v3100 = vsubq_s16(v2939, v2941);
-    int16x8_t v3101 = vqrdmulhq_n_s16(v3100, 26631);
-    int16x8_t v3102 = vaddq_s16(v3099, v3101);
-    int16x8_t v3103 = vqrdmulhq_n_s16(v3102, 18231);
-    int16x8_t v3104 = vaddq_s16(v3098, v3103);
-    int16x8_t v3105 = vqrdmulhq_n_s16(v3104, 16815);
-    int16x8_t v3106 = vaddq_s16(v3094, v3105);
-    int16x8_t v3107 = vsubq_s16(v2857, v2859);
-    int16x8_t v3108 = vsubq_s16(v2861, v2863);
-    int16x8_t v3109 = vqrdmulhq_n_s16(v3108, 28454);
-    int16x8_t v3110 = vaddq_s16(v3107, v3109);
-    int16x8_t v3111 = vsubq_s16(v2867, v2869);
-    int16x8_t v3112 = vsubq_s16(v2871, v2873);
-    int16x8_t v3113 = vqrdmulhq_n_s16(v3112, 28454);
-    int16x8_t v3114 = vaddq_s16(v3111, v3113);
-    int16x8_t v3115 = vqrdmulhq_n_s16(v3114, 18458);
-    int16x8_t v3116 = vaddq_s16(v3110, v3115);
-    int16x8_t v3117 = vsubq_s16(v2879, v2881);
-    int16x8_t v3118 = vsubq_s16(v2883, v2885);
-    int16x8_t v3119 = vqrdmulhq_n_s16(v3118, 28454);
-    int16x8_t v3120 = vaddq_s16(v3117, v3119);
-    int16x8_t v3121 = vsubq_s16(v2889, v2891);
-    int16x8_t v3122 = vsubq_s16(v2893, v2895);
-    int16x8_t v3123 = vqrdmulhq_n_s16(v3122, 28454);
-    int16x8_t v3124 = vaddq_s16(v3121, v3123);
-    int16x8_t v3125 = vqrdmulhq_n_s16(v3124, 18458);
-    int16x8_t v3126 = vaddq_s16(v3120, v3125);
-    int16x8_t v3127 = vqrdmulhq_n_s16(v3126, 16865);
-    int16x8_t v3128 = vaddq_s16(v3116, v3127);
-    int16x8_t v3129 = vsubq_s16(v2811, v2813);
-    int16x8_t v3130 = vsubq_s16(v2815, v2817);
-    int16x8_t v3131 = vqrdmulhq_n_s16(v3130, 30624);
-    int16x8_t v3132 = vaddq_s16(v3129, v3131);
-    int16x8_t v3133 = vsubq_s16(v2821, v2823);
-    int16x8_t v3134 = vsubq_s16(v2825, v2827);
-    int16x8_t v3135 = vqrdmulhq_n_s16(v3134, 30624);
-    int16x8_t v3136 = vaddq_s16(v3133, v3135);
-    int16x8_t v3137 = vqrdmulhq_n_s16(v3136, 18702);
-    int16x8_t v3138 = vaddq_s16(v3132, v3137);
-    int16x8_t v3139 = vsubq_s16(v2833, v2835);
-    int16x8_t v3140 = vsubq_s16(v2837, v2839);
-    int16x8_t v3141 = vqrdmulhq_n_s16(v3140, 30624);
-    int16x8_t v3142 = vaddq_s16(v3139, v3141);
-    int16x8_t v3143 = vsubq_s16(v2843, v2845);
-    int16x8_t v3144 = vsubq_s16(v2847, v2849);
-    int16x8_t v3145 = vqrdmulhq_n_s16(v3144, 30624);
-    int16x8_t v3146 = vaddq_s16(v3143, v3145);
-    int16x8_t v3147 = vqrdmulhq_n_s16(v3146, 18702);
-    int16x8_t v3148 = vaddq_s16(v3142, v3147);
-    int16x8_t v3149 = vqrdmulhq_n_s16(v3148, 16916);
-    int16x8_t v3150 = vaddq_s16(v3138, v3149);
-    int16x8_t v3151 = vsubq_s16(v2765, v2767);
-    int16x8_t v3152 = vsubq_s16(v2769, v2771);
-    int16x8_t v3153_tmp = vqrdmulhq_n_s16(v3152, 472);
-    int16x8_t v3153 = vaddq_s16(v3153_tmp, v3152);
-    int16x8_t v3154 = vaddq_s16(v3151, v3153);
-    int16x8_t v3155 = vsubq_s16(v2775, v2777);
-    int16x8_t v3156 = vsubq_s16(v2779, v2781);
-    int16x8_t v3157_tmp = vqrdmulhq_n_s16(v3156, 472);
-    int16x8_t v3157 = vaddq_s16(v3157_tmp, v3156);
-    int16x8_t v3158 = vaddq_s16(v3155, v3157);
-    int16x8_t v3159 = vqrdmulhq_n_s16(v3158, 18964);
-    int16x8_t v3160 = vaddq_s16(v3154, v3159);
-    int16x8_t v3161 = vsubq_s16(v2787, v2789);
-    int16x8_t v3162 = vsubq_s16(v2791, v2793);
-    int16x8_t v3163_tmp = vqrdmulhq_n_s16(v3162, 472);
-    int16x8_t v3163 = vaddq_s16(v3163_tmp, v3162);
-    int16x8_t v3164 = vaddq_s16(v3161, v3163);
-    int16x8_t v3165 = vsubq_s16(v2797, v2799);
-    int16x8_t v3166 = vsubq_s16(v2801, v2803);
-    int16x8_t v3167_tmp = vqrdmulhq_n_s16(v3166, 472);
-    int16x8_t v3167 = vaddq_s16(v3167_tmp, v3166);
-    int16x8_t v3168 = vaddq_s16(v3165, v3167);
-    int16x8_t v3169 = vqrdmulhq_n_s16(v3168, 18964);
-    int16x8_t v3170 = vaddq_s16(v3164, v3169);
-    int16x8_t v3171 = vqrdmulhq_n_s16(v3170, 16971);
-    int16x8_t v3172 = vaddq_s16(v3160, v3171);
-    int16x8_t v3173 = vsubq_s16(v2719, v2721);
-    int16x8_t v3174 = vsubq_s16(v2723, v2725);
-    int16x8_t v3175_tmp = vqrdmulhq_n_s16(v3174, 3672);
-    int16x8_t v3175 = vaddq_s16(v3175_tmp, v3174);
-    int16x8_t v3176 = vaddq_s16(v3173, v3175);
-    int16x8_t v3177 = vsubq_s16(v2729, v2731);
-    int16x8_t v3178 = vsubq_s16(v2733, v2735);
-    int16x8_t v3179_tmp = vqrdmulhq_n_s16(v3178, 3672);
-    int16x8_t v3179 = vaddq_s16(v3179_tmp, v3178);
-    int16x8_t v3180 = vaddq_s16(v3177, v3179);
-    int16x8_t v3181 = vqrdmulhq_n_s16(v3180, 19245);
-    int16x8_t v3182 = vaddq_s16(v3176, v3181);
-    int16x8_t v3183 = vsubq_s16(v2741, v2743);
-    int16x8_t v3184 = vsubq_s16(v2745, v2747);
-    int16x8_t v3185_tmp = vqrdmulhq_n_s16(v3184, 3672);
-    int16x8_t v3185 = vaddq_s16(v3185_tmp, v3184);
-    int16x8_t v3186 = vaddq_s16(v3183, v3185);
-    int16x8_t v3187 = vsubq_s16(v2751, v2753);
-    int16x8_t v3188 = vsubq_s16(v2755, v2757);
-    int16x8_t v3189_tmp = vqrdmulhq_n_s16(v3188, 3672);
-    int16x8_t v3189 = vaddq_s16(v3189_tmp, v3188);
-    int16x8_t v3190 = vaddq_s16(v3187, v3189);
-    int16x8_t v3191 = vqrdmulhq_n_s16(v3190, 19245);
-    int16x8_t v3192 = vaddq_s16(v3186, v3191);
-    int16x8_t v3193 = vqrdmulhq_n_s16(v3192, 17029);
-    int16x8_t v3194 = vaddq_s16(v3182, v3193);
-    int16x8_t v3195 = vsubq_s16(v2673, v2675);
-    int16x8_t v3196 = vsubq_s16(v2677, v2679);
-    int16x8_t v3197_tmp = vqrdmulhq_n_s16(v3196, 7662);
-    int16x8_t v3197 = vaddq_s16(v3197_tmp, v3196);
-    int16x8_t v3198 = vaddq_s16(v3195, v3197);
-    int16x8_t v3199 = vsubq_s16(v2683, v2685);
-    int16x8_t v3200 = vsubq_s16(v2687, v2689);
-    int16x8_t v3201_tmp = vqrdmulhq_n_s16(v3200, 7662);
-    int16x8_t v3201 = vaddq_s16(v3201_tmp, v3200);
-    int16x8_t v3202 = vaddq_s16(v3199, v3201);
-    int16x8_t v3203 = vqrdmulhq_n_s16(v3202, 19546);
-    int16x8_t v3204 = vaddq_s16(v3198, v3203);
-    int16x8_t v3205 = vsubq_s16(v2695, v2697);
-    int16x8_t v3206 = vsubq_s16(v2699, v2701);
-    int16x8_t v3207_tmp = vqrdmulhq_n_s16(v3206, 7662);
-    int16x8_t v3207 = vaddq_s16(v3207_tmp, v3206);
-    int16x8_t v3208 = vaddq_s16(v3205, v3207);
-    int16x8_t v3209 = vsubq_s16(v2705, v2707);
-    int16x8_t v3210 = vsubq_s16(v2709, v2711);
-    int16x8_t v3211_tmp = vqrdmulhq_n_s16(v3210, 7662);
-    int16x8_t v3211 = vaddq_s16(v3211_tmp, v3210);
-    int16x8_t v3212 = vaddq_s16(v3209, v3211);
-    int16x8_t v3213 = vqrdmulhq_n_s16(v3212, 19546);
-    int16x8_t v3214 = vaddq_s16(v3208, v3213);
-    int16x8_t v3215 = vqrdmulhq_n_s16(v3214, 17090);
-    int16x8_t v3216 = vaddq_s16(v3204, v3215);
-    int16x8_t v3217 = vsubq_s16(v2582, v2587);
-    int16x8_t v3218 = vsubq_s16(v2592, v2597);
-    int16x8_t v3219_tmp = vqrdmulhq_n_s16(v3218, 12756);
-    int16x8_t v3219 = vaddq_s16(v3219_tmp, v3218);
-    int16x8_t v3220 = vaddq_s16(v3217, v3219);
-    int16x8_t v3221 = vsubq_s16(v2604, v2609);
-    int16x8_t v3222 = vsubq_s16(v2614, v2619);
-    int16x8_t v3223_tmp = vqrdmulhq_n_s16(v3222, 12756);
-    int16x8_t v3223 = vaddq_s16(v3223_tmp, v3222);
-    int16x8_t v3224 = vaddq_s16(v3221, v3223);
-    int16x8_t v3225 = vqrdmulhq_n_s16(v3224, 19869);
-    int16x8_t v3226 = vaddq_s16(v3220, v3225);
-    int16x8_t v3227 = vsubq_s16(v2628, v2633);
-    int16x8_t v3228 = vsubq_s16(v2638, v2643);
-    int16x8_t v3229_tmp = vqrdmulhq_n_s16(v3228, 12756);
-    int16x8_t v3229 = vaddq_s16(v3229_tmp, v3228);
-    int16x8_t v3230 = vaddq_s16(v3227, v3229);
-    int16x8_t v3231 = vsubq_s16(v2650, v2655);
-    int16x8_t v3232 = vsubq_s16(v2660, v2665);
-    int16x8_t v3233_tmp = vqrdmulhq_n_s16(v3232, 12756);
-    int16x8_t v3233 = vaddq_s16(v3233_tmp, v3232);
-    int16x8_t v3234 = vaddq_s16(v3231, v3233);
-    int16x8_t v3235 = vqrdmulhq_n_s16(v3234, 19869);
-    int16x8_t v3236 = vaddq_s16(v3230, v3235);
-    int16x8_t v3237 = vqrdmulhq_n_s16(v3236, 17153);
-    int16x8_t v3238 = vaddq_s16(v3226, v3237);
-    int16x8_t v3239 = vsubq_s16(v2488, v2493);
-    int16x8_t v3240 = vsubq_s16(v2498, v2503);
-    int16x8_t v3241_tmp = vqrdmulhq_n_s16(v3240, 19463);
-    int16x8_t v3241 = vaddq_s16(v3241_tmp, v3240);
-    int16x8_t v3242 = vaddq_s16(v3239, v3241);
-    int16x8_t v3243 = vsubq_s16(v2510, v2515);
-    int16x8_t v3244 = vsubq_s16(v2520, v2525);
-    int16x8_t v3245_tmp = vqrdmulhq_n_s16(v3244, 19463);
-    int16x8_t v3245 = vaddq_s16(v3245_tmp, v3244);
-    int16x8_t v3246 = vaddq_s16(v3243, v3245);
-    int16x8_t v3247 = vqrdmulhq_n_s16(v3246, 20216);
-    int16x8_t v3248 = vaddq_s16(v3242, v3247);
-    int16x8_t v3249 = vsubq_s16(v2534, v2539);
-    int16x8_t v3250 = vsubq_s16(v2544, v2549);
-    int16x8_t v3251_tmp = vqrdmulhq_n_s16(v3250, 19463);
-    int16x8_t v3251 = vaddq_s16(v3251_tmp, v3250);
-    int16x8_t v3252 = vaddq_s16(v3249, v3251);
-    int16x8_t v3253 = vsubq_s16(v2556, v2561);
-    int16x8_t v3254 = vsubq_s16(v2566, v2571);
-    int16x8_t v3255_tmp = vqrdmulhq_n_s16(v3254, 19463);
-    int16x8_t v3255 = vaddq_s16(v3255_tmp, v3254);
-    int16x8_t v3256 = vaddq_s16(v3253, v3255);
-    int16x8_t v3257 = vqrdmulhq_n_s16(v3256, 20216);
-    int16x8_t v3258 = vaddq_s16(v3252, v3257);
-    int16x8_t v3259 = vqrdmulhq_n_s16(v3258, 17220);
-    int16x8_t v3260 = vaddq_s16(v3248, v3259);
-    int16x8_t v3261 = vsubq_s16(v2393, v2398);
-    int16x8_t v3262 = vsubq_s16(v2403, v2408);
-    int16x8_t v3263_tmp = vqrdmulhq_n_s16(v3262, 28661);
-    int16x8_t v3263 = vaddq_s16(v3263_tmp, v3262);
-    int16x8_t v3264 = vaddq_s16(v3261, v3263);
-    int16x8_t v3265 = vsubq_s16(v2415, v2420);
-    int16x8_t v3266 = vsubq_s16(v2425, v2430);
-    int16x8_t v3267_tmp = vqrdmulhq_n_s16(v3266, 28661);
-    int16x8_t v3267 = vaddq_s16(v3267_tmp, v3266);
-    int16x8_t v3268 = vaddq_s16(v3265, v3267);
-    int16x8_t v3269 = vqrdmulhq_n_s16(v3268, 20587);
-    int16x8_t v3270 = vaddq_s16(v3264, v3269);
-    int16x8_t v3271 = vsubq_s16(v2439, v2444);
-    int16x8_t v3272 = vsubq_s16(v2449, v2454);
-    int16x8_t v3273_tmp = vqrdmulhq_n_s16(v3272, 28661);
-    int16x8_t v3273 = vaddq_s16(v3273_tmp, v3272);
-    int16x8_t v3274 = vaddq_s16(v3271, v3273);
-    int16x8_t v3275 = vsubq_s16(v2461, v2467);
-    int16x8_t v3276 = vsubq_s16(v2472, v2477);
-    int16x8_t v3277_tmp = vqrdmulhq_n_s16(v3276, 28661);
-    int16x8_t v3277 = vaddq_s16(v3277_tmp, v3276);
-    int16x8_t v3278 = vaddq_s16(v3275, v3277);
-    int16x8_t v3279 = vqrdmulhq_n_s16(v3278, 20587);
-    int16x8_t v3280 = vaddq_s16(v3274, v3279);
-    int16x8_t v3281 = vqrdmulhq_n_s16(v3280, 17290);
-    int16x8_t v3282 = vaddq_s16(v3270, v3281);
-    int16x8_t v3283 = vsubq_s16(v2299, v2304);
-    int16x8_t v3284 = vsubq_s16(v2309, v2314);
-    int16x8_t v3285_tmp = vqrdmulhq_n_s16(v3284, 9242);
-    int16x8_t v3285 = vmlaq_n_s16(v3285_tmp, v3284, 2);
-    int16x8_t v3286 = vaddq_s16(v3283, v3285);
-    int16x8_t v3287 = vsubq_s16(v2321, v2326);
-    int16x8_t v3288 = vsubq_s16(v2331, v2336);
-    int16x8_t v3289_tmp = vqrdmulhq_n_s16(v3288, 9242);
-    int16x8_t v3289 = vmlaq_n_s16(v3289_tmp, v3288, 2);
-    int16x8_t v3290 = vaddq_s16(v3287, v3289);
-    int16x8_t v3291 = vqrdmulhq_n_s16(v3290, 20985);
-    int16x8_t v3292 = vaddq_s16(v3286, v3291);
-    int16x8_t v3293 = vsubq_s16(v2345, v2350);
-    int16x8_t v3294 = vsubq_s16(v2355, v2360);
-    int16x8_t v3295_tmp = vqrdmulhq_n_s16(v3294, 9242);
-    int16x8_t v3295 = vmlaq_n_s16(v3295_tmp, v3294, 2);
-    int16x8_t v3296 = vaddq_s16(v3293, v3295);
-    int16x8_t v3297 = vsubq_s16(v2367, v2372);
-    int16x8_t v3298 = vsubq_s16(v2377, v2382);
-    int16x8_t v3299_tmp = vqrdmulhq_n_s16(v3298, 9242);
-    int16x8_t v3299 = vmlaq_n_s16(v3299_tmp, v3298, 2);
-    int16x8_t v3300 = vaddq_s16(v3297, v3299);
-    int16x8_t v3301 = vqrdmulhq_n_s16(v3300, 20985);
-    int16x8_t v3302 = vaddq_s16(v3296, v3301);
-    int16x8_t v3303 = vqrdmulhq_n_s16(v3302, 17363);
-    int16x8_t v3304 = vaddq_s16(v3292, v3303);
-    int16x8_t v3305 = vsubq_s16(v2115, v2126);
-    int16x8_t v3306 = vsubq_s16(v2137, v2148);
-    int16x8_t v3307_tmp = vqrdmulhq_n_s16(v3306, 30298);
-    int16x8_t v3307 = vmlaq_n_s16(v3307_tmp, v3306, 2);
-    int16x8_t v3308 = vaddq_s16(v3305, v3307);
-    int16x8_t v3309 = vsubq_s16(v2161, v2172);
-    int16x8_t v3310 = vsubq_s16(v2183, v2194);
-    int16x8_t v3311_tmp = vqrdmulhq_n_s16(v3310, 30298);
-    int16x8_t v3311 = vmlaq_n_s16(v3311_tmp, v3310, 2);
-    int16x8_t v3312 = vaddq_s16(v3309, v3311);
-    int16x8_t v3313 = vqrdmulhq_n_s16(v3312, 21412);
-    int16x8_t v3314 = vaddq_s16(v3308, v3313);
-    int16x8_t v3315 = vsubq_s16(v2209, v2220);
-    int16x8_t v3316 = vsubq_s16(v2231, v2242);
-    int16x8_t v3317_tmp = vqrdmulhq_n_s16(v3316, 30298);
-    int16x8_t v3317 = vmlaq_n_s16(v3317_tmp, v3316, 2);
-    int16x8_t v3318 = vaddq_s16(v3315, v3317);
-    int16x8_t v3319 = vsubq_s16(v2255, v2266);
-    int16x8_t v3320 = vsubq_s16(v2277, v2288);
-    int16x8_t v3321_tmp = vqrdmulhq_n_s16(v3320, 30298);
-    int16x8_t v3321 = vmlaq_n_s16(v3321_tmp, v3320, 2);
-    int16x8_t v3322 = vaddq_s16(v3319, v3321);
-    int16x8_t v3323 = vqrdmulhq_n_s16(v3322, 21412);
-    int16x8_t v3324 = vaddq_s16(v3318, v3323);
-    int16x8_t v3325 = vqrdmulhq_n_s16(v3324, 17440);
-    int16x8_t v3326 = vaddq_s16(v3314, v3325);
-    int16x8_t v3327 = vsubq_s16(v1925, v1936);
-    int16x8_t v3328 = vsubq_s16(v1947, v1958);
-    int16x8_t v3329_tmp = vqrdmulhq_n_s16(v3328, 2773);
-    int16x8_t v3329 = vmlaq_n_s16(v3329_tmp, v3328, 4);
-    int16x8_t v3330 = vaddq_s16(v3327, v3329);
-    int16x8_t v3331 = vsubq_s16(v1971, v1982);
-    int16x8_t v3332 = vsubq_s16(v1993, v2004);
-    int16x8_t v3333_tmp = vqrdmulhq_n_s16(v3332, 2773);
-    int16x8_t v3333 = vmlaq_n_s16(v3333_tmp, v3332, 4);
-    int16x8_t v3334 = vaddq_s16(v3331, v3333);
-    int16x8_t v3335 = vqrdmulhq_n_s16(v3334, 21871);
-    int16x8_t v3336 = vaddq_s16(v3330, v3335);
-    int16x8_t v3337 = vsubq_s16(v2019, v2030);
-    int16x8_t v3338 = vsubq_s16(v2041, v2052);
-    int16x8_t v3339_tmp = vqrdmulhq_n_s16(v3338, 2773);
-    int16x8_t v3339 = vmlaq_n_s16(v3339_tmp, v3338, 4);
-    int16x8_t v3340 = vaddq_s16(v3337, v3339);
-    int16x8_t v3341 = vsubq_s16(v2065, v2076);
-    int16x8_t v3342 = vsubq_s16(v2087, v2098);
-    int16x8_t v3343_tmp = vqrdmulhq_n_s16(v3342, 2773);
-    int16x8_t v3343 = vmlaq_n_s16(v3343_tmp, v3342, 4);
-    int16x8_t v3344 = vaddq_s16(v3341, v3343);
-    int16x8_t v3345 = vqrdmulhq_n_s16(v3344, 21871);
-    int16x8_t v3346 = vaddq_s16(v3340, v3345);
-    int16x8_t v3347 = vqrdmulhq_n_s16(v3346, 17520);
-    int16x8_t v3348 = vaddq_s16(v3336, v3347);
-    int16x8_t v3349 = vsubq_s16(v1555, v1578);
-    int16x8_t v3350 = vsubq_s16(v1601, v1624);
-    int16x8_t v3351_tmp = vqrdmulhq_n_s16(v3350, 26108);
-    int16x8_t v3351 = vmlaq_n_s16(v3351_tmp, v3350, 6);
-    int16x8_t v3352 = vaddq_s16(v3349, v3351);
-    int16x8_t v3353 = vsubq_s16(v1649, v1672);
-    int16x8_t v3354 = vsubq_s16(v1695, v1718);
-    int16x8_t v3355_tmp = vqrdmulhq_n_s16(v3354, 26108);
-    int16x8_t v3355 = vmlaq_n_s16(v3355_tmp, v3354, 6);
-    int16x8_t v3356 = vaddq_s16(v3353, v3355);
-    int16x8_t v3357 = vqrdmulhq_n_s16(v3356, 22363);
-    int16x8_t v3358 = vaddq_s16(v3352, v3357);
-    int16x8_t v3359 = vsubq_s16(v1745, v1768);
-    int16x8_t v3360 = vsubq_s16(v1791, v1814);
-    int16x8_t v3361_tmp = vqrdmulhq_n_s16(v3360, 26108);
-    int16x8_t v3361 = vmlaq_n_s16(v3361_tmp, v3360, 6);
-    int16x8_t v3362 = vaddq_s16(v3359, v3361);
-    int16x8_t v3363 = vsubq_s16(v1839, v1862);
-    int16x8_t v3364 = vsubq_s16(v1885, v1908);
-    int16x8_t v3365_tmp = vqrdmulhq_n_s16(v3364, 26108);
-    int16x8_t v3365 = vmlaq_n_s16(v3365_tmp, v3364, 6);
-    int16x8_t v3366 = vaddq_s16(v3363, v3365);
-    int16x8_t v3367 = vqrdmulhq_n_s16(v3366, 22363);
-    int16x8_t v3368 = vaddq_s16(v3362, v3367);
-    int16x8_t v3369 = vqrdmulhq_n_s16(v3368, 17603);
-    int16x8_t v3370 = vaddq_s16(v3358, v3369);
-    int16x8_t v3371 = vsubq_s16(v61, v140);
-    int16x8_t v3372 = vsubq_s16(v234, v314);
-    int16x8_t v3373_tmp = vqrdmulhq_n_s16(v3372, 12251);
-    int16x8_t v3373 = vmlaq_n_s16(v3373_tmp, v3372, 20);
-    int16x8_t v3374 = vaddq_s16(v3371, v3373);
-    int16x8_t v3375 = vsubq_s16(v410, v521);
-    int16x8_t v3376 = vsubq_s16(v615, v696);
-    int16x8_t v3377_tmp = vqrdmulhq_n_s16(v3376, 12251);
-    int16x8_t v3377 = vmlaq_n_s16(v3377_tmp, v3376, 20);
-    int16x8_t v3378 = vaddq_s16(v3375, v3377);
-    int16x8_t v3379 = vqrdmulhq_n_s16(v3378, 22891);
-    int16x8_t v3380 = vaddq_s16(v3374, v3379);
-    int16x8_t v3381 = vsubq_s16(v794, v905);
-    int16x8_t v3382 = vsubq_s16(v1061, v1143);
-    int16x8_t v3383_tmp = vqrdmulhq_n_s16(v3382, 12251);
-    int16x8_t v3383 = vmlaq_n_s16(v3383_tmp, v3382, 20);
-    int16x8_t v3384 = vaddq_s16(v3381, v3383);
-    int16x8_t v3385 = vsubq_s16(v1239, v1350);
-    int16x8_t v3386 = vsubq_s16(v1444, v1526);
-    int16x8_t v3387_tmp = vqrdmulhq_n_s16(v3386, 12251);
-    int16x8_t v3387 = vmlaq_n_s16(v3387_tmp, v3386, 20);
-    int16x8_t v3388 = vaddq_s16(v3385, v3387);
-    int16x8_t v3389 = vqrdmulhq_n_s16(v3388, 22891);
-    int16x8_t v3390 = vaddq_s16(v3384, v3389);
-    int16x8_t v3391 = vqrdmulhq_n_s16(v3390, 17689);
-    int16x8_t v3392 = vaddq_s16(v3380, v3391);
-    int16x8_t v3393 = vsubq_s16(v3371, v3373);
-    int16x8_t v3394 = vsubq_s16(v3375, v3377);
-    int16x8_t v3395 = vqrdmulhq_n_s16(v3394, 23460);
-    int16x8_t v3396 = vaddq_s16(v3393, v3395);
-    int16x8_t v3397 = vsubq_s16(v3381, v3383);
-    int16x8_t v3398 = vsubq_s16(v3385, v3387);
-    int16x8_t v3399 = vqrdmulhq_n_s16(v3398, 23460);
-    int16x8_t v3400 = vaddq_s16(v3397, v3399);
-    int16x8_t v3401 = vqrdmulhq_n_s16(v3400, 17779);
-    int16x8_t v3402 = vaddq_s16(v3396, v3401);
-    int16x8_t v3403 = vsubq_s16(v3349, v3351);
-    int16x8_t v3404 = vsubq_s16(v3353, v3355);
-    int16x8_t v3405 = vqrdmulhq_n_s16(v3404, 24073);
-    int16x8_t v3406 = vaddq_s16(v3403, v3405);
-    int16x8_t v3407 = vsubq_s16(v3359, v3361);
-    int16x8_t v3408 = vsubq_s16(v3363, v3365);
-    int16x8_t v3409 = vqrdmulhq_n_s16(v3408, 24073);
-    int16x8_t v3410 = vaddq_s16(v3407, v3409);
-    int16x8_t v3411 = vqrdmulhq_n_s16(v3410, 17873);
-    int16x8_t v3412 = vaddq_s16(v3406, v3411);
-    int16x8_t v3413 = vsubq_s16(v3327, v3329);
-    int16x8_t v3414 = vsubq_s16(v3331, v3333);
-    int16x8_t v3415 = vqrdmulhq_n_s16(v3414, 24734);
-    int16x8_t v3416 = vaddq_s16(v3413, v3415);
-    int16x8_t v3417 = vsubq_s16(v3337, v3339);
-    int16x8_t v3418 = vsubq_s16(v3341, v3343);
-    int16x8_t v3419 = vqrdmulhq_n_s16(v3418, 24734);
-    int16x8_t v3420 = vaddq_s16(v3417, v3419);
-    int16x8_t v3421 = vqrdmulhq_n_s16(v3420, 17971);
-    int16x8_t v3422 = vaddq_s16(v3416, v3421);
-    int16x8_t v3423 = vsubq_s16(v3305, v3307);
-    int16x8_t v3424 = vsubq_s16(v3309, v3311);
-    int16x8_t v3425 = vqrdmulhq_n_s16(v3424, 25448);
-    int16x8_t v3426 = vaddq_s16(v3423, v3425);
-    int16x8_t v3427 = vsubq_s16(v3315, v3317);
-    int16x8_t v3428 = vsubq_s16(v3319, v3321);
-    int16x8_t v3429 = vqrdmulhq_n_s16(v3428, 25448);
-    int16x8_t v3430 = vaddq_s16(v3427, v3429);
-    int16x8_t v3431 = vqrdmulhq_n_s16(v3430, 18072);
-    int16x8_t v3432 = vaddq_s16(v3426, v3431);
-    int16x8_t v3433 = vsubq_s16(v3283, v3285);
-    int16x8_t v3434 = vsubq_s16(v3287, v3289);
-    int16x8_t v3435 = vqrdmulhq_n_s16(v3434, 26220);
-    int16x8_t v3436 = vaddq_s16(v3433, v3435);
-    int16x8_t v3437 = vsubq_s16(v3293, v3295);
-    int16x8_t v3438 = vsubq_s16(v3297, v3299);
-    int16x8_t v3439 = vqrdmulhq_n_s16(v3438, 26220);
-    int16x8_t v3440 = vaddq_s16(v3437, v3439);
-    int16x8_t v3441 = vqrdmulhq_n_s16(v3440, 18177);
-    int16x8_t v3442 = vaddq_s16(v3436, v3441);
-    int16x8_t v3443 = vsubq_s16(v3261, v3263);
-    int16x8_t v3444 = vsubq_s16(v3265, v3267);
-    int16x8_t v3445 = vqrdmulhq_n_s16(v3444, 27058);
-    int16x8_t v3446 = vaddq_s16(v3443, v3445);
-    int16x8_t v3447 = vsubq_s16(v3271, v3273);
-    int16x8_t v3448 = vsubq_s16(v3275, v3277);
-    int16x8_t v3449 = vqrdmulhq_n_s16(v3448, 27058);
-    int16x8_t v3450 = vaddq_s16(v3447, v3449);
-    int16x8_t v3451 = vqrdmulhq_n_s16(v3450, 18286);
-    int16x8_t v3452 = vaddq_s16(v3446, v3451);
-    int16x8_t v3453 = vsubq_s16(v3239, v3241);
-    int16x8_t v3454 = vsubq_s16(v3243, v3245);
-    int16x8_t v3455 = vqrdmulhq_n_s16(v3454, 27969);
-    int16x8_t v3456 = vaddq_s16(v3453, v3455);
-    int16x8_t v3457 = vsubq_s16(v3249, v3251);
-    int16x8_t v3458 = vsubq_s16(v3253, v3255);
-    int16x8_t v3459 = vqrdmulhq_n_s16(v3458, 27969);
-    int16x8_t v3460 = vaddq_s16(v3457, v3459);
-    int16x8_t v3461 = vqrdmulhq_n_s16(v3460, 18400);
-    int16x8_t v3462 = vaddq_s16(v3456, v3461);
-    int16x8_t v3463 = vsubq_s16(v3217, v3219);
-    int16x8_t v3464 = vsubq_s16(v3221, v3223);
-    int16x8_t v3465 = vqrdmulhq_n_s16(v3464, 28961);
-    int16x8_t v3466 = vaddq_s16(v3463, v3465);
-    int16x8_t v3467 = vsubq_s16(v3227, v3229);
-    int16x8_t v3468 = vsubq_s16(v3231, v3233);
-    int16x8_t v3469 = vqrdmulhq_n_s16(v3468, 28961);
-    int16x8_t v3470 = vaddq_s16(v3467, v3469);
-    int16x8_t v3471 = vqrdmulhq_n_s16(v3470, 18517);
-    int16x8_t v3472 = vaddq_s16(v3466, v3471);
-    int16x8_t v3473 = vsubq_s16(v3195, v3197);
-    int16x8_t v3474 = vsubq_s16(v3199, v3201);
-    int16x8_t v3475 = vqrdmulhq_n_s16(v3474, 30044);
-    int16x8_t v3476 = vaddq_s16(v3473, v3475);
-    int16x8_t v3477 = vsubq_s16(v3205, v3207);
-    int16x8_t v3478 = vsubq_s16(v3209, v3211);
-    int16x8_t v3479 = vqrdmulhq_n_s16(v3478, 30044);
-    int16x8_t v3480 = vaddq_s16(v3477, v3479);
-    int16x8_t v3481 = vqrdmulhq_n_s16(v3480, 18639);
-    int16x8_t v3482 = vaddq_s16(v3476, v3481);
-    int16x8_t v3483 = vsubq_s16(v3173, v3175);
-    int16x8_t v3484 = vsubq_s16(v3177, v3179);
-    int16x8_t v3485 = vqrdmulhq_n_s16(v3484, 31232);
-    int16x8_t v3486 = vaddq_s16(v3483, v3485);
-    int16x8_t v3487 = vsubq_s16(v3183, v3185);
-    int16x8_t v3488 = vsubq_s16(v3187, v3189);
-    int16x8_t v3489 = vqrdmulhq_n_s16(v3488, 31232);
-    int16x8_t v3490 = vaddq_s16(v3487, v3489);
-    int16x8_t v3491 = vqrdmulhq_n_s16(v3490, 18765);
-    int16x8_t v3492 = vaddq_s16(v3486, v3491);
-    int16x8_t v3493 = vsubq_s16(v3151, v3153);
-    int16x8_t v3494 = vsubq_s16(v3155, v3157);
-    int16x8_t v3495 = vqrdmulhq_n_s16(v3494, 32538);
-    int16x8_t v3496 = vaddq_s16(v3493, v3495);
-    int16x8_t v3497 = vsubq_s16(v3161, v3163);
-    int16x8_t v3498 = vsubq_s16(v3165, v3167);
-    int16x8_t v3499 = vqrdmulhq_n_s16(v3498, 32538);
-    int16x8_t v3500 = vaddq_s16(v3497, v3499);
-    int16x8_t v3501 = vqrdmulhq_n_s16(v3500, 18896);
-    int16x8_t v3502 = vaddq_s16(v3496, v3501);
-    int16x8_t v3503 = vsubq_s16(v3129, v3131);
-    int16x8_t v3504 = vsubq_s16(v3133, v3135);
-    int16x8_t v3505_tmp = vqrdmulhq_n_s16(v3504, 1211);
-    int16x8_t v3505 = vaddq_s16(v3505_tmp, v3504);
-    int16x8_t v3506 = vaddq_s16(v3503, v3505);
-    int16x8_t v3507 = vsubq_s16(v3139, v3141);
-    int16x8_t v3508 = vsubq_s16(v3143, v3145);
-    int16x8_t v3509_tmp = vqrdmulhq_n_s16(v3508, 1211);
-    int16x8_t v3509 = vaddq_s16(v3509_tmp, v3508);
-    int16x8_t v3510 = vaddq_s16(v3507, v3509);
-    int16x8_t v3511 = vqrdmulhq_n_s16(v3510, 19032);
-    int16x8_t v3512 = vaddq_s16(v3506, v3511);
-    int16x8_t v3513 = vsubq_s16(v3107, v3109);
-    int16x8_t v3514 = vsubq_s16(v3111, v3113);
-    int16x8_t v3515_tmp = vqrdmulhq_n_s16(v3514, 2808);
-    int16x8_t v3515 = vaddq_s16(v3515_tmp, v3514);
-    int16x8_t v3516 = vaddq_s16(v3513, v3515);
-    int16x8_t v3517 = vsubq_s16(v3117, v3119);
-    int16x8_t v3518 = vsubq_s16(v3121, v3123);
-    int16x8_t v3519_tmp = vqrdmulhq_n_s16(v3518, 2808);
-    int16x8_t v3519 = vaddq_s16(v3519_tmp, v3518);
-    int16x8_t v3520 = vaddq_s16(v3517, v3519);
-    int16x8_t v3521 = vqrdmulhq_n_s16(v3520, 19172);
-    int16x8_t v3522 = vaddq_s16(v3516, v3521);
-    int16x8_t v3523 = vsubq_s16(v3085, v3087);
-    int16x8_t v3524 = vsubq_s16(v3089, v3091);
-    int16x8_t v3525_tmp = vqrdmulhq_n_s16(v3524, 4586);
-    int16x8_t v3525 = vaddq_s16(v3525_tmp, v3524);
-    int16x8_t v3526 = vaddq_s16(v3523, v3525);
-    int16x8_t v3527 = vsubq_s16(v3095, v3097);
-    int16x8_t v3528 = vsubq_s16(v3099, v3101);
-    int16x8_t v3529_tmp = vqrdmulhq_n_s16(v3528, 4586);
-    int16x8_t v3529 = vaddq_s16(v3529_tmp, v3528);
-    int16x8_t v3530 = vaddq_s16(v3527, v3529);
-    int16x8_t v3531 = vqrdmulhq_n_s16(v3530, 19318);
-    int16x8_t v3532 = vaddq_s16(v3526, v3531);
-    int16x8_t v3533 = vsubq_s16(v3063, v3065);
-    int16x8_t v3534 = vsubq_s16(v3067, v3069);
-    int16x8_t v3535_tmp = vqrdmulhq_n_s16(v3534, 6576);
-    int16x8_t v3535 = vaddq_s16(v3535_tmp, v3534);
-    int16x8_t v3536 = vaddq_s16(v3533, v3535);
-    int16x8_t v3537 = vsubq_s16(v3073, v3075);
-    int16x8_t v3538 = vsubq_s16(v3077, v3079);
-    int16x8_t v3539_tmp = vqrdmulhq_n_s16(v3538, 6576);
-    int16x8_t v3539 = vaddq_s16(v3539_tmp, v3538);
-    int16x8_t v3540 = vaddq_s16(v3537, v3539);
-    int16x8_t v3541 = vqrdmulhq_n_s16(v3540, 19469);
-    int16x8_t v3542 = vaddq_s16(v3536, v3541);
-    int16x8_t v3543 = vsubq_s16(v3041, v3043);
-    int16x8_t v3544 = vsubq_s16(v3045, v3047);
-    int16x8_t v3545_tmp = vqrdmulhq_n_s16(v3544, 8817);
-    int16x8_t v3545 = vaddq_s16(v3545_tmp, v3544);
-    int16x8_t v3546 = vaddq_s16(v3543, v3545);
-    int16x8_t v3547 = vsubq_s16(v3051, v3053);
-    int16x8_t v3548 = vsubq_s16(v3055, v3057);
-    int16x8_t v3549_tmp = vqrdmulhq_n_s16(v3548, 8817);
-    int16x8_t v3549 = vaddq_s16(v3549_tmp, v3548);
-    int16x8_t v3550 = vaddq_s16(v3547, v3549);
-    int16x8_t v3551 = vqrdmulhq_n_s16(v3550, 19625);
-    int16x8_t v3552 = vaddq_s16(v3546, v3551);
-    int16x8_t v3553 = vsubq_s16(v2998, v3003);
-    int16x8_t v3554 = vsubq_s16(v3008, v3013);
-    int16x8_t v3555_tmp = vqrdmulhq_n_s16(v3554, 11356);
-    int16x8_t v3555 = vaddq_s16(v3555_tmp, v3554);
-    int16x8_t v3556 = vaddq_s16(v3553, v3555);
-    int16x8_t v3557 = vsubq_s16(v3020, v3025);
-    int16x8_t v3558 = vsubq_s16(v3030, v3035);
-    int16x8_t v3559_tmp = vqrdmulhq_n_s16(v3558, 11356);
-    int16x8_t v3559 = vaddq_s16(v3559_tmp, v3558);
-    int16x8_t v3560 = vaddq_s16(v3557, v3559);
-    int16x8_t v3561 = vqrdmulhq_n_s16(v3560, 19786);
-    int16x8_t v3562 = vaddq_s16(v3556, v3561);
-    int16x8_t v3563 = vsubq_s16(v2952, v2957);
-    int16x8_t v3564 = vsubq_s16(v2962, v2967);
-    int16x8_t v3565_tmp = vqrdmulhq_n_s16(v3564, 14256);
-    int16x8_t v3565 = vaddq_s16(v3565_tmp, v3564);
-    int16x8_t v3566 = vaddq_s16(v3563, v3565);
-    int16x8_t v3567 = vsubq_s16(v2974, v2979);
-    int16x8_t v3568 = vsubq_s16(v2984, v2989);
-    int16x8_t v3569_tmp = vqrdmulhq_n_s16(v3568, 14256);
-    int16x8_t v3569 = vaddq_s16(v3569_tmp, v3568);
-    int16x8_t v3570 = vaddq_s16(v3567, v3569);
-    int16x8_t v3571 = vqrdmulhq_n_s16(v3570, 19954);
-    int16x8_t v3572 = vaddq_s16(v3566, v3571);
-    int16x8_t v3573 = vsubq_s16(v2906, v2911);
-    int16x8_t v3574 = vsubq_s16(v2916, v2921);
-    int16x8_t v3575_tmp = vqrdmulhq_n_s16(v3574, 17596);
-    int16x8_t v3575 = vaddq_s16(v3575_tmp, v3574);
-    int16x8_t v3576 = vaddq_s16(v3573, v3575);
-    int16x8_t v3577 = vsubq_s16(v2928, v2933);
-    int16x8_t v3578 = vsubq_s16(v2938, v2943);
-    int16x8_t v3579_tmp = vqrdmulhq_n_s16(v3578, 17596);
-    int16x8_t v3579 = vaddq_s16(v3579_tmp, v3578);
-    int16x8_t v3580 = vaddq_s16(v3577, v3579);
-    int16x8_t v3581 = vqrdmulhq_n_s16(v3580, 20127);
-    int16x8_t v3582 = vaddq_s16(v3576, v3581);
-    int16x8_t v3583 = vsubq_s16(v2860, v2865);
-    int16x8_t v3584 = vsubq_s16(v2870, v2875);
-    int16x8_t v3585_tmp = vqrdmulhq_n_s16(v3584, 21483);
-    int16x8_t v3585 = vaddq_s16(v3585_tmp, v3584);
-    int16x8_t v3586 = vaddq_s16(v3583, v3585);
-    int16x8_t v3587 = vsubq_s16(v2882, v2887);
-    int16x8_t v3588 = vsubq_s16(v2892, v2897);
-    int16x8_t v3589_tmp = vqrdmulhq_n_s16(v3588, 21483);
-    int16x8_t v3589 = vaddq_s16(v3589_tmp, v3588);
-    int16x8_t v3590 = vaddq_s16(v3587, v3589);
-    int16x8_t v3591 = vqrdmulhq_n_s16(v3590, 20306);
-    int16x8_t v3592 = vaddq_s16(v3586, v3591);
-    int16x8_t v3593 = vsubq_s16(v2814, v2819);
-    int16x8_t v3594 = vsubq_s16(v2824, v2829);
-    int16x8_t v3595_tmp = vqrdmulhq_n_s16(v3594, 26057);
-    int16x8_t v3595 = vaddq_s16(v3595_tmp, v3594);
-    int16x8_t v3596 = vaddq_s16(v3593, v3595);
-    int16x8_t v3597 = vsubq_s16(v2836, v2841);
-    int16x8_t v3598 = vsubq_s16(v2846, v2851);
-    int16x8_t v3599_tmp = vqrdmulhq_n_s16(v3598, 26057);
-    int16x8_t v3599 = vaddq_s16(v3599_tmp, v3598);
-    int16x8_t v3600 = vaddq_s16(v3597, v3599);
-    int16x8_t v3601 = vqrdmulhq_n_s16(v3600, 20492);
-    int16x8_t v3602 = vaddq_s16(v3596, v3601);
-    int16x8_t v3603 = vsubq_s16(v2768, v2773);
-    int16x8_t v3604 = vsubq_s16(v2778, v2783);
-    int16x8_t v3605_tmp = vqrdmulhq_n_s16(v3604, 31517);
-    int16x8_t v3605 = vaddq_s16(v3605_tmp, v3604);
-    int16x8_t v3606 = vaddq_s16(v3603, v3605);
-    int16x8_t v3607 = vsubq_s16(v2790, v2795);
-    int16x8_t v3608 = vsubq_s16(v2800, v2805);
-    int16x8_t v3609_tmp = vqrdmulhq_n_s16(v3608, 31517);
-    int16x8_t v3609 = vaddq_s16(v3609_tmp, v3608);
-    int16x8_t v3610 = vaddq_s16(v3607, v3609);
-    int16x8_t v3611 = vqrdmulhq_n_s16(v3610, 20684);
-    int16x8_t v3612 = vaddq_s16(v3606, v3611);
-    int16x8_t v3613 = vsubq_s16(v2722, v2727);
-    int16x8_t v3614 = vsubq_s16(v2732, v2737);
-    int16x8_t v3615_tmp = vqrdmulhq_n_s16(v3614, 5373);
-    int16x8_t v3615 = vmlaq_n_s16(v3615_tmp, v3614, 2);
-    int16x8_t v3616 = vaddq_s16(v3613, v3615);
-    int16x8_t v3617 = vsubq_s16(v2744, v2749);
-    int16x8_t v3618 = vsubq_s16(v2754, v2759);
-    int16x8_t v3619_tmp = vqrdmulhq_n_s16(v3618, 5373);
-    int16x8_t v3619 = vmlaq_n_s16(v3619_tmp, v3618, 2);
-    int16x8_t v3620 = vaddq_s16(v3617, v3619);
-    int16x8_t v3621 = vqrdmulhq_n_s16(v3620, 20883);
-    int16x8_t v3622 = vaddq_s16(v3616, v3621);
-    int16x8_t v3623 = vsubq_s16(v2676, v2681);
-    int16x8_t v3624 = vsubq_s16(v2686, v2691);
-    int16x8_t v3625_tmp = vqrdmulhq_n_s16(v3624, 13571);
-    int16x8_t v3625 = vmlaq_n_s16(v3625_tmp, v3624, 2);
-    int16x8_t v3626 = vaddq_s16(v3623, v3625);
-    int16x8_t v3627 = vsubq_s16(v2698, v2703);
-    int16x8_t v3628 = vsubq_s16(v2708, v2713);
-    int16x8_t v3629_tmp = vqrdmulhq_n_s16(v3628, 13571);
-    int16x8_t v3629 = vmlaq_n_s16(v3629_tmp, v3628, 2);
-    int16x8_t v3630 = vaddq_s16(v3627, v3629);
-    int16x8_t v3631 = vqrdmulhq_n_s16(v3630, 21089);
-    int16x8_t v3632 = vaddq_s16(v3626, v3631);
-    int16x8_t v3633 = vsubq_s16(v2588, v2599);
-    int16x8_t v3634 = vsubq_s16(v2610, v2621);
-    int16x8_t v3635_tmp = vqrdmulhq_n_s16(v3634, 23975);
-    int16x8_t v3635 = vmlaq_n_s16(v3635_tmp, v3634, 2);
-    int16x8_t v3636 = vaddq_s16(v3633, v3635);
-    int16x8_t v3637 = vsubq_s16(v2634, v2645);
-    int16x8_t v3638 = vsubq_s16(v2656, v2667);
-    int16x8_t v3639_tmp = vqrdmulhq_n_s16(v3638, 23975);
-    int16x8_t v3639 = vmlaq_n_s16(v3639_tmp, v3638, 2);
-    int16x8_t v3640 = vaddq_s16(v3637, v3639);
-    int16x8_t v3641 = vqrdmulhq_n_s16(v3640, 21303);
-    int16x8_t v3642 = vaddq_s16(v3636, v3641);
-    int16x8_t v3643 = vsubq_s16(v2494, v2505);
-    int16x8_t v3644 = vsubq_s16(v2516, v2527);
-    int16x8_t v3645_tmp = vqrdmulhq_n_s16(v3644, 4832);
-    int16x8_t v3645 = vmlaq_n_s16(v3645_tmp, v3644, 3);
-    int16x8_t v3646 = vaddq_s16(v3643, v3645);
-    int16x8_t v3647 = vsubq_s16(v2540, v2551);
-    int16x8_t v3648 = vsubq_s16(v2562, v2573);
-    int16x8_t v3649_tmp = vqrdmulhq_n_s16(v3648, 4832);
-    int16x8_t v3649 = vmlaq_n_s16(v3649_tmp, v3648, 3);
-    int16x8_t v3650 = vaddq_s16(v3647, v3649);
-    int16x8_t v3651 = vqrdmulhq_n_s16(v3650, 21524);
-    int16x8_t v3652 = vaddq_s16(v3646, v3651);
-    int16x8_t v3653 = vsubq_s16(v2399, v2410);
-    int16x8_t v3654 = vsubq_s16(v2421, v2432);
-    int16x8_t v3655_tmp = vqrdmulhq_n_s16(v3654, 23437);
-    int16x8_t v3655 = vmlaq_n_s16(v3655_tmp, v3654, 3);
-    int16x8_t v3656 = vaddq_s16(v3653, v3655);
-    int16x8_t v3657 = vsubq_s16(v2445, v2456);
-    int16x8_t v3658 = vsubq_s16(v2468, v2479);
-    int16x8_t v3659_tmp = vqrdmulhq_n_s16(v3658, 23437);
-    int16x8_t v3659 = vmlaq_n_s16(v3659_tmp, v3658, 3);
-    int16x8_t v3660 = vaddq_s16(v3657, v3659);
-    int16x8_t v3661 = vqrdmulhq_n_s16(v3660, 21753);
-    int16x8_t v3662 = vaddq_s16(v3656, v3661);
-    int16x8_t v3663 = vsubq_s16(v2305, v2316);
-    int16x8_t v3664 = vsubq_s16(v2327, v2338);
-    int16x8_t v3665_tmp = vqrdmulhq_n_s16(v3664, 17573);
-    int16x8_t v3665 = vmlaq_n_s16(v3665_tmp, v3664, 4);
-    int16x8_t v3666 = vaddq_s16(v3663, v3665);
-    int16x8_t v3667 = vsubq_s16(v2351, v2362);
-    int16x8_t v3668 = vsubq_s16(v2373, v2384);
-    int16x8_t v3669_tmp = vqrdmulhq_n_s16(v3668, 17573);
-    int16x8_t v3669 = vmlaq_n_s16(v3669_tmp, v3668, 4);
-    int16x8_t v3670 = vaddq_s16(v3667, v3669);
-    int16x8_t v3671 = vqrdmulhq_n_s16(v3670, 21990);
-    int16x8_t v3672 = vaddq_s16(v3666, v3671);
-    int16x8_t v3673 = vsubq_s16(v2127, v2150);
-    int16x8_t v3674 = vsubq_s16(v2173, v2196);
-    int16x8_t v3675_tmp = vqrdmulhq_n_s16(v3674, 27122);
-    int16x8_t v3675 = vmlaq_n_s16(v3675_tmp, v3674, 5);
-    int16x8_t v3676 = vaddq_s16(v3673, v3675);
-    int16x8_t v3677 = vsubq_s16(v2221, v2244);
-    int16x8_t v3678 = vsubq_s16(v2267, v2290);
-    int16x8_t v3679_tmp = vqrdmulhq_n_s16(v3678, 27122);
-    int16x8_t v3679 = vmlaq_n_s16(v3679_tmp, v3678, 5);
-    int16x8_t v3680 = vaddq_s16(v3677, v3679);
-    int16x8_t v3681 = vqrdmulhq_n_s16(v3680, 22236);
-    int16x8_t v3682 = vaddq_s16(v3676, v3681);
-    int16x8_t v3683 = vsubq_s16(v1937, v1960);
-    int16x8_t v3684 = vsubq_s16(v1983, v2006);
-    int16x8_t v3685_tmp = vqrdmulhq_n_s16(v3684, 5041);
-    int16x8_t v3685 = vmlaq_n_s16(v3685_tmp, v3684, 8);
-    int16x8_t v3686 = vaddq_s16(v3683, v3685);
-    int16x8_t v3687 = vsubq_s16(v2031, v2054);
-    int16x8_t v3688 = vsubq_s16(v2077, v2100);
-    int16x8_t v3689_tmp = vqrdmulhq_n_s16(v3688, 5041);
-    int16x8_t v3689 = vmlaq_n_s16(v3689_tmp, v3688, 8);
-    int16x8_t v3690 = vaddq_s16(v3687, v3689);
-    int16x8_t v3691 = vqrdmulhq_n_s16(v3690, 22491);
-    int16x8_t v3692 = vaddq_s16(v3686, v3691);
-    int16x8_t v3693 = vsubq_s16(v1579, v1626);
-    int16x8_t v3694 = vsubq_s16(v1673, v1720);
-    int16x8_t v3695_tmp = vqrdmulhq_n_s16(v3694, 19146);
-    int16x8_t v3695 = vmlaq_n_s16(v3695_tmp, v3694, 13);
-    int16x8_t v3696 = vaddq_s16(v3693, v3695);
-    int16x8_t v3697 = vsubq_s16(v1769, v1816);
-    int16x8_t v3698 = vsubq_s16(v1863, v1910);
-    int16x8_t v3699_tmp = vqrdmulhq_n_s16(v3698, 19146);
-    int16x8_t v3699 = vmlaq_n_s16(v3699_tmp, v3698, 13);
-    int16x8_t v3700 = vaddq_s16(v3697, v3699);
-    int16x8_t v3701 = vqrdmulhq_n_s16(v3700, 22755);
-    int16x8_t v3702 = vaddq_s16(v3696, v3701);
-    int16x8_t v3703 = vsubq_s16(v141, v316);
-    int16x8_t v3704 = vsubq_s16(v522, v698);
-    int16x8_t v3705_tmp = vqrdmulhq_n_s16(v3704, 24402);
-    int16x8_t v3705 = vmlaq_n_s16(v3705_tmp, v3704, 40);
-    int16x8_t v3706 = vaddq_s16(v3703, v3705);
-    int16x8_t v3707 = vsubq_s16(v906, v1145);
-    int16x8_t v3708 = vsubq_s16(v1351, v1528);
-    int16x8_t v3709_tmp = vqrdmulhq_n_s16(v3708, 24402);
-    int16x8_t v3709 = vmlaq_n_s16(v3709_tmp, v3708, 40);
-    int16x8_t v3710 = vaddq_s16(v3707, v3709);
-    int16x8_t v3711 = vqrdmulhq_n_s16(v3710, 23030);
-    int16x8_t v3712 = vaddq_s16(v3706, v3711);
-    int16x8_t v3713 = vsubq_s16(v3703, v3705);
-    int16x8_t v3714 = vsubq_s16(v3707, v3709);
-    int16x8_t v3715 = vqrdmulhq_n_s16(v3714, 23314);
-    int16x8_t v3716 = vaddq_s16(v3713, v3715);
-    int16x8_t v3717 = vsubq_s16(v3693, v3695);
-    int16x8_t v3718 = vsubq_s16(v3697, v3699);
-    int16x8_t v3719 = vqrdmulhq_n_s16(v3718, 23609);
-    int16x8_t v3720 = vaddq_s16(v3717, v3719);
-    int16x8_t v3721 = vsubq_s16(v3683, v3685);
-    int16x8_t v3722 = vsubq_s16(v3687, v3689);
-    int16x8_t v3723 = vqrdmulhq_n_s16(v3722, 23915);
-    int16x8_t v3724 = vaddq_s16(v3721, v3723);
-    int16x8_t v3725 = vsubq_s16(v3673, v3675);
-    int16x8_t v3726 = vsubq_s16(v3677, v3679);
-    int16x8_t v3727 = vqrdmulhq_n_s16(v3726, 24233);
-    int16x8_t v3728 = vaddq_s16(v3725, v3727);
-    int16x8_t v3729 = vsubq_s16(v3663, v3665);
-    int16x8_t v3730 = vsubq_s16(v3667, v3669);
-    int16x8_t v3731 = vqrdmulhq_n_s16(v3730, 24564);
-    int16x8_t v3732 = vaddq_s16(v3729, v3731);
-    int16x8_t v3733 = vsubq_s16(v3653, v3655);
-    int16x8_t v3734 = vsubq_s16(v3657, v3659);
-    int16x8_t v3735 = vqrdmulhq_n_s16(v3734, 24907);
-    int16x8_t v3736 = vaddq_s16(v3733, v3735);
-    int16x8_t v3737 = vsubq_s16(v3643, v3645);
-    int16x8_t v3738 = vsubq_s16(v3647, v3649);
-    int16x8_t v3739 = vqrdmulhq_n_s16(v3738, 25264);
-    int16x8_t v3740 = vaddq_s16(v3737, v3739);
-    int16x8_t v3741 = vsubq_s16(v3633, v3635);
-    int16x8_t v3742 = vsubq_s16(v3637, v3639);
-    int16x8_t v3743 = vqrdmulhq_n_s16(v3742, 25635);
-    int16x8_t v3744 = vaddq_s16(v3741, v3743);
-    int16x8_t v3745 = vsubq_s16(v3623, v3625);
-    int16x8_t v3746 = vsubq_s16(v3627, v3629);
-    int16x8_t v3747 = vqrdmulhq_n_s16(v3746, 26021);
-    int16x8_t v3748 = vaddq_s16(v3745, v3747);
-    int16x8_t v3749 = vsubq_s16(v3613, v3615);
-    int16x8_t v3750 = vsubq_s16(v3617, v3619);
-    int16x8_t v3751 = vqrdmulhq_n_s16(v3750, 26423);
-    int16x8_t v3752 = vaddq_s16(v3749, v3751);
-    int16x8_t v3753 = vsubq_s16(v3603, v3605);
-    int16x8_t v3754 = vsubq_s16(v3607, v3609);
-    int16x8_t v3755 = vqrdmulhq_n_s16(v3754, 26842);
-    int16x8_t v3756 = vaddq_s16(v3753, v3755);
-    int16x8_t v3757 = vsubq_s16(v3593, v3595);
-    int16x8_t v3758 = vsubq_s16(v3597, v3599);
-    int16x8_t v3759 = vqrdmulhq_n_s16(v3758, 27279);
-    int16x8_t v3760 = vaddq_s16(v3757, v3759);
-    int16x8_t v3761 = vsubq_s16(v3583, v3585);
-    int16x8_t v3762 = vsubq_s16(v3587, v3589);
-    int16x8_t v3763 = vqrdmulhq_n_s16(v3762, 27734);
-    int16x8_t v3764 = vaddq_s16(v3761, v3763);
-    int16x8_t v3765 = vsubq_s16(v3573, v3575);
-    int16x8_t v3766 = vsubq_s16(v3577, v3579);
-    int16x8_t v3767 = vqrdmulhq_n_s16(v3766, 28209);
-    int16x8_t v3768 = vaddq_s16(v3765, v3767);
-    int16x8_t v3769 = vsubq_s16(v3563, v3565);
-    int16x8_t v3770 = vsubq_s16(v3567, v3569);
-    int16x8_t v3771 = vqrdmulhq_n_s16(v3770, 28705);
-    int16x8_t v3772 = vaddq_s16(v3769, v3771);
-    int16x8_t v3773 = vsubq_s16(v3553, v3555);
-    int16x8_t v3774 = vsubq_s16(v3557, v3559);
-    int16x8_t v3775 = vqrdmulhq_n_s16(v3774, 29223);
-    int16x8_t v3776 = vaddq_s16(v3773, v3775);
-    int16x8_t v3777 = vsubq_s16(v3543, v3545);
-    int16x8_t v3778 = vsubq_s16(v3547, v3549);
-    int16x8_t v3779 = vqrdmulhq_n_s16(v3778, 29764);
-    int16x8_t v3780 = vaddq_s16(v3777, v3779);
-    int16x8_t v3781 = vsubq_s16(v3533, v3535);
-    int16x8_t v3782 = vsubq_s16(v3537, v3539);
-    int16x8_t v3783 = vqrdmulhq_n_s16(v3782, 30331);
-    int16x8_t v3784 = vaddq_s16(v3781, v3783);
-    int16x8_t v3785 = vsubq_s16(v3523, v3525);
-    int16x8_t v3786 = vsubq_s16(v3527, v3529);
-    int16x8_t v3787 = vqrdmulhq_n_s16(v3786, 30925);
-    int16x8_t v3788 = vaddq_s16(v3785, v3787);
-    int16x8_t v3789 = vsubq_s16(v3513, v3515);
-    int16x8_t v3790 = vsubq_s16(v3517, v3519);
-    int16x8_t v3791 = vqrdmulhq_n_s16(v3790, 31547);
-    int16x8_t v3792 = vaddq_s16(v3789, v3791);
-    int16x8_t v3793 = vsubq_s16(v3503, v3505);
-    int16x8_t v3794 = vsubq_s16(v3507, v3509);
-    int16x8_t v3795 = vqrdmulhq_n_s16(v3794, 32199);
-    int16x8_t v3796 = vaddq_s16(v3793, v3795);
-    int16x8_t v3797 = vsubq_s16(v3493, v3495);
-    int16x8_t v3798 = vsubq_s16(v3497, v3499);
-    int16x8_t v3799_tmp = vqrdmulhq_n_s16(v3798, 117);
-    int16x8_t v3799 = vaddq_s16(v3799_tmp, v3798);
-    int16x8_t v3800 = vaddq_s16(v3797, v3799);
-    int16x8_t v3801 = vsubq_s16(v3483, v3485);
-    int16x8_t v3802 = vsubq_s16(v3487, v3489);
-    int16x8_t v3803_tmp = vqrdmulhq_n_s16(v3802, 837);
-    int16x8_t v3803 = vaddq_s16(v3803_tmp, v3802);
-    int16x8_t v3804 = vaddq_s16(v3801, v3803);
-    int16x8_t v3805 = vsubq_s16(v3473, v3475);
-    int16x8_t v3806 = vsubq_s16(v3477, v3479);
-    int16x8_t v3807_tmp = vqrdmulhq_n_s16(v3806, 1594);
-    int16x8_t v3807 = vaddq_s16(v3807_tmp, v3806);
-    int16x8_t v3808 = vaddq_s16(v3805, v3807);
-    int16x8_t v3809 = vsubq_s16(v3463, v3465);
-    int16x8_t v3810 = vsubq_s16(v3467, v3469);
-    int16x8_t v3811_tmp = vqrdmulhq_n_s16(v3810, 2393);
-    int16x8_t v3811 = vaddq_s16(v3811_tmp, v3810);
-    int16x8_t v3812 = vaddq_s16(v3809, v3811);
-    int16x8_t v3813 = vsubq_s16(v3453, v3455);
-    int16x8_t v3814 = vsubq_s16(v3457, v3459);
-    int16x8_t v3815_tmp = vqrdmulhq_n_s16(v3814, 3234);
-    int16x8_t v3815 = vaddq_s16(v3815_tmp, v3814);
-    int16x8_t v3816 = vaddq_s16(v3813, v3815);
-    int16x8_t v3817 = vsubq_s16(v3443, v3445);
-    int16x8_t v3818 = vsubq_s16(v3447, v3449);
-    int16x8_t v3819_tmp = vqrdmulhq_n_s16(v3818, 4123);
-    int16x8_t v3819 = vaddq_s16(v3819_tmp, v3818);
-    int16x8_t v3820 = vaddq_s16(v3817, v3819);
-    int16x8_t v3821 = vsubq_s16(v3433, v3435);
-    int16x8_t v3822 = vsubq_s16(v3437, v3439);
-    int16x8_t v3823_tmp = vqrdmulhq_n_s16(v3822, 5062);
-    int16x8_t v3823 = vaddq_s16(v3823_tmp, v3822);
-    int16x8_t v3824 = vaddq_s16(v3821, v3823);
-    int16x8_t v3825 = vsubq_s16(v3423, v3425);
-    int16x8_t v3826 = vsubq_s16(v3427, v3429);
-    int16x8_t v3827_tmp = vqrdmulhq_n_s16(v3826, 6057);
-    int16x8_t v3827 = vaddq_s16(v3827_tmp, v3826);
-    int16x8_t v3828 = vaddq_s16(v3825, v3827);
-    int16x8_t v3829 = vsubq_s16(v3413, v3415);
-    int16x8_t v3830 = vsubq_s16(v3417, v3419);
-    int16x8_t v3831_tmp = vqrdmulhq_n_s16(v3830, 7111);
-    int16x8_t v3831 = vaddq_s16(v3831_tmp, v3830);
-    int16x8_t v3832 = vaddq_s16(v3829, v3831);
-    int16x8_t v3833 = vsubq_s16(v3403, v3405);
-    int16x8_t v3834 = vsubq_s16(v3407, v3409);
-    int16x8_t v3835_tmp = vqrdmulhq_n_s16(v3834, 8231);
-    int16x8_t v3835 = vaddq_s16(v3835_tmp, v3834);
-    int16x8_t v3836 = vaddq_s16(v3833, v3835);
-    int16x8_t v3837 = vsubq_s16(v3393, v3395);
-    int16x8_t v3838 = vsubq_s16(v3397, v3399);
-    int16x8_t v3839_tmp = vqrdmulhq_n_s16(v3838, 9421);
-    int16x8_t v3839 = vaddq_s16(v3839_tmp, v3838);
-    int16x8_t v3840 = vaddq_s16(v3837, v3839);
-    int16x8_t v3841 = vsubq_s16(v3374, v3379);
-    int16x8_t v3842 = vsubq_s16(v3384, v3389);
-    int16x8_t v3843_tmp = vqrdmulhq_n_s16(v3842, 10690);
-    int16x8_t v3843 = vaddq_s16(v3843_tmp, v3842);
-    int16x8_t v3844 = vaddq_s16(v3841, v3843);
-    int16x8_t v3845 = vsubq_s16(v3352, v3357);
-    int16x8_t v3846 = vsubq_s16(v3362, v3367);
-    int16x8_t v3847_tmp = vqrdmulhq_n_s16(v3846, 12044);
-    int16x8_t v3847 = vaddq_s16(v3847_tmp, v3846);
-    int16x8_t v3848 = vaddq_s16(v3845, v3847);
-    int16x8_t v3849 = vsubq_s16(v3330, v3335);
-    int16x8_t v3850 = vsubq_s16(v3340, v3345);
-    int16x8_t v3851_tmp = vqrdmulhq_n_s16(v3850, 13493);
-    int16x8_t v3851 = vaddq_s16(v3851_tmp, v3850);
-    int16x8_t v3852 = vaddq_s16(v3849, v3851);
-    int16x8_t v3853 = vsubq_s16(v3308, v3313);
-    int16x8_t v3854 = vsubq_s16(v3318, v3323);
-    int16x8_t v3855_tmp = vqrdmulhq_n_s16(v3854, 15046);
-    int16x8_t v3855 = vaddq_s16(v3855_tmp, v3854);
-    int16x8_t v3856 = vaddq_s16(v3853, v3855);
-    int16x8_t v3857 = vsubq_s16(v3286, v3291);
-    int16x8_t v3858 = vsubq_s16(v3296, v3301);
-    int16x8_t v3859_tmp = vqrdmulhq_n_s16(v3858, 16715);
-    int16x8_t v3859 = vaddq_s16(v3859_tmp, v3858);
-    int16x8_t v3860 = vaddq_s16(v3857, v3859);
-    int16x8_t v3861 = vsubq_s16(v3264, v3269);
-    int16x8_t v3862 = vsubq_s16(v3274, v3279);
-    int16x8_t v3863_tmp = vqrdmulhq_n_s16(v3862, 18512);
-    int16x8_t v3863 = vaddq_s16(v3863_tmp, v3862);
-    int16x8_t v3864 = vaddq_s16(v3861, v3863);
-    int16x8_t v3865 = vsubq_s16(v3242, v3247);
-    int16x8_t v3866 = vsubq_s16(v3252, v3257);
-    int16x8_t v3867_tmp = vqrdmulhq_n_s16(v3866, 20453);
-    int16x8_t v3867 = vaddq_s16(v3867_tmp, v3866);
-    int16x8_t v3868 = vaddq_s16(v3865, v3867);
-    int16x8_t v3869 = vsubq_s16(v3220, v3225);
-    int16x8_t v3870 = vsubq_s16(v3230, v3235);
-    int16x8_t v3871_tmp = vqrdmulhq_n_s16(v3870, 22555);
-    int16x8_t v3871 = vaddq_s16(v3871_tmp, v3870);
-    int16x8_t v3872 = vaddq_s16(v3869, v3871);
-    int16x8_t v3873 = vsubq_s16(v3198, v3203);
-    int16x8_t v3874 = vsubq_s16(v3208, v3213);
-    int16x8_t v3875_tmp = vqrdmulhq_n_s16(v3874, 24839);
-    int16x8_t v3875 = vaddq_s16(v3875_tmp, v3874);
-    int16x8_t v3876 = vaddq_s16(v3873, v3875);
-    int16x8_t v3877 = vsubq_s16(v3176, v3181);
-    int16x8_t v3878 = vsubq_s16(v3186, v3191);
-    int16x8_t v3879_tmp = vqrdmulhq_n_s16(v3878, 27330);
-    int16x8_t v3879 = vaddq_s16(v3879_tmp, v3878);
-    int16x8_t v3880 = vaddq_s16(v3877, v3879);
-    int16x8_t v3881 = vsubq_s16(v3154, v3159);
-    int16x8_t v3882 = vsubq_s16(v3164, v3169);
-    int16x8_t v3883_tmp = vqrdmulhq_n_s16(v3882, 30056);
-    int16x8_t v3883 = vaddq_s16(v3883_tmp, v3882);
-    int16x8_t v3884 = vaddq_s16(v3881, v3883);
-    int16x8_t v3885 = vsubq_s16(v3132, v3137);
-    int16x8_t v3886 = vsubq_s16(v3142, v3147);
-    int16x8_t v3887_tmp = vqrdmulhq_n_s16(v3886, 282);
-    int16x8_t v3887 = vmlaq_n_s16(v3887_tmp, v3886, 2);
-    int16x8_t v3888 = vaddq_s16(v3885, v3887);
-    int16x8_t v3889 = vsubq_s16(v3110, v3115);
-    int16x8_t v3890 = vsubq_s16(v3120, v3125);
-    int16x8_t v3891_tmp = vqrdmulhq_n_s16(v3890, 3588);
-    int16x8_t v3891 = vmlaq_n_s16(v3891_tmp, v3890, 2);
-    int16x8_t v3892 = vaddq_s16(v3889, v3891);
-    int16x8_t v3893 = vsubq_s16(v3088, v3093);
-    int16x8_t v3894 = vsubq_s16(v3098, v3103);
-    int16x8_t v3895_tmp = vqrdmulhq_n_s16(v3894, 7255);
-    int16x8_t v3895 = vmlaq_n_s16(v3895_tmp, v3894, 2);
-    int16x8_t v3896 = vaddq_s16(v3893, v3895);
-    int16x8_t v3897 = vsubq_s16(v3066, v3071);
-    int16x8_t v3898 = vsubq_s16(v3076, v3081);
-    int16x8_t v3899_tmp = vqrdmulhq_n_s16(v3898, 11344);
-    int16x8_t v3899 = vmlaq_n_s16(v3899_tmp, v3898, 2);
-    int16x8_t v3900 = vaddq_s16(v3897, v3899);
-    int16x8_t v3901 = vsubq_s16(v3044, v3049);
-    int16x8_t v3902 = vsubq_s16(v3054, v3059);
-    int16x8_t v3903_tmp = vqrdmulhq_n_s16(v3902, 15934);
-    int16x8_t v3903 = vmlaq_n_s16(v3903_tmp, v3902, 2);
-    int16x8_t v3904 = vaddq_s16(v3901, v3903);
-    int16x8_t v3905 = vsubq_s16(v3004, v3015);
-    int16x8_t v3906 = vsubq_s16(v3026, v3037);
-    int16x8_t v3907_tmp = vqrdmulhq_n_s16(v3906, 21120);
-    int16x8_t v3907 = vmlaq_n_s16(v3907_tmp, v3906, 2);
-    int16x8_t v3908 = vaddq_s16(v3905, v3907);
-    int16x8_t v3909 = vsubq_s16(v2958, v2969);
-    int16x8_t v3910 = vsubq_s16(v2980, v2991);
-    int16x8_t v3911_tmp = vqrdmulhq_n_s16(v3910, 27027);
-    int16x8_t v3911 = vmlaq_n_s16(v3911_tmp, v3910, 2);
-    int16x8_t v3912 = vaddq_s16(v3909, v3911);
-    int16x8_t v3913 = vsubq_s16(v2912, v2923);
-    int16x8_t v3914 = vsubq_s16(v2934, v2945);
-    int16x8_t v3915_tmp = vqrdmulhq_n_s16(v3914, 1045);
-    int16x8_t v3915 = vmlaq_n_s16(v3915_tmp, v3914, 3);
-    int16x8_t v3916 = vaddq_s16(v3913, v3915);
-    int16x8_t v3917 = vsubq_s16(v2866, v2877);
-    int16x8_t v3918 = vsubq_s16(v2888, v2899);
-    int16x8_t v3919_tmp = vqrdmulhq_n_s16(v3918, 8923);
-    int16x8_t v3919 = vmlaq_n_s16(v3919_tmp, v3918, 3);
-    int16x8_t v3920 = vaddq_s16(v3917, v3919);
-    int16x8_t v3921 = vsubq_s16(v2820, v2831);
-    int16x8_t v3922 = vsubq_s16(v2842, v2853);
-    int16x8_t v3923_tmp = vqrdmulhq_n_s16(v3922, 18177);
-    int16x8_t v3923 = vmlaq_n_s16(v3923_tmp, v3922, 3);
-    int16x8_t v3924 = vaddq_s16(v3921, v3923);
-    int16x8_t v3925 = vsubq_s16(v2774, v2785);
-    int16x8_t v3926 = vsubq_s16(v2796, v2807);
-    int16x8_t v3927_tmp = vqrdmulhq_n_s16(v3926, 29200);
-    int16x8_t v3927 = vmlaq_n_s16(v3927_tmp, v3926, 3);
-    int16x8_t v3928 = vaddq_s16(v3925, v3927);
-    int16x8_t v3929 = vsubq_s16(v2728, v2739);
-    int16x8_t v3930 = vsubq_s16(v2750, v2761);
-    int16x8_t v3931_tmp = vqrdmulhq_n_s16(v3930, 9782);
-    int16x8_t v3931 = vmlaq_n_s16(v3931_tmp, v3930, 4);
-    int16x8_t v3932 = vaddq_s16(v3929, v3931);
-    int16x8_t v3933 = vsubq_s16(v2682, v2693);
-    int16x8_t v3934 = vsubq_s16(v2704, v2715);
-    int16x8_t v3935_tmp = vqrdmulhq_n_s16(v3934, 26282);
-    int16x8_t v3935 = vmlaq_n_s16(v3935_tmp, v3934, 4);
-    int16x8_t v3936 = vaddq_s16(v3933, v3935);
-    int16x8_t v3937 = vsubq_s16(v2600, v2623);
-    int16x8_t v3938 = vsubq_s16(v2646, v2669);
-    int16x8_t v3939_tmp = vqrdmulhq_n_s16(v3938, 14423);
-    int16x8_t v3939 = vmlaq_n_s16(v3939_tmp, v3938, 5);
-    int16x8_t v3940 = vaddq_s16(v3937, v3939);
-    int16x8_t v3941 = vsubq_s16(v2506, v2529);
-    int16x8_t v3942 = vsubq_s16(v2552, v2575);
-    int16x8_t v3943_tmp = vqrdmulhq_n_s16(v3942, 9008);
-    int16x8_t v3943 = vmlaq_n_s16(v3943_tmp, v3942, 6);
-    int16x8_t v3944 = vaddq_s16(v3941, v3943);
-    int16x8_t v3945 = vsubq_s16(v2411, v2434);
-    int16x8_t v3946 = vsubq_s16(v2457, v2481);
-    int16x8_t v3947_tmp = vqrdmulhq_n_s16(v3946, 13552);
-    int16x8_t v3947 = vmlaq_n_s16(v3947_tmp, v3946, 7);
-    int16x8_t v3948 = vaddq_s16(v3945, v3947);
-    int16x8_t v3949 = vsubq_s16(v2317, v2340);
-    int16x8_t v3950 = vsubq_s16(v2363, v2386);
-    int16x8_t v3951_tmp = vqrdmulhq_n_s16(v3950, 1925);
-    int16x8_t v3951 = vmlaq_n_s16(v3951_tmp, v3950, 9);
-    int16x8_t v3952 = vaddq_s16(v3949, v3951);
-    int16x8_t v3953 = vsubq_s16(v2151, v2198);
-    int16x8_t v3954 = vsubq_s16(v2245, v2292);
-    int16x8_t v3955_tmp = vqrdmulhq_n_s16(v3954, 21123);
-    int16x8_t v3955 = vmlaq_n_s16(v3955_tmp, v3954, 11);
-    int16x8_t v3956 = vaddq_s16(v3953, v3955);
-    int16x8_t v3957 = vsubq_s16(v1961, v2008);
-    int16x8_t v3958 = vsubq_s16(v2055, v2102);
-    int16x8_t v3959_tmp = vqrdmulhq_n_s16(v3958, 9831);
-    int16x8_t v3959 = vmlaq_n_s16(v3959_tmp, v3958, 16);
-    int16x8_t v3960 = vaddq_s16(v3957, v3959);
-    int16x8_t v3961 = vsubq_s16(v1627, v1722);
-    int16x8_t v3962 = vsubq_s16(v1817, v1912);
-    int16x8_t v3963_tmp = vqrdmulhq_n_s16(v3962, 5373);
-    int16x8_t v3963 = vmlaq_n_s16(v3963_tmp, v3962, 27);
-    int16x8_t v3964 = vaddq_s16(v3961, v3963);
-    int16x8_t v3965 = vsubq_s16(v317, v700);
-    int16x8_t v3966 = vsubq_s16(v1146, v1530);
-    int16x8_t v3967_tmp = vqrdmulhq_n_s16(v3966, 15986);
-    int16x8_t v3967 = vmlaq_n_s16(v3967_tmp, v3966, 81);
-    int16x8_t v3968 = vaddq_s16(v3965, v3967);
-    int16x8_t v3969 = vsubq_s16(v3965, v3967);
-    int16x8_t v3970 = vsubq_s16(v3961, v3963);
-    int16x8_t v3971 = vsubq_s16(v3957, v3959);
-    int16x8_t v3972 = vsubq_s16(v3953, v3955);
-    int16x8_t v3973 = vsubq_s16(v3949, v3951);
-    int16x8_t v3974 = vsubq_s16(v3945, v3947);
-    int16x8_t v3975 = vsubq_s16(v3941, v3943);
-    int16x8_t v3976 = vsubq_s16(v3937, v3939);
-    int16x8_t v3977 = vsubq_s16(v3933, v3935);
-    int16x8_t v3978 = vsubq_s16(v3929, v3931);
-    int16x8_t v3979 = vsubq_s16(v3925, v3927);
-    int16x8_t v3980 = vsubq_s16(v3921, v3923);
-    int16x8_t v3981 = vsubq_s16(v3917, v3919);
-    int16x8_t v3982 = vsubq_s16(v3913, v3915);
-    int16x8_t v3983 = vsubq_s16(v3909, v3911);
-    int16x8_t v3984 = vsubq_s16(v3905, v3907);
-    int16x8_t v3985 = vsubq_s16(v3901, v3903);
-    int16x8_t v3986 = vsubq_s16(v3897, v3899);
-    int16x8_t v3987 = vsubq_s16(v3893, v3895);
-    int16x8_t v3988 = vsubq_s16(v3889, v3891);
-    int16x8_t v3989 = vsubq_s16(v3885, v3887);
-    int16x8_t v3990 = vsubq_s16(v3881, v3883);
-    int16x8_t v3991 = vsubq_s16(v3877, v3879);
-    int16x8_t v3992 = vsubq_s16(v3873, v3875);
-    int16x8_t v3993 = vsubq_s16(v3869, v3871);
-    int16x8_t v3994 = vsubq_s16(v3865, v3867);
-    int16x8_t v3995 = vsubq_s16(v3861, v3863);
-    int16x8_t v3996 = vsubq_s16(v3857, v3859);
-    int16x8_t v3997 = vsubq_s16(v3853, v3855);
-    int16x8_t v3998 = vsubq_s16(v3849, v3851);
-    int16x8_t v3999 = vsubq_s16(v3845, v3847);
-    int16x8_t v4000 = vsubq_s16(v3841, v3843);
-    int16x8_t v4001 = vsubq_s16(v3837, v3839);
-    int16x8_t v4002 = vsubq_s16(v3833, v3835);
-    int16x8_t v4003 = vsubq_s16(v3829, v3831);
-    int16x8_t v4004 = vsubq_s16(v3825, v3827);
-    int16x8_t v4005 = vsubq_s16(v3821, v3823);
-    int16x8_t v4006 = vsubq_s16(v3817, v3819);
-    int16x8_t v4007 = vsubq_s16(v3813, v3815);
-    int16x8_t v4008 = vsubq_s16(v3809, v3811);
-    int16x8_t v4009 = vsubq_s16(v3805, v3807);
-    int16x8_t v4010 = vsubq_s16(v3801, v3803);
-    int16x8_t v4011 = vsubq_s16(v3797, v3799);
-    int16x8_t v4012 = vsubq_s16(v3793, v3795);
-    int16x8_t v4013 = vsubq_s16(v3789, v3791);
-    int16x8_t v4014 = vsubq_s16(v3785, v3787);
-    int16x8_t v4015 = vsubq_s16(v3781, v3783);
-    int16x8_t v4016 = vsubq_s16(v3777, v3779);
-    int16x8_t v4017 = vsubq_s16(v3773, v3775);
-    int16x8_t v4018 = vsubq_s16(v3769, v3771);
-    int16x8_t v4019 = vsubq_s16(v3765, v3767);
-    int16x8_t v4020 = vsubq_s16(v3761, v3763);
-    int16x8_t v4021 = vsubq_s16(v3757, v3759);
-    int16x8_t v4022 = vsubq_s16(v3753, v3755);
-    int16x8_t v4023 = vsubq_s16(v3749, v3751);
-    int16x8_t v4024 = vsubq_s16(v3745, v3747);
-    int16x8_t v4025 = vsubq_s16(v3741, v3743);
-    int16x8_t v4026 = vsubq_s16(v3737, v3739);
-    int16x8_t v4027 = vsubq_s16(v3733, v3735);
-    int16x8_t v4028 = vsubq_s16(v3729, v3731);
-    int16x8_t v4029 = vsubq_s16(v3725, v3727);
-    int16x8_t v4030 = vsubq_s16(v3721, v3723);
-    int16x8_t v4031 = vsubq_s16(v3717, v3719);
-    int16x8_t v4032 = vsubq_s16(v3713, v3715);
-    int16x8_t v4033 = vsubq_s16(v3706, v3711);
-    int16x8_t v4034 = vsubq_s16(v3696, v3701);
-    int16x8_t v4035 = vsubq_s16(v3686, v3691);
-    int16x8_t v4036 = vsubq_s16(v3676, v3681);
-    int16x8_t v4037 = vsubq_s16(v3666, v3671);
-    int16x8_t v4038 = vsubq_s16(v3656, v3661);
-    int16x8_t v4039 = vsubq_s16(v3646, v3651);
-    int16x8_t v4040 = vsubq_s16(v3636, v3641);
-    int16x8_t v4041 = vsubq_s16(v3626, v3631);
-    int16x8_t v4042 = vsubq_s16(v3616, v3621);
-    int16x8_t v4043 = vsubq_s16(v3606, v3611);
-    int16x8_t v4044 = vsubq_s16(v3596, v3601);
-    int16x8_t v4045 = vsubq_s16(v3586, v3591);
-    int16x8_t v4046 = vsubq_s16(v3576, v3581);
-    int16x8_t v4047 = vsubq_s16(v3566, v3571);
-    int16x8_t v4048 = vsubq_s16(v3556, v3561);
-    int16x8_t v4049 = vsubq_s16(v3546, v3551);
-    int16x8_t v4050 = vsubq_s16(v3536, v3541);
-    int16x8_t v4051 = vsubq_s16(v3526, v3531);
-    int16x8_t v4052 = vsubq_s16(v3516, v3521);
-    int16x8_t v4053 = vsubq_s16(v3506, v3511);
-    int16x8_t v4054 = vsubq_s16(v3496, v3501);
-    int16x8_t v4055 = vsubq_s16(v3486, v3491);
-    int16x8_t v4056 = vsubq_s16(v3476, v3481);
-    int16x8_t v4057 = vsubq_s16(v3466, v3471);
-    int16x8_t v4058 = vsubq_s16(v3456, v3461);
-    int16x8_t v4059 = vsubq_s16(v3446, v3451);
-    int16x8_t v4060 = vsubq_s16(v3436, v3441);
-    int16x8_t v4061 = vsubq_s16(v3426, v3431);
-    int16x8_t v4062 = vsubq_s16(v3416, v3421);
-    int16x8_t v4063 = vsubq_s16(v3406, v3411);
-    int16x8_t v4064 = vsubq_s16(v3396, v3401);
-    int16x8_t v4065 = vsubq_s16(v3380, v3391);
-    int16x8_t v4066 = vsubq_s16(v3358, v3369);
-    int16x8_t v4067 = vsubq_s16(v3336, v3347);
-    int16x8_t v4068 = vsubq_s16(v3314, v3325);
-    int16x8_t v4069 = vsubq_s16(v3292, v3303);
-    int16x8_t v4070 = vsubq_s16(v3270, v3281);
-    int16x8_t v4071 = vsubq_s16(v3248, v3259);
-    int16x8_t v4072 = vsubq_s16(v3226, v3237);
-    int16x8_t v4073 = vsubq_s16(v3204, v3215);
-    int16x8_t v4074 = vsubq_s16(v3182, v3193);
-    int16x8_t v4075 = vsubq_s16(v3160, v3171);
-    int16x8_t v4076 = vsubq_s16(v3138, v3149);
-    int16x8_t v4077 = vsubq_s16(v3116, v3127);
-    int16x8_t v4078 = vsubq_s16(v3094, v3105);
-    int16x8_t v4079 = vsubq_s16(v3072, v3083);
-    int16x8_t v4080 = vsubq_s16(v3050, v3061);
-    int16x8_t v4081 = vsubq_s16(v3016, v3039);
-    int16x8_t v4082 = vsubq_s16(v2970, v2993);
-    int16x8_t v4083 = vsubq_s16(v2924, v2947);
-    int16x8_t v4084 = vsubq_s16(v2878, v2901);
-    int16x8_t v4085 = vsubq_s16(v2832, v2855);
-    int16x8_t v4086 = vsubq_s16(v2786, v2809);
-    int16x8_t v4087 = vsubq_s16(v2740, v2763);
-    int16x8_t v4088 = vsubq_s16(v2694, v2717);
-    int16x8_t v4089 = vsubq_s16(v2624, v2671);
-    int16x8_t v4090 = vsubq_s16(v2530, v2577);
-    int16x8_t v4091 = vsubq_s16(v2435, v2483);
-    int16x8_t v4092 = vsubq_s16(v2341, v2388);
-    int16x8_t v4093 = vsubq_s16(v2199, v2294);
-    int16x8_t v4094 = vsubq_s16(v2009, v2104);
-    int16x8_t v4095 = vsubq_s16(v1723, v1914);
-    int16x8_t v4096 = vsubq_s16(v701, v1532);
-    vst1q_s16(out + out_stride * 0 + i, v1533);
-    vst1q_s16(out + out_stride * 1 + i, v1915);
-    vst1q_s16(out + out_stride * 2 + i, v2105);
-    vst1q_s16(out + out_stride * 3 + i, v2295);
-    vst1q_s16(out + out_stride * 4 + i, v2389);
-    vst1q_s16(out + out_stride * 5 + i, v2484);
-    vst1q_s16(out + out_stride * 6 + i, v2578);
-    vst1q_s16(out + out_stride * 7 + i, v2672);
-    vst1q_s16(out + out_stride * 8 + i, v2718);
-    vst1q_s16(out + out_stride * 9 + i, v2764);
-    vst1q_s16(out + out_stride * 10 + i, v2810);
-    vst1q_s16(out + out_stride * 11 + i, v2856);
-    vst1q_s16(out + out_stride * 12 + i, v2902);
-    vst1q_s16(out + out_stride * 13 + i, v2948);
-    vst1q_s16(out + out_stride * 14 + i, v2994);
-    vst1q_s16(out + out_stride * 15 + i, v3040);
-    vst1q_s16(out + out_stride * 16 + i, v3062);
-    vst1q_s16(out + out_stride * 17 + i, v3084);
-    vst1q_s16(out + out_stride * 18 + i, v3106);
-    vst1q_s16(out + out_stride * 19 + i, v3128);
-    vst1q_s16(out + out_stride * 20 + i, v3150);
-    vst1q_s16(out + out_stride * 21 + i, v3172);
-    vst1q_s16(out + out_stride * 22 + i, v3194);
-    vst1q_s16(out + out_stride * 23 + i, v3216);
-    vst1q_s16(out + out_stride * 24 + i, v3238);
-    vst1q_s16(out + out_stride * 25 + i, v3260);
-    vst1q_s16(out + out_stride * 26 + i, v3282);
-    vst1q_s16(out + out_stride * 27 + i, v3304);
-    vst1q_s16(out + out_stride * 28 + i, v3326);
-    vst1q_s16(out + out_stride * 29 + i, v3348);
-    vst1q_s16(out + out_stride * 30 + i, v3370);
-    vst1q_s16(out + out_stride * 31 + i, v3392);
-    vst1q_s16(out + out_stride * 32 + i, v3402);
-    vst1q_s16(out + out_stride * 33 + i, v3412);
-    vst1q_s16(out + out_stride * 34 + i, v3422);
-    vst1q_s16(out + out_stride * 35 + i, v3432);
-    vst1q_s16(out + out_stride * 36 + i, v3442);
-    vst1q_s16(out + out_stride * 37 + i, v3452);
-    vst1q_s16(out + out_stride * 38 + i, v3462);
-    vst1q_s16(out + out_stride * 39 + i, v3472);
-    vst1q_s16(out + out_stride * 40 + i, v3482);
-    vst1q_s16(out + out_stride * 41 + i, v3492);
-    vst1q_s16(out + out_stride * 42 + i, v3502);
-    vst1q_s16(out + out_stride * 43 + i, v3512);
-    vst1q_s16(out + out_stride * 44 + i, v3522);
-    vst1q_s16(out + out_stride * 45 + i, v3532);
-    vst1q_s16(out + out_stride * 46 + i, v3542);
-    vst1q_s16(out + out_stride * 47 + i, v3552);
-    vst1q_s16(out + out_stride * 48 + i, v3562);
-    vst1q_s16(out + out_stride * 49 + i, v3572);
-    vst1q_s16(out + out_stride * 50 + i, v3582);
-    vst1q_s16(out + out_stride * 51 + i, v3592);
-    vst1q_s16(out + out_stride * 52 + i, v3602);
-    vst1q_s16(out + out_stride * 53 + i, v3612);
-    vst1q_s16(out + out_stride * 54 + i, v3622);
-    vst1q_s16(out + out_stride * 55 + i, v3632);
-    vst1q_s16(out + out_stride * 56 + i, v3642);
-    vst1q_s16(out + out_stride * 57 + i, v3652);
-    vst1q_s16(out + out_stride * 58 + i, v3662);
-    vst1q_s16(out + out_stride * 59 + i, v3672);
-    vst1q_s16(out + out_stride * 60 + i, v3682);
-    vst1q_s16(out + out_stride * 61 + i, v3692);
-    vst1q_s16(out + out_stride * 62 + i, v3702);
-    vst1q_s16(out + out_stride * 63 + i, v3712);
-    vst1q_s16(out + out_stride * 64 + i, v3716);
-    vst1q_s16(out + out_stride * 65 + i, v3720);
-    vst1q_s16(out + out_stride * 66 + i, v3724);
-    vst1q_s16(out + out_stride * 67 + i, v3728);
-    vst1q_s16(out + out_stride * 68 + i, v3732);
-    vst1q_s16(out + out_stride * 69 + i, v3736);
-    vst1q_s16(out + out_stride * 70 + i, v3740);
-    vst1q_s16(out + out_stride * 71 + i, v3744);
-    vst1q_s16(out + out_stride * 72 + i, v3748);
-    vst1q_s16(out + out_stride * 73 + i, v3752);
-    vst1q_s16(out + out_stride * 74 + i, v3756);
-    vst1q_s16(out + out_stride * 75 + i, v3760);
-    vst1q_s16(out + out_stride * 76 + i, v3764);
-    vst1q_s16(out + out_stride * 77 + i, v3768);
-    vst1q_s16(out + out_stride * 78 + i, v3772);
-    vst1q_s16(out + out_stride * 79 + i, v3776);
-    vst1q_s16(out + out_stride * 80 + i, v3780);
-    vst1q_s16(out + out_stride * 81 + i, v3784);
-    vst1q_s16(out + out_stride * 82 + i, v3788);
-    vst1q_s16(out + out_stride * 83 + i, v3792);
-    vst1q_s16(out + out_stride * 84 + i, v3796);
-    vst1q_s16(out + out_stride * 85 + i, v3800);
-    vst1q_s16(out + out_stride * 86 + i, v3804);
-    vst1q_s16(out + out_stride * 87 + i, v3808);
-    vst1q_s16(out + out_stride * 88 + i, v3812);
-    vst1q_s16(out + out_stride * 89 + i, v3816);
-    vst1q_s16(out + out_stride * 90 + i, v3820);
-    vst1q_s16(out + out_stride * 91 + i, v3824);
-    vst1q_s16(out + out_stride * 92 + i, v3828);
-    vst1q_s16(out + out_stride * 93 + i, v3832);
-    vst1q_s16(out + out_stride * 94 + i, v3836);
-    vst1q_s16(out + out_stride * 95 + i, v3840);
-    vst1q_s16(out + out_stride * 96 + i, v3844);
-    vst1q_s16(out + out_stride * 97 + i, v3848);
-    vst1q_s16(out + out_stride * 98 + i, v3852);
-    vst1q_s16(out + out_stride * 99 + i, v3856);
-    vst1q_s16(out + out_stride * 100 + i, v3860);
-    vst1q_s16(out + out_stride * 101 + i, v3864);
-    vst1q_s16(out + out_stride * 102 + i, v3868);
-    vst1q_s16(out + out_stride * 103 + i, v3872);
-    vst1q_s16(out + out_stride * 104 + i, v3876);
-    vst1q_s16(out + out_stride * 105 + i, v3880);
-    vst1q_s16(out + out_stride * 106 + i, v3884);
-    vst1q_s16(out + out_stride * 107 + i, v3888);
-    vst1q_s16(out + out_stride * 108 + i, v3892);
-    vst1q_s16(out + out_stride * 109 + i, v3896);
-    vst1q_s16(out + out_stride * 110 + i, v3900);
-    vst1q_s16(out + out_stride * 111 + i, v3904);
-    vst1q_s16(out + out_stride * 112 + i, v3908);
-    vst1q_s16(out + out_stride * 113 + i, v3912);
-    vst1q_s16(out + out_stride * 114 + i, v3916);
-    vst1q_s16(out + out_stride * 115 + i, v3920);
-    vst1q_s16(out + out_stride * 116 + i, v3924);
-    vst1q_s16(out + out_stride * 117 + i, v3928);
-    vst1q_s16(out + out_stride * 118 + i, v3932);
-    vst1q_s16(out + out_stride * 119 + i, v3936);
-    vst1q_s16(out + out_stride * 120 + i, v3940);
-    vst1q_s16(out + out_stride * 121 + i, v3944);
-    vst1q_s16(out + out_stride * 122 + i, v3948);
-    vst1q_s16(out + out_stride * 123 + i, v3952);
-    vst1q_s16(out + out_stride * 124 + i, v3956);
-    vst1q_s16(out + out_stride * 125 + i, v3960);
-    vst1q_s16(out + out_stride * 126 + i, v3964);
-    vst1q_s16(out + out_stride * 127 + i, v3968);
-    vst1q_s16(out + out_stride * 128 + i, v3969);
-    vst1q_s16(out + out_stride * 129 + i, v3970);
-    vst1q_s16(out + out_stride * 130 + i, v3971);
-    vst1q_s16(out + out_stride * 131 + i, v3972);
-    vst1q_s16(out + out_stride * 132 + i, v3973);
-    vst1q_s16(out + out_stride * 133 + i, v3974);
-    vst1q_s16(out + out_stride * 134 + i, v3975);
-    vst1q_s16(out + out_stride * 135 + i, v3976);
-    vst1q_s16(out + out_stride * 136 + i, v3977);
-    vst1q_s16(out + out_stride * 137 + i, v3978);
-    vst1q_s16(out + out_stride * 138 + i, v3979);
-    vst1q_s16(out + out_stride * 139 + i, v3980);
-    vst1q_s16(out + out_stride * 140 + i, v3981);
-    vst1q_s16(out + out_stride * 141 + i, v3982);
-    vst1q_s16(out + out_stride * 142 + i, v3983);
-    vst1q_s16(out + out_stride * 143 + i, v3984);
-    vst1q_s16(out + out_stride * 144 + i, v3985);
-    vst1q_s16(out + out_stride * 145 + i, v3986);
-    vst1q_s16(out + out_stride * 146 + i, v3987);
-    vst1q_s16(out + out_stride * 147 + i, v3988);
-    vst1q_s16(out + out_stride * 148 + i, v3989);
-    vst1q_s16(out + out_stride * 149 + i, v3990);
-    vst1q_s16(out + out_stride * 150 + i, v3991);
-    vst1q_s16(out + out_stride * 151 + i, v3992);
-    vst1q_s16(out + out_stride * 152 + i, v3993);
-    vst1q_s16(out + out_stride * 153 + i, v3994);
-    vst1q_s16(out + out_stride * 154 + i, v3995);
-    vst1q_s16(out + out_stride * 155 + i, v3996);
-    vst1q_s16(out + out_stride * 156 + i, v3997);
-    vst1q_s16(out + out_stride * 157 + i, v3998);
-    vst1q_s16(out + out_stride * 158 + i, v3999);
-    vst1q_s16(out + out_stride * 159 + i, v4000);
-    vst1q_s16(out + out_stride * 160 + i, v4001);
-    vst1q_s16(out + out_stride * 161 + i, v4002);
-    vst1q_s16(out + out_stride * 162 + i, v4003);
-    vst1q_s16(out + out_stride * 163 + i, v4004);
-    vst1q_s16(out + out_stride * 164 + i, v4005);
-    vst1q_s16(out + out_stride * 165 + i, v4006);
-    vst1q_s16(out + out_stride * 166 + i, v4007);
-    vst1q_s16(out + out_stride * 167 + i, v4008);
-    vst1q_s16(out + out_stride * 168 + i, v4009);
-    vst1q_s16(out + out_stride * 169 + i, v4010);
-    vst1q_s16(out + out_stride * 170 + i, v4011);
-    vst1q_s16(out + out_stride * 171 + i, v4012);
-    vst1q_s16(out + out_stride * 172 + i, v4013);
-    vst1q_s16(out + out_stride * 173 + i, v4014);
-    vst1q_s16(out + out_stride * 174 + i, v4015);
-    vst1q_s16(out + out_stride * 175 + i, v4016);
-    vst1q_s16(out + out_stride * 176 + i, v4017);
-    vst1q_s16(out + out_stride * 177 + i, v4018);
-    vst1q_s16(out + out_stride * 178 + i, v4019);
-    vst1q_s16(out + out_stride * 179 + i, v4020);
-    vst1q_s16(out + out_stride * 180 + i, v4021);
-    vst1q_s16(out + out_stride * 181 + i, v4022);
-    vst1q_s16(out + out_stride * 182 + i, v4023);
-    vst1q_s16(out + out_stride * 183 + i, v4024);
-    vst1q_s16(out + out_stride * 184 + i, v4025);
-    vst1q_s16(out + out_stride * 185 + i, v4026);
-    vst1q_s16(out + out_stride * 186 + i, v4027);
-    vst1q_s16(out + out_stride * 187 + i, v4028);
-    vst1q_s16(out + out_stride * 188 + i, v4029);
-    vst1q_s16(out + out_stride * 189 + i, v4030);
-    vst1q_s16(out + out_stride * 190 + i, v4031);
-    vst1q_s16(out + out_stride * 191 + i, v4032);
-    vst1q_s16(out + out_stride * 192 + i, v4033);
-    vst1q_s16(out + out_stride * 193 + i, v4034);
-    vst1q_s16(out + out_stride * 194 + i, v4035);
-    vst1q_s16(out + out_stride * 195 + i, v4036);
-    vst1q_s16(out + out_stride * 196 + i, v4037);
-    vst1q_s16(out + out_stride * 197 + i, v4038);
-    vst1q_s16(out + out_stride * 198 + i, v4039);
-    vst1q_s16(out + out_stride * 199 + i, v4040);
-    vst1q_s16(out + out_stride * 200 + i, v4041);
-    vst1q_s16(out + out_stride * 201 + i, v4042);
-    vst1q_s16(out + out_stride * 202 + i, v4043);
-    vst1q_s16(out + out_stride * 203 + i, v4044);
-    vst1q_s16(out + out_stride * 204 + i, v4045);
-    vst1q_s16(out + out_stride * 205 + i, v4046);
-    vst1q_s16(out + out_stride * 206 + i, v4047);
-    vst1q_s16(out + out_stride * 207 + i, v4048);
-    vst1q_s16(out + out_stride * 208 + i, v4049);
-    vst1q_s16(out + out_stride * 209 + i, v4050);
-    vst1q_s16(out + out_stride * 210 + i, v4051);
-    vst1q_s16(out + out_stride * 211 + i, v4052);
-    vst1q_s16(out + out_stride * 212 + i, v4053);
-    vst1q_s16(out + out_stride * 213 + i, v4054);
-    vst1q_s16(out + out_stride * 214 + i, v4055);
-    vst1q_s16(out + out_stride * 215 + i, v4056);
-    vst1q_s16(out + out_stride * 216 + i, v4057);
-    vst1q_s16(out + out_stride * 217 + i, v4058);
-    vst1q_s16(out + out_stride * 218 + i, v4059);
-    vst1q_s16(out + out_stride * 219 + i, v4060);
-    vst1q_s16(out + out_stride * 220 + i, v4061);
-    vst1q_s16(out + out_stride * 221 + i, v4062);
-    vst1q_s16(out + out_stride * 222 + i, v4063);
-    vst1q_s16(out + out_stride * 223 + i, v4064);
-    vst1q_s16(out + out_stride * 224 + i, v4065);
-    vst1q_s16(out + out_stride * 225 + i, v4066);
-    vst1q_s16(out + out_stride * 226 + i, v4067);
-    vst1q_s16(out + out_stride * 227 + i, v4068);
-    vst1q_s16(out + out_stride * 228 + i, v4069);
-    vst1q_s16(out + out_stride * 229 + i, v4070);
-    vst1q_s16(out + out_stride * 230 + i, v4071);
-    vst1q_s16(out + out_stride * 231 + i, v4072);
-    vst1q_s16(out + out_stride * 232 + i, v4073);
-    vst1q_s16(out + out_stride * 233 + i, v4074);
-    vst1q_s16(out + out_stride * 234 + i, v4075);
-    vst1q_s16(out + out_stride * 235 + i, v4076);
-    vst1q_s16(out + out_stride * 236 + i, v4077);
-    vst1q_s16(out + out_stride * 237 + i, v4078);
-    vst1q_s16(out + out_stride * 238 + i, v4079);
-    vst1q_s16(out + out_stride * 239 + i, v4080);
-    vst1q_s16(out + out_stride * 240 + i, v4081);
-    vst1q_s16(out + out_stride * 241 + i, v4082);
-    vst1q_s16(out + out_stride * 242 + i, v4083);
-    vst1q_s16(out + out_stride * 243 + i, v4084);
-    vst1q_s16(out + out_stride * 244 + i, v4085);
-    vst1q_s16(out + out_stride * 245 + i, v4086);
-    vst1q_s16(out + out_stride * 246 + i, v4087);
-    vst1q_s16(out + out_stride * 247 + i, v4088);
-    vst1q_s16(out + out_stride * 248 + i, v4089);
-    vst1q_s16(out + out_stride * 249 + i, v4090);
-    vst1q_s16(out + out_stride * 250 + i, v4091);
-    vst1q_s16(out + out_stride * 251 + i, v4092);
-    vst1q_s16(out + out_stride * 252 + i, v4093);
-    vst1q_s16(out + out_stride * 253 + i, v4094);
-    vst1q_s16(out + out_stride * 254 + i, v4095);
-    vst1q_s16(out + out_stride * 255 + i, v4096);
+  const HWY_CAPPED(int16_t, 8) d16;
+  for (size_t i = 0; i < count; i += Lanes(d16)) {
+    auto v0 = LoadU(d16, in + in_stride * 0 + i);
+    auto v1 = LoadU(d16, in + in_stride * 128 + i);
+    auto v2 = Add(v0, v1);
+    auto v3 = LoadU(d16, in + in_stride * 64 + i);
+    auto v4_tmp = MulFixedPoint15(v3, Set(d16, 13573));
+    auto v4 = Add(v4_tmp, v3);
+    auto v5 = LoadU(d16, in + in_stride * 192 + i);
+    auto v6 = Add(v5, v3);
+    auto v7 = Add(v4, v6);
+    auto v8 = MulFixedPoint15(v7, Set(d16, 17734));
+    auto v9 = Add(v2, v8);
+    auto v10 = LoadU(d16, in + in_stride * 32 + i);
+    auto v11_tmp = MulFixedPoint15(v10, Set(d16, 13573));
+    auto v11 = Add(v11_tmp, v10);
+    auto v12 = LoadU(d16, in + in_stride * 160 + i);
+    auto v13 = LoadU(d16, in + in_stride * 96 + i);
+    auto v14 = Add(v12, v13);
+    auto v15 = Add(v11, v14);
+    auto v16 = Add(v13, v10);
+    auto v17_tmp = MulFixedPoint15(v16, Set(d16, 13573));
+    auto v17 = Add(v17_tmp, v16);
+    auto v18 = LoadU(d16, in + in_stride * 224 + i);
+    auto v19 = Add(v18, v12);
+    auto v20 = Add(v19, v16);
+    auto v21 = Add(v17, v20);
+    auto v22 = MulFixedPoint15(v21, Set(d16, 17734));
+    auto v23 = Add(v15, v22);
+    auto v24 = MulFixedPoint15(v23, Set(d16, 16705));
+    auto v25 = Add(v9, v24);
+    auto v26 = LoadU(d16, in + in_stride * 16 + i);
+    auto v27_tmp = MulFixedPoint15(v26, Set(d16, 13573));
+    auto v27 = Add(v27_tmp, v26);
+    auto v28 = LoadU(d16, in + in_stride * 144 + i);
+    auto v29 = LoadU(d16, in + in_stride * 112 + i);
+    auto v30 = Add(v28, v29);
+    auto v31 = Add(v27, v30);
+    auto v32 = LoadU(d16, in + in_stride * 80 + i);
+    auto v33 = LoadU(d16, in + in_stride * 48 + i);
+    auto v34 = Add(v32, v33);
+    auto v35_tmp = MulFixedPoint15(v34, Set(d16, 13573));
+    auto v35 = Add(v35_tmp, v34);
+    auto v36 = LoadU(d16, in + in_stride * 208 + i);
+    auto v37 = LoadU(d16, in + in_stride * 176 + i);
+    auto v38 = Add(v36, v37);
+    auto v39 = Add(v38, v34);
+    auto v40 = Add(v35, v39);
+    auto v41 = MulFixedPoint15(v40, Set(d16, 17734));
+    auto v42 = Add(v31, v41);
+    auto v43 = Add(v33, v26);
+    auto v44_tmp = MulFixedPoint15(v43, Set(d16, 13573));
+    auto v44 = Add(v44_tmp, v43);
+    auto v45 = Add(v37, v28);
+    auto v46 = Add(v29, v32);
+    auto v47 = Add(v45, v46);
+    auto v48 = Add(v44, v47);
+    auto v49 = Add(v46, v43);
+    auto v50_tmp = MulFixedPoint15(v49, Set(d16, 13573));
+    auto v50 = Add(v50_tmp, v49);
+    auto v51 = LoadU(d16, in + in_stride * 240 + i);
+    auto v52 = Add(v51, v36);
+    auto v53 = Add(v52, v45);
+    auto v54 = Add(v53, v49);
+    auto v55 = Add(v50, v54);
+    auto v56 = MulFixedPoint15(v55, Set(d16, 17734));
+    auto v57 = Add(v48, v56);
+    auto v58 = MulFixedPoint15(v57, Set(d16, 16705));
+    auto v59 = Add(v42, v58);
+    auto v60 = MulFixedPoint15(v59, Set(d16, 16463));
+    auto v61 = Add(v25, v60);
+    auto v62 = LoadU(d16, in + in_stride * 8 + i);
+    auto v63_tmp = MulFixedPoint15(v62, Set(d16, 13573));
+    auto v63 = Add(v63_tmp, v62);
+    auto v64 = LoadU(d16, in + in_stride * 136 + i);
+    auto v65 = LoadU(d16, in + in_stride * 120 + i);
+    auto v66 = Add(v64, v65);
+    auto v67 = Add(v63, v66);
+    auto v68 = LoadU(d16, in + in_stride * 72 + i);
+    auto v69 = LoadU(d16, in + in_stride * 56 + i);
+    auto v70 = Add(v68, v69);
+    auto v71_tmp = MulFixedPoint15(v70, Set(d16, 13573));
+    auto v71 = Add(v71_tmp, v70);
+    auto v72 = LoadU(d16, in + in_stride * 200 + i);
+    auto v73 = LoadU(d16, in + in_stride * 184 + i);
+    auto v74 = Add(v72, v73);
+    auto v75 = Add(v74, v70);
+    auto v76 = Add(v71, v75);
+    auto v77 = MulFixedPoint15(v76, Set(d16, 17734));
+    auto v78 = Add(v67, v77);
+    auto v79 = LoadU(d16, in + in_stride * 40 + i);
+    auto v80 = LoadU(d16, in + in_stride * 24 + i);
+    auto v81 = Add(v79, v80);
+    auto v82_tmp = MulFixedPoint15(v81, Set(d16, 13573));
+    auto v82 = Add(v82_tmp, v81);
+    auto v83 = LoadU(d16, in + in_stride * 168 + i);
+    auto v84 = LoadU(d16, in + in_stride * 152 + i);
+    auto v85 = Add(v83, v84);
+    auto v86 = LoadU(d16, in + in_stride * 104 + i);
+    auto v87 = LoadU(d16, in + in_stride * 88 + i);
+    auto v88 = Add(v86, v87);
+    auto v89 = Add(v85, v88);
+    auto v90 = Add(v82, v89);
+    auto v91 = Add(v88, v81);
+    auto v92_tmp = MulFixedPoint15(v91, Set(d16, 13573));
+    auto v92 = Add(v92_tmp, v91);
+    auto v93 = LoadU(d16, in + in_stride * 232 + i);
+    auto v94 = LoadU(d16, in + in_stride * 216 + i);
+    auto v95 = Add(v93, v94);
+    auto v96 = Add(v95, v85);
+    auto v97 = Add(v96, v91);
+    auto v98 = Add(v92, v97);
+    auto v99 = MulFixedPoint15(v98, Set(d16, 17734));
+    auto v100 = Add(v90, v99);
+    auto v101 = MulFixedPoint15(v100, Set(d16, 16705));
+    auto v102 = Add(v78, v101);
+    auto v103 = Add(v80, v62);
+    auto v104_tmp = MulFixedPoint15(v103, Set(d16, 13573));
+    auto v104 = Add(v104_tmp, v103);
+    auto v105 = Add(v84, v64);
+    auto v106 = Add(v65, v86);
+    auto v107 = Add(v105, v106);
+    auto v108 = Add(v104, v107);
+    auto v109 = Add(v87, v68);
+    auto v110 = Add(v69, v79);
+    auto v111 = Add(v109, v110);
+    auto v112_tmp = MulFixedPoint15(v111, Set(d16, 13573));
+    auto v112 = Add(v112_tmp, v111);
+    auto v113 = Add(v94, v72);
+    auto v114 = Add(v73, v83);
+    auto v115 = Add(v113, v114);
+    auto v116 = Add(v115, v111);
+    auto v117 = Add(v112, v116);
+    auto v118 = MulFixedPoint15(v117, Set(d16, 17734));
+    auto v119 = Add(v108, v118);
+    auto v120 = Add(v110, v103);
+    auto v121_tmp = MulFixedPoint15(v120, Set(d16, 13573));
+    auto v121 = Add(v121_tmp, v120);
+    auto v122 = Add(v114, v105);
+    auto v123 = Add(v106, v109);
+    auto v124 = Add(v122, v123);
+    auto v125 = Add(v121, v124);
+    auto v126 = Add(v123, v120);
+    auto v127_tmp = MulFixedPoint15(v126, Set(d16, 13573));
+    auto v127 = Add(v127_tmp, v126);
+    auto v128 = LoadU(d16, in + in_stride * 248 + i);
+    auto v129 = Add(v128, v93);
+    auto v130 = Add(v129, v113);
+    auto v131 = Add(v130, v122);
+    auto v132 = Add(v131, v126);
+    auto v133 = Add(v127, v132);
+    auto v134 = MulFixedPoint15(v133, Set(d16, 17734));
+    auto v135 = Add(v125, v134);
+    auto v136 = MulFixedPoint15(v135, Set(d16, 16705));
+    auto v137 = Add(v119, v136);
+    auto v138 = MulFixedPoint15(v137, Set(d16, 16463));
+    auto v139 = Add(v102, v138);
+    auto v140 = MulFixedPoint15(v139, Set(d16, 16404));
+    auto v141 = Add(v61, v140);
+    auto v142 = LoadU(d16, in + in_stride * 4 + i);
+    auto v143_tmp = MulFixedPoint15(v142, Set(d16, 13573));
+    auto v143 = Add(v143_tmp, v142);
+    auto v144 = LoadU(d16, in + in_stride * 132 + i);
+    auto v145 = LoadU(d16, in + in_stride * 124 + i);
+    auto v146 = Add(v144, v145);
+    auto v147 = Add(v143, v146);
+    auto v148 = LoadU(d16, in + in_stride * 68 + i);
+    auto v149 = LoadU(d16, in + in_stride * 60 + i);
+    auto v150 = Add(v148, v149);
+    auto v151_tmp = MulFixedPoint15(v150, Set(d16, 13573));
+    auto v151 = Add(v151_tmp, v150);
+    auto v152 = LoadU(d16, in + in_stride * 196 + i);
+    auto v153 = LoadU(d16, in + in_stride * 188 + i);
+    auto v154 = Add(v152, v153);
+    auto v155 = Add(v154, v150);
+    auto v156 = Add(v151, v155);
+    auto v157 = MulFixedPoint15(v156, Set(d16, 17734));
+    auto v158 = Add(v147, v157);
+    auto v159 = LoadU(d16, in + in_stride * 36 + i);
+    auto v160 = LoadU(d16, in + in_stride * 28 + i);
+    auto v161 = Add(v159, v160);
+    auto v162_tmp = MulFixedPoint15(v161, Set(d16, 13573));
+    auto v162 = Add(v162_tmp, v161);
+    auto v163 = LoadU(d16, in + in_stride * 164 + i);
+    auto v164 = LoadU(d16, in + in_stride * 156 + i);
+    auto v165 = Add(v163, v164);
+    auto v166 = LoadU(d16, in + in_stride * 100 + i);
+    auto v167 = LoadU(d16, in + in_stride * 92 + i);
+    auto v168 = Add(v166, v167);
+    auto v169 = Add(v165, v168);
+    auto v170 = Add(v162, v169);
+    auto v171 = Add(v168, v161);
+    auto v172_tmp = MulFixedPoint15(v171, Set(d16, 13573));
+    auto v172 = Add(v172_tmp, v171);
+    auto v173 = LoadU(d16, in + in_stride * 228 + i);
+    auto v174 = LoadU(d16, in + in_stride * 220 + i);
+    auto v175 = Add(v173, v174);
+    auto v176 = Add(v175, v165);
+    auto v177 = Add(v176, v171);
+    auto v178 = Add(v172, v177);
+    auto v179 = MulFixedPoint15(v178, Set(d16, 17734));
+    auto v180 = Add(v170, v179);
+    auto v181 = MulFixedPoint15(v180, Set(d16, 16705));
+    auto v182 = Add(v158, v181);
+    auto v183 = LoadU(d16, in + in_stride * 20 + i);
+    auto v184 = LoadU(d16, in + in_stride * 12 + i);
+    auto v185 = Add(v183, v184);
+    auto v186_tmp = MulFixedPoint15(v185, Set(d16, 13573));
+    auto v186 = Add(v186_tmp, v185);
+    auto v187 = LoadU(d16, in + in_stride * 148 + i);
+    auto v188 = LoadU(d16, in + in_stride * 140 + i);
+    auto v189 = Add(v187, v188);
+    auto v190 = LoadU(d16, in + in_stride * 116 + i);
+    auto v191 = LoadU(d16, in + in_stride * 108 + i);
+    auto v192 = Add(v190, v191);
+    auto v193 = Add(v189, v192);
+    auto v194 = Add(v186, v193);
+    auto v195 = LoadU(d16, in + in_stride * 84 + i);
+    auto v196 = LoadU(d16, in + in_stride * 76 + i);
+    auto v197 = Add(v195, v196);
+    auto v198 = LoadU(d16, in + in_stride * 52 + i);
+    auto v199 = LoadU(d16, in + in_stride * 44 + i);
+    auto v200 = Add(v198, v199);
+    auto v201 = Add(v197, v200);
+    auto v202_tmp = MulFixedPoint15(v201, Set(d16, 13573));
+    auto v202 = Add(v202_tmp, v201);
+    auto v203 = LoadU(d16, in + in_stride * 212 + i);
+    auto v204 = LoadU(d16, in + in_stride * 204 + i);
+    auto v205 = Add(v203, v204);
+    auto v206 = LoadU(d16, in + in_stride * 180 + i);
+    auto v207 = LoadU(d16, in + in_stride * 172 + i);
+    auto v208 = Add(v206, v207);
+    auto v209 = Add(v205, v208);
+    auto v210 = Add(v209, v201);
+    auto v211 = Add(v202, v210);
+    auto v212 = MulFixedPoint15(v211, Set(d16, 17734));
+    auto v213 = Add(v194, v212);
+    auto v214 = Add(v200, v185);
+    auto v215_tmp = MulFixedPoint15(v214, Set(d16, 13573));
+    auto v215 = Add(v215_tmp, v214);
+    auto v216 = Add(v208, v189);
+    auto v217 = Add(v192, v197);
+    auto v218 = Add(v216, v217);
+    auto v219 = Add(v215, v218);
+    auto v220 = Add(v217, v214);
+    auto v221_tmp = MulFixedPoint15(v220, Set(d16, 13573));
+    auto v221 = Add(v221_tmp, v220);
+    auto v222 = LoadU(d16, in + in_stride * 244 + i);
+    auto v223 = LoadU(d16, in + in_stride * 236 + i);
+    auto v224 = Add(v222, v223);
+    auto v225 = Add(v224, v205);
+    auto v226 = Add(v225, v216);
+    auto v227 = Add(v226, v220);
+    auto v228 = Add(v221, v227);
+    auto v229 = MulFixedPoint15(v228, Set(d16, 17734));
+    auto v230 = Add(v219, v229);
+    auto v231 = MulFixedPoint15(v230, Set(d16, 16705));
+    auto v232 = Add(v213, v231);
+    auto v233 = MulFixedPoint15(v232, Set(d16, 16463));
+    auto v234 = Add(v182, v233);
+    auto v235 = Add(v184, v142);
+    auto v236_tmp = MulFixedPoint15(v235, Set(d16, 13573));
+    auto v236 = Add(v236_tmp, v235);
+    auto v237 = Add(v188, v144);
+    auto v238 = Add(v145, v190);
+    auto v239 = Add(v237, v238);
+    auto v240 = Add(v236, v239);
+    auto v241 = Add(v196, v148);
+    auto v242 = Add(v149, v198);
+    auto v243 = Add(v241, v242);
+    auto v244_tmp = MulFixedPoint15(v243, Set(d16, 13573));
+    auto v244 = Add(v244_tmp, v243);
+    auto v245 = Add(v204, v152);
+    auto v246 = Add(v153, v206);
+    auto v247 = Add(v245, v246);
+    auto v248 = Add(v247, v243);
+    auto v249 = Add(v244, v248);
+    auto v250 = MulFixedPoint15(v249, Set(d16, 17734));
+    auto v251 = Add(v240, v250);
+    auto v252 = Add(v199, v159);
+    auto v253 = Add(v160, v183);
+    auto v254 = Add(v252, v253);
+    auto v255_tmp = MulFixedPoint15(v254, Set(d16, 13573));
+    auto v255 = Add(v255_tmp, v254);
+    auto v256 = Add(v207, v163);
+    auto v257 = Add(v164, v187);
+    auto v258 = Add(v256, v257);
+    auto v259 = Add(v191, v166);
+    auto v260 = Add(v167, v195);
+    auto v261 = Add(v259, v260);
+    auto v262 = Add(v258, v261);
+    auto v263 = Add(v255, v262);
+    auto v264 = Add(v261, v254);
+    auto v265_tmp = MulFixedPoint15(v264, Set(d16, 13573));
+    auto v265 = Add(v265_tmp, v264);
+    auto v266 = Add(v223, v173);
+    auto v267 = Add(v174, v203);
+    auto v268 = Add(v266, v267);
+    auto v269 = Add(v268, v258);
+    auto v270 = Add(v269, v264);
+    auto v271 = Add(v265, v270);
+    auto v272 = MulFixedPoint15(v271, Set(d16, 17734));
+    auto v273 = Add(v263, v272);
+    auto v274 = MulFixedPoint15(v273, Set(d16, 16705));
+    auto v275 = Add(v251, v274);
+    auto v276 = Add(v253, v235);
+    auto v277_tmp = MulFixedPoint15(v276, Set(d16, 13573));
+    auto v277 = Add(v277_tmp, v276);
+    auto v278 = Add(v257, v237);
+    auto v279 = Add(v238, v259);
+    auto v280 = Add(v278, v279);
+    auto v281 = Add(v277, v280);
+    auto v282 = Add(v260, v241);
+    auto v283 = Add(v242, v252);
+    auto v284 = Add(v282, v283);
+    auto v285_tmp = MulFixedPoint15(v284, Set(d16, 13573));
+    auto v285 = Add(v285_tmp, v284);
+    auto v286 = Add(v267, v245);
+    auto v287 = Add(v246, v256);
+    auto v288 = Add(v286, v287);
+    auto v289 = Add(v288, v284);
+    auto v290 = Add(v285, v289);
+    auto v291 = MulFixedPoint15(v290, Set(d16, 17734));
+    auto v292 = Add(v281, v291);
+    auto v293 = Add(v283, v276);
+    auto v294_tmp = MulFixedPoint15(v293, Set(d16, 13573));
+    auto v294 = Add(v294_tmp, v293);
+    auto v295 = Add(v287, v278);
+    auto v296 = Add(v279, v282);
+    auto v297 = Add(v295, v296);
+    auto v298 = Add(v294, v297);
+    auto v299 = Add(v296, v293);
+    auto v300_tmp = MulFixedPoint15(v299, Set(d16, 13573));
+    auto v300 = Add(v300_tmp, v299);
+    auto v301 = LoadU(d16, in + in_stride * 252 + i);
+    auto v302 = Add(v301, v222);
+    auto v303 = Add(v302, v266);
+    auto v304 = Add(v303, v286);
+    auto v305 = Add(v304, v295);
+    auto v306 = Add(v305, v299);
+    auto v307 = Add(v300, v306);
+    auto v308 = MulFixedPoint15(v307, Set(d16, 17734));
+    auto v309 = Add(v298, v308);
+    auto v310 = MulFixedPoint15(v309, Set(d16, 16705));
+    auto v311 = Add(v292, v310);
+    auto v312 = MulFixedPoint15(v311, Set(d16, 16463));
+    auto v313 = Add(v275, v312);
+    auto v314 = MulFixedPoint15(v313, Set(d16, 16404));
+    auto v315 = Add(v234, v314);
+    auto v316 = MulFixedPoint15(v315, Set(d16, 16389));
+    auto v317 = Add(v141, v316);
+    auto v318 = LoadU(d16, in + in_stride * 2 + i);
+    auto v319_tmp = MulFixedPoint15(v318, Set(d16, 13573));
+    auto v319 = Add(v319_tmp, v318);
+    auto v320 = LoadU(d16, in + in_stride * 130 + i);
+    auto v321 = LoadU(d16, in + in_stride * 126 + i);
+    auto v322 = Add(v320, v321);
+    auto v323 = Add(v319, v322);
+    auto v324 = LoadU(d16, in + in_stride * 66 + i);
+    auto v325 = LoadU(d16, in + in_stride * 62 + i);
+    auto v326 = Add(v324, v325);
+    auto v327_tmp = MulFixedPoint15(v326, Set(d16, 13573));
+    auto v327 = Add(v327_tmp, v326);
+    auto v328 = LoadU(d16, in + in_stride * 194 + i);
+    auto v329 = LoadU(d16, in + in_stride * 190 + i);
+    auto v330 = Add(v328, v329);
+    auto v331 = Add(v330, v326);
+    auto v332 = Add(v327, v331);
+    auto v333 = MulFixedPoint15(v332, Set(d16, 17734));
+    auto v334 = Add(v323, v333);
+    auto v335 = LoadU(d16, in + in_stride * 34 + i);
+    auto v336 = LoadU(d16, in + in_stride * 30 + i);
+    auto v337 = Add(v335, v336);
+    auto v338_tmp = MulFixedPoint15(v337, Set(d16, 13573));
+    auto v338 = Add(v338_tmp, v337);
+    auto v339 = LoadU(d16, in + in_stride * 162 + i);
+    auto v340 = LoadU(d16, in + in_stride * 158 + i);
+    auto v341 = Add(v339, v340);
+    auto v342 = LoadU(d16, in + in_stride * 98 + i);
+    auto v343 = LoadU(d16, in + in_stride * 94 + i);
+    auto v344 = Add(v342, v343);
+    auto v345 = Add(v341, v344);
+    auto v346 = Add(v338, v345);
+    auto v347 = Add(v344, v337);
+    auto v348_tmp = MulFixedPoint15(v347, Set(d16, 13573));
+    auto v348 = Add(v348_tmp, v347);
+    auto v349 = LoadU(d16, in + in_stride * 226 + i);
+    auto v350 = LoadU(d16, in + in_stride * 222 + i);
+    auto v351 = Add(v349, v350);
+    auto v352 = Add(v351, v341);
+    auto v353 = Add(v352, v347);
+    auto v354 = Add(v348, v353);
+    auto v355 = MulFixedPoint15(v354, Set(d16, 17734));
+    auto v356 = Add(v346, v355);
+    auto v357 = MulFixedPoint15(v356, Set(d16, 16705));
+    auto v358 = Add(v334, v357);
+    auto v359 = LoadU(d16, in + in_stride * 18 + i);
+    auto v360 = LoadU(d16, in + in_stride * 14 + i);
+    auto v361 = Add(v359, v360);
+    auto v362_tmp = MulFixedPoint15(v361, Set(d16, 13573));
+    auto v362 = Add(v362_tmp, v361);
+    auto v363 = LoadU(d16, in + in_stride * 146 + i);
+    auto v364 = LoadU(d16, in + in_stride * 142 + i);
+    auto v365 = Add(v363, v364);
+    auto v366 = LoadU(d16, in + in_stride * 114 + i);
+    auto v367 = LoadU(d16, in + in_stride * 110 + i);
+    auto v368 = Add(v366, v367);
+    auto v369 = Add(v365, v368);
+    auto v370 = Add(v362, v369);
+    auto v371 = LoadU(d16, in + in_stride * 82 + i);
+    auto v372 = LoadU(d16, in + in_stride * 78 + i);
+    auto v373 = Add(v371, v372);
+    auto v374 = LoadU(d16, in + in_stride * 50 + i);
+    auto v375 = LoadU(d16, in + in_stride * 46 + i);
+    auto v376 = Add(v374, v375);
+    auto v377 = Add(v373, v376);
+    auto v378_tmp = MulFixedPoint15(v377, Set(d16, 13573));
+    auto v378 = Add(v378_tmp, v377);
+    auto v379 = LoadU(d16, in + in_stride * 210 + i);
+    auto v380 = LoadU(d16, in + in_stride * 206 + i);
+    auto v381 = Add(v379, v380);
+    auto v382 = LoadU(d16, in + in_stride * 178 + i);
+    auto v383 = LoadU(d16, in + in_stride * 174 + i);
+    auto v384 = Add(v382, v383);
+    auto v385 = Add(v381, v384);
+    auto v386 = Add(v385, v377);
+    auto v387 = Add(v378, v386);
+    auto v388 = MulFixedPoint15(v387, Set(d16, 17734));
+    auto v389 = Add(v370, v388);
+    auto v390 = Add(v376, v361);
+    auto v391_tmp = MulFixedPoint15(v390, Set(d16, 13573));
+    auto v391 = Add(v391_tmp, v390);
+    auto v392 = Add(v384, v365);
+    auto v393 = Add(v368, v373);
+    auto v394 = Add(v392, v393);
+    auto v395 = Add(v391, v394);
+    auto v396 = Add(v393, v390);
+    auto v397_tmp = MulFixedPoint15(v396, Set(d16, 13573));
+    auto v397 = Add(v397_tmp, v396);
+    auto v398 = LoadU(d16, in + in_stride * 242 + i);
+    auto v399 = LoadU(d16, in + in_stride * 238 + i);
+    auto v400 = Add(v398, v399);
+    auto v401 = Add(v400, v381);
+    auto v402 = Add(v401, v392);
+    auto v403 = Add(v402, v396);
+    auto v404 = Add(v397, v403);
+    auto v405 = MulFixedPoint15(v404, Set(d16, 17734));
+    auto v406 = Add(v395, v405);
+    auto v407 = MulFixedPoint15(v406, Set(d16, 16705));
+    auto v408 = Add(v389, v407);
+    auto v409 = MulFixedPoint15(v408, Set(d16, 16463));
+    auto v410 = Add(v358, v409);
+    auto v411 = LoadU(d16, in + in_stride * 10 + i);
+    auto v412 = LoadU(d16, in + in_stride * 6 + i);
+    auto v413 = Add(v411, v412);
+    auto v414_tmp = MulFixedPoint15(v413, Set(d16, 13573));
+    auto v414 = Add(v414_tmp, v413);
+    auto v415 = LoadU(d16, in + in_stride * 138 + i);
+    auto v416 = LoadU(d16, in + in_stride * 134 + i);
+    auto v417 = Add(v415, v416);
+    auto v418 = LoadU(d16, in + in_stride * 122 + i);
+    auto v419 = LoadU(d16, in + in_stride * 118 + i);
+    auto v420 = Add(v418, v419);
+    auto v421 = Add(v417, v420);
+    auto v422 = Add(v414, v421);
+    auto v423 = LoadU(d16, in + in_stride * 74 + i);
+    auto v424 = LoadU(d16, in + in_stride * 70 + i);
+    auto v425 = Add(v423, v424);
+    auto v426 = LoadU(d16, in + in_stride * 58 + i);
+    auto v427 = LoadU(d16, in + in_stride * 54 + i);
+    auto v428 = Add(v426, v427);
+    auto v429 = Add(v425, v428);
+    auto v430_tmp = MulFixedPoint15(v429, Set(d16, 13573));
+    auto v430 = Add(v430_tmp, v429);
+    auto v431 = LoadU(d16, in + in_stride * 202 + i);
+    auto v432 = LoadU(d16, in + in_stride * 198 + i);
+    auto v433 = Add(v431, v432);
+    auto v434 = LoadU(d16, in + in_stride * 186 + i);
+    auto v435 = LoadU(d16, in + in_stride * 182 + i);
+    auto v436 = Add(v434, v435);
+    auto v437 = Add(v433, v436);
+    auto v438 = Add(v437, v429);
+    auto v439 = Add(v430, v438);
+    auto v440 = MulFixedPoint15(v439, Set(d16, 17734));
+    auto v441 = Add(v422, v440);
+    auto v442 = LoadU(d16, in + in_stride * 42 + i);
+    auto v443 = LoadU(d16, in + in_stride * 38 + i);
+    auto v444 = Add(v442, v443);
+    auto v445 = LoadU(d16, in + in_stride * 26 + i);
+    auto v446 = LoadU(d16, in + in_stride * 22 + i);
+    auto v447 = Add(v445, v446);
+    auto v448 = Add(v444, v447);
+    auto v449_tmp = MulFixedPoint15(v448, Set(d16, 13573));
+    auto v449 = Add(v449_tmp, v448);
+    auto v450 = LoadU(d16, in + in_stride * 170 + i);
+    auto v451 = LoadU(d16, in + in_stride * 166 + i);
+    auto v452 = Add(v450, v451);
+    auto v453 = LoadU(d16, in + in_stride * 154 + i);
+    auto v454 = LoadU(d16, in + in_stride * 150 + i);
+    auto v455 = Add(v453, v454);
+    auto v456 = Add(v452, v455);
+    auto v457 = LoadU(d16, in + in_stride * 106 + i);
+    auto v458 = LoadU(d16, in + in_stride * 102 + i);
+    auto v459 = Add(v457, v458);
+    auto v460 = LoadU(d16, in + in_stride * 90 + i);
+    auto v461 = LoadU(d16, in + in_stride * 86 + i);
+    auto v462 = Add(v460, v461);
+    auto v463 = Add(v459, v462);
+    auto v464 = Add(v456, v463);
+    auto v465 = Add(v449, v464);
+    auto v466 = Add(v463, v448);
+    auto v467_tmp = MulFixedPoint15(v466, Set(d16, 13573));
+    auto v467 = Add(v467_tmp, v466);
+    auto v468 = LoadU(d16, in + in_stride * 234 + i);
+    auto v469 = LoadU(d16, in + in_stride * 230 + i);
+    auto v470 = Add(v468, v469);
+    auto v471 = LoadU(d16, in + in_stride * 218 + i);
+    auto v472 = LoadU(d16, in + in_stride * 214 + i);
+    auto v473 = Add(v471, v472);
+    auto v474 = Add(v470, v473);
+    auto v475 = Add(v474, v456);
+    auto v476 = Add(v475, v466);
+    auto v477 = Add(v467, v476);
+    auto v478 = MulFixedPoint15(v477, Set(d16, 17734));
+    auto v479 = Add(v465, v478);
+    auto v480 = MulFixedPoint15(v479, Set(d16, 16705));
+    auto v481 = Add(v441, v480);
+    auto v482 = Add(v447, v413);
+    auto v483_tmp = MulFixedPoint15(v482, Set(d16, 13573));
+    auto v483 = Add(v483_tmp, v482);
+    auto v484 = Add(v455, v417);
+    auto v485 = Add(v420, v459);
+    auto v486 = Add(v484, v485);
+    auto v487 = Add(v483, v486);
+    auto v488 = Add(v462, v425);
+    auto v489 = Add(v428, v444);
+    auto v490 = Add(v488, v489);
+    auto v491_tmp = MulFixedPoint15(v490, Set(d16, 13573));
+    auto v491 = Add(v491_tmp, v490);
+    auto v492 = Add(v473, v433);
+    auto v493 = Add(v436, v452);
+    auto v494 = Add(v492, v493);
+    auto v495 = Add(v494, v490);
+    auto v496 = Add(v491, v495);
+    auto v497 = MulFixedPoint15(v496, Set(d16, 17734));
+    auto v498 = Add(v487, v497);
+    auto v499 = Add(v489, v482);
+    auto v500_tmp = MulFixedPoint15(v499, Set(d16, 13573));
+    auto v500 = Add(v500_tmp, v499);
+    auto v501 = Add(v493, v484);
+    auto v502 = Add(v485, v488);
+    auto v503 = Add(v501, v502);
+    auto v504 = Add(v500, v503);
+    auto v505 = Add(v502, v499);
+    auto v506_tmp = MulFixedPoint15(v505, Set(d16, 13573));
+    auto v506 = Add(v506_tmp, v505);
+    auto v507 = LoadU(d16, in + in_stride * 250 + i);
+    auto v508 = LoadU(d16, in + in_stride * 246 + i);
+    auto v509 = Add(v507, v508);
+    auto v510 = Add(v509, v470);
+    auto v511 = Add(v510, v492);
+    auto v512 = Add(v511, v501);
+    auto v513 = Add(v512, v505);
+    auto v514 = Add(v506, v513);
+    auto v515 = MulFixedPoint15(v514, Set(d16, 17734));
+    auto v516 = Add(v504, v515);
+    auto v517 = MulFixedPoint15(v516, Set(d16, 16705));
+    auto v518 = Add(v498, v517);
+    auto v519 = MulFixedPoint15(v518, Set(d16, 16463));
+    auto v520 = Add(v481, v519);
+    auto v521 = MulFixedPoint15(v520, Set(d16, 16404));
+    auto v522 = Add(v410, v521);
+    auto v523 = Add(v412, v318);
+    auto v524_tmp = MulFixedPoint15(v523, Set(d16, 13573));
+    auto v524 = Add(v524_tmp, v523);
+    auto v525 = Add(v416, v320);
+    auto v526 = Add(v321, v418);
+    auto v527 = Add(v525, v526);
+    auto v528 = Add(v524, v527);
+    auto v529 = Add(v424, v324);
+    auto v530 = Add(v325, v426);
+    auto v531 = Add(v529, v530);
+    auto v532_tmp = MulFixedPoint15(v531, Set(d16, 13573));
+    auto v532 = Add(v532_tmp, v531);
+    auto v533 = Add(v432, v328);
+    auto v534 = Add(v329, v434);
+    auto v535 = Add(v533, v534);
+    auto v536 = Add(v535, v531);
+    auto v537 = Add(v532, v536);
+    auto v538 = MulFixedPoint15(v537, Set(d16, 17734));
+    auto v539 = Add(v528, v538);
+    auto v540 = Add(v443, v335);
+    auto v541 = Add(v336, v445);
+    auto v542 = Add(v540, v541);
+    auto v543_tmp = MulFixedPoint15(v542, Set(d16, 13573));
+    auto v543 = Add(v543_tmp, v542);
+    auto v544 = Add(v451, v339);
+    auto v545 = Add(v340, v453);
+    auto v546 = Add(v544, v545);
+    auto v547 = Add(v458, v342);
+    auto v548 = Add(v343, v460);
+    auto v549 = Add(v547, v548);
+    auto v550 = Add(v546, v549);
+    auto v551 = Add(v543, v550);
+    auto v552 = Add(v549, v542);
+    auto v553_tmp = MulFixedPoint15(v552, Set(d16, 13573));
+    auto v553 = Add(v553_tmp, v552);
+    auto v554 = Add(v469, v349);
+    auto v555 = Add(v350, v471);
+    auto v556 = Add(v554, v555);
+    auto v557 = Add(v556, v546);
+    auto v558 = Add(v557, v552);
+    auto v559 = Add(v553, v558);
+    auto v560 = MulFixedPoint15(v559, Set(d16, 17734));
+    auto v561 = Add(v551, v560);
+    auto v562 = MulFixedPoint15(v561, Set(d16, 16705));
+    auto v563 = Add(v539, v562);
+    auto v564 = Add(v446, v359);
+    auto v565 = Add(v360, v411);
+    auto v566 = Add(v564, v565);
+    auto v567_tmp = MulFixedPoint15(v566, Set(d16, 13573));
+    auto v567 = Add(v567_tmp, v566);
+    auto v568 = Add(v454, v363);
+    auto v569 = Add(v364, v415);
+    auto v570 = Add(v568, v569);
+    auto v571 = Add(v419, v366);
+    auto v572 = Add(v367, v457);
+    auto v573 = Add(v571, v572);
+    auto v574 = Add(v570, v573);
+    auto v575 = Add(v567, v574);
+    auto v576 = Add(v461, v371);
+    auto v577 = Add(v372, v423);
+    auto v578 = Add(v576, v577);
+    auto v579 = Add(v427, v374);
+    auto v580 = Add(v375, v442);
+    auto v581 = Add(v579, v580);
+    auto v582 = Add(v578, v581);
+    auto v583_tmp = MulFixedPoint15(v582, Set(d16, 13573));
+    auto v583 = Add(v583_tmp, v582);
+    auto v584 = Add(v472, v379);
+    auto v585 = Add(v380, v431);
+    auto v586 = Add(v584, v585);
+    auto v587 = Add(v435, v382);
+    auto v588 = Add(v383, v450);
+    auto v589 = Add(v587, v588);
+    auto v590 = Add(v586, v589);
+    auto v591 = Add(v590, v582);
+    auto v592 = Add(v583, v591);
+    auto v593 = MulFixedPoint15(v592, Set(d16, 17734));
+    auto v594 = Add(v575, v593);
+    auto v595 = Add(v581, v566);
+    auto v596_tmp = MulFixedPoint15(v595, Set(d16, 13573));
+    auto v596 = Add(v596_tmp, v595);
+    auto v597 = Add(v589, v570);
+    auto v598 = Add(v573, v578);
+    auto v599 = Add(v597, v598);
+    auto v600 = Add(v596, v599);
+    auto v601 = Add(v598, v595);
+    auto v602_tmp = MulFixedPoint15(v601, Set(d16, 13573));
+    auto v602 = Add(v602_tmp, v601);
+    auto v603 = Add(v508, v398);
+    auto v604 = Add(v399, v468);
+    auto v605 = Add(v603, v604);
+    auto v606 = Add(v605, v586);
+    auto v607 = Add(v606, v597);
+    auto v608 = Add(v607, v601);
+    auto v609 = Add(v602, v608);
+    auto v610 = MulFixedPoint15(v609, Set(d16, 17734));
+    auto v611 = Add(v600, v610);
+    auto v612 = MulFixedPoint15(v611, Set(d16, 16705));
+    auto v613 = Add(v594, v612);
+    auto v614 = MulFixedPoint15(v613, Set(d16, 16463));
+    auto v615 = Add(v563, v614);
+    auto v616 = Add(v565, v523);
+    auto v617_tmp = MulFixedPoint15(v616, Set(d16, 13573));
+    auto v617 = Add(v617_tmp, v616);
+    auto v618 = Add(v569, v525);
+    auto v619 = Add(v526, v571);
+    auto v620 = Add(v618, v619);
+    auto v621 = Add(v617, v620);
+    auto v622 = Add(v577, v529);
+    auto v623 = Add(v530, v579);
+    auto v624 = Add(v622, v623);
+    auto v625_tmp = MulFixedPoint15(v624, Set(d16, 13573));
+    auto v625 = Add(v625_tmp, v624);
+    auto v626 = Add(v585, v533);
+    auto v627 = Add(v534, v587);
+    auto v628 = Add(v626, v627);
+    auto v629 = Add(v628, v624);
+    auto v630 = Add(v625, v629);
+    auto v631 = MulFixedPoint15(v630, Set(d16, 17734));
+    auto v632 = Add(v621, v631);
+    auto v633 = Add(v580, v540);
+    auto v634 = Add(v541, v564);
+    auto v635 = Add(v633, v634);
+    auto v636_tmp = MulFixedPoint15(v635, Set(d16, 13573));
+    auto v636 = Add(v636_tmp, v635);
+    auto v637 = Add(v588, v544);
+    auto v638 = Add(v545, v568);
+    auto v639 = Add(v637, v638);
+    auto v640 = Add(v572, v547);
+    auto v641 = Add(v548, v576);
+    auto v642 = Add(v640, v641);
+    auto v643 = Add(v639, v642);
+    auto v644 = Add(v636, v643);
+    auto v645 = Add(v642, v635);
+    auto v646_tmp = MulFixedPoint15(v645, Set(d16, 13573));
+    auto v646 = Add(v646_tmp, v645);
+    auto v647 = Add(v604, v554);
+    auto v648 = Add(v555, v584);
+    auto v649 = Add(v647, v648);
+    auto v650 = Add(v649, v639);
+    auto v651 = Add(v650, v645);
+    auto v652 = Add(v646, v651);
+    auto v653 = MulFixedPoint15(v652, Set(d16, 17734));
+    auto v654 = Add(v644, v653);
+    auto v655 = MulFixedPoint15(v654, Set(d16, 16705));
+    auto v656 = Add(v632, v655);
+    auto v657 = Add(v634, v616);
+    auto v658_tmp = MulFixedPoint15(v657, Set(d16, 13573));
+    auto v658 = Add(v658_tmp, v657);
+    auto v659 = Add(v638, v618);
+    auto v660 = Add(v619, v640);
+    auto v661 = Add(v659, v660);
+    auto v662 = Add(v658, v661);
+    auto v663 = Add(v641, v622);
+    auto v664 = Add(v623, v633);
+    auto v665 = Add(v663, v664);
+    auto v666_tmp = MulFixedPoint15(v665, Set(d16, 13573));
+    auto v666 = Add(v666_tmp, v665);
+    auto v667 = Add(v648, v626);
+    auto v668 = Add(v627, v637);
+    auto v669 = Add(v667, v668);
+    auto v670 = Add(v669, v665);
+    auto v671 = Add(v666, v670);
+    auto v672 = MulFixedPoint15(v671, Set(d16, 17734));
+    auto v673 = Add(v662, v672);
+    auto v674 = Add(v664, v657);
+    auto v675_tmp = MulFixedPoint15(v674, Set(d16, 13573));
+    auto v675 = Add(v675_tmp, v674);
+    auto v676 = Add(v668, v659);
+    auto v677 = Add(v660, v663);
+    auto v678 = Add(v676, v677);
+    auto v679 = Add(v675, v678);
+    auto v680 = Add(v677, v674);
+    auto v681_tmp = MulFixedPoint15(v680, Set(d16, 13573));
+    auto v681 = Add(v681_tmp, v680);
+    auto v682 = LoadU(d16, in + in_stride * 254 + i);
+    auto v683 = Add(v682, v507);
+    auto v684 = Add(v683, v603);
+    auto v685 = Add(v684, v647);
+    auto v686 = Add(v685, v667);
+    auto v687 = Add(v686, v676);
+    auto v688 = Add(v687, v680);
+    auto v689 = Add(v681, v688);
+    auto v690 = MulFixedPoint15(v689, Set(d16, 17734));
+    auto v691 = Add(v679, v690);
+    auto v692 = MulFixedPoint15(v691, Set(d16, 16705));
+    auto v693 = Add(v673, v692);
+    auto v694 = MulFixedPoint15(v693, Set(d16, 16463));
+    auto v695 = Add(v656, v694);
+    auto v696 = MulFixedPoint15(v695, Set(d16, 16404));
+    auto v697 = Add(v615, v696);
+    auto v698 = MulFixedPoint15(v697, Set(d16, 16389));
+    auto v699 = Add(v522, v698);
+    auto v700 = MulFixedPoint15(v699, Set(d16, 16385));
+    auto v701 = Add(v317, v700);
+    auto v702 = LoadU(d16, in + in_stride * 1 + i);
+    auto v703_tmp = MulFixedPoint15(v702, Set(d16, 13573));
+    auto v703 = Add(v703_tmp, v702);
+    auto v704 = LoadU(d16, in + in_stride * 129 + i);
+    auto v705 = LoadU(d16, in + in_stride * 127 + i);
+    auto v706 = Add(v704, v705);
+    auto v707 = Add(v703, v706);
+    auto v708 = LoadU(d16, in + in_stride * 65 + i);
+    auto v709 = LoadU(d16, in + in_stride * 63 + i);
+    auto v710 = Add(v708, v709);
+    auto v711_tmp = MulFixedPoint15(v710, Set(d16, 13573));
+    auto v711 = Add(v711_tmp, v710);
+    auto v712 = LoadU(d16, in + in_stride * 193 + i);
+    auto v713 = LoadU(d16, in + in_stride * 191 + i);
+    auto v714 = Add(v712, v713);
+    auto v715 = Add(v714, v710);
+    auto v716 = Add(v711, v715);
+    auto v717 = MulFixedPoint15(v716, Set(d16, 17734));
+    auto v718 = Add(v707, v717);
+    auto v719 = LoadU(d16, in + in_stride * 33 + i);
+    auto v720 = LoadU(d16, in + in_stride * 31 + i);
+    auto v721 = Add(v719, v720);
+    auto v722_tmp = MulFixedPoint15(v721, Set(d16, 13573));
+    auto v722 = Add(v722_tmp, v721);
+    auto v723 = LoadU(d16, in + in_stride * 161 + i);
+    auto v724 = LoadU(d16, in + in_stride * 159 + i);
+    auto v725 = Add(v723, v724);
+    auto v726 = LoadU(d16, in + in_stride * 97 + i);
+    auto v727 = LoadU(d16, in + in_stride * 95 + i);
+    auto v728 = Add(v726, v727);
+    auto v729 = Add(v725, v728);
+    auto v730 = Add(v722, v729);
+    auto v731 = Add(v728, v721);
+    auto v732_tmp = MulFixedPoint15(v731, Set(d16, 13573));
+    auto v732 = Add(v732_tmp, v731);
+    auto v733 = LoadU(d16, in + in_stride * 225 + i);
+    auto v734 = LoadU(d16, in + in_stride * 223 + i);
+    auto v735 = Add(v733, v734);
+    auto v736 = Add(v735, v725);
+    auto v737 = Add(v736, v731);
+    auto v738 = Add(v732, v737);
+    auto v739 = MulFixedPoint15(v738, Set(d16, 17734));
+    auto v740 = Add(v730, v739);
+    auto v741 = MulFixedPoint15(v740, Set(d16, 16705));
+    auto v742 = Add(v718, v741);
+    auto v743 = LoadU(d16, in + in_stride * 17 + i);
+    auto v744 = LoadU(d16, in + in_stride * 15 + i);
+    auto v745 = Add(v743, v744);
+    auto v746_tmp = MulFixedPoint15(v745, Set(d16, 13573));
+    auto v746 = Add(v746_tmp, v745);
+    auto v747 = LoadU(d16, in + in_stride * 145 + i);
+    auto v748 = LoadU(d16, in + in_stride * 143 + i);
+    auto v749 = Add(v747, v748);
+    auto v750 = LoadU(d16, in + in_stride * 113 + i);
+    auto v751 = LoadU(d16, in + in_stride * 111 + i);
+    auto v752 = Add(v750, v751);
+    auto v753 = Add(v749, v752);
+    auto v754 = Add(v746, v753);
+    auto v755 = LoadU(d16, in + in_stride * 81 + i);
+    auto v756 = LoadU(d16, in + in_stride * 79 + i);
+    auto v757 = Add(v755, v756);
+    auto v758 = LoadU(d16, in + in_stride * 49 + i);
+    auto v759 = LoadU(d16, in + in_stride * 47 + i);
+    auto v760 = Add(v758, v759);
+    auto v761 = Add(v757, v760);
+    auto v762_tmp = MulFixedPoint15(v761, Set(d16, 13573));
+    auto v762 = Add(v762_tmp, v761);
+    auto v763 = LoadU(d16, in + in_stride * 209 + i);
+    auto v764 = LoadU(d16, in + in_stride * 207 + i);
+    auto v765 = Add(v763, v764);
+    auto v766 = LoadU(d16, in + in_stride * 177 + i);
+    auto v767 = LoadU(d16, in + in_stride * 175 + i);
+    auto v768 = Add(v766, v767);
+    auto v769 = Add(v765, v768);
+    auto v770 = Add(v769, v761);
+    auto v771 = Add(v762, v770);
+    auto v772 = MulFixedPoint15(v771, Set(d16, 17734));
+    auto v773 = Add(v754, v772);
+    auto v774 = Add(v760, v745);
+    auto v775_tmp = MulFixedPoint15(v774, Set(d16, 13573));
+    auto v775 = Add(v775_tmp, v774);
+    auto v776 = Add(v768, v749);
+    auto v777 = Add(v752, v757);
+    auto v778 = Add(v776, v777);
+    auto v779 = Add(v775, v778);
+    auto v780 = Add(v777, v774);
+    auto v781_tmp = MulFixedPoint15(v780, Set(d16, 13573));
+    auto v781 = Add(v781_tmp, v780);
+    auto v782 = LoadU(d16, in + in_stride * 241 + i);
+    auto v783 = LoadU(d16, in + in_stride * 239 + i);
+    auto v784 = Add(v782, v783);
+    auto v785 = Add(v784, v765);
+    auto v786 = Add(v785, v776);
+    auto v787 = Add(v786, v780);
+    auto v788 = Add(v781, v787);
+    auto v789 = MulFixedPoint15(v788, Set(d16, 17734));
+    auto v790 = Add(v779, v789);
+    auto v791 = MulFixedPoint15(v790, Set(d16, 16705));
+    auto v792 = Add(v773, v791);
+    auto v793 = MulFixedPoint15(v792, Set(d16, 16463));
+    auto v794 = Add(v742, v793);
+    auto v795 = LoadU(d16, in + in_stride * 9 + i);
+    auto v796 = LoadU(d16, in + in_stride * 7 + i);
+    auto v797 = Add(v795, v796);
+    auto v798_tmp = MulFixedPoint15(v797, Set(d16, 13573));
+    auto v798 = Add(v798_tmp, v797);
+    auto v799 = LoadU(d16, in + in_stride * 137 + i);
+    auto v800 = LoadU(d16, in + in_stride * 135 + i);
+    auto v801 = Add(v799, v800);
+    auto v802 = LoadU(d16, in + in_stride * 121 + i);
+    auto v803 = LoadU(d16, in + in_stride * 119 + i);
+    auto v804 = Add(v802, v803);
+    auto v805 = Add(v801, v804);
+    auto v806 = Add(v798, v805);
+    auto v807 = LoadU(d16, in + in_stride * 73 + i);
+    auto v808 = LoadU(d16, in + in_stride * 71 + i);
+    auto v809 = Add(v807, v808);
+    auto v810 = LoadU(d16, in + in_stride * 57 + i);
+    auto v811 = LoadU(d16, in + in_stride * 55 + i);
+    auto v812 = Add(v810, v811);
+    auto v813 = Add(v809, v812);
+    auto v814_tmp = MulFixedPoint15(v813, Set(d16, 13573));
+    auto v814 = Add(v814_tmp, v813);
+    auto v815 = LoadU(d16, in + in_stride * 201 + i);
+    auto v816 = LoadU(d16, in + in_stride * 199 + i);
+    auto v817 = Add(v815, v816);
+    auto v818 = LoadU(d16, in + in_stride * 185 + i);
+    auto v819 = LoadU(d16, in + in_stride * 183 + i);
+    auto v820 = Add(v818, v819);
+    auto v821 = Add(v817, v820);
+    auto v822 = Add(v821, v813);
+    auto v823 = Add(v814, v822);
+    auto v824 = MulFixedPoint15(v823, Set(d16, 17734));
+    auto v825 = Add(v806, v824);
+    auto v826 = LoadU(d16, in + in_stride * 41 + i);
+    auto v827 = LoadU(d16, in + in_stride * 39 + i);
+    auto v828 = Add(v826, v827);
+    auto v829 = LoadU(d16, in + in_stride * 25 + i);
+    auto v830 = LoadU(d16, in + in_stride * 23 + i);
+    auto v831 = Add(v829, v830);
+    auto v832 = Add(v828, v831);
+    auto v833_tmp = MulFixedPoint15(v832, Set(d16, 13573));
+    auto v833 = Add(v833_tmp, v832);
+    auto v834 = LoadU(d16, in + in_stride * 169 + i);
+    auto v835 = LoadU(d16, in + in_stride * 167 + i);
+    auto v836 = Add(v834, v835);
+    auto v837 = LoadU(d16, in + in_stride * 153 + i);
+    auto v838 = LoadU(d16, in + in_stride * 151 + i);
+    auto v839 = Add(v837, v838);
+    auto v840 = Add(v836, v839);
+    auto v841 = LoadU(d16, in + in_stride * 105 + i);
+    auto v842 = LoadU(d16, in + in_stride * 103 + i);
+    auto v843 = Add(v841, v842);
+    auto v844 = LoadU(d16, in + in_stride * 89 + i);
+    auto v845 = LoadU(d16, in + in_stride * 87 + i);
+    auto v846 = Add(v844, v845);
+    auto v847 = Add(v843, v846);
+    auto v848 = Add(v840, v847);
+    auto v849 = Add(v833, v848);
+    auto v850 = Add(v847, v832);
+    auto v851_tmp = MulFixedPoint15(v850, Set(d16, 13573));
+    auto v851 = Add(v851_tmp, v850);
+    auto v852 = LoadU(d16, in + in_stride * 233 + i);
+    auto v853 = LoadU(d16, in + in_stride * 231 + i);
+    auto v854 = Add(v852, v853);
+    auto v855 = LoadU(d16, in + in_stride * 217 + i);
+    auto v856 = LoadU(d16, in + in_stride * 215 + i);
+    auto v857 = Add(v855, v856);
+    auto v858 = Add(v854, v857);
+    auto v859 = Add(v858, v840);
+    auto v860 = Add(v859, v850);
+    auto v861 = Add(v851, v860);
+    auto v862 = MulFixedPoint15(v861, Set(d16, 17734));
+    auto v863 = Add(v849, v862);
+    auto v864 = MulFixedPoint15(v863, Set(d16, 16705));
+    auto v865 = Add(v825, v864);
+    auto v866 = Add(v831, v797);
+    auto v867_tmp = MulFixedPoint15(v866, Set(d16, 13573));
+    auto v867 = Add(v867_tmp, v866);
+    auto v868 = Add(v839, v801);
+    auto v869 = Add(v804, v843);
+    auto v870 = Add(v868, v869);
+    auto v871 = Add(v867, v870);
+    auto v872 = Add(v846, v809);
+    auto v873 = Add(v812, v828);
+    auto v874 = Add(v872, v873);
+    auto v875_tmp = MulFixedPoint15(v874, Set(d16, 13573));
+    auto v875 = Add(v875_tmp, v874);
+    auto v876 = Add(v857, v817);
+    auto v877 = Add(v820, v836);
+    auto v878 = Add(v876, v877);
+    auto v879 = Add(v878, v874);
+    auto v880 = Add(v875, v879);
+    auto v881 = MulFixedPoint15(v880, Set(d16, 17734));
+    auto v882 = Add(v871, v881);
+    auto v883 = Add(v873, v866);
+    auto v884_tmp = MulFixedPoint15(v883, Set(d16, 13573));
+    auto v884 = Add(v884_tmp, v883);
+    auto v885 = Add(v877, v868);
+    auto v886 = Add(v869, v872);
+    auto v887 = Add(v885, v886);
+    auto v888 = Add(v884, v887);
+    auto v889 = Add(v886, v883);
+    auto v890_tmp = MulFixedPoint15(v889, Set(d16, 13573));
+    auto v890 = Add(v890_tmp, v889);
+    auto v891 = LoadU(d16, in + in_stride * 249 + i);
+    auto v892 = LoadU(d16, in + in_stride * 247 + i);
+    auto v893 = Add(v891, v892);
+    auto v894 = Add(v893, v854);
+    auto v895 = Add(v894, v876);
+    auto v896 = Add(v895, v885);
+    auto v897 = Add(v896, v889);
+    auto v898 = Add(v890, v897);
+    auto v899 = MulFixedPoint15(v898, Set(d16, 17734));
+    auto v900 = Add(v888, v899);
+    auto v901 = MulFixedPoint15(v900, Set(d16, 16705));
+    auto v902 = Add(v882, v901);
+    auto v903 = MulFixedPoint15(v902, Set(d16, 16463));
+    auto v904 = Add(v865, v903);
+    auto v905 = MulFixedPoint15(v904, Set(d16, 16404));
+    auto v906 = Add(v794, v905);
+    auto v907 = LoadU(d16, in + in_stride * 5 + i);
+    auto v908 = LoadU(d16, in + in_stride * 3 + i);
+    auto v909 = Add(v907, v908);
+    auto v910_tmp = MulFixedPoint15(v909, Set(d16, 13573));
+    auto v910 = Add(v910_tmp, v909);
+    auto v911 = LoadU(d16, in + in_stride * 133 + i);
+    auto v912 = LoadU(d16, in + in_stride * 131 + i);
+    auto v913 = Add(v911, v912);
+    auto v914 = LoadU(d16, in + in_stride * 125 + i);
+    auto v915 = LoadU(d16, in + in_stride * 123 + i);
+    auto v916 = Add(v914, v915);
+    auto v917 = Add(v913, v916);
+    auto v918 = Add(v910, v917);
+    auto v919 = LoadU(d16, in + in_stride * 69 + i);
+    auto v920 = LoadU(d16, in + in_stride * 67 + i);
+    auto v921 = Add(v919, v920);
+    auto v922 = LoadU(d16, in + in_stride * 61 + i);
+    auto v923 = LoadU(d16, in + in_stride * 59 + i);
+    auto v924 = Add(v922, v923);
+    auto v925 = Add(v921, v924);
+    auto v926_tmp = MulFixedPoint15(v925, Set(d16, 13573));
+    auto v926 = Add(v926_tmp, v925);
+    auto v927 = LoadU(d16, in + in_stride * 197 + i);
+    auto v928 = LoadU(d16, in + in_stride * 195 + i);
+    auto v929 = Add(v927, v928);
+    auto v930 = LoadU(d16, in + in_stride * 189 + i);
+    auto v931 = LoadU(d16, in + in_stride * 187 + i);
+    auto v932 = Add(v930, v931);
+    auto v933 = Add(v929, v932);
+    auto v934 = Add(v933, v925);
+    auto v935 = Add(v926, v934);
+    auto v936 = MulFixedPoint15(v935, Set(d16, 17734));
+    auto v937 = Add(v918, v936);
+    auto v938 = LoadU(d16, in + in_stride * 37 + i);
+    auto v939 = LoadU(d16, in + in_stride * 35 + i);
+    auto v940 = Add(v938, v939);
+    auto v941 = LoadU(d16, in + in_stride * 29 + i);
+    auto v942 = LoadU(d16, in + in_stride * 27 + i);
+    auto v943 = Add(v941, v942);
+    auto v944 = Add(v940, v943);
+    auto v945_tmp = MulFixedPoint15(v944, Set(d16, 13573));
+    auto v945 = Add(v945_tmp, v944);
+    auto v946 = LoadU(d16, in + in_stride * 165 + i);
+    auto v947 = LoadU(d16, in + in_stride * 163 + i);
+    auto v948 = Add(v946, v947);
+    auto v949 = LoadU(d16, in + in_stride * 157 + i);
+    auto v950 = LoadU(d16, in + in_stride * 155 + i);
+    auto v951 = Add(v949, v950);
+    auto v952 = Add(v948, v951);
+    auto v953 = LoadU(d16, in + in_stride * 101 + i);
+    auto v954 = LoadU(d16, in + in_stride * 99 + i);
+    auto v955 = Add(v953, v954);
+    auto v956 = LoadU(d16, in + in_stride * 93 + i);
+    auto v957 = LoadU(d16, in + in_stride * 91 + i);
+    auto v958 = Add(v956, v957);
+    auto v959 = Add(v955, v958);
+    auto v960 = Add(v952, v959);
+    auto v961 = Add(v945, v960);
+    auto v962 = Add(v959, v944);
+    auto v963_tmp = MulFixedPoint15(v962, Set(d16, 13573));
+    auto v963 = Add(v963_tmp, v962);
+    auto v964 = LoadU(d16, in + in_stride * 229 + i);
+    auto v965 = LoadU(d16, in + in_stride * 227 + i);
+    auto v966 = Add(v964, v965);
+    auto v967 = LoadU(d16, in + in_stride * 221 + i);
+    auto v968 = LoadU(d16, in + in_stride * 219 + i);
+    auto v969 = Add(v967, v968);
+    auto v970 = Add(v966, v969);
+    auto v971 = Add(v970, v952);
+    auto v972 = Add(v971, v962);
+    auto v973 = Add(v963, v972);
+    auto v974 = MulFixedPoint15(v973, Set(d16, 17734));
+    auto v975 = Add(v961, v974);
+    auto v976 = MulFixedPoint15(v975, Set(d16, 16705));
+    auto v977 = Add(v937, v976);
+    auto v978 = LoadU(d16, in + in_stride * 21 + i);
+    auto v979 = LoadU(d16, in + in_stride * 19 + i);
+    auto v980 = Add(v978, v979);
+    auto v981 = LoadU(d16, in + in_stride * 13 + i);
+    auto v982 = LoadU(d16, in + in_stride * 11 + i);
+    auto v983 = Add(v981, v982);
+    auto v984 = Add(v980, v983);
+    auto v985_tmp = MulFixedPoint15(v984, Set(d16, 13573));
+    auto v985 = Add(v985_tmp, v984);
+    auto v986 = LoadU(d16, in + in_stride * 149 + i);
+    auto v987 = LoadU(d16, in + in_stride * 147 + i);
+    auto v988 = Add(v986, v987);
+    auto v989 = LoadU(d16, in + in_stride * 141 + i);
+    auto v990 = LoadU(d16, in + in_stride * 139 + i);
+    auto v991 = Add(v989, v990);
+    auto v992 = Add(v988, v991);
+    auto v993 = LoadU(d16, in + in_stride * 117 + i);
+    auto v994 = LoadU(d16, in + in_stride * 115 + i);
+    auto v995 = Add(v993, v994);
+    auto v996 = LoadU(d16, in + in_stride * 109 + i);
+    auto v997 = LoadU(d16, in + in_stride * 107 + i);
+    auto v998 = Add(v996, v997);
+    auto v999 = Add(v995, v998);
+    auto v1000 = Add(v992, v999);
+    auto v1001 = Add(v985, v1000);
+    auto v1002 = LoadU(d16, in + in_stride * 85 + i);
+    auto v1003 = LoadU(d16, in + in_stride * 83 + i);
+    auto v1004 = Add(v1002, v1003);
+    auto v1005 = LoadU(d16, in + in_stride * 77 + i);
+    auto v1006 = LoadU(d16, in + in_stride * 75 + i);
+    auto v1007 = Add(v1005, v1006);
+    auto v1008 = Add(v1004, v1007);
+    auto v1009 = LoadU(d16, in + in_stride * 53 + i);
+    auto v1010 = LoadU(d16, in + in_stride * 51 + i);
+    auto v1011 = Add(v1009, v1010);
+    auto v1012 = LoadU(d16, in + in_stride * 45 + i);
+    auto v1013 = LoadU(d16, in + in_stride * 43 + i);
+    auto v1014 = Add(v1012, v1013);
+    auto v1015 = Add(v1011, v1014);
+    auto v1016 = Add(v1008, v1015);
+    auto v1017_tmp = MulFixedPoint15(v1016, Set(d16, 13573));
+    auto v1017 = Add(v1017_tmp, v1016);
+    auto v1018 = LoadU(d16, in + in_stride * 213 + i);
+    auto v1019 = LoadU(d16, in + in_stride * 211 + i);
+    auto v1020 = Add(v1018, v1019);
+    auto v1021 = LoadU(d16, in + in_stride * 205 + i);
+    auto v1022 = LoadU(d16, in + in_stride * 203 + i);
+    auto v1023 = Add(v1021, v1022);
+    auto v1024 = Add(v1020, v1023);
+    auto v1025 = LoadU(d16, in + in_stride * 181 + i);
+    auto v1026 = LoadU(d16, in + in_stride * 179 + i);
+    auto v1027 = Add(v1025, v1026);
+    auto v1028 = LoadU(d16, in + in_stride * 173 + i);
+    auto v1029 = LoadU(d16, in + in_stride * 171 + i);
+    auto v1030 = Add(v1028, v1029);
+    auto v1031 = Add(v1027, v1030);
+    auto v1032 = Add(v1024, v1031);
+    auto v1033 = Add(v1032, v1016);
+    auto v1034 = Add(v1017, v1033);
+    auto v1035 = MulFixedPoint15(v1034, Set(d16, 17734));
+    auto v1036 = Add(v1001, v1035);
+    auto v1037 = Add(v1015, v984);
+    auto v1038_tmp = MulFixedPoint15(v1037, Set(d16, 13573));
+    auto v1038 = Add(v1038_tmp, v1037);
+    auto v1039 = Add(v1031, v992);
+    auto v1040 = Add(v999, v1008);
+    auto v1041 = Add(v1039, v1040);
+    auto v1042 = Add(v1038, v1041);
+    auto v1043 = Add(v1040, v1037);
+    auto v1044_tmp = MulFixedPoint15(v1043, Set(d16, 13573));
+    auto v1044 = Add(v1044_tmp, v1043);
+    auto v1045 = LoadU(d16, in + in_stride * 245 + i);
+    auto v1046 = LoadU(d16, in + in_stride * 243 + i);
+    auto v1047 = Add(v1045, v1046);
+    auto v1048 = LoadU(d16, in + in_stride * 237 + i);
+    auto v1049 = LoadU(d16, in + in_stride * 235 + i);
+    auto v1050 = Add(v1048, v1049);
+    auto v1051 = Add(v1047, v1050);
+    auto v1052 = Add(v1051, v1024);
+    auto v1053 = Add(v1052, v1039);
+    auto v1054 = Add(v1053, v1043);
+    auto v1055 = Add(v1044, v1054);
+    auto v1056 = MulFixedPoint15(v1055, Set(d16, 17734));
+    auto v1057 = Add(v1042, v1056);
+    auto v1058 = MulFixedPoint15(v1057, Set(d16, 16705));
+    auto v1059 = Add(v1036, v1058);
+    auto v1060 = MulFixedPoint15(v1059, Set(d16, 16463));
+    auto v1061 = Add(v977, v1060);
+    auto v1062 = Add(v983, v909);
+    auto v1063_tmp = MulFixedPoint15(v1062, Set(d16, 13573));
+    auto v1063 = Add(v1063_tmp, v1062);
+    auto v1064 = Add(v991, v913);
+    auto v1065 = Add(v916, v995);
+    auto v1066 = Add(v1064, v1065);
+    auto v1067 = Add(v1063, v1066);
+    auto v1068 = Add(v1007, v921);
+    auto v1069 = Add(v924, v1011);
+    auto v1070 = Add(v1068, v1069);
+    auto v1071_tmp = MulFixedPoint15(v1070, Set(d16, 13573));
+    auto v1071 = Add(v1071_tmp, v1070);
+    auto v1072 = Add(v1023, v929);
+    auto v1073 = Add(v932, v1027);
+    auto v1074 = Add(v1072, v1073);
+    auto v1075 = Add(v1074, v1070);
+    auto v1076 = Add(v1071, v1075);
+    auto v1077 = MulFixedPoint15(v1076, Set(d16, 17734));
+    auto v1078 = Add(v1067, v1077);
+    auto v1079 = Add(v1014, v940);
+    auto v1080 = Add(v943, v980);
+    auto v1081 = Add(v1079, v1080);
+    auto v1082_tmp = MulFixedPoint15(v1081, Set(d16, 13573));
+    auto v1082 = Add(v1082_tmp, v1081);
+    auto v1083 = Add(v1030, v948);
+    auto v1084 = Add(v951, v988);
+    auto v1085 = Add(v1083, v1084);
+    auto v1086 = Add(v998, v955);
+    auto v1087 = Add(v958, v1004);
+    auto v1088 = Add(v1086, v1087);
+    auto v1089 = Add(v1085, v1088);
+    auto v1090 = Add(v1082, v1089);
+    auto v1091 = Add(v1088, v1081);
+    auto v1092_tmp = MulFixedPoint15(v1091, Set(d16, 13573));
+    auto v1092 = Add(v1092_tmp, v1091);
+    auto v1093 = Add(v1050, v966);
+    auto v1094 = Add(v969, v1020);
+    auto v1095 = Add(v1093, v1094);
+    auto v1096 = Add(v1095, v1085);
+    auto v1097 = Add(v1096, v1091);
+    auto v1098 = Add(v1092, v1097);
+    auto v1099 = MulFixedPoint15(v1098, Set(d16, 17734));
+    auto v1100 = Add(v1090, v1099);
+    auto v1101 = MulFixedPoint15(v1100, Set(d16, 16705));
+    auto v1102 = Add(v1078, v1101);
+    auto v1103 = Add(v1080, v1062);
+    auto v1104_tmp = MulFixedPoint15(v1103, Set(d16, 13573));
+    auto v1104 = Add(v1104_tmp, v1103);
+    auto v1105 = Add(v1084, v1064);
+    auto v1106 = Add(v1065, v1086);
+    auto v1107 = Add(v1105, v1106);
+    auto v1108 = Add(v1104, v1107);
+    auto v1109 = Add(v1087, v1068);
+    auto v1110 = Add(v1069, v1079);
+    auto v1111 = Add(v1109, v1110);
+    auto v1112_tmp = MulFixedPoint15(v1111, Set(d16, 13573));
+    auto v1112 = Add(v1112_tmp, v1111);
+    auto v1113 = Add(v1094, v1072);
+    auto v1114 = Add(v1073, v1083);
+    auto v1115 = Add(v1113, v1114);
+    auto v1116 = Add(v1115, v1111);
+    auto v1117 = Add(v1112, v1116);
+    auto v1118 = MulFixedPoint15(v1117, Set(d16, 17734));
+    auto v1119 = Add(v1108, v1118);
+    auto v1120 = Add(v1110, v1103);
+    auto v1121_tmp = MulFixedPoint15(v1120, Set(d16, 13573));
+    auto v1121 = Add(v1121_tmp, v1120);
+    auto v1122 = Add(v1114, v1105);
+    auto v1123 = Add(v1106, v1109);
+    auto v1124 = Add(v1122, v1123);
+    auto v1125 = Add(v1121, v1124);
+    auto v1126 = Add(v1123, v1120);
+    auto v1127_tmp = MulFixedPoint15(v1126, Set(d16, 13573));
+    auto v1127 = Add(v1127_tmp, v1126);
+    auto v1128 = LoadU(d16, in + in_stride * 253 + i);
+    auto v1129 = LoadU(d16, in + in_stride * 251 + i);
+    auto v1130 = Add(v1128, v1129);
+    auto v1131 = Add(v1130, v1047);
+    auto v1132 = Add(v1131, v1093);
+    auto v1133 = Add(v1132, v1113);
+    auto v1134 = Add(v1133, v1122);
+    auto v1135 = Add(v1134, v1126);
+    auto v1136 = Add(v1127, v1135);
+    auto v1137 = MulFixedPoint15(v1136, Set(d16, 17734));
+    auto v1138 = Add(v1125, v1137);
+    auto v1139 = MulFixedPoint15(v1138, Set(d16, 16705));
+    auto v1140 = Add(v1119, v1139);
+    auto v1141 = MulFixedPoint15(v1140, Set(d16, 16463));
+    auto v1142 = Add(v1102, v1141);
+    auto v1143 = MulFixedPoint15(v1142, Set(d16, 16404));
+    auto v1144 = Add(v1061, v1143);
+    auto v1145 = MulFixedPoint15(v1144, Set(d16, 16389));
+    auto v1146 = Add(v906, v1145);
+    auto v1147 = Add(v908, v702);
+    auto v1148_tmp = MulFixedPoint15(v1147, Set(d16, 13573));
+    auto v1148 = Add(v1148_tmp, v1147);
+    auto v1149 = Add(v912, v704);
+    auto v1150 = Add(v705, v914);
+    auto v1151 = Add(v1149, v1150);
+    auto v1152 = Add(v1148, v1151);
+    auto v1153 = Add(v920, v708);
+    auto v1154 = Add(v709, v922);
+    auto v1155 = Add(v1153, v1154);
+    auto v1156_tmp = MulFixedPoint15(v1155, Set(d16, 13573));
+    auto v1156 = Add(v1156_tmp, v1155);
+    auto v1157 = Add(v928, v712);
+    auto v1158 = Add(v713, v930);
+    auto v1159 = Add(v1157, v1158);
+    auto v1160 = Add(v1159, v1155);
+    auto v1161 = Add(v1156, v1160);
+    auto v1162 = MulFixedPoint15(v1161, Set(d16, 17734));
+    auto v1163 = Add(v1152, v1162);
+    auto v1164 = Add(v939, v719);
+    auto v1165 = Add(v720, v941);
+    auto v1166 = Add(v1164, v1165);
+    auto v1167_tmp = MulFixedPoint15(v1166, Set(d16, 13573));
+    auto v1167 = Add(v1167_tmp, v1166);
+    auto v1168 = Add(v947, v723);
+    auto v1169 = Add(v724, v949);
+    auto v1170 = Add(v1168, v1169);
+    auto v1171 = Add(v954, v726);
+    auto v1172 = Add(v727, v956);
+    auto v1173 = Add(v1171, v1172);
+    auto v1174 = Add(v1170, v1173);
+    auto v1175 = Add(v1167, v1174);
+    auto v1176 = Add(v1173, v1166);
+    auto v1177_tmp = MulFixedPoint15(v1176, Set(d16, 13573));
+    auto v1177 = Add(v1177_tmp, v1176);
+    auto v1178 = Add(v965, v733);
+    auto v1179 = Add(v734, v967);
+    auto v1180 = Add(v1178, v1179);
+    auto v1181 = Add(v1180, v1170);
+    auto v1182 = Add(v1181, v1176);
+    auto v1183 = Add(v1177, v1182);
+    auto v1184 = MulFixedPoint15(v1183, Set(d16, 17734));
+    auto v1185 = Add(v1175, v1184);
+    auto v1186 = MulFixedPoint15(v1185, Set(d16, 16705));
+    auto v1187 = Add(v1163, v1186);
+    auto v1188 = Add(v979, v743);
+    auto v1189 = Add(v744, v981);
+    auto v1190 = Add(v1188, v1189);
+    auto v1191_tmp = MulFixedPoint15(v1190, Set(d16, 13573));
+    auto v1191 = Add(v1191_tmp, v1190);
+    auto v1192 = Add(v987, v747);
+    auto v1193 = Add(v748, v989);
+    auto v1194 = Add(v1192, v1193);
+    auto v1195 = Add(v994, v750);
+    auto v1196 = Add(v751, v996);
+    auto v1197 = Add(v1195, v1196);
+    auto v1198 = Add(v1194, v1197);
+    auto v1199 = Add(v1191, v1198);
+    auto v1200 = Add(v1003, v755);
+    auto v1201 = Add(v756, v1005);
+    auto v1202 = Add(v1200, v1201);
+    auto v1203 = Add(v1010, v758);
+    auto v1204 = Add(v759, v1012);
+    auto v1205 = Add(v1203, v1204);
+    auto v1206 = Add(v1202, v1205);
+    auto v1207_tmp = MulFixedPoint15(v1206, Set(d16, 13573));
+    auto v1207 = Add(v1207_tmp, v1206);
+    auto v1208 = Add(v1019, v763);
+    auto v1209 = Add(v764, v1021);
+    auto v1210 = Add(v1208, v1209);
+    auto v1211 = Add(v1026, v766);
+    auto v1212 = Add(v767, v1028);
+    auto v1213 = Add(v1211, v1212);
+    auto v1214 = Add(v1210, v1213);
+    auto v1215 = Add(v1214, v1206);
+    auto v1216 = Add(v1207, v1215);
+    auto v1217 = MulFixedPoint15(v1216, Set(d16, 17734));
+    auto v1218 = Add(v1199, v1217);
+    auto v1219 = Add(v1205, v1190);
+    auto v1220_tmp = MulFixedPoint15(v1219, Set(d16, 13573));
+    auto v1220 = Add(v1220_tmp, v1219);
+    auto v1221 = Add(v1213, v1194);
+    auto v1222 = Add(v1197, v1202);
+    auto v1223 = Add(v1221, v1222);
+    auto v1224 = Add(v1220, v1223);
+    auto v1225 = Add(v1222, v1219);
+    auto v1226_tmp = MulFixedPoint15(v1225, Set(d16, 13573));
+    auto v1226 = Add(v1226_tmp, v1225);
+    auto v1227 = Add(v1046, v782);
+    auto v1228 = Add(v783, v1048);
+    auto v1229 = Add(v1227, v1228);
+    auto v1230 = Add(v1229, v1210);
+    auto v1231 = Add(v1230, v1221);
+    auto v1232 = Add(v1231, v1225);
+    auto v1233 = Add(v1226, v1232);
+    auto v1234 = MulFixedPoint15(v1233, Set(d16, 17734));
+    auto v1235 = Add(v1224, v1234);
+    auto v1236 = MulFixedPoint15(v1235, Set(d16, 16705));
+    auto v1237 = Add(v1218, v1236);
+    auto v1238 = MulFixedPoint15(v1237, Set(d16, 16463));
+    auto v1239 = Add(v1187, v1238);
+    auto v1240 = Add(v982, v795);
+    auto v1241 = Add(v796, v907);
+    auto v1242 = Add(v1240, v1241);
+    auto v1243_tmp = MulFixedPoint15(v1242, Set(d16, 13573));
+    auto v1243 = Add(v1243_tmp, v1242);
+    auto v1244 = Add(v990, v799);
+    auto v1245 = Add(v800, v911);
+    auto v1246 = Add(v1244, v1245);
+    auto v1247 = Add(v915, v802);
+    auto v1248 = Add(v803, v993);
+    auto v1249 = Add(v1247, v1248);
+    auto v1250 = Add(v1246, v1249);
+    auto v1251 = Add(v1243, v1250);
+    auto v1252 = Add(v1006, v807);
+    auto v1253 = Add(v808, v919);
+    auto v1254 = Add(v1252, v1253);
+    auto v1255 = Add(v923, v810);
+    auto v1256 = Add(v811, v1009);
+    auto v1257 = Add(v1255, v1256);
+    auto v1258 = Add(v1254, v1257);
+    auto v1259_tmp = MulFixedPoint15(v1258, Set(d16, 13573));
+    auto v1259 = Add(v1259_tmp, v1258);
+    auto v1260 = Add(v1022, v815);
+    auto v1261 = Add(v816, v927);
+    auto v1262 = Add(v1260, v1261);
+    auto v1263 = Add(v931, v818);
+    auto v1264 = Add(v819, v1025);
+    auto v1265 = Add(v1263, v1264);
+    auto v1266 = Add(v1262, v1265);
+    auto v1267 = Add(v1266, v1258);
+    auto v1268 = Add(v1259, v1267);
+    auto v1269 = MulFixedPoint15(v1268, Set(d16, 17734));
+    auto v1270 = Add(v1251, v1269);
+    auto v1271 = Add(v1013, v826);
+    auto v1272 = Add(v827, v938);
+    auto v1273 = Add(v1271, v1272);
+    auto v1274 = Add(v942, v829);
+    auto v1275 = Add(v830, v978);
+    auto v1276 = Add(v1274, v1275);
+    auto v1277 = Add(v1273, v1276);
+    auto v1278_tmp = MulFixedPoint15(v1277, Set(d16, 13573));
+    auto v1278 = Add(v1278_tmp, v1277);
+    auto v1279 = Add(v1029, v834);
+    auto v1280 = Add(v835, v946);
+    auto v1281 = Add(v1279, v1280);
+    auto v1282 = Add(v950, v837);
+    auto v1283 = Add(v838, v986);
+    auto v1284 = Add(v1282, v1283);
+    auto v1285 = Add(v1281, v1284);
+    auto v1286 = Add(v997, v841);
+    auto v1287 = Add(v842, v953);
+    auto v1288 = Add(v1286, v1287);
+    auto v1289 = Add(v957, v844);
+    auto v1290 = Add(v845, v1002);
+    auto v1291 = Add(v1289, v1290);
+    auto v1292 = Add(v1288, v1291);
+    auto v1293 = Add(v1285, v1292);
+    auto v1294 = Add(v1278, v1293);
+    auto v1295 = Add(v1292, v1277);
+    auto v1296_tmp = MulFixedPoint15(v1295, Set(d16, 13573));
+    auto v1296 = Add(v1296_tmp, v1295);
+    auto v1297 = Add(v1049, v852);
+    auto v1298 = Add(v853, v964);
+    auto v1299 = Add(v1297, v1298);
+    auto v1300 = Add(v968, v855);
+    auto v1301 = Add(v856, v1018);
+    auto v1302 = Add(v1300, v1301);
+    auto v1303 = Add(v1299, v1302);
+    auto v1304 = Add(v1303, v1285);
+    auto v1305 = Add(v1304, v1295);
+    auto v1306 = Add(v1296, v1305);
+    auto v1307 = MulFixedPoint15(v1306, Set(d16, 17734));
+    auto v1308 = Add(v1294, v1307);
+    auto v1309 = MulFixedPoint15(v1308, Set(d16, 16705));
+    auto v1310 = Add(v1270, v1309);
+    auto v1311 = Add(v1276, v1242);
+    auto v1312_tmp = MulFixedPoint15(v1311, Set(d16, 13573));
+    auto v1312 = Add(v1312_tmp, v1311);
+    auto v1313 = Add(v1284, v1246);
+    auto v1314 = Add(v1249, v1288);
+    auto v1315 = Add(v1313, v1314);
+    auto v1316 = Add(v1312, v1315);
+    auto v1317 = Add(v1291, v1254);
+    auto v1318 = Add(v1257, v1273);
+    auto v1319 = Add(v1317, v1318);
+    auto v1320_tmp = MulFixedPoint15(v1319, Set(d16, 13573));
+    auto v1320 = Add(v1320_tmp, v1319);
+    auto v1321 = Add(v1302, v1262);
+    auto v1322 = Add(v1265, v1281);
+    auto v1323 = Add(v1321, v1322);
+    auto v1324 = Add(v1323, v1319);
+    auto v1325 = Add(v1320, v1324);
+    auto v1326 = MulFixedPoint15(v1325, Set(d16, 17734));
+    auto v1327 = Add(v1316, v1326);
+    auto v1328 = Add(v1318, v1311);
+    auto v1329_tmp = MulFixedPoint15(v1328, Set(d16, 13573));
+    auto v1329 = Add(v1329_tmp, v1328);
+    auto v1330 = Add(v1322, v1313);
+    auto v1331 = Add(v1314, v1317);
+    auto v1332 = Add(v1330, v1331);
+    auto v1333 = Add(v1329, v1332);
+    auto v1334 = Add(v1331, v1328);
+    auto v1335_tmp = MulFixedPoint15(v1334, Set(d16, 13573));
+    auto v1335 = Add(v1335_tmp, v1334);
+    auto v1336 = Add(v1129, v891);
+    auto v1337 = Add(v892, v1045);
+    auto v1338 = Add(v1336, v1337);
+    auto v1339 = Add(v1338, v1299);
+    auto v1340 = Add(v1339, v1321);
+    auto v1341 = Add(v1340, v1330);
+    auto v1342 = Add(v1341, v1334);
+    auto v1343 = Add(v1335, v1342);
+    auto v1344 = MulFixedPoint15(v1343, Set(d16, 17734));
+    auto v1345 = Add(v1333, v1344);
+    auto v1346 = MulFixedPoint15(v1345, Set(d16, 16705));
+    auto v1347 = Add(v1327, v1346);
+    auto v1348 = MulFixedPoint15(v1347, Set(d16, 16463));
+    auto v1349 = Add(v1310, v1348);
+    auto v1350 = MulFixedPoint15(v1349, Set(d16, 16404));
+    auto v1351 = Add(v1239, v1350);
+    auto v1352 = Add(v1241, v1147);
+    auto v1353_tmp = MulFixedPoint15(v1352, Set(d16, 13573));
+    auto v1353 = Add(v1353_tmp, v1352);
+    auto v1354 = Add(v1245, v1149);
+    auto v1355 = Add(v1150, v1247);
+    auto v1356 = Add(v1354, v1355);
+    auto v1357 = Add(v1353, v1356);
+    auto v1358 = Add(v1253, v1153);
+    auto v1359 = Add(v1154, v1255);
+    auto v1360 = Add(v1358, v1359);
+    auto v1361_tmp = MulFixedPoint15(v1360, Set(d16, 13573));
+    auto v1361 = Add(v1361_tmp, v1360);
+    auto v1362 = Add(v1261, v1157);
+    auto v1363 = Add(v1158, v1263);
+    auto v1364 = Add(v1362, v1363);
+    auto v1365 = Add(v1364, v1360);
+    auto v1366 = Add(v1361, v1365);
+    auto v1367 = MulFixedPoint15(v1366, Set(d16, 17734));
+    auto v1368 = Add(v1357, v1367);
+    auto v1369 = Add(v1272, v1164);
+    auto v1370 = Add(v1165, v1274);
+    auto v1371 = Add(v1369, v1370);
+    auto v1372_tmp = MulFixedPoint15(v1371, Set(d16, 13573));
+    auto v1372 = Add(v1372_tmp, v1371);
+    auto v1373 = Add(v1280, v1168);
+    auto v1374 = Add(v1169, v1282);
+    auto v1375 = Add(v1373, v1374);
+    auto v1376 = Add(v1287, v1171);
+    auto v1377 = Add(v1172, v1289);
+    auto v1378 = Add(v1376, v1377);
+    auto v1379 = Add(v1375, v1378);
+    auto v1380 = Add(v1372, v1379);
+    auto v1381 = Add(v1378, v1371);
+    auto v1382_tmp = MulFixedPoint15(v1381, Set(d16, 13573));
+    auto v1382 = Add(v1382_tmp, v1381);
+    auto v1383 = Add(v1298, v1178);
+    auto v1384 = Add(v1179, v1300);
+    auto v1385 = Add(v1383, v1384);
+    auto v1386 = Add(v1385, v1375);
+    auto v1387 = Add(v1386, v1381);
+    auto v1388 = Add(v1382, v1387);
+    auto v1389 = MulFixedPoint15(v1388, Set(d16, 17734));
+    auto v1390 = Add(v1380, v1389);
+    auto v1391 = MulFixedPoint15(v1390, Set(d16, 16705));
+    auto v1392 = Add(v1368, v1391);
+    auto v1393 = Add(v1275, v1188);
+    auto v1394 = Add(v1189, v1240);
+    auto v1395 = Add(v1393, v1394);
+    auto v1396_tmp = MulFixedPoint15(v1395, Set(d16, 13573));
+    auto v1396 = Add(v1396_tmp, v1395);
+    auto v1397 = Add(v1283, v1192);
+    auto v1398 = Add(v1193, v1244);
+    auto v1399 = Add(v1397, v1398);
+    auto v1400 = Add(v1248, v1195);
+    auto v1401 = Add(v1196, v1286);
+    auto v1402 = Add(v1400, v1401);
+    auto v1403 = Add(v1399, v1402);
+    auto v1404 = Add(v1396, v1403);
+    auto v1405 = Add(v1290, v1200);
+    auto v1406 = Add(v1201, v1252);
+    auto v1407 = Add(v1405, v1406);
+    auto v1408 = Add(v1256, v1203);
+    auto v1409 = Add(v1204, v1271);
+    auto v1410 = Add(v1408, v1409);
+    auto v1411 = Add(v1407, v1410);
+    auto v1412_tmp = MulFixedPoint15(v1411, Set(d16, 13573));
+    auto v1412 = Add(v1412_tmp, v1411);
+    auto v1413 = Add(v1301, v1208);
+    auto v1414 = Add(v1209, v1260);
+    auto v1415 = Add(v1413, v1414);
+    auto v1416 = Add(v1264, v1211);
+    auto v1417 = Add(v1212, v1279);
+    auto v1418 = Add(v1416, v1417);
+    auto v1419 = Add(v1415, v1418);
+    auto v1420 = Add(v1419, v1411);
+    auto v1421 = Add(v1412, v1420);
+    auto v1422 = MulFixedPoint15(v1421, Set(d16, 17734));
+    auto v1423 = Add(v1404, v1422);
+    auto v1424 = Add(v1410, v1395);
+    auto v1425_tmp = MulFixedPoint15(v1424, Set(d16, 13573));
+    auto v1425 = Add(v1425_tmp, v1424);
+    auto v1426 = Add(v1418, v1399);
+    auto v1427 = Add(v1402, v1407);
+    auto v1428 = Add(v1426, v1427);
+    auto v1429 = Add(v1425, v1428);
+    auto v1430 = Add(v1427, v1424);
+    auto v1431_tmp = MulFixedPoint15(v1430, Set(d16, 13573));
+    auto v1431 = Add(v1431_tmp, v1430);
+    auto v1432 = Add(v1337, v1227);
+    auto v1433 = Add(v1228, v1297);
+    auto v1434 = Add(v1432, v1433);
+    auto v1435 = Add(v1434, v1415);
+    auto v1436 = Add(v1435, v1426);
+    auto v1437 = Add(v1436, v1430);
+    auto v1438 = Add(v1431, v1437);
+    auto v1439 = MulFixedPoint15(v1438, Set(d16, 17734));
+    auto v1440 = Add(v1429, v1439);
+    auto v1441 = MulFixedPoint15(v1440, Set(d16, 16705));
+    auto v1442 = Add(v1423, v1441);
+    auto v1443 = MulFixedPoint15(v1442, Set(d16, 16463));
+    auto v1444 = Add(v1392, v1443);
+    auto v1445 = Add(v1394, v1352);
+    auto v1446_tmp = MulFixedPoint15(v1445, Set(d16, 13573));
+    auto v1446 = Add(v1446_tmp, v1445);
+    auto v1447 = Add(v1398, v1354);
+    auto v1448 = Add(v1355, v1400);
+    auto v1449 = Add(v1447, v1448);
+    auto v1450 = Add(v1446, v1449);
+    auto v1451 = Add(v1406, v1358);
+    auto v1452 = Add(v1359, v1408);
+    auto v1453 = Add(v1451, v1452);
+    auto v1454_tmp = MulFixedPoint15(v1453, Set(d16, 13573));
+    auto v1454 = Add(v1454_tmp, v1453);
+    auto v1455 = Add(v1414, v1362);
+    auto v1456 = Add(v1363, v1416);
+    auto v1457 = Add(v1455, v1456);
+    auto v1458 = Add(v1457, v1453);
+    auto v1459 = Add(v1454, v1458);
+    auto v1460 = MulFixedPoint15(v1459, Set(d16, 17734));
+    auto v1461 = Add(v1450, v1460);
+    auto v1462 = Add(v1409, v1369);
+    auto v1463 = Add(v1370, v1393);
+    auto v1464 = Add(v1462, v1463);
+    auto v1465_tmp = MulFixedPoint15(v1464, Set(d16, 13573));
+    auto v1465 = Add(v1465_tmp, v1464);
+    auto v1466 = Add(v1417, v1373);
+    auto v1467 = Add(v1374, v1397);
+    auto v1468 = Add(v1466, v1467);
+    auto v1469 = Add(v1401, v1376);
+    auto v1470 = Add(v1377, v1405);
+    auto v1471 = Add(v1469, v1470);
+    auto v1472 = Add(v1468, v1471);
+    auto v1473 = Add(v1465, v1472);
+    auto v1474 = Add(v1471, v1464);
+    auto v1475_tmp = MulFixedPoint15(v1474, Set(d16, 13573));
+    auto v1475 = Add(v1475_tmp, v1474);
+    auto v1476 = Add(v1433, v1383);
+    auto v1477 = Add(v1384, v1413);
+    auto v1478 = Add(v1476, v1477);
+    auto v1479 = Add(v1478, v1468);
+    auto v1480 = Add(v1479, v1474);
+    auto v1481 = Add(v1475, v1480);
+    auto v1482 = MulFixedPoint15(v1481, Set(d16, 17734));
+    auto v1483 = Add(v1473, v1482);
+    auto v1484 = MulFixedPoint15(v1483, Set(d16, 16705));
+    auto v1485 = Add(v1461, v1484);
+    auto v1486 = Add(v1463, v1445);
+    auto v1487_tmp = MulFixedPoint15(v1486, Set(d16, 13573));
+    auto v1487 = Add(v1487_tmp, v1486);
+    auto v1488 = Add(v1467, v1447);
+    auto v1489 = Add(v1448, v1469);
+    auto v1490 = Add(v1488, v1489);
+    auto v1491 = Add(v1487, v1490);
+    auto v1492 = Add(v1470, v1451);
+    auto v1493 = Add(v1452, v1462);
+    auto v1494 = Add(v1492, v1493);
+    auto v1495_tmp = MulFixedPoint15(v1494, Set(d16, 13573));
+    auto v1495 = Add(v1495_tmp, v1494);
+    auto v1496 = Add(v1477, v1455);
+    auto v1497 = Add(v1456, v1466);
+    auto v1498 = Add(v1496, v1497);
+    auto v1499 = Add(v1498, v1494);
+    auto v1500 = Add(v1495, v1499);
+    auto v1501 = MulFixedPoint15(v1500, Set(d16, 17734));
+    auto v1502 = Add(v1491, v1501);
+    auto v1503 = Add(v1493, v1486);
+    auto v1504_tmp = MulFixedPoint15(v1503, Set(d16, 13573));
+    auto v1504 = Add(v1504_tmp, v1503);
+    auto v1505 = Add(v1497, v1488);
+    auto v1506 = Add(v1489, v1492);
+    auto v1507 = Add(v1505, v1506);
+    auto v1508 = Add(v1504, v1507);
+    auto v1509 = Add(v1506, v1503);
+    auto v1510_tmp = MulFixedPoint15(v1509, Set(d16, 13573));
+    auto v1510 = Add(v1510_tmp, v1509);
+    auto v1511 = LoadU(d16, in + in_stride * 255 + i);
+    auto v1512 = Add(v1511, v1128);
+    auto v1513 = Add(v1512, v1336);
+    auto v1514 = Add(v1513, v1432);
+    auto v1515 = Add(v1514, v1476);
+    auto v1516 = Add(v1515, v1496);
+    auto v1517 = Add(v1516, v1505);
+    auto v1518 = Add(v1517, v1509);
+    auto v1519 = Add(v1510, v1518);
+    auto v1520 = MulFixedPoint15(v1519, Set(d16, 17734));
+    auto v1521 = Add(v1508, v1520);
+    auto v1522 = MulFixedPoint15(v1521, Set(d16, 16705));
+    auto v1523 = Add(v1502, v1522);
+    auto v1524 = MulFixedPoint15(v1523, Set(d16, 16463));
+    auto v1525 = Add(v1485, v1524);
+    auto v1526 = MulFixedPoint15(v1525, Set(d16, 16404));
+    auto v1527 = Add(v1444, v1526);
+    auto v1528 = MulFixedPoint15(v1527, Set(d16, 16389));
+    auto v1529 = Add(v1351, v1528);
+    auto v1530 = MulFixedPoint15(v1529, Set(d16, 16385));
+    auto v1531 = Add(v1146, v1530);
+    auto v1532 = MulFixedPoint15(v1531, Set(d16, 16384));
+    auto v1533 = Add(v701, v1532);
+    auto v1534 = Sub(v0, v1);
+    auto v1535 = Sub(v4, v6);
+    auto v1536_tmp = MulFixedPoint15(v1535, Set(d16, 10045));
+    auto v1536 = Add(v1536_tmp, v1535);
+    auto v1537 = Add(v1534, v1536);
+    auto v1538 = Sub(v11, v14);
+    auto v1539 = Sub(v17, v20);
+    auto v1540_tmp = MulFixedPoint15(v1539, Set(d16, 10045));
+    auto v1540 = Add(v1540_tmp, v1539);
+    auto v1541 = Add(v1538, v1540);
+    auto v1542 = MulFixedPoint15(v1541, Set(d16, 19705));
+    auto v1543 = Add(v1537, v1542);
+    auto v1544 = Sub(v27, v30);
+    auto v1545 = Sub(v35, v39);
+    auto v1546_tmp = MulFixedPoint15(v1545, Set(d16, 10045));
+    auto v1546 = Add(v1546_tmp, v1545);
+    auto v1547 = Add(v1544, v1546);
+    auto v1548 = Sub(v44, v47);
+    auto v1549 = Sub(v50, v54);
+    auto v1550_tmp = MulFixedPoint15(v1549, Set(d16, 10045));
+    auto v1550 = Add(v1550_tmp, v1549);
+    auto v1551 = Add(v1548, v1550);
+    auto v1552 = MulFixedPoint15(v1551, Set(d16, 19705));
+    auto v1553 = Add(v1547, v1552);
+    auto v1554 = MulFixedPoint15(v1553, Set(d16, 17121));
+    auto v1555 = Add(v1543, v1554);
+    auto v1556 = Sub(v63, v66);
+    auto v1557 = Sub(v71, v75);
+    auto v1558_tmp = MulFixedPoint15(v1557, Set(d16, 10045));
+    auto v1558 = Add(v1558_tmp, v1557);
+    auto v1559 = Add(v1556, v1558);
+    auto v1560 = Sub(v82, v89);
+    auto v1561 = Sub(v92, v97);
+    auto v1562_tmp = MulFixedPoint15(v1561, Set(d16, 10045));
+    auto v1562 = Add(v1562_tmp, v1561);
+    auto v1563 = Add(v1560, v1562);
+    auto v1564 = MulFixedPoint15(v1563, Set(d16, 19705));
+    auto v1565 = Add(v1559, v1564);
+    auto v1566 = Sub(v104, v107);
+    auto v1567 = Sub(v112, v116);
+    auto v1568_tmp = MulFixedPoint15(v1567, Set(d16, 10045));
+    auto v1568 = Add(v1568_tmp, v1567);
+    auto v1569 = Add(v1566, v1568);
+    auto v1570 = Sub(v121, v124);
+    auto v1571 = Sub(v127, v132);
+    auto v1572_tmp = MulFixedPoint15(v1571, Set(d16, 10045));
+    auto v1572 = Add(v1572_tmp, v1571);
+    auto v1573 = Add(v1570, v1572);
+    auto v1574 = MulFixedPoint15(v1573, Set(d16, 19705));
+    auto v1575 = Add(v1569, v1574);
+    auto v1576 = MulFixedPoint15(v1575, Set(d16, 17121));
+    auto v1577 = Add(v1565, v1576);
+    auto v1578 = MulFixedPoint15(v1577, Set(d16, 16563));
+    auto v1579 = Add(v1555, v1578);
+    auto v1580 = Sub(v143, v146);
+    auto v1581 = Sub(v151, v155);
+    auto v1582_tmp = MulFixedPoint15(v1581, Set(d16, 10045));
+    auto v1582 = Add(v1582_tmp, v1581);
+    auto v1583 = Add(v1580, v1582);
+    auto v1584 = Sub(v162, v169);
+    auto v1585 = Sub(v172, v177);
+    auto v1586_tmp = MulFixedPoint15(v1585, Set(d16, 10045));
+    auto v1586 = Add(v1586_tmp, v1585);
+    auto v1587 = Add(v1584, v1586);
+    auto v1588 = MulFixedPoint15(v1587, Set(d16, 19705));
+    auto v1589 = Add(v1583, v1588);
+    auto v1590 = Sub(v186, v193);
+    auto v1591 = Sub(v202, v210);
+    auto v1592_tmp = MulFixedPoint15(v1591, Set(d16, 10045));
+    auto v1592 = Add(v1592_tmp, v1591);
+    auto v1593 = Add(v1590, v1592);
+    auto v1594 = Sub(v215, v218);
+    auto v1595 = Sub(v221, v227);
+    auto v1596_tmp = MulFixedPoint15(v1595, Set(d16, 10045));
+    auto v1596 = Add(v1596_tmp, v1595);
+    auto v1597 = Add(v1594, v1596);
+    auto v1598 = MulFixedPoint15(v1597, Set(d16, 19705));
+    auto v1599 = Add(v1593, v1598);
+    auto v1600 = MulFixedPoint15(v1599, Set(d16, 17121));
+    auto v1601 = Add(v1589, v1600);
+    auto v1602 = Sub(v236, v239);
+    auto v1603 = Sub(v244, v248);
+    auto v1604_tmp = MulFixedPoint15(v1603, Set(d16, 10045));
+    auto v1604 = Add(v1604_tmp, v1603);
+    auto v1605 = Add(v1602, v1604);
+    auto v1606 = Sub(v255, v262);
+    auto v1607 = Sub(v265, v270);
+    auto v1608_tmp = MulFixedPoint15(v1607, Set(d16, 10045));
+    auto v1608 = Add(v1608_tmp, v1607);
+    auto v1609 = Add(v1606, v1608);
+    auto v1610 = MulFixedPoint15(v1609, Set(d16, 19705));
+    auto v1611 = Add(v1605, v1610);
+    auto v1612 = Sub(v277, v280);
+    auto v1613 = Sub(v285, v289);
+    auto v1614_tmp = MulFixedPoint15(v1613, Set(d16, 10045));
+    auto v1614 = Add(v1614_tmp, v1613);
+    auto v1615 = Add(v1612, v1614);
+    auto v1616 = Sub(v294, v297);
+    auto v1617 = Sub(v300, v306);
+    auto v1618_tmp = MulFixedPoint15(v1617, Set(d16, 10045));
+    auto v1618 = Add(v1618_tmp, v1617);
+    auto v1619 = Add(v1616, v1618);
+    auto v1620 = MulFixedPoint15(v1619, Set(d16, 19705));
+    auto v1621 = Add(v1615, v1620);
+    auto v1622 = MulFixedPoint15(v1621, Set(d16, 17121));
+    auto v1623 = Add(v1611, v1622);
+    auto v1624 = MulFixedPoint15(v1623, Set(d16, 16563));
+    auto v1625 = Add(v1601, v1624);
+    auto v1626 = MulFixedPoint15(v1625, Set(d16, 16429));
+    auto v1627 = Add(v1579, v1626);
+    auto v1628 = Sub(v319, v322);
+    auto v1629 = Sub(v327, v331);
+    auto v1630_tmp = MulFixedPoint15(v1629, Set(d16, 10045));
+    auto v1630 = Add(v1630_tmp, v1629);
+    auto v1631 = Add(v1628, v1630);
+    auto v1632 = Sub(v338, v345);
+    auto v1633 = Sub(v348, v353);
+    auto v1634_tmp = MulFixedPoint15(v1633, Set(d16, 10045));
+    auto v1634 = Add(v1634_tmp, v1633);
+    auto v1635 = Add(v1632, v1634);
+    auto v1636 = MulFixedPoint15(v1635, Set(d16, 19705));
+    auto v1637 = Add(v1631, v1636);
+    auto v1638 = Sub(v362, v369);
+    auto v1639 = Sub(v378, v386);
+    auto v1640_tmp = MulFixedPoint15(v1639, Set(d16, 10045));
+    auto v1640 = Add(v1640_tmp, v1639);
+    auto v1641 = Add(v1638, v1640);
+    auto v1642 = Sub(v391, v394);
+    auto v1643 = Sub(v397, v403);
+    auto v1644_tmp = MulFixedPoint15(v1643, Set(d16, 10045));
+    auto v1644 = Add(v1644_tmp, v1643);
+    auto v1645 = Add(v1642, v1644);
+    auto v1646 = MulFixedPoint15(v1645, Set(d16, 19705));
+    auto v1647 = Add(v1641, v1646);
+    auto v1648 = MulFixedPoint15(v1647, Set(d16, 17121));
+    auto v1649 = Add(v1637, v1648);
+    auto v1650 = Sub(v414, v421);
+    auto v1651 = Sub(v430, v438);
+    auto v1652_tmp = MulFixedPoint15(v1651, Set(d16, 10045));
+    auto v1652 = Add(v1652_tmp, v1651);
+    auto v1653 = Add(v1650, v1652);
+    auto v1654 = Sub(v449, v464);
+    auto v1655 = Sub(v467, v476);
+    auto v1656_tmp = MulFixedPoint15(v1655, Set(d16, 10045));
+    auto v1656 = Add(v1656_tmp, v1655);
+    auto v1657 = Add(v1654, v1656);
+    auto v1658 = MulFixedPoint15(v1657, Set(d16, 19705));
+    auto v1659 = Add(v1653, v1658);
+    auto v1660 = Sub(v483, v486);
+    auto v1661 = Sub(v491, v495);
+    auto v1662_tmp = MulFixedPoint15(v1661, Set(d16, 10045));
+    auto v1662 = Add(v1662_tmp, v1661);
+    auto v1663 = Add(v1660, v1662);
+    auto v1664 = Sub(v500, v503);
+    auto v1665 = Sub(v506, v513);
+    auto v1666_tmp = MulFixedPoint15(v1665, Set(d16, 10045));
+    auto v1666 = Add(v1666_tmp, v1665);
+    auto v1667 = Add(v1664, v1666);
+    auto v1668 = MulFixedPoint15(v1667, Set(d16, 19705));
+    auto v1669 = Add(v1663, v1668);
+    auto v1670 = MulFixedPoint15(v1669, Set(d16, 17121));
+    auto v1671 = Add(v1659, v1670);
+    auto v1672 = MulFixedPoint15(v1671, Set(d16, 16563));
+    auto v1673 = Add(v1649, v1672);
+    auto v1674 = Sub(v524, v527);
+    auto v1675 = Sub(v532, v536);
+    auto v1676_tmp = MulFixedPoint15(v1675, Set(d16, 10045));
+    auto v1676 = Add(v1676_tmp, v1675);
+    auto v1677 = Add(v1674, v1676);
+    auto v1678 = Sub(v543, v550);
+    auto v1679 = Sub(v553, v558);
+    auto v1680_tmp = MulFixedPoint15(v1679, Set(d16, 10045));
+    auto v1680 = Add(v1680_tmp, v1679);
+    auto v1681 = Add(v1678, v1680);
+    auto v1682 = MulFixedPoint15(v1681, Set(d16, 19705));
+    auto v1683 = Add(v1677, v1682);
+    auto v1684 = Sub(v567, v574);
+    auto v1685 = Sub(v583, v591);
+    auto v1686_tmp = MulFixedPoint15(v1685, Set(d16, 10045));
+    auto v1686 = Add(v1686_tmp, v1685);
+    auto v1687 = Add(v1684, v1686);
+    auto v1688 = Sub(v596, v599);
+    auto v1689 = Sub(v602, v608);
+    auto v1690_tmp = MulFixedPoint15(v1689, Set(d16, 10045));
+    auto v1690 = Add(v1690_tmp, v1689);
+    auto v1691 = Add(v1688, v1690);
+    auto v1692 = MulFixedPoint15(v1691, Set(d16, 19705));
+    auto v1693 = Add(v1687, v1692);
+    auto v1694 = MulFixedPoint15(v1693, Set(d16, 17121));
+    auto v1695 = Add(v1683, v1694);
+    auto v1696 = Sub(v617, v620);
+    auto v1697 = Sub(v625, v629);
+    auto v1698_tmp = MulFixedPoint15(v1697, Set(d16, 10045));
+    auto v1698 = Add(v1698_tmp, v1697);
+    auto v1699 = Add(v1696, v1698);
+    auto v1700 = Sub(v636, v643);
+    auto v1701 = Sub(v646, v651);
+    auto v1702_tmp = MulFixedPoint15(v1701, Set(d16, 10045));
+    auto v1702 = Add(v1702_tmp, v1701);
+    auto v1703 = Add(v1700, v1702);
+    auto v1704 = MulFixedPoint15(v1703, Set(d16, 19705));
+    auto v1705 = Add(v1699, v1704);
+    auto v1706 = Sub(v658, v661);
+    auto v1707 = Sub(v666, v670);
+    auto v1708_tmp = MulFixedPoint15(v1707, Set(d16, 10045));
+    auto v1708 = Add(v1708_tmp, v1707);
+    auto v1709 = Add(v1706, v1708);
+    auto v1710 = Sub(v675, v678);
+    auto v1711 = Sub(v681, v688);
+    auto v1712_tmp = MulFixedPoint15(v1711, Set(d16, 10045));
+    auto v1712 = Add(v1712_tmp, v1711);
+    auto v1713 = Add(v1710, v1712);
+    auto v1714 = MulFixedPoint15(v1713, Set(d16, 19705));
+    auto v1715 = Add(v1709, v1714);
+    auto v1716 = MulFixedPoint15(v1715, Set(d16, 17121));
+    auto v1717 = Add(v1705, v1716);
+    auto v1718 = MulFixedPoint15(v1717, Set(d16, 16563));
+    auto v1719 = Add(v1695, v1718);
+    auto v1720 = MulFixedPoint15(v1719, Set(d16, 16429));
+    auto v1721 = Add(v1673, v1720);
+    auto v1722 = MulFixedPoint15(v1721, Set(d16, 16395));
+    auto v1723 = Add(v1627, v1722);
+    auto v1724 = Sub(v703, v706);
+    auto v1725 = Sub(v711, v715);
+    auto v1726_tmp = MulFixedPoint15(v1725, Set(d16, 10045));
+    auto v1726 = Add(v1726_tmp, v1725);
+    auto v1727 = Add(v1724, v1726);
+    auto v1728 = Sub(v722, v729);
+    auto v1729 = Sub(v732, v737);
+    auto v1730_tmp = MulFixedPoint15(v1729, Set(d16, 10045));
+    auto v1730 = Add(v1730_tmp, v1729);
+    auto v1731 = Add(v1728, v1730);
+    auto v1732 = MulFixedPoint15(v1731, Set(d16, 19705));
+    auto v1733 = Add(v1727, v1732);
+    auto v1734 = Sub(v746, v753);
+    auto v1735 = Sub(v762, v770);
+    auto v1736_tmp = MulFixedPoint15(v1735, Set(d16, 10045));
+    auto v1736 = Add(v1736_tmp, v1735);
+    auto v1737 = Add(v1734, v1736);
+    auto v1738 = Sub(v775, v778);
+    auto v1739 = Sub(v781, v787);
+    auto v1740_tmp = MulFixedPoint15(v1739, Set(d16, 10045));
+    auto v1740 = Add(v1740_tmp, v1739);
+    auto v1741 = Add(v1738, v1740);
+    auto v1742 = MulFixedPoint15(v1741, Set(d16, 19705));
+    auto v1743 = Add(v1737, v1742);
+    auto v1744 = MulFixedPoint15(v1743, Set(d16, 17121));
+    auto v1745 = Add(v1733, v1744);
+    auto v1746 = Sub(v798, v805);
+    auto v1747 = Sub(v814, v822);
+    auto v1748_tmp = MulFixedPoint15(v1747, Set(d16, 10045));
+    auto v1748 = Add(v1748_tmp, v1747);
+    auto v1749 = Add(v1746, v1748);
+    auto v1750 = Sub(v833, v848);
+    auto v1751 = Sub(v851, v860);
+    auto v1752_tmp = MulFixedPoint15(v1751, Set(d16, 10045));
+    auto v1752 = Add(v1752_tmp, v1751);
+    auto v1753 = Add(v1750, v1752);
+    auto v1754 = MulFixedPoint15(v1753, Set(d16, 19705));
+    auto v1755 = Add(v1749, v1754);
+    auto v1756 = Sub(v867, v870);
+    auto v1757 = Sub(v875, v879);
+    auto v1758_tmp = MulFixedPoint15(v1757, Set(d16, 10045));
+    auto v1758 = Add(v1758_tmp, v1757);
+    auto v1759 = Add(v1756, v1758);
+    auto v1760 = Sub(v884, v887);
+    auto v1761 = Sub(v890, v897);
+    auto v1762_tmp = MulFixedPoint15(v1761, Set(d16, 10045));
+    auto v1762 = Add(v1762_tmp, v1761);
+    auto v1763 = Add(v1760, v1762);
+    auto v1764 = MulFixedPoint15(v1763, Set(d16, 19705));
+    auto v1765 = Add(v1759, v1764);
+    auto v1766 = MulFixedPoint15(v1765, Set(d16, 17121));
+    auto v1767 = Add(v1755, v1766);
+    auto v1768 = MulFixedPoint15(v1767, Set(d16, 16563));
+    auto v1769 = Add(v1745, v1768);
+    auto v1770 = Sub(v910, v917);
+    auto v1771 = Sub(v926, v934);
+    auto v1772_tmp = MulFixedPoint15(v1771, Set(d16, 10045));
+    auto v1772 = Add(v1772_tmp, v1771);
+    auto v1773 = Add(v1770, v1772);
+    auto v1774 = Sub(v945, v960);
+    auto v1775 = Sub(v963, v972);
+    auto v1776_tmp = MulFixedPoint15(v1775, Set(d16, 10045));
+    auto v1776 = Add(v1776_tmp, v1775);
+    auto v1777 = Add(v1774, v1776);
+    auto v1778 = MulFixedPoint15(v1777, Set(d16, 19705));
+    auto v1779 = Add(v1773, v1778);
+    auto v1780 = Sub(v985, v1000);
+    auto v1781 = Sub(v1017, v1033);
+    auto v1782_tmp = MulFixedPoint15(v1781, Set(d16, 10045));
+    auto v1782 = Add(v1782_tmp, v1781);
+    auto v1783 = Add(v1780, v1782);
+    auto v1784 = Sub(v1038, v1041);
+    auto v1785 = Sub(v1044, v1054);
+    auto v1786_tmp = MulFixedPoint15(v1785, Set(d16, 10045));
+    auto v1786 = Add(v1786_tmp, v1785);
+    auto v1787 = Add(v1784, v1786);
+    auto v1788 = MulFixedPoint15(v1787, Set(d16, 19705));
+    auto v1789 = Add(v1783, v1788);
+    auto v1790 = MulFixedPoint15(v1789, Set(d16, 17121));
+    auto v1791 = Add(v1779, v1790);
+    auto v1792 = Sub(v1063, v1066);
+    auto v1793 = Sub(v1071, v1075);
+    auto v1794_tmp = MulFixedPoint15(v1793, Set(d16, 10045));
+    auto v1794 = Add(v1794_tmp, v1793);
+    auto v1795 = Add(v1792, v1794);
+    auto v1796 = Sub(v1082, v1089);
+    auto v1797 = Sub(v1092, v1097);
+    auto v1798_tmp = MulFixedPoint15(v1797, Set(d16, 10045));
+    auto v1798 = Add(v1798_tmp, v1797);
+    auto v1799 = Add(v1796, v1798);
+    auto v1800 = MulFixedPoint15(v1799, Set(d16, 19705));
+    auto v1801 = Add(v1795, v1800);
+    auto v1802 = Sub(v1104, v1107);
+    auto v1803 = Sub(v1112, v1116);
+    auto v1804_tmp = MulFixedPoint15(v1803, Set(d16, 10045));
+    auto v1804 = Add(v1804_tmp, v1803);
+    auto v1805 = Add(v1802, v1804);
+    auto v1806 = Sub(v1121, v1124);
+    auto v1807 = Sub(v1127, v1135);
+    auto v1808_tmp = MulFixedPoint15(v1807, Set(d16, 10045));
+    auto v1808 = Add(v1808_tmp, v1807);
+    auto v1809 = Add(v1806, v1808);
+    auto v1810 = MulFixedPoint15(v1809, Set(d16, 19705));
+    auto v1811 = Add(v1805, v1810);
+    auto v1812 = MulFixedPoint15(v1811, Set(d16, 17121));
+    auto v1813 = Add(v1801, v1812);
+    auto v1814 = MulFixedPoint15(v1813, Set(d16, 16563));
+    auto v1815 = Add(v1791, v1814);
+    auto v1816 = MulFixedPoint15(v1815, Set(d16, 16429));
+    auto v1817 = Add(v1769, v1816);
+    auto v1818 = Sub(v1148, v1151);
+    auto v1819 = Sub(v1156, v1160);
+    auto v1820_tmp = MulFixedPoint15(v1819, Set(d16, 10045));
+    auto v1820 = Add(v1820_tmp, v1819);
+    auto v1821 = Add(v1818, v1820);
+    auto v1822 = Sub(v1167, v1174);
+    auto v1823 = Sub(v1177, v1182);
+    auto v1824_tmp = MulFixedPoint15(v1823, Set(d16, 10045));
+    auto v1824 = Add(v1824_tmp, v1823);
+    auto v1825 = Add(v1822, v1824);
+    auto v1826 = MulFixedPoint15(v1825, Set(d16, 19705));
+    auto v1827 = Add(v1821, v1826);
+    auto v1828 = Sub(v1191, v1198);
+    auto v1829 = Sub(v1207, v1215);
+    auto v1830_tmp = MulFixedPoint15(v1829, Set(d16, 10045));
+    auto v1830 = Add(v1830_tmp, v1829);
+    auto v1831 = Add(v1828, v1830);
+    auto v1832 = Sub(v1220, v1223);
+    auto v1833 = Sub(v1226, v1232);
+    auto v1834_tmp = MulFixedPoint15(v1833, Set(d16, 10045));
+    auto v1834 = Add(v1834_tmp, v1833);
+    auto v1835 = Add(v1832, v1834);
+    auto v1836 = MulFixedPoint15(v1835, Set(d16, 19705));
+    auto v1837 = Add(v1831, v1836);
+    auto v1838 = MulFixedPoint15(v1837, Set(d16, 17121));
+    auto v1839 = Add(v1827, v1838);
+    auto v1840 = Sub(v1243, v1250);
+    auto v1841 = Sub(v1259, v1267);
+    auto v1842_tmp = MulFixedPoint15(v1841, Set(d16, 10045));
+    auto v1842 = Add(v1842_tmp, v1841);
+    auto v1843 = Add(v1840, v1842);
+    auto v1844 = Sub(v1278, v1293);
+    auto v1845 = Sub(v1296, v1305);
+    auto v1846_tmp = MulFixedPoint15(v1845, Set(d16, 10045));
+    auto v1846 = Add(v1846_tmp, v1845);
+    auto v1847 = Add(v1844, v1846);
+    auto v1848 = MulFixedPoint15(v1847, Set(d16, 19705));
+    auto v1849 = Add(v1843, v1848);
+    auto v1850 = Sub(v1312, v1315);
+    auto v1851 = Sub(v1320, v1324);
+    auto v1852_tmp = MulFixedPoint15(v1851, Set(d16, 10045));
+    auto v1852 = Add(v1852_tmp, v1851);
+    auto v1853 = Add(v1850, v1852);
+    auto v1854 = Sub(v1329, v1332);
+    auto v1855 = Sub(v1335, v1342);
+    auto v1856_tmp = MulFixedPoint15(v1855, Set(d16, 10045));
+    auto v1856 = Add(v1856_tmp, v1855);
+    auto v1857 = Add(v1854, v1856);
+    auto v1858 = MulFixedPoint15(v1857, Set(d16, 19705));
+    auto v1859 = Add(v1853, v1858);
+    auto v1860 = MulFixedPoint15(v1859, Set(d16, 17121));
+    auto v1861 = Add(v1849, v1860);
+    auto v1862 = MulFixedPoint15(v1861, Set(d16, 16563));
+    auto v1863 = Add(v1839, v1862);
+    auto v1864 = Sub(v1353, v1356);
+    auto v1865 = Sub(v1361, v1365);
+    auto v1866_tmp = MulFixedPoint15(v1865, Set(d16, 10045));
+    auto v1866 = Add(v1866_tmp, v1865);
+    auto v1867 = Add(v1864, v1866);
+    auto v1868 = Sub(v1372, v1379);
+    auto v1869 = Sub(v1382, v1387);
+    auto v1870_tmp = MulFixedPoint15(v1869, Set(d16, 10045));
+    auto v1870 = Add(v1870_tmp, v1869);
+    auto v1871 = Add(v1868, v1870);
+    auto v1872 = MulFixedPoint15(v1871, Set(d16, 19705));
+    auto v1873 = Add(v1867, v1872);
+    auto v1874 = Sub(v1396, v1403);
+    auto v1875 = Sub(v1412, v1420);
+    auto v1876_tmp = MulFixedPoint15(v1875, Set(d16, 10045));
+    auto v1876 = Add(v1876_tmp, v1875);
+    auto v1877 = Add(v1874, v1876);
+    auto v1878 = Sub(v1425, v1428);
+    auto v1879 = Sub(v1431, v1437);
+    auto v1880_tmp = MulFixedPoint15(v1879, Set(d16, 10045));
+    auto v1880 = Add(v1880_tmp, v1879);
+    auto v1881 = Add(v1878, v1880);
+    auto v1882 = MulFixedPoint15(v1881, Set(d16, 19705));
+    auto v1883 = Add(v1877, v1882);
+    auto v1884 = MulFixedPoint15(v1883, Set(d16, 17121));
+    auto v1885 = Add(v1873, v1884);
+    auto v1886 = Sub(v1446, v1449);
+    auto v1887 = Sub(v1454, v1458);
+    auto v1888_tmp = MulFixedPoint15(v1887, Set(d16, 10045));
+    auto v1888 = Add(v1888_tmp, v1887);
+    auto v1889 = Add(v1886, v1888);
+    auto v1890 = Sub(v1465, v1472);
+    auto v1891 = Sub(v1475, v1480);
+    auto v1892_tmp = MulFixedPoint15(v1891, Set(d16, 10045));
+    auto v1892 = Add(v1892_tmp, v1891);
+    auto v1893 = Add(v1890, v1892);
+    auto v1894 = MulFixedPoint15(v1893, Set(d16, 19705));
+    auto v1895 = Add(v1889, v1894);
+    auto v1896 = Sub(v1487, v1490);
+    auto v1897 = Sub(v1495, v1499);
+    auto v1898_tmp = MulFixedPoint15(v1897, Set(d16, 10045));
+    auto v1898 = Add(v1898_tmp, v1897);
+    auto v1899 = Add(v1896, v1898);
+    auto v1900 = Sub(v1504, v1507);
+    auto v1901 = Sub(v1510, v1518);
+    auto v1902_tmp = MulFixedPoint15(v1901, Set(d16, 10045));
+    auto v1902 = Add(v1902_tmp, v1901);
+    auto v1903 = Add(v1900, v1902);
+    auto v1904 = MulFixedPoint15(v1903, Set(d16, 19705));
+    auto v1905 = Add(v1899, v1904);
+    auto v1906 = MulFixedPoint15(v1905, Set(d16, 17121));
+    auto v1907 = Add(v1895, v1906);
+    auto v1908 = MulFixedPoint15(v1907, Set(d16, 16563));
+    auto v1909 = Add(v1885, v1908);
+    auto v1910 = MulFixedPoint15(v1909, Set(d16, 16429));
+    auto v1911 = Add(v1863, v1910);
+    auto v1912 = MulFixedPoint15(v1911, Set(d16, 16395));
+    auto v1913 = Add(v1817, v1912);
+    auto v1914 = MulFixedPoint15(v1913, Set(d16, 16387));
+    auto v1915 = Add(v1723, v1914);
+    auto v1916 = Sub(v1534, v1536);
+    auto v1917 = Sub(v1538, v1540);
+    auto v1918 = MulFixedPoint15(v1917, Set(d16, 29490));
+    auto v1919 = Add(v1916, v1918);
+    auto v1920 = Sub(v1544, v1546);
+    auto v1921 = Sub(v1548, v1550);
+    auto v1922 = MulFixedPoint15(v1921, Set(d16, 29490));
+    auto v1923 = Add(v1920, v1922);
+    auto v1924 = MulFixedPoint15(v1923, Set(d16, 18578));
+    auto v1925 = Add(v1919, v1924);
+    auto v1926 = Sub(v1556, v1558);
+    auto v1927 = Sub(v1560, v1562);
+    auto v1928 = MulFixedPoint15(v1927, Set(d16, 29490));
+    auto v1929 = Add(v1926, v1928);
+    auto v1930 = Sub(v1566, v1568);
+    auto v1931 = Sub(v1570, v1572);
+    auto v1932 = MulFixedPoint15(v1931, Set(d16, 29490));
+    auto v1933 = Add(v1930, v1932);
+    auto v1934 = MulFixedPoint15(v1933, Set(d16, 18578));
+    auto v1935 = Add(v1929, v1934);
+    auto v1936 = MulFixedPoint15(v1935, Set(d16, 16890));
+    auto v1937 = Add(v1925, v1936);
+    auto v1938 = Sub(v1580, v1582);
+    auto v1939 = Sub(v1584, v1586);
+    auto v1940 = MulFixedPoint15(v1939, Set(d16, 29490));
+    auto v1941 = Add(v1938, v1940);
+    auto v1942 = Sub(v1590, v1592);
+    auto v1943 = Sub(v1594, v1596);
+    auto v1944 = MulFixedPoint15(v1943, Set(d16, 29490));
+    auto v1945 = Add(v1942, v1944);
+    auto v1946 = MulFixedPoint15(v1945, Set(d16, 18578));
+    auto v1947 = Add(v1941, v1946);
+    auto v1948 = Sub(v1602, v1604);
+    auto v1949 = Sub(v1606, v1608);
+    auto v1950 = MulFixedPoint15(v1949, Set(d16, 29490));
+    auto v1951 = Add(v1948, v1950);
+    auto v1952 = Sub(v1612, v1614);
+    auto v1953 = Sub(v1616, v1618);
+    auto v1954 = MulFixedPoint15(v1953, Set(d16, 29490));
+    auto v1955 = Add(v1952, v1954);
+    auto v1956 = MulFixedPoint15(v1955, Set(d16, 18578));
+    auto v1957 = Add(v1951, v1956);
+    auto v1958 = MulFixedPoint15(v1957, Set(d16, 16890));
+    auto v1959 = Add(v1947, v1958);
+    auto v1960 = MulFixedPoint15(v1959, Set(d16, 16508));
+    auto v1961 = Add(v1937, v1960);
+    auto v1962 = Sub(v1628, v1630);
+    auto v1963 = Sub(v1632, v1634);
+    auto v1964 = MulFixedPoint15(v1963, Set(d16, 29490));
+    auto v1965 = Add(v1962, v1964);
+    auto v1966 = Sub(v1638, v1640);
+    auto v1967 = Sub(v1642, v1644);
+    auto v1968 = MulFixedPoint15(v1967, Set(d16, 29490));
+    auto v1969 = Add(v1966, v1968);
+    auto v1970 = MulFixedPoint15(v1969, Set(d16, 18578));
+    auto v1971 = Add(v1965, v1970);
+    auto v1972 = Sub(v1650, v1652);
+    auto v1973 = Sub(v1654, v1656);
+    auto v1974 = MulFixedPoint15(v1973, Set(d16, 29490));
+    auto v1975 = Add(v1972, v1974);
+    auto v1976 = Sub(v1660, v1662);
+    auto v1977 = Sub(v1664, v1666);
+    auto v1978 = MulFixedPoint15(v1977, Set(d16, 29490));
+    auto v1979 = Add(v1976, v1978);
+    auto v1980 = MulFixedPoint15(v1979, Set(d16, 18578));
+    auto v1981 = Add(v1975, v1980);
+    auto v1982 = MulFixedPoint15(v1981, Set(d16, 16890));
+    auto v1983 = Add(v1971, v1982);
+    auto v1984 = Sub(v1674, v1676);
+    auto v1985 = Sub(v1678, v1680);
+    auto v1986 = MulFixedPoint15(v1985, Set(d16, 29490));
+    auto v1987 = Add(v1984, v1986);
+    auto v1988 = Sub(v1684, v1686);
+    auto v1989 = Sub(v1688, v1690);
+    auto v1990 = MulFixedPoint15(v1989, Set(d16, 29490));
+    auto v1991 = Add(v1988, v1990);
+    auto v1992 = MulFixedPoint15(v1991, Set(d16, 18578));
+    auto v1993 = Add(v1987, v1992);
+    auto v1994 = Sub(v1696, v1698);
+    auto v1995 = Sub(v1700, v1702);
+    auto v1996 = MulFixedPoint15(v1995, Set(d16, 29490));
+    auto v1997 = Add(v1994, v1996);
+    auto v1998 = Sub(v1706, v1708);
+    auto v1999 = Sub(v1710, v1712);
+    auto v2000 = MulFixedPoint15(v1999, Set(d16, 29490));
+    auto v2001 = Add(v1998, v2000);
+    auto v2002 = MulFixedPoint15(v2001, Set(d16, 18578));
+    auto v2003 = Add(v1997, v2002);
+    auto v2004 = MulFixedPoint15(v2003, Set(d16, 16890));
+    auto v2005 = Add(v1993, v2004);
+    auto v2006 = MulFixedPoint15(v2005, Set(d16, 16508));
+    auto v2007 = Add(v1983, v2006);
+    auto v2008 = MulFixedPoint15(v2007, Set(d16, 16415));
+    auto v2009 = Add(v1961, v2008);
+    auto v2010 = Sub(v1724, v1726);
+    auto v2011 = Sub(v1728, v1730);
+    auto v2012 = MulFixedPoint15(v2011, Set(d16, 29490));
+    auto v2013 = Add(v2010, v2012);
+    auto v2014 = Sub(v1734, v1736);
+    auto v2015 = Sub(v1738, v1740);
+    auto v2016 = MulFixedPoint15(v2015, Set(d16, 29490));
+    auto v2017 = Add(v2014, v2016);
+    auto v2018 = MulFixedPoint15(v2017, Set(d16, 18578));
+    auto v2019 = Add(v2013, v2018);
+    auto v2020 = Sub(v1746, v1748);
+    auto v2021 = Sub(v1750, v1752);
+    auto v2022 = MulFixedPoint15(v2021, Set(d16, 29490));
+    auto v2023 = Add(v2020, v2022);
+    auto v2024 = Sub(v1756, v1758);
+    auto v2025 = Sub(v1760, v1762);
+    auto v2026 = MulFixedPoint15(v2025, Set(d16, 29490));
+    auto v2027 = Add(v2024, v2026);
+    auto v2028 = MulFixedPoint15(v2027, Set(d16, 18578));
+    auto v2029 = Add(v2023, v2028);
+    auto v2030 = MulFixedPoint15(v2029, Set(d16, 16890));
+    auto v2031 = Add(v2019, v2030);
+    auto v2032 = Sub(v1770, v1772);
+    auto v2033 = Sub(v1774, v1776);
+    auto v2034 = MulFixedPoint15(v2033, Set(d16, 29490));
+    auto v2035 = Add(v2032, v2034);
+    auto v2036 = Sub(v1780, v1782);
+    auto v2037 = Sub(v1784, v1786);
+    auto v2038 = MulFixedPoint15(v2037, Set(d16, 29490));
+    auto v2039 = Add(v2036, v2038);
+    auto v2040 = MulFixedPoint15(v2039, Set(d16, 18578));
+    auto v2041 = Add(v2035, v2040);
+    auto v2042 = Sub(v1792, v1794);
+    auto v2043 = Sub(v1796, v1798);
+    auto v2044 = MulFixedPoint15(v2043, Set(d16, 29490));
+    auto v2045 = Add(v2042, v2044);
+    auto v2046 = Sub(v1802, v1804);
+    auto v2047 = Sub(v1806, v1808);
+    auto v2048 = MulFixedPoint15(v2047, Set(d16, 29490));
+    auto v2049 = Add(v2046, v2048);
+    auto v2050 = MulFixedPoint15(v2049, Set(d16, 18578));
+    auto v2051 = Add(v2045, v2050);
+    auto v2052 = MulFixedPoint15(v2051, Set(d16, 16890));
+    auto v2053 = Add(v2041, v2052);
+    auto v2054 = MulFixedPoint15(v2053, Set(d16, 16508));
+    auto v2055 = Add(v2031, v2054);
+    auto v2056 = Sub(v1818, v1820);
+    auto v2057 = Sub(v1822, v1824);
+    auto v2058 = MulFixedPoint15(v2057, Set(d16, 29490));
+    auto v2059 = Add(v2056, v2058);
+    auto v2060 = Sub(v1828, v1830);
+    auto v2061 = Sub(v1832, v1834);
+    auto v2062 = MulFixedPoint15(v2061, Set(d16, 29490));
+    auto v2063 = Add(v2060, v2062);
+    auto v2064 = MulFixedPoint15(v2063, Set(d16, 18578));
+    auto v2065 = Add(v2059, v2064);
+    auto v2066 = Sub(v1840, v1842);
+    auto v2067 = Sub(v1844, v1846);
+    auto v2068 = MulFixedPoint15(v2067, Set(d16, 29490));
+    auto v2069 = Add(v2066, v2068);
+    auto v2070 = Sub(v1850, v1852);
+    auto v2071 = MulFixedPoint15(v2070, Set(d16, 18578));
+    auto v2072 = Sub(v1854, v1856);
+    auto v2073 = MulFixedPoint15(v2072, Set(d16, 16719));
+    auto v2074 = Add(v2071, v2073);
+    auto v2075 = Add(v2069, v2074);
+    auto v2076 = MulFixedPoint15(v2075, Set(d16, 16890));
+    auto v2077 = Add(v2065, v2076);
+    auto v2078 = Sub(v1864, v1866);
+    auto v2079 = Sub(v1868, v1870);
+    auto v2080 = MulFixedPoint15(v2079, Set(d16, 29490));
+    auto v2081 = Add(v2078, v2080);
+    auto v2082 = Sub(v1874, v1876);
+    auto v2083 = Sub(v1878, v1880);
+    auto v2084 = MulFixedPoint15(v2083, Set(d16, 29490));
+    auto v2085 = Add(v2082, v2084);
+    auto v2086 = MulFixedPoint15(v2085, Set(d16, 18578));
+    auto v2087 = Add(v2081, v2086);
+    auto v2088 = Sub(v1886, v1888);
+    auto v2089 = Sub(v1890, v1892);
+    auto v2090 = MulFixedPoint15(v2089, Set(d16, 29490));
+    auto v2091 = Add(v2088, v2090);
+    auto v2092 = Sub(v1896, v1898);
+    auto v2093 = Sub(v1900, v1902);
+    auto v2094 = MulFixedPoint15(v2093, Set(d16, 29490));
+    auto v2095 = Add(v2092, v2094);
+    auto v2096 = MulFixedPoint15(v2095, Set(d16, 18578));
+    auto v2097 = Add(v2091, v2096);
+    auto v2098 = MulFixedPoint15(v2097, Set(d16, 16890));
+    auto v2099 = Add(v2087, v2098);
+    auto v2100 = MulFixedPoint15(v2099, Set(d16, 16508));
+    auto v2101 = Add(v2077, v2100);
+    auto v2102 = MulFixedPoint15(v2101, Set(d16, 16415));
+    auto v2103 = Add(v2055, v2102);
+    auto v2104 = MulFixedPoint15(v2103, Set(d16, 16392));
+    auto v2105 = Add(v2009, v2104);
+    auto v2106 = Sub(v2, v8);
+    auto v2107 = Sub(v15, v22);
+    auto v2108_tmp = MulFixedPoint15(v2107, Set(d16, 18446));
+    auto v2108 = Add(v2108_tmp, Mul(v2107, Set(d16, 2)));
+    auto v2109 = Add(v2106, v2108);
+    auto v2110 = Sub(v31, v41);
+    auto v2111 = Sub(v48, v56);
+    auto v2112_tmp = MulFixedPoint15(v2111, Set(d16, 18446));
+    auto v2112 = Add(v2112_tmp, Mul(v2111, Set(d16, 2)));
+    auto v2113 = Add(v2110, v2112);
+    auto v2114 = MulFixedPoint15(v2113, Set(d16, 21195));
+    auto v2115 = Add(v2109, v2114);
+    auto v2116 = Sub(v67, v77);
+    auto v2117 = Sub(v90, v99);
+    auto v2118_tmp = MulFixedPoint15(v2117, Set(d16, 18446));
+    auto v2118 = Add(v2118_tmp, Mul(v2117, Set(d16, 2)));
+    auto v2119 = Add(v2116, v2118);
+    auto v2120 = Sub(v108, v118);
+    auto v2121 = Sub(v125, v134);
+    auto v2122_tmp = MulFixedPoint15(v2121, Set(d16, 18446));
+    auto v2122 = Add(v2122_tmp, Mul(v2121, Set(d16, 2)));
+    auto v2123 = Add(v2120, v2122);
+    auto v2124 = MulFixedPoint15(v2123, Set(d16, 21195));
+    auto v2125 = Add(v2119, v2124);
+    auto v2126 = MulFixedPoint15(v2125, Set(d16, 17401));
+    auto v2127 = Add(v2115, v2126);
+    auto v2128 = Sub(v147, v157);
+    auto v2129 = Sub(v170, v179);
+    auto v2130_tmp = MulFixedPoint15(v2129, Set(d16, 18446));
+    auto v2130 = Add(v2130_tmp, Mul(v2129, Set(d16, 2)));
+    auto v2131 = Add(v2128, v2130);
+    auto v2132 = Sub(v194, v212);
+    auto v2133 = Sub(v219, v229);
+    auto v2134_tmp = MulFixedPoint15(v2133, Set(d16, 18446));
+    auto v2134 = Add(v2134_tmp, Mul(v2133, Set(d16, 2)));
+    auto v2135 = Add(v2132, v2134);
+    auto v2136 = MulFixedPoint15(v2135, Set(d16, 21195));
+    auto v2137 = Add(v2131, v2136);
+    auto v2138 = Sub(v240, v250);
+    auto v2139 = Sub(v263, v272);
+    auto v2140_tmp = MulFixedPoint15(v2139, Set(d16, 18446));
+    auto v2140 = Add(v2140_tmp, Mul(v2139, Set(d16, 2)));
+    auto v2141 = Add(v2138, v2140);
+    auto v2142 = Sub(v281, v291);
+    auto v2143 = Sub(v298, v308);
+    auto v2144_tmp = MulFixedPoint15(v2143, Set(d16, 18446));
+    auto v2144 = Add(v2144_tmp, Mul(v2143, Set(d16, 2)));
+    auto v2145 = Add(v2142, v2144);
+    auto v2146 = MulFixedPoint15(v2145, Set(d16, 21195));
+    auto v2147 = Add(v2141, v2146);
+    auto v2148 = MulFixedPoint15(v2147, Set(d16, 17401));
+    auto v2149 = Add(v2137, v2148);
+    auto v2150 = MulFixedPoint15(v2149, Set(d16, 16629));
+    auto v2151 = Add(v2127, v2150);
+    auto v2152 = Sub(v323, v333);
+    auto v2153 = Sub(v346, v355);
+    auto v2154_tmp = MulFixedPoint15(v2153, Set(d16, 18446));
+    auto v2154 = Add(v2154_tmp, Mul(v2153, Set(d16, 2)));
+    auto v2155 = Add(v2152, v2154);
+    auto v2156 = Sub(v370, v388);
+    auto v2157 = Sub(v395, v405);
+    auto v2158_tmp = MulFixedPoint15(v2157, Set(d16, 18446));
+    auto v2158 = Add(v2158_tmp, Mul(v2157, Set(d16, 2)));
+    auto v2159 = Add(v2156, v2158);
+    auto v2160 = MulFixedPoint15(v2159, Set(d16, 21195));
+    auto v2161 = Add(v2155, v2160);
+    auto v2162 = Sub(v422, v440);
+    auto v2163 = Sub(v465, v478);
+    auto v2164_tmp = MulFixedPoint15(v2163, Set(d16, 18446));
+    auto v2164 = Add(v2164_tmp, Mul(v2163, Set(d16, 2)));
+    auto v2165 = Add(v2162, v2164);
+    auto v2166 = Sub(v487, v497);
+    auto v2167 = Sub(v504, v515);
+    auto v2168_tmp = MulFixedPoint15(v2167, Set(d16, 18446));
+    auto v2168 = Add(v2168_tmp, Mul(v2167, Set(d16, 2)));
+    auto v2169 = Add(v2166, v2168);
+    auto v2170 = MulFixedPoint15(v2169, Set(d16, 21195));
+    auto v2171 = Add(v2165, v2170);
+    auto v2172 = MulFixedPoint15(v2171, Set(d16, 17401));
+    auto v2173 = Add(v2161, v2172);
+    auto v2174 = Sub(v528, v538);
+    auto v2175 = Sub(v551, v560);
+    auto v2176_tmp = MulFixedPoint15(v2175, Set(d16, 18446));
+    auto v2176 = Add(v2176_tmp, Mul(v2175, Set(d16, 2)));
+    auto v2177 = Add(v2174, v2176);
+    auto v2178 = Sub(v575, v593);
+    auto v2179 = Sub(v600, v610);
+    auto v2180_tmp = MulFixedPoint15(v2179, Set(d16, 18446));
+    auto v2180 = Add(v2180_tmp, Mul(v2179, Set(d16, 2)));
+    auto v2181 = Add(v2178, v2180);
+    auto v2182 = MulFixedPoint15(v2181, Set(d16, 21195));
+    auto v2183 = Add(v2177, v2182);
+    auto v2184 = Sub(v621, v631);
+    auto v2185 = Sub(v644, v653);
+    auto v2186_tmp = MulFixedPoint15(v2185, Set(d16, 18446));
+    auto v2186 = Add(v2186_tmp, Mul(v2185, Set(d16, 2)));
+    auto v2187 = Add(v2184, v2186);
+    auto v2188 = Sub(v662, v672);
+    auto v2189 = Sub(v679, v690);
+    auto v2190_tmp = MulFixedPoint15(v2189, Set(d16, 18446));
+    auto v2190 = Add(v2190_tmp, Mul(v2189, Set(d16, 2)));
+    auto v2191 = Add(v2188, v2190);
+    auto v2192 = MulFixedPoint15(v2191, Set(d16, 21195));
+    auto v2193 = Add(v2187, v2192);
+    auto v2194 = MulFixedPoint15(v2193, Set(d16, 17401));
+    auto v2195 = Add(v2183, v2194);
+    auto v2196 = MulFixedPoint15(v2195, Set(d16, 16629));
+    auto v2197 = Add(v2173, v2196);
+    auto v2198 = MulFixedPoint15(v2197, Set(d16, 16445));
+    auto v2199 = Add(v2151, v2198);
+    auto v2200 = Sub(v707, v717);
+    auto v2201 = Sub(v730, v739);
+    auto v2202_tmp = MulFixedPoint15(v2201, Set(d16, 18446));
+    auto v2202 = Add(v2202_tmp, Mul(v2201, Set(d16, 2)));
+    auto v2203 = Add(v2200, v2202);
+    auto v2204 = Sub(v754, v772);
+    auto v2205 = Sub(v779, v789);
+    auto v2206_tmp = MulFixedPoint15(v2205, Set(d16, 18446));
+    auto v2206 = Add(v2206_tmp, Mul(v2205, Set(d16, 2)));
+    auto v2207 = Add(v2204, v2206);
+    auto v2208 = MulFixedPoint15(v2207, Set(d16, 21195));
+    auto v2209 = Add(v2203, v2208);
+    auto v2210 = Sub(v806, v824);
+    auto v2211 = Sub(v849, v862);
+    auto v2212_tmp = MulFixedPoint15(v2211, Set(d16, 18446));
+    auto v2212 = Add(v2212_tmp, Mul(v2211, Set(d16, 2)));
+    auto v2213 = Add(v2210, v2212);
+    auto v2214 = Sub(v871, v881);
+    auto v2215 = Sub(v888, v899);
+    auto v2216_tmp = MulFixedPoint15(v2215, Set(d16, 18446));
+    auto v2216 = Add(v2216_tmp, Mul(v2215, Set(d16, 2)));
+    auto v2217 = Add(v2214, v2216);
+    auto v2218 = MulFixedPoint15(v2217, Set(d16, 21195));
+    auto v2219 = Add(v2213, v2218);
+    auto v2220 = MulFixedPoint15(v2219, Set(d16, 17401));
+    auto v2221 = Add(v2209, v2220);
+    auto v2222 = Sub(v918, v936);
+    auto v2223 = Sub(v961, v974);
+    auto v2224_tmp = MulFixedPoint15(v2223, Set(d16, 18446));
+    auto v2224 = Add(v2224_tmp, Mul(v2223, Set(d16, 2)));
+    auto v2225 = Add(v2222, v2224);
+    auto v2226 = Sub(v1001, v1035);
+    auto v2227 = Sub(v1042, v1056);
+    auto v2228_tmp = MulFixedPoint15(v2227, Set(d16, 18446));
+    auto v2228 = Add(v2228_tmp, Mul(v2227, Set(d16, 2)));
+    auto v2229 = Add(v2226, v2228);
+    auto v2230 = MulFixedPoint15(v2229, Set(d16, 21195));
+    auto v2231 = Add(v2225, v2230);
+    auto v2232 = Sub(v1067, v1077);
+    auto v2233 = Sub(v1090, v1099);
+    auto v2234_tmp = MulFixedPoint15(v2233, Set(d16, 18446));
+    auto v2234 = Add(v2234_tmp, Mul(v2233, Set(d16, 2)));
+    auto v2235 = Add(v2232, v2234);
+    auto v2236 = Sub(v1108, v1118);
+    auto v2237 = Sub(v1125, v1137);
+    auto v2238_tmp = MulFixedPoint15(v2237, Set(d16, 18446));
+    auto v2238 = Add(v2238_tmp, Mul(v2237, Set(d16, 2)));
+    auto v2239 = Add(v2236, v2238);
+    auto v2240 = MulFixedPoint15(v2239, Set(d16, 21195));
+    auto v2241 = Add(v2235, v2240);
+    auto v2242 = MulFixedPoint15(v2241, Set(d16, 17401));
+    auto v2243 = Add(v2231, v2242);
+    auto v2244 = MulFixedPoint15(v2243, Set(d16, 16629));
+    auto v2245 = Add(v2221, v2244);
+    auto v2246 = Sub(v1152, v1162);
+    auto v2247 = Sub(v1175, v1184);
+    auto v2248_tmp = MulFixedPoint15(v2247, Set(d16, 18446));
+    auto v2248 = Add(v2248_tmp, Mul(v2247, Set(d16, 2)));
+    auto v2249 = Add(v2246, v2248);
+    auto v2250 = Sub(v1199, v1217);
+    auto v2251 = Sub(v1224, v1234);
+    auto v2252_tmp = MulFixedPoint15(v2251, Set(d16, 18446));
+    auto v2252 = Add(v2252_tmp, Mul(v2251, Set(d16, 2)));
+    auto v2253 = Add(v2250, v2252);
+    auto v2254 = MulFixedPoint15(v2253, Set(d16, 21195));
+    auto v2255 = Add(v2249, v2254);
+    auto v2256 = Sub(v1251, v1269);
+    auto v2257 = Sub(v1294, v1307);
+    auto v2258_tmp = MulFixedPoint15(v2257, Set(d16, 18446));
+    auto v2258 = Add(v2258_tmp, Mul(v2257, Set(d16, 2)));
+    auto v2259 = Add(v2256, v2258);
+    auto v2260 = Sub(v1316, v1326);
+    auto v2261 = Sub(v1333, v1344);
+    auto v2262_tmp = MulFixedPoint15(v2261, Set(d16, 18446));
+    auto v2262 = Add(v2262_tmp, Mul(v2261, Set(d16, 2)));
+    auto v2263 = Add(v2260, v2262);
+    auto v2264 = MulFixedPoint15(v2263, Set(d16, 21195));
+    auto v2265 = Add(v2259, v2264);
+    auto v2266 = MulFixedPoint15(v2265, Set(d16, 17401));
+    auto v2267 = Add(v2255, v2266);
+    auto v2268 = Sub(v1357, v1367);
+    auto v2269 = Sub(v1380, v1389);
+    auto v2270_tmp = MulFixedPoint15(v2269, Set(d16, 18446));
+    auto v2270 = Add(v2270_tmp, Mul(v2269, Set(d16, 2)));
+    auto v2271 = Add(v2268, v2270);
+    auto v2272 = Sub(v1404, v1422);
+    auto v2273 = Sub(v1429, v1439);
+    auto v2274_tmp = MulFixedPoint15(v2273, Set(d16, 18446));
+    auto v2274 = Add(v2274_tmp, Mul(v2273, Set(d16, 2)));
+    auto v2275 = Add(v2272, v2274);
+    auto v2276 = MulFixedPoint15(v2275, Set(d16, 21195));
+    auto v2277 = Add(v2271, v2276);
+    auto v2278 = Sub(v1450, v1460);
+    auto v2279 = Sub(v1473, v1482);
+    auto v2280_tmp = MulFixedPoint15(v2279, Set(d16, 18446));
+    auto v2280 = Add(v2280_tmp, Mul(v2279, Set(d16, 2)));
+    auto v2281 = Add(v2278, v2280);
+    auto v2282 = Sub(v1491, v1501);
+    auto v2283 = Sub(v1508, v1520);
+    auto v2284_tmp = MulFixedPoint15(v2283, Set(d16, 18446));
+    auto v2284 = Add(v2284_tmp, Mul(v2283, Set(d16, 2)));
+    auto v2285 = Add(v2282, v2284);
+    auto v2286 = MulFixedPoint15(v2285, Set(d16, 21195));
+    auto v2287 = Add(v2281, v2286);
+    auto v2288 = MulFixedPoint15(v2287, Set(d16, 17401));
+    auto v2289 = Add(v2277, v2288);
+    auto v2290 = MulFixedPoint15(v2289, Set(d16, 16629));
+    auto v2291 = Add(v2267, v2290);
+    auto v2292 = MulFixedPoint15(v2291, Set(d16, 16445));
+    auto v2293 = Add(v2245, v2292);
+    auto v2294 = MulFixedPoint15(v2293, Set(d16, 16399));
+    auto v2295 = Add(v2199, v2294);
+    auto v2296 = Sub(v2106, v2108);
+    auto v2297 = Sub(v2110, v2112);
+    auto v2298 = MulFixedPoint15(v2297, Set(d16, 25826));
+    auto v2299 = Add(v2296, v2298);
+    auto v2300 = Sub(v2116, v2118);
+    auto v2301 = Sub(v2120, v2122);
+    auto v2302 = MulFixedPoint15(v2301, Set(d16, 25826));
+    auto v2303 = Add(v2300, v2302);
+    auto v2304 = MulFixedPoint15(v2303, Set(d16, 18124));
+    auto v2305 = Add(v2299, v2304);
+    auto v2306 = Sub(v2128, v2130);
+    auto v2307 = Sub(v2132, v2134);
+    auto v2308 = MulFixedPoint15(v2307, Set(d16, 25826));
+    auto v2309 = Add(v2306, v2308);
+    auto v2310 = Sub(v2138, v2140);
+    auto v2311 = Sub(v2142, v2144);
+    auto v2312 = MulFixedPoint15(v2311, Set(d16, 25826));
+    auto v2313 = Add(v2310, v2312);
+    auto v2314 = MulFixedPoint15(v2313, Set(d16, 18124));
+    auto v2315 = Add(v2309, v2314);
+    auto v2316 = MulFixedPoint15(v2315, Set(d16, 16792));
+    auto v2317 = Add(v2305, v2316);
+    auto v2318 = Sub(v2152, v2154);
+    auto v2319 = Sub(v2156, v2158);
+    auto v2320 = MulFixedPoint15(v2319, Set(d16, 25826));
+    auto v2321 = Add(v2318, v2320);
+    auto v2322 = Sub(v2162, v2164);
+    auto v2323 = Sub(v2166, v2168);
+    auto v2324 = MulFixedPoint15(v2323, Set(d16, 25826));
+    auto v2325 = Add(v2322, v2324);
+    auto v2326 = MulFixedPoint15(v2325, Set(d16, 18124));
+    auto v2327 = Add(v2321, v2326);
+    auto v2328 = Sub(v2174, v2176);
+    auto v2329 = Sub(v2178, v2180);
+    auto v2330 = MulFixedPoint15(v2329, Set(d16, 25826));
+    auto v2331 = Add(v2328, v2330);
+    auto v2332 = Sub(v2184, v2186);
+    auto v2333 = Sub(v2188, v2190);
+    auto v2334 = MulFixedPoint15(v2333, Set(d16, 25826));
+    auto v2335 = Add(v2332, v2334);
+    auto v2336 = MulFixedPoint15(v2335, Set(d16, 18124));
+    auto v2337 = Add(v2331, v2336);
+    auto v2338 = MulFixedPoint15(v2337, Set(d16, 16792));
+    auto v2339 = Add(v2327, v2338);
+    auto v2340 = MulFixedPoint15(v2339, Set(d16, 16484));
+    auto v2341 = Add(v2317, v2340);
+    auto v2342 = Sub(v2200, v2202);
+    auto v2343 = Sub(v2204, v2206);
+    auto v2344 = MulFixedPoint15(v2343, Set(d16, 25826));
+    auto v2345 = Add(v2342, v2344);
+    auto v2346 = Sub(v2210, v2212);
+    auto v2347 = Sub(v2214, v2216);
+    auto v2348 = MulFixedPoint15(v2347, Set(d16, 25826));
+    auto v2349 = Add(v2346, v2348);
+    auto v2350 = MulFixedPoint15(v2349, Set(d16, 18124));
+    auto v2351 = Add(v2345, v2350);
+    auto v2352 = Sub(v2222, v2224);
+    auto v2353 = Sub(v2226, v2228);
+    auto v2354 = MulFixedPoint15(v2353, Set(d16, 25826));
+    auto v2355 = Add(v2352, v2354);
+    auto v2356 = Sub(v2232, v2234);
+    auto v2357 = Sub(v2236, v2238);
+    auto v2358 = MulFixedPoint15(v2357, Set(d16, 25826));
+    auto v2359 = Add(v2356, v2358);
+    auto v2360 = MulFixedPoint15(v2359, Set(d16, 18124));
+    auto v2361 = Add(v2355, v2360);
+    auto v2362 = MulFixedPoint15(v2361, Set(d16, 16792));
+    auto v2363 = Add(v2351, v2362);
+    auto v2364 = Sub(v2246, v2248);
+    auto v2365 = Sub(v2250, v2252);
+    auto v2366 = MulFixedPoint15(v2365, Set(d16, 25826));
+    auto v2367 = Add(v2364, v2366);
+    auto v2368 = Sub(v2256, v2258);
+    auto v2369 = Sub(v2260, v2262);
+    auto v2370 = MulFixedPoint15(v2369, Set(d16, 25826));
+    auto v2371 = Add(v2368, v2370);
+    auto v2372 = MulFixedPoint15(v2371, Set(d16, 18124));
+    auto v2373 = Add(v2367, v2372);
+    auto v2374 = Sub(v2268, v2270);
+    auto v2375 = Sub(v2272, v2274);
+    auto v2376 = MulFixedPoint15(v2375, Set(d16, 25826));
+    auto v2377 = Add(v2374, v2376);
+    auto v2378 = Sub(v2278, v2280);
+    auto v2379 = Sub(v2282, v2284);
+    auto v2380 = MulFixedPoint15(v2379, Set(d16, 25826));
+    auto v2381 = Add(v2378, v2380);
+    auto v2382 = MulFixedPoint15(v2381, Set(d16, 18124));
+    auto v2383 = Add(v2377, v2382);
+    auto v2384 = MulFixedPoint15(v2383, Set(d16, 16792));
+    auto v2385 = Add(v2373, v2384);
+    auto v2386 = MulFixedPoint15(v2385, Set(d16, 16484));
+    auto v2387 = Add(v2363, v2386);
+    auto v2388 = MulFixedPoint15(v2387, Set(d16, 16409));
+    auto v2389 = Add(v2341, v2388);
+    auto v2390 = Sub(v1916, v1918);
+    auto v2391 = Sub(v1920, v1922);
+    auto v2392_tmp = MulFixedPoint15(v2391, Set(d16, 1988));
+    auto v2392 = Add(v2392_tmp, v2391);
+    auto v2393 = Add(v2390, v2392);
+    auto v2394 = Sub(v1926, v1928);
+    auto v2395 = Sub(v1930, v1932);
+    auto v2396_tmp = MulFixedPoint15(v2395, Set(d16, 1988));
+    auto v2396 = Add(v2396_tmp, v2395);
+    auto v2397 = Add(v2394, v2396);
+    auto v2398 = MulFixedPoint15(v2397, Set(d16, 19102));
+    auto v2399 = Add(v2393, v2398);
+    auto v2400 = Sub(v1938, v1940);
+    auto v2401 = Sub(v1942, v1944);
+    auto v2402_tmp = MulFixedPoint15(v2401, Set(d16, 1988));
+    auto v2402 = Add(v2402_tmp, v2401);
+    auto v2403 = Add(v2400, v2402);
+    auto v2404 = Sub(v1948, v1950);
+    auto v2405 = Sub(v1952, v1954);
+    auto v2406_tmp = MulFixedPoint15(v2405, Set(d16, 1988));
+    auto v2406 = Add(v2406_tmp, v2405);
+    auto v2407 = Add(v2404, v2406);
+    auto v2408 = MulFixedPoint15(v2407, Set(d16, 19102));
+    auto v2409 = Add(v2403, v2408);
+    auto v2410 = MulFixedPoint15(v2409, Set(d16, 17000));
+    auto v2411 = Add(v2399, v2410);
+    auto v2412 = Sub(v1962, v1964);
+    auto v2413 = Sub(v1966, v1968);
+    auto v2414_tmp = MulFixedPoint15(v2413, Set(d16, 1988));
+    auto v2414 = Add(v2414_tmp, v2413);
+    auto v2415 = Add(v2412, v2414);
+    auto v2416 = Sub(v1972, v1974);
+    auto v2417 = Sub(v1976, v1978);
+    auto v2418_tmp = MulFixedPoint15(v2417, Set(d16, 1988));
+    auto v2418 = Add(v2418_tmp, v2417);
+    auto v2419 = Add(v2416, v2418);
+    auto v2420 = MulFixedPoint15(v2419, Set(d16, 19102));
+    auto v2421 = Add(v2415, v2420);
+    auto v2422 = Sub(v1984, v1986);
+    auto v2423 = Sub(v1988, v1990);
+    auto v2424_tmp = MulFixedPoint15(v2423, Set(d16, 1988));
+    auto v2424 = Add(v2424_tmp, v2423);
+    auto v2425 = Add(v2422, v2424);
+    auto v2426 = Sub(v1994, v1996);
+    auto v2427 = Sub(v1998, v2000);
+    auto v2428_tmp = MulFixedPoint15(v2427, Set(d16, 1988));
+    auto v2428 = Add(v2428_tmp, v2427);
+    auto v2429 = Add(v2426, v2428);
+    auto v2430 = MulFixedPoint15(v2429, Set(d16, 19102));
+    auto v2431 = Add(v2425, v2430);
+    auto v2432 = MulFixedPoint15(v2431, Set(d16, 17000));
+    auto v2433 = Add(v2421, v2432);
+    auto v2434 = MulFixedPoint15(v2433, Set(d16, 16534));
+    auto v2435 = Add(v2411, v2434);
+    auto v2436 = Sub(v2010, v2012);
+    auto v2437 = Sub(v2014, v2016);
+    auto v2438_tmp = MulFixedPoint15(v2437, Set(d16, 1988));
+    auto v2438 = Add(v2438_tmp, v2437);
+    auto v2439 = Add(v2436, v2438);
+    auto v2440 = Sub(v2020, v2022);
+    auto v2441 = Sub(v2024, v2026);
+    auto v2442_tmp = MulFixedPoint15(v2441, Set(d16, 1988));
+    auto v2442 = Add(v2442_tmp, v2441);
+    auto v2443 = Add(v2440, v2442);
+    auto v2444 = MulFixedPoint15(v2443, Set(d16, 19102));
+    auto v2445 = Add(v2439, v2444);
+    auto v2446 = Sub(v2032, v2034);
+    auto v2447 = Sub(v2036, v2038);
+    auto v2448_tmp = MulFixedPoint15(v2447, Set(d16, 1988));
+    auto v2448 = Add(v2448_tmp, v2447);
+    auto v2449 = Add(v2446, v2448);
+    auto v2450 = Sub(v2042, v2044);
+    auto v2451 = Sub(v2046, v2048);
+    auto v2452_tmp = MulFixedPoint15(v2451, Set(d16, 1988));
+    auto v2452 = Add(v2452_tmp, v2451);
+    auto v2453 = Add(v2450, v2452);
+    auto v2454 = MulFixedPoint15(v2453, Set(d16, 19102));
+    auto v2455 = Add(v2449, v2454);
+    auto v2456 = MulFixedPoint15(v2455, Set(d16, 17000));
+    auto v2457 = Add(v2445, v2456);
+    auto v2458 = Sub(v2056, v2058);
+    auto v2459 = Sub(v2060, v2062);
+    auto v2460_tmp = MulFixedPoint15(v2459, Set(d16, 1988));
+    auto v2460 = Add(v2460_tmp, v2459);
+    auto v2461 = Add(v2458, v2460);
+    auto v2462 = Sub(v2066, v2068);
+    auto v2463 = MulFixedPoint15(v2072, Set(d16, 29490));
+    auto v2464 = Sub(v2070, v2463);
+    auto v2465_tmp = MulFixedPoint15(v2464, Set(d16, 1988));
+    auto v2465 = Add(v2465_tmp, v2464);
+    auto v2466 = Add(v2462, v2465);
+    auto v2467 = MulFixedPoint15(v2466, Set(d16, 19102));
+    auto v2468 = Add(v2461, v2467);
+    auto v2469 = Sub(v2078, v2080);
+    auto v2470 = Sub(v2082, v2084);
+    auto v2471_tmp = MulFixedPoint15(v2470, Set(d16, 1988));
+    auto v2471 = Add(v2471_tmp, v2470);
+    auto v2472 = Add(v2469, v2471);
+    auto v2473 = Sub(v2088, v2090);
+    auto v2474 = Sub(v2092, v2094);
+    auto v2475_tmp = MulFixedPoint15(v2474, Set(d16, 1988));
+    auto v2475 = Add(v2475_tmp, v2474);
+    auto v2476 = Add(v2473, v2475);
+    auto v2477 = MulFixedPoint15(v2476, Set(d16, 19102));
+    auto v2478 = Add(v2472, v2477);
+    auto v2479 = MulFixedPoint15(v2478, Set(d16, 17000));
+    auto v2480 = Add(v2468, v2479);
+    auto v2481 = MulFixedPoint15(v2480, Set(d16, 16534));
+    auto v2482 = Add(v2457, v2481);
+    auto v2483 = MulFixedPoint15(v2482, Set(d16, 16421));
+    auto v2484 = Add(v2435, v2483);
+    auto v2485 = Sub(v1537, v1542);
+    auto v2486 = Sub(v1547, v1552);
+    auto v2487_tmp = MulFixedPoint15(v2486, Set(d16, 23673));
+    auto v2487 = Add(v2487_tmp, v2486);
+    auto v2488 = Add(v2485, v2487);
+    auto v2489 = Sub(v1559, v1564);
+    auto v2490 = Sub(v1569, v1574);
+    auto v2491_tmp = MulFixedPoint15(v2490, Set(d16, 23673));
+    auto v2491 = Add(v2491_tmp, v2490);
+    auto v2492 = Add(v2489, v2491);
+    auto v2493 = MulFixedPoint15(v2492, Set(d16, 20398));
+    auto v2494 = Add(v2488, v2493);
+    auto v2495 = Sub(v1583, v1588);
+    auto v2496 = Sub(v1593, v1598);
+    auto v2497_tmp = MulFixedPoint15(v2496, Set(d16, 23673));
+    auto v2497 = Add(v2497_tmp, v2496);
+    auto v2498 = Add(v2495, v2497);
+    auto v2499 = Sub(v1605, v1610);
+    auto v2500 = Sub(v1615, v1620);
+    auto v2501_tmp = MulFixedPoint15(v2500, Set(d16, 23673));
+    auto v2501 = Add(v2501_tmp, v2500);
+    auto v2502 = Add(v2499, v2501);
+    auto v2503 = MulFixedPoint15(v2502, Set(d16, 20398));
+    auto v2504 = Add(v2498, v2503);
+    auto v2505 = MulFixedPoint15(v2504, Set(d16, 17255));
+    auto v2506 = Add(v2494, v2505);
+    auto v2507 = Sub(v1631, v1636);
+    auto v2508 = Sub(v1641, v1646);
+    auto v2509_tmp = MulFixedPoint15(v2508, Set(d16, 23673));
+    auto v2509 = Add(v2509_tmp, v2508);
+    auto v2510 = Add(v2507, v2509);
+    auto v2511 = Sub(v1653, v1658);
+    auto v2512 = Sub(v1663, v1668);
+    auto v2513_tmp = MulFixedPoint15(v2512, Set(d16, 23673));
+    auto v2513 = Add(v2513_tmp, v2512);
+    auto v2514 = Add(v2511, v2513);
+    auto v2515 = MulFixedPoint15(v2514, Set(d16, 20398));
+    auto v2516 = Add(v2510, v2515);
+    auto v2517 = Sub(v1677, v1682);
+    auto v2518 = Sub(v1687, v1692);
+    auto v2519_tmp = MulFixedPoint15(v2518, Set(d16, 23673));
+    auto v2519 = Add(v2519_tmp, v2518);
+    auto v2520 = Add(v2517, v2519);
+    auto v2521 = Sub(v1699, v1704);
+    auto v2522 = Sub(v1709, v1714);
+    auto v2523_tmp = MulFixedPoint15(v2522, Set(d16, 23673));
+    auto v2523 = Add(v2523_tmp, v2522);
+    auto v2524 = Add(v2521, v2523);
+    auto v2525 = MulFixedPoint15(v2524, Set(d16, 20398));
+    auto v2526 = Add(v2520, v2525);
+    auto v2527 = MulFixedPoint15(v2526, Set(d16, 17255));
+    auto v2528 = Add(v2516, v2527);
+    auto v2529 = MulFixedPoint15(v2528, Set(d16, 16595));
+    auto v2530 = Add(v2506, v2529);
+    auto v2531 = Sub(v1727, v1732);
+    auto v2532 = Sub(v1737, v1742);
+    auto v2533_tmp = MulFixedPoint15(v2532, Set(d16, 23673));
+    auto v2533 = Add(v2533_tmp, v2532);
+    auto v2534 = Add(v2531, v2533);
+    auto v2535 = Sub(v1749, v1754);
+    auto v2536 = Sub(v1759, v1764);
+    auto v2537_tmp = MulFixedPoint15(v2536, Set(d16, 23673));
+    auto v2537 = Add(v2537_tmp, v2536);
+    auto v2538 = Add(v2535, v2537);
+    auto v2539 = MulFixedPoint15(v2538, Set(d16, 20398));
+    auto v2540 = Add(v2534, v2539);
+    auto v2541 = Sub(v1773, v1778);
+    auto v2542 = Sub(v1783, v1788);
+    auto v2543_tmp = MulFixedPoint15(v2542, Set(d16, 23673));
+    auto v2543 = Add(v2543_tmp, v2542);
+    auto v2544 = Add(v2541, v2543);
+    auto v2545 = Sub(v1795, v1800);
+    auto v2546 = Sub(v1805, v1810);
+    auto v2547_tmp = MulFixedPoint15(v2546, Set(d16, 23673));
+    auto v2547 = Add(v2547_tmp, v2546);
+    auto v2548 = Add(v2545, v2547);
+    auto v2549 = MulFixedPoint15(v2548, Set(d16, 20398));
+    auto v2550 = Add(v2544, v2549);
+    auto v2551 = MulFixedPoint15(v2550, Set(d16, 17255));
+    auto v2552 = Add(v2540, v2551);
+    auto v2553 = Sub(v1821, v1826);
+    auto v2554 = Sub(v1831, v1836);
+    auto v2555_tmp = MulFixedPoint15(v2554, Set(d16, 23673));
+    auto v2555 = Add(v2555_tmp, v2554);
+    auto v2556 = Add(v2553, v2555);
+    auto v2557 = Sub(v1843, v1848);
+    auto v2558 = Sub(v1853, v1858);
+    auto v2559_tmp = MulFixedPoint15(v2558, Set(d16, 23673));
+    auto v2559 = Add(v2559_tmp, v2558);
+    auto v2560 = Add(v2557, v2559);
+    auto v2561 = MulFixedPoint15(v2560, Set(d16, 20398));
+    auto v2562 = Add(v2556, v2561);
+    auto v2563 = Sub(v1867, v1872);
+    auto v2564 = Sub(v1877, v1882);
+    auto v2565_tmp = MulFixedPoint15(v2564, Set(d16, 23673));
+    auto v2565 = Add(v2565_tmp, v2564);
+    auto v2566 = Add(v2563, v2565);
+    auto v2567 = Sub(v1889, v1894);
+    auto v2568 = Sub(v1899, v1904);
+    auto v2569_tmp = MulFixedPoint15(v2568, Set(d16, 23673));
+    auto v2569 = Add(v2569_tmp, v2568);
+    auto v2570 = Add(v2567, v2569);
+    auto v2571 = MulFixedPoint15(v2570, Set(d16, 20398));
+    auto v2572 = Add(v2566, v2571);
+    auto v2573 = MulFixedPoint15(v2572, Set(d16, 17255));
+    auto v2574 = Add(v2562, v2573);
+    auto v2575 = MulFixedPoint15(v2574, Set(d16, 16595));
+    auto v2576 = Add(v2552, v2575);
+    auto v2577 = MulFixedPoint15(v2576, Set(d16, 16436));
+    auto v2578 = Add(v2530, v2577);
+    auto v2579 = Sub(v9, v24);
+    auto v2580 = Sub(v42, v58);
+    auto v2581_tmp = MulFixedPoint15(v2580, Set(d16, 3314));
+    auto v2581 = Add(v2581_tmp, Mul(v2580, Set(d16, 5)));
+    auto v2582 = Add(v2579, v2581);
+    auto v2583 = Sub(v78, v101);
+    auto v2584 = Sub(v119, v136);
+    auto v2585_tmp = MulFixedPoint15(v2584, Set(d16, 3314));
+    auto v2585 = Add(v2585_tmp, Mul(v2584, Set(d16, 5)));
+    auto v2586 = Add(v2583, v2585);
+    auto v2587 = MulFixedPoint15(v2586, Set(d16, 22112));
+    auto v2588 = Add(v2582, v2587);
+    auto v2589 = Sub(v158, v181);
+    auto v2590 = Sub(v213, v231);
+    auto v2591_tmp = MulFixedPoint15(v2590, Set(d16, 3314));
+    auto v2591 = Add(v2591_tmp, Mul(v2590, Set(d16, 5)));
+    auto v2592 = Add(v2589, v2591);
+    auto v2593 = Sub(v251, v274);
+    auto v2594 = Sub(v292, v310);
+    auto v2595_tmp = MulFixedPoint15(v2594, Set(d16, 3314));
+    auto v2595 = Add(v2595_tmp, Mul(v2594, Set(d16, 5)));
+    auto v2596 = Add(v2593, v2595);
+    auto v2597 = MulFixedPoint15(v2596, Set(d16, 22112));
+    auto v2598 = Add(v2592, v2597);
+    auto v2599 = MulFixedPoint15(v2598, Set(d16, 17561));
+    auto v2600 = Add(v2588, v2599);
+    auto v2601 = Sub(v334, v357);
+    auto v2602 = Sub(v389, v407);
+    auto v2603_tmp = MulFixedPoint15(v2602, Set(d16, 3314));
+    auto v2603 = Add(v2603_tmp, Mul(v2602, Set(d16, 5)));
+    auto v2604 = Add(v2601, v2603);
+    auto v2605 = Sub(v441, v480);
+    auto v2606 = Sub(v498, v517);
+    auto v2607_tmp = MulFixedPoint15(v2606, Set(d16, 3314));
+    auto v2607 = Add(v2607_tmp, Mul(v2606, Set(d16, 5)));
+    auto v2608 = Add(v2605, v2607);
+    auto v2609 = MulFixedPoint15(v2608, Set(d16, 22112));
+    auto v2610 = Add(v2604, v2609);
+    auto v2611 = Sub(v539, v562);
+    auto v2612 = Sub(v594, v612);
+    auto v2613_tmp = MulFixedPoint15(v2612, Set(d16, 3314));
+    auto v2613 = Add(v2613_tmp, Mul(v2612, Set(d16, 5)));
+    auto v2614 = Add(v2611, v2613);
+    auto v2615 = Sub(v632, v655);
+    auto v2616 = Sub(v673, v692);
+    auto v2617_tmp = MulFixedPoint15(v2616, Set(d16, 3314));
+    auto v2617 = Add(v2617_tmp, Mul(v2616, Set(d16, 5)));
+    auto v2618 = Add(v2615, v2617);
+    auto v2619 = MulFixedPoint15(v2618, Set(d16, 22112));
+    auto v2620 = Add(v2614, v2619);
+    auto v2621 = MulFixedPoint15(v2620, Set(d16, 17561));
+    auto v2622 = Add(v2610, v2621);
+    auto v2623 = MulFixedPoint15(v2622, Set(d16, 16666));
+    auto v2624 = Add(v2600, v2623);
+    auto v2625 = Sub(v718, v741);
+    auto v2626 = Sub(v773, v791);
+    auto v2627_tmp = MulFixedPoint15(v2626, Set(d16, 3314));
+    auto v2627 = Add(v2627_tmp, Mul(v2626, Set(d16, 5)));
+    auto v2628 = Add(v2625, v2627);
+    auto v2629 = Sub(v825, v864);
+    auto v2630 = Sub(v882, v901);
+    auto v2631_tmp = MulFixedPoint15(v2630, Set(d16, 3314));
+    auto v2631 = Add(v2631_tmp, Mul(v2630, Set(d16, 5)));
+    auto v2632 = Add(v2629, v2631);
+    auto v2633 = MulFixedPoint15(v2632, Set(d16, 22112));
+    auto v2634 = Add(v2628, v2633);
+    auto v2635 = Sub(v937, v976);
+    auto v2636 = Sub(v1036, v1058);
+    auto v2637_tmp = MulFixedPoint15(v2636, Set(d16, 3314));
+    auto v2637 = Add(v2637_tmp, Mul(v2636, Set(d16, 5)));
+    auto v2638 = Add(v2635, v2637);
+    auto v2639 = Sub(v1078, v1101);
+    auto v2640 = Sub(v1119, v1139);
+    auto v2641_tmp = MulFixedPoint15(v2640, Set(d16, 3314));
+    auto v2641 = Add(v2641_tmp, Mul(v2640, Set(d16, 5)));
+    auto v2642 = Add(v2639, v2641);
+    auto v2643 = MulFixedPoint15(v2642, Set(d16, 22112));
+    auto v2644 = Add(v2638, v2643);
+    auto v2645 = MulFixedPoint15(v2644, Set(d16, 17561));
+    auto v2646 = Add(v2634, v2645);
+    auto v2647 = Sub(v1163, v1186);
+    auto v2648 = Sub(v1218, v1236);
+    auto v2649_tmp = MulFixedPoint15(v2648, Set(d16, 3314));
+    auto v2649 = Add(v2649_tmp, Mul(v2648, Set(d16, 5)));
+    auto v2650 = Add(v2647, v2649);
+    auto v2651 = Sub(v1270, v1309);
+    auto v2652 = Sub(v1327, v1346);
+    auto v2653_tmp = MulFixedPoint15(v2652, Set(d16, 3314));
+    auto v2653 = Add(v2653_tmp, Mul(v2652, Set(d16, 5)));
+    auto v2654 = Add(v2651, v2653);
+    auto v2655 = MulFixedPoint15(v2654, Set(d16, 22112));
+    auto v2656 = Add(v2650, v2655);
+    auto v2657 = Sub(v1368, v1391);
+    auto v2658 = Sub(v1423, v1441);
+    auto v2659_tmp = MulFixedPoint15(v2658, Set(d16, 3314));
+    auto v2659 = Add(v2659_tmp, Mul(v2658, Set(d16, 5)));
+    auto v2660 = Add(v2657, v2659);
+    auto v2661 = Sub(v1461, v1484);
+    auto v2662 = Sub(v1502, v1522);
+    auto v2663_tmp = MulFixedPoint15(v2662, Set(d16, 3314));
+    auto v2663 = Add(v2663_tmp, Mul(v2662, Set(d16, 5)));
+    auto v2664 = Add(v2661, v2663);
+    auto v2665 = MulFixedPoint15(v2664, Set(d16, 22112));
+    auto v2666 = Add(v2660, v2665);
+    auto v2667 = MulFixedPoint15(v2666, Set(d16, 17561));
+    auto v2668 = Add(v2656, v2667);
+    auto v2669 = MulFixedPoint15(v2668, Set(d16, 16666));
+    auto v2670 = Add(v2646, v2669);
+    auto v2671 = MulFixedPoint15(v2670, Set(d16, 16454));
+    auto v2672 = Add(v2624, v2671);
+    auto v2673 = Sub(v2579, v2581);
+    auto v2674 = Sub(v2583, v2585);
+    auto v2675 = MulFixedPoint15(v2674, Set(d16, 24397));
+    auto v2676 = Add(v2673, v2675);
+    auto v2677 = Sub(v2589, v2591);
+    auto v2678 = Sub(v2593, v2595);
+    auto v2679 = MulFixedPoint15(v2678, Set(d16, 24397));
+    auto v2680 = Add(v2677, v2679);
+    auto v2681 = MulFixedPoint15(v2680, Set(d16, 17921));
+    auto v2682 = Add(v2676, v2681);
+    auto v2683 = Sub(v2601, v2603);
+    auto v2684 = Sub(v2605, v2607);
+    auto v2685 = MulFixedPoint15(v2684, Set(d16, 24397));
+    auto v2686 = Add(v2683, v2685);
+    auto v2687 = Sub(v2611, v2613);
+    auto v2688 = Sub(v2615, v2617);
+    auto v2689 = MulFixedPoint15(v2688, Set(d16, 24397));
+    auto v2690 = Add(v2687, v2689);
+    auto v2691 = MulFixedPoint15(v2690, Set(d16, 17921));
+    auto v2692 = Add(v2686, v2691);
+    auto v2693 = MulFixedPoint15(v2692, Set(d16, 16747));
+    auto v2694 = Add(v2682, v2693);
+    auto v2695 = Sub(v2625, v2627);
+    auto v2696 = Sub(v2629, v2631);
+    auto v2697 = MulFixedPoint15(v2696, Set(d16, 24397));
+    auto v2698 = Add(v2695, v2697);
+    auto v2699 = Sub(v2635, v2637);
+    auto v2700 = Sub(v2639, v2641);
+    auto v2701 = MulFixedPoint15(v2700, Set(d16, 24397));
+    auto v2702 = Add(v2699, v2701);
+    auto v2703 = MulFixedPoint15(v2702, Set(d16, 17921));
+    auto v2704 = Add(v2698, v2703);
+    auto v2705 = Sub(v2647, v2649);
+    auto v2706 = Sub(v2651, v2653);
+    auto v2707 = MulFixedPoint15(v2706, Set(d16, 24397));
+    auto v2708 = Add(v2705, v2707);
+    auto v2709 = Sub(v2657, v2659);
+    auto v2710 = Sub(v2661, v2663);
+    auto v2711 = MulFixedPoint15(v2710, Set(d16, 24397));
+    auto v2712 = Add(v2709, v2711);
+    auto v2713 = MulFixedPoint15(v2712, Set(d16, 17921));
+    auto v2714 = Add(v2708, v2713);
+    auto v2715 = MulFixedPoint15(v2714, Set(d16, 16747));
+    auto v2716 = Add(v2704, v2715);
+    auto v2717 = MulFixedPoint15(v2716, Set(d16, 16474));
+    auto v2718 = Add(v2694, v2717);
+    auto v2719 = Sub(v2485, v2487);
+    auto v2720 = Sub(v2489, v2491);
+    auto v2721 = MulFixedPoint15(v2720, Set(d16, 27504));
+    auto v2722 = Add(v2719, v2721);
+    auto v2723 = Sub(v2495, v2497);
+    auto v2724 = Sub(v2499, v2501);
+    auto v2725 = MulFixedPoint15(v2724, Set(d16, 27504));
+    auto v2726 = Add(v2723, v2725);
+    auto v2727 = MulFixedPoint15(v2726, Set(d16, 18343));
+    auto v2728 = Add(v2722, v2727);
+    auto v2729 = Sub(v2507, v2509);
+    auto v2730 = Sub(v2511, v2513);
+    auto v2731 = MulFixedPoint15(v2730, Set(d16, 27504));
+    auto v2732 = Add(v2729, v2731);
+    auto v2733 = Sub(v2517, v2519);
+    auto v2734 = Sub(v2521, v2523);
+    auto v2735 = MulFixedPoint15(v2734, Set(d16, 27504));
+    auto v2736 = Add(v2733, v2735);
+    auto v2737 = MulFixedPoint15(v2736, Set(d16, 18343));
+    auto v2738 = Add(v2732, v2737);
+    auto v2739 = MulFixedPoint15(v2738, Set(d16, 16840));
+    auto v2740 = Add(v2728, v2739);
+    auto v2741 = Sub(v2531, v2533);
+    auto v2742 = Sub(v2535, v2537);
+    auto v2743 = MulFixedPoint15(v2742, Set(d16, 27504));
+    auto v2744 = Add(v2741, v2743);
+    auto v2745 = Sub(v2541, v2543);
+    auto v2746 = Sub(v2545, v2547);
+    auto v2747 = MulFixedPoint15(v2746, Set(d16, 27504));
+    auto v2748 = Add(v2745, v2747);
+    auto v2749 = MulFixedPoint15(v2748, Set(d16, 18343));
+    auto v2750 = Add(v2744, v2749);
+    auto v2751 = Sub(v2553, v2555);
+    auto v2752 = Sub(v2557, v2559);
+    auto v2753 = MulFixedPoint15(v2752, Set(d16, 27504));
+    auto v2754 = Add(v2751, v2753);
+    auto v2755 = Sub(v2563, v2565);
+    auto v2756 = Sub(v2567, v2569);
+    auto v2757 = MulFixedPoint15(v2756, Set(d16, 27504));
+    auto v2758 = Add(v2755, v2757);
+    auto v2759 = MulFixedPoint15(v2758, Set(d16, 18343));
+    auto v2760 = Add(v2754, v2759);
+    auto v2761 = MulFixedPoint15(v2760, Set(d16, 16840));
+    auto v2762 = Add(v2750, v2761);
+    auto v2763 = MulFixedPoint15(v2762, Set(d16, 16496));
+    auto v2764 = Add(v2740, v2763);
+    auto v2765 = Sub(v2390, v2392);
+    auto v2766 = Sub(v2394, v2396);
+    auto v2767 = MulFixedPoint15(v2766, Set(d16, 31869));
+    auto v2768 = Add(v2765, v2767);
+    auto v2769 = Sub(v2400, v2402);
+    auto v2770 = Sub(v2404, v2406);
+    auto v2771 = MulFixedPoint15(v2770, Set(d16, 31869));
+    auto v2772 = Add(v2769, v2771);
+    auto v2773 = MulFixedPoint15(v2772, Set(d16, 18830));
+    auto v2774 = Add(v2768, v2773);
+    auto v2775 = Sub(v2412, v2414);
+    auto v2776 = Sub(v2416, v2418);
+    auto v2777 = MulFixedPoint15(v2776, Set(d16, 31869));
+    auto v2778 = Add(v2775, v2777);
+    auto v2779 = Sub(v2422, v2424);
+    auto v2780 = Sub(v2426, v2428);
+    auto v2781 = MulFixedPoint15(v2780, Set(d16, 31869));
+    auto v2782 = Add(v2779, v2781);
+    auto v2783 = MulFixedPoint15(v2782, Set(d16, 18830));
+    auto v2784 = Add(v2778, v2783);
+    auto v2785 = MulFixedPoint15(v2784, Set(d16, 16944));
+    auto v2786 = Add(v2774, v2785);
+    auto v2787 = Sub(v2436, v2438);
+    auto v2788 = Sub(v2440, v2442);
+    auto v2789 = MulFixedPoint15(v2788, Set(d16, 31869));
+    auto v2790 = Add(v2787, v2789);
+    auto v2791 = Sub(v2446, v2448);
+    auto v2792 = Sub(v2450, v2452);
+    auto v2793 = MulFixedPoint15(v2792, Set(d16, 31869));
+    auto v2794 = Add(v2791, v2793);
+    auto v2795 = MulFixedPoint15(v2794, Set(d16, 18830));
+    auto v2796 = Add(v2790, v2795);
+    auto v2797 = Sub(v2458, v2460);
+    auto v2798 = Sub(v2462, v2465);
+    auto v2799 = MulFixedPoint15(v2798, Set(d16, 31869));
+    auto v2800 = Add(v2797, v2799);
+    auto v2801 = Sub(v2469, v2471);
+    auto v2802 = Sub(v2473, v2475);
+    auto v2803 = MulFixedPoint15(v2802, Set(d16, 31869));
+    auto v2804 = Add(v2801, v2803);
+    auto v2805 = MulFixedPoint15(v2804, Set(d16, 18830));
+    auto v2806 = Add(v2800, v2805);
+    auto v2807 = MulFixedPoint15(v2806, Set(d16, 16944));
+    auto v2808 = Add(v2796, v2807);
+    auto v2809 = MulFixedPoint15(v2808, Set(d16, 16521));
+    auto v2810 = Add(v2786, v2809);
+    auto v2811 = Sub(v2296, v2298);
+    auto v2812 = Sub(v2300, v2302);
+    auto v2813_tmp = MulFixedPoint15(v2812, Set(d16, 5552));
+    auto v2813 = Add(v2813_tmp, v2812);
+    auto v2814 = Add(v2811, v2813);
+    auto v2815 = Sub(v2306, v2308);
+    auto v2816 = Sub(v2310, v2312);
+    auto v2817_tmp = MulFixedPoint15(v2816, Set(d16, 5552));
+    auto v2817 = Add(v2817_tmp, v2816);
+    auto v2818 = Add(v2815, v2817);
+    auto v2819 = MulFixedPoint15(v2818, Set(d16, 19393));
+    auto v2820 = Add(v2814, v2819);
+    auto v2821 = Sub(v2318, v2320);
+    auto v2822 = Sub(v2322, v2324);
+    auto v2823_tmp = MulFixedPoint15(v2822, Set(d16, 5552));
+    auto v2823 = Add(v2823_tmp, v2822);
+    auto v2824 = Add(v2821, v2823);
+    auto v2825 = Sub(v2328, v2330);
+    auto v2826 = Sub(v2332, v2334);
+    auto v2827_tmp = MulFixedPoint15(v2826, Set(d16, 5552));
+    auto v2827 = Add(v2827_tmp, v2826);
+    auto v2828 = Add(v2825, v2827);
+    auto v2829 = MulFixedPoint15(v2828, Set(d16, 19393));
+    auto v2830 = Add(v2824, v2829);
+    auto v2831 = MulFixedPoint15(v2830, Set(d16, 17059));
+    auto v2832 = Add(v2820, v2831);
+    auto v2833 = Sub(v2342, v2344);
+    auto v2834 = Sub(v2346, v2348);
+    auto v2835_tmp = MulFixedPoint15(v2834, Set(d16, 5552));
+    auto v2835 = Add(v2835_tmp, v2834);
+    auto v2836 = Add(v2833, v2835);
+    auto v2837 = Sub(v2352, v2354);
+    auto v2838 = Sub(v2356, v2358);
+    auto v2839_tmp = MulFixedPoint15(v2838, Set(d16, 5552));
+    auto v2839 = Add(v2839_tmp, v2838);
+    auto v2840 = Add(v2837, v2839);
+    auto v2841 = MulFixedPoint15(v2840, Set(d16, 19393));
+    auto v2842 = Add(v2836, v2841);
+    auto v2843 = Sub(v2364, v2366);
+    auto v2844 = Sub(v2368, v2370);
+    auto v2845_tmp = MulFixedPoint15(v2844, Set(d16, 5552));
+    auto v2845 = Add(v2845_tmp, v2844);
+    auto v2846 = Add(v2843, v2845);
+    auto v2847 = Sub(v2374, v2376);
+    auto v2848 = Sub(v2378, v2380);
+    auto v2849_tmp = MulFixedPoint15(v2848, Set(d16, 5552));
+    auto v2849 = Add(v2849_tmp, v2848);
+    auto v2850 = Add(v2847, v2849);
+    auto v2851 = MulFixedPoint15(v2850, Set(d16, 19393));
+    auto v2852 = Add(v2846, v2851);
+    auto v2853 = MulFixedPoint15(v2852, Set(d16, 17059));
+    auto v2854 = Add(v2842, v2853);
+    auto v2855 = MulFixedPoint15(v2854, Set(d16, 16549));
+    auto v2856 = Add(v2832, v2855);
+    auto v2857 = Sub(v2109, v2114);
+    auto v2858 = Sub(v2119, v2124);
+    auto v2859_tmp = MulFixedPoint15(v2858, Set(d16, 15865));
+    auto v2859 = Add(v2859_tmp, v2858);
+    auto v2860 = Add(v2857, v2859);
+    auto v2861 = Sub(v2131, v2136);
+    auto v2862 = Sub(v2141, v2146);
+    auto v2863_tmp = MulFixedPoint15(v2862, Set(d16, 15865));
+    auto v2863 = Add(v2863_tmp, v2862);
+    auto v2864 = Add(v2861, v2863);
+    auto v2865 = MulFixedPoint15(v2864, Set(d16, 20040));
+    auto v2866 = Add(v2860, v2865);
+    auto v2867 = Sub(v2155, v2160);
+    auto v2868 = Sub(v2165, v2170);
+    auto v2869_tmp = MulFixedPoint15(v2868, Set(d16, 15865));
+    auto v2869 = Add(v2869_tmp, v2868);
+    auto v2870 = Add(v2867, v2869);
+    auto v2871 = Sub(v2177, v2182);
+    auto v2872 = Sub(v2187, v2192);
+    auto v2873_tmp = MulFixedPoint15(v2872, Set(d16, 15865));
+    auto v2873 = Add(v2873_tmp, v2872);
+    auto v2874 = Add(v2871, v2873);
+    auto v2875 = MulFixedPoint15(v2874, Set(d16, 20040));
+    auto v2876 = Add(v2870, v2875);
+    auto v2877 = MulFixedPoint15(v2876, Set(d16, 17187));
+    auto v2878 = Add(v2866, v2877);
+    auto v2879 = Sub(v2203, v2208);
+    auto v2880 = Sub(v2213, v2218);
+    auto v2881_tmp = MulFixedPoint15(v2880, Set(d16, 15865));
+    auto v2881 = Add(v2881_tmp, v2880);
+    auto v2882 = Add(v2879, v2881);
+    auto v2883 = Sub(v2225, v2230);
+    auto v2884 = Sub(v2235, v2240);
+    auto v2885_tmp = MulFixedPoint15(v2884, Set(d16, 15865));
+    auto v2885 = Add(v2885_tmp, v2884);
+    auto v2886 = Add(v2883, v2885);
+    auto v2887 = MulFixedPoint15(v2886, Set(d16, 20040));
+    auto v2888 = Add(v2882, v2887);
+    auto v2889 = Sub(v2249, v2254);
+    auto v2890 = Sub(v2259, v2264);
+    auto v2891_tmp = MulFixedPoint15(v2890, Set(d16, 15865));
+    auto v2891 = Add(v2891_tmp, v2890);
+    auto v2892 = Add(v2889, v2891);
+    auto v2893 = Sub(v2271, v2276);
+    auto v2894 = Sub(v2281, v2286);
+    auto v2895_tmp = MulFixedPoint15(v2894, Set(d16, 15865));
+    auto v2895 = Add(v2895_tmp, v2894);
+    auto v2896 = Add(v2893, v2895);
+    auto v2897 = MulFixedPoint15(v2896, Set(d16, 20040));
+    auto v2898 = Add(v2892, v2897);
+    auto v2899 = MulFixedPoint15(v2898, Set(d16, 17187));
+    auto v2900 = Add(v2888, v2899);
+    auto v2901 = MulFixedPoint15(v2900, Set(d16, 16579));
+    auto v2902 = Add(v2878, v2901);
+    auto v2903 = Sub(v1919, v1924);
+    auto v2904 = Sub(v1929, v1934);
+    auto v2905_tmp = MulFixedPoint15(v2904, Set(d16, 1893));
+    auto v2905 = Add(v2905_tmp, Mul(v2904, Set(d16, 2)));
+    auto v2906 = Add(v2903, v2905);
+    auto v2907 = Sub(v1941, v1946);
+    auto v2908 = Sub(v1951, v1956);
+    auto v2909_tmp = MulFixedPoint15(v2908, Set(d16, 1893));
+    auto v2909 = Add(v2909_tmp, Mul(v2908, Set(d16, 2)));
+    auto v2910 = Add(v2907, v2909);
+    auto v2911 = MulFixedPoint15(v2910, Set(d16, 20783));
+    auto v2912 = Add(v2906, v2911);
+    auto v2913 = Sub(v1965, v1970);
+    auto v2914 = Sub(v1975, v1980);
+    auto v2915_tmp = MulFixedPoint15(v2914, Set(d16, 1893));
+    auto v2915 = Add(v2915_tmp, Mul(v2914, Set(d16, 2)));
+    auto v2916 = Add(v2913, v2915);
+    auto v2917 = Sub(v1987, v1992);
+    auto v2918 = Sub(v1997, v2002);
+    auto v2919_tmp = MulFixedPoint15(v2918, Set(d16, 1893));
+    auto v2919 = Add(v2919_tmp, Mul(v2918, Set(d16, 2)));
+    auto v2920 = Add(v2917, v2919);
+    auto v2921 = MulFixedPoint15(v2920, Set(d16, 20783));
+    auto v2922 = Add(v2916, v2921);
+    auto v2923 = MulFixedPoint15(v2922, Set(d16, 17326));
+    auto v2924 = Add(v2912, v2923);
+    auto v2925 = Sub(v2013, v2018);
+    auto v2926 = Sub(v2023, v2028);
+    auto v2927_tmp = MulFixedPoint15(v2926, Set(d16, 1893));
+    auto v2927 = Add(v2927_tmp, Mul(v2926, Set(d16, 2)));
+    auto v2928 = Add(v2925, v2927);
+    auto v2929 = Sub(v2035, v2040);
+    auto v2930 = Sub(v2045, v2050);
+    auto v2931_tmp = MulFixedPoint15(v2930, Set(d16, 1893));
+    auto v2931 = Add(v2931_tmp, Mul(v2930, Set(d16, 2)));
+    auto v2932 = Add(v2929, v2931);
+    auto v2933 = MulFixedPoint15(v2932, Set(d16, 20783));
+    auto v2934 = Add(v2928, v2933);
+    auto v2935 = Sub(v2059, v2064);
+    auto v2936 = Sub(v2069, v2074);
+    auto v2937_tmp = MulFixedPoint15(v2936, Set(d16, 1893));
+    auto v2937 = Add(v2937_tmp, Mul(v2936, Set(d16, 2)));
+    auto v2938 = Add(v2935, v2937);
+    auto v2939 = Sub(v2081, v2086);
+    auto v2940 = Sub(v2091, v2096);
+    auto v2941_tmp = MulFixedPoint15(v2940, Set(d16, 1893));
+    auto v2941 = Add(v2941_tmp, Mul(v2940, Set(d16, 2)));
+    auto v2942 = Add(v2939, v2941);
+    auto v2943 = MulFixedPoint15(v2942, Set(d16, 20783));
+    auto v2944 = Add(v2938, v2943);
+    auto v2945 = MulFixedPoint15(v2944, Set(d16, 17326));
+    auto v2946 = Add(v2934, v2945);
+    auto v2947 = MulFixedPoint15(v2946, Set(d16, 16611));
+    auto v2948 = Add(v2924, v2947);
+    auto v2949 = Sub(v1543, v1554);
+    auto v2950 = Sub(v1565, v1576);
+    auto v2951_tmp = MulFixedPoint15(v2950, Set(d16, 13357));
+    auto v2951 = Add(v2951_tmp, Mul(v2950, Set(d16, 3)));
+    auto v2952 = Add(v2949, v2951);
+    auto v2953 = Sub(v1589, v1600);
+    auto v2954 = Sub(v1611, v1622);
+    auto v2955_tmp = MulFixedPoint15(v2954, Set(d16, 13357));
+    auto v2955 = Add(v2955_tmp, Mul(v2954, Set(d16, 3)));
+    auto v2956 = Add(v2953, v2955);
+    auto v2957 = MulFixedPoint15(v2956, Set(d16, 21637));
+    auto v2958 = Add(v2952, v2957);
+    auto v2959 = Sub(v1637, v1648);
+    auto v2960 = Sub(v1659, v1670);
+    auto v2961_tmp = MulFixedPoint15(v2960, Set(d16, 13357));
+    auto v2961 = Add(v2961_tmp, Mul(v2960, Set(d16, 3)));
+    auto v2962 = Add(v2959, v2961);
+    auto v2963 = Sub(v1683, v1694);
+    auto v2964 = Sub(v1705, v1716);
+    auto v2965_tmp = MulFixedPoint15(v2964, Set(d16, 13357));
+    auto v2965 = Add(v2965_tmp, Mul(v2964, Set(d16, 3)));
+    auto v2966 = Add(v2963, v2965);
+    auto v2967 = MulFixedPoint15(v2966, Set(d16, 21637));
+    auto v2968 = Add(v2962, v2967);
+    auto v2969 = MulFixedPoint15(v2968, Set(d16, 17479));
+    auto v2970 = Add(v2958, v2969);
+    auto v2971 = Sub(v1733, v1744);
+    auto v2972 = Sub(v1755, v1766);
+    auto v2973_tmp = MulFixedPoint15(v2972, Set(d16, 13357));
+    auto v2973 = Add(v2973_tmp, Mul(v2972, Set(d16, 3)));
+    auto v2974 = Add(v2971, v2973);
+    auto v2975 = Sub(v1779, v1790);
+    auto v2976 = Sub(v1801, v1812);
+    auto v2977_tmp = MulFixedPoint15(v2976, Set(d16, 13357));
+    auto v2977 = Add(v2977_tmp, Mul(v2976, Set(d16, 3)));
+    auto v2978 = Add(v2975, v2977);
+    auto v2979 = MulFixedPoint15(v2978, Set(d16, 21637));
+    auto v2980 = Add(v2974, v2979);
+    auto v2981 = Sub(v1827, v1838);
+    auto v2982 = Sub(v1849, v1860);
+    auto v2983_tmp = MulFixedPoint15(v2982, Set(d16, 13357));
+    auto v2983 = Add(v2983_tmp, Mul(v2982, Set(d16, 3)));
+    auto v2984 = Add(v2981, v2983);
+    auto v2985 = Sub(v1873, v1884);
+    auto v2986 = Sub(v1895, v1906);
+    auto v2987_tmp = MulFixedPoint15(v2986, Set(d16, 13357));
+    auto v2987 = Add(v2987_tmp, Mul(v2986, Set(d16, 3)));
+    auto v2988 = Add(v2985, v2987);
+    auto v2989 = MulFixedPoint15(v2988, Set(d16, 21637));
+    auto v2990 = Add(v2984, v2989);
+    auto v2991 = MulFixedPoint15(v2990, Set(d16, 17479));
+    auto v2992 = Add(v2980, v2991);
+    auto v2993 = MulFixedPoint15(v2992, Set(d16, 16647));
+    auto v2994 = Add(v2970, v2993);
+    auto v2995 = Sub(v25, v60);
+    auto v2996 = Sub(v102, v138);
+    auto v2997_tmp = MulFixedPoint15(v2996, Set(d16, 6226));
+    auto v2997 = Add(v2997_tmp, Mul(v2996, Set(d16, 10)));
+    auto v2998 = Add(v2995, v2997);
+    auto v2999 = Sub(v182, v233);
+    auto v3000 = Sub(v275, v312);
+    auto v3001_tmp = MulFixedPoint15(v3000, Set(d16, 6226));
+    auto v3001 = Add(v3001_tmp, Mul(v3000, Set(d16, 10)));
+    auto v3002 = Add(v2999, v3001);
+    auto v3003 = MulFixedPoint15(v3002, Set(d16, 22622));
+    auto v3004 = Add(v2998, v3003);
+    auto v3005 = Sub(v358, v409);
+    auto v3006 = Sub(v481, v519);
+    auto v3007_tmp = MulFixedPoint15(v3006, Set(d16, 6226));
+    auto v3007 = Add(v3007_tmp, Mul(v3006, Set(d16, 10)));
+    auto v3008 = Add(v3005, v3007);
+    auto v3009 = Sub(v563, v614);
+    auto v3010 = Sub(v656, v694);
+    auto v3011_tmp = MulFixedPoint15(v3010, Set(d16, 6226));
+    auto v3011 = Add(v3011_tmp, Mul(v3010, Set(d16, 10)));
+    auto v3012 = Add(v3009, v3011);
+    auto v3013 = MulFixedPoint15(v3012, Set(d16, 22622));
+    auto v3014 = Add(v3008, v3013);
+    auto v3015 = MulFixedPoint15(v3014, Set(d16, 17646));
+    auto v3016 = Add(v3004, v3015);
+    auto v3017 = Sub(v742, v793);
+    auto v3018 = Sub(v865, v903);
+    auto v3019_tmp = MulFixedPoint15(v3018, Set(d16, 6226));
+    auto v3019 = Add(v3019_tmp, Mul(v3018, Set(d16, 10)));
+    auto v3020 = Add(v3017, v3019);
+    auto v3021 = Sub(v977, v1060);
+    auto v3022 = Sub(v1102, v1141);
+    auto v3023_tmp = MulFixedPoint15(v3022, Set(d16, 6226));
+    auto v3023 = Add(v3023_tmp, Mul(v3022, Set(d16, 10)));
+    auto v3024 = Add(v3021, v3023);
+    auto v3025 = MulFixedPoint15(v3024, Set(d16, 22622));
+    auto v3026 = Add(v3020, v3025);
+    auto v3027 = Sub(v1187, v1238);
+    auto v3028 = Sub(v1310, v1348);
+    auto v3029_tmp = MulFixedPoint15(v3028, Set(d16, 6226));
+    auto v3029 = Add(v3029_tmp, Mul(v3028, Set(d16, 10)));
+    auto v3030 = Add(v3027, v3029);
+    auto v3031 = Sub(v1392, v1443);
+    auto v3032 = Sub(v1485, v1524);
+    auto v3033_tmp = MulFixedPoint15(v3032, Set(d16, 6226));
+    auto v3033 = Add(v3033_tmp, Mul(v3032, Set(d16, 10)));
+    auto v3034 = Add(v3031, v3033);
+    auto v3035 = MulFixedPoint15(v3034, Set(d16, 22622));
+    auto v3036 = Add(v3030, v3035);
+    auto v3037 = MulFixedPoint15(v3036, Set(d16, 17646));
+    auto v3038 = Add(v3026, v3037);
+    auto v3039 = MulFixedPoint15(v3038, Set(d16, 16685));
+    auto v3040 = Add(v3016, v3039);
+    auto v3041 = Sub(v2995, v2997);
+    auto v3042 = Sub(v2999, v3001);
+    auto v3043 = MulFixedPoint15(v3042, Set(d16, 23761));
+    auto v3044 = Add(v3041, v3043);
+    auto v3045 = Sub(v3005, v3007);
+    auto v3046 = Sub(v3009, v3011);
+    auto v3047 = MulFixedPoint15(v3046, Set(d16, 23761));
+    auto v3048 = Add(v3045, v3047);
+    auto v3049 = MulFixedPoint15(v3048, Set(d16, 17826));
+    auto v3050 = Add(v3044, v3049);
+    auto v3051 = Sub(v3017, v3019);
+    auto v3052 = Sub(v3021, v3023);
+    auto v3053 = MulFixedPoint15(v3052, Set(d16, 23761));
+    auto v3054 = Add(v3051, v3053);
+    auto v3055 = Sub(v3027, v3029);
+    auto v3056 = Sub(v3031, v3033);
+    auto v3057 = MulFixedPoint15(v3056, Set(d16, 23761));
+    auto v3058 = Add(v3055, v3057);
+    auto v3059 = MulFixedPoint15(v3058, Set(d16, 17826));
+    auto v3060 = Add(v3054, v3059);
+    auto v3061 = MulFixedPoint15(v3060, Set(d16, 16726));
+    auto v3062 = Add(v3050, v3061);
+    auto v3063 = Sub(v2949, v2951);
+    auto v3064 = Sub(v2953, v2955);
+    auto v3065 = MulFixedPoint15(v3064, Set(d16, 25084));
+    auto v3066 = Add(v3063, v3065);
+    auto v3067 = Sub(v2959, v2961);
+    auto v3068 = Sub(v2963, v2965);
+    auto v3069 = MulFixedPoint15(v3068, Set(d16, 25084));
+    auto v3070 = Add(v3067, v3069);
+    auto v3071 = MulFixedPoint15(v3070, Set(d16, 18021));
+    auto v3072 = Add(v3066, v3071);
+    auto v3073 = Sub(v2971, v2973);
+    auto v3074 = Sub(v2975, v2977);
+    auto v3075 = MulFixedPoint15(v3074, Set(d16, 25084));
+    auto v3076 = Add(v3073, v3075);
+    auto v3077 = Sub(v2981, v2983);
+    auto v3078 = Sub(v2985, v2987);
+    auto v3079 = MulFixedPoint15(v3078, Set(d16, 25084));
+    auto v3080 = Add(v3077, v3079);
+    auto v3081 = MulFixedPoint15(v3080, Set(d16, 18021));
+    auto v3082 = Add(v3076, v3081);
+    auto v3083 = MulFixedPoint15(v3082, Set(d16, 16769));
+    auto v3084 = Add(v3072, v3083);
+    auto v3085 = Sub(v2903, v2905);
+    auto v3086 = Sub(v2907, v2909);
+    auto v3087 = MulFixedPoint15(v3086, Set(d16, 26631));
+    auto v3088 = Add(v3085, v3087);
+    auto v3089 = Sub(v2913, v2915);
+    auto v3090 = Sub(v2917, v2919);
+    auto v3091 = MulFixedPoint15(v3090, Set(d16, 26631));
+    auto v3092 = Add(v3089, v3091);
+    auto v3093 = MulFixedPoint15(v3092, Set(d16, 18231));
+    auto v3094 = Add(v3088, v3093);
+    auto v3095 = Sub(v2925, v2927);
+    auto v3096 = Sub(v2929, v2931);
+    auto v3097 = MulFixedPoint15(v3096, Set(d16, 26631));
+    auto v3098 = Add(v3095, v3097);
+    auto v3099 = Sub(v2935, v2937);
+    auto v3100 = Sub(v2939, v2941);
+    auto v3101 = MulFixedPoint15(v3100, Set(d16, 26631));
+    auto v3102 = Add(v3099, v3101);
+    auto v3103 = MulFixedPoint15(v3102, Set(d16, 18231));
+    auto v3104 = Add(v3098, v3103);
+    auto v3105 = MulFixedPoint15(v3104, Set(d16, 16815));
+    auto v3106 = Add(v3094, v3105);
+    auto v3107 = Sub(v2857, v2859);
+    auto v3108 = Sub(v2861, v2863);
+    auto v3109 = MulFixedPoint15(v3108, Set(d16, 28454));
+    auto v3110 = Add(v3107, v3109);
+    auto v3111 = Sub(v2867, v2869);
+    auto v3112 = Sub(v2871, v2873);
+    auto v3113 = MulFixedPoint15(v3112, Set(d16, 28454));
+    auto v3114 = Add(v3111, v3113);
+    auto v3115 = MulFixedPoint15(v3114, Set(d16, 18458));
+    auto v3116 = Add(v3110, v3115);
+    auto v3117 = Sub(v2879, v2881);
+    auto v3118 = Sub(v2883, v2885);
+    auto v3119 = MulFixedPoint15(v3118, Set(d16, 28454));
+    auto v3120 = Add(v3117, v3119);
+    auto v3121 = Sub(v2889, v2891);
+    auto v3122 = Sub(v2893, v2895);
+    auto v3123 = MulFixedPoint15(v3122, Set(d16, 28454));
+    auto v3124 = Add(v3121, v3123);
+    auto v3125 = MulFixedPoint15(v3124, Set(d16, 18458));
+    auto v3126 = Add(v3120, v3125);
+    auto v3127 = MulFixedPoint15(v3126, Set(d16, 16865));
+    auto v3128 = Add(v3116, v3127);
+    auto v3129 = Sub(v2811, v2813);
+    auto v3130 = Sub(v2815, v2817);
+    auto v3131 = MulFixedPoint15(v3130, Set(d16, 30624));
+    auto v3132 = Add(v3129, v3131);
+    auto v3133 = Sub(v2821, v2823);
+    auto v3134 = Sub(v2825, v2827);
+    auto v3135 = MulFixedPoint15(v3134, Set(d16, 30624));
+    auto v3136 = Add(v3133, v3135);
+    auto v3137 = MulFixedPoint15(v3136, Set(d16, 18702));
+    auto v3138 = Add(v3132, v3137);
+    auto v3139 = Sub(v2833, v2835);
+    auto v3140 = Sub(v2837, v2839);
+    auto v3141 = MulFixedPoint15(v3140, Set(d16, 30624));
+    auto v3142 = Add(v3139, v3141);
+    auto v3143 = Sub(v2843, v2845);
+    auto v3144 = Sub(v2847, v2849);
+    auto v3145 = MulFixedPoint15(v3144, Set(d16, 30624));
+    auto v3146 = Add(v3143, v3145);
+    auto v3147 = MulFixedPoint15(v3146, Set(d16, 18702));
+    auto v3148 = Add(v3142, v3147);
+    auto v3149 = MulFixedPoint15(v3148, Set(d16, 16916));
+    auto v3150 = Add(v3138, v3149);
+    auto v3151 = Sub(v2765, v2767);
+    auto v3152 = Sub(v2769, v2771);
+    auto v3153_tmp = MulFixedPoint15(v3152, Set(d16, 472));
+    auto v3153 = Add(v3153_tmp, v3152);
+    auto v3154 = Add(v3151, v3153);
+    auto v3155 = Sub(v2775, v2777);
+    auto v3156 = Sub(v2779, v2781);
+    auto v3157_tmp = MulFixedPoint15(v3156, Set(d16, 472));
+    auto v3157 = Add(v3157_tmp, v3156);
+    auto v3158 = Add(v3155, v3157);
+    auto v3159 = MulFixedPoint15(v3158, Set(d16, 18964));
+    auto v3160 = Add(v3154, v3159);
+    auto v3161 = Sub(v2787, v2789);
+    auto v3162 = Sub(v2791, v2793);
+    auto v3163_tmp = MulFixedPoint15(v3162, Set(d16, 472));
+    auto v3163 = Add(v3163_tmp, v3162);
+    auto v3164 = Add(v3161, v3163);
+    auto v3165 = Sub(v2797, v2799);
+    auto v3166 = Sub(v2801, v2803);
+    auto v3167_tmp = MulFixedPoint15(v3166, Set(d16, 472));
+    auto v3167 = Add(v3167_tmp, v3166);
+    auto v3168 = Add(v3165, v3167);
+    auto v3169 = MulFixedPoint15(v3168, Set(d16, 18964));
+    auto v3170 = Add(v3164, v3169);
+    auto v3171 = MulFixedPoint15(v3170, Set(d16, 16971));
+    auto v3172 = Add(v3160, v3171);
+    auto v3173 = Sub(v2719, v2721);
+    auto v3174 = Sub(v2723, v2725);
+    auto v3175_tmp = MulFixedPoint15(v3174, Set(d16, 3672));
+    auto v3175 = Add(v3175_tmp, v3174);
+    auto v3176 = Add(v3173, v3175);
+    auto v3177 = Sub(v2729, v2731);
+    auto v3178 = Sub(v2733, v2735);
+    auto v3179_tmp = MulFixedPoint15(v3178, Set(d16, 3672));
+    auto v3179 = Add(v3179_tmp, v3178);
+    auto v3180 = Add(v3177, v3179);
+    auto v3181 = MulFixedPoint15(v3180, Set(d16, 19245));
+    auto v3182 = Add(v3176, v3181);
+    auto v3183 = Sub(v2741, v2743);
+    auto v3184 = Sub(v2745, v2747);
+    auto v3185_tmp = MulFixedPoint15(v3184, Set(d16, 3672));
+    auto v3185 = Add(v3185_tmp, v3184);
+    auto v3186 = Add(v3183, v3185);
+    auto v3187 = Sub(v2751, v2753);
+    auto v3188 = Sub(v2755, v2757);
+    auto v3189_tmp = MulFixedPoint15(v3188, Set(d16, 3672));
+    auto v3189 = Add(v3189_tmp, v3188);
+    auto v3190 = Add(v3187, v3189);
+    auto v3191 = MulFixedPoint15(v3190, Set(d16, 19245));
+    auto v3192 = Add(v3186, v3191);
+    auto v3193 = MulFixedPoint15(v3192, Set(d16, 17029));
+    auto v3194 = Add(v3182, v3193);
+    auto v3195 = Sub(v2673, v2675);
+    auto v3196 = Sub(v2677, v2679);
+    auto v3197_tmp = MulFixedPoint15(v3196, Set(d16, 7662));
+    auto v3197 = Add(v3197_tmp, v3196);
+    auto v3198 = Add(v3195, v3197);
+    auto v3199 = Sub(v2683, v2685);
+    auto v3200 = Sub(v2687, v2689);
+    auto v3201_tmp = MulFixedPoint15(v3200, Set(d16, 7662));
+    auto v3201 = Add(v3201_tmp, v3200);
+    auto v3202 = Add(v3199, v3201);
+    auto v3203 = MulFixedPoint15(v3202, Set(d16, 19546));
+    auto v3204 = Add(v3198, v3203);
+    auto v3205 = Sub(v2695, v2697);
+    auto v3206 = Sub(v2699, v2701);
+    auto v3207_tmp = MulFixedPoint15(v3206, Set(d16, 7662));
+    auto v3207 = Add(v3207_tmp, v3206);
+    auto v3208 = Add(v3205, v3207);
+    auto v3209 = Sub(v2705, v2707);
+    auto v3210 = Sub(v2709, v2711);
+    auto v3211_tmp = MulFixedPoint15(v3210, Set(d16, 7662));
+    auto v3211 = Add(v3211_tmp, v3210);
+    auto v3212 = Add(v3209, v3211);
+    auto v3213 = MulFixedPoint15(v3212, Set(d16, 19546));
+    auto v3214 = Add(v3208, v3213);
+    auto v3215 = MulFixedPoint15(v3214, Set(d16, 17090));
+    auto v3216 = Add(v3204, v3215);
+    auto v3217 = Sub(v2582, v2587);
+    auto v3218 = Sub(v2592, v2597);
+    auto v3219_tmp = MulFixedPoint15(v3218, Set(d16, 12756));
+    auto v3219 = Add(v3219_tmp, v3218);
+    auto v3220 = Add(v3217, v3219);
+    auto v3221 = Sub(v2604, v2609);
+    auto v3222 = Sub(v2614, v2619);
+    auto v3223_tmp = MulFixedPoint15(v3222, Set(d16, 12756));
+    auto v3223 = Add(v3223_tmp, v3222);
+    auto v3224 = Add(v3221, v3223);
+    auto v3225 = MulFixedPoint15(v3224, Set(d16, 19869));
+    auto v3226 = Add(v3220, v3225);
+    auto v3227 = Sub(v2628, v2633);
+    auto v3228 = Sub(v2638, v2643);
+    auto v3229_tmp = MulFixedPoint15(v3228, Set(d16, 12756));
+    auto v3229 = Add(v3229_tmp, v3228);
+    auto v3230 = Add(v3227, v3229);
+    auto v3231 = Sub(v2650, v2655);
+    auto v3232 = Sub(v2660, v2665);
+    auto v3233_tmp = MulFixedPoint15(v3232, Set(d16, 12756));
+    auto v3233 = Add(v3233_tmp, v3232);
+    auto v3234 = Add(v3231, v3233);
+    auto v3235 = MulFixedPoint15(v3234, Set(d16, 19869));
+    auto v3236 = Add(v3230, v3235);
+    auto v3237 = MulFixedPoint15(v3236, Set(d16, 17153));
+    auto v3238 = Add(v3226, v3237);
+    auto v3239 = Sub(v2488, v2493);
+    auto v3240 = Sub(v2498, v2503);
+    auto v3241_tmp = MulFixedPoint15(v3240, Set(d16, 19463));
+    auto v3241 = Add(v3241_tmp, v3240);
+    auto v3242 = Add(v3239, v3241);
+    auto v3243 = Sub(v2510, v2515);
+    auto v3244 = Sub(v2520, v2525);
+    auto v3245_tmp = MulFixedPoint15(v3244, Set(d16, 19463));
+    auto v3245 = Add(v3245_tmp, v3244);
+    auto v3246 = Add(v3243, v3245);
+    auto v3247 = MulFixedPoint15(v3246, Set(d16, 20216));
+    auto v3248 = Add(v3242, v3247);
+    auto v3249 = Sub(v2534, v2539);
+    auto v3250 = Sub(v2544, v2549);
+    auto v3251_tmp = MulFixedPoint15(v3250, Set(d16, 19463));
+    auto v3251 = Add(v3251_tmp, v3250);
+    auto v3252 = Add(v3249, v3251);
+    auto v3253 = Sub(v2556, v2561);
+    auto v3254 = Sub(v2566, v2571);
+    auto v3255_tmp = MulFixedPoint15(v3254, Set(d16, 19463));
+    auto v3255 = Add(v3255_tmp, v3254);
+    auto v3256 = Add(v3253, v3255);
+    auto v3257 = MulFixedPoint15(v3256, Set(d16, 20216));
+    auto v3258 = Add(v3252, v3257);
+    auto v3259 = MulFixedPoint15(v3258, Set(d16, 17220));
+    auto v3260 = Add(v3248, v3259);
+    auto v3261 = Sub(v2393, v2398);
+    auto v3262 = Sub(v2403, v2408);
+    auto v3263_tmp = MulFixedPoint15(v3262, Set(d16, 28661));
+    auto v3263 = Add(v3263_tmp, v3262);
+    auto v3264 = Add(v3261, v3263);
+    auto v3265 = Sub(v2415, v2420);
+    auto v3266 = Sub(v2425, v2430);
+    auto v3267_tmp = MulFixedPoint15(v3266, Set(d16, 28661));
+    auto v3267 = Add(v3267_tmp, v3266);
+    auto v3268 = Add(v3265, v3267);
+    auto v3269 = MulFixedPoint15(v3268, Set(d16, 20587));
+    auto v3270 = Add(v3264, v3269);
+    auto v3271 = Sub(v2439, v2444);
+    auto v3272 = Sub(v2449, v2454);
+    auto v3273_tmp = MulFixedPoint15(v3272, Set(d16, 28661));
+    auto v3273 = Add(v3273_tmp, v3272);
+    auto v3274 = Add(v3271, v3273);
+    auto v3275 = Sub(v2461, v2467);
+    auto v3276 = Sub(v2472, v2477);
+    auto v3277_tmp = MulFixedPoint15(v3276, Set(d16, 28661));
+    auto v3277 = Add(v3277_tmp, v3276);
+    auto v3278 = Add(v3275, v3277);
+    auto v3279 = MulFixedPoint15(v3278, Set(d16, 20587));
+    auto v3280 = Add(v3274, v3279);
+    auto v3281 = MulFixedPoint15(v3280, Set(d16, 17290));
+    auto v3282 = Add(v3270, v3281);
+    auto v3283 = Sub(v2299, v2304);
+    auto v3284 = Sub(v2309, v2314);
+    auto v3285_tmp = MulFixedPoint15(v3284, Set(d16, 9242));
+    auto v3285 = Add(v3285_tmp, Mul(v3284, Set(d16, 2)));
+    auto v3286 = Add(v3283, v3285);
+    auto v3287 = Sub(v2321, v2326);
+    auto v3288 = Sub(v2331, v2336);
+    auto v3289_tmp = MulFixedPoint15(v3288, Set(d16, 9242));
+    auto v3289 = Add(v3289_tmp, Mul(v3288, Set(d16, 2)));
+    auto v3290 = Add(v3287, v3289);
+    auto v3291 = MulFixedPoint15(v3290, Set(d16, 20985));
+    auto v3292 = Add(v3286, v3291);
+    auto v3293 = Sub(v2345, v2350);
+    auto v3294 = Sub(v2355, v2360);
+    auto v3295_tmp = MulFixedPoint15(v3294, Set(d16, 9242));
+    auto v3295 = Add(v3295_tmp, Mul(v3294, Set(d16, 2)));
+    auto v3296 = Add(v3293, v3295);
+    auto v3297 = Sub(v2367, v2372);
+    auto v3298 = Sub(v2377, v2382);
+    auto v3299_tmp = MulFixedPoint15(v3298, Set(d16, 9242));
+    auto v3299 = Add(v3299_tmp, Mul(v3298, Set(d16, 2)));
+    auto v3300 = Add(v3297, v3299);
+    auto v3301 = MulFixedPoint15(v3300, Set(d16, 20985));
+    auto v3302 = Add(v3296, v3301);
+    auto v3303 = MulFixedPoint15(v3302, Set(d16, 17363));
+    auto v3304 = Add(v3292, v3303);
+    auto v3305 = Sub(v2115, v2126);
+    auto v3306 = Sub(v2137, v2148);
+    auto v3307_tmp = MulFixedPoint15(v3306, Set(d16, 30298));
+    auto v3307 = Add(v3307_tmp, Mul(v3306, Set(d16, 2)));
+    auto v3308 = Add(v3305, v3307);
+    auto v3309 = Sub(v2161, v2172);
+    auto v3310 = Sub(v2183, v2194);
+    auto v3311_tmp = MulFixedPoint15(v3310, Set(d16, 30298));
+    auto v3311 = Add(v3311_tmp, Mul(v3310, Set(d16, 2)));
+    auto v3312 = Add(v3309, v3311);
+    auto v3313 = MulFixedPoint15(v3312, Set(d16, 21412));
+    auto v3314 = Add(v3308, v3313);
+    auto v3315 = Sub(v2209, v2220);
+    auto v3316 = Sub(v2231, v2242);
+    auto v3317_tmp = MulFixedPoint15(v3316, Set(d16, 30298));
+    auto v3317 = Add(v3317_tmp, Mul(v3316, Set(d16, 2)));
+    auto v3318 = Add(v3315, v3317);
+    auto v3319 = Sub(v2255, v2266);
+    auto v3320 = Sub(v2277, v2288);
+    auto v3321_tmp = MulFixedPoint15(v3320, Set(d16, 30298));
+    auto v3321 = Add(v3321_tmp, Mul(v3320, Set(d16, 2)));
+    auto v3322 = Add(v3319, v3321);
+    auto v3323 = MulFixedPoint15(v3322, Set(d16, 21412));
+    auto v3324 = Add(v3318, v3323);
+    auto v3325 = MulFixedPoint15(v3324, Set(d16, 17440));
+    auto v3326 = Add(v3314, v3325);
+    auto v3327 = Sub(v1925, v1936);
+    auto v3328 = Sub(v1947, v1958);
+    auto v3329_tmp = MulFixedPoint15(v3328, Set(d16, 2773));
+    auto v3329 = Add(v3329_tmp, Mul(v3328, Set(d16, 4)));
+    auto v3330 = Add(v3327, v3329);
+    auto v3331 = Sub(v1971, v1982);
+    auto v3332 = Sub(v1993, v2004);
+    auto v3333_tmp = MulFixedPoint15(v3332, Set(d16, 2773));
+    auto v3333 = Add(v3333_tmp, Mul(v3332, Set(d16, 4)));
+    auto v3334 = Add(v3331, v3333);
+    auto v3335 = MulFixedPoint15(v3334, Set(d16, 21871));
+    auto v3336 = Add(v3330, v3335);
+    auto v3337 = Sub(v2019, v2030);
+    auto v3338 = Sub(v2041, v2052);
+    auto v3339_tmp = MulFixedPoint15(v3338, Set(d16, 2773));
+    auto v3339 = Add(v3339_tmp, Mul(v3338, Set(d16, 4)));
+    auto v3340 = Add(v3337, v3339);
+    auto v3341 = Sub(v2065, v2076);
+    auto v3342 = Sub(v2087, v2098);
+    auto v3343_tmp = MulFixedPoint15(v3342, Set(d16, 2773));
+    auto v3343 = Add(v3343_tmp, Mul(v3342, Set(d16, 4)));
+    auto v3344 = Add(v3341, v3343);
+    auto v3345 = MulFixedPoint15(v3344, Set(d16, 21871));
+    auto v3346 = Add(v3340, v3345);
+    auto v3347 = MulFixedPoint15(v3346, Set(d16, 17520));
+    auto v3348 = Add(v3336, v3347);
+    auto v3349 = Sub(v1555, v1578);
+    auto v3350 = Sub(v1601, v1624);
+    auto v3351_tmp = MulFixedPoint15(v3350, Set(d16, 26108));
+    auto v3351 = Add(v3351_tmp, Mul(v3350, Set(d16, 6)));
+    auto v3352 = Add(v3349, v3351);
+    auto v3353 = Sub(v1649, v1672);
+    auto v3354 = Sub(v1695, v1718);
+    auto v3355_tmp = MulFixedPoint15(v3354, Set(d16, 26108));
+    auto v3355 = Add(v3355_tmp, Mul(v3354, Set(d16, 6)));
+    auto v3356 = Add(v3353, v3355);
+    auto v3357 = MulFixedPoint15(v3356, Set(d16, 22363));
+    auto v3358 = Add(v3352, v3357);
+    auto v3359 = Sub(v1745, v1768);
+    auto v3360 = Sub(v1791, v1814);
+    auto v3361_tmp = MulFixedPoint15(v3360, Set(d16, 26108));
+    auto v3361 = Add(v3361_tmp, Mul(v3360, Set(d16, 6)));
+    auto v3362 = Add(v3359, v3361);
+    auto v3363 = Sub(v1839, v1862);
+    auto v3364 = Sub(v1885, v1908);
+    auto v3365_tmp = MulFixedPoint15(v3364, Set(d16, 26108));
+    auto v3365 = Add(v3365_tmp, Mul(v3364, Set(d16, 6)));
+    auto v3366 = Add(v3363, v3365);
+    auto v3367 = MulFixedPoint15(v3366, Set(d16, 22363));
+    auto v3368 = Add(v3362, v3367);
+    auto v3369 = MulFixedPoint15(v3368, Set(d16, 17603));
+    auto v3370 = Add(v3358, v3369);
+    auto v3371 = Sub(v61, v140);
+    auto v3372 = Sub(v234, v314);
+    auto v3373_tmp = MulFixedPoint15(v3372, Set(d16, 12251));
+    auto v3373 = Add(v3373_tmp, Mul(v3372, Set(d16, 20)));
+    auto v3374 = Add(v3371, v3373);
+    auto v3375 = Sub(v410, v521);
+    auto v3376 = Sub(v615, v696);
+    auto v3377_tmp = MulFixedPoint15(v3376, Set(d16, 12251));
+    auto v3377 = Add(v3377_tmp, Mul(v3376, Set(d16, 20)));
+    auto v3378 = Add(v3375, v3377);
+    auto v3379 = MulFixedPoint15(v3378, Set(d16, 22891));
+    auto v3380 = Add(v3374, v3379);
+    auto v3381 = Sub(v794, v905);
+    auto v3382 = Sub(v1061, v1143);
+    auto v3383_tmp = MulFixedPoint15(v3382, Set(d16, 12251));
+    auto v3383 = Add(v3383_tmp, Mul(v3382, Set(d16, 20)));
+    auto v3384 = Add(v3381, v3383);
+    auto v3385 = Sub(v1239, v1350);
+    auto v3386 = Sub(v1444, v1526);
+    auto v3387_tmp = MulFixedPoint15(v3386, Set(d16, 12251));
+    auto v3387 = Add(v3387_tmp, Mul(v3386, Set(d16, 20)));
+    auto v3388 = Add(v3385, v3387);
+    auto v3389 = MulFixedPoint15(v3388, Set(d16, 22891));
+    auto v3390 = Add(v3384, v3389);
+    auto v3391 = MulFixedPoint15(v3390, Set(d16, 17689));
+    auto v3392 = Add(v3380, v3391);
+    auto v3393 = Sub(v3371, v3373);
+    auto v3394 = Sub(v3375, v3377);
+    auto v3395 = MulFixedPoint15(v3394, Set(d16, 23460));
+    auto v3396 = Add(v3393, v3395);
+    auto v3397 = Sub(v3381, v3383);
+    auto v3398 = Sub(v3385, v3387);
+    auto v3399 = MulFixedPoint15(v3398, Set(d16, 23460));
+    auto v3400 = Add(v3397, v3399);
+    auto v3401 = MulFixedPoint15(v3400, Set(d16, 17779));
+    auto v3402 = Add(v3396, v3401);
+    auto v3403 = Sub(v3349, v3351);
+    auto v3404 = Sub(v3353, v3355);
+    auto v3405 = MulFixedPoint15(v3404, Set(d16, 24073));
+    auto v3406 = Add(v3403, v3405);
+    auto v3407 = Sub(v3359, v3361);
+    auto v3408 = Sub(v3363, v3365);
+    auto v3409 = MulFixedPoint15(v3408, Set(d16, 24073));
+    auto v3410 = Add(v3407, v3409);
+    auto v3411 = MulFixedPoint15(v3410, Set(d16, 17873));
+    auto v3412 = Add(v3406, v3411);
+    auto v3413 = Sub(v3327, v3329);
+    auto v3414 = Sub(v3331, v3333);
+    auto v3415 = MulFixedPoint15(v3414, Set(d16, 24734));
+    auto v3416 = Add(v3413, v3415);
+    auto v3417 = Sub(v3337, v3339);
+    auto v3418 = Sub(v3341, v3343);
+    auto v3419 = MulFixedPoint15(v3418, Set(d16, 24734));
+    auto v3420 = Add(v3417, v3419);
+    auto v3421 = MulFixedPoint15(v3420, Set(d16, 17971));
+    auto v3422 = Add(v3416, v3421);
+    auto v3423 = Sub(v3305, v3307);
+    auto v3424 = Sub(v3309, v3311);
+    auto v3425 = MulFixedPoint15(v3424, Set(d16, 25448));
+    auto v3426 = Add(v3423, v3425);
+    auto v3427 = Sub(v3315, v3317);
+    auto v3428 = Sub(v3319, v3321);
+    auto v3429 = MulFixedPoint15(v3428, Set(d16, 25448));
+    auto v3430 = Add(v3427, v3429);
+    auto v3431 = MulFixedPoint15(v3430, Set(d16, 18072));
+    auto v3432 = Add(v3426, v3431);
+    auto v3433 = Sub(v3283, v3285);
+    auto v3434 = Sub(v3287, v3289);
+    auto v3435 = MulFixedPoint15(v3434, Set(d16, 26220));
+    auto v3436 = Add(v3433, v3435);
+    auto v3437 = Sub(v3293, v3295);
+    auto v3438 = Sub(v3297, v3299);
+    auto v3439 = MulFixedPoint15(v3438, Set(d16, 26220));
+    auto v3440 = Add(v3437, v3439);
+    auto v3441 = MulFixedPoint15(v3440, Set(d16, 18177));
+    auto v3442 = Add(v3436, v3441);
+    auto v3443 = Sub(v3261, v3263);
+    auto v3444 = Sub(v3265, v3267);
+    auto v3445 = MulFixedPoint15(v3444, Set(d16, 27058));
+    auto v3446 = Add(v3443, v3445);
+    auto v3447 = Sub(v3271, v3273);
+    auto v3448 = Sub(v3275, v3277);
+    auto v3449 = MulFixedPoint15(v3448, Set(d16, 27058));
+    auto v3450 = Add(v3447, v3449);
+    auto v3451 = MulFixedPoint15(v3450, Set(d16, 18286));
+    auto v3452 = Add(v3446, v3451);
+    auto v3453 = Sub(v3239, v3241);
+    auto v3454 = Sub(v3243, v3245);
+    auto v3455 = MulFixedPoint15(v3454, Set(d16, 27969));
+    auto v3456 = Add(v3453, v3455);
+    auto v3457 = Sub(v3249, v3251);
+    auto v3458 = Sub(v3253, v3255);
+    auto v3459 = MulFixedPoint15(v3458, Set(d16, 27969));
+    auto v3460 = Add(v3457, v3459);
+    auto v3461 = MulFixedPoint15(v3460, Set(d16, 18400));
+    auto v3462 = Add(v3456, v3461);
+    auto v3463 = Sub(v3217, v3219);
+    auto v3464 = Sub(v3221, v3223);
+    auto v3465 = MulFixedPoint15(v3464, Set(d16, 28961));
+    auto v3466 = Add(v3463, v3465);
+    auto v3467 = Sub(v3227, v3229);
+    auto v3468 = Sub(v3231, v3233);
+    auto v3469 = MulFixedPoint15(v3468, Set(d16, 28961));
+    auto v3470 = Add(v3467, v3469);
+    auto v3471 = MulFixedPoint15(v3470, Set(d16, 18517));
+    auto v3472 = Add(v3466, v3471);
+    auto v3473 = Sub(v3195, v3197);
+    auto v3474 = Sub(v3199, v3201);
+    auto v3475 = MulFixedPoint15(v3474, Set(d16, 30044));
+    auto v3476 = Add(v3473, v3475);
+    auto v3477 = Sub(v3205, v3207);
+    auto v3478 = Sub(v3209, v3211);
+    auto v3479 = MulFixedPoint15(v3478, Set(d16, 30044));
+    auto v3480 = Add(v3477, v3479);
+    auto v3481 = MulFixedPoint15(v3480, Set(d16, 18639));
+    auto v3482 = Add(v3476, v3481);
+    auto v3483 = Sub(v3173, v3175);
+    auto v3484 = Sub(v3177, v3179);
+    auto v3485 = MulFixedPoint15(v3484, Set(d16, 31232));
+    auto v3486 = Add(v3483, v3485);
+    auto v3487 = Sub(v3183, v3185);
+    auto v3488 = Sub(v3187, v3189);
+    auto v3489 = MulFixedPoint15(v3488, Set(d16, 31232));
+    auto v3490 = Add(v3487, v3489);
+    auto v3491 = MulFixedPoint15(v3490, Set(d16, 18765));
+    auto v3492 = Add(v3486, v3491);
+    auto v3493 = Sub(v3151, v3153);
+    auto v3494 = Sub(v3155, v3157);
+    auto v3495 = MulFixedPoint15(v3494, Set(d16, 32538));
+    auto v3496 = Add(v3493, v3495);
+    auto v3497 = Sub(v3161, v3163);
+    auto v3498 = Sub(v3165, v3167);
+    auto v3499 = MulFixedPoint15(v3498, Set(d16, 32538));
+    auto v3500 = Add(v3497, v3499);
+    auto v3501 = MulFixedPoint15(v3500, Set(d16, 18896));
+    auto v3502 = Add(v3496, v3501);
+    auto v3503 = Sub(v3129, v3131);
+    auto v3504 = Sub(v3133, v3135);
+    auto v3505_tmp = MulFixedPoint15(v3504, Set(d16, 1211));
+    auto v3505 = Add(v3505_tmp, v3504);
+    auto v3506 = Add(v3503, v3505);
+    auto v3507 = Sub(v3139, v3141);
+    auto v3508 = Sub(v3143, v3145);
+    auto v3509_tmp = MulFixedPoint15(v3508, Set(d16, 1211));
+    auto v3509 = Add(v3509_tmp, v3508);
+    auto v3510 = Add(v3507, v3509);
+    auto v3511 = MulFixedPoint15(v3510, Set(d16, 19032));
+    auto v3512 = Add(v3506, v3511);
+    auto v3513 = Sub(v3107, v3109);
+    auto v3514 = Sub(v3111, v3113);
+    auto v3515_tmp = MulFixedPoint15(v3514, Set(d16, 2808));
+    auto v3515 = Add(v3515_tmp, v3514);
+    auto v3516 = Add(v3513, v3515);
+    auto v3517 = Sub(v3117, v3119);
+    auto v3518 = Sub(v3121, v3123);
+    auto v3519_tmp = MulFixedPoint15(v3518, Set(d16, 2808));
+    auto v3519 = Add(v3519_tmp, v3518);
+    auto v3520 = Add(v3517, v3519);
+    auto v3521 = MulFixedPoint15(v3520, Set(d16, 19172));
+    auto v3522 = Add(v3516, v3521);
+    auto v3523 = Sub(v3085, v3087);
+    auto v3524 = Sub(v3089, v3091);
+    auto v3525_tmp = MulFixedPoint15(v3524, Set(d16, 4586));
+    auto v3525 = Add(v3525_tmp, v3524);
+    auto v3526 = Add(v3523, v3525);
+    auto v3527 = Sub(v3095, v3097);
+    auto v3528 = Sub(v3099, v3101);
+    auto v3529_tmp = MulFixedPoint15(v3528, Set(d16, 4586));
+    auto v3529 = Add(v3529_tmp, v3528);
+    auto v3530 = Add(v3527, v3529);
+    auto v3531 = MulFixedPoint15(v3530, Set(d16, 19318));
+    auto v3532 = Add(v3526, v3531);
+    auto v3533 = Sub(v3063, v3065);
+    auto v3534 = Sub(v3067, v3069);
+    auto v3535_tmp = MulFixedPoint15(v3534, Set(d16, 6576));
+    auto v3535 = Add(v3535_tmp, v3534);
+    auto v3536 = Add(v3533, v3535);
+    auto v3537 = Sub(v3073, v3075);
+    auto v3538 = Sub(v3077, v3079);
+    auto v3539_tmp = MulFixedPoint15(v3538, Set(d16, 6576));
+    auto v3539 = Add(v3539_tmp, v3538);
+    auto v3540 = Add(v3537, v3539);
+    auto v3541 = MulFixedPoint15(v3540, Set(d16, 19469));
+    auto v3542 = Add(v3536, v3541);
+    auto v3543 = Sub(v3041, v3043);
+    auto v3544 = Sub(v3045, v3047);
+    auto v3545_tmp = MulFixedPoint15(v3544, Set(d16, 8817));
+    auto v3545 = Add(v3545_tmp, v3544);
+    auto v3546 = Add(v3543, v3545);
+    auto v3547 = Sub(v3051, v3053);
+    auto v3548 = Sub(v3055, v3057);
+    auto v3549_tmp = MulFixedPoint15(v3548, Set(d16, 8817));
+    auto v3549 = Add(v3549_tmp, v3548);
+    auto v3550 = Add(v3547, v3549);
+    auto v3551 = MulFixedPoint15(v3550, Set(d16, 19625));
+    auto v3552 = Add(v3546, v3551);
+    auto v3553 = Sub(v2998, v3003);
+    auto v3554 = Sub(v3008, v3013);
+    auto v3555_tmp = MulFixedPoint15(v3554, Set(d16, 11356));
+    auto v3555 = Add(v3555_tmp, v3554);
+    auto v3556 = Add(v3553, v3555);
+    auto v3557 = Sub(v3020, v3025);
+    auto v3558 = Sub(v3030, v3035);
+    auto v3559_tmp = MulFixedPoint15(v3558, Set(d16, 11356));
+    auto v3559 = Add(v3559_tmp, v3558);
+    auto v3560 = Add(v3557, v3559);
+    auto v3561 = MulFixedPoint15(v3560, Set(d16, 19786));
+    auto v3562 = Add(v3556, v3561);
+    auto v3563 = Sub(v2952, v2957);
+    auto v3564 = Sub(v2962, v2967);
+    auto v3565_tmp = MulFixedPoint15(v3564, Set(d16, 14256));
+    auto v3565 = Add(v3565_tmp, v3564);
+    auto v3566 = Add(v3563, v3565);
+    auto v3567 = Sub(v2974, v2979);
+    auto v3568 = Sub(v2984, v2989);
+    auto v3569_tmp = MulFixedPoint15(v3568, Set(d16, 14256));
+    auto v3569 = Add(v3569_tmp, v3568);
+    auto v3570 = Add(v3567, v3569);
+    auto v3571 = MulFixedPoint15(v3570, Set(d16, 19954));
+    auto v3572 = Add(v3566, v3571);
+    auto v3573 = Sub(v2906, v2911);
+    auto v3574 = Sub(v2916, v2921);
+    auto v3575_tmp = MulFixedPoint15(v3574, Set(d16, 17596));
+    auto v3575 = Add(v3575_tmp, v3574);
+    auto v3576 = Add(v3573, v3575);
+    auto v3577 = Sub(v2928, v2933);
+    auto v3578 = Sub(v2938, v2943);
+    auto v3579_tmp = MulFixedPoint15(v3578, Set(d16, 17596));
+    auto v3579 = Add(v3579_tmp, v3578);
+    auto v3580 = Add(v3577, v3579);
+    auto v3581 = MulFixedPoint15(v3580, Set(d16, 20127));
+    auto v3582 = Add(v3576, v3581);
+    auto v3583 = Sub(v2860, v2865);
+    auto v3584 = Sub(v2870, v2875);
+    auto v3585_tmp = MulFixedPoint15(v3584, Set(d16, 21483));
+    auto v3585 = Add(v3585_tmp, v3584);
+    auto v3586 = Add(v3583, v3585);
+    auto v3587 = Sub(v2882, v2887);
+    auto v3588 = Sub(v2892, v2897);
+    auto v3589_tmp = MulFixedPoint15(v3588, Set(d16, 21483));
+    auto v3589 = Add(v3589_tmp, v3588);
+    auto v3590 = Add(v3587, v3589);
+    auto v3591 = MulFixedPoint15(v3590, Set(d16, 20306));
+    auto v3592 = Add(v3586, v3591);
+    auto v3593 = Sub(v2814, v2819);
+    auto v3594 = Sub(v2824, v2829);
+    auto v3595_tmp = MulFixedPoint15(v3594, Set(d16, 26057));
+    auto v3595 = Add(v3595_tmp, v3594);
+    auto v3596 = Add(v3593, v3595);
+    auto v3597 = Sub(v2836, v2841);
+    auto v3598 = Sub(v2846, v2851);
+    auto v3599_tmp = MulFixedPoint15(v3598, Set(d16, 26057));
+    auto v3599 = Add(v3599_tmp, v3598);
+    auto v3600 = Add(v3597, v3599);
+    auto v3601 = MulFixedPoint15(v3600, Set(d16, 20492));
+    auto v3602 = Add(v3596, v3601);
+    auto v3603 = Sub(v2768, v2773);
+    auto v3604 = Sub(v2778, v2783);
+    auto v3605_tmp = MulFixedPoint15(v3604, Set(d16, 31517));
+    auto v3605 = Add(v3605_tmp, v3604);
+    auto v3606 = Add(v3603, v3605);
+    auto v3607 = Sub(v2790, v2795);
+    auto v3608 = Sub(v2800, v2805);
+    auto v3609_tmp = MulFixedPoint15(v3608, Set(d16, 31517));
+    auto v3609 = Add(v3609_tmp, v3608);
+    auto v3610 = Add(v3607, v3609);
+    auto v3611 = MulFixedPoint15(v3610, Set(d16, 20684));
+    auto v3612 = Add(v3606, v3611);
+    auto v3613 = Sub(v2722, v2727);
+    auto v3614 = Sub(v2732, v2737);
+    auto v3615_tmp = MulFixedPoint15(v3614, Set(d16, 5373));
+    auto v3615 = Add(v3615_tmp, Mul(v3614, Set(d16, 2)));
+    auto v3616 = Add(v3613, v3615);
+    auto v3617 = Sub(v2744, v2749);
+    auto v3618 = Sub(v2754, v2759);
+    auto v3619_tmp = MulFixedPoint15(v3618, Set(d16, 5373));
+    auto v3619 = Add(v3619_tmp, Mul(v3618, Set(d16, 2)));
+    auto v3620 = Add(v3617, v3619);
+    auto v3621 = MulFixedPoint15(v3620, Set(d16, 20883));
+    auto v3622 = Add(v3616, v3621);
+    auto v3623 = Sub(v2676, v2681);
+    auto v3624 = Sub(v2686, v2691);
+    auto v3625_tmp = MulFixedPoint15(v3624, Set(d16, 13571));
+    auto v3625 = Add(v3625_tmp, Mul(v3624, Set(d16, 2)));
+    auto v3626 = Add(v3623, v3625);
+    auto v3627 = Sub(v2698, v2703);
+    auto v3628 = Sub(v2708, v2713);
+    auto v3629_tmp = MulFixedPoint15(v3628, Set(d16, 13571));
+    auto v3629 = Add(v3629_tmp, Mul(v3628, Set(d16, 2)));
+    auto v3630 = Add(v3627, v3629);
+    auto v3631 = MulFixedPoint15(v3630, Set(d16, 21089));
+    auto v3632 = Add(v3626, v3631);
+    auto v3633 = Sub(v2588, v2599);
+    auto v3634 = Sub(v2610, v2621);
+    auto v3635_tmp = MulFixedPoint15(v3634, Set(d16, 23975));
+    auto v3635 = Add(v3635_tmp, Mul(v3634, Set(d16, 2)));
+    auto v3636 = Add(v3633, v3635);
+    auto v3637 = Sub(v2634, v2645);
+    auto v3638 = Sub(v2656, v2667);
+    auto v3639_tmp = MulFixedPoint15(v3638, Set(d16, 23975));
+    auto v3639 = Add(v3639_tmp, Mul(v3638, Set(d16, 2)));
+    auto v3640 = Add(v3637, v3639);
+    auto v3641 = MulFixedPoint15(v3640, Set(d16, 21303));
+    auto v3642 = Add(v3636, v3641);
+    auto v3643 = Sub(v2494, v2505);
+    auto v3644 = Sub(v2516, v2527);
+    auto v3645_tmp = MulFixedPoint15(v3644, Set(d16, 4832));
+    auto v3645 = Add(v3645_tmp, Mul(v3644, Set(d16, 3)));
+    auto v3646 = Add(v3643, v3645);
+    auto v3647 = Sub(v2540, v2551);
+    auto v3648 = Sub(v2562, v2573);
+    auto v3649_tmp = MulFixedPoint15(v3648, Set(d16, 4832));
+    auto v3649 = Add(v3649_tmp, Mul(v3648, Set(d16, 3)));
+    auto v3650 = Add(v3647, v3649);
+    auto v3651 = MulFixedPoint15(v3650, Set(d16, 21524));
+    auto v3652 = Add(v3646, v3651);
+    auto v3653 = Sub(v2399, v2410);
+    auto v3654 = Sub(v2421, v2432);
+    auto v3655_tmp = MulFixedPoint15(v3654, Set(d16, 23437));
+    auto v3655 = Add(v3655_tmp, Mul(v3654, Set(d16, 3)));
+    auto v3656 = Add(v3653, v3655);
+    auto v3657 = Sub(v2445, v2456);
+    auto v3658 = Sub(v2468, v2479);
+    auto v3659_tmp = MulFixedPoint15(v3658, Set(d16, 23437));
+    auto v3659 = Add(v3659_tmp, Mul(v3658, Set(d16, 3)));
+    auto v3660 = Add(v3657, v3659);
+    auto v3661 = MulFixedPoint15(v3660, Set(d16, 21753));
+    auto v3662 = Add(v3656, v3661);
+    auto v3663 = Sub(v2305, v2316);
+    auto v3664 = Sub(v2327, v2338);
+    auto v3665_tmp = MulFixedPoint15(v3664, Set(d16, 17573));
+    auto v3665 = Add(v3665_tmp, Mul(v3664, Set(d16, 4)));
+    auto v3666 = Add(v3663, v3665);
+    auto v3667 = Sub(v2351, v2362);
+    auto v3668 = Sub(v2373, v2384);
+    auto v3669_tmp = MulFixedPoint15(v3668, Set(d16, 17573));
+    auto v3669 = Add(v3669_tmp, Mul(v3668, Set(d16, 4)));
+    auto v3670 = Add(v3667, v3669);
+    auto v3671 = MulFixedPoint15(v3670, Set(d16, 21990));
+    auto v3672 = Add(v3666, v3671);
+    auto v3673 = Sub(v2127, v2150);
+    auto v3674 = Sub(v2173, v2196);
+    auto v3675_tmp = MulFixedPoint15(v3674, Set(d16, 27122));
+    auto v3675 = Add(v3675_tmp, Mul(v3674, Set(d16, 5)));
+    auto v3676 = Add(v3673, v3675);
+    auto v3677 = Sub(v2221, v2244);
+    auto v3678 = Sub(v2267, v2290);
+    auto v3679_tmp = MulFixedPoint15(v3678, Set(d16, 27122));
+    auto v3679 = Add(v3679_tmp, Mul(v3678, Set(d16, 5)));
+    auto v3680 = Add(v3677, v3679);
+    auto v3681 = MulFixedPoint15(v3680, Set(d16, 22236));
+    auto v3682 = Add(v3676, v3681);
+    auto v3683 = Sub(v1937, v1960);
+    auto v3684 = Sub(v1983, v2006);
+    auto v3685_tmp = MulFixedPoint15(v3684, Set(d16, 5041));
+    auto v3685 = Add(v3685_tmp, Mul(v3684, Set(d16, 8)));
+    auto v3686 = Add(v3683, v3685);
+    auto v3687 = Sub(v2031, v2054);
+    auto v3688 = Sub(v2077, v2100);
+    auto v3689_tmp = MulFixedPoint15(v3688, Set(d16, 5041));
+    auto v3689 = Add(v3689_tmp, Mul(v3688, Set(d16, 8)));
+    auto v3690 = Add(v3687, v3689);
+    auto v3691 = MulFixedPoint15(v3690, Set(d16, 22491));
+    auto v3692 = Add(v3686, v3691);
+    auto v3693 = Sub(v1579, v1626);
+    auto v3694 = Sub(v1673, v1720);
+    auto v3695_tmp = MulFixedPoint15(v3694, Set(d16, 19146));
+    auto v3695 = Add(v3695_tmp, Mul(v3694, Set(d16, 13)));
+    auto v3696 = Add(v3693, v3695);
+    auto v3697 = Sub(v1769, v1816);
+    auto v3698 = Sub(v1863, v1910);
+    auto v3699_tmp = MulFixedPoint15(v3698, Set(d16, 19146));
+    auto v3699 = Add(v3699_tmp, Mul(v3698, Set(d16, 13)));
+    auto v3700 = Add(v3697, v3699);
+    auto v3701 = MulFixedPoint15(v3700, Set(d16, 22755));
+    auto v3702 = Add(v3696, v3701);
+    auto v3703 = Sub(v141, v316);
+    auto v3704 = Sub(v522, v698);
+    auto v3705_tmp = MulFixedPoint15(v3704, Set(d16, 24402));
+    auto v3705 = Add(v3705_tmp, Mul(v3704, Set(d16, 40)));
+    auto v3706 = Add(v3703, v3705);
+    auto v3707 = Sub(v906, v1145);
+    auto v3708 = Sub(v1351, v1528);
+    auto v3709_tmp = MulFixedPoint15(v3708, Set(d16, 24402));
+    auto v3709 = Add(v3709_tmp, Mul(v3708, Set(d16, 40)));
+    auto v3710 = Add(v3707, v3709);
+    auto v3711 = MulFixedPoint15(v3710, Set(d16, 23030));
+    auto v3712 = Add(v3706, v3711);
+    auto v3713 = Sub(v3703, v3705);
+    auto v3714 = Sub(v3707, v3709);
+    auto v3715 = MulFixedPoint15(v3714, Set(d16, 23314));
+    auto v3716 = Add(v3713, v3715);
+    auto v3717 = Sub(v3693, v3695);
+    auto v3718 = Sub(v3697, v3699);
+    auto v3719 = MulFixedPoint15(v3718, Set(d16, 23609));
+    auto v3720 = Add(v3717, v3719);
+    auto v3721 = Sub(v3683, v3685);
+    auto v3722 = Sub(v3687, v3689);
+    auto v3723 = MulFixedPoint15(v3722, Set(d16, 23915));
+    auto v3724 = Add(v3721, v3723);
+    auto v3725 = Sub(v3673, v3675);
+    auto v3726 = Sub(v3677, v3679);
+    auto v3727 = MulFixedPoint15(v3726, Set(d16, 24233));
+    auto v3728 = Add(v3725, v3727);
+    auto v3729 = Sub(v3663, v3665);
+    auto v3730 = Sub(v3667, v3669);
+    auto v3731 = MulFixedPoint15(v3730, Set(d16, 24564));
+    auto v3732 = Add(v3729, v3731);
+    auto v3733 = Sub(v3653, v3655);
+    auto v3734 = Sub(v3657, v3659);
+    auto v3735 = MulFixedPoint15(v3734, Set(d16, 24907));
+    auto v3736 = Add(v3733, v3735);
+    auto v3737 = Sub(v3643, v3645);
+    auto v3738 = Sub(v3647, v3649);
+    auto v3739 = MulFixedPoint15(v3738, Set(d16, 25264));
+    auto v3740 = Add(v3737, v3739);
+    auto v3741 = Sub(v3633, v3635);
+    auto v3742 = Sub(v3637, v3639);
+    auto v3743 = MulFixedPoint15(v3742, Set(d16, 25635));
+    auto v3744 = Add(v3741, v3743);
+    auto v3745 = Sub(v3623, v3625);
+    auto v3746 = Sub(v3627, v3629);
+    auto v3747 = MulFixedPoint15(v3746, Set(d16, 26021));
+    auto v3748 = Add(v3745, v3747);
+    auto v3749 = Sub(v3613, v3615);
+    auto v3750 = Sub(v3617, v3619);
+    auto v3751 = MulFixedPoint15(v3750, Set(d16, 26423));
+    auto v3752 = Add(v3749, v3751);
+    auto v3753 = Sub(v3603, v3605);
+    auto v3754 = Sub(v3607, v3609);
+    auto v3755 = MulFixedPoint15(v3754, Set(d16, 26842));
+    auto v3756 = Add(v3753, v3755);
+    auto v3757 = Sub(v3593, v3595);
+    auto v3758 = Sub(v3597, v3599);
+    auto v3759 = MulFixedPoint15(v3758, Set(d16, 27279));
+    auto v3760 = Add(v3757, v3759);
+    auto v3761 = Sub(v3583, v3585);
+    auto v3762 = Sub(v3587, v3589);
+    auto v3763 = MulFixedPoint15(v3762, Set(d16, 27734));
+    auto v3764 = Add(v3761, v3763);
+    auto v3765 = Sub(v3573, v3575);
+    auto v3766 = Sub(v3577, v3579);
+    auto v3767 = MulFixedPoint15(v3766, Set(d16, 28209));
+    auto v3768 = Add(v3765, v3767);
+    auto v3769 = Sub(v3563, v3565);
+    auto v3770 = Sub(v3567, v3569);
+    auto v3771 = MulFixedPoint15(v3770, Set(d16, 28705));
+    auto v3772 = Add(v3769, v3771);
+    auto v3773 = Sub(v3553, v3555);
+    auto v3774 = Sub(v3557, v3559);
+    auto v3775 = MulFixedPoint15(v3774, Set(d16, 29223));
+    auto v3776 = Add(v3773, v3775);
+    auto v3777 = Sub(v3543, v3545);
+    auto v3778 = Sub(v3547, v3549);
+    auto v3779 = MulFixedPoint15(v3778, Set(d16, 29764));
+    auto v3780 = Add(v3777, v3779);
+    auto v3781 = Sub(v3533, v3535);
+    auto v3782 = Sub(v3537, v3539);
+    auto v3783 = MulFixedPoint15(v3782, Set(d16, 30331));
+    auto v3784 = Add(v3781, v3783);
+    auto v3785 = Sub(v3523, v3525);
+    auto v3786 = Sub(v3527, v3529);
+    auto v3787 = MulFixedPoint15(v3786, Set(d16, 30925));
+    auto v3788 = Add(v3785, v3787);
+    auto v3789 = Sub(v3513, v3515);
+    auto v3790 = Sub(v3517, v3519);
+    auto v3791 = MulFixedPoint15(v3790, Set(d16, 31547));
+    auto v3792 = Add(v3789, v3791);
+    auto v3793 = Sub(v3503, v3505);
+    auto v3794 = Sub(v3507, v3509);
+    auto v3795 = MulFixedPoint15(v3794, Set(d16, 32199));
+    auto v3796 = Add(v3793, v3795);
+    auto v3797 = Sub(v3493, v3495);
+    auto v3798 = Sub(v3497, v3499);
+    auto v3799_tmp = MulFixedPoint15(v3798, Set(d16, 117));
+    auto v3799 = Add(v3799_tmp, v3798);
+    auto v3800 = Add(v3797, v3799);
+    auto v3801 = Sub(v3483, v3485);
+    auto v3802 = Sub(v3487, v3489);
+    auto v3803_tmp = MulFixedPoint15(v3802, Set(d16, 837));
+    auto v3803 = Add(v3803_tmp, v3802);
+    auto v3804 = Add(v3801, v3803);
+    auto v3805 = Sub(v3473, v3475);
+    auto v3806 = Sub(v3477, v3479);
+    auto v3807_tmp = MulFixedPoint15(v3806, Set(d16, 1594));
+    auto v3807 = Add(v3807_tmp, v3806);
+    auto v3808 = Add(v3805, v3807);
+    auto v3809 = Sub(v3463, v3465);
+    auto v3810 = Sub(v3467, v3469);
+    auto v3811_tmp = MulFixedPoint15(v3810, Set(d16, 2393));
+    auto v3811 = Add(v3811_tmp, v3810);
+    auto v3812 = Add(v3809, v3811);
+    auto v3813 = Sub(v3453, v3455);
+    auto v3814 = Sub(v3457, v3459);
+    auto v3815_tmp = MulFixedPoint15(v3814, Set(d16, 3234));
+    auto v3815 = Add(v3815_tmp, v3814);
+    auto v3816 = Add(v3813, v3815);
+    auto v3817 = Sub(v3443, v3445);
+    auto v3818 = Sub(v3447, v3449);
+    auto v3819_tmp = MulFixedPoint15(v3818, Set(d16, 4123));
+    auto v3819 = Add(v3819_tmp, v3818);
+    auto v3820 = Add(v3817, v3819);
+    auto v3821 = Sub(v3433, v3435);
+    auto v3822 = Sub(v3437, v3439);
+    auto v3823_tmp = MulFixedPoint15(v3822, Set(d16, 5062));
+    auto v3823 = Add(v3823_tmp, v3822);
+    auto v3824 = Add(v3821, v3823);
+    auto v3825 = Sub(v3423, v3425);
+    auto v3826 = Sub(v3427, v3429);
+    auto v3827_tmp = MulFixedPoint15(v3826, Set(d16, 6057));
+    auto v3827 = Add(v3827_tmp, v3826);
+    auto v3828 = Add(v3825, v3827);
+    auto v3829 = Sub(v3413, v3415);
+    auto v3830 = Sub(v3417, v3419);
+    auto v3831_tmp = MulFixedPoint15(v3830, Set(d16, 7111));
+    auto v3831 = Add(v3831_tmp, v3830);
+    auto v3832 = Add(v3829, v3831);
+    auto v3833 = Sub(v3403, v3405);
+    auto v3834 = Sub(v3407, v3409);
+    auto v3835_tmp = MulFixedPoint15(v3834, Set(d16, 8231));
+    auto v3835 = Add(v3835_tmp, v3834);
+    auto v3836 = Add(v3833, v3835);
+    auto v3837 = Sub(v3393, v3395);
+    auto v3838 = Sub(v3397, v3399);
+    auto v3839_tmp = MulFixedPoint15(v3838, Set(d16, 9421));
+    auto v3839 = Add(v3839_tmp, v3838);
+    auto v3840 = Add(v3837, v3839);
+    auto v3841 = Sub(v3374, v3379);
+    auto v3842 = Sub(v3384, v3389);
+    auto v3843_tmp = MulFixedPoint15(v3842, Set(d16, 10690));
+    auto v3843 = Add(v3843_tmp, v3842);
+    auto v3844 = Add(v3841, v3843);
+    auto v3845 = Sub(v3352, v3357);
+    auto v3846 = Sub(v3362, v3367);
+    auto v3847_tmp = MulFixedPoint15(v3846, Set(d16, 12044));
+    auto v3847 = Add(v3847_tmp, v3846);
+    auto v3848 = Add(v3845, v3847);
+    auto v3849 = Sub(v3330, v3335);
+    auto v3850 = Sub(v3340, v3345);
+    auto v3851_tmp = MulFixedPoint15(v3850, Set(d16, 13493));
+    auto v3851 = Add(v3851_tmp, v3850);
+    auto v3852 = Add(v3849, v3851);
+    auto v3853 = Sub(v3308, v3313);
+    auto v3854 = Sub(v3318, v3323);
+    auto v3855_tmp = MulFixedPoint15(v3854, Set(d16, 15046));
+    auto v3855 = Add(v3855_tmp, v3854);
+    auto v3856 = Add(v3853, v3855);
+    auto v3857 = Sub(v3286, v3291);
+    auto v3858 = Sub(v3296, v3301);
+    auto v3859_tmp = MulFixedPoint15(v3858, Set(d16, 16715));
+    auto v3859 = Add(v3859_tmp, v3858);
+    auto v3860 = Add(v3857, v3859);
+    auto v3861 = Sub(v3264, v3269);
+    auto v3862 = Sub(v3274, v3279);
+    auto v3863_tmp = MulFixedPoint15(v3862, Set(d16, 18512));
+    auto v3863 = Add(v3863_tmp, v3862);
+    auto v3864 = Add(v3861, v3863);
+    auto v3865 = Sub(v3242, v3247);
+    auto v3866 = Sub(v3252, v3257);
+    auto v3867_tmp = MulFixedPoint15(v3866, Set(d16, 20453));
+    auto v3867 = Add(v3867_tmp, v3866);
+    auto v3868 = Add(v3865, v3867);
+    auto v3869 = Sub(v3220, v3225);
+    auto v3870 = Sub(v3230, v3235);
+    auto v3871_tmp = MulFixedPoint15(v3870, Set(d16, 22555));
+    auto v3871 = Add(v3871_tmp, v3870);
+    auto v3872 = Add(v3869, v3871);
+    auto v3873 = Sub(v3198, v3203);
+    auto v3874 = Sub(v3208, v3213);
+    auto v3875_tmp = MulFixedPoint15(v3874, Set(d16, 24839));
+    auto v3875 = Add(v3875_tmp, v3874);
+    auto v3876 = Add(v3873, v3875);
+    auto v3877 = Sub(v3176, v3181);
+    auto v3878 = Sub(v3186, v3191);
+    auto v3879_tmp = MulFixedPoint15(v3878, Set(d16, 27330));
+    auto v3879 = Add(v3879_tmp, v3878);
+    auto v3880 = Add(v3877, v3879);
+    auto v3881 = Sub(v3154, v3159);
+    auto v3882 = Sub(v3164, v3169);
+    auto v3883_tmp = MulFixedPoint15(v3882, Set(d16, 30056));
+    auto v3883 = Add(v3883_tmp, v3882);
+    auto v3884 = Add(v3881, v3883);
+    auto v3885 = Sub(v3132, v3137);
+    auto v3886 = Sub(v3142, v3147);
+    auto v3887_tmp = MulFixedPoint15(v3886, Set(d16, 282));
+    auto v3887 = Add(v3887_tmp, Mul(v3886, Set(d16, 2)));
+    auto v3888 = Add(v3885, v3887);
+    auto v3889 = Sub(v3110, v3115);
+    auto v3890 = Sub(v3120, v3125);
+    auto v3891_tmp = MulFixedPoint15(v3890, Set(d16, 3588));
+    auto v3891 = Add(v3891_tmp, Mul(v3890, Set(d16, 2)));
+    auto v3892 = Add(v3889, v3891);
+    auto v3893 = Sub(v3088, v3093);
+    auto v3894 = Sub(v3098, v3103);
+    auto v3895_tmp = MulFixedPoint15(v3894, Set(d16, 7255));
+    auto v3895 = Add(v3895_tmp, Mul(v3894, Set(d16, 2)));
+    auto v3896 = Add(v3893, v3895);
+    auto v3897 = Sub(v3066, v3071);
+    auto v3898 = Sub(v3076, v3081);
+    auto v3899_tmp = MulFixedPoint15(v3898, Set(d16, 11344));
+    auto v3899 = Add(v3899_tmp, Mul(v3898, Set(d16, 2)));
+    auto v3900 = Add(v3897, v3899);
+    auto v3901 = Sub(v3044, v3049);
+    auto v3902 = Sub(v3054, v3059);
+    auto v3903_tmp = MulFixedPoint15(v3902, Set(d16, 15934));
+    auto v3903 = Add(v3903_tmp, Mul(v3902, Set(d16, 2)));
+    auto v3904 = Add(v3901, v3903);
+    auto v3905 = Sub(v3004, v3015);
+    auto v3906 = Sub(v3026, v3037);
+    auto v3907_tmp = MulFixedPoint15(v3906, Set(d16, 21120));
+    auto v3907 = Add(v3907_tmp, Mul(v3906, Set(d16, 2)));
+    auto v3908 = Add(v3905, v3907);
+    auto v3909 = Sub(v2958, v2969);
+    auto v3910 = Sub(v2980, v2991);
+    auto v3911_tmp = MulFixedPoint15(v3910, Set(d16, 27027));
+    auto v3911 = Add(v3911_tmp, Mul(v3910, Set(d16, 2)));
+    auto v3912 = Add(v3909, v3911);
+    auto v3913 = Sub(v2912, v2923);
+    auto v3914 = Sub(v2934, v2945);
+    auto v3915_tmp = MulFixedPoint15(v3914, Set(d16, 1045));
+    auto v3915 = Add(v3915_tmp, Mul(v3914, Set(d16, 3)));
+    auto v3916 = Add(v3913, v3915);
+    auto v3917 = Sub(v2866, v2877);
+    auto v3918 = Sub(v2888, v2899);
+    auto v3919_tmp = MulFixedPoint15(v3918, Set(d16, 8923));
+    auto v3919 = Add(v3919_tmp, Mul(v3918, Set(d16, 3)));
+    auto v3920 = Add(v3917, v3919);
+    auto v3921 = Sub(v2820, v2831);
+    auto v3922 = Sub(v2842, v2853);
+    auto v3923_tmp = MulFixedPoint15(v3922, Set(d16, 18177));
+    auto v3923 = Add(v3923_tmp, Mul(v3922, Set(d16, 3)));
+    auto v3924 = Add(v3921, v3923);
+    auto v3925 = Sub(v2774, v2785);
+    auto v3926 = Sub(v2796, v2807);
+    auto v3927_tmp = MulFixedPoint15(v3926, Set(d16, 29200));
+    auto v3927 = Add(v3927_tmp, Mul(v3926, Set(d16, 3)));
+    auto v3928 = Add(v3925, v3927);
+    auto v3929 = Sub(v2728, v2739);
+    auto v3930 = Sub(v2750, v2761);
+    auto v3931_tmp = MulFixedPoint15(v3930, Set(d16, 9782));
+    auto v3931 = Add(v3931_tmp, Mul(v3930, Set(d16, 4)));
+    auto v3932 = Add(v3929, v3931);
+    auto v3933 = Sub(v2682, v2693);
+    auto v3934 = Sub(v2704, v2715);
+    auto v3935_tmp = MulFixedPoint15(v3934, Set(d16, 26282));
+    auto v3935 = Add(v3935_tmp, Mul(v3934, Set(d16, 4)));
+    auto v3936 = Add(v3933, v3935);
+    auto v3937 = Sub(v2600, v2623);
+    auto v3938 = Sub(v2646, v2669);
+    auto v3939_tmp = MulFixedPoint15(v3938, Set(d16, 14423));
+    auto v3939 = Add(v3939_tmp, Mul(v3938, Set(d16, 5)));
+    auto v3940 = Add(v3937, v3939);
+    auto v3941 = Sub(v2506, v2529);
+    auto v3942 = Sub(v2552, v2575);
+    auto v3943_tmp = MulFixedPoint15(v3942, Set(d16, 9008));
+    auto v3943 = Add(v3943_tmp, Mul(v3942, Set(d16, 6)));
+    auto v3944 = Add(v3941, v3943);
+    auto v3945 = Sub(v2411, v2434);
+    auto v3946 = Sub(v2457, v2481);
+    auto v3947_tmp = MulFixedPoint15(v3946, Set(d16, 13552));
+    auto v3947 = Add(v3947_tmp, Mul(v3946, Set(d16, 7)));
+    auto v3948 = Add(v3945, v3947);
+    auto v3949 = Sub(v2317, v2340);
+    auto v3950 = Sub(v2363, v2386);
+    auto v3951_tmp = MulFixedPoint15(v3950, Set(d16, 1925));
+    auto v3951 = Add(v3951_tmp, Mul(v3950, Set(d16, 9)));
+    auto v3952 = Add(v3949, v3951);
+    auto v3953 = Sub(v2151, v2198);
+    auto v3954 = Sub(v2245, v2292);
+    auto v3955_tmp = MulFixedPoint15(v3954, Set(d16, 21123));
+    auto v3955 = Add(v3955_tmp, Mul(v3954, Set(d16, 11)));
+    auto v3956 = Add(v3953, v3955);
+    auto v3957 = Sub(v1961, v2008);
+    auto v3958 = Sub(v2055, v2102);
+    auto v3959_tmp = MulFixedPoint15(v3958, Set(d16, 9831));
+    auto v3959 = Add(v3959_tmp, Mul(v3958, Set(d16, 16)));
+    auto v3960 = Add(v3957, v3959);
+    auto v3961 = Sub(v1627, v1722);
+    auto v3962 = Sub(v1817, v1912);
+    auto v3963_tmp = MulFixedPoint15(v3962, Set(d16, 5373));
+    auto v3963 = Add(v3963_tmp, Mul(v3962, Set(d16, 27)));
+    auto v3964 = Add(v3961, v3963);
+    auto v3965 = Sub(v317, v700);
+    auto v3966 = Sub(v1146, v1530);
+    auto v3967_tmp = MulFixedPoint15(v3966, Set(d16, 15986));
+    auto v3967 = Add(v3967_tmp, Mul(v3966, Set(d16, 81)));
+    auto v3968 = Add(v3965, v3967);
+    auto v3969 = Sub(v3965, v3967);
+    auto v3970 = Sub(v3961, v3963);
+    auto v3971 = Sub(v3957, v3959);
+    auto v3972 = Sub(v3953, v3955);
+    auto v3973 = Sub(v3949, v3951);
+    auto v3974 = Sub(v3945, v3947);
+    auto v3975 = Sub(v3941, v3943);
+    auto v3976 = Sub(v3937, v3939);
+    auto v3977 = Sub(v3933, v3935);
+    auto v3978 = Sub(v3929, v3931);
+    auto v3979 = Sub(v3925, v3927);
+    auto v3980 = Sub(v3921, v3923);
+    auto v3981 = Sub(v3917, v3919);
+    auto v3982 = Sub(v3913, v3915);
+    auto v3983 = Sub(v3909, v3911);
+    auto v3984 = Sub(v3905, v3907);
+    auto v3985 = Sub(v3901, v3903);
+    auto v3986 = Sub(v3897, v3899);
+    auto v3987 = Sub(v3893, v3895);
+    auto v3988 = Sub(v3889, v3891);
+    auto v3989 = Sub(v3885, v3887);
+    auto v3990 = Sub(v3881, v3883);
+    auto v3991 = Sub(v3877, v3879);
+    auto v3992 = Sub(v3873, v3875);
+    auto v3993 = Sub(v3869, v3871);
+    auto v3994 = Sub(v3865, v3867);
+    auto v3995 = Sub(v3861, v3863);
+    auto v3996 = Sub(v3857, v3859);
+    auto v3997 = Sub(v3853, v3855);
+    auto v3998 = Sub(v3849, v3851);
+    auto v3999 = Sub(v3845, v3847);
+    auto v4000 = Sub(v3841, v3843);
+    auto v4001 = Sub(v3837, v3839);
+    auto v4002 = Sub(v3833, v3835);
+    auto v4003 = Sub(v3829, v3831);
+    auto v4004 = Sub(v3825, v3827);
+    auto v4005 = Sub(v3821, v3823);
+    auto v4006 = Sub(v3817, v3819);
+    auto v4007 = Sub(v3813, v3815);
+    auto v4008 = Sub(v3809, v3811);
+    auto v4009 = Sub(v3805, v3807);
+    auto v4010 = Sub(v3801, v3803);
+    auto v4011 = Sub(v3797, v3799);
+    auto v4012 = Sub(v3793, v3795);
+    auto v4013 = Sub(v3789, v3791);
+    auto v4014 = Sub(v3785, v3787);
+    auto v4015 = Sub(v3781, v3783);
+    auto v4016 = Sub(v3777, v3779);
+    auto v4017 = Sub(v3773, v3775);
+    auto v4018 = Sub(v3769, v3771);
+    auto v4019 = Sub(v3765, v3767);
+    auto v4020 = Sub(v3761, v3763);
+    auto v4021 = Sub(v3757, v3759);
+    auto v4022 = Sub(v3753, v3755);
+    auto v4023 = Sub(v3749, v3751);
+    auto v4024 = Sub(v3745, v3747);
+    auto v4025 = Sub(v3741, v3743);
+    auto v4026 = Sub(v3737, v3739);
+    auto v4027 = Sub(v3733, v3735);
+    auto v4028 = Sub(v3729, v3731);
+    auto v4029 = Sub(v3725, v3727);
+    auto v4030 = Sub(v3721, v3723);
+    auto v4031 = Sub(v3717, v3719);
+    auto v4032 = Sub(v3713, v3715);
+    auto v4033 = Sub(v3706, v3711);
+    auto v4034 = Sub(v3696, v3701);
+    auto v4035 = Sub(v3686, v3691);
+    auto v4036 = Sub(v3676, v3681);
+    auto v4037 = Sub(v3666, v3671);
+    auto v4038 = Sub(v3656, v3661);
+    auto v4039 = Sub(v3646, v3651);
+    auto v4040 = Sub(v3636, v3641);
+    auto v4041 = Sub(v3626, v3631);
+    auto v4042 = Sub(v3616, v3621);
+    auto v4043 = Sub(v3606, v3611);
+    auto v4044 = Sub(v3596, v3601);
+    auto v4045 = Sub(v3586, v3591);
+    auto v4046 = Sub(v3576, v3581);
+    auto v4047 = Sub(v3566, v3571);
+    auto v4048 = Sub(v3556, v3561);
+    auto v4049 = Sub(v3546, v3551);
+    auto v4050 = Sub(v3536, v3541);
+    auto v4051 = Sub(v3526, v3531);
+    auto v4052 = Sub(v3516, v3521);
+    auto v4053 = Sub(v3506, v3511);
+    auto v4054 = Sub(v3496, v3501);
+    auto v4055 = Sub(v3486, v3491);
+    auto v4056 = Sub(v3476, v3481);
+    auto v4057 = Sub(v3466, v3471);
+    auto v4058 = Sub(v3456, v3461);
+    auto v4059 = Sub(v3446, v3451);
+    auto v4060 = Sub(v3436, v3441);
+    auto v4061 = Sub(v3426, v3431);
+    auto v4062 = Sub(v3416, v3421);
+    auto v4063 = Sub(v3406, v3411);
+    auto v4064 = Sub(v3396, v3401);
+    auto v4065 = Sub(v3380, v3391);
+    auto v4066 = Sub(v3358, v3369);
+    auto v4067 = Sub(v3336, v3347);
+    auto v4068 = Sub(v3314, v3325);
+    auto v4069 = Sub(v3292, v3303);
+    auto v4070 = Sub(v3270, v3281);
+    auto v4071 = Sub(v3248, v3259);
+    auto v4072 = Sub(v3226, v3237);
+    auto v4073 = Sub(v3204, v3215);
+    auto v4074 = Sub(v3182, v3193);
+    auto v4075 = Sub(v3160, v3171);
+    auto v4076 = Sub(v3138, v3149);
+    auto v4077 = Sub(v3116, v3127);
+    auto v4078 = Sub(v3094, v3105);
+    auto v4079 = Sub(v3072, v3083);
+    auto v4080 = Sub(v3050, v3061);
+    auto v4081 = Sub(v3016, v3039);
+    auto v4082 = Sub(v2970, v2993);
+    auto v4083 = Sub(v2924, v2947);
+    auto v4084 = Sub(v2878, v2901);
+    auto v4085 = Sub(v2832, v2855);
+    auto v4086 = Sub(v2786, v2809);
+    auto v4087 = Sub(v2740, v2763);
+    auto v4088 = Sub(v2694, v2717);
+    auto v4089 = Sub(v2624, v2671);
+    auto v4090 = Sub(v2530, v2577);
+    auto v4091 = Sub(v2435, v2483);
+    auto v4092 = Sub(v2341, v2388);
+    auto v4093 = Sub(v2199, v2294);
+    auto v4094 = Sub(v2009, v2104);
+    auto v4095 = Sub(v1723, v1914);
+    auto v4096 = Sub(v701, v1532);
+    StoreU(v1533, d16, out + out_stride * 0 + i);
+    StoreU(v1915, d16, out + out_stride * 1 + i);
+    StoreU(v2105, d16, out + out_stride * 2 + i);
+    StoreU(v2295, d16, out + out_stride * 3 + i);
+    StoreU(v2389, d16, out + out_stride * 4 + i);
+    StoreU(v2484, d16, out + out_stride * 5 + i);
+    StoreU(v2578, d16, out + out_stride * 6 + i);
+    StoreU(v2672, d16, out + out_stride * 7 + i);
+    StoreU(v2718, d16, out + out_stride * 8 + i);
+    StoreU(v2764, d16, out + out_stride * 9 + i);
+    StoreU(v2810, d16, out + out_stride * 10 + i);
+    StoreU(v2856, d16, out + out_stride * 11 + i);
+    StoreU(v2902, d16, out + out_stride * 12 + i);
+    StoreU(v2948, d16, out + out_stride * 13 + i);
+    StoreU(v2994, d16, out + out_stride * 14 + i);
+    StoreU(v3040, d16, out + out_stride * 15 + i);
+    StoreU(v3062, d16, out + out_stride * 16 + i);
+    StoreU(v3084, d16, out + out_stride * 17 + i);
+    StoreU(v3106, d16, out + out_stride * 18 + i);
+    StoreU(v3128, d16, out + out_stride * 19 + i);
+    StoreU(v3150, d16, out + out_stride * 20 + i);
+    StoreU(v3172, d16, out + out_stride * 21 + i);
+    StoreU(v3194, d16, out + out_stride * 22 + i);
+    StoreU(v3216, d16, out + out_stride * 23 + i);
+    StoreU(v3238, d16, out + out_stride * 24 + i);
+    StoreU(v3260, d16, out + out_stride * 25 + i);
+    StoreU(v3282, d16, out + out_stride * 26 + i);
+    StoreU(v3304, d16, out + out_stride * 27 + i);
+    StoreU(v3326, d16, out + out_stride * 28 + i);
+    StoreU(v3348, d16, out + out_stride * 29 + i);
+    StoreU(v3370, d16, out + out_stride * 30 + i);
+    StoreU(v3392, d16, out + out_stride * 31 + i);
+    StoreU(v3402, d16, out + out_stride * 32 + i);
+    StoreU(v3412, d16, out + out_stride * 33 + i);
+    StoreU(v3422, d16, out + out_stride * 34 + i);
+    StoreU(v3432, d16, out + out_stride * 35 + i);
+    StoreU(v3442, d16, out + out_stride * 36 + i);
+    StoreU(v3452, d16, out + out_stride * 37 + i);
+    StoreU(v3462, d16, out + out_stride * 38 + i);
+    StoreU(v3472, d16, out + out_stride * 39 + i);
+    StoreU(v3482, d16, out + out_stride * 40 + i);
+    StoreU(v3492, d16, out + out_stride * 41 + i);
+    StoreU(v3502, d16, out + out_stride * 42 + i);
+    StoreU(v3512, d16, out + out_stride * 43 + i);
+    StoreU(v3522, d16, out + out_stride * 44 + i);
+    StoreU(v3532, d16, out + out_stride * 45 + i);
+    StoreU(v3542, d16, out + out_stride * 46 + i);
+    StoreU(v3552, d16, out + out_stride * 47 + i);
+    StoreU(v3562, d16, out + out_stride * 48 + i);
+    StoreU(v3572, d16, out + out_stride * 49 + i);
+    StoreU(v3582, d16, out + out_stride * 50 + i);
+    StoreU(v3592, d16, out + out_stride * 51 + i);
+    StoreU(v3602, d16, out + out_stride * 52 + i);
+    StoreU(v3612, d16, out + out_stride * 53 + i);
+    StoreU(v3622, d16, out + out_stride * 54 + i);
+    StoreU(v3632, d16, out + out_stride * 55 + i);
+    StoreU(v3642, d16, out + out_stride * 56 + i);
+    StoreU(v3652, d16, out + out_stride * 57 + i);
+    StoreU(v3662, d16, out + out_stride * 58 + i);
+    StoreU(v3672, d16, out + out_stride * 59 + i);
+    StoreU(v3682, d16, out + out_stride * 60 + i);
+    StoreU(v3692, d16, out + out_stride * 61 + i);
+    StoreU(v3702, d16, out + out_stride * 62 + i);
+    StoreU(v3712, d16, out + out_stride * 63 + i);
+    StoreU(v3716, d16, out + out_stride * 64 + i);
+    StoreU(v3720, d16, out + out_stride * 65 + i);
+    StoreU(v3724, d16, out + out_stride * 66 + i);
+    StoreU(v3728, d16, out + out_stride * 67 + i);
+    StoreU(v3732, d16, out + out_stride * 68 + i);
+    StoreU(v3736, d16, out + out_stride * 69 + i);
+    StoreU(v3740, d16, out + out_stride * 70 + i);
+    StoreU(v3744, d16, out + out_stride * 71 + i);
+    StoreU(v3748, d16, out + out_stride * 72 + i);
+    StoreU(v3752, d16, out + out_stride * 73 + i);
+    StoreU(v3756, d16, out + out_stride * 74 + i);
+    StoreU(v3760, d16, out + out_stride * 75 + i);
+    StoreU(v3764, d16, out + out_stride * 76 + i);
+    StoreU(v3768, d16, out + out_stride * 77 + i);
+    StoreU(v3772, d16, out + out_stride * 78 + i);
+    StoreU(v3776, d16, out + out_stride * 79 + i);
+    StoreU(v3780, d16, out + out_stride * 80 + i);
+    StoreU(v3784, d16, out + out_stride * 81 + i);
+    StoreU(v3788, d16, out + out_stride * 82 + i);
+    StoreU(v3792, d16, out + out_stride * 83 + i);
+    StoreU(v3796, d16, out + out_stride * 84 + i);
+    StoreU(v3800, d16, out + out_stride * 85 + i);
+    StoreU(v3804, d16, out + out_stride * 86 + i);
+    StoreU(v3808, d16, out + out_stride * 87 + i);
+    StoreU(v3812, d16, out + out_stride * 88 + i);
+    StoreU(v3816, d16, out + out_stride * 89 + i);
+    StoreU(v3820, d16, out + out_stride * 90 + i);
+    StoreU(v3824, d16, out + out_stride * 91 + i);
+    StoreU(v3828, d16, out + out_stride * 92 + i);
+    StoreU(v3832, d16, out + out_stride * 93 + i);
+    StoreU(v3836, d16, out + out_stride * 94 + i);
+    StoreU(v3840, d16, out + out_stride * 95 + i);
+    StoreU(v3844, d16, out + out_stride * 96 + i);
+    StoreU(v3848, d16, out + out_stride * 97 + i);
+    StoreU(v3852, d16, out + out_stride * 98 + i);
+    StoreU(v3856, d16, out + out_stride * 99 + i);
+    StoreU(v3860, d16, out + out_stride * 100 + i);
+    StoreU(v3864, d16, out + out_stride * 101 + i);
+    StoreU(v3868, d16, out + out_stride * 102 + i);
+    StoreU(v3872, d16, out + out_stride * 103 + i);
+    StoreU(v3876, d16, out + out_stride * 104 + i);
+    StoreU(v3880, d16, out + out_stride * 105 + i);
+    StoreU(v3884, d16, out + out_stride * 106 + i);
+    StoreU(v3888, d16, out + out_stride * 107 + i);
+    StoreU(v3892, d16, out + out_stride * 108 + i);
+    StoreU(v3896, d16, out + out_stride * 109 + i);
+    StoreU(v3900, d16, out + out_stride * 110 + i);
+    StoreU(v3904, d16, out + out_stride * 111 + i);
+    StoreU(v3908, d16, out + out_stride * 112 + i);
+    StoreU(v3912, d16, out + out_stride * 113 + i);
+    StoreU(v3916, d16, out + out_stride * 114 + i);
+    StoreU(v3920, d16, out + out_stride * 115 + i);
+    StoreU(v3924, d16, out + out_stride * 116 + i);
+    StoreU(v3928, d16, out + out_stride * 117 + i);
+    StoreU(v3932, d16, out + out_stride * 118 + i);
+    StoreU(v3936, d16, out + out_stride * 119 + i);
+    StoreU(v3940, d16, out + out_stride * 120 + i);
+    StoreU(v3944, d16, out + out_stride * 121 + i);
+    StoreU(v3948, d16, out + out_stride * 122 + i);
+    StoreU(v3952, d16, out + out_stride * 123 + i);
+    StoreU(v3956, d16, out + out_stride * 124 + i);
+    StoreU(v3960, d16, out + out_stride * 125 + i);
+    StoreU(v3964, d16, out + out_stride * 126 + i);
+    StoreU(v3968, d16, out + out_stride * 127 + i);
+    StoreU(v3969, d16, out + out_stride * 128 + i);
+    StoreU(v3970, d16, out + out_stride * 129 + i);
+    StoreU(v3971, d16, out + out_stride * 130 + i);
+    StoreU(v3972, d16, out + out_stride * 131 + i);
+    StoreU(v3973, d16, out + out_stride * 132 + i);
+    StoreU(v3974, d16, out + out_stride * 133 + i);
+    StoreU(v3975, d16, out + out_stride * 134 + i);
+    StoreU(v3976, d16, out + out_stride * 135 + i);
+    StoreU(v3977, d16, out + out_stride * 136 + i);
+    StoreU(v3978, d16, out + out_stride * 137 + i);
+    StoreU(v3979, d16, out + out_stride * 138 + i);
+    StoreU(v3980, d16, out + out_stride * 139 + i);
+    StoreU(v3981, d16, out + out_stride * 140 + i);
+    StoreU(v3982, d16, out + out_stride * 141 + i);
+    StoreU(v3983, d16, out + out_stride * 142 + i);
+    StoreU(v3984, d16, out + out_stride * 143 + i);
+    StoreU(v3985, d16, out + out_stride * 144 + i);
+    StoreU(v3986, d16, out + out_stride * 145 + i);
+    StoreU(v3987, d16, out + out_stride * 146 + i);
+    StoreU(v3988, d16, out + out_stride * 147 + i);
+    StoreU(v3989, d16, out + out_stride * 148 + i);
+    StoreU(v3990, d16, out + out_stride * 149 + i);
+    StoreU(v3991, d16, out + out_stride * 150 + i);
+    StoreU(v3992, d16, out + out_stride * 151 + i);
+    StoreU(v3993, d16, out + out_stride * 152 + i);
+    StoreU(v3994, d16, out + out_stride * 153 + i);
+    StoreU(v3995, d16, out + out_stride * 154 + i);
+    StoreU(v3996, d16, out + out_stride * 155 + i);
+    StoreU(v3997, d16, out + out_stride * 156 + i);
+    StoreU(v3998, d16, out + out_stride * 157 + i);
+    StoreU(v3999, d16, out + out_stride * 158 + i);
+    StoreU(v4000, d16, out + out_stride * 159 + i);
+    StoreU(v4001, d16, out + out_stride * 160 + i);
+    StoreU(v4002, d16, out + out_stride * 161 + i);
+    StoreU(v4003, d16, out + out_stride * 162 + i);
+    StoreU(v4004, d16, out + out_stride * 163 + i);
+    StoreU(v4005, d16, out + out_stride * 164 + i);
+    StoreU(v4006, d16, out + out_stride * 165 + i);
+    StoreU(v4007, d16, out + out_stride * 166 + i);
+    StoreU(v4008, d16, out + out_stride * 167 + i);
+    StoreU(v4009, d16, out + out_stride * 168 + i);
+    StoreU(v4010, d16, out + out_stride * 169 + i);
+    StoreU(v4011, d16, out + out_stride * 170 + i);
+    StoreU(v4012, d16, out + out_stride * 171 + i);
+    StoreU(v4013, d16, out + out_stride * 172 + i);
+    StoreU(v4014, d16, out + out_stride * 173 + i);
+    StoreU(v4015, d16, out + out_stride * 174 + i);
+    StoreU(v4016, d16, out + out_stride * 175 + i);
+    StoreU(v4017, d16, out + out_stride * 176 + i);
+    StoreU(v4018, d16, out + out_stride * 177 + i);
+    StoreU(v4019, d16, out + out_stride * 178 + i);
+    StoreU(v4020, d16, out + out_stride * 179 + i);
+    StoreU(v4021, d16, out + out_stride * 180 + i);
+    StoreU(v4022, d16, out + out_stride * 181 + i);
+    StoreU(v4023, d16, out + out_stride * 182 + i);
+    StoreU(v4024, d16, out + out_stride * 183 + i);
+    StoreU(v4025, d16, out + out_stride * 184 + i);
+    StoreU(v4026, d16, out + out_stride * 185 + i);
+    StoreU(v4027, d16, out + out_stride * 186 + i);
+    StoreU(v4028, d16, out + out_stride * 187 + i);
+    StoreU(v4029, d16, out + out_stride * 188 + i);
+    StoreU(v4030, d16, out + out_stride * 189 + i);
+    StoreU(v4031, d16, out + out_stride * 190 + i);
+    StoreU(v4032, d16, out + out_stride * 191 + i);
+    StoreU(v4033, d16, out + out_stride * 192 + i);
+    StoreU(v4034, d16, out + out_stride * 193 + i);
+    StoreU(v4035, d16, out + out_stride * 194 + i);
+    StoreU(v4036, d16, out + out_stride * 195 + i);
+    StoreU(v4037, d16, out + out_stride * 196 + i);
+    StoreU(v4038, d16, out + out_stride * 197 + i);
+    StoreU(v4039, d16, out + out_stride * 198 + i);
+    StoreU(v4040, d16, out + out_stride * 199 + i);
+    StoreU(v4041, d16, out + out_stride * 200 + i);
+    StoreU(v4042, d16, out + out_stride * 201 + i);
+    StoreU(v4043, d16, out + out_stride * 202 + i);
+    StoreU(v4044, d16, out + out_stride * 203 + i);
+    StoreU(v4045, d16, out + out_stride * 204 + i);
+    StoreU(v4046, d16, out + out_stride * 205 + i);
+    StoreU(v4047, d16, out + out_stride * 206 + i);
+    StoreU(v4048, d16, out + out_stride * 207 + i);
+    StoreU(v4049, d16, out + out_stride * 208 + i);
+    StoreU(v4050, d16, out + out_stride * 209 + i);
+    StoreU(v4051, d16, out + out_stride * 210 + i);
+    StoreU(v4052, d16, out + out_stride * 211 + i);
+    StoreU(v4053, d16, out + out_stride * 212 + i);
+    StoreU(v4054, d16, out + out_stride * 213 + i);
+    StoreU(v4055, d16, out + out_stride * 214 + i);
+    StoreU(v4056, d16, out + out_stride * 215 + i);
+    StoreU(v4057, d16, out + out_stride * 216 + i);
+    StoreU(v4058, d16, out + out_stride * 217 + i);
+    StoreU(v4059, d16, out + out_stride * 218 + i);
+    StoreU(v4060, d16, out + out_stride * 219 + i);
+    StoreU(v4061, d16, out + out_stride * 220 + i);
+    StoreU(v4062, d16, out + out_stride * 221 + i);
+    StoreU(v4063, d16, out + out_stride * 222 + i);
+    StoreU(v4064, d16, out + out_stride * 223 + i);
+    StoreU(v4065, d16, out + out_stride * 224 + i);
+    StoreU(v4066, d16, out + out_stride * 225 + i);
+    StoreU(v4067, d16, out + out_stride * 226 + i);
+    StoreU(v4068, d16, out + out_stride * 227 + i);
+    StoreU(v4069, d16, out + out_stride * 228 + i);
+    StoreU(v4070, d16, out + out_stride * 229 + i);
+    StoreU(v4071, d16, out + out_stride * 230 + i);
+    StoreU(v4072, d16, out + out_stride * 231 + i);
+    StoreU(v4073, d16, out + out_stride * 232 + i);
+    StoreU(v4074, d16, out + out_stride * 233 + i);
+    StoreU(v4075, d16, out + out_stride * 234 + i);
+    StoreU(v4076, d16, out + out_stride * 235 + i);
+    StoreU(v4077, d16, out + out_stride * 236 + i);
+    StoreU(v4078, d16, out + out_stride * 237 + i);
+    StoreU(v4079, d16, out + out_stride * 238 + i);
+    StoreU(v4080, d16, out + out_stride * 239 + i);
+    StoreU(v4081, d16, out + out_stride * 240 + i);
+    StoreU(v4082, d16, out + out_stride * 241 + i);
+    StoreU(v4083, d16, out + out_stride * 242 + i);
+    StoreU(v4084, d16, out + out_stride * 243 + i);
+    StoreU(v4085, d16, out + out_stride * 244 + i);
+    StoreU(v4086, d16, out + out_stride * 245 + i);
+    StoreU(v4087, d16, out + out_stride * 246 + i);
+    StoreU(v4088, d16, out + out_stride * 247 + i);
+    StoreU(v4089, d16, out + out_stride * 248 + i);
+    StoreU(v4090, d16, out + out_stride * 249 + i);
+    StoreU(v4091, d16, out + out_stride * 250 + i);
+    StoreU(v4092, d16, out + out_stride * 251 + i);
+    StoreU(v4093, d16, out + out_stride * 252 + i);
+    StoreU(v4094, d16, out + out_stride * 253 + i);
+    StoreU(v4095, d16, out + out_stride * 254 + i);
+    StoreU(v4096, d16, out + out_stride * 255 + i);
   }
 }
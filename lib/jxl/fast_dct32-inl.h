@@ -3,417 +3,417 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
-/* This file is automatically generated. Do not modify it directly. */
-#if HWY_TARGET != HWY_NEON
-#error "only include this file from fast_dct-inl.h"
-#endif
+// Fixed-point IDCT of size 32, only meant to be included by
+// fast_dct_testonly-inl.h.
 
 constexpr size_t FastIDCTIntegerBits(FastDCTTag<32>) { return 1; }
 
-void FastIDCT(FastDCTTag<32>, const int16_t* in, size_t in_stride, int16_t* out,
-              size_t out_stride, size_t count) {
+HWY_MAYBE_UNUSED void FastIDCT(FastDCTTag<32>, const int16_t* in,
+                               size_t in_stride, int16_t* out,
+                               size_t out_stride, size_t count) {
   JXL_ASSERT(count % 8 == 0);
-  for (size_t i = 0; i < count; i += 8) {
-    int16x8_t v0 = vld1q_s16(in + in_stride * 0 + i);
-    int16x8_t v1 = vld1q_s16(in + in_stride * 16 + i);
-    int16x8_t v2 = vaddq_s16(v0, v1);
-    int16x8_t v3 = vld1q_s16(in + in_stride * 8 + i);
-    int16x8_t v4_tmp = vqrdmulhq_n_s16(v3, 13573);
-    int16x8_t v4 = vaddq_s16(v4_tmp, v3);
-    int16x8_t v5 = vld1q_s16(in + in_stride * 24 + i);
-    int16x8_t v6 = vaddq_s16(v5, v3);
-    int16x8_t v7 = vaddq_s16(v4, v6);
-    int16x8_t v8 = vqrdmulhq_n_s16(v7, 17734);
-    int16x8_t v9 = vaddq_s16(v2, v8);
-    int16x8_t v10 = vld1q_s16(in + in_stride * 4 + i);
-    int16x8_t v11_tmp = vqrdmulhq_n_s16(v10, 13573);
-    int16x8_t v11 = vaddq_s16(v11_tmp, v10);
-    int16x8_t v12 = vld1q_s16(in + in_stride * 20 + i);
-    int16x8_t v13 = vld1q_s16(in + in_stride * 12 + i);
-    int16x8_t v14 = vaddq_s16(v12, v13);
-    int16x8_t v15 = vaddq_s16(v11, v14);
-    int16x8_t v16 = vld1q_s16(in + in_stride * 28 + i);
-    int16x8_t v17 = vaddq_s16(v16, v12);
-    int16x8_t v18 = vaddq_s16(v13, v10);
-    int16x8_t v19 = vaddq_s16(v17, v18);
-    int16x8_t v20 = vqrdmulhq_n_s16(v19, 17734);
-    int16x8_t v21 = vqrdmulhq_n_s16(v18, 25080);
-    int16x8_t v22 = vaddq_s16(v20, v21);
-    int16x8_t v23 = vaddq_s16(v15, v22);
-    int16x8_t v24 = vqrdmulhq_n_s16(v23, 16705);
-    int16x8_t v25 = vaddq_s16(v9, v24);
-    int16x8_t v26 = vld1q_s16(in + in_stride * 2 + i);
-    int16x8_t v27_tmp = vqrdmulhq_n_s16(v26, 13573);
-    int16x8_t v27 = vaddq_s16(v27_tmp, v26);
-    int16x8_t v28 = vld1q_s16(in + in_stride * 18 + i);
-    int16x8_t v29 = vld1q_s16(in + in_stride * 14 + i);
-    int16x8_t v30 = vaddq_s16(v28, v29);
-    int16x8_t v31 = vaddq_s16(v27, v30);
-    int16x8_t v32 = vld1q_s16(in + in_stride * 10 + i);
-    int16x8_t v33 = vld1q_s16(in + in_stride * 6 + i);
-    int16x8_t v34 = vaddq_s16(v32, v33);
-    int16x8_t v35 = vqrdmulhq_n_s16(v34, 25080);
-    int16x8_t v36 = vld1q_s16(in + in_stride * 26 + i);
-    int16x8_t v37 = vld1q_s16(in + in_stride * 22 + i);
-    int16x8_t v38 = vaddq_s16(v36, v37);
-    int16x8_t v39 = vaddq_s16(v38, v34);
-    int16x8_t v40 = vqrdmulhq_n_s16(v39, 17734);
-    int16x8_t v41 = vaddq_s16(v35, v40);
-    int16x8_t v42 = vaddq_s16(v31, v41);
-    int16x8_t v43 = vaddq_s16(v33, v26);
-    int16x8_t v44_tmp = vqrdmulhq_n_s16(v43, 13573);
-    int16x8_t v44 = vaddq_s16(v44_tmp, v43);
-    int16x8_t v45 = vaddq_s16(v29, v32);
-    int16x8_t v46 = vaddq_s16(v37, v28);
-    int16x8_t v47 = vaddq_s16(v45, v46);
-    int16x8_t v48 = vaddq_s16(v44, v47);
-    int16x8_t v49 = vqrdmulhq_n_s16(v48, 16705);
-    int16x8_t v50 = vld1q_s16(in + in_stride * 30 + i);
-    int16x8_t v51 = vaddq_s16(v50, v36);
-    int16x8_t v52 = vaddq_s16(v51, v46);
-    int16x8_t v53 = vqrdmulhq_n_s16(v52, 17734);
-    int16x8_t v54 = vaddq_s16(v45, v43);
-    int16x8_t v55_tmp = vqrdmulhq_n_s16(v54, 10045);
-    int16x8_t v55 = vaddq_s16(v55_tmp, v54);
-    int16x8_t v56 = vaddq_s16(v53, v55);
-    int16x8_t v57 = vqrdmulhq_n_s16(v56, 16705);
-    int16x8_t v58 = vaddq_s16(v49, v57);
-    int16x8_t v59 = vaddq_s16(v42, v58);
-    int16x8_t v60 = vqrdmulhq_n_s16(v59, 16463);
-    int16x8_t v61 = vaddq_s16(v25, v60);
-    int16x8_t v62 = vld1q_s16(in + in_stride * 13 + i);
-    int16x8_t v63 = vld1q_s16(in + in_stride * 11 + i);
-    int16x8_t v64 = vaddq_s16(v62, v63);
-    int16x8_t v65 = vld1q_s16(in + in_stride * 5 + i);
-    int16x8_t v66 = vld1q_s16(in + in_stride * 3 + i);
-    int16x8_t v67 = vaddq_s16(v65, v66);
-    int16x8_t v68 = vaddq_s16(v64, v67);
-    int16x8_t v69_tmp = vqrdmulhq_n_s16(v68, 10045);
-    int16x8_t v69 = vaddq_s16(v69_tmp, v68);
-    int16x8_t v70 = vld1q_s16(in + in_stride * 21 + i);
-    int16x8_t v71 = vld1q_s16(in + in_stride * 19 + i);
-    int16x8_t v72 = vaddq_s16(v70, v71);
-    int16x8_t v73 = vld1q_s16(in + in_stride * 29 + i);
-    int16x8_t v74 = vld1q_s16(in + in_stride * 27 + i);
-    int16x8_t v75 = vaddq_s16(v73, v74);
-    int16x8_t v76 = vaddq_s16(v72, v75);
-    int16x8_t v77 = vqrdmulhq_n_s16(v76, 17734);
-    int16x8_t v78 = vaddq_s16(v69, v77);
-    int16x8_t v79 = vqrdmulhq_n_s16(v78, 16705);
-    int16x8_t v80_tmp = vqrdmulhq_n_s16(v67, 13573);
-    int16x8_t v80 = vaddq_s16(v80_tmp, v67);
-    int16x8_t v81 = vaddq_s16(v64, v72);
-    int16x8_t v82 = vaddq_s16(v80, v81);
-    int16x8_t v83 = vqrdmulhq_n_s16(v82, 16705);
-    int16x8_t v84 = vaddq_s16(v79, v83);
-    int16x8_t v85 = vld1q_s16(in + in_stride * 1 + i);
-    int16x8_t v86_tmp = vqrdmulhq_n_s16(v85, 13573);
-    int16x8_t v86 = vaddq_s16(v86_tmp, v85);
-    int16x8_t v87 = vld1q_s16(in + in_stride * 17 + i);
-    int16x8_t v88 = vld1q_s16(in + in_stride * 15 + i);
-    int16x8_t v89 = vaddq_s16(v87, v88);
-    int16x8_t v90 = vaddq_s16(v86, v89);
-    int16x8_t v91 = vld1q_s16(in + in_stride * 9 + i);
-    int16x8_t v92 = vld1q_s16(in + in_stride * 7 + i);
-    int16x8_t v93 = vaddq_s16(v91, v92);
-    int16x8_t v94 = vqrdmulhq_n_s16(v93, 25080);
-    int16x8_t v95 = vld1q_s16(in + in_stride * 25 + i);
-    int16x8_t v96 = vld1q_s16(in + in_stride * 23 + i);
-    int16x8_t v97 = vaddq_s16(v95, v96);
-    int16x8_t v98 = vaddq_s16(v97, v93);
-    int16x8_t v99 = vqrdmulhq_n_s16(v98, 17734);
-    int16x8_t v100 = vaddq_s16(v94, v99);
-    int16x8_t v101 = vaddq_s16(v90, v100);
-    int16x8_t v102 = vaddq_s16(v84, v101);
-    int16x8_t v103 = vaddq_s16(v92, v65);
-    int16x8_t v104 = vaddq_s16(v66, v85);
-    int16x8_t v105 = vaddq_s16(v103, v104);
-    int16x8_t v106_tmp = vqrdmulhq_n_s16(v105, 13573);
-    int16x8_t v106 = vaddq_s16(v106_tmp, v105);
-    int16x8_t v107 = vaddq_s16(v96, v70);
-    int16x8_t v108 = vaddq_s16(v71, v87);
-    int16x8_t v109 = vaddq_s16(v107, v108);
-    int16x8_t v110 = vaddq_s16(v63, v91);
-    int16x8_t v111 = vaddq_s16(v88, v62);
-    int16x8_t v112 = vaddq_s16(v110, v111);
-    int16x8_t v113 = vaddq_s16(v109, v112);
-    int16x8_t v114 = vaddq_s16(v106, v113);
-    int16x8_t v115 = vqrdmulhq_n_s16(v114, 16705);
-    int16x8_t v116 = vaddq_s16(v112, v105);
-    int16x8_t v117 = vqrdmulhq_n_s16(v116, 25080);
-    int16x8_t v118 = vqrdmulhq_n_s16(v116, 17734);
-    int16x8_t v119 = vaddq_s16(v74, v95);
-    int16x8_t v120 = vld1q_s16(in + in_stride * 31 + i);
-    int16x8_t v121 = vaddq_s16(v120, v73);
-    int16x8_t v122 = vaddq_s16(v119, v121);
-    int16x8_t v123 = vaddq_s16(v122, v109);
-    int16x8_t v124 = vqrdmulhq_n_s16(v123, 17734);
-    int16x8_t v125 = vaddq_s16(v118, v124);
-    int16x8_t v126 = vaddq_s16(v117, v125);
-    int16x8_t v127 = vqrdmulhq_n_s16(v126, 16705);
-    int16x8_t v128 = vaddq_s16(v115, v127);
-    int16x8_t v129 = vqrdmulhq_n_s16(v128, 16463);
-    int16x8_t v130_tmp = vqrdmulhq_n_s16(v104, 13573);
-    int16x8_t v130 = vaddq_s16(v130_tmp, v104);
-    int16x8_t v131 = vaddq_s16(v108, v111);
-    int16x8_t v132 = vaddq_s16(v130, v131);
-    int16x8_t v133 = vaddq_s16(v119, v107);
-    int16x8_t v134 = vqrdmulhq_n_s16(v133, 17734);
-    int16x8_t v135 = vaddq_s16(v110, v103);
-    int16x8_t v136_tmp = vqrdmulhq_n_s16(v135, 10045);
-    int16x8_t v136 = vaddq_s16(v136_tmp, v135);
-    int16x8_t v137 = vaddq_s16(v134, v136);
-    int16x8_t v138 = vaddq_s16(v132, v137);
-    int16x8_t v139 = vqrdmulhq_n_s16(v138, 16463);
-    int16x8_t v140 = vaddq_s16(v129, v139);
-    int16x8_t v141 = vaddq_s16(v102, v140);
-    int16x8_t v142 = vqrdmulhq_n_s16(v141, 16404);
-    int16x8_t v143 = vaddq_s16(v61, v142);
-    int16x8_t v144 = vsubq_s16(v0, v1);
-    int16x8_t v145 = vsubq_s16(v4, v6);
-    int16x8_t v146_tmp = vqrdmulhq_n_s16(v145, 10045);
-    int16x8_t v146 = vaddq_s16(v146_tmp, v145);
-    int16x8_t v147 = vaddq_s16(v144, v146);
-    int16x8_t v148 = vsubq_s16(v11, v14);
-    int16x8_t v149 = vqrdmulhq_n_s16(v18, 17734);
-    int16x8_t v150_tmp = vqrdmulhq_n_s16(v17, 10045);
-    int16x8_t v150 = vaddq_s16(v150_tmp, v17);
-    int16x8_t v151 = vsubq_s16(v149, v150);
-    int16x8_t v152 = vaddq_s16(v148, v151);
-    int16x8_t v153 = vqrdmulhq_n_s16(v152, 19705);
-    int16x8_t v154 = vaddq_s16(v147, v153);
-    int16x8_t v155 = vsubq_s16(v27, v30);
-    int16x8_t v156 = vqrdmulhq_n_s16(v34, 17734);
-    int16x8_t v157_tmp = vqrdmulhq_n_s16(v38, 10045);
-    int16x8_t v157 = vaddq_s16(v157_tmp, v38);
-    int16x8_t v158 = vsubq_s16(v156, v157);
-    int16x8_t v159 = vaddq_s16(v155, v158);
-    int16x8_t v160 = vqrdmulhq_n_s16(v54, 13573);
-    int16x8_t v161 = vsubq_s16(v160, v52);
-    int16x8_t v162 = vqrdmulhq_n_s16(v161, 25746);
-    int16x8_t v163 = vsubq_s16(v44, v47);
-    int16x8_t v164 = vqrdmulhq_n_s16(v163, 19705);
-    int16x8_t v165 = vaddq_s16(v162, v164);
-    int16x8_t v166 = vaddq_s16(v159, v165);
-    int16x8_t v167 = vqrdmulhq_n_s16(v166, 17121);
-    int16x8_t v168 = vaddq_s16(v154, v167);
-    int16x8_t v169 = vsubq_s16(v86, v89);
-    int16x8_t v170 = vqrdmulhq_n_s16(v93, 17734);
-    int16x8_t v171_tmp = vqrdmulhq_n_s16(v97, 10045);
-    int16x8_t v171 = vaddq_s16(v171_tmp, v97);
-    int16x8_t v172 = vsubq_s16(v170, v171);
-    int16x8_t v173 = vaddq_s16(v169, v172);
-    int16x8_t v174 = vsubq_s16(v80, v81);
-    int16x8_t v175 = vqrdmulhq_n_s16(v174, 19705);
-    int16x8_t v176 = vqrdmulhq_n_s16(v68, 13573);
-    int16x8_t v177 = vsubq_s16(v176, v76);
-    int16x8_t v178 = vqrdmulhq_n_s16(v177, 25746);
-    int16x8_t v179 = vaddq_s16(v175, v178);
-    int16x8_t v180 = vaddq_s16(v173, v179);
-    int16x8_t v181 = vsubq_s16(v130, v131);
-    int16x8_t v182 = vqrdmulhq_n_s16(v135, 13573);
-    int16x8_t v183 = vsubq_s16(v182, v133);
-    int16x8_t v184_tmp = vqrdmulhq_n_s16(v183, 10045);
-    int16x8_t v184 = vaddq_s16(v184_tmp, v183);
-    int16x8_t v185 = vaddq_s16(v181, v184);
-    int16x8_t v186 = vqrdmulhq_n_s16(v185, 17121);
-    int16x8_t v187 = vqrdmulhq_n_s16(v105, 27867);
-    int16x8_t v188 = vqrdmulhq_n_s16(v113, 19705);
-    int16x8_t v189 = vsubq_s16(v187, v188);
-    int16x8_t v190 = vqrdmulhq_n_s16(v116, 13573);
-    int16x8_t v191 = vsubq_s16(v190, v123);
-    int16x8_t v192 = vqrdmulhq_n_s16(v191, 25746);
-    int16x8_t v193 = vaddq_s16(v189, v192);
-    int16x8_t v194 = vqrdmulhq_n_s16(v193, 17121);
-    int16x8_t v195 = vaddq_s16(v186, v194);
-    int16x8_t v196 = vaddq_s16(v180, v195);
-    int16x8_t v197 = vqrdmulhq_n_s16(v196, 16563);
-    int16x8_t v198 = vaddq_s16(v168, v197);
-    int16x8_t v199 = vsubq_s16(v144, v146);
-    int16x8_t v200 = vsubq_s16(v148, v151);
-    int16x8_t v201 = vqrdmulhq_n_s16(v200, 29490);
-    int16x8_t v202 = vaddq_s16(v199, v201);
-    int16x8_t v203 = vsubq_s16(v155, v158);
-    int16x8_t v204 = vqrdmulhq_n_s16(v163, 29490);
-    int16x8_t v205_tmp = vqrdmulhq_n_s16(v161, 5763);
-    int16x8_t v205 = vaddq_s16(v205_tmp, v161);
-    int16x8_t v206 = vsubq_s16(v204, v205);
-    int16x8_t v207 = vaddq_s16(v203, v206);
-    int16x8_t v208 = vqrdmulhq_n_s16(v207, 18578);
-    int16x8_t v209 = vaddq_s16(v202, v208);
-    int16x8_t v210 = vsubq_s16(v169, v172);
-    int16x8_t v211 = vqrdmulhq_n_s16(v174, 29490);
-    int16x8_t v212_tmp = vqrdmulhq_n_s16(v177, 5763);
-    int16x8_t v212 = vaddq_s16(v212_tmp, v177);
-    int16x8_t v213 = vsubq_s16(v211, v212);
-    int16x8_t v214 = vaddq_s16(v210, v213);
-    int16x8_t v215 = vsubq_s16(v181, v184);
-    int16x8_t v216 = vqrdmulhq_n_s16(v215, 18578);
-    int16x8_t v217 = vqrdmulhq_n_s16(v189, 27803);
-    int16x8_t v218 = vqrdmulhq_n_s16(v191, 21845);
-    int16x8_t v219 = vsubq_s16(v217, v218);
-    int16x8_t v220 = vaddq_s16(v216, v219);
-    int16x8_t v221 = vaddq_s16(v214, v220);
-    int16x8_t v222 = vqrdmulhq_n_s16(v221, 16890);
-    int16x8_t v223 = vaddq_s16(v209, v222);
-    int16x8_t v224 = vsubq_s16(v2, v8);
-    int16x8_t v225 = vsubq_s16(v15, v22);
-    int16x8_t v226_tmp = vqrdmulhq_n_s16(v225, 18446);
-    int16x8_t v226 = vmlaq_n_s16(v226_tmp, v225, 2);
-    int16x8_t v227 = vaddq_s16(v224, v226);
-    int16x8_t v228 = vsubq_s16(v31, v41);
-    int16x8_t v229 = vsubq_s16(v48, v56);
-    int16x8_t v230_tmp = vqrdmulhq_n_s16(v229, 18446);
-    int16x8_t v230 = vmlaq_n_s16(v230_tmp, v229, 2);
-    int16x8_t v231 = vaddq_s16(v228, v230);
-    int16x8_t v232 = vqrdmulhq_n_s16(v231, 21195);
-    int16x8_t v233 = vaddq_s16(v227, v232);
-    int16x8_t v234 = vsubq_s16(v82, v78);
-    int16x8_t v235_tmp = vqrdmulhq_n_s16(v234, 18446);
-    int16x8_t v235 = vmlaq_n_s16(v235_tmp, v234, 2);
-    int16x8_t v236 = vsubq_s16(v90, v100);
-    int16x8_t v237 = vaddq_s16(v235, v236);
-    int16x8_t v238 = vsubq_s16(v132, v137);
-    int16x8_t v239 = vsubq_s16(v114, v126);
-    int16x8_t v240_tmp = vqrdmulhq_n_s16(v239, 18446);
-    int16x8_t v240 = vmlaq_n_s16(v240_tmp, v239, 2);
-    int16x8_t v241 = vaddq_s16(v238, v240);
-    int16x8_t v242 = vqrdmulhq_n_s16(v241, 21195);
-    int16x8_t v243 = vaddq_s16(v237, v242);
-    int16x8_t v244 = vqrdmulhq_n_s16(v243, 17401);
-    int16x8_t v245 = vaddq_s16(v233, v244);
-    int16x8_t v246 = vsubq_s16(v228, v230);
-    int16x8_t v247 = vqrdmulhq_n_s16(v246, 25826);
-    int16x8_t v248 = vsubq_s16(v224, v226);
-    int16x8_t v249 = vaddq_s16(v247, v248);
-    int16x8_t v250 = vsubq_s16(v238, v240);
-    int16x8_t v251 = vqrdmulhq_n_s16(v250, 25826);
-    int16x8_t v252 = vsubq_s16(v236, v235);
-    int16x8_t v253 = vaddq_s16(v251, v252);
-    int16x8_t v254 = vqrdmulhq_n_s16(v253, 18124);
-    int16x8_t v255 = vaddq_s16(v249, v254);
-    int16x8_t v256 = vsubq_s16(v199, v201);
-    int16x8_t v257 = vsubq_s16(v203, v206);
-    int16x8_t v258_tmp = vqrdmulhq_n_s16(v257, 1988);
-    int16x8_t v258 = vaddq_s16(v258_tmp, v257);
-    int16x8_t v259 = vaddq_s16(v256, v258);
-    int16x8_t v260 = vsubq_s16(v210, v213);
-    int16x8_t v261_tmp = vqrdmulhq_n_s16(v219, 25030);
-    int16x8_t v261 = vaddq_s16(v261_tmp, v219);
-    int16x8_t v262 = vsubq_s16(v215, v261);
-    int16x8_t v263_tmp = vqrdmulhq_n_s16(v262, 1988);
-    int16x8_t v263 = vaddq_s16(v263_tmp, v262);
-    int16x8_t v264 = vaddq_s16(v260, v263);
-    int16x8_t v265 = vqrdmulhq_n_s16(v264, 19102);
-    int16x8_t v266 = vaddq_s16(v259, v265);
-    int16x8_t v267 = vsubq_s16(v147, v153);
-    int16x8_t v268 = vsubq_s16(v159, v165);
-    int16x8_t v269_tmp = vqrdmulhq_n_s16(v268, 23673);
-    int16x8_t v269 = vaddq_s16(v269_tmp, v268);
-    int16x8_t v270 = vaddq_s16(v267, v269);
-    int16x8_t v271 = vsubq_s16(v173, v179);
-    int16x8_t v272 = vsubq_s16(v185, v193);
-    int16x8_t v273_tmp = vqrdmulhq_n_s16(v272, 23673);
-    int16x8_t v273 = vaddq_s16(v273_tmp, v272);
-    int16x8_t v274 = vaddq_s16(v271, v273);
-    int16x8_t v275 = vqrdmulhq_n_s16(v274, 20398);
-    int16x8_t v276 = vaddq_s16(v270, v275);
-    int16x8_t v277 = vsubq_s16(v9, v24);
-    int16x8_t v278 = vsubq_s16(v42, v58);
-    int16x8_t v279_tmp = vqrdmulhq_n_s16(v278, 3314);
-    int16x8_t v279 = vmlaq_n_s16(v279_tmp, v278, 5);
-    int16x8_t v280 = vaddq_s16(v277, v279);
-    int16x8_t v281 = vsubq_s16(v138, v128);
-    int16x8_t v282_tmp = vqrdmulhq_n_s16(v281, 3314);
-    int16x8_t v282 = vmlaq_n_s16(v282_tmp, v281, 5);
-    int16x8_t v283 = vsubq_s16(v101, v84);
-    int16x8_t v284 = vaddq_s16(v282, v283);
-    int16x8_t v285 = vqrdmulhq_n_s16(v284, 22112);
-    int16x8_t v286 = vaddq_s16(v280, v285);
-    int16x8_t v287 = vsubq_s16(v277, v279);
-    int16x8_t v288 = vsubq_s16(v283, v282);
-    int16x8_t v289 = vqrdmulhq_n_s16(v288, 24397);
-    int16x8_t v290 = vaddq_s16(v287, v289);
-    int16x8_t v291 = vsubq_s16(v267, v269);
-    int16x8_t v292 = vsubq_s16(v271, v273);
-    int16x8_t v293 = vqrdmulhq_n_s16(v292, 27504);
-    int16x8_t v294 = vaddq_s16(v291, v293);
-    int16x8_t v295 = vsubq_s16(v260, v263);
-    int16x8_t v296 = vqrdmulhq_n_s16(v295, 31869);
-    int16x8_t v297 = vsubq_s16(v256, v258);
-    int16x8_t v298 = vaddq_s16(v296, v297);
-    int16x8_t v299 = vsubq_s16(v248, v247);
-    int16x8_t v300 = vsubq_s16(v252, v251);
-    int16x8_t v301_tmp = vqrdmulhq_n_s16(v300, 5552);
-    int16x8_t v301 = vaddq_s16(v301_tmp, v300);
-    int16x8_t v302 = vaddq_s16(v299, v301);
-    int16x8_t v303 = vsubq_s16(v227, v232);
-    int16x8_t v304 = vsubq_s16(v237, v242);
-    int16x8_t v305_tmp = vqrdmulhq_n_s16(v304, 15865);
-    int16x8_t v305 = vaddq_s16(v305_tmp, v304);
-    int16x8_t v306 = vaddq_s16(v303, v305);
-    int16x8_t v307 = vsubq_s16(v202, v208);
-    int16x8_t v308 = vsubq_s16(v214, v220);
-    int16x8_t v309_tmp = vqrdmulhq_n_s16(v308, 1893);
-    int16x8_t v309 = vmlaq_n_s16(v309_tmp, v308, 2);
-    int16x8_t v310 = vaddq_s16(v307, v309);
-    int16x8_t v311 = vsubq_s16(v154, v167);
-    int16x8_t v312 = vsubq_s16(v180, v195);
-    int16x8_t v313_tmp = vqrdmulhq_n_s16(v312, 13357);
-    int16x8_t v313 = vmlaq_n_s16(v313_tmp, v312, 3);
-    int16x8_t v314 = vaddq_s16(v311, v313);
-    int16x8_t v315 = vsubq_s16(v102, v140);
-    int16x8_t v316_tmp = vqrdmulhq_n_s16(v315, 6226);
-    int16x8_t v316 = vmlaq_n_s16(v316_tmp, v315, 10);
-    int16x8_t v317 = vsubq_s16(v25, v60);
-    int16x8_t v318 = vaddq_s16(v316, v317);
-    int16x8_t v319 = vsubq_s16(v317, v316);
-    int16x8_t v320 = vsubq_s16(v311, v313);
-    int16x8_t v321 = vsubq_s16(v307, v309);
-    int16x8_t v322 = vsubq_s16(v303, v305);
-    int16x8_t v323 = vsubq_s16(v299, v301);
-    int16x8_t v324 = vsubq_s16(v297, v296);
-    int16x8_t v325 = vsubq_s16(v291, v293);
-    int16x8_t v326 = vsubq_s16(v287, v289);
-    int16x8_t v327 = vsubq_s16(v280, v285);
-    int16x8_t v328 = vsubq_s16(v270, v275);
-    int16x8_t v329 = vsubq_s16(v259, v265);
-    int16x8_t v330 = vsubq_s16(v249, v254);
-    int16x8_t v331 = vsubq_s16(v233, v244);
-    int16x8_t v332 = vsubq_s16(v209, v222);
-    int16x8_t v333 = vsubq_s16(v168, v197);
-    int16x8_t v334 = vsubq_s16(v61, v142);
-    vst1q_s16(out + out_stride * 0 + i, v143);
-    vst1q_s16(out + out_stride * 1 + i, v198);
-    vst1q_s16(out + out_stride * 2 + i, v223);
-    vst1q_s16(out + out_stride * 3 + i, v245);
-    vst1q_s16(out + out_stride * 4 + i, v255);
-    vst1q_s16(out + out_stride * 5 + i, v266);
-    vst1q_s16(out + out_stride * 6 + i, v276);
-    vst1q_s16(out + out_stride * 7 + i, v286);
-    vst1q_s16(out + out_stride * 8 + i, v290);
-    vst1q_s16(out + out_stride * 9 + i, v294);
-    vst1q_s16(out + out_stride * 10 + i, v298);
-    vst1q_s16(out + out_stride * 11 + i, v302);
-    vst1q_s16(out + out_stride * 12 + i, v306);
-    vst1q_s16(out + out_stride * 13 + i, v310);
-    vst1q_s16(out + out_stride * 14 + i, v314);
-    vst1q_s16(out + out_stride * 15 + i, v318);
-    vst1q_s16(out + out_stride * 16 + i, v319);
-    vst1q_s16(out + out_stride * 17 + i, v320);
-    vst1q_s16(out + out_stride * 18 + i, v321);
-    vst1q_s16(out + out_stride * 19 + i, v322);
-    vst1q_s16(out + out_stride * 20 + i, v323);
-    vst1q_s16(out + out_stride * 21 + i, v324);
-    vst1q_s16(out + out_stride * 22 + i, v325);
-    vst1q_s16(out + out_stride * 23 + i, v326);
-    vst1q_s16(out + out_stride * 24 + i, v327);
-    vst1q_s16(out + out_stride * 25 + i, v328);
-    vst1q_s16(out + out_stride * 26 + i, v329);
-    vst1q_s16(out + out_stride * 27 + i, v330);
-    vst1q_s16(out + out_stride * 28 + i, v331);
-    vst1q_s16(out + out_stride * 29 + i, v332);
-    vst1q_s16(out + out_stride * 30 + i, v333);
-    vst1q_s16(out + out_stride * 31 + i, v334);
+  const HWY_CAPPED(int16_t, 8) d16;
+  for (size_t i = 0; i < count; i += Lanes(d16)) {
+    auto v0 = LoadU(d16, in + in_stride * 0 + i);
+    auto v1 = LoadU(d16, in + in_stride * 16 + i);
+    auto v2 = Add(v0, v1);
+    auto v3 = LoadU(d16, in + in_stride * 8 + i);
+    auto v4_tmp = MulFixedPoint15(v3, Set(d16, 13573));
+    auto v4 = Add(v4_tmp, v3);
+    auto v5 = LoadU(d16, in + in_stride * 24 + i);
+    auto v6 = Add(v5, v3);
+    auto v7 = Add(v4, v6);
+    auto v8 = MulFixedPoint15(v7, Set(d16, 17734));
+    auto v9 = Add(v2, v8);
+    auto v10 = LoadU(d16, in + in_stride * 4 + i);
+    auto v11_tmp = MulFixedPoint15(v10, Set(d16, 13573));
+    auto v11 = Add(v11_tmp, v10);
+    auto v12 = LoadU(d16, in + in_stride * 20 + i);
+    auto v13 = LoadU(d16, in + in_stride * 12 + i);
+    auto v14 = Add(v12, v13);
+    auto v15 = Add(v11, v14);
+    auto v16 = LoadU(d16, in + in_stride * 28 + i);
+    auto v17 = Add(v16, v12);
+    auto v18 = Add(v13, v10);
+    auto v19 = Add(v17, v18);
+    auto v20 = MulFixedPoint15(v19, Set(d16, 17734));
+    auto v21 = MulFixedPoint15(v18, Set(d16, 25080));
+    auto v22 = Add(v20, v21);
+    auto v23 = Add(v15, v22);
+    auto v24 = MulFixedPoint15(v23, Set(d16, 16705));
+    auto v25 = Add(v9, v24);
+    auto v26 = LoadU(d16, in + in_stride * 2 + i);
+    auto v27_tmp = MulFixedPoint15(v26, Set(d16, 13573));
+    auto v27 = Add(v27_tmp, v26);
+    auto v28 = LoadU(d16, in + in_stride * 18 + i);
+    auto v29 = LoadU(d16, in + in_stride * 14 + i);
+    auto v30 = Add(v28, v29);
+    auto v31 = Add(v27, v30);
+    auto v32 = LoadU(d16, in + in_stride * 10 + i);
+    auto v33 = LoadU(d16, in + in_stride * 6 + i);
+    auto v34 = Add(v32, v33);
+    auto v35 = MulFixedPoint15(v34, Set(d16, 25080));
+    auto v36 = LoadU(d16, in + in_stride * 26 + i);
+    auto v37 = LoadU(d16, in + in_stride * 22 + i);
+    auto v38 = Add(v36, v37);
+    auto v39 = Add(v38, v34);
+    auto v40 = MulFixedPoint15(v39, Set(d16, 17734));
+    auto v41 = Add(v35, v40);
+    auto v42 = Add(v31, v41);
+    auto v43 = Add(v33, v26);
+    auto v44_tmp = MulFixedPoint15(v43, Set(d16, 13573));
+    auto v44 = Add(v44_tmp, v43);
+    auto v45 = Add(v29, v32);
+    auto v46 = Add(v37, v28);
+    auto v47 = Add(v45, v46);
+    auto v48 = Add(v44, v47);
+    auto v49 = MulFixedPoint15(v48, Set(d16, 16705));
+    auto v50 = LoadU(d16, in + in_stride * 30 + i);
+    auto v51 = Add(v50, v36);
+    auto v52 = Add(v51, v46);
+    auto v53 = MulFixedPoint15(v52, Set(d16, 17734));
+    auto v54 = Add(v45, v43);
+    auto v55_tmp = MulFixedPoint15(v54, Set(d16, 10045));
+    auto v55 = Add(v55_tmp, v54);
+    auto v56 = Add(v53, v55);
+    auto v57 = MulFixedPoint15(v56, Set(d16, 16705));
+    auto v58 = Add(v49, v57);
+    auto v59 = Add(v42, v58);
+    auto v60 = MulFixedPoint15(v59, Set(d16, 16463));
+    auto v61 = Add(v25, v60);
+    auto v62 = LoadU(d16, in + in_stride * 13 + i);
+    auto v63 = LoadU(d16, in + in_stride * 11 + i);
+    auto v64 = Add(v62, v63);
+    auto v65 = LoadU(d16, in + in_stride * 5 + i);
+    auto v66 = LoadU(d16, in + in_stride * 3 + i);
+    auto v67 = Add(v65, v66);
+    auto v68 = Add(v64, v67);
+    auto v69_tmp = MulFixedPoint15(v68, Set(d16, 10045));
+    auto v69 = Add(v69_tmp, v68);
+    auto v70 = LoadU(d16, in + in_stride * 21 + i);
+    auto v71 = LoadU(d16, in + in_stride * 19 + i);
+    auto v72 = Add(v70, v71);
+    auto v73 = LoadU(d16, in + in_stride * 29 + i);
+    auto v74 = LoadU(d16, in + in_stride * 27 + i);
+    auto v75 = Add(v73, v74);
+    auto v76 = Add(v72, v75);
+    auto v77 = MulFixedPoint15(v76, Set(d16, 17734));
+    auto v78 = Add(v69, v77);
+    auto v79 = MulFixedPoint15(v78, Set(d16, 16705));
+    auto v80_tmp = MulFixedPoint15(v67, Set(d16, 13573));
+    auto v80 = Add(v80_tmp, v67);
+    auto v81 = Add(v64, v72);
+    auto v82 = Add(v80, v81);
+    auto v83 = MulFixedPoint15(v82, Set(d16, 16705));
+    auto v84 = Add(v79, v83);
+    auto v85 = LoadU(d16, in + in_stride * 1 + i);
+    auto v86_tmp = MulFixedPoint15(v85, Set(d16, 13573));
+    auto v86 = Add(v86_tmp, v85);
+    auto v87 = LoadU(d16, in + in_stride * 17 + i);
+    auto v88 = LoadU(d16, in + in_stride * 15 + i);
+    auto v89 = Add(v87, v88);
+    auto v90 = Add(v86, v89);
+    auto v91 = LoadU(d16, in + in_stride * 9 + i);
+    auto v92 = LoadU(d16, in + in_stride * 7 + i);
+    auto v93 = Add(v91, v92);
+    auto v94 = MulFixedPoint15(v93, Set(d16, 25080));
+    auto v95 = LoadU(d16, in + in_stride * 25 + i);
+    auto v96 = LoadU(d16, in + in_stride * 23 + i);
+    auto v97 = Add(v95, v96);
+    auto v98 = Add(v97, v93);
+    auto v99 = MulFixedPoint15(v98, Set(d16, 17734));
+    auto v100 = Add(v94, v99);
+    auto v101 = Add(v90, v100);
+    auto v102 = Add(v84, v101);
+    auto v103 = Add(v92, v65);
+    auto v104 = Add(v66, v85);
+    auto v105 = Add(v103, v104);
+    auto v106_tmp = MulFixedPoint15(v105, Set(d16, 13573));
+    auto v106 = Add(v106_tmp, v105);
+    auto v107 = Add(v96, v70);
+    auto v108 = Add(v71, v87);
+    auto v109 = Add(v107, v108);
+    auto v110 = Add(v63, v91);
+    auto v111 = Add(v88, v62);
+    auto v112 = Add(v110, v111);
+    auto v113 = Add(v109, v112);
+    auto v114 = Add(v106, v113);
+    auto v115 = MulFixedPoint15(v114, Set(d16, 16705));
+    auto v116 = Add(v112, v105);
+    auto v117 = MulFixedPoint15(v116, Set(d16, 25080));
+    auto v118 = MulFixedPoint15(v116, Set(d16, 17734));
+    auto v119 = Add(v74, v95);
+    auto v120 = LoadU(d16, in + in_stride * 31 + i);
+    auto v121 = Add(v120, v73);
+    auto v122 = Add(v119, v121);
+    auto v123 = Add(v122, v109);
+    auto v124 = MulFixedPoint15(v123, Set(d16, 17734));
+    auto v125 = Add(v118, v124);
+    auto v126 = Add(v117, v125);
+    auto v127 = MulFixedPoint15(v126, Set(d16, 16705));
+    auto v128 = Add(v115, v127);
+    auto v129 = MulFixedPoint15(v128, Set(d16, 16463));
+    auto v130_tmp = MulFixedPoint15(v104, Set(d16, 13573));
+    auto v130 = Add(v130_tmp, v104);
+    auto v131 = Add(v108, v111);
+    auto v132 = Add(v130, v131);
+    auto v133 = Add(v119, v107);
+    auto v134 = MulFixedPoint15(v133, Set(d16, 17734));
+    auto v135 = Add(v110, v103);
+    auto v136_tmp = MulFixedPoint15(v135, Set(d16, 10045));
+    auto v136 = Add(v136_tmp, v135);
+    auto v137 = Add(v134, v136);
+    auto v138 = Add(v132, v137);
+    auto v139 = MulFixedPoint15(v138, Set(d16, 16463));
+    auto v140 = Add(v129, v139);
+    auto v141 = Add(v102, v140);
+    auto v142 = MulFixedPoint15(v141, Set(d16, 16404));
+    auto v143 = Add(v61, v142);
+    auto v144 = Sub(v0, v1);
+    auto v145 = Sub(v4, v6);
+    auto v146_tmp = MulFixedPoint15(v145, Set(d16, 10045));
+    auto v146 = Add(v146_tmp, v145);
+    auto v147 = Add(v144, v146);
+    auto v148 = Sub(v11, v14);
+    auto v149 = MulFixedPoint15(v18, Set(d16, 17734));
+    auto v150_tmp = MulFixedPoint15(v17, Set(d16, 10045));
+    auto v150 = Add(v150_tmp, v17);
+    auto v151 = Sub(v149, v150);
+    auto v152 = Add(v148, v151);
+    auto v153 = MulFixedPoint15(v152, Set(d16, 19705));
+    auto v154 = Add(v147, v153);
+    auto v155 = Sub(v27, v30);
+    auto v156 = MulFixedPoint15(v34, Set(d16, 17734));
+    auto v157_tmp = MulFixedPoint15(v38, Set(d16, 10045));
+    auto v157 = Add(v157_tmp, v38);
+    auto v158 = Sub(v156, v157);
+    auto v159 = Add(v155, v158);
+    auto v160 = MulFixedPoint15(v54, Set(d16, 13573));
+    auto v161 = Sub(v160, v52);
+    auto v162 = MulFixedPoint15(v161, Set(d16, 25746));
+    auto v163 = Sub(v44, v47);
+    auto v164 = MulFixedPoint15(v163, Set(d16, 19705));
+    auto v165 = Add(v162, v164);
+    auto v166 = Add(v159, v165);
+    auto v167 = MulFixedPoint15(v166, Set(d16, 17121));
+    auto v168 = Add(v154, v167);
+    auto v169 = Sub(v86, v89);
+    auto v170 = MulFixedPoint15(v93, Set(d16, 17734));
+    auto v171_tmp = MulFixedPoint15(v97, Set(d16, 10045));
+    auto v171 = Add(v171_tmp, v97);
+    auto v172 = Sub(v170, v171);
+    auto v173 = Add(v169, v172);
+    auto v174 = Sub(v80, v81);
+    auto v175 = MulFixedPoint15(v174, Set(d16, 19705));
+    auto v176 = MulFixedPoint15(v68, Set(d16, 13573));
+    auto v177 = Sub(v176, v76);
+    auto v178 = MulFixedPoint15(v177, Set(d16, 25746));
+    auto v179 = Add(v175, v178);
+    auto v180 = Add(v173, v179);
+    auto v181 = Sub(v130, v131);
+    auto v182 = MulFixedPoint15(v135, Set(d16, 13573));
+    auto v183 = Sub(v182, v133);
+    auto v184_tmp = MulFixedPoint15(v183, Set(d16, 10045));
+    auto v184 = Add(v184_tmp, v183);
+    auto v185 = Add(v181, v184);
+    auto v186 = MulFixedPoint15(v185, Set(d16, 17121));
+    auto v187 = MulFixedPoint15(v105, Set(d16, 27867));
+    auto v188 = MulFixedPoint15(v113, Set(d16, 19705));
+    auto v189 = Sub(v187, v188);
+    auto v190 = MulFixedPoint15(v116, Set(d16, 13573));
+    auto v191 = Sub(v190, v123);
+    auto v192 = MulFixedPoint15(v191, Set(d16, 25746));
+    auto v193 = Add(v189, v192);
+    auto v194 = MulFixedPoint15(v193, Set(d16, 17121));
+    auto v195 = Add(v186, v194);
+    auto v196 = Add(v180, v195);
+    auto v197 = MulFixedPoint15(v196, Set(d16, 16563));
+    auto v198 = Add(v168, v197);
+    auto v199 = Sub(v144, v146);
+    auto v200 = Sub(v148, v151);
+    auto v201 = MulFixedPoint15(v200, Set(d16, 29490));
+    auto v202 = Add(v199, v201);
+    auto v203 = Sub(v155, v158);
+    auto v204 = MulFixedPoint15(v163, Set(d16, 29490));
+    auto v205_tmp = MulFixedPoint15(v161, Set(d16, 5763));
+    auto v205 = Add(v205_tmp, v161);
+    auto v206 = Sub(v204, v205);
+    auto v207 = Add(v203, v206);
+    auto v208 = MulFixedPoint15(v207, Set(d16, 18578));
+    auto v209 = Add(v202, v208);
+    auto v210 = Sub(v169, v172);
+    auto v211 = MulFixedPoint15(v174, Set(d16, 29490));
+    auto v212_tmp = MulFixedPoint15(v177, Set(d16, 5763));
+    auto v212 = Add(v212_tmp, v177);
+    auto v213 = Sub(v211, v212);
+    auto v214 = Add(v210, v213);
+    auto v215 = Sub(v181, v184);
+    auto v216 = MulFixedPoint15(v215, Set(d16, 18578));
+    auto v217 = MulFixedPoint15(v189, Set(d16, 27803));
+    auto v218 = MulFixedPoint15(v191, Set(d16, 21845));
+    auto v219 = Sub(v217, v218);
+    auto v220 = Add(v216, v219);
+    auto v221 = Add(v214, v220);
+    auto v222 = MulFixedPoint15(v221, Set(d16, 16890));
+    auto v223 = Add(v209, v222);
+    auto v224 = Sub(v2, v8);
+    auto v225 = Sub(v15, v22);
+    auto v226_tmp = MulFixedPoint15(v225, Set(d16, 18446));
+    auto v226 = Add(v226_tmp, Mul(v225, Set(d16, 2)));
+    auto v227 = Add(v224, v226);
+    auto v228 = Sub(v31, v41);
+    auto v229 = Sub(v48, v56);
+    auto v230_tmp = MulFixedPoint15(v229, Set(d16, 18446));
+    auto v230 = Add(v230_tmp, Mul(v229, Set(d16, 2)));
+    auto v231 = Add(v228, v230);
+    auto v232 = MulFixedPoint15(v231, Set(d16, 21195));
+    auto v233 = Add(v227, v232);
+    auto v234 = Sub(v82, v78);
+    auto v235_tmp = MulFixedPoint15(v234, Set(d16, 18446));
+    auto v235 = Add(v235_tmp, Mul(v234, Set(d16, 2)));
+    auto v236 = Sub(v90, v100);
+    auto v237 = Add(v235, v236);
+    auto v238 = Sub(v132, v137);
+    auto v239 = Sub(v114, v126);
+    auto v240_tmp = MulFixedPoint15(v239, Set(d16, 18446));
+    auto v240 = Add(v240_tmp, Mul(v239, Set(d16, 2)));
+    auto v241 = Add(v238, v240);
+    auto v242 = MulFixedPoint15(v241, Set(d16, 21195));
+    auto v243 = Add(v237, v242);
+    auto v244 = MulFixedPoint15(v243, Set(d16, 17401));
+    auto v245 = Add(v233, v244);
+    auto v246 = Sub(v228, v230);
+    auto v247 = MulFixedPoint15(v246, Set(d16, 25826));
+    auto v248 = Sub(v224, v226);
+    auto v249 = Add(v247, v248);
+    auto v250 = Sub(v238, v240);
+    auto v251 = MulFixedPoint15(v250, Set(d16, 25826));
+    auto v252 = Sub(v236, v235);
+    auto v253 = Add(v251, v252);
+    auto v254 = MulFixedPoint15(v253, Set(d16, 18124));
+    auto v255 = Add(v249, v254);
+    auto v256 = Sub(v199, v201);
+    auto v257 = Sub(v203, v206);
+    auto v258_tmp = MulFixedPoint15(v257, Set(d16, 1988));
+    auto v258 = Add(v258_tmp, v257);
+    auto v259 = Add(v256, v258);
+    auto v260 = Sub(v210, v213);
+    auto v261_tmp = MulFixedPoint15(v219, Set(d16, 25030));
+    auto v261 = Add(v261_tmp, v219);
+    auto v262 = Sub(v215, v261);
+    auto v263_tmp = MulFixedPoint15(v262, Set(d16, 1988));
+    auto v263 = Add(v263_tmp, v262);
+    auto v264 = Add(v260, v263);
+    auto v265 = MulFixedPoint15(v264, Set(d16, 19102));
+    auto v266 = Add(v259, v265);
+    auto v267 = Sub(v147, v153);
+    auto v268 = Sub(v159, v165);
+    auto v269_tmp = MulFixedPoint15(v268, Set(d16, 23673));
+    auto v269 = Add(v269_tmp, v268);
+    auto v270 = Add(v267, v269);
+    auto v271 = Sub(v173, v179);
+    auto v272 = Sub(v185, v193);
+    auto v273_tmp = MulFixedPoint15(v272, Set(d16, 23673));
+    auto v273 = Add(v273_tmp, v272);
+    auto v274 = Add(v271, v273);
+    auto v275 = MulFixedPoint15(v274, Set(d16, 20398));
+    auto v276 = Add(v270, v275);
+    auto v277 = Sub(v9, v24);
+    auto v278 = Sub(v42, v58);
+    auto v279_tmp = MulFixedPoint15(v278, Set(d16, 3314));
+    auto v279 = Add(v279_tmp, Mul(v278, Set(d16, 5)));
+    auto v280 = Add(v277, v279);
+    auto v281 = Sub(v138, v128);
+    auto v282_tmp = MulFixedPoint15(v281, Set(d16, 3314));
+    auto v282 = Add(v282_tmp, Mul(v281, Set(d16, 5)));
+    auto v283 = Sub(v101, v84);
+    auto v284 = Add(v282, v283);
+    auto v285 = MulFixedPoint15(v284, Set(d16, 22112));
+    auto v286 = Add(v280, v285);
+    auto v287 = Sub(v277, v279);
+    auto v288 = Sub(v283, v282);
+    auto v289 = MulFixedPoint15(v288, Set(d16, 24397));
+    auto v290 = Add(v287, v289);
+    auto v291 = Sub(v267, v269);
+    auto v292 = Sub(v271, v273);
+    auto v293 = MulFixedPoint15(v292, Set(d16, 27504));
+    auto v294 = Add(v291, v293);
+    auto v295 = Sub(v260, v263);
+    auto v296 = MulFixedPoint15(v295, Set(d16, 31869));
+    auto v297 = Sub(v256, v258);
+    auto v298 = Add(v296, v297);
+    auto v299 = Sub(v248, v247);
+    auto v300 = Sub(v252, v251);
+    auto v301_tmp = MulFixedPoint15(v300, Set(d16, 5552));
+    auto v301 = Add(v301_tmp, v300);
+    auto v302 = Add(v299, v301);
+    auto v303 = Sub(v227, v232);
+    auto v304 = Sub(v237, v242);
+    auto v305_tmp = MulFixedPoint15(v304, Set(d16, 15865));
+    auto v305 = Add(v305_tmp, v304);
+    auto v306 = Add(v303, v305);
+    auto v307 = Sub(v202, v208);
+    auto v308 = Sub(v214, v220);
+    auto v309_tmp = MulFixedPoint15(v308, Set(d16, 1893));
+    auto v309 = Add(v309_tmp, Mul(v308, Set(d16, 2)));
+    auto v310 = Add(v307, v309);
+    auto v311 = Sub(v154, v167);
+    auto v312 = Sub(v180, v195);
+    auto v313_tmp = MulFixedPoint15(v312, Set(d16, 13357));
+    auto v313 = Add(v313_tmp, Mul(v312, Set(d16, 3)));
+    auto v314 = Add(v311, v313);
+    auto v315 = Sub(v102, v140);
+    auto v316_tmp = MulFixedPoint15(v315, Set(d16, 6226));
+    auto v316 = Add(v316_tmp, Mul(v315, Set(d16, 10)));
+    auto v317 = Sub(v25, v60);
+    auto v318 = Add(v316, v317);
+    auto v319 = Sub(v317, v316);
+    auto v320 = Sub(v311, v313);
+    auto v321 = Sub(v307, v309);
+    auto v322 = Sub(v303, v305);
+    auto v323 = Sub(v299, v301);
+    auto v324 = Sub(v297, v296);
+    auto v325 = Sub(v291, v293);
+    auto v326 = Sub(v287, v289);
+    auto v327 = Sub(v280, v285);
+    auto v328 = Sub(v270, v275);
+    auto v329 = Sub(v259, v265);
+    auto v330 = Sub(v249, v254);
+    auto v331 = Sub(v233, v244);
+    auto v332 = Sub(v209, v222);
+    auto v333 = Sub(v168, v197);
+    auto v334 = Sub(v61, v142);
+    StoreU(v143, d16, out + out_stride * 0 + i);
+    StoreU(v198, d16, out + out_stride * 1 + i);
+    StoreU(v223, d16, out + out_stride * 2 + i);
+    StoreU(v245, d16, out + out_stride * 3 + i);
+    StoreU(v255, d16, out + out_stride * 4 + i);
+    StoreU(v266, d16, out + out_stride * 5 + i);
+    StoreU(v276, d16, out + out_stride * 6 + i);
+    StoreU(v286, d16, out + out_stride * 7 + i);
+    StoreU(v290, d16, out + out_stride * 8 + i);
+    StoreU(v294, d16, out + out_stride * 9 + i);
+    StoreU(v298, d16, out + out_stride * 10 + i);
+    StoreU(v302, d16, out + out_stride * 11 + i);
+    StoreU(v306, d16, out + out_stride * 12 + i);
+    StoreU(v310, d16, out + out_stride * 13 + i);
+    StoreU(v314, d16, out + out_stride * 14 + i);
+    StoreU(v318, d16, out + out_stride * 15 + i);
+    StoreU(v319, d16, out + out_stride * 16 + i);
+    StoreU(v320, d16, out + out_stride * 17 + i);
+    StoreU(v321, d16, out + out_stride * 18 + i);
+    StoreU(v322, d16, out + out_stride * 19 + i);
+    StoreU(v323, d16, out + out_stride * 20 + i);
+    StoreU(v324, d16, out + out_stride * 21 + i);
+    StoreU(v325, d16, out + out_stride * 22 + i);
+    StoreU(v326, d16, out + out_stride * 23 + i);
+    StoreU(v327, d16, out + out_stride * 24 + i);
+    StoreU(v328, d16, out + out_stride * 25 + i);
+    StoreU(v329, d16, out + out_stride * 26 + i);
+    StoreU(v330, d16, out + out_stride * 27 + i);
+    StoreU(v331, d16, out + out_stride * 28 + i);
+    StoreU(v332, d16, out + out_stride * 29 + i);
+    StoreU(v333, d16, out + out_stride * 30 + i);
+    StoreU(v334, d16, out + out_stride * 31 + i);
   }
 }
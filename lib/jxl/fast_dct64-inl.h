@@ -3,983 +3,983 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
-/* This file is automatically generated. Do not modify it directly. */
-#if HWY_TARGET != HWY_NEON
-#error "only include this file from fast_dct-inl.h"
-#endif
+// Fixed-point IDCT of size 64, only meant to be included by
+// fast_dct_testonly-inl.h.
 
 constexpr size_t FastIDCTIntegerBits(FastDCTTag<64>) { return 1; }
 
-void FastIDCT(FastDCTTag<64>, const int16_t* in, size_t in_stride, int16_t* out,
-              size_t out_stride, size_t count) {
+HWY_MAYBE_UNUSED void FastIDCT(FastDCTTag<64>, const int16_t* in,
+                               size_t in_stride, int16_t* out,
+                               size_t out_stride, size_t count) {
   JXL_ASSERT(count % 8 == 0);
-  for (size_t i = 0; i < count; i += 8) {
-    int16x8_t v0 = vld1q_s16(in + in_stride * 0 + i);
-    int16x8_t v1 = vld1q_s16(in + in_stride * 32 + i);
-    int16x8_t v2 = vaddq_s16(v0, v1);
-    int16x8_t v3 = vld1q_s16(in + in_stride * 16 + i);
-    int16x8_t v4_tmp = vqrdmulhq_n_s16(v3, 13573);
-    int16x8_t v4 = vaddq_s16(v4_tmp, v3);
-    int16x8_t v5 = vld1q_s16(in + in_stride * 48 + i);
-    int16x8_t v6 = vaddq_s16(v5, v3);
-    int16x8_t v7 = vaddq_s16(v4, v6);
-    int16x8_t v8 = vqrdmulhq_n_s16(v7, 17734);
-    int16x8_t v9 = vaddq_s16(v2, v8);
-    int16x8_t v10 = vld1q_s16(in + in_stride * 8 + i);
-    int16x8_t v11_tmp = vqrdmulhq_n_s16(v10, 13573);
-    int16x8_t v11 = vaddq_s16(v11_tmp, v10);
-    int16x8_t v12 = vld1q_s16(in + in_stride * 40 + i);
-    int16x8_t v13 = vld1q_s16(in + in_stride * 24 + i);
-    int16x8_t v14 = vaddq_s16(v12, v13);
-    int16x8_t v15 = vaddq_s16(v11, v14);
-    int16x8_t v16 = vld1q_s16(in + in_stride * 56 + i);
-    int16x8_t v17 = vaddq_s16(v16, v12);
-    int16x8_t v18 = vaddq_s16(v13, v10);
-    int16x8_t v19 = vaddq_s16(v17, v18);
-    int16x8_t v20 = vqrdmulhq_n_s16(v19, 17734);
-    int16x8_t v21 = vqrdmulhq_n_s16(v18, 25080);
-    int16x8_t v22 = vaddq_s16(v20, v21);
-    int16x8_t v23 = vaddq_s16(v15, v22);
-    int16x8_t v24 = vqrdmulhq_n_s16(v23, 16705);
-    int16x8_t v25 = vaddq_s16(v9, v24);
-    int16x8_t v26 = vld1q_s16(in + in_stride * 4 + i);
-    int16x8_t v27_tmp = vqrdmulhq_n_s16(v26, 13573);
-    int16x8_t v27 = vaddq_s16(v27_tmp, v26);
-    int16x8_t v28 = vld1q_s16(in + in_stride * 36 + i);
-    int16x8_t v29 = vld1q_s16(in + in_stride * 28 + i);
-    int16x8_t v30 = vaddq_s16(v28, v29);
-    int16x8_t v31 = vaddq_s16(v27, v30);
-    int16x8_t v32 = vld1q_s16(in + in_stride * 20 + i);
-    int16x8_t v33 = vld1q_s16(in + in_stride * 12 + i);
-    int16x8_t v34 = vaddq_s16(v32, v33);
-    int16x8_t v35 = vqrdmulhq_n_s16(v34, 25080);
-    int16x8_t v36 = vld1q_s16(in + in_stride * 52 + i);
-    int16x8_t v37 = vld1q_s16(in + in_stride * 44 + i);
-    int16x8_t v38 = vaddq_s16(v36, v37);
-    int16x8_t v39 = vaddq_s16(v38, v34);
-    int16x8_t v40 = vqrdmulhq_n_s16(v39, 17734);
-    int16x8_t v41 = vaddq_s16(v35, v40);
-    int16x8_t v42 = vaddq_s16(v31, v41);
-    int16x8_t v43 = vaddq_s16(v33, v26);
-    int16x8_t v44_tmp = vqrdmulhq_n_s16(v43, 13573);
-    int16x8_t v44 = vaddq_s16(v44_tmp, v43);
-    int16x8_t v45 = vaddq_s16(v37, v28);
-    int16x8_t v46 = vaddq_s16(v29, v32);
-    int16x8_t v47 = vaddq_s16(v45, v46);
-    int16x8_t v48 = vaddq_s16(v44, v47);
-    int16x8_t v49 = vqrdmulhq_n_s16(v48, 16705);
-    int16x8_t v50 = vaddq_s16(v46, v43);
-    int16x8_t v51_tmp = vqrdmulhq_n_s16(v50, 10045);
-    int16x8_t v51 = vaddq_s16(v51_tmp, v50);
-    int16x8_t v52 = vld1q_s16(in + in_stride * 60 + i);
-    int16x8_t v53 = vaddq_s16(v52, v36);
-    int16x8_t v54 = vaddq_s16(v53, v45);
-    int16x8_t v55 = vqrdmulhq_n_s16(v54, 17734);
-    int16x8_t v56 = vaddq_s16(v51, v55);
-    int16x8_t v57 = vqrdmulhq_n_s16(v56, 16705);
-    int16x8_t v58 = vaddq_s16(v49, v57);
-    int16x8_t v59 = vaddq_s16(v42, v58);
-    int16x8_t v60 = vqrdmulhq_n_s16(v59, 16463);
-    int16x8_t v61 = vaddq_s16(v25, v60);
-    int16x8_t v62 = vld1q_s16(in + in_stride * 2 + i);
-    int16x8_t v63_tmp = vqrdmulhq_n_s16(v62, 13573);
-    int16x8_t v63 = vaddq_s16(v63_tmp, v62);
-    int16x8_t v64 = vld1q_s16(in + in_stride * 34 + i);
-    int16x8_t v65 = vld1q_s16(in + in_stride * 30 + i);
-    int16x8_t v66 = vaddq_s16(v64, v65);
-    int16x8_t v67 = vaddq_s16(v63, v66);
-    int16x8_t v68 = vld1q_s16(in + in_stride * 18 + i);
-    int16x8_t v69 = vld1q_s16(in + in_stride * 14 + i);
-    int16x8_t v70 = vaddq_s16(v68, v69);
-    int16x8_t v71 = vqrdmulhq_n_s16(v70, 25080);
-    int16x8_t v72 = vld1q_s16(in + in_stride * 50 + i);
-    int16x8_t v73 = vld1q_s16(in + in_stride * 46 + i);
-    int16x8_t v74 = vaddq_s16(v72, v73);
-    int16x8_t v75 = vaddq_s16(v74, v70);
-    int16x8_t v76 = vqrdmulhq_n_s16(v75, 17734);
-    int16x8_t v77 = vaddq_s16(v71, v76);
-    int16x8_t v78 = vaddq_s16(v67, v77);
-    int16x8_t v79 = vld1q_s16(in + in_stride * 10 + i);
-    int16x8_t v80 = vld1q_s16(in + in_stride * 6 + i);
-    int16x8_t v81 = vaddq_s16(v79, v80);
-    int16x8_t v82_tmp = vqrdmulhq_n_s16(v81, 13573);
-    int16x8_t v82 = vaddq_s16(v82_tmp, v81);
-    int16x8_t v83 = vld1q_s16(in + in_stride * 42 + i);
-    int16x8_t v84 = vld1q_s16(in + in_stride * 38 + i);
-    int16x8_t v85 = vaddq_s16(v83, v84);
-    int16x8_t v86 = vld1q_s16(in + in_stride * 26 + i);
-    int16x8_t v87 = vld1q_s16(in + in_stride * 22 + i);
-    int16x8_t v88 = vaddq_s16(v86, v87);
-    int16x8_t v89 = vaddq_s16(v85, v88);
-    int16x8_t v90 = vaddq_s16(v82, v89);
-    int16x8_t v91 = vqrdmulhq_n_s16(v90, 16705);
-    int16x8_t v92 = vaddq_s16(v88, v81);
-    int16x8_t v93_tmp = vqrdmulhq_n_s16(v92, 10045);
-    int16x8_t v93 = vaddq_s16(v93_tmp, v92);
-    int16x8_t v94 = vld1q_s16(in + in_stride * 58 + i);
-    int16x8_t v95 = vld1q_s16(in + in_stride * 54 + i);
-    int16x8_t v96 = vaddq_s16(v94, v95);
-    int16x8_t v97 = vaddq_s16(v96, v85);
-    int16x8_t v98 = vqrdmulhq_n_s16(v97, 17734);
-    int16x8_t v99 = vaddq_s16(v93, v98);
-    int16x8_t v100 = vqrdmulhq_n_s16(v99, 16705);
-    int16x8_t v101 = vaddq_s16(v91, v100);
-    int16x8_t v102 = vaddq_s16(v78, v101);
-    int16x8_t v103 = vaddq_s16(v69, v79);
-    int16x8_t v104 = vaddq_s16(v80, v62);
-    int16x8_t v105 = vaddq_s16(v103, v104);
-    int16x8_t v106_tmp = vqrdmulhq_n_s16(v105, 13573);
-    int16x8_t v106 = vaddq_s16(v106_tmp, v105);
-    int16x8_t v107 = vaddq_s16(v73, v83);
-    int16x8_t v108 = vaddq_s16(v84, v64);
-    int16x8_t v109 = vaddq_s16(v107, v108);
-    int16x8_t v110 = vaddq_s16(v65, v86);
-    int16x8_t v111 = vaddq_s16(v87, v68);
-    int16x8_t v112 = vaddq_s16(v110, v111);
-    int16x8_t v113 = vaddq_s16(v109, v112);
-    int16x8_t v114 = vaddq_s16(v106, v113);
-    int16x8_t v115 = vqrdmulhq_n_s16(v114, 16705);
-    int16x8_t v116 = vaddq_s16(v112, v105);
-    int16x8_t v117 = vqrdmulhq_n_s16(v116, 25080);
-    int16x8_t v118 = vqrdmulhq_n_s16(v116, 17734);
-    int16x8_t v119 = vld1q_s16(in + in_stride * 62 + i);
-    int16x8_t v120 = vaddq_s16(v119, v94);
-    int16x8_t v121 = vaddq_s16(v95, v72);
-    int16x8_t v122 = vaddq_s16(v120, v121);
-    int16x8_t v123 = vaddq_s16(v122, v109);
-    int16x8_t v124 = vqrdmulhq_n_s16(v123, 17734);
-    int16x8_t v125 = vaddq_s16(v118, v124);
-    int16x8_t v126 = vaddq_s16(v117, v125);
-    int16x8_t v127 = vqrdmulhq_n_s16(v126, 16705);
-    int16x8_t v128 = vaddq_s16(v115, v127);
-    int16x8_t v129 = vqrdmulhq_n_s16(v128, 16463);
-    int16x8_t v130_tmp = vqrdmulhq_n_s16(v104, 13573);
-    int16x8_t v130 = vaddq_s16(v130_tmp, v104);
-    int16x8_t v131 = vaddq_s16(v108, v110);
-    int16x8_t v132 = vaddq_s16(v130, v131);
-    int16x8_t v133 = vaddq_s16(v111, v103);
-    int16x8_t v134_tmp = vqrdmulhq_n_s16(v133, 10045);
-    int16x8_t v134 = vaddq_s16(v134_tmp, v133);
-    int16x8_t v135 = vaddq_s16(v121, v107);
-    int16x8_t v136 = vqrdmulhq_n_s16(v135, 17734);
-    int16x8_t v137 = vaddq_s16(v134, v136);
-    int16x8_t v138 = vaddq_s16(v132, v137);
-    int16x8_t v139 = vqrdmulhq_n_s16(v138, 16463);
-    int16x8_t v140 = vaddq_s16(v129, v139);
-    int16x8_t v141 = vaddq_s16(v102, v140);
-    int16x8_t v142 = vqrdmulhq_n_s16(v141, 16404);
-    int16x8_t v143 = vaddq_s16(v61, v142);
-    int16x8_t v144 = vld1q_s16(in + in_stride * 1 + i);
-    int16x8_t v145_tmp = vqrdmulhq_n_s16(v144, 13573);
-    int16x8_t v145 = vaddq_s16(v145_tmp, v144);
-    int16x8_t v146 = vld1q_s16(in + in_stride * 33 + i);
-    int16x8_t v147 = vld1q_s16(in + in_stride * 31 + i);
-    int16x8_t v148 = vaddq_s16(v146, v147);
-    int16x8_t v149 = vaddq_s16(v145, v148);
-    int16x8_t v150 = vld1q_s16(in + in_stride * 17 + i);
-    int16x8_t v151 = vld1q_s16(in + in_stride * 15 + i);
-    int16x8_t v152 = vaddq_s16(v150, v151);
-    int16x8_t v153 = vqrdmulhq_n_s16(v152, 25080);
-    int16x8_t v154 = vld1q_s16(in + in_stride * 49 + i);
-    int16x8_t v155 = vld1q_s16(in + in_stride * 47 + i);
-    int16x8_t v156 = vaddq_s16(v154, v155);
-    int16x8_t v157 = vaddq_s16(v156, v152);
-    int16x8_t v158 = vqrdmulhq_n_s16(v157, 17734);
-    int16x8_t v159 = vaddq_s16(v153, v158);
-    int16x8_t v160 = vaddq_s16(v149, v159);
-    int16x8_t v161 = vld1q_s16(in + in_stride * 9 + i);
-    int16x8_t v162 = vld1q_s16(in + in_stride * 7 + i);
-    int16x8_t v163 = vaddq_s16(v161, v162);
-    int16x8_t v164_tmp = vqrdmulhq_n_s16(v163, 13573);
-    int16x8_t v164 = vaddq_s16(v164_tmp, v163);
-    int16x8_t v165 = vld1q_s16(in + in_stride * 41 + i);
-    int16x8_t v166 = vld1q_s16(in + in_stride * 39 + i);
-    int16x8_t v167 = vaddq_s16(v165, v166);
-    int16x8_t v168 = vld1q_s16(in + in_stride * 25 + i);
-    int16x8_t v169 = vld1q_s16(in + in_stride * 23 + i);
-    int16x8_t v170 = vaddq_s16(v168, v169);
-    int16x8_t v171 = vaddq_s16(v167, v170);
-    int16x8_t v172 = vaddq_s16(v164, v171);
-    int16x8_t v173 = vqrdmulhq_n_s16(v172, 16705);
-    int16x8_t v174 = vaddq_s16(v170, v163);
-    int16x8_t v175_tmp = vqrdmulhq_n_s16(v174, 10045);
-    int16x8_t v175 = vaddq_s16(v175_tmp, v174);
-    int16x8_t v176 = vld1q_s16(in + in_stride * 57 + i);
-    int16x8_t v177 = vld1q_s16(in + in_stride * 55 + i);
-    int16x8_t v178 = vaddq_s16(v176, v177);
-    int16x8_t v179 = vaddq_s16(v178, v167);
-    int16x8_t v180 = vqrdmulhq_n_s16(v179, 17734);
-    int16x8_t v181 = vaddq_s16(v175, v180);
-    int16x8_t v182 = vqrdmulhq_n_s16(v181, 16705);
-    int16x8_t v183 = vaddq_s16(v173, v182);
-    int16x8_t v184 = vaddq_s16(v160, v183);
-    int16x8_t v185 = vld1q_s16(in + in_stride * 37 + i);
-    int16x8_t v186 = vld1q_s16(in + in_stride * 35 + i);
-    int16x8_t v187 = vaddq_s16(v185, v186);
-    int16x8_t v188 = vld1q_s16(in + in_stride * 45 + i);
-    int16x8_t v189 = vld1q_s16(in + in_stride * 43 + i);
-    int16x8_t v190 = vaddq_s16(v188, v189);
-    int16x8_t v191 = vaddq_s16(v187, v190);
-    int16x8_t v192 = vld1q_s16(in + in_stride * 29 + i);
-    int16x8_t v193 = vld1q_s16(in + in_stride * 27 + i);
-    int16x8_t v194 = vaddq_s16(v192, v193);
-    int16x8_t v195 = vld1q_s16(in + in_stride * 21 + i);
-    int16x8_t v196 = vld1q_s16(in + in_stride * 19 + i);
-    int16x8_t v197 = vaddq_s16(v195, v196);
-    int16x8_t v198 = vaddq_s16(v194, v197);
-    int16x8_t v199 = vaddq_s16(v191, v198);
-    int16x8_t v200 = vld1q_s16(in + in_stride * 5 + i);
-    int16x8_t v201 = vld1q_s16(in + in_stride * 3 + i);
-    int16x8_t v202 = vaddq_s16(v200, v201);
-    int16x8_t v203 = vld1q_s16(in + in_stride * 13 + i);
-    int16x8_t v204 = vld1q_s16(in + in_stride * 11 + i);
-    int16x8_t v205 = vaddq_s16(v203, v204);
-    int16x8_t v206 = vaddq_s16(v202, v205);
-    int16x8_t v207_tmp = vqrdmulhq_n_s16(v206, 13573);
-    int16x8_t v207 = vaddq_s16(v207_tmp, v206);
-    int16x8_t v208 = vaddq_s16(v199, v207);
-    int16x8_t v209 = vqrdmulhq_n_s16(v208, 16705);
-    int16x8_t v210 = vaddq_s16(v198, v206);
-    int16x8_t v211 = vqrdmulhq_n_s16(v210, 25080);
-    int16x8_t v212 = vqrdmulhq_n_s16(v210, 17734);
-    int16x8_t v213 = vld1q_s16(in + in_stride * 53 + i);
-    int16x8_t v214 = vld1q_s16(in + in_stride * 51 + i);
-    int16x8_t v215 = vaddq_s16(v213, v214);
-    int16x8_t v216 = vld1q_s16(in + in_stride * 61 + i);
-    int16x8_t v217 = vld1q_s16(in + in_stride * 59 + i);
-    int16x8_t v218 = vaddq_s16(v216, v217);
-    int16x8_t v219 = vaddq_s16(v215, v218);
-    int16x8_t v220 = vaddq_s16(v219, v191);
-    int16x8_t v221 = vqrdmulhq_n_s16(v220, 17734);
-    int16x8_t v222 = vaddq_s16(v212, v221);
-    int16x8_t v223 = vaddq_s16(v211, v222);
-    int16x8_t v224 = vqrdmulhq_n_s16(v223, 16705);
-    int16x8_t v225 = vaddq_s16(v209, v224);
-    int16x8_t v226 = vqrdmulhq_n_s16(v225, 16463);
-    int16x8_t v227_tmp = vqrdmulhq_n_s16(v202, 13573);
-    int16x8_t v227 = vaddq_s16(v227_tmp, v202);
-    int16x8_t v228 = vaddq_s16(v187, v194);
-    int16x8_t v229 = vaddq_s16(v227, v228);
-    int16x8_t v230 = vaddq_s16(v215, v190);
-    int16x8_t v231 = vqrdmulhq_n_s16(v230, 17734);
-    int16x8_t v232 = vaddq_s16(v197, v205);
-    int16x8_t v233_tmp = vqrdmulhq_n_s16(v232, 10045);
-    int16x8_t v233 = vaddq_s16(v233_tmp, v232);
-    int16x8_t v234 = vaddq_s16(v231, v233);
-    int16x8_t v235 = vaddq_s16(v229, v234);
-    int16x8_t v236 = vqrdmulhq_n_s16(v235, 16463);
-    int16x8_t v237 = vaddq_s16(v226, v236);
-    int16x8_t v238 = vaddq_s16(v184, v237);
-    int16x8_t v239 = vaddq_s16(v201, v144);
-    int16x8_t v240_tmp = vqrdmulhq_n_s16(v239, 13573);
-    int16x8_t v240 = vaddq_s16(v240_tmp, v239);
-    int16x8_t v241 = vaddq_s16(v186, v146);
-    int16x8_t v242 = vaddq_s16(v147, v192);
-    int16x8_t v243 = vaddq_s16(v241, v242);
-    int16x8_t v244 = vaddq_s16(v240, v243);
-    int16x8_t v245 = vaddq_s16(v196, v150);
-    int16x8_t v246 = vaddq_s16(v151, v203);
-    int16x8_t v247 = vaddq_s16(v245, v246);
-    int16x8_t v248_tmp = vqrdmulhq_n_s16(v247, 10045);
-    int16x8_t v248 = vaddq_s16(v248_tmp, v247);
-    int16x8_t v249 = vaddq_s16(v155, v188);
-    int16x8_t v250 = vaddq_s16(v214, v154);
-    int16x8_t v251 = vaddq_s16(v249, v250);
-    int16x8_t v252 = vqrdmulhq_n_s16(v251, 17734);
-    int16x8_t v253 = vaddq_s16(v248, v252);
-    int16x8_t v254 = vaddq_s16(v244, v253);
-    int16x8_t v255 = vaddq_s16(v204, v161);
-    int16x8_t v256 = vaddq_s16(v162, v200);
-    int16x8_t v257 = vaddq_s16(v255, v256);
-    int16x8_t v258_tmp = vqrdmulhq_n_s16(v257, 13573);
-    int16x8_t v258 = vaddq_s16(v258_tmp, v257);
-    int16x8_t v259 = vaddq_s16(v189, v165);
-    int16x8_t v260 = vaddq_s16(v166, v185);
-    int16x8_t v261 = vaddq_s16(v259, v260);
-    int16x8_t v262 = vaddq_s16(v169, v195);
-    int16x8_t v263 = vaddq_s16(v193, v168);
-    int16x8_t v264 = vaddq_s16(v262, v263);
-    int16x8_t v265 = vaddq_s16(v261, v264);
-    int16x8_t v266 = vaddq_s16(v258, v265);
-    int16x8_t v267 = vqrdmulhq_n_s16(v266, 16705);
-    int16x8_t v268 = vaddq_s16(v264, v257);
-    int16x8_t v269 = vqrdmulhq_n_s16(v268, 25080);
-    int16x8_t v270 = vaddq_s16(v217, v176);
-    int16x8_t v271 = vaddq_s16(v177, v213);
-    int16x8_t v272 = vaddq_s16(v270, v271);
-    int16x8_t v273 = vaddq_s16(v272, v261);
-    int16x8_t v274 = vqrdmulhq_n_s16(v273, 17734);
-    int16x8_t v275 = vqrdmulhq_n_s16(v268, 17734);
-    int16x8_t v276 = vaddq_s16(v274, v275);
-    int16x8_t v277 = vaddq_s16(v269, v276);
-    int16x8_t v278 = vqrdmulhq_n_s16(v277, 16705);
-    int16x8_t v279 = vaddq_s16(v267, v278);
-    int16x8_t v280 = vaddq_s16(v254, v279);
-    int16x8_t v281 = vqrdmulhq_n_s16(v280, 16404);
-    int16x8_t v282 = vaddq_s16(v256, v239);
-    int16x8_t v283_tmp = vqrdmulhq_n_s16(v282, 13573);
-    int16x8_t v283 = vaddq_s16(v283_tmp, v282);
-    int16x8_t v284 = vaddq_s16(v260, v241);
-    int16x8_t v285 = vaddq_s16(v242, v263);
-    int16x8_t v286 = vaddq_s16(v284, v285);
-    int16x8_t v287 = vaddq_s16(v283, v286);
-    int16x8_t v288 = vaddq_s16(v262, v245);
-    int16x8_t v289 = vaddq_s16(v246, v255);
-    int16x8_t v290 = vaddq_s16(v288, v289);
-    int16x8_t v291 = vqrdmulhq_n_s16(v290, 25080);
-    int16x8_t v292 = vqrdmulhq_n_s16(v290, 17734);
-    int16x8_t v293 = vaddq_s16(v271, v250);
-    int16x8_t v294 = vaddq_s16(v249, v259);
-    int16x8_t v295 = vaddq_s16(v293, v294);
-    int16x8_t v296 = vqrdmulhq_n_s16(v295, 17734);
-    int16x8_t v297 = vaddq_s16(v292, v296);
-    int16x8_t v298 = vaddq_s16(v291, v297);
-    int16x8_t v299 = vaddq_s16(v287, v298);
-    int16x8_t v300 = vqrdmulhq_n_s16(v299, 16463);
-    int16x8_t v301 = vaddq_s16(v289, v282);
-    int16x8_t v302 = vqrdmulhq_n_s16(v301, 23624);
-    int16x8_t v303 = vaddq_s16(v294, v284);
-    int16x8_t v304 = vqrdmulhq_n_s16(v303, 19705);
-    int16x8_t v305 = vaddq_s16(v285, v288);
-    int16x8_t v306 = vqrdmulhq_n_s16(v305, 19705);
-    int16x8_t v307 = vaddq_s16(v304, v306);
-    int16x8_t v308 = vqrdmulhq_n_s16(v307, 27779);
-    int16x8_t v309 = vaddq_s16(v302, v308);
-    int16x8_t v310 = vaddq_s16(v305, v301);
-    int16x8_t v311 = vqrdmulhq_n_s16(v310, 25080);
-    int16x8_t v312 = vqrdmulhq_n_s16(v310, 17734);
-    int16x8_t v313 = vld1q_s16(in + in_stride * 63 + i);
-    int16x8_t v314 = vaddq_s16(v313, v216);
-    int16x8_t v315 = vaddq_s16(v314, v270);
-    int16x8_t v316 = vaddq_s16(v315, v293);
-    int16x8_t v317 = vqrdmulhq_n_s16(v316, 25746);
-    int16x8_t v318 = vqrdmulhq_n_s16(v303, 25746);
-    int16x8_t v319 = vaddq_s16(v317, v318);
-    int16x8_t v320 = vqrdmulhq_n_s16(v319, 22571);
-    int16x8_t v321 = vaddq_s16(v312, v320);
-    int16x8_t v322 = vaddq_s16(v311, v321);
-    int16x8_t v323 = vqrdmulhq_n_s16(v322, 16705);
-    int16x8_t v324 = vaddq_s16(v309, v323);
-    int16x8_t v325 = vqrdmulhq_n_s16(v324, 16463);
-    int16x8_t v326 = vaddq_s16(v300, v325);
-    int16x8_t v327 = vqrdmulhq_n_s16(v326, 16404);
-    int16x8_t v328 = vaddq_s16(v281, v327);
-    int16x8_t v329 = vaddq_s16(v238, v328);
-    int16x8_t v330 = vqrdmulhq_n_s16(v329, 16389);
-    int16x8_t v331 = vaddq_s16(v143, v330);
-    int16x8_t v332 = vsubq_s16(v82, v89);
-    int16x8_t v333 = vqrdmulhq_n_s16(v332, 19705);
-    int16x8_t v334 = vqrdmulhq_n_s16(v92, 13573);
-    int16x8_t v335 = vsubq_s16(v334, v97);
-    int16x8_t v336 = vqrdmulhq_n_s16(v335, 25746);
-    int16x8_t v337 = vaddq_s16(v333, v336);
-    int16x8_t v338 = vsubq_s16(v63, v66);
-    int16x8_t v339 = vqrdmulhq_n_s16(v70, 17734);
-    int16x8_t v340_tmp = vqrdmulhq_n_s16(v74, 10045);
-    int16x8_t v340 = vaddq_s16(v340_tmp, v74);
-    int16x8_t v341 = vsubq_s16(v339, v340);
-    int16x8_t v342 = vaddq_s16(v338, v341);
-    int16x8_t v343 = vaddq_s16(v337, v342);
-    int16x8_t v344 = vsubq_s16(v130, v131);
-    int16x8_t v345 = vqrdmulhq_n_s16(v133, 13573);
-    int16x8_t v346 = vsubq_s16(v345, v135);
-    int16x8_t v347_tmp = vqrdmulhq_n_s16(v346, 10045);
-    int16x8_t v347 = vaddq_s16(v347_tmp, v346);
-    int16x8_t v348 = vaddq_s16(v344, v347);
-    int16x8_t v349 = vqrdmulhq_n_s16(v348, 17121);
-    int16x8_t v350 = vqrdmulhq_n_s16(v105, 27867);
-    int16x8_t v351 = vqrdmulhq_n_s16(v113, 19705);
-    int16x8_t v352 = vsubq_s16(v350, v351);
-    int16x8_t v353 = vqrdmulhq_n_s16(v116, 13573);
-    int16x8_t v354 = vsubq_s16(v353, v123);
-    int16x8_t v355 = vqrdmulhq_n_s16(v354, 25746);
-    int16x8_t v356 = vaddq_s16(v352, v355);
-    int16x8_t v357 = vqrdmulhq_n_s16(v356, 17121);
-    int16x8_t v358 = vaddq_s16(v349, v357);
-    int16x8_t v359 = vaddq_s16(v343, v358);
-    int16x8_t v360 = vqrdmulhq_n_s16(v359, 16563);
-    int16x8_t v361 = vsubq_s16(v27, v30);
-    int16x8_t v362 = vqrdmulhq_n_s16(v34, 17734);
-    int16x8_t v363_tmp = vqrdmulhq_n_s16(v38, 10045);
-    int16x8_t v363 = vaddq_s16(v363_tmp, v38);
-    int16x8_t v364 = vsubq_s16(v362, v363);
-    int16x8_t v365 = vaddq_s16(v361, v364);
-    int16x8_t v366 = vsubq_s16(v44, v47);
-    int16x8_t v367 = vqrdmulhq_n_s16(v366, 19705);
-    int16x8_t v368 = vqrdmulhq_n_s16(v50, 13573);
-    int16x8_t v369 = vsubq_s16(v368, v54);
-    int16x8_t v370 = vqrdmulhq_n_s16(v369, 25746);
-    int16x8_t v371 = vaddq_s16(v367, v370);
-    int16x8_t v372 = vaddq_s16(v365, v371);
-    int16x8_t v373 = vqrdmulhq_n_s16(v372, 17121);
-    int16x8_t v374 = vsubq_s16(v0, v1);
-    int16x8_t v375 = vsubq_s16(v4, v6);
-    int16x8_t v376_tmp = vqrdmulhq_n_s16(v375, 10045);
-    int16x8_t v376 = vaddq_s16(v376_tmp, v375);
-    int16x8_t v377 = vaddq_s16(v374, v376);
-    int16x8_t v378 = vsubq_s16(v11, v14);
-    int16x8_t v379 = vqrdmulhq_n_s16(v18, 17734);
-    int16x8_t v380_tmp = vqrdmulhq_n_s16(v17, 10045);
-    int16x8_t v380 = vaddq_s16(v380_tmp, v17);
-    int16x8_t v381 = vsubq_s16(v379, v380);
-    int16x8_t v382 = vaddq_s16(v378, v381);
-    int16x8_t v383 = vqrdmulhq_n_s16(v382, 19705);
-    int16x8_t v384 = vaddq_s16(v377, v383);
-    int16x8_t v385 = vaddq_s16(v373, v384);
-    int16x8_t v386 = vaddq_s16(v360, v385);
-    int16x8_t v387 = vsubq_s16(v145, v148);
-    int16x8_t v388 = vqrdmulhq_n_s16(v152, 17734);
-    int16x8_t v389_tmp = vqrdmulhq_n_s16(v156, 10045);
-    int16x8_t v389 = vaddq_s16(v389_tmp, v156);
-    int16x8_t v390 = vsubq_s16(v388, v389);
-    int16x8_t v391 = vaddq_s16(v387, v390);
-    int16x8_t v392 = vsubq_s16(v164, v171);
-    int16x8_t v393 = vqrdmulhq_n_s16(v392, 19705);
-    int16x8_t v394 = vqrdmulhq_n_s16(v174, 13573);
-    int16x8_t v395 = vsubq_s16(v394, v179);
-    int16x8_t v396 = vqrdmulhq_n_s16(v395, 25746);
-    int16x8_t v397 = vaddq_s16(v393, v396);
-    int16x8_t v398 = vaddq_s16(v391, v397);
-    int16x8_t v399 = vsubq_s16(v227, v228);
-    int16x8_t v400 = vqrdmulhq_n_s16(v232, 13573);
-    int16x8_t v401 = vsubq_s16(v400, v230);
-    int16x8_t v402_tmp = vqrdmulhq_n_s16(v401, 10045);
-    int16x8_t v402 = vaddq_s16(v402_tmp, v401);
-    int16x8_t v403 = vaddq_s16(v399, v402);
-    int16x8_t v404 = vqrdmulhq_n_s16(v403, 17121);
-    int16x8_t v405 = vqrdmulhq_n_s16(v206, 27867);
-    int16x8_t v406 = vqrdmulhq_n_s16(v199, 19705);
-    int16x8_t v407 = vsubq_s16(v405, v406);
-    int16x8_t v408 = vqrdmulhq_n_s16(v210, 13573);
-    int16x8_t v409 = vsubq_s16(v408, v220);
-    int16x8_t v410 = vqrdmulhq_n_s16(v409, 25746);
-    int16x8_t v411 = vaddq_s16(v407, v410);
-    int16x8_t v412 = vqrdmulhq_n_s16(v411, 17121);
-    int16x8_t v413 = vaddq_s16(v404, v412);
-    int16x8_t v414 = vaddq_s16(v398, v413);
-    int16x8_t v415 = vsubq_s16(v240, v243);
-    int16x8_t v416 = vqrdmulhq_n_s16(v247, 13573);
-    int16x8_t v417 = vsubq_s16(v416, v251);
-    int16x8_t v418_tmp = vqrdmulhq_n_s16(v417, 10045);
-    int16x8_t v418 = vaddq_s16(v418_tmp, v417);
-    int16x8_t v419 = vaddq_s16(v415, v418);
-    int16x8_t v420 = vqrdmulhq_n_s16(v257, 27867);
-    int16x8_t v421 = vqrdmulhq_n_s16(v265, 19705);
-    int16x8_t v422 = vsubq_s16(v420, v421);
-    int16x8_t v423 = vqrdmulhq_n_s16(v268, 13573);
-    int16x8_t v424 = vsubq_s16(v423, v273);
-    int16x8_t v425 = vqrdmulhq_n_s16(v424, 25746);
-    int16x8_t v426 = vaddq_s16(v422, v425);
-    int16x8_t v427 = vaddq_s16(v419, v426);
-    int16x8_t v428 = vqrdmulhq_n_s16(v427, 16563);
-    int16x8_t v429 = vqrdmulhq_n_s16(v301, 27867);
-    int16x8_t v430 = vsubq_s16(v429, v307);
-    int16x8_t v431 = vqrdmulhq_n_s16(v310, 10664);
-    int16x8_t v432 = vsubq_s16(v431, v319);
-    int16x8_t v433 = vaddq_s16(v430, v432);
-    int16x8_t v434 = vqrdmulhq_n_s16(v433, 17121);
-    int16x8_t v435 = vsubq_s16(v283, v286);
-    int16x8_t v436 = vqrdmulhq_n_s16(v290, 13573);
-    int16x8_t v437 = vsubq_s16(v436, v295);
-    int16x8_t v438_tmp = vqrdmulhq_n_s16(v437, 10045);
-    int16x8_t v438 = vaddq_s16(v438_tmp, v437);
-    int16x8_t v439 = vaddq_s16(v435, v438);
-    int16x8_t v440 = vqrdmulhq_n_s16(v439, 17121);
-    int16x8_t v441 = vaddq_s16(v434, v440);
-    int16x8_t v442 = vqrdmulhq_n_s16(v441, 16563);
-    int16x8_t v443 = vaddq_s16(v428, v442);
-    int16x8_t v444 = vaddq_s16(v414, v443);
-    int16x8_t v445 = vqrdmulhq_n_s16(v444, 16429);
-    int16x8_t v446 = vaddq_s16(v386, v445);
-    int16x8_t v447 = vsubq_s16(v374, v376);
-    int16x8_t v448 = vsubq_s16(v378, v381);
-    int16x8_t v449 = vqrdmulhq_n_s16(v448, 29490);
-    int16x8_t v450 = vaddq_s16(v447, v449);
-    int16x8_t v451 = vsubq_s16(v361, v364);
-    int16x8_t v452 = vqrdmulhq_n_s16(v366, 29490);
-    int16x8_t v453_tmp = vqrdmulhq_n_s16(v369, 5763);
-    int16x8_t v453 = vaddq_s16(v453_tmp, v369);
-    int16x8_t v454 = vsubq_s16(v452, v453);
-    int16x8_t v455 = vaddq_s16(v451, v454);
-    int16x8_t v456 = vqrdmulhq_n_s16(v455, 18578);
-    int16x8_t v457 = vaddq_s16(v450, v456);
-    int16x8_t v458 = vsubq_s16(v338, v341);
-    int16x8_t v459 = vqrdmulhq_n_s16(v332, 29490);
-    int16x8_t v460_tmp = vqrdmulhq_n_s16(v335, 5763);
-    int16x8_t v460 = vaddq_s16(v460_tmp, v335);
-    int16x8_t v461 = vsubq_s16(v459, v460);
-    int16x8_t v462 = vaddq_s16(v458, v461);
-    int16x8_t v463 = vqrdmulhq_n_s16(v352, 27803);
-    int16x8_t v464 = vqrdmulhq_n_s16(v354, 21845);
-    int16x8_t v465 = vsubq_s16(v463, v464);
-    int16x8_t v466 = vsubq_s16(v344, v347);
-    int16x8_t v467 = vqrdmulhq_n_s16(v466, 18578);
-    int16x8_t v468 = vaddq_s16(v465, v467);
-    int16x8_t v469 = vaddq_s16(v462, v468);
-    int16x8_t v470 = vqrdmulhq_n_s16(v469, 16890);
-    int16x8_t v471 = vaddq_s16(v457, v470);
-    int16x8_t v472 = vsubq_s16(v415, v418);
-    int16x8_t v473_tmp = vqrdmulhq_n_s16(v422, 16273);
-    int16x8_t v473 = vaddq_s16(v473_tmp, v422);
-    int16x8_t v474_tmp = vqrdmulhq_n_s16(v424, 5763);
-    int16x8_t v474 = vaddq_s16(v474_tmp, v424);
-    int16x8_t v475 = vsubq_s16(v473, v474);
-    int16x8_t v476 = vaddq_s16(v472, v475);
-    int16x8_t v477 = vqrdmulhq_n_s16(v476, 16890);
-    int16x8_t v478 = vqrdmulhq_n_s16(v435, 20261);
-    int16x8_t v479 = vqrdmulhq_n_s16(v437, 26472);
-    int16x8_t v480 = vsubq_s16(v478, v479);
-    int16x8_t v481 = vqrdmulhq_n_s16(v480, 30046);
-    int16x8_t v482 = vqrdmulhq_n_s16(v430, 30322);
-    int16x8_t v483 = vqrdmulhq_n_s16(v432, 30322);
-    int16x8_t v484 = vsubq_s16(v482, v483);
-    int16x8_t v485 = vqrdmulhq_n_s16(v484, 30046);
-    int16x8_t v486 = vaddq_s16(v481, v485);
-    int16x8_t v487 = vqrdmulhq_n_s16(v486, 16890);
-    int16x8_t v488 = vaddq_s16(v477, v487);
-    int16x8_t v489 = vsubq_s16(v387, v390);
-    int16x8_t v490 = vqrdmulhq_n_s16(v392, 29490);
-    int16x8_t v491_tmp = vqrdmulhq_n_s16(v395, 5763);
-    int16x8_t v491 = vaddq_s16(v491_tmp, v395);
-    int16x8_t v492 = vsubq_s16(v490, v491);
-    int16x8_t v493 = vaddq_s16(v489, v492);
-    int16x8_t v494 = vsubq_s16(v399, v402);
-    int16x8_t v495 = vqrdmulhq_n_s16(v494, 18578);
-    int16x8_t v496 = vqrdmulhq_n_s16(v407, 27803);
-    int16x8_t v497 = vqrdmulhq_n_s16(v409, 21845);
-    int16x8_t v498 = vsubq_s16(v496, v497);
-    int16x8_t v499 = vaddq_s16(v495, v498);
-    int16x8_t v500 = vaddq_s16(v493, v499);
-    int16x8_t v501 = vaddq_s16(v488, v500);
-    int16x8_t v502 = vqrdmulhq_n_s16(v501, 16508);
-    int16x8_t v503 = vaddq_s16(v471, v502);
-    int16x8_t v504 = vsubq_s16(v2, v8);
-    int16x8_t v505 = vsubq_s16(v15, v22);
-    int16x8_t v506_tmp = vqrdmulhq_n_s16(v505, 18446);
-    int16x8_t v506 = vmlaq_n_s16(v506_tmp, v505, 2);
-    int16x8_t v507 = vaddq_s16(v504, v506);
-    int16x8_t v508 = vsubq_s16(v31, v41);
-    int16x8_t v509 = vsubq_s16(v48, v56);
-    int16x8_t v510_tmp = vqrdmulhq_n_s16(v509, 18446);
-    int16x8_t v510 = vmlaq_n_s16(v510_tmp, v509, 2);
-    int16x8_t v511 = vaddq_s16(v508, v510);
-    int16x8_t v512 = vqrdmulhq_n_s16(v511, 21195);
-    int16x8_t v513 = vaddq_s16(v507, v512);
-    int16x8_t v514 = vsubq_s16(v67, v77);
-    int16x8_t v515 = vsubq_s16(v90, v99);
-    int16x8_t v516_tmp = vqrdmulhq_n_s16(v515, 18446);
-    int16x8_t v516 = vmlaq_n_s16(v516_tmp, v515, 2);
-    int16x8_t v517 = vaddq_s16(v514, v516);
-    int16x8_t v518 = vsubq_s16(v114, v126);
-    int16x8_t v519_tmp = vqrdmulhq_n_s16(v518, 18446);
-    int16x8_t v519 = vmlaq_n_s16(v519_tmp, v518, 2);
-    int16x8_t v520 = vsubq_s16(v132, v137);
-    int16x8_t v521 = vaddq_s16(v519, v520);
-    int16x8_t v522 = vqrdmulhq_n_s16(v521, 21195);
-    int16x8_t v523 = vaddq_s16(v517, v522);
-    int16x8_t v524 = vqrdmulhq_n_s16(v523, 17401);
-    int16x8_t v525 = vaddq_s16(v513, v524);
-    int16x8_t v526 = vsubq_s16(v172, v181);
-    int16x8_t v527_tmp = vqrdmulhq_n_s16(v526, 18446);
-    int16x8_t v527 = vmlaq_n_s16(v527_tmp, v526, 2);
-    int16x8_t v528 = vsubq_s16(v149, v159);
-    int16x8_t v529 = vaddq_s16(v527, v528);
-    int16x8_t v530 = vsubq_s16(v229, v234);
-    int16x8_t v531 = vsubq_s16(v208, v223);
-    int16x8_t v532_tmp = vqrdmulhq_n_s16(v531, 18446);
-    int16x8_t v532 = vmlaq_n_s16(v532_tmp, v531, 2);
-    int16x8_t v533 = vaddq_s16(v530, v532);
-    int16x8_t v534 = vqrdmulhq_n_s16(v533, 21195);
-    int16x8_t v535 = vaddq_s16(v529, v534);
-    int16x8_t v536 = vsubq_s16(v244, v253);
-    int16x8_t v537 = vsubq_s16(v266, v277);
-    int16x8_t v538_tmp = vqrdmulhq_n_s16(v537, 18446);
-    int16x8_t v538 = vmlaq_n_s16(v538_tmp, v537, 2);
-    int16x8_t v539 = vaddq_s16(v536, v538);
-    int16x8_t v540 = vqrdmulhq_n_s16(v539, 17401);
-    int16x8_t v541 = vqrdmulhq_n_s16(v287, 25826);
-    int16x8_t v542 = vqrdmulhq_n_s16(v298, 25826);
-    int16x8_t v543 = vsubq_s16(v541, v542);
-    int16x8_t v544 = vqrdmulhq_n_s16(v543, 14281);
-    int16x8_t v545_tmp = vqrdmulhq_n_s16(v309, 31509);
-    int16x8_t v545 = vaddq_s16(v545_tmp, v309);
-    int16x8_t v546 = vsubq_s16(v545, v322);
-    int16x8_t v547 = vqrdmulhq_n_s16(v546, 28847);
-    int16x8_t v548 = vaddq_s16(v544, v547);
-    int16x8_t v549 = vaddq_s16(v540, v548);
-    int16x8_t v550 = vaddq_s16(v535, v549);
-    int16x8_t v551 = vqrdmulhq_n_s16(v550, 16629);
-    int16x8_t v552 = vaddq_s16(v525, v551);
-    int16x8_t v553 = vsubq_s16(v504, v506);
-    int16x8_t v554 = vsubq_s16(v508, v510);
-    int16x8_t v555 = vqrdmulhq_n_s16(v554, 25826);
-    int16x8_t v556 = vaddq_s16(v553, v555);
-    int16x8_t v557 = vsubq_s16(v514, v516);
-    int16x8_t v558 = vsubq_s16(v520, v519);
-    int16x8_t v559 = vqrdmulhq_n_s16(v558, 25826);
-    int16x8_t v560 = vaddq_s16(v557, v559);
-    int16x8_t v561 = vqrdmulhq_n_s16(v560, 18124);
-    int16x8_t v562 = vaddq_s16(v556, v561);
-    int16x8_t v563 = vsubq_s16(v528, v527);
-    int16x8_t v564 = vsubq_s16(v530, v532);
-    int16x8_t v565 = vqrdmulhq_n_s16(v564, 25826);
-    int16x8_t v566 = vaddq_s16(v563, v565);
-    int16x8_t v567 = vsubq_s16(v536, v538);
-    int16x8_t v568 = vqrdmulhq_n_s16(v567, 18124);
-    int16x8_t v569_tmp = vqrdmulhq_n_s16(v546, 654);
-    int16x8_t v569 = vmlaq_n_s16(v569_tmp, v546, 2);
-    int16x8_t v570 = vsubq_s16(v543, v569);
-    int16x8_t v571 = vqrdmulhq_n_s16(v570, 18124);
-    int16x8_t v572 = vaddq_s16(v568, v571);
-    int16x8_t v573 = vaddq_s16(v566, v572);
-    int16x8_t v574 = vqrdmulhq_n_s16(v573, 16792);
-    int16x8_t v575 = vaddq_s16(v562, v574);
-    int16x8_t v576 = vsubq_s16(v458, v461);
-    int16x8_t v577_tmp = vqrdmulhq_n_s16(v465, 25030);
-    int16x8_t v577 = vaddq_s16(v577_tmp, v465);
-    int16x8_t v578 = vsubq_s16(v466, v577);
-    int16x8_t v579_tmp = vqrdmulhq_n_s16(v578, 1988);
-    int16x8_t v579 = vaddq_s16(v579_tmp, v578);
-    int16x8_t v580 = vaddq_s16(v576, v579);
-    int16x8_t v581 = vqrdmulhq_n_s16(v580, 19102);
-    int16x8_t v582 = vsubq_s16(v447, v449);
-    int16x8_t v583 = vsubq_s16(v451, v454);
-    int16x8_t v584_tmp = vqrdmulhq_n_s16(v583, 1988);
-    int16x8_t v584 = vaddq_s16(v584_tmp, v583);
-    int16x8_t v585 = vaddq_s16(v582, v584);
-    int16x8_t v586 = vaddq_s16(v581, v585);
-    int16x8_t v587 = vsubq_s16(v489, v492);
-    int16x8_t v588_tmp = vqrdmulhq_n_s16(v498, 25030);
-    int16x8_t v588 = vaddq_s16(v588_tmp, v498);
-    int16x8_t v589 = vsubq_s16(v494, v588);
-    int16x8_t v590_tmp = vqrdmulhq_n_s16(v589, 1988);
-    int16x8_t v590 = vaddq_s16(v590_tmp, v589);
-    int16x8_t v591 = vaddq_s16(v587, v590);
-    int16x8_t v592 = vsubq_s16(v472, v475);
-    int16x8_t v593 = vqrdmulhq_n_s16(v592, 19102);
-    int16x8_t v594 = vsubq_s16(v480, v484);
-    int16x8_t v595 = vaddq_s16(v593, v594);
-    int16x8_t v596 = vaddq_s16(v591, v595);
-    int16x8_t v597 = vqrdmulhq_n_s16(v596, 17000);
-    int16x8_t v598 = vaddq_s16(v586, v597);
-    int16x8_t v599 = vsubq_s16(v365, v371);
-    int16x8_t v600_tmp = vqrdmulhq_n_s16(v599, 23673);
-    int16x8_t v600 = vaddq_s16(v600_tmp, v599);
-    int16x8_t v601 = vsubq_s16(v377, v383);
-    int16x8_t v602 = vaddq_s16(v600, v601);
-    int16x8_t v603 = vsubq_s16(v348, v356);
-    int16x8_t v604_tmp = vqrdmulhq_n_s16(v603, 23673);
-    int16x8_t v604 = vaddq_s16(v604_tmp, v603);
-    int16x8_t v605 = vsubq_s16(v342, v337);
-    int16x8_t v606 = vaddq_s16(v604, v605);
-    int16x8_t v607 = vqrdmulhq_n_s16(v606, 20398);
-    int16x8_t v608 = vaddq_s16(v602, v607);
-    int16x8_t v609 = vsubq_s16(v391, v397);
-    int16x8_t v610 = vsubq_s16(v403, v411);
-    int16x8_t v611_tmp = vqrdmulhq_n_s16(v610, 23673);
-    int16x8_t v611 = vaddq_s16(v611_tmp, v610);
-    int16x8_t v612 = vaddq_s16(v609, v611);
-    int16x8_t v613 = vsubq_s16(v419, v426);
-    int16x8_t v614 = vqrdmulhq_n_s16(v613, 20398);
-    int16x8_t v615 = vsubq_s16(v439, v433);
-    int16x8_t v616_tmp = vqrdmulhq_n_s16(v615, 2367);
-    int16x8_t v616 = vaddq_s16(v616_tmp, v615);
-    int16x8_t v617 = vaddq_s16(v614, v616);
-    int16x8_t v618 = vaddq_s16(v612, v617);
-    int16x8_t v619 = vqrdmulhq_n_s16(v618, 17255);
-    int16x8_t v620 = vaddq_s16(v608, v619);
-    int16x8_t v621 = vsubq_s16(v160, v183);
-    int16x8_t v622 = vsubq_s16(v235, v225);
-    int16x8_t v623_tmp = vqrdmulhq_n_s16(v622, 3314);
-    int16x8_t v623 = vmlaq_n_s16(v623_tmp, v622, 5);
-    int16x8_t v624 = vaddq_s16(v621, v623);
-    int16x8_t v625 = vsubq_s16(v254, v279);
-    int16x8_t v626 = vsubq_s16(v299, v324);
-    int16x8_t v627_tmp = vqrdmulhq_n_s16(v626, 3314);
-    int16x8_t v627 = vmlaq_n_s16(v627_tmp, v626, 5);
-    int16x8_t v628 = vaddq_s16(v625, v627);
-    int16x8_t v629 = vqrdmulhq_n_s16(v628, 22112);
-    int16x8_t v630 = vaddq_s16(v624, v629);
-    int16x8_t v631 = vqrdmulhq_n_s16(v630, 17561);
-    int16x8_t v632 = vsubq_s16(v9, v24);
-    int16x8_t v633 = vsubq_s16(v42, v58);
-    int16x8_t v634_tmp = vqrdmulhq_n_s16(v633, 3314);
-    int16x8_t v634 = vmlaq_n_s16(v634_tmp, v633, 5);
-    int16x8_t v635 = vaddq_s16(v632, v634);
-    int16x8_t v636 = vsubq_s16(v78, v101);
-    int16x8_t v637 = vsubq_s16(v138, v128);
-    int16x8_t v638_tmp = vqrdmulhq_n_s16(v637, 3314);
-    int16x8_t v638 = vmlaq_n_s16(v638_tmp, v637, 5);
-    int16x8_t v639 = vaddq_s16(v636, v638);
-    int16x8_t v640 = vqrdmulhq_n_s16(v639, 22112);
-    int16x8_t v641 = vaddq_s16(v635, v640);
-    int16x8_t v642 = vaddq_s16(v631, v641);
-    int16x8_t v643 = vsubq_s16(v632, v634);
-    int16x8_t v644 = vsubq_s16(v636, v638);
-    int16x8_t v645 = vqrdmulhq_n_s16(v644, 24397);
-    int16x8_t v646 = vaddq_s16(v643, v645);
-    int16x8_t v647 = vsubq_s16(v621, v623);
-    int16x8_t v648 = vsubq_s16(v625, v627);
-    int16x8_t v649 = vqrdmulhq_n_s16(v648, 24397);
-    int16x8_t v650 = vaddq_s16(v647, v649);
-    int16x8_t v651 = vqrdmulhq_n_s16(v650, 17921);
-    int16x8_t v652 = vaddq_s16(v646, v651);
-    int16x8_t v653 = vsubq_s16(v601, v600);
-    int16x8_t v654 = vsubq_s16(v605, v604);
-    int16x8_t v655 = vqrdmulhq_n_s16(v654, 27504);
-    int16x8_t v656 = vaddq_s16(v653, v655);
-    int16x8_t v657 = vsubq_s16(v609, v611);
-    int16x8_t v658 = vqrdmulhq_n_s16(v613, 27504);
-    int16x8_t v659_tmp = vqrdmulhq_n_s16(v615, 14606);
-    int16x8_t v659 = vaddq_s16(v659_tmp, v615);
-    int16x8_t v660 = vsubq_s16(v658, v659);
-    int16x8_t v661 = vaddq_s16(v657, v660);
-    int16x8_t v662 = vqrdmulhq_n_s16(v661, 18343);
-    int16x8_t v663 = vaddq_s16(v656, v662);
-    int16x8_t v664 = vsubq_s16(v582, v584);
-    int16x8_t v665 = vsubq_s16(v576, v579);
-    int16x8_t v666 = vqrdmulhq_n_s16(v665, 31869);
-    int16x8_t v667 = vaddq_s16(v664, v666);
-    int16x8_t v668 = vsubq_s16(v587, v590);
-    int16x8_t v669_tmp = vqrdmulhq_n_s16(v594, 23444);
-    int16x8_t v669 = vaddq_s16(v669_tmp, v594);
-    int16x8_t v670 = vsubq_s16(v592, v669);
-    int16x8_t v671 = vqrdmulhq_n_s16(v670, 31869);
-    int16x8_t v672 = vaddq_s16(v668, v671);
-    int16x8_t v673 = vqrdmulhq_n_s16(v672, 18830);
-    int16x8_t v674 = vaddq_s16(v667, v673);
-    int16x8_t v675 = vsubq_s16(v553, v555);
-    int16x8_t v676 = vsubq_s16(v557, v559);
-    int16x8_t v677_tmp = vqrdmulhq_n_s16(v676, 5552);
-    int16x8_t v677 = vaddq_s16(v677_tmp, v676);
-    int16x8_t v678 = vaddq_s16(v675, v677);
-    int16x8_t v679 = vsubq_s16(v563, v565);
-    int16x8_t v680 = vsubq_s16(v567, v570);
-    int16x8_t v681_tmp = vqrdmulhq_n_s16(v680, 5552);
-    int16x8_t v681 = vaddq_s16(v681_tmp, v680);
-    int16x8_t v682 = vaddq_s16(v679, v681);
-    int16x8_t v683 = vqrdmulhq_n_s16(v682, 19393);
-    int16x8_t v684 = vaddq_s16(v678, v683);
-    int16x8_t v685 = vsubq_s16(v507, v512);
-    int16x8_t v686 = vsubq_s16(v517, v522);
-    int16x8_t v687_tmp = vqrdmulhq_n_s16(v686, 15865);
-    int16x8_t v687 = vaddq_s16(v687_tmp, v686);
-    int16x8_t v688 = vaddq_s16(v685, v687);
-    int16x8_t v689 = vsubq_s16(v529, v534);
-    int16x8_t v690_tmp = vqrdmulhq_n_s16(v548, 28937);
-    int16x8_t v690 = vaddq_s16(v690_tmp, v548);
-    int16x8_t v691 = vsubq_s16(v539, v690);
-    int16x8_t v692_tmp = vqrdmulhq_n_s16(v691, 15865);
-    int16x8_t v692 = vaddq_s16(v692_tmp, v691);
-    int16x8_t v693 = vaddq_s16(v689, v692);
-    int16x8_t v694 = vqrdmulhq_n_s16(v693, 20040);
-    int16x8_t v695 = vaddq_s16(v688, v694);
-    int16x8_t v696 = vsubq_s16(v476, v486);
-    int16x8_t v697_tmp = vqrdmulhq_n_s16(v696, 1893);
-    int16x8_t v697 = vmlaq_n_s16(v697_tmp, v696, 2);
-    int16x8_t v698 = vsubq_s16(v493, v499);
-    int16x8_t v699 = vaddq_s16(v697, v698);
-    int16x8_t v700 = vqrdmulhq_n_s16(v699, 20783);
-    int16x8_t v701 = vsubq_s16(v450, v456);
-    int16x8_t v702 = vsubq_s16(v462, v468);
-    int16x8_t v703_tmp = vqrdmulhq_n_s16(v702, 1893);
-    int16x8_t v703 = vmlaq_n_s16(v703_tmp, v702, 2);
-    int16x8_t v704 = vaddq_s16(v701, v703);
-    int16x8_t v705 = vaddq_s16(v700, v704);
-    int16x8_t v706 = vsubq_s16(v384, v373);
-    int16x8_t v707 = vsubq_s16(v343, v358);
-    int16x8_t v708_tmp = vqrdmulhq_n_s16(v707, 13357);
-    int16x8_t v708 = vmlaq_n_s16(v708_tmp, v707, 3);
-    int16x8_t v709 = vaddq_s16(v706, v708);
-    int16x8_t v710 = vsubq_s16(v398, v413);
-    int16x8_t v711 = vsubq_s16(v427, v441);
-    int16x8_t v712_tmp = vqrdmulhq_n_s16(v711, 13357);
-    int16x8_t v712 = vmlaq_n_s16(v712_tmp, v711, 3);
-    int16x8_t v713 = vaddq_s16(v710, v712);
-    int16x8_t v714 = vqrdmulhq_n_s16(v713, 21637);
-    int16x8_t v715 = vaddq_s16(v709, v714);
-    int16x8_t v716 = vsubq_s16(v25, v60);
-    int16x8_t v717 = vsubq_s16(v102, v140);
-    int16x8_t v718_tmp = vqrdmulhq_n_s16(v717, 6226);
-    int16x8_t v718 = vmlaq_n_s16(v718_tmp, v717, 10);
-    int16x8_t v719 = vaddq_s16(v716, v718);
-    int16x8_t v720 = vsubq_s16(v280, v326);
-    int16x8_t v721_tmp = vqrdmulhq_n_s16(v720, 6226);
-    int16x8_t v721 = vmlaq_n_s16(v721_tmp, v720, 10);
-    int16x8_t v722 = vsubq_s16(v184, v237);
-    int16x8_t v723 = vaddq_s16(v721, v722);
-    int16x8_t v724 = vqrdmulhq_n_s16(v723, 22622);
-    int16x8_t v725 = vaddq_s16(v719, v724);
-    int16x8_t v726 = vsubq_s16(v716, v718);
-    int16x8_t v727 = vsubq_s16(v722, v721);
-    int16x8_t v728 = vqrdmulhq_n_s16(v727, 23761);
-    int16x8_t v729 = vaddq_s16(v726, v728);
-    int16x8_t v730 = vsubq_s16(v706, v708);
-    int16x8_t v731 = vsubq_s16(v710, v712);
-    int16x8_t v732 = vqrdmulhq_n_s16(v731, 25084);
-    int16x8_t v733 = vaddq_s16(v730, v732);
-    int16x8_t v734 = vsubq_s16(v701, v703);
-    int16x8_t v735 = vsubq_s16(v698, v697);
-    int16x8_t v736 = vqrdmulhq_n_s16(v735, 26631);
-    int16x8_t v737 = vaddq_s16(v734, v736);
-    int16x8_t v738 = vsubq_s16(v685, v687);
-    int16x8_t v739 = vsubq_s16(v689, v692);
-    int16x8_t v740 = vqrdmulhq_n_s16(v739, 28454);
-    int16x8_t v741 = vaddq_s16(v738, v740);
-    int16x8_t v742 = vsubq_s16(v675, v677);
-    int16x8_t v743 = vsubq_s16(v679, v681);
-    int16x8_t v744 = vqrdmulhq_n_s16(v743, 30624);
-    int16x8_t v745 = vaddq_s16(v742, v744);
-    int16x8_t v746 = vsubq_s16(v664, v666);
-    int16x8_t v747 = vsubq_s16(v668, v671);
-    int16x8_t v748_tmp = vqrdmulhq_n_s16(v747, 472);
-    int16x8_t v748 = vaddq_s16(v748_tmp, v747);
-    int16x8_t v749 = vaddq_s16(v746, v748);
-    int16x8_t v750 = vsubq_s16(v653, v655);
-    int16x8_t v751 = vsubq_s16(v657, v660);
-    int16x8_t v752_tmp = vqrdmulhq_n_s16(v751, 3672);
-    int16x8_t v752 = vaddq_s16(v752_tmp, v751);
-    int16x8_t v753 = vaddq_s16(v750, v752);
-    int16x8_t v754 = vsubq_s16(v643, v645);
-    int16x8_t v755 = vsubq_s16(v647, v649);
-    int16x8_t v756_tmp = vqrdmulhq_n_s16(v755, 7662);
-    int16x8_t v756 = vaddq_s16(v756_tmp, v755);
-    int16x8_t v757 = vaddq_s16(v754, v756);
-    int16x8_t v758 = vsubq_s16(v635, v640);
-    int16x8_t v759 = vsubq_s16(v624, v629);
-    int16x8_t v760_tmp = vqrdmulhq_n_s16(v759, 12756);
-    int16x8_t v760 = vaddq_s16(v760_tmp, v759);
-    int16x8_t v761 = vaddq_s16(v758, v760);
-    int16x8_t v762 = vsubq_s16(v602, v607);
-    int16x8_t v763 = vsubq_s16(v612, v617);
-    int16x8_t v764_tmp = vqrdmulhq_n_s16(v763, 19463);
-    int16x8_t v764 = vaddq_s16(v764_tmp, v763);
-    int16x8_t v765 = vaddq_s16(v762, v764);
-    int16x8_t v766 = vsubq_s16(v585, v581);
-    int16x8_t v767 = vsubq_s16(v591, v595);
-    int16x8_t v768_tmp = vqrdmulhq_n_s16(v767, 28661);
-    int16x8_t v768 = vaddq_s16(v768_tmp, v767);
-    int16x8_t v769 = vaddq_s16(v766, v768);
-    int16x8_t v770 = vsubq_s16(v556, v561);
-    int16x8_t v771 = vsubq_s16(v566, v572);
-    int16x8_t v772_tmp = vqrdmulhq_n_s16(v771, 9242);
-    int16x8_t v772 = vmlaq_n_s16(v772_tmp, v771, 2);
-    int16x8_t v773 = vaddq_s16(v770, v772);
-    int16x8_t v774 = vsubq_s16(v513, v524);
-    int16x8_t v775 = vsubq_s16(v535, v549);
-    int16x8_t v776_tmp = vqrdmulhq_n_s16(v775, 30298);
-    int16x8_t v776 = vmlaq_n_s16(v776_tmp, v775, 2);
-    int16x8_t v777 = vaddq_s16(v774, v776);
-    int16x8_t v778 = vsubq_s16(v457, v470);
-    int16x8_t v779 = vsubq_s16(v500, v488);
-    int16x8_t v780_tmp = vqrdmulhq_n_s16(v779, 2773);
-    int16x8_t v780 = vmlaq_n_s16(v780_tmp, v779, 4);
-    int16x8_t v781 = vaddq_s16(v778, v780);
-    int16x8_t v782 = vsubq_s16(v385, v360);
-    int16x8_t v783 = vsubq_s16(v414, v443);
-    int16x8_t v784_tmp = vqrdmulhq_n_s16(v783, 26108);
-    int16x8_t v784 = vmlaq_n_s16(v784_tmp, v783, 6);
-    int16x8_t v785 = vaddq_s16(v782, v784);
-    int16x8_t v786 = vsubq_s16(v61, v142);
-    int16x8_t v787 = vsubq_s16(v238, v328);
-    int16x8_t v788_tmp = vqrdmulhq_n_s16(v787, 12251);
-    int16x8_t v788 = vmlaq_n_s16(v788_tmp, v787, 20);
-    int16x8_t v789 = vaddq_s16(v786, v788);
-    int16x8_t v790 = vsubq_s16(v786, v788);
-    int16x8_t v791 = vsubq_s16(v782, v784);
-    int16x8_t v792 = vsubq_s16(v778, v780);
-    int16x8_t v793 = vsubq_s16(v774, v776);
-    int16x8_t v794 = vsubq_s16(v770, v772);
-    int16x8_t v795 = vsubq_s16(v766, v768);
-    int16x8_t v796 = vsubq_s16(v762, v764);
-    int16x8_t v797 = vsubq_s16(v758, v760);
-    int16x8_t v798 = vsubq_s16(v754, v756);
-    int16x8_t v799 = vsubq_s16(v750, v752);
-    int16x8_t v800 = vsubq_s16(v746, v748);
-    int16x8_t v801 = vsubq_s16(v742, v744);
-    int16x8_t v802 = vsubq_s16(v738, v740);
-    int16x8_t v803 = vsubq_s16(v734, v736);
-    int16x8_t v804 = vsubq_s16(v730, v732);
-    int16x8_t v805 = vsubq_s16(v726, v728);
-    int16x8_t v806 = vsubq_s16(v719, v724);
-    int16x8_t v807 = vsubq_s16(v709, v714);
-    int16x8_t v808 = vsubq_s16(v704, v700);
-    int16x8_t v809 = vsubq_s16(v688, v694);
-    int16x8_t v810 = vsubq_s16(v678, v683);
-    int16x8_t v811 = vsubq_s16(v667, v673);
-    int16x8_t v812 = vsubq_s16(v656, v662);
-    int16x8_t v813 = vsubq_s16(v646, v651);
-    int16x8_t v814 = vsubq_s16(v641, v631);
-    int16x8_t v815 = vsubq_s16(v608, v619);
-    int16x8_t v816 = vsubq_s16(v586, v597);
-    int16x8_t v817 = vsubq_s16(v562, v574);
-    int16x8_t v818 = vsubq_s16(v525, v551);
-    int16x8_t v819 = vsubq_s16(v471, v502);
-    int16x8_t v820 = vsubq_s16(v386, v445);
-    int16x8_t v821 = vsubq_s16(v143, v330);
-    vst1q_s16(out + out_stride * 0 + i, v331);
-    vst1q_s16(out + out_stride * 1 + i, v446);
-    vst1q_s16(out + out_stride * 2 + i, v503);
-    vst1q_s16(out + out_stride * 3 + i, v552);
-    vst1q_s16(out + out_stride * 4 + i, v575);
-    vst1q_s16(out + out_stride * 5 + i, v598);
-    vst1q_s16(out + out_stride * 6 + i, v620);
-    vst1q_s16(out + out_stride * 7 + i, v642);
-    vst1q_s16(out + out_stride * 8 + i, v652);
-    vst1q_s16(out + out_stride * 9 + i, v663);
-    vst1q_s16(out + out_stride * 10 + i, v674);
-    vst1q_s16(out + out_stride * 11 + i, v684);
-    vst1q_s16(out + out_stride * 12 + i, v695);
-    vst1q_s16(out + out_stride * 13 + i, v705);
-    vst1q_s16(out + out_stride * 14 + i, v715);
-    vst1q_s16(out + out_stride * 15 + i, v725);
-    vst1q_s16(out + out_stride * 16 + i, v729);
-    vst1q_s16(out + out_stride * 17 + i, v733);
-    vst1q_s16(out + out_stride * 18 + i, v737);
-    vst1q_s16(out + out_stride * 19 + i, v741);
-    vst1q_s16(out + out_stride * 20 + i, v745);
-    vst1q_s16(out + out_stride * 21 + i, v749);
-    vst1q_s16(out + out_stride * 22 + i, v753);
-    vst1q_s16(out + out_stride * 23 + i, v757);
-    vst1q_s16(out + out_stride * 24 + i, v761);
-    vst1q_s16(out + out_stride * 25 + i, v765);
-    vst1q_s16(out + out_stride * 26 + i, v769);
-    vst1q_s16(out + out_stride * 27 + i, v773);
-    vst1q_s16(out + out_stride * 28 + i, v777);
-    vst1q_s16(out + out_stride * 29 + i, v781);
-    vst1q_s16(out + out_stride * 30 + i, v785);
-    vst1q_s16(out + out_stride * 31 + i, v789);
-    vst1q_s16(out + out_stride * 32 + i, v790);
-    vst1q_s16(out + out_stride * 33 + i, v791);
-    vst1q_s16(out + out_stride * 34 + i, v792);
-    vst1q_s16(out + out_stride * 35 + i, v793);
-    vst1q_s16(out + out_stride * 36 + i, v794);
-    vst1q_s16(out + out_stride * 37 + i, v795);
-    vst1q_s16(out + out_stride * 38 + i, v796);
-    vst1q_s16(out + out_stride * 39 + i, v797);
-    vst1q_s16(out + out_stride * 40 + i, v798);
-    vst1q_s16(out + out_stride * 41 + i, v799);
-    vst1q_s16(out + out_stride * 42 + i, v800);
-    vst1q_s16(out + out_stride * 43 + i, v801);
-    vst1q_s16(out + out_stride * 44 + i, v802);
-    vst1q_s16(out + out_stride * 45 + i, v803);
-    vst1q_s16(out + out_stride * 46 + i, v804);
-    vst1q_s16(out + out_stride * 47 + i, v805);
-    vst1q_s16(out + out_stride * 48 + i, v806);
-    vst1q_s16(out + out_stride * 49 + i, v807);
-    vst1q_s16(out + out_stride * 50 + i, v808);
-    vst1q_s16(out + out_stride * 51 + i, v809);
-    vst1q_s16(out + out_stride * 52 + i, v810);
-    vst1q_s16(out + out_stride * 53 + i, v811);
-    vst1q_s16(out + out_stride * 54 + i, v812);
-    vst1q_s16(out + out_stride * 55 + i, v813);
-    vst1q_s16(out + out_stride * 56 + i, v814);
-    vst1q_s16(out + out_stride * 57 + i, v815);
-    vst1q_s16(out + out_stride * 58 + i, v816);
-    vst1q_s16(out + out_stride * 59 + i, v817);
-    vst1q_s16(out + out_stride * 60 + i, v818);
-    vst1q_s16(out + out_stride * 61 + i, v819);
-    vst1q_s16(out + out_stride * 62 + i, v820);
-    vst1q_s16(out + out_stride * 63 + i, v821);
+  const HWY_CAPPED(int16_t, 8) d16;
+  for (size_t i = 0; i < count; i += Lanes(d16)) {
+    auto v0 = LoadU(d16, in + in_stride * 0 + i);
+    auto v1 = LoadU(d16, in + in_stride * 32 + i);
+    auto v2 = Add(v0, v1);
+    auto v3 = LoadU(d16, in + in_stride * 16 + i);
+    auto v4_tmp = MulFixedPoint15(v3, Set(d16, 13573));
+    auto v4 = Add(v4_tmp, v3);
+    auto v5 = LoadU(d16, in + in_stride * 48 + i);
+    auto v6 = Add(v5, v3);
+    auto v7 = Add(v4, v6);
+    auto v8 = MulFixedPoint15(v7, Set(d16, 17734));
+    auto v9 = Add(v2, v8);
+    auto v10 = LoadU(d16, in + in_stride * 8 + i);
+    auto v11_tmp = MulFixedPoint15(v10, Set(d16, 13573));
+    auto v11 = Add(v11_tmp, v10);
+    auto v12 = LoadU(d16, in + in_stride * 40 + i);
+    auto v13 = LoadU(d16, in + in_stride * 24 + i);
+    auto v14 = Add(v12, v13);
+    auto v15 = Add(v11, v14);
+    auto v16 = LoadU(d16, in + in_stride * 56 + i);
+    auto v17 = Add(v16, v12);
+    auto v18 = Add(v13, v10);
+    auto v19 = Add(v17, v18);
+    auto v20 = MulFixedPoint15(v19, Set(d16, 17734));
+    auto v21 = MulFixedPoint15(v18, Set(d16, 25080));
+    auto v22 = Add(v20, v21);
+    auto v23 = Add(v15, v22);
+    auto v24 = MulFixedPoint15(v23, Set(d16, 16705));
+    auto v25 = Add(v9, v24);
+    auto v26 = LoadU(d16, in + in_stride * 4 + i);
+    auto v27_tmp = MulFixedPoint15(v26, Set(d16, 13573));
+    auto v27 = Add(v27_tmp, v26);
+    auto v28 = LoadU(d16, in + in_stride * 36 + i);
+    auto v29 = LoadU(d16, in + in_stride * 28 + i);
+    auto v30 = Add(v28, v29);
+    auto v31 = Add(v27, v30);
+    auto v32 = LoadU(d16, in + in_stride * 20 + i);
+    auto v33 = LoadU(d16, in + in_stride * 12 + i);
+    auto v34 = Add(v32, v33);
+    auto v35 = MulFixedPoint15(v34, Set(d16, 25080));
+    auto v36 = LoadU(d16, in + in_stride * 52 + i);
+    auto v37 = LoadU(d16, in + in_stride * 44 + i);
+    auto v38 = Add(v36, v37);
+    auto v39 = Add(v38, v34);
+    auto v40 = MulFixedPoint15(v39, Set(d16, 17734));
+    auto v41 = Add(v35, v40);
+    auto v42 = Add(v31, v41);
+    auto v43 = Add(v33, v26);
+    auto v44_tmp = MulFixedPoint15(v43, Set(d16, 13573));
+    auto v44 = Add(v44_tmp, v43);
+    auto v45 = Add(v37, v28);
+    auto v46 = Add(v29, v32);
+    auto v47 = Add(v45, v46);
+    auto v48 = Add(v44, v47);
+    auto v49 = MulFixedPoint15(v48, Set(d16, 16705));
+    auto v50 = Add(v46, v43);
+    auto v51_tmp = MulFixedPoint15(v50, Set(d16, 10045));
+    auto v51 = Add(v51_tmp, v50);
+    auto v52 = LoadU(d16, in + in_stride * 60 + i);
+    auto v53 = Add(v52, v36);
+    auto v54 = Add(v53, v45);
+    auto v55 = MulFixedPoint15(v54, Set(d16, 17734));
+    auto v56 = Add(v51, v55);
+    auto v57 = MulFixedPoint15(v56, Set(d16, 16705));
+    auto v58 = Add(v49, v57);
+    auto v59 = Add(v42, v58);
+    auto v60 = MulFixedPoint15(v59, Set(d16, 16463));
+    auto v61 = Add(v25, v60);
+    auto v62 = LoadU(d16, in + in_stride * 2 + i);
+    auto v63_tmp = MulFixedPoint15(v62, Set(d16, 13573));
+    auto v63 = Add(v63_tmp, v62);
+    auto v64 = LoadU(d16, in + in_stride * 34 + i);
+    auto v65 = LoadU(d16, in + in_stride * 30 + i);
+    auto v66 = Add(v64, v65);
+    auto v67 = Add(v63, v66);
+    auto v68 = LoadU(d16, in + in_stride * 18 + i);
+    auto v69 = LoadU(d16, in + in_stride * 14 + i);
+    auto v70 = Add(v68, v69);
+    auto v71 = MulFixedPoint15(v70, Set(d16, 25080));
+    auto v72 = LoadU(d16, in + in_stride * 50 + i);
+    auto v73 = LoadU(d16, in + in_stride * 46 + i);
+    auto v74 = Add(v72, v73);
+    auto v75 = Add(v74, v70);
+    auto v76 = MulFixedPoint15(v75, Set(d16, 17734));
+    auto v77 = Add(v71, v76);
+    auto v78 = Add(v67, v77);
+    auto v79 = LoadU(d16, in + in_stride * 10 + i);
+    auto v80 = LoadU(d16, in + in_stride * 6 + i);
+    auto v81 = Add(v79, v80);
+    auto v82_tmp = MulFixedPoint15(v81, Set(d16, 13573));
+    auto v82 = Add(v82_tmp, v81);
+    auto v83 = LoadU(d16, in + in_stride * 42 + i);
+    auto v84 = LoadU(d16, in + in_stride * 38 + i);
+    auto v85 = Add(v83, v84);
+    auto v86 = LoadU(d16, in + in_stride * 26 + i);
+    auto v87 = LoadU(d16, in + in_stride * 22 + i);
+    auto v88 = Add(v86, v87);
+    auto v89 = Add(v85, v88);
+    auto v90 = Add(v82, v89);
+    auto v91 = MulFixedPoint15(v90, Set(d16, 16705));
+    auto v92 = Add(v88, v81);
+    auto v93_tmp = MulFixedPoint15(v92, Set(d16, 10045));
+    auto v93 = Add(v93_tmp, v92);
+    auto v94 = LoadU(d16, in + in_stride * 58 + i);
+    auto v95 = LoadU(d16, in + in_stride * 54 + i);
+    auto v96 = Add(v94, v95);
+    auto v97 = Add(v96, v85);
+    auto v98 = MulFixedPoint15(v97, Set(d16, 17734));
+    auto v99 = Add(v93, v98);
+    auto v100 = MulFixedPoint15(v99, Set(d16, 16705));
+    auto v101 = Add(v91, v100);
+    auto v102 = Add(v78, v101);
+    auto v103 = Add(v69, v79);
+    auto v104 = Add(v80, v62);
+    auto v105 = Add(v103, v104);
+    auto v106_tmp = MulFixedPoint15(v105, Set(d16, 13573));
+    auto v106 = Add(v106_tmp, v105);
+    auto v107 = Add(v73, v83);
+    auto v108 = Add(v84, v64);
+    auto v109 = Add(v107, v108);
+    auto v110 = Add(v65, v86);
+    auto v111 = Add(v87, v68);
+    auto v112 = Add(v110, v111);
+    auto v113 = Add(v109, v112);
+    auto v114 = Add(v106, v113);
+    auto v115 = MulFixedPoint15(v114, Set(d16, 16705));
+    auto v116 = Add(v112, v105);
+    auto v117 = MulFixedPoint15(v116, Set(d16, 25080));
+    auto v118 = MulFixedPoint15(v116, Set(d16, 17734));
+    auto v119 = LoadU(d16, in + in_stride * 62 + i);
+    auto v120 = Add(v119, v94);
+    auto v121 = Add(v95, v72);
+    auto v122 = Add(v120, v121);
+    auto v123 = Add(v122, v109);
+    auto v124 = MulFixedPoint15(v123, Set(d16, 17734));
+    auto v125 = Add(v118, v124);
+    auto v126 = Add(v117, v125);
+    auto v127 = MulFixedPoint15(v126, Set(d16, 16705));
+    auto v128 = Add(v115, v127);
+    auto v129 = MulFixedPoint15(v128, Set(d16, 16463));
+    auto v130_tmp = MulFixedPoint15(v104, Set(d16, 13573));
+    auto v130 = Add(v130_tmp, v104);
+    auto v131 = Add(v108, v110);
+    auto v132 = Add(v130, v131);
+    auto v133 = Add(v111, v103);
+    auto v134_tmp = MulFixedPoint15(v133, Set(d16, 10045));
+    auto v134 = Add(v134_tmp, v133);
+    auto v135 = Add(v121, v107);
+    auto v136 = MulFixedPoint15(v135, Set(d16, 17734));
+    auto v137 = Add(v134, v136);
+    auto v138 = Add(v132, v137);
+    auto v139 = MulFixedPoint15(v138, Set(d16, 16463));
+    auto v140 = Add(v129, v139);
+    auto v141 = Add(v102, v140);
+    auto v142 = MulFixedPoint15(v141, Set(d16, 16404));
+    auto v143 = Add(v61, v142);
+    auto v144 = LoadU(d16, in + in_stride * 1 + i);
+    auto v145_tmp = MulFixedPoint15(v144, Set(d16, 13573));
+    auto v145 = Add(v145_tmp, v144);
+    auto v146 = LoadU(d16, in + in_stride * 33 + i);
+    auto v147 = LoadU(d16, in + in_stride * 31 + i);
+    auto v148 = Add(v146, v147);
+    auto v149 = Add(v145, v148);
+    auto v150 = LoadU(d16, in + in_stride * 17 + i);
+    auto v151 = LoadU(d16, in + in_stride * 15 + i);
+    auto v152 = Add(v150, v151);
+    auto v153 = MulFixedPoint15(v152, Set(d16, 25080));
+    auto v154 = LoadU(d16, in + in_stride * 49 + i);
+    auto v155 = LoadU(d16, in + in_stride * 47 + i);
+    auto v156 = Add(v154, v155);
+    auto v157 = Add(v156, v152);
+    auto v158 = MulFixedPoint15(v157, Set(d16, 17734));
+    auto v159 = Add(v153, v158);
+    auto v160 = Add(v149, v159);
+    auto v161 = LoadU(d16, in + in_stride * 9 + i);
+    auto v162 = LoadU(d16, in + in_stride * 7 + i);
+    auto v163 = Add(v161, v162);
+    auto v164_tmp = MulFixedPoint15(v163, Set(d16, 13573));
+    auto v164 = Add(v164_tmp, v163);
+    auto v165 = LoadU(d16, in + in_stride * 41 + i);
+    auto v166 = LoadU(d16, in + in_stride * 39 + i);
+    auto v167 = Add(v165, v166);
+    auto v168 = LoadU(d16, in + in_stride * 25 + i);
+    auto v169 = LoadU(d16, in + in_stride * 23 + i);
+    auto v170 = Add(v168, v169);
+    auto v171 = Add(v167, v170);
+    auto v172 = Add(v164, v171);
+    auto v173 = MulFixedPoint15(v172, Set(d16, 16705));
+    auto v174 = Add(v170, v163);
+    auto v175_tmp = MulFixedPoint15(v174, Set(d16, 10045));
+    auto v175 = Add(v175_tmp, v174);
+    auto v176 = LoadU(d16, in + in_stride * 57 + i);
+    auto v177 = LoadU(d16, in + in_stride * 55 + i);
+    auto v178 = Add(v176, v177);
+    auto v179 = Add(v178, v167);
+    auto v180 = MulFixedPoint15(v179, Set(d16, 17734));
+    auto v181 = Add(v175, v180);
+    auto v182 = MulFixedPoint15(v181, Set(d16, 16705));
+    auto v183 = Add(v173, v182);
+    auto v184 = Add(v160, v183);
+    auto v185 = LoadU(d16, in + in_stride * 37 + i);
+    auto v186 = LoadU(d16, in + in_stride * 35 + i);
+    auto v187 = Add(v185, v186);
+    auto v188 = LoadU(d16, in + in_stride * 45 + i);
+    auto v189 = LoadU(d16, in + in_stride * 43 + i);
+    auto v190 = Add(v188, v189);
+    auto v191 = Add(v187, v190);
+    auto v192 = LoadU(d16, in + in_stride * 29 + i);
+    auto v193 = LoadU(d16, in + in_stride * 27 + i);
+    auto v194 = Add(v192, v193);
+    auto v195 = LoadU(d16, in + in_stride * 21 + i);
+    auto v196 = LoadU(d16, in + in_stride * 19 + i);
+    auto v197 = Add(v195, v196);
+    auto v198 = Add(v194, v197);
+    auto v199 = Add(v191, v198);
+    auto v200 = LoadU(d16, in + in_stride * 5 + i);
+    auto v201 = LoadU(d16, in + in_stride * 3 + i);
+    auto v202 = Add(v200, v201);
+    auto v203 = LoadU(d16, in + in_stride * 13 + i);
+    auto v204 = LoadU(d16, in + in_stride * 11 + i);
+    auto v205 = Add(v203, v204);
+    auto v206 = Add(v202, v205);
+    auto v207_tmp = MulFixedPoint15(v206, Set(d16, 13573));
+    auto v207 = Add(v207_tmp, v206);
+    auto v208 = Add(v199, v207);
+    auto v209 = MulFixedPoint15(v208, Set(d16, 16705));
+    auto v210 = Add(v198, v206);
+    auto v211 = MulFixedPoint15(v210, Set(d16, 25080));
+    auto v212 = MulFixedPoint15(v210, Set(d16, 17734));
+    auto v213 = LoadU(d16, in + in_stride * 53 + i);
+    auto v214 = LoadU(d16, in + in_stride * 51 + i);
+    auto v215 = Add(v213, v214);
+    auto v216 = LoadU(d16, in + in_stride * 61 + i);
+    auto v217 = LoadU(d16, in + in_stride * 59 + i);
+    auto v218 = Add(v216, v217);
+    auto v219 = Add(v215, v218);
+    auto v220 = Add(v219, v191);
+    auto v221 = MulFixedPoint15(v220, Set(d16, 17734));
+    auto v222 = Add(v212, v221);
+    auto v223 = Add(v211, v222);
+    auto v224 = MulFixedPoint15(v223, Set(d16, 16705));
+    auto v225 = Add(v209, v224);
+    auto v226 = MulFixedPoint15(v225, Set(d16, 16463));
+    auto v227_tmp = MulFixedPoint15(v202, Set(d16, 13573));
+    auto v227 = Add(v227_tmp, v202);
+    auto v228 = Add(v187, v194);
+    auto v229 = Add(v227, v228);
+    auto v230 = Add(v215, v190);
+    auto v231 = MulFixedPoint15(v230, Set(d16, 17734));
+    auto v232 = Add(v197, v205);
+    auto v233_tmp = MulFixedPoint15(v232, Set(d16, 10045));
+    auto v233 = Add(v233_tmp, v232);
+    auto v234 = Add(v231, v233);
+    auto v235 = Add(v229, v234);
+    auto v236 = MulFixedPoint15(v235, Set(d16, 16463));
+    auto v237 = Add(v226, v236);
+    auto v238 = Add(v184, v237);
+    auto v239 = Add(v201, v144);
+    auto v240_tmp = MulFixedPoint15(v239, Set(d16, 13573));
+    auto v240 = Add(v240_tmp, v239);
+    auto v241 = Add(v186, v146);
+    auto v242 = Add(v147, v192);
+    auto v243 = Add(v241, v242);
+    auto v244 = Add(v240, v243);
+    auto v245 = Add(v196, v150);
+    auto v246 = Add(v151, v203);
+    auto v247 = Add(v245, v246);
+    auto v248_tmp = MulFixedPoint15(v247, Set(d16, 10045));
+    auto v248 = Add(v248_tmp, v247);
+    auto v249 = Add(v155, v188);
+    auto v250 = Add(v214, v154);
+    auto v251 = Add(v249, v250);
+    auto v252 = MulFixedPoint15(v251, Set(d16, 17734));
+    auto v253 = Add(v248, v252);
+    auto v254 = Add(v244, v253);
+    auto v255 = Add(v204, v161);
+    auto v256 = Add(v162, v200);
+    auto v257 = Add(v255, v256);
+    auto v258_tmp = MulFixedPoint15(v257, Set(d16, 13573));
+    auto v258 = Add(v258_tmp, v257);
+    auto v259 = Add(v189, v165);
+    auto v260 = Add(v166, v185);
+    auto v261 = Add(v259, v260);
+    auto v262 = Add(v169, v195);
+    auto v263 = Add(v193, v168);
+    auto v264 = Add(v262, v263);
+    auto v265 = Add(v261, v264);
+    auto v266 = Add(v258, v265);
+    auto v267 = MulFixedPoint15(v266, Set(d16, 16705));
+    auto v268 = Add(v264, v257);
+    auto v269 = MulFixedPoint15(v268, Set(d16, 25080));
+    auto v270 = Add(v217, v176);
+    auto v271 = Add(v177, v213);
+    auto v272 = Add(v270, v271);
+    auto v273 = Add(v272, v261);
+    auto v274 = MulFixedPoint15(v273, Set(d16, 17734));
+    auto v275 = MulFixedPoint15(v268, Set(d16, 17734));
+    auto v276 = Add(v274, v275);
+    auto v277 = Add(v269, v276);
+    auto v278 = MulFixedPoint15(v277, Set(d16, 16705));
+    auto v279 = Add(v267, v278);
+    auto v280 = Add(v254, v279);
+    auto v281 = MulFixedPoint15(v280, Set(d16, 16404));
+    auto v282 = Add(v256, v239);
+    auto v283_tmp = MulFixedPoint15(v282, Set(d16, 13573));
+    auto v283 = Add(v283_tmp, v282);
+    auto v284 = Add(v260, v241);
+    auto v285 = Add(v242, v263);
+    auto v286 = Add(v284, v285);
+    auto v287 = Add(v283, v286);
+    auto v288 = Add(v262, v245);
+    auto v289 = Add(v246, v255);
+    auto v290 = Add(v288, v289);
+    auto v291 = MulFixedPoint15(v290, Set(d16, 25080));
+    auto v292 = MulFixedPoint15(v290, Set(d16, 17734));
+    auto v293 = Add(v271, v250);
+    auto v294 = Add(v249, v259);
+    auto v295 = Add(v293, v294);
+    auto v296 = MulFixedPoint15(v295, Set(d16, 17734));
+    auto v297 = Add(v292, v296);
+    auto v298 = Add(v291, v297);
+    auto v299 = Add(v287, v298);
+    auto v300 = MulFixedPoint15(v299, Set(d16, 16463));
+    auto v301 = Add(v289, v282);
+    auto v302 = MulFixedPoint15(v301, Set(d16, 23624));
+    auto v303 = Add(v294, v284);
+    auto v304 = MulFixedPoint15(v303, Set(d16, 19705));
+    auto v305 = Add(v285, v288);
+    auto v306 = MulFixedPoint15(v305, Set(d16, 19705));
+    auto v307 = Add(v304, v306);
+    auto v308 = MulFixedPoint15(v307, Set(d16, 27779));
+    auto v309 = Add(v302, v308);
+    auto v310 = Add(v305, v301);
+    auto v311 = MulFixedPoint15(v310, Set(d16, 25080));
+    auto v312 = MulFixedPoint15(v310, Set(d16, 17734));
+    auto v313 = LoadU(d16, in + in_stride * 63 + i);
+    auto v314 = Add(v313, v216);
+    auto v315 = Add(v314, v270);
+    auto v316 = Add(v315, v293);
+    auto v317 = MulFixedPoint15(v316, Set(d16, 25746));
+    auto v318 = MulFixedPoint15(v303, Set(d16, 25746));
+    auto v319 = Add(v317, v318);
+    auto v320 = MulFixedPoint15(v319, Set(d16, 22571));
+    auto v321 = Add(v312, v320);
+    auto v322 = Add(v311, v321);
+    auto v323 = MulFixedPoint15(v322, Set(d16, 16705));
+    auto v324 = Add(v309, v323);
+    auto v325 = MulFixedPoint15(v324, Set(d16, 16463));
+    auto v326 = Add(v300, v325);
+    auto v327 = MulFixedPoint15(v326, Set(d16, 16404));
+    auto v328 = Add(v281, v327);
+    auto v329 = Add(v238, v328);
+    auto v330 = MulFixedPoint15(v329, Set(d16, 16389));
+    auto v331 = Add(v143, v330);
+    auto v332 = Sub(v82, v89);
+    auto v333 = MulFixedPoint15(v332, Set(d16, 19705));
+    auto v334 = MulFixedPoint15(v92, Set(d16, 13573));
+    auto v335 = Sub(v334, v97);
+    auto v336 = MulFixedPoint15(v335, Set(d16, 25746));
+    auto v337 = Add(v333, v336);
+    auto v338 = Sub(v63, v66);
+    auto v339 = MulFixedPoint15(v70, Set(d16, 17734));
+    auto v340_tmp = MulFixedPoint15(v74, Set(d16, 10045));
+    auto v340 = Add(v340_tmp, v74);
+    auto v341 = Sub(v339, v340);
+    auto v342 = Add(v338, v341);
+    auto v343 = Add(v337, v342);
+    auto v344 = Sub(v130, v131);
+    auto v345 = MulFixedPoint15(v133, Set(d16, 13573));
+    auto v346 = Sub(v345, v135);
+    auto v347_tmp = MulFixedPoint15(v346, Set(d16, 10045));
+    auto v347 = Add(v347_tmp, v346);
+    auto v348 = Add(v344, v347);
+    auto v349 = MulFixedPoint15(v348, Set(d16, 17121));
+    auto v350 = MulFixedPoint15(v105, Set(d16, 27867));
+    auto v351 = MulFixedPoint15(v113, Set(d16, 19705));
+    auto v352 = Sub(v350, v351);
+    auto v353 = MulFixedPoint15(v116, Set(d16, 13573));
+    auto v354 = Sub(v353, v123);
+    auto v355 = MulFixedPoint15(v354, Set(d16, 25746));
+    auto v356 = Add(v352, v355);
+    auto v357 = MulFixedPoint15(v356, Set(d16, 17121));
+    auto v358 = Add(v349, v357);
+    auto v359 = Add(v343, v358);
+    auto v360 = MulFixedPoint15(v359, Set(d16, 16563));
+    auto v361 = Sub(v27, v30);
+    auto v362 = MulFixedPoint15(v34, Set(d16, 17734));
+    auto v363_tmp = MulFixedPoint15(v38, Set(d16, 10045));
+    auto v363 = Add(v363_tmp, v38);
+    auto v364 = Sub(v362, v363);
+    auto v365 = Add(v361, v364);
+    auto v366 = Sub(v44, v47);
+    auto v367 = MulFixedPoint15(v366, Set(d16, 19705));
+    auto v368 = MulFixedPoint15(v50, Set(d16, 13573));
+    auto v369 = Sub(v368, v54);
+    auto v370 = MulFixedPoint15(v369, Set(d16, 25746));
+    auto v371 = Add(v367, v370);
+    auto v372 = Add(v365, v371);
+    auto v373 = MulFixedPoint15(v372, Set(d16, 17121));
+    auto v374 = Sub(v0, v1);
+    auto v375 = Sub(v4, v6);
+    auto v376_tmp = MulFixedPoint15(v375, Set(d16, 10045));
+    auto v376 = Add(v376_tmp, v375);
+    auto v377 = Add(v374, v376);
+    auto v378 = Sub(v11, v14);
+    auto v379 = MulFixedPoint15(v18, Set(d16, 17734));
+    auto v380_tmp = MulFixedPoint15(v17, Set(d16, 10045));
+    auto v380 = Add(v380_tmp, v17);
+    auto v381 = Sub(v379, v380);
+    auto v382 = Add(v378, v381);
+    auto v383 = MulFixedPoint15(v382, Set(d16, 19705));
+    auto v384 = Add(v377, v383);
+    auto v385 = Add(v373, v384);
+    auto v386 = Add(v360, v385);
+    auto v387 = Sub(v145, v148);
+    auto v388 = MulFixedPoint15(v152, Set(d16, 17734));
+    auto v389_tmp = MulFixedPoint15(v156, Set(d16, 10045));
+    auto v389 = Add(v389_tmp, v156);
+    auto v390 = Sub(v388, v389);
+    auto v391 = Add(v387, v390);
+    auto v392 = Sub(v164, v171);
+    auto v393 = MulFixedPoint15(v392, Set(d16, 19705));
+    auto v394 = MulFixedPoint15(v174, Set(d16, 13573));
+    auto v395 = Sub(v394, v179);
+    auto v396 = MulFixedPoint15(v395, Set(d16, 25746));
+    auto v397 = Add(v393, v396);
+    auto v398 = Add(v391, v397);
+    auto v399 = Sub(v227, v228);
+    auto v400 = MulFixedPoint15(v232, Set(d16, 13573));
+    auto v401 = Sub(v400, v230);
+    auto v402_tmp = MulFixedPoint15(v401, Set(d16, 10045));
+    auto v402 = Add(v402_tmp, v401);
+    auto v403 = Add(v399, v402);
+    auto v404 = MulFixedPoint15(v403, Set(d16, 17121));
+    auto v405 = MulFixedPoint15(v206, Set(d16, 27867));
+    auto v406 = MulFixedPoint15(v199, Set(d16, 19705));
+    auto v407 = Sub(v405, v406);
+    auto v408 = MulFixedPoint15(v210, Set(d16, 13573));
+    auto v409 = Sub(v408, v220);
+    auto v410 = MulFixedPoint15(v409, Set(d16, 25746));
+    auto v411 = Add(v407, v410);
+    auto v412 = MulFixedPoint15(v411, Set(d16, 17121));
+    auto v413 = Add(v404, v412);
+    auto v414 = Add(v398, v413);
+    auto v415 = Sub(v240, v243);
+    auto v416 = MulFixedPoint15(v247, Set(d16, 13573));
+    auto v417 = Sub(v416, v251);
+    auto v418_tmp = MulFixedPoint15(v417, Set(d16, 10045));
+    auto v418 = Add(v418_tmp, v417);
+    auto v419 = Add(v415, v418);
+    auto v420 = MulFixedPoint15(v257, Set(d16, 27867));
+    auto v421 = MulFixedPoint15(v265, Set(d16, 19705));
+    auto v422 = Sub(v420, v421);
+    auto v423 = MulFixedPoint15(v268, Set(d16, 13573));
+    auto v424 = Sub(v423, v273);
+    auto v425 = MulFixedPoint15(v424, Set(d16, 25746));
+    auto v426 = Add(v422, v425);
+    auto v427 = Add(v419, v426);
+    auto v428 = MulFixedPoint15(v427, Set(d16, 16563));
+    auto v429 = MulFixedPoint15(v301, Set(d16, 27867));
+    auto v430 = Sub(v429, v307);
+    auto v431 = MulFixedPoint15(v310, Set(d16, 10664));
+    auto v432 = Sub(v431, v319);
+    auto v433 = Add(v430, v432);
+    auto v434 = MulFixedPoint15(v433, Set(d16, 17121));
+    auto v435 = Sub(v283, v286);
+    auto v436 = MulFixedPoint15(v290, Set(d16, 13573));
+    auto v437 = Sub(v436, v295);
+    auto v438_tmp = MulFixedPoint15(v437, Set(d16, 10045));
+    auto v438 = Add(v438_tmp, v437);
+    auto v439 = Add(v435, v438);
+    auto v440 = MulFixedPoint15(v439, Set(d16, 17121));
+    auto v441 = Add(v434, v440);
+    auto v442 = MulFixedPoint15(v441, Set(d16, 16563));
+    auto v443 = Add(v428, v442);
+    auto v444 = Add(v414, v443);
+    auto v445 = MulFixedPoint15(v444, Set(d16, 16429));
+    auto v446 = Add(v386, v445);
+    auto v447 = Sub(v374, v376);
+    auto v448 = Sub(v378, v381);
+    auto v449 = MulFixedPoint15(v448, Set(d16, 29490));
+    auto v450 = Add(v447, v449);
+    auto v451 = Sub(v361, v364);
+    auto v452 = MulFixedPoint15(v366, Set(d16, 29490));
+    auto v453_tmp = MulFixedPoint15(v369, Set(d16, 5763));
+    auto v453 = Add(v453_tmp, v369);
+    auto v454 = Sub(v452, v453);
+    auto v455 = Add(v451, v454);
+    auto v456 = MulFixedPoint15(v455, Set(d16, 18578));
+    auto v457 = Add(v450, v456);
+    auto v458 = Sub(v338, v341);
+    auto v459 = MulFixedPoint15(v332, Set(d16, 29490));
+    auto v460_tmp = MulFixedPoint15(v335, Set(d16, 5763));
+    auto v460 = Add(v460_tmp, v335);
+    auto v461 = Sub(v459, v460);
+    auto v462 = Add(v458, v461);
+    auto v463 = MulFixedPoint15(v352, Set(d16, 27803));
+    auto v464 = MulFixedPoint15(v354, Set(d16, 21845));
+    auto v465 = Sub(v463, v464);
+    auto v466 = Sub(v344, v347);
+    auto v467 = MulFixedPoint15(v466, Set(d16, 18578));
+    auto v468 = Add(v465, v467);
+    auto v469 = Add(v462, v468);
+    auto v470 = MulFixedPoint15(v469, Set(d16, 16890));
+    auto v471 = Add(v457, v470);
+    auto v472 = Sub(v415, v418);
+    auto v473_tmp = MulFixedPoint15(v422, Set(d16, 16273));
+    auto v473 = Add(v473_tmp, v422);
+    auto v474_tmp = MulFixedPoint15(v424, Set(d16, 5763));
+    auto v474 = Add(v474_tmp, v424);
+    auto v475 = Sub(v473, v474);
+    auto v476 = Add(v472, v475);
+    auto v477 = MulFixedPoint15(v476, Set(d16, 16890));
+    auto v478 = MulFixedPoint15(v435, Set(d16, 20261));
+    auto v479 = MulFixedPoint15(v437, Set(d16, 26472));
+    auto v480 = Sub(v478, v479);
+    auto v481 = MulFixedPoint15(v480, Set(d16, 30046));
+    auto v482 = MulFixedPoint15(v430, Set(d16, 30322));
+    auto v483 = MulFixedPoint15(v432, Set(d16, 30322));
+    auto v484 = Sub(v482, v483);
+    auto v485 = MulFixedPoint15(v484, Set(d16, 30046));
+    auto v486 = Add(v481, v485);
+    auto v487 = MulFixedPoint15(v486, Set(d16, 16890));
+    auto v488 = Add(v477, v487);
+    auto v489 = Sub(v387, v390);
+    auto v490 = MulFixedPoint15(v392, Set(d16, 29490));
+    auto v491_tmp = MulFixedPoint15(v395, Set(d16, 5763));
+    auto v491 = Add(v491_tmp, v395);
+    auto v492 = Sub(v490, v491);
+    auto v493 = Add(v489, v492);
+    auto v494 = Sub(v399, v402);
+    auto v495 = MulFixedPoint15(v494, Set(d16, 18578));
+    auto v496 = MulFixedPoint15(v407, Set(d16, 27803));
+    auto v497 = MulFixedPoint15(v409, Set(d16, 21845));
+    auto v498 = Sub(v496, v497);
+    auto v499 = Add(v495, v498);
+    auto v500 = Add(v493, v499);
+    auto v501 = Add(v488, v500);
+    auto v502 = MulFixedPoint15(v501, Set(d16, 16508));
+    auto v503 = Add(v471, v502);
+    auto v504 = Sub(v2, v8);
+    auto v505 = Sub(v15, v22);
+    auto v506_tmp = MulFixedPoint15(v505, Set(d16, 18446));
+    auto v506 = Add(v506_tmp, Mul(v505, Set(d16, 2)));
+    auto v507 = Add(v504, v506);
+    auto v508 = Sub(v31, v41);
+    auto v509 = Sub(v48, v56);
+    auto v510_tmp = MulFixedPoint15(v509, Set(d16, 18446));
+    auto v510 = Add(v510_tmp, Mul(v509, Set(d16, 2)));
+    auto v511 = Add(v508, v510);
+    auto v512 = MulFixedPoint15(v511, Set(d16, 21195));
+    auto v513 = Add(v507, v512);
+    auto v514 = Sub(v67, v77);
+    auto v515 = Sub(v90, v99);
+    auto v516_tmp = MulFixedPoint15(v515, Set(d16, 18446));
+    auto v516 = Add(v516_tmp, Mul(v515, Set(d16, 2)));
+    auto v517 = Add(v514, v516);
+    auto v518 = Sub(v114, v126);
+    auto v519_tmp = MulFixedPoint15(v518, Set(d16, 18446));
+    auto v519 = Add(v519_tmp, Mul(v518, Set(d16, 2)));
+    auto v520 = Sub(v132, v137);
+    auto v521 = Add(v519, v520);
+    auto v522 = MulFixedPoint15(v521, Set(d16, 21195));
+    auto v523 = Add(v517, v522);
+    auto v524 = MulFixedPoint15(v523, Set(d16, 17401));
+    auto v525 = Add(v513, v524);
+    auto v526 = Sub(v172, v181);
+    auto v527_tmp = MulFixedPoint15(v526, Set(d16, 18446));
+    auto v527 = Add(v527_tmp, Mul(v526, Set(d16, 2)));
+    auto v528 = Sub(v149, v159);
+    auto v529 = Add(v527, v528);
+    auto v530 = Sub(v229, v234);
+    auto v531 = Sub(v208, v223);
+    auto v532_tmp = MulFixedPoint15(v531, Set(d16, 18446));
+    auto v532 = Add(v532_tmp, Mul(v531, Set(d16, 2)));
+    auto v533 = Add(v530, v532);
+    auto v534 = MulFixedPoint15(v533, Set(d16, 21195));
+    auto v535 = Add(v529, v534);
+    auto v536 = Sub(v244, v253);
+    auto v537 = Sub(v266, v277);
+    auto v538_tmp = MulFixedPoint15(v537, Set(d16, 18446));
+    auto v538 = Add(v538_tmp, Mul(v537, Set(d16, 2)));
+    auto v539 = Add(v536, v538);
+    auto v540 = MulFixedPoint15(v539, Set(d16, 17401));
+    auto v541 = MulFixedPoint15(v287, Set(d16, 25826));
+    auto v542 = MulFixedPoint15(v298, Set(d16, 25826));
+    auto v543 = Sub(v541, v542);
+    auto v544 = MulFixedPoint15(v543, Set(d16, 14281));
+    auto v545_tmp = MulFixedPoint15(v309, Set(d16, 31509));
+    auto v545 = Add(v545_tmp, v309);
+    auto v546 = Sub(v545, v322);
+    auto v547 = MulFixedPoint15(v546, Set(d16, 28847));
+    auto v548 = Add(v544, v547);
+    auto v549 = Add(v540, v548);
+    auto v550 = Add(v535, v549);
+    auto v551 = MulFixedPoint15(v550, Set(d16, 16629));
+    auto v552 = Add(v525, v551);
+    auto v553 = Sub(v504, v506);
+    auto v554 = Sub(v508, v510);
+    auto v555 = MulFixedPoint15(v554, Set(d16, 25826));
+    auto v556 = Add(v553, v555);
+    auto v557 = Sub(v514, v516);
+    auto v558 = Sub(v520, v519);
+    auto v559 = MulFixedPoint15(v558, Set(d16, 25826));
+    auto v560 = Add(v557, v559);
+    auto v561 = MulFixedPoint15(v560, Set(d16, 18124));
+    auto v562 = Add(v556, v561);
+    auto v563 = Sub(v528, v527);
+    auto v564 = Sub(v530, v532);
+    auto v565 = MulFixedPoint15(v564, Set(d16, 25826));
+    auto v566 = Add(v563, v565);
+    auto v567 = Sub(v536, v538);
+    auto v568 = MulFixedPoint15(v567, Set(d16, 18124));
+    auto v569_tmp = MulFixedPoint15(v546, Set(d16, 654));
+    auto v569 = Add(v569_tmp, Mul(v546, Set(d16, 2)));
+    auto v570 = Sub(v543, v569);
+    auto v571 = MulFixedPoint15(v570, Set(d16, 18124));
+    auto v572 = Add(v568, v571);
+    auto v573 = Add(v566, v572);
+    auto v574 = MulFixedPoint15(v573, Set(d16, 16792));
+    auto v575 = Add(v562, v574);
+    auto v576 = Sub(v458, v461);
+    auto v577_tmp = MulFixedPoint15(v465, Set(d16, 25030));
+    auto v577 = Add(v577_tmp, v465);
+    auto v578 = Sub(v466, v577);
+    auto v579_tmp = MulFixedPoint15(v578, Set(d16, 1988));
+    auto v579 = Add(v579_tmp, v578);
+    auto v580 = Add(v576, v579);
+    auto v581 = MulFixedPoint15(v580, Set(d16, 19102));
+    auto v582 = Sub(v447, v449);
+    auto v583 = Sub(v451, v454);
+    auto v584_tmp = MulFixedPoint15(v583, Set(d16, 1988));
+    auto v584 = Add(v584_tmp, v583);
+    auto v585 = Add(v582, v584);
+    auto v586 = Add(v581, v585);
+    auto v587 = Sub(v489, v492);
+    auto v588_tmp = MulFixedPoint15(v498, Set(d16, 25030));
+    auto v588 = Add(v588_tmp, v498);
+    auto v589 = Sub(v494, v588);
+    auto v590_tmp = MulFixedPoint15(v589, Set(d16, 1988));
+    auto v590 = Add(v590_tmp, v589);
+    auto v591 = Add(v587, v590);
+    auto v592 = Sub(v472, v475);
+    auto v593 = MulFixedPoint15(v592, Set(d16, 19102));
+    auto v594 = Sub(v480, v484);
+    auto v595 = Add(v593, v594);
+    auto v596 = Add(v591, v595);
+    auto v597 = MulFixedPoint15(v596, Set(d16, 17000));
+    auto v598 = Add(v586, v597);
+    auto v599 = Sub(v365, v371);
+    auto v600_tmp = MulFixedPoint15(v599, Set(d16, 23673));
+    auto v600 = Add(v600_tmp, v599);
+    auto v601 = Sub(v377, v383);
+    auto v602 = Add(v600, v601);
+    auto v603 = Sub(v348, v356);
+    auto v604_tmp = MulFixedPoint15(v603, Set(d16, 23673));
+    auto v604 = Add(v604_tmp, v603);
+    auto v605 = Sub(v342, v337);
+    auto v606 = Add(v604, v605);
+    auto v607 = MulFixedPoint15(v606, Set(d16, 20398));
+    auto v608 = Add(v602, v607);
+    auto v609 = Sub(v391, v397);
+    auto v610 = Sub(v403, v411);
+    auto v611_tmp = MulFixedPoint15(v610, Set(d16, 23673));
+    auto v611 = Add(v611_tmp, v610);
+    auto v612 = Add(v609, v611);
+    auto v613 = Sub(v419, v426);
+    auto v614 = MulFixedPoint15(v613, Set(d16, 20398));
+    auto v615 = Sub(v439, v433);
+    auto v616_tmp = MulFixedPoint15(v615, Set(d16, 2367));
+    auto v616 = Add(v616_tmp, v615);
+    auto v617 = Add(v614, v616);
+    auto v618 = Add(v612, v617);
+    auto v619 = MulFixedPoint15(v618, Set(d16, 17255));
+    auto v620 = Add(v608, v619);
+    auto v621 = Sub(v160, v183);
+    auto v622 = Sub(v235, v225);
+    auto v623_tmp = MulFixedPoint15(v622, Set(d16, 3314));
+    auto v623 = Add(v623_tmp, Mul(v622, Set(d16, 5)));
+    auto v624 = Add(v621, v623);
+    auto v625 = Sub(v254, v279);
+    auto v626 = Sub(v299, v324);
+    auto v627_tmp = MulFixedPoint15(v626, Set(d16, 3314));
+    auto v627 = Add(v627_tmp, Mul(v626, Set(d16, 5)));
+    auto v628 = Add(v625, v627);
+    auto v629 = MulFixedPoint15(v628, Set(d16, 22112));
+    auto v630 = Add(v624, v629);
+    auto v631 = MulFixedPoint15(v630, Set(d16, 17561));
+    auto v632 = Sub(v9, v24);
+    auto v633 = Sub(v42, v58);
+    auto v634_tmp = MulFixedPoint15(v633, Set(d16, 3314));
+    auto v634 = Add(v634_tmp, Mul(v633, Set(d16, 5)));
+    auto v635 = Add(v632, v634);
+    auto v636 = Sub(v78, v101);
+    auto v637 = Sub(v138, v128);
+    auto v638_tmp = MulFixedPoint15(v637, Set(d16, 3314));
+    auto v638 = Add(v638_tmp, Mul(v637, Set(d16, 5)));
+    auto v639 = Add(v636, v638);
+    auto v640 = MulFixedPoint15(v639, Set(d16, 22112));
+    auto v641 = Add(v635, v640);
+    auto v642 = Add(v631, v641);
+    auto v643 = Sub(v632, v634);
+    auto v644 = Sub(v636, v638);
+    auto v645 = MulFixedPoint15(v644, Set(d16, 24397));
+    auto v646 = Add(v643, v645);
+    auto v647 = Sub(v621, v623);
+    auto v648 = Sub(v625, v627);
+    auto v649 = MulFixedPoint15(v648, Set(d16, 24397));
+    auto v650 = Add(v647, v649);
+    auto v651 = MulFixedPoint15(v650, Set(d16, 17921));
+    auto v652 = Add(v646, v651);
+    auto v653 = Sub(v601, v600);
+    auto v654 = Sub(v605, v604);
+    auto v655 = MulFixedPoint15(v654, Set(d16, 27504));
+    auto v656 = Add(v653, v655);
+    auto v657 = Sub(v609, v611);
+    auto v658 = MulFixedPoint15(v613, Set(d16, 27504));
+    auto v659_tmp = MulFixedPoint15(v615, Set(d16, 14606));
+    auto v659 = Add(v659_tmp, v615);
+    auto v660 = Sub(v658, v659);
+    auto v661 = Add(v657, v660);
+    auto v662 = MulFixedPoint15(v661, Set(d16, 18343));
+    auto v663 = Add(v656, v662);
+    auto v664 = Sub(v582, v584);
+    auto v665 = Sub(v576, v579);
+    auto v666 = MulFixedPoint15(v665, Set(d16, 31869));
+    auto v667 = Add(v664, v666);
+    auto v668 = Sub(v587, v590);
+    auto v669_tmp = MulFixedPoint15(v594, Set(d16, 23444));
+    auto v669 = Add(v669_tmp, v594);
+    auto v670 = Sub(v592, v669);
+    auto v671 = MulFixedPoint15(v670, Set(d16, 31869));
+    auto v672 = Add(v668, v671);
+    auto v673 = MulFixedPoint15(v672, Set(d16, 18830));
+    auto v674 = Add(v667, v673);
+    auto v675 = Sub(v553, v555);
+    auto v676 = Sub(v557, v559);
+    auto v677_tmp = MulFixedPoint15(v676, Set(d16, 5552));
+    auto v677 = Add(v677_tmp, v676);
+    auto v678 = Add(v675, v677);
+    auto v679 = Sub(v563, v565);
+    auto v680 = Sub(v567, v570);
+    auto v681_tmp = MulFixedPoint15(v680, Set(d16, 5552));
+    auto v681 = Add(v681_tmp, v680);
+    auto v682 = Add(v679, v681);
+    auto v683 = MulFixedPoint15(v682, Set(d16, 19393));
+    auto v684 = Add(v678, v683);
+    auto v685 = Sub(v507, v512);
+    auto v686 = Sub(v517, v522);
+    auto v687_tmp = MulFixedPoint15(v686, Set(d16, 15865));
+    auto v687 = Add(v687_tmp, v686);
+    auto v688 = Add(v685, v687);
+    auto v689 = Sub(v529, v534);
+    auto v690_tmp = MulFixedPoint15(v548, Set(d16, 28937));
+    auto v690 = Add(v690_tmp, v548);
+    auto v691 = Sub(v539, v690);
+    auto v692_tmp = MulFixedPoint15(v691, Set(d16, 15865));
+    auto v692 = Add(v692_tmp, v691);
+    auto v693 = Add(v689, v692);
+    auto v694 = MulFixedPoint15(v693, Set(d16, 20040));
+    auto v695 = Add(v688, v694);
+    auto v696 = Sub(v476, v486);
+    auto v697_tmp = MulFixedPoint15(v696, Set(d16, 1893));
+    auto v697 = Add(v697_tmp, Mul(v696, Set(d16, 2)));
+    auto v698 = Sub(v493, v499);
+    auto v699 = Add(v697, v698);
+    auto v700 = MulFixedPoint15(v699, Set(d16, 20783));
+    auto v701 = Sub(v450, v456);
+    auto v702 = Sub(v462, v468);
+    auto v703_tmp = MulFixedPoint15(v702, Set(d16, 1893));
+    auto v703 = Add(v703_tmp, Mul(v702, Set(d16, 2)));
+    auto v704 = Add(v701, v703);
+    auto v705 = Add(v700, v704);
+    auto v706 = Sub(v384, v373);
+    auto v707 = Sub(v343, v358);
+    auto v708_tmp = MulFixedPoint15(v707, Set(d16, 13357));
+    auto v708 = Add(v708_tmp, Mul(v707, Set(d16, 3)));
+    auto v709 = Add(v706, v708);
+    auto v710 = Sub(v398, v413);
+    auto v711 = Sub(v427, v441);
+    auto v712_tmp = MulFixedPoint15(v711, Set(d16, 13357));
+    auto v712 = Add(v712_tmp, Mul(v711, Set(d16, 3)));
+    auto v713 = Add(v710, v712);
+    auto v714 = MulFixedPoint15(v713, Set(d16, 21637));
+    auto v715 = Add(v709, v714);
+    auto v716 = Sub(v25, v60);
+    auto v717 = Sub(v102, v140);
+    auto v718_tmp = MulFixedPoint15(v717, Set(d16, 6226));
+    auto v718 = Add(v718_tmp, Mul(v717, Set(d16, 10)));
+    auto v719 = Add(v716, v718);
+    auto v720 = Sub(v280, v326);
+    auto v721_tmp = MulFixedPoint15(v720, Set(d16, 6226));
+    auto v721 = Add(v721_tmp, Mul(v720, Set(d16, 10)));
+    auto v722 = Sub(v184, v237);
+    auto v723 = Add(v721, v722);
+    auto v724 = MulFixedPoint15(v723, Set(d16, 22622));
+    auto v725 = Add(v719, v724);
+    auto v726 = Sub(v716, v718);
+    auto v727 = Sub(v722, v721);
+    auto v728 = MulFixedPoint15(v727, Set(d16, 23761));
+    auto v729 = Add(v726, v728);
+    auto v730 = Sub(v706, v708);
+    auto v731 = Sub(v710, v712);
+    auto v732 = MulFixedPoint15(v731, Set(d16, 25084));
+    auto v733 = Add(v730, v732);
+    auto v734 = Sub(v701, v703);
+    auto v735 = Sub(v698, v697);
+    auto v736 = MulFixedPoint15(v735, Set(d16, 26631));
+    auto v737 = Add(v734, v736);
+    auto v738 = Sub(v685, v687);
+    auto v739 = Sub(v689, v692);
+    auto v740 = MulFixedPoint15(v739, Set(d16, 28454));
+    auto v741 = Add(v738, v740);
+    auto v742 = Sub(v675, v677);
+    auto v743 = Sub(v679, v681);
+    auto v744 = MulFixedPoint15(v743, Set(d16, 30624));
+    auto v745 = Add(v742, v744);
+    auto v746 = Sub(v664, v666);
+    auto v747 = Sub(v668, v671);
+    auto v748_tmp = MulFixedPoint15(v747, Set(d16, 472));
+    auto v748 = Add(v748_tmp, v747);
+    auto v749 = Add(v746, v748);
+    auto v750 = Sub(v653, v655);
+    auto v751 = Sub(v657, v660);
+    auto v752_tmp = MulFixedPoint15(v751, Set(d16, 3672));
+    auto v752 = Add(v752_tmp, v751);
+    auto v753 = Add(v750, v752);
+    auto v754 = Sub(v643, v645);
+    auto v755 = Sub(v647, v649);
+    auto v756_tmp = MulFixedPoint15(v755, Set(d16, 7662));
+    auto v756 = Add(v756_tmp, v755);
+    auto v757 = Add(v754, v756);
+    auto v758 = Sub(v635, v640);
+    auto v759 = Sub(v624, v629);
+    auto v760_tmp = MulFixedPoint15(v759, Set(d16, 12756));
+    auto v760 = Add(v760_tmp, v759);
+    auto v761 = Add(v758, v760);
+    auto v762 = Sub(v602, v607);
+    auto v763 = Sub(v612, v617);
+    auto v764_tmp = MulFixedPoint15(v763, Set(d16, 19463));
+    auto v764 = Add(v764_tmp, v763);
+    auto v765 = Add(v762, v764);
+    auto v766 = Sub(v585, v581);
+    auto v767 = Sub(v591, v595);
+    auto v768_tmp = MulFixedPoint15(v767, Set(d16, 28661));
+    auto v768 = Add(v768_tmp, v767);
+    auto v769 = Add(v766, v768);
+    auto v770 = Sub(v556, v561);
+    auto v771 = Sub(v566, v572);
+    auto v772_tmp = MulFixedPoint15(v771, Set(d16, 9242));
+    auto v772 = Add(v772_tmp, Mul(v771, Set(d16, 2)));
+    auto v773 = Add(v770, v772);
+    auto v774 = Sub(v513, v524);
+    auto v775 = Sub(v535, v549);
+    auto v776_tmp = MulFixedPoint15(v775, Set(d16, 30298));
+    auto v776 = Add(v776_tmp, Mul(v775, Set(d16, 2)));
+    auto v777 = Add(v774, v776);
+    auto v778 = Sub(v457, v470);
+    auto v779 = Sub(v500, v488);
+    auto v780_tmp = MulFixedPoint15(v779, Set(d16, 2773));
+    auto v780 = Add(v780_tmp, Mul(v779, Set(d16, 4)));
+    auto v781 = Add(v778, v780);
+    auto v782 = Sub(v385, v360);
+    auto v783 = Sub(v414, v443);
+    auto v784_tmp = MulFixedPoint15(v783, Set(d16, 26108));
+    auto v784 = Add(v784_tmp, Mul(v783, Set(d16, 6)));
+    auto v785 = Add(v782, v784);
+    auto v786 = Sub(v61, v142);
+    auto v787 = Sub(v238, v328);
+    auto v788_tmp = MulFixedPoint15(v787, Set(d16, 12251));
+    auto v788 = Add(v788_tmp, Mul(v787, Set(d16, 20)));
+    auto v789 = Add(v786, v788);
+    auto v790 = Sub(v786, v788);
+    auto v791 = Sub(v782, v784);
+    auto v792 = Sub(v778, v780);
+    auto v793 = Sub(v774, v776);
+    auto v794 = Sub(v770, v772);
+    auto v795 = Sub(v766, v768);
+    auto v796 = Sub(v762, v764);
+    auto v797 = Sub(v758, v760);
+    auto v798 = Sub(v754, v756);
+    auto v799 = Sub(v750, v752);
+    auto v800 = Sub(v746, v748);
+    auto v801 = Sub(v742, v744);
+    auto v802 = Sub(v738, v740);
+    auto v803 = Sub(v734, v736);
+    auto v804 = Sub(v730, v732);
+    auto v805 = Sub(v726, v728);
+    auto v806 = Sub(v719, v724);
+    auto v807 = Sub(v709, v714);
+    auto v808 = Sub(v704, v700);
+    auto v809 = Sub(v688, v694);
+    auto v810 = Sub(v678, v683);
+    auto v811 = Sub(v667, v673);
+    auto v812 = Sub(v656, v662);
+    auto v813 = Sub(v646, v651);
+    auto v814 = Sub(v641, v631);
+    auto v815 = Sub(v608, v619);
+    auto v816 = Sub(v586, v597);
+    auto v817 = Sub(v562, v574);
+    auto v818 = Sub(v525, v551);
+    auto v819 = Sub(v471, v502);
+    auto v820 = Sub(v386, v445);
+    auto v821 = Sub(v143, v330);
+    StoreU(v331, d16, out + out_stride * 0 + i);
+    StoreU(v446, d16, out + out_stride * 1 + i);
+    StoreU(v503, d16, out + out_stride * 2 + i);
+    StoreU(v552, d16, out + out_stride * 3 + i);
+    StoreU(v575, d16, out + out_stride * 4 + i);
+    StoreU(v598, d16, out + out_stride * 5 + i);
+    StoreU(v620, d16, out + out_stride * 6 + i);
+    StoreU(v642, d16, out + out_stride * 7 + i);
+    StoreU(v652, d16, out + out_stride * 8 + i);
+    StoreU(v663, d16, out + out_stride * 9 + i);
+    StoreU(v674, d16, out + out_stride * 10 + i);
+    StoreU(v684, d16, out + out_stride * 11 + i);
+    StoreU(v695, d16, out + out_stride * 12 + i);
+    StoreU(v705, d16, out + out_stride * 13 + i);
+    StoreU(v715, d16, out + out_stride * 14 + i);
+    StoreU(v725, d16, out + out_stride * 15 + i);
+    StoreU(v729, d16, out + out_stride * 16 + i);
+    StoreU(v733, d16, out + out_stride * 17 + i);
+    StoreU(v737, d16, out + out_stride * 18 + i);
+    StoreU(v741, d16, out + out_stride * 19 + i);
+    StoreU(v745, d16, out + out_stride * 20 + i);
+    StoreU(v749, d16, out + out_stride * 21 + i);
+    StoreU(v753, d16, out + out_stride * 22 + i);
+    StoreU(v757, d16, out + out_stride * 23 + i);
+    StoreU(v761, d16, out + out_stride * 24 + i);
+    StoreU(v765, d16, out + out_stride * 25 + i);
+    StoreU(v769, d16, out + out_stride * 26 + i);
+    StoreU(v773, d16, out + out_stride * 27 + i);
+    StoreU(v777, d16, out + out_stride * 28 + i);
+    StoreU(v781, d16, out + out_stride * 29 + i);
+    StoreU(v785, d16, out + out_stride * 30 + i);
+    StoreU(v789, d16, out + out_stride * 31 + i);
+    StoreU(v790, d16, out + out_stride * 32 + i);
+    StoreU(v791, d16, out + out_stride * 33 + i);
+    StoreU(v792, d16, out + out_stride * 34 + i);
+    StoreU(v793, d16, out + out_stride * 35 + i);
+    StoreU(v794, d16, out + out_stride * 36 + i);
+    StoreU(v795, d16, out + out_stride * 37 + i);
+    StoreU(v796, d16, out + out_stride * 38 + i);
+    StoreU(v797, d16, out + out_stride * 39 + i);
+    StoreU(v798, d16, out + out_stride * 40 + i);
+    StoreU(v799, d16, out + out_stride * 41 + i);
+    StoreU(v800, d16, out + out_stride * 42 + i);
+    StoreU(v801, d16, out + out_stride * 43 + i);
+    StoreU(v802, d16, out + out_stride * 44 + i);
+    StoreU(v803, d16, out + out_stride * 45 + i);
+    StoreU(v804, d16, out + out_stride * 46 + i);
+    StoreU(v805, d16, out + out_stride * 47 + i);
+    StoreU(v806, d16, out + out_stride * 48 + i);
+    StoreU(v807, d16, out + out_stride * 49 + i);
+    StoreU(v808, d16, out + out_stride * 50 + i);
+    StoreU(v809, d16, out + out_stride * 51 + i);
+    StoreU(v810, d16, out + out_stride * 52 + i);
+    StoreU(v811, d16, out + out_stride * 53 + i);
+    StoreU(v812, d16, out + out_stride * 54 + i);
+    StoreU(v813, d16, out + out_stride * 55 + i);
+    StoreU(v814, d16, out + out_stride * 56 + i);
+    StoreU(v815, d16, out + out_stride * 57 + i);
+    StoreU(v816, d16, out + out_stride * 58 + i);
+    StoreU(v817, d16, out + out_stride * 59 + i);
+    StoreU(v818, d16, out + out_stride * 60 + i);
+    StoreU(v819, d16, out + out_stride * 61 + i);
+    StoreU(v820, d16, out + out_stride * 62 + i);
+    StoreU(v821, d16, out + out_stride * 63 + i);
   }
 }
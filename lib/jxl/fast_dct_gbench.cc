@@ -0,0 +1,176 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <string.h>
+
+#include <hwy/aligned_allocator.h>
+
+#include "benchmark/benchmark.h"
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "lib/jxl/fast_dct_gbench.cc"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
+#include "lib/jxl/base/random.h"
+#include "lib/jxl/dct-inl.h"
+#include "lib/jxl/fast_dct-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace jxl {
+namespace HWY_NAMESPACE {
+namespace {
+
+template <size_t ROWS, size_t COLS>
+void RunFastTranspose(benchmark::State& state) {
+  auto in = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  auto out = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  for (size_t i = 0; i < ROWS * COLS; i++) {
+    in[i] = static_cast<int16_t>(i);
+  }
+  for (auto _ : state) {
+    FastTransposeBlock(in.get(), COLS, ROWS, COLS, out.get(), ROWS);
+    benchmark::DoNotOptimize(out[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * ROWS * COLS);
+}
+
+// The fixed-point IDCT that the decoder uses with JxlDecoderSetFastIDCT.
+template <size_t ROWS, size_t COLS>
+void RunFastIDCT(benchmark::State& state) {
+  auto coefficients = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  auto from = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  auto to = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  auto scratch = hwy::AllocateAligned<int16_t>(ROWS * COLS);
+  Rng rng(0);
+  for (size_t i = 0; i < ROWS * COLS; i++) {
+    coefficients[i] = static_cast<int16_t>(rng.UniformI(-256, 256));
+  }
+  for (auto _ : state) {
+    memcpy(from.get(), coefficients.get(), ROWS * COLS * sizeof(int16_t));
+    ComputeFastScaledIDCT<ROWS, COLS>()(from.get(), to.get(), COLS,
+                                        scratch.get());
+    benchmark::DoNotOptimize(to[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * ROWS * COLS);
+}
+
+// The float IDCT that RunFastIDCT replaces.
+template <size_t ROWS, size_t COLS>
+void RunFloatIDCT(benchmark::State& state) {
+  auto coefficients = hwy::AllocateAligned<float>(ROWS * COLS);
+  auto from = hwy::AllocateAligned<float>(ROWS * COLS);
+  auto to = hwy::AllocateAligned<float>(ROWS * COLS);
+  auto scratch = hwy::AllocateAligned<float>(5 * ROWS * COLS);
+  Rng rng(0);
+  for (size_t i = 0; i < ROWS * COLS; i++) {
+    coefficients[i] = rng.UniformF(-1.0f / 64, 1.0f / 64);
+  }
+  for (auto _ : state) {
+    memcpy(from.get(), coefficients.get(), ROWS * COLS * sizeof(float));
+    ComputeScaledIDCT<ROWS, COLS>()(from.get(), DCTTo(to.get(), COLS),
+                                    scratch.get());
+    benchmark::DoNotOptimize(to[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * ROWS * COLS);
+}
+
+HWY_NOINLINE void BM_FastTranspose8x8(benchmark::State& state) {
+  RunFastTranspose<8, 8>(state);
+}
+HWY_NOINLINE void BM_FastTranspose16x16(benchmark::State& state) {
+  RunFastTranspose<16, 16>(state);
+}
+HWY_NOINLINE void BM_FastIDCT8x8(benchmark::State& state) {
+  RunFastIDCT<8, 8>(state);
+}
+HWY_NOINLINE void BM_FastIDCT8x16(benchmark::State& state) {
+  RunFastIDCT<8, 16>(state);
+}
+HWY_NOINLINE void BM_FastIDCT16x8(benchmark::State& state) {
+  RunFastIDCT<16, 8>(state);
+}
+HWY_NOINLINE void BM_FastIDCT16x16(benchmark::State& state) {
+  RunFastIDCT<16, 16>(state);
+}
+HWY_NOINLINE void BM_FloatIDCT8x8(benchmark::State& state) {
+  RunFloatIDCT<8, 8>(state);
+}
+HWY_NOINLINE void BM_FloatIDCT8x16(benchmark::State& state) {
+  RunFloatIDCT<8, 16>(state);
+}
+HWY_NOINLINE void BM_FloatIDCT16x8(benchmark::State& state) {
+  RunFloatIDCT<16, 8>(state);
+}
+HWY_NOINLINE void BM_FloatIDCT16x16(benchmark::State& state) {
+  RunFloatIDCT<16, 16>(state);
+}
+
+}  // namespace
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace jxl
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace jxl {
+namespace {
+
+HWY_EXPORT(BM_FastTranspose8x8);
+HWY_EXPORT(BM_FastTranspose16x16);
+HWY_EXPORT(BM_FastIDCT8x8);
+HWY_EXPORT(BM_FastIDCT8x16);
+HWY_EXPORT(BM_FastIDCT16x8);
+HWY_EXPORT(BM_FastIDCT16x16);
+HWY_EXPORT(BM_FloatIDCT8x8);
+HWY_EXPORT(BM_FloatIDCT8x16);
+HWY_EXPORT(BM_FloatIDCT16x8);
+HWY_EXPORT(BM_FloatIDCT16x16);
+
+void BM_FastTranspose8x8(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastTranspose8x8)(state);
+}
+void BM_FastTranspose16x16(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastTranspose16x16)(state);
+}
+void BM_FastIDCT8x8(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastIDCT8x8)(state);
+}
+void BM_FastIDCT8x16(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastIDCT8x16)(state);
+}
+void BM_FastIDCT16x8(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastIDCT16x8)(state);
+}
+void BM_FastIDCT16x16(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FastIDCT16x16)(state);
+}
+void BM_FloatIDCT8x8(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FloatIDCT8x8)(state);
+}
+void BM_FloatIDCT8x16(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FloatIDCT8x16)(state);
+}
+void BM_FloatIDCT16x8(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FloatIDCT16x8)(state);
+}
+void BM_FloatIDCT16x16(benchmark::State& state) {
+  HWY_DYNAMIC_DISPATCH(BM_FloatIDCT16x16)(state);
+}
+
+BENCHMARK(BM_FastTranspose8x8);
+BENCHMARK(BM_FastTranspose16x16);
+BENCHMARK(BM_FastIDCT8x8);
+BENCHMARK(BM_FastIDCT8x16);
+BENCHMARK(BM_FastIDCT16x8);
+BENCHMARK(BM_FastIDCT16x16);
+BENCHMARK(BM_FloatIDCT8x8);
+BENCHMARK(BM_FloatIDCT8x16);
+BENCHMARK(BM_FloatIDCT16x8);
+BENCHMARK(BM_FloatIDCT16x16);
+
+}  // namespace
+}  // namespace jxl
+#endif
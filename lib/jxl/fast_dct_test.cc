@@ -11,7 +11,7 @@
 
 #include "lib/jxl/base/random.h"
 #include "lib/jxl/dct-inl.h"
-#include "lib/jxl/fast_dct-inl.h"
+#include "lib/jxl/fast_dct_testonly-inl.h"
 #include "lib/jxl/fast_dct.h"
 #include "lib/jxl/testing.h"
 #include "lib/jxl/transpose-inl.h"
@@ -26,21 +26,17 @@ namespace {
 
 template <size_t N, size_t M>
 HWY_NOINLINE void TestFastTranspose() {
-#if HWY_TARGET == HWY_NEON
   auto array_mem = hwy::AllocateAligned<int16_t>(N * M);
   int16_t* array = array_mem.get();
   auto transposed_mem = hwy::AllocateAligned<int16_t>(N * M);
   int16_t* transposed = transposed_mem.get();
   std::iota(array, array + N * M, 0);
-  for (size_t j = 0; j < 100000000 / (N * M); j++) {
-    FastTransposeBlock(array, M, N, M, transposed, N);
-  }
+  FastTransposeBlock(array, M, N, M, transposed, N);
   for (size_t i = 0; i < M; i++) {
     for (size_t j = 0; j < N; j++) {
       EXPECT_EQ(array[j * M + i], transposed[i * N + j]);
     }
   }
-#endif
 }
 
 template <size_t N, size_t M>
@@ -60,12 +56,18 @@ HWY_NOINLINE void TestFloatTranspose() {
   }
 }
 
+// The error bounds of the fixed-point IDCTs are about twice the measured
+// errors; they grow with the transform size, which is why the decoder only
+// uses the fixed-point IDCTs up to 256 coefficients, see dec_group.cc.
+
 // TODO(sboukortt): re-enable the FloatIDCT tests once we find out why they fail
 // in ASAN mode in the CI runners and seemingly not locally.
 
 HWY_NOINLINE void TestFastTranspose8x8() { TestFastTranspose<8, 8>(); }
 HWY_NOINLINE void TestFloatTranspose8x8() { TestFloatTranspose<8, 8>(); }
-HWY_NOINLINE void TestFastIDCT8x8() { TestFastIDCT<8, 8>(); }
+HWY_NOINLINE void TestFastIDCT8x8() {
+  EXPECT_LE(TestFastIDCT<8, 8>(), 1.0f / 256);
+}
 HWY_NOINLINE void TestFloatIDCT8x8() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -76,7 +78,9 @@ HWY_NOINLINE void TestFloatIDCT8x8() {
 }
 HWY_NOINLINE void TestFastTranspose8x16() { TestFastTranspose<8, 16>(); }
 HWY_NOINLINE void TestFloatTranspose8x16() { TestFloatTranspose<8, 16>(); }
-HWY_NOINLINE void TestFastIDCT8x16() { TestFastIDCT<8, 16>(); }
+HWY_NOINLINE void TestFastIDCT8x16() {
+  EXPECT_LE(TestFastIDCT<8, 16>(), 1.0f / 128);
+}
 HWY_NOINLINE void TestFloatIDCT8x16() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -87,7 +91,9 @@ HWY_NOINLINE void TestFloatIDCT8x16() {
 }
 HWY_NOINLINE void TestFastTranspose8x32() { TestFastTranspose<8, 32>(); }
 HWY_NOINLINE void TestFloatTranspose8x32() { TestFloatTranspose<8, 32>(); }
-HWY_NOINLINE void TestFastIDCT8x32() { TestFastIDCT<8, 32>(); }
+HWY_NOINLINE void TestFastIDCT8x32() {
+  EXPECT_LE(TestFastIDCT<8, 32>(), 1.0f / 64);
+}
 HWY_NOINLINE void TestFloatIDCT8x32() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -98,7 +104,9 @@ HWY_NOINLINE void TestFloatIDCT8x32() {
 }
 HWY_NOINLINE void TestFastTranspose16x8() { TestFastTranspose<16, 8>(); }
 HWY_NOINLINE void TestFloatTranspose16x8() { TestFloatTranspose<16, 8>(); }
-HWY_NOINLINE void TestFastIDCT16x8() { TestFastIDCT<16, 8>(); }
+HWY_NOINLINE void TestFastIDCT16x8() {
+  EXPECT_LE(TestFastIDCT<16, 8>(), 1.0f / 128);
+}
 HWY_NOINLINE void TestFloatIDCT16x8() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -109,7 +117,9 @@ HWY_NOINLINE void TestFloatIDCT16x8() {
 }
 HWY_NOINLINE void TestFastTranspose16x16() { TestFastTranspose<16, 16>(); }
 HWY_NOINLINE void TestFloatTranspose16x16() { TestFloatTranspose<16, 16>(); }
-HWY_NOINLINE void TestFastIDCT16x16() { TestFastIDCT<16, 16>(); }
+HWY_NOINLINE void TestFastIDCT16x16() {
+  EXPECT_LE(TestFastIDCT<16, 16>(), 1.0f / 64);
+}
 HWY_NOINLINE void TestFloatIDCT16x16() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -120,7 +130,9 @@ HWY_NOINLINE void TestFloatIDCT16x16() {
 }
 HWY_NOINLINE void TestFastTranspose16x32() { TestFastTranspose<16, 32>(); }
 HWY_NOINLINE void TestFloatTranspose16x32() { TestFloatTranspose<16, 32>(); }
-HWY_NOINLINE void TestFastIDCT16x32() { TestFastIDCT<16, 32>(); }
+HWY_NOINLINE void TestFastIDCT16x32() {
+  EXPECT_LE(TestFastIDCT<16, 32>(), 1.0f / 32);
+}
 HWY_NOINLINE void TestFloatIDCT16x32() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -131,7 +143,9 @@ HWY_NOINLINE void TestFloatIDCT16x32() {
 }
 HWY_NOINLINE void TestFastTranspose32x8() { TestFastTranspose<32, 8>(); }
 HWY_NOINLINE void TestFloatTranspose32x8() { TestFloatTranspose<32, 8>(); }
-HWY_NOINLINE void TestFastIDCT32x8() { TestFastIDCT<32, 8>(); }
+HWY_NOINLINE void TestFastIDCT32x8() {
+  EXPECT_LE(TestFastIDCT<32, 8>(), 1.0f / 64);
+}
 HWY_NOINLINE void TestFloatIDCT32x8() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -142,7 +156,9 @@ HWY_NOINLINE void TestFloatIDCT32x8() {
 }
 HWY_NOINLINE void TestFastTranspose32x16() { TestFastTranspose<32, 16>(); }
 HWY_NOINLINE void TestFloatTranspose32x16() { TestFloatTranspose<32, 16>(); }
-HWY_NOINLINE void TestFastIDCT32x16() { TestFastIDCT<32, 16>(); }
+HWY_NOINLINE void TestFastIDCT32x16() {
+  EXPECT_LE(TestFastIDCT<32, 16>(), 1.0f / 32);
+}
 HWY_NOINLINE void TestFloatIDCT32x16() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -153,7 +169,9 @@ HWY_NOINLINE void TestFloatIDCT32x16() {
 }
 HWY_NOINLINE void TestFastTranspose32x32() { TestFastTranspose<32, 32>(); }
 HWY_NOINLINE void TestFloatTranspose32x32() { TestFloatTranspose<32, 32>(); }
-HWY_NOINLINE void TestFastIDCT32x32() { TestFastIDCT<32, 32>(); }
+HWY_NOINLINE void TestFastIDCT32x32() {
+  EXPECT_LE(TestFastIDCT<32, 32>(), 1.0f / 16);
+}
 HWY_NOINLINE void TestFloatIDCT32x32() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -164,7 +182,9 @@ HWY_NOINLINE void TestFloatIDCT32x32() {
 }
 HWY_NOINLINE void TestFastTranspose32x64() { TestFastTranspose<32, 64>(); }
 HWY_NOINLINE void TestFloatTranspose32x64() { TestFloatTranspose<32, 64>(); }
-HWY_NOINLINE void TestFastIDCT32x64() { TestFastIDCT<32, 64>(); }
+HWY_NOINLINE void TestFastIDCT32x64() {
+  EXPECT_LE(TestFastIDCT<32, 64>(), 1.0f / 8);
+}
 HWY_NOINLINE void TestFloatIDCT32x64() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -175,7 +195,9 @@ HWY_NOINLINE void TestFloatIDCT32x64() {
 }
 HWY_NOINLINE void TestFastTranspose64x32() { TestFastTranspose<64, 32>(); }
 HWY_NOINLINE void TestFloatTranspose64x32() { TestFloatTranspose<64, 32>(); }
-HWY_NOINLINE void TestFastIDCT64x32() { TestFastIDCT<64, 32>(); }
+HWY_NOINLINE void TestFastIDCT64x32() {
+  EXPECT_LE(TestFastIDCT<64, 32>(), 1.0f / 8);
+}
 HWY_NOINLINE void TestFloatIDCT64x32() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -186,7 +208,9 @@ HWY_NOINLINE void TestFloatIDCT64x32() {
 }
 HWY_NOINLINE void TestFastTranspose64x64() { TestFastTranspose<64, 64>(); }
 HWY_NOINLINE void TestFloatTranspose64x64() { TestFloatTranspose<64, 64>(); }
-HWY_NOINLINE void TestFastIDCT64x64() { TestFastIDCT<64, 64>(); }
+HWY_NOINLINE void TestFastIDCT64x64() {
+  EXPECT_LE(TestFastIDCT<64, 64>(), 1.0f / 4);
+}
 HWY_NOINLINE void TestFloatIDCT64x64() {
 #if HWY_TARGET == HWY_SCALAR && \
     (defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER))
@@ -500,12 +500,18 @@ Status U32Coder::CanEncode(const U32Enc enc, const uint32_t value,
 }
 
 uint32_t U32Coder::Read(const U32Enc enc, BitReader* JXL_RESTRICT reader) {
-  const uint32_t selector = reader->ReadFixedBits<2>();
+  // Selector and extra bits (at most 2 + 32) fit in a single refill.
+  reader->Refill();
+  const uint32_t selector = reader->PeekFixedBits<2>();
+  reader->Consume(2);
   const U32Distr d = enc.GetDistr(selector);
   if (d.IsDirect()) {
     return d.Direct();
   } else {
-    return reader->ReadBits(d.ExtraBits()) + d.Offset();
+    const size_t nbits = d.ExtraBits();
+    const uint32_t bits = reader->PeekBits(nbits);
+    reader->Consume(nbits);
+    return bits + d.Offset();
   }
 }
 
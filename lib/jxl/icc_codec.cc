@@ -7,18 +7,43 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
 
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "lib/jxl/icc_codec.cc"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
 #include "lib/jxl/base/byte_order.h"
 #include "lib/jxl/dec_ans.h"
 #include "lib/jxl/fields.h"
 #include "lib/jxl/icc_codec_common.h"
 
+HWY_BEFORE_NAMESPACE();
 namespace jxl {
+namespace HWY_NAMESPACE {
 namespace {
 
+// Interleaves Lanes(d) columns of the matrix described at Shuffle.
+template <class D>
+JXL_INLINE void ShuffleColumns(D d, hwy::SizeTag<2> /* tag */,
+                               const uint8_t* data, size_t height,
+                               uint8_t* result) {
+  StoreInterleaved2(LoadU(d, data), LoadU(d, data + height), d, result);
+}
+
+template <class D>
+JXL_INLINE void ShuffleColumns(D d, hwy::SizeTag<4> /* tag */,
+                               const uint8_t* data, size_t height,
+                               uint8_t* result) {
+  StoreInterleaved4(LoadU(d, data), LoadU(d, data + height),
+                    LoadU(d, data + 2 * height), LoadU(d, data + 3 * height),
+                    d, result);
+}
+
 // Shuffles or interleaves bytes, for example with width 2, turns "ABCDabcd"
 // into "AaBbCcDc". Transposes a matrix of ceil(size / width) columns and
 // width rows. There are size elements, size may be < width * height, if so the
@@ -28,20 +53,64 @@ namespace {
 // scanline order but with missing elements skipped (which may occur in multiple
 // locations), the output is the result matrix in scanline order (with
 // no need to skip missing elements as they are past the end of the data).
-void Shuffle(uint8_t* data, size_t size, size_t width) {
-  size_t height = (size + width - 1) / width;  // amount of rows of output
-  PaddedBytes result(size);
-  // i = output index, j input index
-  size_t s = 0, j = 0;
-  for (size_t i = 0; i < size; i++) {
-    result[i] = data[j];
-    j += height;
-    if (j >= size) j = ++s;
+template <size_t kWidth>
+void Shuffle(const uint8_t* data, size_t size, uint8_t* result) {
+  size_t height = (size + kWidth - 1) / kWidth;  // amount of rows of output
+  // Columns of the input matrix that have all kWidth rows filled in.
+  size_t full = size > (kWidth - 1) * height ? size - (kWidth - 1) * height : 0;
+  const HWY_FULL(uint8_t) d;
+  const size_t N = Lanes(d);
+  size_t s = 0;
+  for (; s + N <= full; s += N) {
+    ShuffleColumns(d, hwy::SizeTag<kWidth>(), data + s, height,
+                   result + s * kWidth);
+  }
+  // i = output index, s + k * height input index
+  size_t i = s * kWidth;
+  for (; s < full; s++) {
+    for (size_t k = 0; k < kWidth; k++) {
+      result[i++] = data[s + k * height];
+    }
+  }
+  for (s = full; s < height; s++) {
+    for (size_t k = 0; k < kWidth && s + k * height < size; k++) {
+      result[i++] = data[s + k * height];
+    }
+  }
+}
+
+}  // namespace
+
+void ShuffleICC(const uint8_t* data, size_t size, size_t width,
+                uint8_t* result) {
+  if (width == 2) {
+    Shuffle<2>(data, size, result);
+  } else {
+    Shuffle<4>(data, size, result);
   }
+}
 
-  for (size_t i = 0; i < size; i++) {
-    data[i] = result[i];
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace jxl
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace jxl {
+HWY_EXPORT(ShuffleICC);
+
+namespace {
+
+// Appends the num bytes at data, shuffled with given width (1, 2 or 4).
+void AppendShuffled(const uint8_t* data, size_t num, size_t width,
+                    PaddedBytes* result) {
+  size_t start = result->size();
+  if (width == 1) {
+    result->append(data, data + num);
+    return;
   }
+  result->resize(start + num);
+  HWY_DYNAMIC_DISPATCH(ShuffleICC)(data, num, width, result->data() + start);
 }
 
 // TODO(eustas): should be 20, or even 18, once DecodeVarInt is improved;
@@ -106,6 +175,9 @@ Status UnpredictICC(const uint8_t* enc, size_t size, PaddedBytes* result) {
   JXL_RETURN_IF_ERROR(CheckOutOfBounds(pos, csize, size));
   size_t commands_end = cpos + csize;
   pos = commands_end;  // pos in data stream
+  // Every input byte produces at most a few dozen output bytes, so don't
+  // trust osize beyond that for the upfront allocation.
+  result->reserve(std::min<uint64_t>(osize, 64 * uint64_t{size}));
 
   // Header
   PaddedBytes header = ICCInitialHeaderPrediction();
@@ -214,26 +286,15 @@ Status UnpredictICC(const uint8_t* enc, size_t size, PaddedBytes* result) {
       if (cpos >= commands_end) return JXL_FAILURE("Out of bounds");
       uint64_t num = DecodeVarInt(enc, size, &cpos);
       JXL_RETURN_IF_ERROR(CheckOutOfBounds(pos, num, size));
-      for (size_t i = 0; i < num; i++) {
-        result->push_back(enc[pos++]);
-      }
+      result->append(enc + pos, enc + pos + num);
+      pos += num;
     } else if (command == kCommandShuffle2 || command == kCommandShuffle4) {
       if (cpos >= commands_end) return JXL_FAILURE("Out of bounds");
       uint64_t num = DecodeVarInt(enc, size, &cpos);
       JXL_RETURN_IF_ERROR(CheckOutOfBounds(pos, num, size));
-      PaddedBytes shuffled(num);
-      for (size_t i = 0; i < num; i++) {
-        shuffled[i] = enc[pos + i];
-      }
-      if (command == kCommandShuffle2) {
-        Shuffle(shuffled.data(), num, 2);
-      } else if (command == kCommandShuffle4) {
-        Shuffle(shuffled.data(), num, 4);
-      }
-      for (size_t i = 0; i < num; i++) {
-        result->push_back(shuffled[i]);
-        pos++;
-      }
+      AppendShuffled(enc + pos, num, command == kCommandShuffle2 ? 2 : 4,
+                     result);
+      pos += num;
     } else if (command == kCommandPredict) {
       JXL_RETURN_IF_ERROR(CheckOutOfBounds(cpos, 2, commands_end));
       uint8_t flags = enc[cpos++];
@@ -265,26 +326,18 @@ Status UnpredictICC(const uint8_t* enc, size_t size, PaddedBytes* result) {
       uint64_t num = DecodeVarInt(enc, size, &cpos);  // in bytes
       JXL_RETURN_IF_ERROR(CheckOutOfBounds(pos, num, size));
 
-      PaddedBytes shuffled(num);
-      for (size_t i = 0; i < num; i++) {
-        shuffled[i] = enc[pos + i];
-      }
-      if (width > 1) Shuffle(shuffled.data(), num, width);
-
+      // The residuals are shuffled straight into the result, then replaced by
+      // the predicted values front to back.
       size_t start = result->size();
-      for (size_t i = 0; i < num; i++) {
-        uint8_t predicted = LinearPredictICCValue(result->data(), start, i,
-                                                  stride, width, order);
-        result->push_back(predicted + shuffled[i]);
-      }
+      AppendShuffled(enc + pos, num, width, result);
+      LinearUnpredictICC(result->data(), start, num, stride, width, order);
       pos += num;
     } else if (command == kCommandXYZ) {
       AppendKeyword(kXyz_Tag, result);
       for (int i = 0; i < 4; i++) result->push_back(0);
       JXL_RETURN_IF_ERROR(CheckOutOfBounds(pos, 12, size));
-      for (size_t i = 0; i < 12; i++) {
-        result->push_back(enc[pos++]);
-      }
+      result->append(enc + pos, enc + pos + 12);
+      pos += 12;
     } else if (command >= kCommandTypeStartFirst &&
                command < kCommandTypeStartFirst + kNumTypeStrings) {
       AppendKeyword(*kTypeStrings[command - kCommandTypeStartFirst], result);
@@ -399,3 +452,4 @@ Status ReadICC(BitReader* JXL_RESTRICT reader, PaddedBytes* JXL_RESTRICT icc,
 }
 
 }  // namespace jxl
+#endif  // HWY_ONCE
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -150,37 +151,68 @@ void ICCPredictHeader(const uint8_t* icc, size_t size, uint8_t* header,
   }
 }
 
-// Predicts a value with linear prediction of given order (0-2), for integers
-// with width bytes and given stride in bytes between values.
-// The start position is at start + i, and the relevant modulus of i describes
-// which byte of the multi-byte integer is being handled.
-// The value start + i must be at least stride * 4.
-uint8_t LinearPredictICCValue(const uint8_t* data, size_t start, size_t i,
-                              size_t stride, size_t width, int order) {
-  size_t pos = start + i;
+namespace {
+
+template <size_t kWidth>
+JXL_INLINE uint32_t LoadICCElement(const uint8_t* p) {
+  return kWidth == 1 ? p[0] : kWidth == 2 ? LoadBE16(p) : LoadBE32(p);
+}
+
+// Predicts integers of kWidth bytes with linear prediction of given order
+// (0-2), from the integers stride bytes, 2 * stride bytes and 3 * stride bytes
+// before them. The prediction is computed once per integer and is exact modulo
+// 2^32, so its low kWidth bytes match a prediction in kWidth-byte arithmetic.
+// Since stride >= kWidth, the integers read only precede the one predicted, so
+// with kUnpredict, data may be updated in place from front to back.
+template <size_t kWidth, bool kUnpredict>
+void LinearPredictICCRun(const uint8_t* data, size_t start, size_t num,
+                         size_t stride, int order, uint8_t* out) {
+  for (size_t i = 0; i < num; i += kWidth) {
+    const uint8_t* p = data + start + i;
+    uint32_t p1 = LoadICCElement<kWidth>(p - stride);
+    uint32_t p2 = LoadICCElement<kWidth>(p - stride * 2);
+    uint32_t p3 = LoadICCElement<kWidth>(p - stride * 3);
+    uint32_t pred = PredictValue(p1, p2, p3, order);
+    size_t n = std::min(kWidth, num - i);
+    for (size_t j = 0; j < n; j++) {
+      uint8_t predicted = (pred >> ((kWidth - 1 - j) * 8)) & 255;
+      if (kUnpredict) {
+        out[i + j] += predicted;
+      } else {
+        out[i + j] = p[j] - predicted;
+      }
+    }
+  }
+}
+
+template <bool kUnpredict>
+void LinearPredictICCImpl(const uint8_t* data, size_t start, size_t num,
+                          size_t stride, size_t width, int order,
+                          uint8_t* out) {
   if (width == 1) {
-    uint8_t p1 = data[pos - stride];
-    uint8_t p2 = data[pos - stride * 2];
-    uint8_t p3 = data[pos - stride * 3];
-    return PredictValue(p1, p2, p3, order);
+    LinearPredictICCRun<1, kUnpredict>(data, start, num, stride, order, out);
   } else if (width == 2) {
-    size_t p = start + (i & ~1);
-    uint16_t p1 = (data[p - stride * 1] << 8) + data[p - stride * 1 + 1];
-    uint16_t p2 = (data[p - stride * 2] << 8) + data[p - stride * 2 + 1];
-    uint16_t p3 = (data[p - stride * 3] << 8) + data[p - stride * 3 + 1];
-    uint16_t pred = PredictValue(p1, p2, p3, order);
-    return (i & 1) ? (pred & 255) : ((pred >> 8) & 255);
+    LinearPredictICCRun<2, kUnpredict>(data, start, num, stride, order, out);
   } else {
-    size_t p = start + (i & ~3);
-    uint32_t p1 = DecodeUint32(data, pos, p - stride);
-    uint32_t p2 = DecodeUint32(data, pos, p - stride * 2);
-    uint32_t p3 = DecodeUint32(data, pos, p - stride * 3);
-    uint32_t pred = PredictValue(p1, p2, p3, order);
-    unsigned shiftbytes = 3 - (i & 3);
-    return (pred >> (shiftbytes * 8)) & 255;
+    LinearPredictICCRun<4, kUnpredict>(data, start, num, stride, order, out);
   }
 }
 
+}  // namespace
+
+void LinearPredictICC(const uint8_t* data, size_t start, size_t num,
+                      size_t stride, size_t width, int order,
+                      uint8_t* residuals) {
+  LinearPredictICCImpl</*kUnpredict=*/false>(data, start, num, stride, width,
+                                             order, residuals);
+}
+
+void LinearUnpredictICC(uint8_t* data, size_t start, size_t num, size_t stride,
+                        size_t width, int order) {
+  LinearPredictICCImpl</*kUnpredict=*/true>(data, start, num, stride, width,
+                                            order, data + start);
+}
+
 size_t ICCANSContext(size_t i, size_t b1, size_t b2) {
   if (i <= 128) return 0;
   return 1 + ByteKind1(b1) + ByteKind2(b2) * 8;
@@ -97,8 +97,21 @@ Status CheckIs32Bit(uint64_t v);
 PaddedBytes ICCInitialHeaderPrediction();
 void ICCPredictHeader(const uint8_t* icc, size_t size, uint8_t* header,
                       size_t pos);
-uint8_t LinearPredictICCValue(const uint8_t* data, size_t start, size_t i,
-                              size_t stride, size_t width, int order);
+
+// Linear prediction of given order (0-2) for big-endian integers of width
+// bytes (1, 2 or 4) with given stride in bytes between values, for the num
+// bytes at data + start. The relevant modulus of the offset from start
+// describes which byte of the multi-byte integer is being handled.
+// start must be at least stride * 4, and stride at least width.
+// Writes data[start + i] minus its prediction to residuals[i].
+void LinearPredictICC(const uint8_t* data, size_t start, size_t num,
+                      size_t stride, size_t width, int order,
+                      uint8_t* residuals);
+// Inverse of LinearPredictICC: the num bytes at data + start hold residuals on
+// input and the reconstructed values on output.
+void LinearUnpredictICC(uint8_t* data, size_t start, size_t num, size_t stride,
+                        size_t width, int order);
+
 size_t ICCANSContext(size_t i, size_t b1, size_t b2);
 
 }  // namespace jxl
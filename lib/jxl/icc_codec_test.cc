@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <string>
 
+#include "lib/jxl/base/random.h"
 #include "lib/jxl/base/span.h"
 #include "lib/jxl/color_encoding_internal.h"
 #include "lib/jxl/enc_icc_codec.h"
@@ -151,6 +152,85 @@ TEST(IccCodecTest, Icc) {
   }
 }
 
+// Curve and gbd tags that are predicted and shuffled over many vectors, with
+// tails of every length.
+TEST(IccCodecTest, LargePredictedTags) {
+  const auto append_be32 = [](uint32_t value, IccBytes* icc) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      icc->push_back((value >> shift) & 255);
+    }
+  };
+  Rng rng(0);
+  for (size_t num_entries = 1000; num_entries < 1070; num_entries++) {
+    const size_t curv_size = 12 + num_entries * 2;
+    const size_t gbd_size = 8 + num_entries;
+    IccBytes profile(128, 0);
+    append_be32(2, &profile);  // tag count
+    const uint32_t curv_start = 128 + 4 + 2 * 12;
+    Span<const uint8_t>(reinterpret_cast<const uint8_t*>("rTRC"), 4)
+        .AppendTo(&profile);
+    append_be32(curv_start, &profile);
+    append_be32(curv_size, &profile);
+    Span<const uint8_t>(reinterpret_cast<const uint8_t*>("gbd "), 4)
+        .AppendTo(&profile);
+    append_be32(curv_start + curv_size, &profile);
+    append_be32(gbd_size, &profile);
+    Span<const uint8_t>(reinterpret_cast<const uint8_t*>("curv"), 4)
+        .AppendTo(&profile);
+    append_be32(0, &profile);
+    append_be32(num_entries, &profile);
+    for (size_t i = 0; i < num_entries; i++) {
+      // Smooth, with carries between the bytes of the 16-bit entries.
+      const uint32_t value = i * i * 65535 / (num_entries * num_entries) +
+                             rng.UniformU(0, 300);
+      profile.push_back((value >> 8) & 255);
+      profile.push_back(value & 255);
+    }
+    Span<const uint8_t>(reinterpret_cast<const uint8_t*>("gbd "), 4)
+        .AppendTo(&profile);
+    append_be32(0, &profile);
+    for (size_t i = 0; i < num_entries; i++) {
+      profile.push_back(rng.UniformU(0, 256));
+    }
+    const uint32_t size = profile.size();
+    for (size_t i = 0; i < 4; i++) {
+      profile[i] = (size >> (24 - 8 * i)) & 255;
+    }
+    TestProfile(profile);
+  }
+}
+
+TEST(IccCodecTest, WriterCacheMatchesWriteICC) {
+  IccBytes profile;
+  Span<const uint8_t>(kTestProfile, sizeof(kTestProfile)).AppendTo(&profile);
+  IccBytes other(profile.begin(), profile.begin() + 200);
+  ICCWriterCache cache;
+  for (const IccBytes* icc : {&profile, &profile, &other, &profile}) {
+    // Start at an unaligned position, as after the codestream headers.
+    BitWriter expected;
+    BitWriter actual;
+    for (BitWriter* writer : {&expected, &actual}) {
+      BitWriter::Allotment allotment(writer, 3);
+      writer->Write(3, 5);
+      allotment.ReclaimAndCharge(writer, 0, nullptr);
+    }
+    ASSERT_TRUE(WriteICC(*icc, &expected, 0, nullptr));
+    ASSERT_TRUE(cache.WriteICC(*icc, &actual, 0, nullptr));
+    ASSERT_EQ(expected.BitsWritten(), actual.BitsWritten());
+    for (BitWriter* writer : {&expected, &actual}) {
+      BitWriter::Allotment allotment(writer, kBitsPerByte);
+      writer->ZeroPadToByte();
+      allotment.ReclaimAndCharge(writer, 0, nullptr);
+    }
+    Span<const uint8_t> expected_bytes = expected.GetSpan();
+    Span<const uint8_t> actual_bytes = actual.GetSpan();
+    ASSERT_EQ(expected_bytes.size(), actual_bytes.size());
+    for (size_t i = 0; i < expected_bytes.size(); i++) {
+      ASSERT_EQ(expected_bytes[i], actual_bytes[i]);
+    }
+  }
+}
+
 // kTestProfile after encoding with the ICC codec
 static const unsigned char kEncodedTestProfile[] = {
     0x1f, 0x8b, 0x1,  0x13, 0x10, 0x0,  0x0,  0x0,  0x20, 0x4c, 0xcc, 0x3,
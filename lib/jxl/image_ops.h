@@ -13,6 +13,8 @@
 #include <limits>
 #include <vector>
 
+#include "lib/jxl/base/cache_aligned.h"
+#include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/frame_dimensions.h"
 #include "lib/jxl/image.h"
@@ -432,6 +434,42 @@ void ZeroFillImage(Image3<T>* image) {
   }
 }
 
+// Zero-fills `image` if it is a large buffer (see
+// CacheAligned::SetLargeAllocationThreshold), in stripes of `rows_per_task`
+// rows distributed over `pool`. With the usual first-touch NUMA policy, its
+// pages then end up spread over the nodes of the threads that process the
+// groups, instead of all on the node of the allocating thread. Does nothing
+// for other images, whose contents are left unchanged.
+template <typename T>
+Status FirstTouchImage(ThreadPool* pool, Plane<T>* image,
+                       size_t rows_per_task = kGroupDim) {
+  const size_t threshold = CacheAligned::LargeAllocationThreshold();
+  if (threshold == 0 || image->xsize() == 0 ||
+      image->bytes_per_row() * image->ysize() < threshold) {
+    return true;
+  }
+  const size_t num_stripes = DivCeil(image->ysize(), rows_per_task);
+  const auto touch_stripe = [&](const uint32_t stripe, size_t /*thread*/) {
+    const size_t y_end =
+        std::min((stripe + 1) * rows_per_task, image->ysize());
+    for (size_t y = stripe * rows_per_task; y < y_end; ++y) {
+      memset(image->Row(y), 0, image->xsize() * sizeof(T));
+    }
+  };
+  return RunOnPool(pool, 0, num_stripes, ThreadPool::NoInit, touch_stripe,
+                   "FirstTouchImage");
+}
+
+template <typename T>
+Status FirstTouchImage(ThreadPool* pool, Image3<T>* image,
+                       size_t rows_per_task = kGroupDim) {
+  for (size_t c = 0; c < 3; ++c) {
+    JXL_RETURN_IF_ERROR(
+        FirstTouchImage(pool, &image->Plane(c), rows_per_task));
+  }
+  return true;
+}
+
 template <typename T>
 void ZeroFillPlane(Plane<T>* image, Rect rect) {
   for (size_t y = 0; y < rect.ysize(); ++y) {
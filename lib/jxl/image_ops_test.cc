@@ -68,6 +68,42 @@ TEST(ImageTest, TestAllocator) {
   }
 }
 
+TEST(ImageTest, TestLargeAllocations) {
+  const size_t kLarge = CacheAligned::kHugePageSize;
+  CacheAligned::SetLargeAllocationThreshold(kLarge);
+  for (size_t size : {kLarge - 1, kLarge, 3 * kLarge + 5}) {
+    for (size_t offset = 0; offset <= CacheAligned::kAlias;
+         offset += CacheAligned::kAlias / 2) {
+      uint8_t* bytes =
+          static_cast<uint8_t*>(CacheAligned::Allocate(size, offset));
+      JXL_CHECK(reinterpret_cast<uintptr_t>(bytes) % CacheAligned::kAlignment ==
+                0);
+      memset(bytes, 0, size);
+      bytes[size - 1] = 1;
+      EXPECT_EQ(1, bytes[size - 1]);
+      CacheAligned::Free(bytes);
+    }
+  }
+
+  // Only large images are first-touched, i.e. zero-filled, and only where
+  // large allocations are special.
+  const float touched =
+      CacheAligned::LargeAllocationThreshold() != 0 ? 0.0f : 1.0f;
+  ImageF small(64, 64);
+  ImageF large(1024, 1024);
+  FillImage(1.0f, &small);
+  FillImage(1.0f, &large);
+  EXPECT_TRUE(FirstTouchImage(/*pool=*/nullptr, &small));
+  EXPECT_TRUE(FirstTouchImage(/*pool=*/nullptr, &large));
+  CacheAligned::SetLargeAllocationThreshold(0);
+  EXPECT_EQ(1.0f, small.Row(63)[63]);
+  for (size_t y = 0; y < large.ysize(); y++) {
+    for (size_t x = 0; x < large.xsize(); x++) {
+      ASSERT_EQ(touched, large.Row(y)[x]);
+    }
+  }
+}
+
 template <typename T>
 void TestFillImpl(Image3<T>* img, const char* layout) {
   FillImage(T(1), img);
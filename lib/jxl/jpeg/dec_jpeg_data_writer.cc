@@ -15,6 +15,7 @@
 #include "lib/jxl/base/bits.h"
 #include "lib/jxl/base/byte_order.h"
 #include "lib/jxl/base/common.h"
+#include "lib/jxl/base/jpeg_entropy.h"
 #include "lib/jxl/frame_dimensions.h"
 #include "lib/jxl/image_bundle.h"
 #include "lib/jxl/jpeg/dec_jpeg_serialization_state.h"
@@ -40,12 +41,6 @@ const size_t kJpegBitWriterChunkSize = 16384;
 // DCTCodingState: maximum number of correction bits to buffer
 const int kJPEGMaxCorrectionBits = 1u << 16;
 
-// Returns non-zero if and only if x has a zero byte, i.e. one of
-// x & 0xff, x & 0xff00, ..., x & 0xff00000000000000 is zero.
-static JXL_INLINE uint64_t HasZeroByte(uint64_t x) {
-  return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
-}
-
 void JpegBitWriterInit(JpegBitWriter* bw,
                        std::deque<OutputChunk>* output_queue) {
   bw->output = output_queue;
@@ -87,25 +82,9 @@ static JXL_INLINE void DischargeBitBuffer(JpegBitWriter* bw, int nbits,
                                           uint64_t bits) {
   // At this point we are ready to emit the put_buffer to the output.
   // The JPEG format requires that after every 0xff byte in the entropy
-  // coded section, there is a zero byte, therefore we first check if any of
-  // the 8 bytes of put_buffer is 0xFF.
+  // coded section, there is a zero byte.
   bw->put_buffer |= (bits >> -bw->put_bits);
-  if (JXL_UNLIKELY(HasZeroByte(~bw->put_buffer))) {
-    // We have a 0xFF byte somewhere, examine each byte and append a zero
-    // byte if necessary.
-    EmitByte(bw, (bw->put_buffer >> 56) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 48) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 40) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 32) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 24) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 16) & 0xFF);
-    EmitByte(bw, (bw->put_buffer >> 8) & 0xFF);
-    EmitByte(bw, (bw->put_buffer) & 0xFF);
-  } else {
-    // We don't have any 0xFF bytes, output all 8 bytes without checking.
-    StoreBE64(bw->put_buffer, bw->data + bw->pos);
-    bw->pos += 8;
-  }
+  bw->pos += StoreBE64Stuffed(bw->put_buffer, bw->data + bw->pos);
 
   bw->put_bits += 64;
   bw->put_buffer = bits << bw->put_bits;
@@ -504,36 +483,40 @@ bool EncodeDCTBlockSequential(const coeff_t* coeffs, HuffmanCodeTable* dc_huff,
   if (dc_nbits) {
     WriteBits(bw, dc_nbits, temp & ((1u << dc_nbits) - 1));
   }
-  int16_t r = 0;
-
-  for (size_t i = 1; i < 64; i++) {
-    if ((temp = coeffs[kJPEGNaturalOrder[i]]) == 0) {
-      r++;
-    } else {
-      temp2 = temp >> (8 * sizeof(coeff_t) - 1);
-      temp += temp2;
-      temp2 ^= temp;
-      if (JXL_UNLIKELY(r > 15)) {
+  // Bit k of the mask is set for each non-zero AC coefficient at zig-zag
+  // position k, the zero runs are the gaps between the set bits.
+  uint64_t nonzero_mask =
+      NonZeroMask(coeffs, kJPEGNaturalOrder) & ~static_cast<uint64_t>(1);
+  int last_k = 0;
+  while (nonzero_mask != 0) {
+    const int k = static_cast<int>(Num0BitsBelowLS1Bit_Nonzero(nonzero_mask));
+    nonzero_mask &= nonzero_mask - 1;
+    int16_t r = k - last_k - 1;
+    last_k = k;
+    temp = coeffs[kJPEGNaturalOrder[k]];
+    temp2 = temp >> (8 * sizeof(coeff_t) - 1);
+    temp += temp2;
+    temp2 ^= temp;
+    if (JXL_UNLIKELY(r > 15)) {
+      WriteSymbol(0xf0, ac_huff, bw);
+      r -= 16;
+      if (r > 15) {
+        WriteSymbol(0xf0, ac_huff, bw);
+        r -= 16;
+      }
+      if (r > 15) {
         WriteSymbol(0xf0, ac_huff, bw);
         r -= 16;
-        if (r > 15) {
-          WriteSymbol(0xf0, ac_huff, bw);
-          r -= 16;
-        }
-        if (r > 15) {
-          WriteSymbol(0xf0, ac_huff, bw);
-          r -= 16;
-        }
       }
-      litmus |= temp2;
-      int ac_nbits =
-          FloorLog2Nonzero<uint32_t>(static_cast<uint16_t>(temp2)) + 1;
-      int symbol = (r << 4u) + ac_nbits;
-      WriteSymbolBits(symbol, ac_huff, bw, ac_nbits,
-                      temp & ((1 << ac_nbits) - 1));
-      r = 0;
     }
+    litmus |= temp2;
+    int ac_nbits =
+        FloorLog2Nonzero<uint32_t>(static_cast<uint16_t>(temp2)) + 1;
+    int symbol = (r << 4u) + ac_nbits;
+    WriteSymbolBits(symbol, ac_huff, bw, ac_nbits,
+                    temp & ((1 << ac_nbits) - 1));
   }
+  int16_t r = 63 - last_k;
 
   for (int i = 0; i < num_zero_runs; ++i) {
     WriteSymbol(0xf0, ac_huff, bw);
@@ -0,0 +1,331 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "lib/jxl/jpeg/enc_jpeg_arith_decode.h"
+
+#include <string.h>
+
+#include "lib/jxl/base/status.h"
+
+namespace jxl {
+namespace jpeg {
+
+namespace {
+
+// One row of Table D.2 of ITU-T T.81, the probability estimation state
+// machine of the QM-coder.
+struct QeEntry {
+  uint16_t qe;
+  uint8_t next_lps;
+  uint8_t next_mps;
+  uint8_t switch_mps;
+};
+
+// The last entry is a non-adapting state with probability close to 1/2, used
+// for the sign and refinement bits.
+constexpr int kFixedBinState = 113;
+
+/* clang-format off */
+constexpr QeEntry kQeTable[kFixedBinState + 1] = {
+  {0x5a1d,   1,   1, 1}, {0x2586,  14,   2, 0}, {0x1114,  16,   3, 0},
+  {0x080b,  18,   4, 0}, {0x03d8,  20,   5, 0}, {0x01da,  23,   6, 0},
+  {0x00e5,  25,   7, 0}, {0x006f,  28,   8, 0}, {0x0036,  30,   9, 0},
+  {0x001a,  33,  10, 0}, {0x000d,  35,  11, 0}, {0x0006,   9,  12, 0},
+  {0x0003,  10,  13, 0}, {0x0001,  12,  13, 0}, {0x5a7f,  15,  15, 1},
+  {0x3f25,  36,  16, 0}, {0x2cf2,  38,  17, 0}, {0x207c,  39,  18, 0},
+  {0x17b9,  40,  19, 0}, {0x1182,  42,  20, 0}, {0x0cef,  43,  21, 0},
+  {0x09a1,  45,  22, 0}, {0x072f,  46,  23, 0}, {0x055c,  48,  24, 0},
+  {0x0406,  49,  25, 0}, {0x0303,  51,  26, 0}, {0x0240,  52,  27, 0},
+  {0x01b1,  54,  28, 0}, {0x0144,  56,  29, 0}, {0x00f5,  57,  30, 0},
+  {0x00b7,  59,  31, 0}, {0x008a,  60,  32, 0}, {0x0068,  62,  33, 0},
+  {0x004e,  63,  34, 0}, {0x003b,  32,  35, 0}, {0x002c,  33,   9, 0},
+  {0x5ae1,  37,  37, 1}, {0x484c,  64,  38, 0}, {0x3a0d,  65,  39, 0},
+  {0x2ef1,  67,  40, 0}, {0x261f,  68,  41, 0}, {0x1f33,  69,  42, 0},
+  {0x19a8,  70,  43, 0}, {0x1518,  72,  44, 0}, {0x1177,  73,  45, 0},
+  {0x0e74,  74,  46, 0}, {0x0bfb,  75,  47, 0}, {0x09f8,  77,  48, 0},
+  {0x0861,  78,  49, 0}, {0x0706,  79,  50, 0}, {0x05cd,  48,  51, 0},
+  {0x04de,  50,  52, 0}, {0x040f,  50,  53, 0}, {0x0363,  51,  54, 0},
+  {0x02d4,  52,  55, 0}, {0x025c,  53,  56, 0}, {0x01f8,  54,  57, 0},
+  {0x01a4,  55,  58, 0}, {0x0160,  56,  59, 0}, {0x0125,  57,  60, 0},
+  {0x00f6,  58,  61, 0}, {0x00cb,  59,  62, 0}, {0x00ab,  61,  63, 0},
+  {0x008f,  61,  32, 0}, {0x5b12,  65,  65, 1}, {0x4d04,  80,  66, 0},
+  {0x412c,  81,  67, 0}, {0x37d8,  82,  68, 0}, {0x2fe8,  83,  69, 0},
+  {0x293c,  84,  70, 0}, {0x2379,  86,  71, 0}, {0x1edf,  87,  72, 0},
+  {0x1aa9,  87,  73, 0}, {0x174e,  72,  74, 0}, {0x1424,  72,  75, 0},
+  {0x119c,  74,  76, 0}, {0x0f6b,  74,  77, 0}, {0x0d51,  75,  78, 0},
+  {0x0bb6,  77,  79, 0}, {0x0a40,  77,  48, 0}, {0x5832,  80,  81, 1},
+  {0x4d1c,  88,  82, 0}, {0x438e,  89,  83, 0}, {0x3bdd,  90,  84, 0},
+  {0x34ee,  91,  85, 0}, {0x2eae,  92,  86, 0}, {0x299a,  93,  87, 0},
+  {0x2516,  86,  71, 0}, {0x5570,  88,  89, 1}, {0x4ca9,  95,  90, 0},
+  {0x44d9,  96,  91, 0}, {0x3e22,  97,  92, 0}, {0x3824,  99,  93, 0},
+  {0x32b4,  99,  94, 0}, {0x2e17,  93,  86, 0}, {0x56a8,  95,  96, 1},
+  {0x4f46, 101,  97, 0}, {0x47e5, 102,  98, 0}, {0x41cf, 103,  99, 0},
+  {0x3c3d, 104, 100, 0}, {0x375e,  99,  93, 0}, {0x5231, 105, 102, 0},
+  {0x4c0f, 106, 103, 0}, {0x4639, 107, 104, 0}, {0x415e, 103,  99, 0},
+  {0x5627, 105, 106, 1}, {0x50e7, 108, 107, 0}, {0x4b85, 109, 103, 0},
+  {0x5597, 110, 109, 0}, {0x504f, 111, 107, 0}, {0x5a10, 110, 111, 1},
+  {0x5522, 112, 109, 0}, {0x59eb, 112, 111, 1}, {0x5a1d, 113, 113, 0},
+};
+/* clang-format on */
+
+// Stores a decoded coefficient value, checking that it fits into coeff_t.
+#define JXL_JPEG_ARITH_STORE_COEFF(dst, value)                 \
+  do {                                                         \
+    const int v_ = (value);                                    \
+    (dst) = v_;                                                \
+    if ((dst) != v_) {                                         \
+      return JXL_FAILURE("Invalid coefficient value %d", v_); \
+    }                                                          \
+  } while (0)
+
+}  // namespace
+
+void ArithmeticDecoder::Reset(size_t pos) {
+  pos_ = pos;
+  marker_pos_ = 0;
+  c_ = 0;
+  a_ = 0;
+  // Forces reading the two initial bytes into the C register.
+  ct_ = -16;
+}
+
+int ArithmeticDecoder::NextByte() {
+  // Once a marker was found, the convention is to supply zero data until
+  // decoding of the segment is complete.
+  if (marker_pos_ != 0) return 0;
+  if (pos_ >= len_) {
+    marker_pos_ = len_;
+    return 0;
+  }
+  int c = data_[pos_++];
+  if (c == 0xff) {
+    // Skip fill bytes.
+    while (pos_ < len_ && data_[pos_] == 0xff) ++pos_;
+    if (pos_ >= len_) {
+      marker_pos_ = len_;
+      return 0;
+    }
+    if (data_[pos_] == 0) {
+      // Stuffed zero byte.
+      ++pos_;
+    } else {
+      marker_pos_ = pos_ - 1;
+      c = 0;
+    }
+  }
+  return c;
+}
+
+int ArithmeticDecoder::DecodeBit(uint8_t* st) {
+  // Renormalization and data input, section D.2.6.
+  while (a_ < 0x8000) {
+    if (--ct_ < 0) {
+      c_ = (c_ << 8) | NextByte();
+      ct_ += 8;
+      // Still reading the two initial bytes of the segment: once both are in,
+      // A becomes 0x10000 after the shift below.
+      if (ct_ < 0 && ++ct_ == 0) a_ = 0x8000;
+    }
+    a_ <<= 1;
+  }
+  int sv = *st;
+  const QeEntry& e = kQeTable[sv & 0x7f];
+  const int64_t qe = e.qe;
+  const int nl = e.next_lps | (e.switch_mps << 7);
+  const int nm = e.next_mps;
+  // Decoding and probability estimation, sections D.2.4 and D.2.5.
+  int64_t temp = a_ - qe;
+  a_ = temp;
+  temp <<= ct_;
+  if (c_ >= temp) {
+    c_ -= temp;
+    // Conditional LPS exchange.
+    if (a_ < qe) {
+      *st = (sv & 0x80) ^ nm;
+    } else {
+      *st = (sv & 0x80) ^ nl;
+      sv ^= 0x80;
+    }
+    a_ = qe;
+  } else if (a_ < 0x8000) {
+    // Conditional MPS exchange.
+    if (a_ < qe) {
+      *st = (sv & 0x80) ^ nl;
+      sv ^= 0x80;
+    } else {
+      *st = (sv & 0x80) ^ nm;
+    }
+  }
+  return sv >> 7;
+}
+
+size_t ArithmeticDecoder::MarkerPos() {
+  if (marker_pos_ != 0) return marker_pos_;
+  // The decoder did not consume the whole segment, skip the remaining
+  // entropy-coded bytes.
+  size_t pos = pos_;
+  while (pos + 1 < len_) {
+    if (data_[pos] == 0xff && data_[pos + 1] != 0 && data_[pos + 1] != 0xff) {
+      return pos;
+    }
+    pos += (data_[pos] == 0xff && data_[pos + 1] == 0) ? 2 : 1;
+  }
+  return len_;
+}
+
+ArithScanState::ArithScanState() : fixed_bin(kFixedBinState) {
+  memset(dc_stats, 0, sizeof(dc_stats));
+  memset(ac_stats, 0, sizeof(ac_stats));
+  memset(dc_context, 0, sizeof(dc_context));
+  memset(last_dc, 0, sizeof(last_dc));
+}
+
+void ArithScanState::ResetComponent(int comp, int dc_tbl, int ac_tbl,
+                                    bool reset_dc, bool reset_ac) {
+  if (reset_dc) {
+    memset(dc_stats[dc_tbl], 0, sizeof(dc_stats[dc_tbl]));
+    last_dc[comp] = 0;
+    dc_context[comp] = 0;
+  }
+  if (reset_ac) {
+    memset(ac_stats[ac_tbl], 0, sizeof(ac_stats[ac_tbl]));
+  }
+}
+
+bool DecodeArithDCFirst(const ArithConditioning& cond, int dc_tbl, int comp,
+                        int Al, ArithmeticDecoder* ad, ArithScanState* s,
+                        coeff_t* coeffs) {
+  uint8_t* st = s->dc_stats[dc_tbl] + s->dc_context[comp];
+  if (ad->DecodeBit(st) == 0) {
+    s->dc_context[comp] = 0;
+  } else {
+    // Figures F.21 and F.22: decoding the sign of a non-zero difference.
+    const int sign = ad->DecodeBit(st + 1);
+    st += 2 + sign;
+    // Figure F.23: decoding the magnitude category.
+    int m = ad->DecodeBit(st);
+    if (m != 0) {
+      st = s->dc_stats[dc_tbl] + 20;  // Table F.4: X1 = 20
+      while (ad->DecodeBit(st)) {
+        if ((m <<= 1) == 0x8000) {
+          return JXL_FAILURE("Invalid arithmetic coded DC difference.");
+        }
+        ++st;
+      }
+    }
+    // Section F.1.4.4.1.2: conditioning category of the next difference.
+    if (m < ((1 << cond.dc_L[dc_tbl]) >> 1)) {
+      s->dc_context[comp] = 0;
+    } else if (m > ((1 << cond.dc_U[dc_tbl]) >> 1)) {
+      s->dc_context[comp] = 12 + sign * 4;
+    } else {
+      s->dc_context[comp] = 4 + sign * 4;
+    }
+    // Figure F.24: decoding the magnitude bit pattern.
+    int v = m;
+    st += 14;
+    while (m >>= 1) {
+      if (ad->DecodeBit(st)) v |= m;
+    }
+    v += 1;
+    if (sign) v = -v;
+    s->last_dc[comp] += v;
+  }
+  JXL_JPEG_ARITH_STORE_COEFF(coeffs[0], s->last_dc[comp] * (1 << Al));
+  return true;
+}
+
+bool DecodeArithACFirst(const ArithConditioning& cond, int ac_tbl, int Ss,
+                        int Se, int Al, ArithmeticDecoder* ad,
+                        ArithScanState* s, coeff_t* coeffs) {
+  uint8_t* stats = s->ac_stats[ac_tbl];
+  // Figure F.20: decoding the AC coefficients.
+  for (int k = Ss; k <= Se; ++k) {
+    uint8_t* st = stats + 3 * (k - 1);
+    if (ad->DecodeBit(st)) break;  // end-of-block
+    while (ad->DecodeBit(st + 1) == 0) {
+      st += 3;
+      if (++k > Se) {
+        return JXL_FAILURE("Out-of-band AC coefficient, band was %d-%d", Ss,
+                           Se);
+      }
+    }
+    // Figures F.21 and F.22: decoding the sign of a non-zero value.
+    const int sign = ad->DecodeBit(&s->fixed_bin);
+    st += 2;
+    // Figure F.23: decoding the magnitude category.
+    int m = ad->DecodeBit(st);
+    if (m != 0 && ad->DecodeBit(st)) {
+      m <<= 1;
+      st = stats + (k <= cond.ac_K[ac_tbl] ? 189 : 217);
+      while (ad->DecodeBit(st)) {
+        if ((m <<= 1) == 0x8000) {
+          return JXL_FAILURE("Invalid arithmetic coded AC coefficient %d", k);
+        }
+        ++st;
+      }
+    }
+    // Figure F.24: decoding the magnitude bit pattern.
+    int v = m;
+    st += 14;
+    while (m >>= 1) {
+      if (ad->DecodeBit(st)) v |= m;
+    }
+    v += 1;
+    if (sign) v = -v;
+    JXL_JPEG_ARITH_STORE_COEFF(coeffs[kJPEGNaturalOrder[k]], v * (1 << Al));
+  }
+  return true;
+}
+
+void DecodeArithDCRefine(int Al, ArithmeticDecoder* ad, ArithScanState* s,
+                         coeff_t* coeffs) {
+  if (ad->DecodeBit(&s->fixed_bin)) {
+    coeffs[0] |= (1 << Al);
+  }
+}
+
+bool DecodeArithACRefine(int ac_tbl, int Ss, int Se, int Al,
+                         ArithmeticDecoder* ad, ArithScanState* s,
+                         coeff_t* coeffs) {
+  uint8_t* stats = s->ac_stats[ac_tbl];
+  const int p1 = 1 << Al;
+  // The end-of-block position of the previous stage.
+  int kex = Se;
+  for (; kex > 0; --kex) {
+    if (coeffs[kJPEGNaturalOrder[kex]] != 0) break;
+  }
+  // Figure G.10: decoding the AC refinement.
+  for (int k = Ss; k <= Se; ++k) {
+    uint8_t* st = stats + 3 * (k - 1);
+    if (k > kex && ad->DecodeBit(st)) break;  // end-of-block
+    for (;;) {
+      coeff_t* coeff = &coeffs[kJPEGNaturalOrder[k]];
+      if (*coeff != 0) {
+        // Correction bit of a previously non-zero coefficient.
+        if (ad->DecodeBit(st + 2)) {
+          JXL_JPEG_ARITH_STORE_COEFF(*coeff, *coeff + (*coeff < 0 ? -p1 : p1));
+        }
+        break;
+      }
+      if (ad->DecodeBit(st + 1)) {
+        // Newly non-zero coefficient.
+        *coeff = ad->DecodeBit(&s->fixed_bin) ? -p1 : p1;
+        break;
+      }
+      st += 3;
+      if (++k > Se) {
+        return JXL_FAILURE("Out-of-band AC coefficient, band was %d-%d", Ss,
+                           Se);
+      }
+    }
+  }
+  return true;
+}
+
+#undef JXL_JPEG_ARITH_STORE_COEFF
+
+}  // namespace jpeg
+}  // namespace jxl
@@ -0,0 +1,121 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Arithmetic decoding of the entropy-coded segments of a jpeg file, as
+// specified in ITU-T T.81 Annex D, F.2.4 and G.2. The block decoders below
+// yield the same quantized coefficients as the Huffman decoder of the jpeg
+// reader, so that both kinds of files are ingested into the same JPEGData.
+
+#ifndef LIB_JXL_JPEG_ENC_JPEG_ARITH_DECODE_H_
+#define LIB_JXL_JPEG_ENC_JPEG_ARITH_DECODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib/jxl/jpeg/jpeg_data.h"
+
+namespace jxl {
+namespace jpeg {
+
+// Number of arithmetic coding conditioning table slots (Tb in DAC and SOS).
+constexpr int kMaxArithTables = 4;
+// Sizes of the statistics areas of one DC and one AC conditioning table.
+constexpr int kArithDCStatBins = 64;
+constexpr int kArithACStatBins = 256;
+
+// Conditioning parameters of the arithmetic coder, as defined by the DAC
+// marker, indexed by table slot. The defaults are given in section F.1.4.4.
+struct ArithConditioning {
+  ArithConditioning() {
+    for (int i = 0; i < kMaxArithTables; ++i) {
+      dc_L[i] = 0;
+      dc_U[i] = 1;
+      ac_K[i] = 5;
+    }
+  }
+  uint8_t dc_L[kMaxArithTables];
+  uint8_t dc_U[kMaxArithTables];
+  uint8_t ac_K[kMaxArithTables];
+};
+
+// Adaptive binary arithmetic decoder (QM-coder) reading one entropy-coded
+// segment of a scan.
+class ArithmeticDecoder {
+ public:
+  ArithmeticDecoder(const uint8_t* data, size_t len, size_t pos)
+      : data_(data), len_(len) {
+    Reset(pos);
+  }
+
+  // Starts decoding a new entropy-coded segment at pos, i.e. after the SOS
+  // marker segment or after a restart marker.
+  void Reset(size_t pos);
+
+  // Decodes one binary decision using and updating the probability estimate
+  // in *st.
+  int DecodeBit(uint8_t* st);
+
+  // Returns the position of the marker that terminates the current
+  // entropy-coded segment, or len if the data ended before a marker.
+  size_t MarkerPos();
+
+ private:
+  int NextByte();
+
+  const uint8_t* data_;
+  const size_t len_;
+  size_t pos_;
+  // Position of the marker that ended the segment, or 0 if not yet seen.
+  size_t marker_pos_;
+  int64_t c_;
+  int64_t a_;
+  int ct_;
+};
+
+// Statistics areas and DC prediction state of the arithmetic decoder for one
+// scan.
+struct ArithScanState {
+  ArithScanState();
+
+  // Clears the DC and/or AC statistics of the conditioning tables used by
+  // component comp of the scan, and its DC prediction. Called at the start of
+  // the scan and after each restart marker.
+  void ResetComponent(int comp, int dc_tbl, int ac_tbl, bool reset_dc,
+                      bool reset_ac);
+
+  uint8_t dc_stats[kMaxArithTables][kArithDCStatBins];
+  uint8_t ac_stats[kMaxArithTables][kArithACStatBins];
+  // The fixed probability estimate used for sign and refinement bits.
+  uint8_t fixed_bin;
+  int dc_context[kMaxComponents];
+  int last_dc[kMaxComponents];
+};
+
+// Decodes the DC coefficient of one block in a sequential scan or in the
+// first DC scan of a progressive jpeg, into coeffs[0].
+bool DecodeArithDCFirst(const ArithConditioning& cond, int dc_tbl, int comp,
+                        int Al, ArithmeticDecoder* ad, ArithScanState* s,
+                        coeff_t* coeffs);
+
+// Decodes the AC coefficients Ss..Se of one block in a sequential scan or in
+// a first AC scan of a progressive jpeg.
+bool DecodeArithACFirst(const ArithConditioning& cond, int ac_tbl, int Ss,
+                        int Se, int Al, ArithmeticDecoder* ad,
+                        ArithScanState* s, coeff_t* coeffs);
+
+// Decodes the refinement bit of the DC coefficient of one block.
+void DecodeArithDCRefine(int Al, ArithmeticDecoder* ad, ArithScanState* s,
+                         coeff_t* coeffs);
+
+// Decodes the refinement bits and newly non-zero AC coefficients Ss..Se of
+// one block in a progressive refinement scan.
+bool DecodeArithACRefine(int ac_tbl, int Ss, int Se, int Al,
+                         ArithmeticDecoder* ad, ArithScanState* s,
+                         coeff_t* coeffs);
+
+}  // namespace jpeg
+}  // namespace jxl
+
+#endif  // LIB_JXL_JPEG_ENC_JPEG_ARITH_DECODE_H_
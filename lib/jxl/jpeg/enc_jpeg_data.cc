@@ -234,6 +234,10 @@ Status SetColorEncodingFromJpegData(const jpeg::JPEGData& jpg,
 
 Status EncodeJPEGData(JPEGData& jpeg_data, PaddedBytes* bytes,
                       const CompressParams& cparams) {
+  if (jpeg_data.is_arithmetic_coded) {
+    return JXL_FAILURE(
+        "Reconstruction data can not describe arithmetic coded JPEGs");
+  }
   jpeg_data.app_marker_type.resize(jpeg_data.app_data.size(),
                                    AppMarkerType::kUnknown);
   JXL_RETURN_IF_ERROR(DetectIccProfile(jpeg_data));
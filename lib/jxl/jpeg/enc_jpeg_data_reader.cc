@@ -16,6 +16,7 @@
 #include "lib/jxl/base/printf_macros.h"
 #include "lib/jxl/base/status.h"
 #include "lib/jxl/frame_dimensions.h"
+#include "lib/jxl/jpeg/enc_jpeg_arith_decode.h"
 #include "lib/jxl/jpeg/enc_jpeg_huffman_decode.h"
 #include "lib/jxl/jpeg/jpeg_data.h"
 
@@ -78,7 +79,9 @@ bool ProcessSOF(const uint8_t* data, const size_t len, JpegReadMode mode,
   int height = ReadUint16(data, pos);
   int width = ReadUint16(data, pos);
   int num_components = ReadUint8(data, pos);
-  // 'jbrd' is hardcoded for 8bits:
+  // The JPEG recompression mode of the codestream and 'jbrd' are defined for
+  // 8-bit samples only, so 12-bit JPEGs can not be transcoded at the
+  // coefficient level and have to be recompressed from pixels.
   JXL_JPEG_VERIFY_INPUT(precision, 8, 8, PRECISION);
   JXL_JPEG_VERIFY_INPUT(height, 1, kMaxDimPixels, HEIGHT);
   JXL_JPEG_VERIFY_INPUT(width, 1, kMaxDimPixels, WIDTH);
@@ -136,8 +139,8 @@ bool ProcessSOF(const uint8_t* data, const size_t len, JpegReadMode mode,
 
 // Reads the Start of Scan (SOS) marker segment and fills in *scan_info with the
 // parsed data.
-bool ProcessSOS(const uint8_t* data, const size_t len, size_t* pos,
-                JPEGData* jpg) {
+bool ProcessSOS(const uint8_t* data, const size_t len, bool is_arithmetic,
+                size_t* pos, JPEGData* jpg) {
   const size_t start_pos = *pos;
   JXL_JPEG_VERIFY_LEN(3);
   size_t marker_len = ReadUint16(data, pos);
@@ -188,8 +191,9 @@ bool ProcessSOS(const uint8_t* data, const size_t len, size_t* pos,
     JXL_WARNING("Invalid progressive parameters: Al=%d Ah=%d", scan_info.Al,
                 scan_info.Ah);
   }
-  // Check that all the Huffman tables needed for this scan are defined.
-  for (size_t i = 0; i < comps_in_scan; ++i) {
+  // Check that all the Huffman tables needed for this scan are defined. The
+  // conditioning tables of arithmetic coding all have defaults.
+  for (size_t i = 0; i < comps_in_scan && !is_arithmetic; ++i) {
     bool found_dc_table = false;
     bool found_ac_table = false;
     for (size_t j = 0; j < jpg->huffman_code.size(); ++j) {
@@ -350,6 +354,37 @@ bool ProcessDRI(const uint8_t* data, const size_t len, size_t* pos,
   return true;
 }
 
+// Reads the Define Arithmetic Coding conditioning (DAC) marker segment and
+// saves the conditioning parameters into *cond.
+bool ProcessDAC(const uint8_t* data, const size_t len, size_t* pos,
+                ArithConditioning* cond) {
+  const size_t start_pos = *pos;
+  JXL_JPEG_VERIFY_LEN(2);
+  size_t marker_len = ReadUint16(data, pos);
+  JXL_JPEG_VERIFY_INPUT(marker_len, 2, 65535, MARKER_LEN);
+  JXL_JPEG_VERIFY_LEN(marker_len - 2);
+  while (*pos + 2 <= start_pos + marker_len) {
+    int table_index = ReadUint8(data, pos);
+    int value = ReadUint8(data, pos);
+    int is_ac_table = table_index >> 4;
+    table_index &= 0xf;
+    JXL_JPEG_VERIFY_INPUT(is_ac_table, 0, 1, ARITH_TBL_CLASS);
+    JXL_JPEG_VERIFY_INPUT(table_index, 0, kMaxArithTables - 1, ARITH_TBL_INDEX);
+    if (is_ac_table) {
+      JXL_JPEG_VERIFY_INPUT(value, 1, 63, ARITH_AC_K);
+      cond->ac_K[table_index] = value;
+    } else {
+      int L = value & 0xf;
+      int U = value >> 4;
+      JXL_JPEG_VERIFY_INPUT(L, 0, U, ARITH_DC_L);
+      cond->dc_L[table_index] = L;
+      cond->dc_U[table_index] = U;
+    }
+  }
+  JXL_JPEG_VERIFY_MARKER_END();
+  return true;
+}
+
 // Saves the APP marker segment as a string to *jpg.
 bool ProcessAPP(const uint8_t* data, const size_t len, size_t* pos,
                 JPEGData* jpg) {
@@ -745,12 +780,105 @@ bool ProcessRestart(const uint8_t* data, const size_t len,
   return true;
 }
 
+// Decodes the arithmetic coded entropy-coded segments of the scan into the
+// coefficients of *jpg, and sets *pos to the marker following the scan.
+bool ProcessArithmeticScan(const uint8_t* data, const size_t len,
+                           const ArithConditioning& cond,
+                           const JPEGScanInfo& scan_info, int MCU_rows,
+                           int MCUs_per_row, bool is_progressive, int Ss,
+                           int Se, int Ah, int Al, size_t* pos,
+                           JPEGData* jpg) {
+  if (is_progressive && Ss == 0 && Se != 0) {
+    return JXL_FAILURE("Progressive scan mixes DC and AC coefficients.");
+  }
+  const bool is_interleaved = (scan_info.num_components > 1);
+  // Section F.1.4 and G.1.3: statistics of a scan are reset at its start and
+  // after each restart marker.
+  const bool reset_dc = !is_progressive || (Ss == 0 && Ah == 0);
+  const bool reset_ac = !is_progressive || Ss > 0;
+  ArithmeticDecoder ad(data, len, *pos);
+  ArithScanState state;
+  const auto reset_state = [&]() {
+    for (size_t i = 0; i < scan_info.num_components; ++i) {
+      const JPEGComponentScanInfo& si = scan_info.components[i];
+      state.ResetComponent(si.comp_idx, si.dc_tbl_idx, si.ac_tbl_idx,
+                           reset_dc, reset_ac);
+    }
+  };
+  reset_state();
+  int restarts_to_go = jpg->restart_interval;
+  int next_restart_marker = 0;
+  for (int mcu_y = 0; mcu_y < MCU_rows; ++mcu_y) {
+    for (int mcu_x = 0; mcu_x < MCUs_per_row; ++mcu_x) {
+      // Handle the restart intervals.
+      if (jpg->restart_interval > 0) {
+        if (restarts_to_go == 0) {
+          const size_t marker_pos = ad.MarkerPos();
+          const int expected_marker = 0xd0 + next_restart_marker;
+          if (marker_pos + 2 > len || data[marker_pos + 1] != expected_marker) {
+            return JXL_FAILURE("Did not find expected restart marker %d",
+                               expected_marker);
+          }
+          ad.Reset(marker_pos + 2);
+          reset_state();
+          next_restart_marker = (next_restart_marker + 1) & 0x7;
+          restarts_to_go = jpg->restart_interval;
+        }
+        --restarts_to_go;
+      }
+      // Decode one MCU.
+      for (size_t i = 0; i < scan_info.num_components; ++i) {
+        const JPEGComponentScanInfo& si = scan_info.components[i];
+        JPEGComponent* c = &jpg->components[si.comp_idx];
+        int nblocks_y = is_interleaved ? c->v_samp_factor : 1;
+        int nblocks_x = is_interleaved ? c->h_samp_factor : 1;
+        for (int iy = 0; iy < nblocks_y; ++iy) {
+          for (int ix = 0; ix < nblocks_x; ++ix) {
+            int block_y = mcu_y * nblocks_y + iy;
+            int block_x = mcu_x * nblocks_x + ix;
+            int block_idx = block_y * c->width_in_blocks + block_x;
+            coeff_t* coeffs = &c->coeffs[block_idx * kDCTBlockSize];
+            if (Ah == 0) {
+              if (Ss == 0 &&
+                  !DecodeArithDCFirst(cond, si.dc_tbl_idx, si.comp_idx, Al,
+                                      &ad, &state, coeffs)) {
+                return false;
+              }
+              if (Se > 0 &&
+                  !DecodeArithACFirst(cond, si.ac_tbl_idx, std::max(Ss, 1),
+                                      Se, Al, &ad, &state, coeffs)) {
+                return false;
+              }
+            } else {
+              if (Ss == 0) {
+                DecodeArithDCRefine(Al, &ad, &state, coeffs);
+              }
+              if (Se > 0 &&
+                  !DecodeArithACRefine(si.ac_tbl_idx, std::max(Ss, 1), Se, Al,
+                                       &ad, &state, coeffs)) {
+                return false;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  *pos = ad.MarkerPos();
+  if (*pos >= len) {
+    return JXL_FAILURE("Unexpected end of file during scan.");
+  }
+  return true;
+}
+
 bool ProcessScan(const uint8_t* data, const size_t len,
                  const std::vector<HuffmanTableEntry>& dc_huff_lut,
                  const std::vector<HuffmanTableEntry>& ac_huff_lut,
+                 const ArithConditioning& arith_cond,
                  uint16_t scan_progression[kMaxComponents][kDCTBlockSize],
-                 bool is_progressive, size_t* pos, JPEGData* jpg) {
-  if (!ProcessSOS(data, len, pos, jpg)) {
+                 bool is_progressive, bool is_arithmetic, size_t* pos,
+                 JPEGData* jpg) {
+  if (!ProcessSOS(data, len, is_arithmetic, pos, jpg)) {
     return false;
   }
   JPEGScanInfo* scan_info = &jpg->scan_info.back();
@@ -771,12 +899,6 @@ bool ProcessScan(const uint8_t* data, const size_t len,
     MCUs_per_row = DivCeil(jpg->width * c.h_samp_factor, 8 * max_h_samp_factor);
     MCU_rows = DivCeil(jpg->height * c.v_samp_factor, 8 * max_v_samp_factor);
   }
-  coeff_t last_dc_coeff[kMaxComponents] = {0};
-  BitReaderState br(data, len, *pos);
-  int restarts_to_go = jpg->restart_interval;
-  int next_restart_marker = 0;
-  int eobrun = -1;
-  int block_scan_index = 0;
   const int Al = is_progressive ? scan_info->Al : 0;
   const int Ah = is_progressive ? scan_info->Ah : 0;
   const int Ss = is_progressive ? scan_info->Ss : 0;
@@ -803,6 +925,17 @@ bool ProcessScan(const uint8_t* data, const size_t len,
   if (Al > 10) {
     return JXL_FAILURE("Scan parameter Al=%d is not supported.", Al);
   }
+  if (is_arithmetic) {
+    return ProcessArithmeticScan(data, len, arith_cond, *scan_info, MCU_rows,
+                                 MCUs_per_row, is_progressive, Ss, Se, Ah, Al,
+                                 pos, jpg);
+  }
+  coeff_t last_dc_coeff[kMaxComponents] = {0};
+  BitReaderState br(data, len, *pos);
+  int restarts_to_go = jpg->restart_interval;
+  int next_restart_marker = 0;
+  int eobrun = -1;
+  int block_scan_index = 0;
   for (int mcu_y = 0; mcu_y < MCU_rows; ++mcu_y) {
     for (int mcu_x = 0; mcu_x < MCUs_per_row; ++mcu_x) {
       // Handle the restart intervals.
@@ -904,7 +1037,7 @@ bool FixupIndexes(JPEGData* jpg) {
 size_t FindNextMarker(const uint8_t* data, const size_t len, size_t pos) {
   // kIsValidMarker[i] == 1 means (0xc0 + i) is a valid marker.
   static const uint8_t kIsValidMarker[] = {
-      1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
       1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
       1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
   };
@@ -938,6 +1071,8 @@ bool ReadJpeg(const uint8_t* data, const size_t len, JpegReadMode mode,
 
   jpg->padding_bits.resize(0);
   bool is_progressive = false;  // default
+  bool is_arithmetic = false;
+  ArithConditioning arith_cond;
   do {
     // Read next marker.
     size_t num_skipped = FindNextMarker(data, len, pos);
@@ -959,9 +1094,21 @@ bool ReadJpeg(const uint8_t* data, const size_t len, JpegReadMode mode,
         ok = ProcessSOF(data, len, mode, &pos, jpg);
         found_sof = true;
         break;
+      case 0xc9:
+      case 0xca:
+        // Arithmetic coded extended sequential and progressive DCT.
+        is_progressive = (marker == 0xca);
+        is_arithmetic = true;
+        jpg->is_arithmetic_coded = true;
+        ok = ProcessSOF(data, len, mode, &pos, jpg);
+        found_sof = true;
+        break;
       case 0xc4:
         ok = ProcessDHT(data, len, mode, &dc_huff_lut, &ac_huff_lut, &pos, jpg);
         break;
+      case 0xcc:
+        ok = ProcessDAC(data, len, &pos, &arith_cond);
+        break;
       case 0xd0:
       case 0xd1:
       case 0xd2:
@@ -977,8 +1124,9 @@ bool ReadJpeg(const uint8_t* data, const size_t len, JpegReadMode mode,
         break;
       case 0xda:
         if (mode == JpegReadMode::kReadAll) {
-          ok = ProcessScan(data, len, dc_huff_lut, ac_huff_lut,
-                           scan_progression, is_progressive, &pos, jpg);
+          ok = ProcessScan(data, len, dc_huff_lut, ac_huff_lut, arith_cond,
+                           scan_progression, is_progressive, is_arithmetic,
+                           &pos, jpg);
         }
         break;
       case 0xdb:
@@ -1037,7 +1185,7 @@ bool ReadJpeg(const uint8_t* data, const size_t len, JpegReadMode mode,
     if (!FixupIndexes(jpg)) {
       return false;
     }
-    if (jpg->huffman_code.empty()) {
+    if (jpg->huffman_code.empty() && !is_arithmetic) {
       // Section B.2.4.2: "If a table has never been defined for a particular
       // destination, then when this destination is specified in a scan header,
       // the results are unpredictable."
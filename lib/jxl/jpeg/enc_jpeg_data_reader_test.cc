@@ -0,0 +1,354 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "lib/jxl/jpeg/enc_jpeg_data_reader.h"
+
+#include <jxl/encode.h>
+#include <jxl/encode_cxx.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "lib/jxl/jpeg/jpeg_data.h"
+#include "lib/jxl/testing.h"
+
+namespace jxl {
+namespace jpeg {
+namespace {
+
+// Small quality 75 jpeg files written by libjpeg-turbo with arithmetic coding,
+// and their Huffman coded (optimized) twins, compressed from the same pixels
+// with otherwise the same settings, so that they have the same quantized
+// coefficients. They cover sequential and progressive scans, restart
+// intervals and 4:2:0 chroma subsampling.
+
+// 16x16, 4:4:4, sequential.
+const uint8_t kArithSequential444[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc9, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x10, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xcc, 0x00, 0x0a, 0x00, 0x10, 0x10, 0x05, 0x01,
+    0x10, 0x11, 0x05, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3f, 0x00, 0xff, 0x00, 0x68, 0xab, 0x74, 0x09, 0xff,
+    0x00, 0x52, 0xec, 0xc9, 0x64, 0x2c, 0x35, 0x37, 0x1b, 0x63, 0x93, 0x8b,
+    0x0f, 0xcf, 0x64, 0x70, 0xf3, 0xde, 0xe4, 0x2e, 0x95, 0x01, 0x06, 0xa7,
+    0xfe, 0xbd, 0x27, 0x36, 0x19, 0x22, 0xee, 0xd4, 0x78, 0x18, 0x37, 0x1f,
+    0x03, 0xe0, 0xff, 0xd9,
+};
+const uint8_t kHuffmanSequential444[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc0, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x10, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x15, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x02, 0xff, 0xc4, 0x00, 0x1c, 0x10, 0x00, 0x01, 0x03, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x04, 0x12, 0x05, 0x14, 0x21, 0x81, 0xf1, 0xff, 0xc4, 0x00, 0x16,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0xff, 0xc4, 0x00, 0x16,
+    0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0xff, 0xda, 0x00, 0x0c,
+    0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0x2e, 0xc2,
+    0x9d, 0x64, 0x31, 0x39, 0xe8, 0x0e, 0xab, 0x66, 0x95, 0x94, 0xb0, 0xa7,
+    0x59, 0x0c, 0x4e, 0x7a, 0x03, 0xa9, 0x99, 0x6b, 0x61, 0x4e, 0xb2, 0x18,
+    0x9c, 0xf4, 0x07, 0x56, 0xec, 0xd8, 0xac, 0xa1, 0x85, 0x3a, 0xc8, 0x62,
+    0x73, 0xd0, 0x1d, 0x4c, 0xcb, 0x7f, 0xff, 0xd9,
+};
+
+// 16x16, 4:4:4, progressive, one MCU per restart interval.
+const uint8_t kArithProgressive444Restart[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xca, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x10, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xcc, 0x00, 0x06, 0x00, 0x10, 0x01, 0x10, 0xff,
+    0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00,
+    0x02, 0x10, 0x03, 0x10, 0x00, 0x00, 0x01, 0xfe, 0xd1, 0xe1, 0xff, 0xd0,
+    0x42, 0x40, 0xff, 0xd1, 0xc4, 0xb7, 0xf4, 0xff, 0xd2, 0xd1, 0xe2, 0x6b,
+    0x85, 0xff, 0xcc, 0x00, 0x04, 0x10, 0x05, 0xff, 0xda, 0x00, 0x08, 0x01,
+    0x01, 0x00, 0x01, 0x05, 0x02, 0x18, 0x11, 0x70, 0xff, 0xd0, 0x18, 0x11,
+    0x70, 0xff, 0xd1, 0x18, 0x11, 0x70, 0xff, 0xd2, 0x18, 0x11, 0x70, 0xff,
+    0xcc, 0x00, 0x04, 0x11, 0x05, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01,
+    0x01, 0x3f, 0x01, 0x80, 0xff, 0xd0, 0x80, 0xff, 0xd1, 0x80, 0xff, 0xd2,
+    0x80, 0xff, 0xcc, 0x00, 0x04, 0x11, 0x05, 0xff, 0xda, 0x00, 0x08, 0x01,
+    0x02, 0x01, 0x01, 0x3f, 0x01, 0xa4, 0xff, 0xd0, 0xa4, 0xff, 0xd1, 0xa4,
+    0xff, 0xd2, 0xa4, 0xff, 0xcc, 0x00, 0x04, 0x10, 0x05, 0xff, 0xda, 0x00,
+    0x08, 0x01, 0x01, 0x00, 0x06, 0x3f, 0x02, 0xc0, 0xff, 0xd0, 0xc0, 0xff,
+    0xd1, 0xc0, 0xff, 0xd2, 0xc0, 0xff, 0xcc, 0x00, 0x04, 0x10, 0x05, 0xff,
+    0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x21, 0xa5, 0xef, 0x40,
+    0xff, 0xd0, 0xa5, 0xef, 0x40, 0xff, 0xd1, 0xa5, 0xef, 0x40, 0xff, 0xd2,
+    0xa5, 0xef, 0x40, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x10, 0x80, 0xff, 0xd0, 0xc0, 0xff, 0xd1, 0x60,
+    0xff, 0xd2, 0x60, 0xff, 0xcc, 0x00, 0x04, 0x11, 0x05, 0xff, 0xda, 0x00,
+    0x08, 0x01, 0x03, 0x01, 0x01, 0x3f, 0x10, 0xff, 0xd0, 0xff, 0xd1, 0xff,
+    0xd2, 0xff, 0xcc, 0x00, 0x04, 0x11, 0x05, 0xff, 0xda, 0x00, 0x08, 0x01,
+    0x02, 0x01, 0x01, 0x3f, 0x10, 0x80, 0xff, 0xd0, 0x80, 0xff, 0xd1, 0x80,
+    0xff, 0xd2, 0x80, 0xff, 0xcc, 0x00, 0x04, 0x10, 0x05, 0xff, 0xda, 0x00,
+    0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x10, 0xe2, 0xb9, 0x1c, 0x94, 0x25,
+    0x63, 0xa0, 0xff, 0xd0, 0xe2, 0xb9, 0x1c, 0x94, 0x25, 0x63, 0xa0, 0xff,
+    0xd1, 0xe2, 0xb9, 0x1c, 0x94, 0x25, 0x63, 0xa0, 0xff, 0xd2, 0xe2, 0xb9,
+    0x1c, 0x94, 0x25, 0x63, 0xa0, 0xff, 0xd9,
+};
+const uint8_t kHuffmanProgressive444Restart[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc2, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x10, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x02, 0xff, 0xc4, 0x00, 0x15, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x04, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c,
+    0x03, 0x01, 0x00, 0x02, 0x10, 0x03, 0x10, 0x00, 0x00, 0x01, 0x2d, 0x8f,
+    0xff, 0xd0, 0x98, 0xff, 0xd1, 0xd5, 0x53, 0x7f, 0xff, 0xd2, 0x5a, 0xa9,
+    0xbf, 0xff, 0xc4, 0x00, 0x17, 0x10, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0x12, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x05, 0x02,
+    0x49, 0xe0, 0xff, 0xd0, 0x49, 0xe0, 0xff, 0xd1, 0x49, 0xe0, 0xff, 0xd2,
+    0x49, 0xe0, 0xff, 0xc4, 0x00, 0x15, 0x11, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0x3f, 0x01, 0xaf,
+    0xff, 0xd0, 0xaf, 0xff, 0xd1, 0xaf, 0xff, 0xd2, 0xaf, 0xff, 0xc4, 0x00,
+    0x15, 0x11, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xda, 0x00, 0x08,
+    0x01, 0x02, 0x01, 0x01, 0x3f, 0x01, 0x97, 0xff, 0xd0, 0x97, 0xff, 0xd1,
+    0x97, 0xff, 0xd2, 0x97, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x06, 0x3f, 0x02,
+    0x7f, 0xff, 0xd0, 0x7f, 0xff, 0xd1, 0x7f, 0xff, 0xd2, 0x7f, 0xff, 0xc4,
+    0x00, 0x16, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x71, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x21, 0xb1, 0x9f, 0xff, 0xd0,
+    0xb1, 0x9f, 0xff, 0xd1, 0xb1, 0x9f, 0xff, 0xd2, 0xb1, 0x9f, 0xff, 0xda,
+    0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10,
+    0x3f, 0xff, 0xd0, 0xbf, 0xff, 0xd1, 0x1f, 0xff, 0xd2, 0x1f, 0xff, 0xc4,
+    0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x00, 0x08,
+    0x01, 0x03, 0x01, 0x01, 0x3f, 0x10, 0x7f, 0xff, 0xd0, 0x7f, 0xff, 0xd1,
+    0x7f, 0xff, 0xd2, 0x7f, 0xff, 0xc4, 0x00, 0x14, 0x11, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3f, 0x10,
+    0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd1, 0x3f, 0xff, 0xd2, 0x3f, 0xff, 0xc4,
+    0x00, 0x18, 0x10, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x00, 0xa1, 0xf1,
+    0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x10, 0x5d, 0x56,
+    0x06, 0xcf, 0xff, 0xd0, 0x5d, 0x56, 0x06, 0xcf, 0xff, 0xd1, 0x5d, 0x56,
+    0x06, 0xcf, 0xff, 0xd2, 0x5d, 0x56, 0x06, 0xcf, 0xff, 0xd9,
+};
+
+// 32x16, 4:2:0, sequential, one MCU per restart interval.
+const uint8_t kArithSequential420Restart[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc9, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xcc, 0x00, 0x0a, 0x00, 0x10, 0x10, 0x05, 0x01,
+    0x10, 0x11, 0x05, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00,
+    0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xff,
+    0x00, 0x68, 0xab, 0x74, 0x09, 0xff, 0x00, 0x52, 0xec, 0xc9, 0x64, 0x2c,
+    0x35, 0x37, 0x1b, 0x27, 0xec, 0x8e, 0x1e, 0x7b, 0xdc, 0x85, 0xe4, 0xc7,
+    0x29, 0xff, 0x00, 0xaf, 0x49, 0xca, 0xb5, 0x96, 0x18, 0x37, 0x1f, 0x07,
+    0x06, 0x00, 0xac, 0xbf, 0xc0, 0xff, 0xd0, 0xd2, 0x66, 0x1c, 0x14, 0x09,
+    0xff, 0x00, 0x52, 0xec, 0xc9, 0x64, 0x2c, 0x35, 0x37, 0x1b, 0x25, 0xec,
+    0x58, 0xbe, 0xb5, 0xd0, 0x99, 0x37, 0x6d, 0x0e, 0x33, 0x23, 0x08, 0xba,
+    0x29, 0x2b, 0x99, 0x9a, 0x31, 0x5f, 0x2b, 0xbf, 0x87, 0x8f, 0xbf, 0x00,
+    0xf5, 0x26, 0x57, 0x94, 0x21, 0xcd, 0x29, 0x3d, 0xf3, 0x89, 0x7d, 0xc0,
+    0x42, 0x2b, 0x97, 0xf3, 0x45, 0x1e, 0xb1, 0x6e, 0xa1, 0x06, 0x90, 0x8f,
+    0x78, 0x61, 0x76, 0x78, 0xeb, 0x85, 0x57, 0xc1, 0x24, 0xe5, 0x0b, 0xa9,
+    0x3e, 0x6f, 0x28, 0x79, 0x14, 0x86, 0xdd, 0x9f, 0xec, 0x9e, 0xc2, 0xf0,
+    0xc2, 0xcf, 0x9c, 0x2a, 0xe2, 0x27, 0xe2, 0xda, 0x37, 0x3d, 0x5e, 0x96,
+    0x47, 0xf9, 0xec, 0xe7, 0x11, 0xab, 0xb8, 0xbd, 0xc7, 0xc9, 0xbe, 0xda,
+    0xf3, 0xb4, 0xf5, 0x70, 0xff, 0xd9,
+};
+const uint8_t kHuffmanSequential420Restart[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06,
+    0x05, 0x08, 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d,
+    0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12, 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f,
+    0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20, 0x22, 0x2c,
+    0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34,
+    0x1f, 0x27, 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d,
+    0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc0, 0x00, 0x11,
+    0x08, 0x00, 0x10, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x17, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x02, 0x04, 0x07, 0xff, 0xc4, 0x00, 0x28, 0x10, 0x00, 0x00, 0x05,
+    0x02, 0x05, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x11, 0x12, 0x00, 0x21, 0x05, 0x14, 0x31, 0x81,
+    0xf1, 0x03, 0x06, 0x13, 0x22, 0x32, 0x41, 0x51, 0x71, 0xb1, 0xff, 0xc4,
+    0x00, 0x14, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc4, 0x00, 0x23,
+    0x11, 0x00, 0x00, 0x04, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x11, 0x03, 0x05, 0x21,
+    0x31, 0x41, 0x04, 0x12, 0x13, 0x81, 0x14, 0x51, 0xa1, 0xff, 0xdd, 0x00,
+    0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3f, 0x00, 0x2e, 0x83, 0x0e, 0xc9, 0x35, 0xa7, 0x3d,
+    0x99, 0xb9, 0xa5, 0x28, 0x30, 0xec, 0x93, 0x5a, 0x73, 0xd9, 0x9b, 0x9a,
+    0x9a, 0x0c, 0x3b, 0x24, 0xd6, 0x9c, 0xf6, 0x66, 0xe6, 0x94, 0x20, 0xc3,
+    0xb2, 0x4d, 0x69, 0xcf, 0x66, 0x6e, 0x69, 0xbe, 0x38, 0x1f, 0x38, 0xff,
+    0xd0, 0x52, 0x83, 0x0e, 0xc9, 0x35, 0xa7, 0x3d, 0x99, 0xb9, 0xa4, 0xc8,
+    0x10, 0x95, 0x17, 0xc1, 0xdf, 0x5b, 0xb4, 0x5a, 0xa9, 0xa5, 0x28, 0xa5,
+    0x2b, 0x10, 0x07, 0xcf, 0xa0, 0xfd, 0x7e, 0x6b, 0x59, 0x9f, 0x71, 0x77,
+    0x39, 0xfb, 0x89, 0x3a, 0x52, 0x9d, 0x37, 0x51, 0x3f, 0x84, 0x71, 0x10,
+    0xe9, 0x17, 0xa9, 0x22, 0x1d, 0xc3, 0x51, 0xb0, 0x30, 0x87, 0xb5, 0x87,
+    0xd4, 0x37, 0x06, 0xb8, 0x13, 0x35, 0x83, 0x19, 0x66, 0x9d, 0x31, 0x6e,
+    0x66, 0xae, 0x2a, 0xfd, 0xdc, 0xbd, 0x7c, 0xa8, 0x64, 0xae, 0x5b, 0x1b,
+    0x5f, 0x13, 0x69, 0x1b, 0x24, 0xae, 0x77, 0x67, 0xb5, 0x32, 0xed, 0xd6,
+    0x47, 0xff, 0xd9,
+};
+
+struct ArithmeticTestCase {
+  const uint8_t* arith;
+  size_t arith_size;
+  const uint8_t* huffman;
+  size_t huffman_size;
+};
+
+std::vector<ArithmeticTestCase> ArithmeticTestCases() {
+  return {
+      {kArithSequential444, sizeof(kArithSequential444),
+       kHuffmanSequential444, sizeof(kHuffmanSequential444)},
+      {kArithProgressive444Restart, sizeof(kArithProgressive444Restart),
+       kHuffmanProgressive444Restart, sizeof(kHuffmanProgressive444Restart)},
+      {kArithSequential420Restart, sizeof(kArithSequential420Restart),
+       kHuffmanSequential420Restart, sizeof(kHuffmanSequential420Restart)},
+  };
+}
+
+TEST(JpegDataReaderTest, ArithmeticCodedCoefficientsMatchHuffman) {
+  for (const ArithmeticTestCase& test : ArithmeticTestCases()) {
+    JPEGData arith;
+    ASSERT_TRUE(ReadJpeg(test.arith, test.arith_size, JpegReadMode::kReadAll,
+                         &arith));
+    EXPECT_TRUE(arith.is_arithmetic_coded);
+    JPEGData huffman;
+    ASSERT_TRUE(ReadJpeg(test.huffman, test.huffman_size,
+                         JpegReadMode::kReadAll, &huffman));
+    EXPECT_FALSE(huffman.is_arithmetic_coded);
+    EXPECT_EQ(arith.width, huffman.width);
+    EXPECT_EQ(arith.height, huffman.height);
+    EXPECT_EQ(arith.restart_interval, huffman.restart_interval);
+    EXPECT_EQ(arith.scan_info.size(), huffman.scan_info.size());
+    ASSERT_EQ(arith.components.size(), huffman.components.size());
+    for (size_t c = 0; c < arith.components.size(); ++c) {
+      EXPECT_EQ(arith.components[c].h_samp_factor,
+                huffman.components[c].h_samp_factor);
+      EXPECT_EQ(arith.components[c].v_samp_factor,
+                huffman.components[c].v_samp_factor);
+      EXPECT_EQ(arith.components[c].coeffs, huffman.components[c].coeffs);
+    }
+  }
+}
+
+TEST(JpegDataReaderTest, TruncatedArithmeticCodedFails) {
+  for (const ArithmeticTestCase& test : ArithmeticTestCases()) {
+    for (size_t len = 0; len < test.arith_size; ++len) {
+      JPEGData jpg;
+      EXPECT_FALSE(ReadJpeg(test.arith, len, JpegReadMode::kReadAll, &jpg))
+          << "len=" << len;
+    }
+  }
+}
+
+TEST(JpegDataReaderTest, CorruptArithmeticCodedDoesNotCrash) {
+  // Corrupt entropy-coded data may still decode to valid coefficients, but
+  // corrupt headers, markers and coefficient magnitudes must be rejected
+  // without reading out of bounds (which the sanitizer builds check).
+  for (const ArithmeticTestCase& test : ArithmeticTestCases()) {
+    std::vector<uint8_t> data(test.arith, test.arith + test.arith_size);
+    for (size_t i = 0; i < data.size(); ++i) {
+      for (uint8_t flip : {0x01, 0x5a, 0xff}) {
+        data[i] ^= flip;
+        JPEGData jpg;
+        (void)ReadJpeg(data.data(), data.size(), JpegReadMode::kReadAll, &jpg);
+        data[i] = test.arith[i];
+      }
+    }
+  }
+}
+
+TEST(JpegDataReaderTest,
+     JXL_TRANSCODE_JPEG_TEST(ArithmeticCodedReconstructionDataFails)) {
+  // Reconstruction data can only describe Huffman coded jpegs.
+  JxlEncoderPtr enc = JxlEncoderMake(nullptr);
+  JxlEncoderFrameSettings* frame_settings =
+      JxlEncoderFrameSettingsCreate(enc.get(), nullptr);
+  EXPECT_EQ(JXL_ENC_SUCCESS, JxlEncoderStoreJPEGMetadata(enc.get(), JXL_TRUE));
+  EXPECT_EQ(JXL_ENC_ERROR,
+            JxlEncoderAddJPEGFrame(frame_settings, kArithSequential444,
+                                   sizeof(kArithSequential444)));
+  EXPECT_EQ(JXL_ENC_ERR_JBRD, JxlEncoderGetError(enc.get()));
+
+  // Without reconstruction data the coefficients are transcoded.
+  enc = JxlEncoderMake(nullptr);
+  frame_settings = JxlEncoderFrameSettingsCreate(enc.get(), nullptr);
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderStoreJPEGMetadata(enc.get(), JXL_FALSE));
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderAddJPEGFrame(frame_settings, kArithSequential444,
+                                   sizeof(kArithSequential444)));
+  JxlEncoderCloseInput(enc.get());
+  std::vector<uint8_t> compressed(4096);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  EXPECT_EQ(JXL_ENC_SUCCESS,
+            JxlEncoderProcessOutput(enc.get(), &next_out, &avail_out));
+}
+
+}  // namespace
+}  // namespace jpeg
+}  // namespace jxl
@@ -165,7 +165,11 @@ enum class AppMarkerType : uint32_t {
 // Represents a parsed jpeg file.
 struct JPEGData : public Fields {
   JPEGData()
-      : width(0), height(0), restart_interval(0), has_zero_padding_bit(false) {}
+      : width(0),
+        height(0),
+        restart_interval(0),
+        is_arithmetic_coded(false),
+        has_zero_padding_bit(false) {}
 
   JXL_FIELDS_NAME(JPEGData)
 #if JPEGXL_ENABLE_TRANSCODE_JPEG
@@ -194,6 +198,11 @@ struct JPEGData : public Fields {
   std::vector<uint8_t> marker_order;
   std::vector<std::vector<uint8_t>> inter_marker_data;
   std::vector<uint8_t> tail_data;
+  // Set if the entropy-coded segments use arithmetic coding. The coefficients
+  // of such files are read like those of Huffman coded ones, but they can not
+  // be reconstructed bit-exactly, since the reconstruction data can only
+  // describe Huffman coding. Not serialized.
+  bool is_arithmetic_coded;
 
   // Extra information required for bit-precise JPEG file reconstruction.
 
@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include <array>
+#include <deque>
 #include <future>
 #include <string>
 #include <tuple>
@@ -94,6 +95,75 @@ TEST(JxlTest, RoundtripMarker) {
 }
 #endif
 
+TEST(JxlTest, DecodeImageJXLAsync) {
+  TestImage t;
+  // Several groups, so that the decoder has parallel stages to split.
+  t.SetDimensions(512, 300).SetChannels(3).AddFrame().RandomFill();
+  std::vector<uint8_t> compressed;
+  ASSERT_TRUE(extras::EncodeImageJXL({}, t.ppf(), /*jpeg_bytes=*/nullptr,
+                                     &compressed));
+
+  // Queue the tasks so that nothing runs until we drain the queue; the tasks
+  // of the parallel stages are only run after the driving task has already
+  // done their work.
+  std::deque<std::function<void()>> tasks;
+  size_t num_tasks = 0;
+  extras::JXLExecutor executor = [&](std::function<void()> task) {
+    tasks.push_back(std::move(task));
+    ++num_tasks;
+  };
+  const auto run_tasks = [&tasks]() {
+    while (!tasks.empty()) {
+      std::function<void()> task = std::move(tasks.front());
+      tasks.pop_front();
+      task();
+    }
+  };
+  JXLDecompressParams dparams;
+  test::DefaultAcceptedFormats(dparams);
+  size_t num_events = 0;
+  dparams.event_callback = [&num_events](JxlDecoderStatus) {
+    ++num_events;
+    return true;
+  };
+  bool done = false;
+  auto decode = extras::DecodeImageJXLAsync(
+      compressed.data(), compressed.size(), dparams, executor,
+      /*num_workers=*/3,
+      [&done](bool ok, const PackedPixelFile&) { done = ok; });
+  ASSERT_EQ(1u, num_tasks);
+  EXPECT_FALSE(done);
+  run_tasks();
+  EXPECT_TRUE(done);
+  EXPECT_TRUE(decode->result().get());
+  EXPECT_GT(num_tasks, 1u);
+  EXPECT_GT(num_events, 0u);
+  ASSERT_EQ(1u, decode->ppf().frames.size());
+  EXPECT_EQ(512u, decode->ppf().frames[0].color.xsize);
+
+  // Cancelled before it starts.
+  auto cancelled = extras::DecodeImageJXLAsync(
+      compressed.data(), compressed.size(), dparams, executor,
+      /*num_workers=*/3);
+  cancelled->Cancel();
+  run_tasks();
+  EXPECT_TRUE(cancelled->IsCancelled());
+  EXPECT_FALSE(cancelled->result().get());
+
+  // Cancelled while decoding, through JxlDecoderCancel.
+  std::shared_ptr<extras::JXLAsyncDecode> cancelled_later;
+  dparams.event_callback = [&cancelled_later](JxlDecoderStatus status) {
+    if (status == JXL_DEC_BASIC_INFO) cancelled_later->Cancel();
+    return true;
+  };
+  cancelled_later = extras::DecodeImageJXLAsync(
+      compressed.data(), compressed.size(), dparams, executor,
+      /*num_workers=*/3);
+  run_tasks();
+  EXPECT_FALSE(cancelled_later->result().get());
+  EXPECT_TRUE(cancelled_later->ppf().frames.empty());
+}
+
 TEST(JxlTest, RoundtripTinyFast) {
   ThreadPool* pool = nullptr;
   const PaddedBytes orig = jxl::test::ReadTestData(
@@ -0,0 +1,162 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <jxl/decode.h>
+#include <jxl/encode.h>
+#include <jxl/thread_parallel_runner.h>
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "lib/jxl/base/cache_aligned.h"
+#include "lib/jxl/base/random.h"
+#include "lib/jxl/base/status.h"
+
+namespace jxl {
+namespace {
+
+// Multithreaded encode and decode of large images. The first argument is the
+// threshold of CacheAligned::SetLargeAllocationThreshold in MiB (0 = off),
+// the second the image size in megapixels, the third whether the image is
+// lossless (modular) instead of VarDCT. The difference between the two
+// thresholds is largest on multi-socket machines with transparent huge pages
+// in "madvise" mode. To compare them, run e.g.
+//   jxl_gbench --benchmark_filter=BM_LargeImage --benchmark_repetitions=5
+// and compare the pairs of results that only differ in the first argument.
+// The threshold set by JXL_LARGE_ALLOCATION_MIB is restored after each run.
+
+std::vector<uint8_t> RandomPixels(size_t xsize, size_t ysize) {
+  std::vector<uint8_t> pixels(xsize * ysize * 3);
+  Rng rng(0);
+  // Smooth gradient with noise, to give the encoder realistic work.
+  for (size_t y = 0; y < ysize; ++y) {
+    for (size_t x = 0; x < xsize; ++x) {
+      for (size_t c = 0; c < 3; ++c) {
+        pixels[(y * xsize + x) * 3 + c] = static_cast<uint8_t>(
+            ((x + y * (c + 1)) >> 4) + rng.UniformU(0, 16));
+      }
+    }
+  }
+  return pixels;
+}
+
+std::vector<uint8_t> Encode(void* runner, const std::vector<uint8_t>& pixels,
+                            size_t xsize, size_t ysize, bool lossless) {
+  JxlEncoder* enc = JxlEncoderCreate(nullptr);
+  JXL_CHECK(JxlEncoderSetParallelRunner(enc, JxlThreadParallelRunner,
+                                        runner) == JXL_ENC_SUCCESS);
+  JxlBasicInfo info;
+  JxlEncoderInitBasicInfo(&info);
+  info.xsize = xsize;
+  info.ysize = ysize;
+  info.uses_original_profile = lossless;
+  JXL_CHECK(JxlEncoderSetBasicInfo(enc, &info) == JXL_ENC_SUCCESS);
+  JxlColorEncoding color_encoding;
+  JxlColorEncodingSetToSRGB(&color_encoding, /*is_gray=*/JXL_FALSE);
+  JXL_CHECK(JxlEncoderSetColorEncoding(enc, &color_encoding) ==
+            JXL_ENC_SUCCESS);
+  JxlEncoderFrameSettings* settings = JxlEncoderFrameSettingsCreate(enc, NULL);
+  JXL_CHECK(JxlEncoderFrameSettingsSetOption(
+                settings, JXL_ENC_FRAME_SETTING_EFFORT, 3) == JXL_ENC_SUCCESS);
+  JXL_CHECK(JxlEncoderSetFrameLossless(settings, lossless) == JXL_ENC_SUCCESS);
+  JxlPixelFormat format = {3, JXL_TYPE_UINT8, JXL_NATIVE_ENDIAN, 0};
+  JXL_CHECK(JxlEncoderAddImageFrame(settings, &format, pixels.data(),
+                                    pixels.size()) == JXL_ENC_SUCCESS);
+  JxlEncoderCloseInput(enc);
+  std::vector<uint8_t> compressed(1 << 20);
+  uint8_t* next_out = compressed.data();
+  size_t avail_out = compressed.size();
+  JxlEncoderStatus status;
+  while ((status = JxlEncoderProcessOutput(enc, &next_out, &avail_out)) ==
+         JXL_ENC_NEED_MORE_OUTPUT) {
+    size_t offset = next_out - compressed.data();
+    compressed.resize(compressed.size() * 2);
+    next_out = compressed.data() + offset;
+    avail_out = compressed.size() - offset;
+  }
+  JXL_CHECK(status == JXL_ENC_SUCCESS);
+  compressed.resize(next_out - compressed.data());
+  JxlEncoderDestroy(enc);
+  return compressed;
+}
+
+void Decode(void* runner, const std::vector<uint8_t>& compressed,
+            std::vector<uint8_t>* pixels) {
+  JxlDecoder* dec = JxlDecoderCreate(nullptr);
+  JXL_CHECK(JxlDecoderSetParallelRunner(dec, JxlThreadParallelRunner,
+                                        runner) == JXL_DEC_SUCCESS);
+  JXL_CHECK(JxlDecoderSubscribeEvents(dec, JXL_DEC_FULL_IMAGE) ==
+            JXL_DEC_SUCCESS);
+  JXL_CHECK(JxlDecoderSetInput(dec, compressed.data(), compressed.size()) ==
+            JXL_DEC_SUCCESS);
+  JxlDecoderCloseInput(dec);
+  JxlPixelFormat format = {3, JXL_TYPE_UINT8, JXL_NATIVE_ENDIAN, 0};
+  JXL_CHECK(JxlDecoderProcessInput(dec) == JXL_DEC_NEED_IMAGE_OUT_BUFFER);
+  JXL_CHECK(JxlDecoderSetImageOutBuffer(dec, &format, pixels->data(),
+                                        pixels->size()) == JXL_DEC_SUCCESS);
+  JXL_CHECK(JxlDecoderProcessInput(dec) == JXL_DEC_FULL_IMAGE);
+  JxlDecoderDestroy(dec);
+}
+
+void BM_LargeImage_Encode(benchmark::State& state) {
+  const size_t xsize = 1024;
+  const size_t ysize = state.range(1) * 1024;
+  const std::vector<uint8_t> pixels = RandomPixels(xsize, ysize);
+  void* runner = JxlThreadParallelRunnerCreate(
+      nullptr, JxlThreadParallelRunnerDefaultNumWorkerThreads());
+  const size_t threshold = CacheAligned::LargeAllocationThreshold();
+  CacheAligned::SetLargeAllocationThreshold(state.range(0) << 20);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        Encode(runner, pixels, xsize, ysize, state.range(2) != 0));
+  }
+  CacheAligned::SetLargeAllocationThreshold(threshold);
+  JxlThreadParallelRunnerDestroy(runner);
+  state.SetItemsProcessed(state.iterations() * xsize * ysize);
+}
+
+void BM_LargeImage_Decode(benchmark::State& state) {
+  const size_t xsize = 1024;
+  const size_t ysize = state.range(1) * 1024;
+  void* runner = JxlThreadParallelRunnerCreate(
+      nullptr, JxlThreadParallelRunnerDefaultNumWorkerThreads());
+  const std::vector<uint8_t> compressed = Encode(
+      runner, RandomPixels(xsize, ysize), xsize, ysize, state.range(2) != 0);
+  std::vector<uint8_t> pixels(xsize * ysize * 3);
+  const size_t threshold = CacheAligned::LargeAllocationThreshold();
+  CacheAligned::SetLargeAllocationThreshold(state.range(0) << 20);
+  for (auto _ : state) {
+    Decode(runner, compressed, &pixels);
+  }
+  CacheAligned::SetLargeAllocationThreshold(threshold);
+  JxlThreadParallelRunnerDestroy(runner);
+  state.SetItemsProcessed(state.iterations() * xsize * ysize);
+}
+
+BENCHMARK(BM_LargeImage_Encode)
+    ->Args({0, 16, 0})
+    ->Args({2, 16, 0})
+    ->Args({0, 64, 0})
+    ->Args({2, 64, 0})
+    ->Args({0, 16, 1})
+    ->Args({2, 16, 1})
+    ->Args({0, 64, 1})
+    ->Args({2, 64, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_LargeImage_Decode)
+    ->Args({0, 16, 0})
+    ->Args({2, 16, 0})
+    ->Args({0, 64, 0})
+    ->Args({2, 64, 0})
+    ->Args({0, 16, 1})
+    ->Args({2, 16, 1})
+    ->Args({0, 64, 1})
+    ->Args({2, 64, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace jxl
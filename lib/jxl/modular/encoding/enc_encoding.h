@@ -30,7 +30,8 @@ namespace jxl {
 Tree LearnTree(TreeSamples &&tree_samples, size_t total_pixels,
                const ModularOptions &options,
                const std::vector<ModularMultiplierInfo> &multiplier_info = {},
-               StaticPropRange static_prop_range = {});
+               StaticPropRange static_prop_range = {},
+               const ThreadPool *pool = nullptr);
 
 // TODO(veluca): make cleaner interfaces.
 
@@ -163,7 +163,8 @@ void SplitTreeSamples(TreeSamples &tree_samples, size_t begin, size_t pos,
 void FindBestSplit(TreeSamples &tree_samples, float threshold,
                    const std::vector<ModularMultiplierInfo> &mul_info,
                    StaticPropRange initial_static_prop_range,
-                   float fast_decode_multiplier, Tree *tree) {
+                   float fast_decode_multiplier, Tree *tree,
+                   const ThreadPool *pool) {
   struct NodeInfo {
     size_t pos;
     size_t begin;
@@ -181,6 +182,7 @@ void FindBestSplit(TreeSamples &tree_samples, float threshold,
   // TODO(veluca): consider parallelizing the search (processing multiple nodes
   // at a time).
   while (!nodes.empty()) {
+    if (!CheckCancelled(pool)) break;
     size_t pos = nodes.back().pos;
     size_t begin = nodes.back().begin;
     size_t end = nodes.back().end;
@@ -479,7 +481,8 @@ HWY_EXPORT(FindBestSplit);  // Local function.
 void ComputeBestTree(TreeSamples &tree_samples, float threshold,
                      const std::vector<ModularMultiplierInfo> &mul_info,
                      StaticPropRange static_prop_range,
-                     float fast_decode_multiplier, Tree *tree) {
+                     float fast_decode_multiplier, Tree *tree,
+                     const ThreadPool *pool) {
   // TODO(veluca): take into account that different contexts can have different
   // uint configs.
   //
@@ -495,7 +498,7 @@ void ComputeBestTree(TreeSamples &tree_samples, float threshold,
              std::numeric_limits<uint32_t>::max());
   HWY_DYNAMIC_DISPATCH(FindBestSplit)
   (tree_samples, threshold, mul_info, static_prop_range, fast_decode_multiplier,
-   tree);
+   tree, pool);
 }
 
 constexpr int32_t TreeSamples::kPropertyRange;
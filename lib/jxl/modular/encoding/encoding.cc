@@ -645,7 +645,7 @@ Status ModularGenericDecompress(BitReader *br, Image &image,
                                 ModularOptions *options, bool undo_transforms,
                                 const Tree *tree, const ANSCode *code,
                                 const std::vector<uint8_t> *ctx_map,
-                                bool allow_truncated_group) {
+                                bool allow_truncated_group, ThreadPool *pool) {
 #ifdef JXL_ENABLE_ASSERT
   std::vector<std::pair<uint32_t, uint32_t>> req_sizes(image.channel.size());
   for (size_t c = 0; c < req_sizes.size(); c++) {
@@ -659,7 +659,7 @@ Status ModularGenericDecompress(BitReader *br, Image &image,
                                   code, ctx_map, allow_truncated_group);
   if (!allow_truncated_group) JXL_RETURN_IF_ERROR(dec_status);
   if (dec_status.IsFatalError()) return dec_status;
-  if (undo_transforms) image.undo_transforms(header->wp_header);
+  if (undo_transforms) image.undo_transforms(header->wp_header, pool);
   if (image.error) return JXL_FAILURE("Corrupt file. Aborting.");
   JXL_DEBUG_V(4,
               "Modular-decoded a %" PRIuS "x%" PRIuS " nbchans=%" PRIuS
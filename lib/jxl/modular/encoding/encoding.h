@@ -129,6 +129,11 @@ bool TreeToLookupTable(const FlatTree &tree, TreeLut<T, HAS_MULTIPLIERS> &lut) {
 Status ValidateChannelDimensions(const Image &image,
                                  const ModularOptions &options);
 
+// Decodes a modular stream into `image`. The entropy-coded channel data forms
+// a single sequential ANS stream and is always decoded on the calling thread;
+// if `pool` is given, it is used to undo the transforms (RCT, squeeze,
+// palette) afterwards. It must not be the pool that is currently running the
+// caller, as nested `RunOnPool` calls are not supported.
 Status ModularGenericDecompress(BitReader *br, Image &image,
                                 GroupHeader *header, size_t group_id,
                                 ModularOptions *options,
@@ -136,7 +141,8 @@ Status ModularGenericDecompress(BitReader *br, Image &image,
                                 const Tree *tree = nullptr,
                                 const ANSCode *code = nullptr,
                                 const std::vector<uint8_t> *ctx_map = nullptr,
-                                bool allow_truncated_group = false);
+                                bool allow_truncated_group = false,
+                                ThreadPool *pool = nullptr);
 }  // namespace jxl
 
 #endif  // LIB_JXL_MODULAR_ENCODING_ENCODING_H_
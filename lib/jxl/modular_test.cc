@@ -27,6 +27,7 @@
 #include "lib/jxl/enc_file.h"
 #include "lib/jxl/enc_params.h"
 #include "lib/jxl/enc_toc.h"
+#include "lib/jxl/frame_dimensions.h"
 #include "lib/jxl/image.h"
 #include "lib/jxl/image_bundle.h"
 #include "lib/jxl/image_ops.h"
@@ -69,6 +70,31 @@ TEST(ModularTest, JXL_TSAN_SLOW_TEST(RoundtripLosslessGroups1024)) {
   TestLosslessGroups(3);
 }
 
+TEST(ModularTest, RoundtripLosslessSingleGroupThreaded) {
+  const PaddedBytes orig = jxl::test::ReadTestData("jxl/flower/flower.png");
+  CompressParams cparams;
+  cparams.SetLossless();
+  // The whole image fits in a single 1024x1024 group, which is then decoded on
+  // the calling thread with the transforms undone on the pool.
+  cparams.modular_group_size_shift = 3;
+  cparams.responsive = 1;
+
+  CodecInOut io;
+  ASSERT_TRUE(SetFromBytes(Span<const uint8_t>(orig), &io));
+  io.ShrinkTo(1024, 1024);
+  FrameDimensions frame_dim;
+  frame_dim.Set(io.xsize(), io.ysize(), cparams.modular_group_size_shift,
+                /*max_hshift=*/0, /*max_vshift=*/0, /*modular_mode=*/true,
+                /*upsampling=*/1);
+  ASSERT_EQ(1u, frame_dim.num_groups);
+
+  test::ThreadPoolForTests pool(8);
+  CodecInOut io_out;
+  JXL_EXPECT_OK(Roundtrip(&io, cparams, {}, &io_out, _,
+                          /*compressed_size=*/nullptr, &pool));
+  JXL_EXPECT_OK(SamePixels(*io.Main().color(), *io_out.Main().color(), _));
+}
+
 TEST(ModularTest, RoundtripLosslessCustomWP_PermuteRCT) {
   const PaddedBytes orig = jxl::test::ReadTestData(
       "external/wesaturate/500px/u76c0g_bliznaca_srgb8.png");
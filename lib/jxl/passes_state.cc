@@ -11,6 +11,15 @@
 
 namespace jxl {
 
+namespace {
+
+template <typename ImageT>
+bool NeedsAlloc(bool reuse, size_t xsize, size_t ysize, const ImageT& image) {
+  return !reuse || image.xsize() != xsize || image.ysize() != ysize;
+}
+
+}  // namespace
+
 Status InitializePassesSharedState(const FrameHeader& frame_header,
                                    PassesSharedState* JXL_RESTRICT shared,
                                    bool encoder) {
@@ -22,12 +31,21 @@ Status InitializePassesSharedState(const FrameHeader& frame_header,
 
   const FrameDimensions& frame_dim = shared->frame_dim;
 
-  shared->ac_strategy =
-      AcStrategyImage(frame_dim.xsize_blocks, frame_dim.ysize_blocks);
-  shared->raw_quant_field =
-      ImageI(frame_dim.xsize_blocks, frame_dim.ysize_blocks);
-  shared->epf_sharpness =
-      ImageB(frame_dim.xsize_blocks, frame_dim.ysize_blocks);
+  const size_t xsize_blocks = frame_dim.xsize_blocks;
+  const size_t ysize_blocks = frame_dim.ysize_blocks;
+  // The encoder may pass in the state of a previous frame; its per-block
+  // images are fully overwritten for each frame, so keep them if they already
+  // have the right size.
+  if (NeedsAlloc(encoder, xsize_blocks, ysize_blocks, shared->ac_strategy)) {
+    shared->ac_strategy = AcStrategyImage(xsize_blocks, ysize_blocks);
+  }
+  if (NeedsAlloc(encoder, xsize_blocks, ysize_blocks,
+                 shared->raw_quant_field)) {
+    shared->raw_quant_field = ImageI(xsize_blocks, ysize_blocks);
+  }
+  if (NeedsAlloc(encoder, xsize_blocks, ysize_blocks, shared->epf_sharpness)) {
+    shared->epf_sharpness = ImageB(xsize_blocks, ysize_blocks);
+  }
   shared->cmap = ColorCorrelationMap(frame_dim.xsize, frame_dim.ysize);
 
   // In the decoder, we allocate coeff orders afterwards, when we know how many
@@ -41,7 +59,9 @@ Status InitializePassesSharedState(const FrameHeader& frame_header,
                                 kCoeffOrderMaxSize);
   }
 
-  shared->quant_dc = ImageB(frame_dim.xsize_blocks, frame_dim.ysize_blocks);
+  if (NeedsAlloc(encoder, xsize_blocks, ysize_blocks, shared->quant_dc)) {
+    shared->quant_dc = ImageB(xsize_blocks, ysize_blocks);
+  }
 
   bool use_dc_frame = !!(frame_header.flags & FrameHeader::kUseDcFrame);
   if (!encoder && use_dc_frame) {
@@ -59,8 +79,9 @@ Status InitializePassesSharedState(const FrameHeader& frame_header,
     }
     ZeroFillImage(&shared->quant_dc);
   } else {
-    shared->dc_storage =
-        Image3F(frame_dim.xsize_blocks, frame_dim.ysize_blocks);
+    if (NeedsAlloc(encoder, xsize_blocks, ysize_blocks, shared->dc_storage)) {
+      shared->dc_storage = Image3F(xsize_blocks, ysize_blocks);
+    }
     shared->dc = &shared->dc_storage;
   }
 
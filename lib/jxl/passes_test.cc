@@ -14,13 +14,16 @@
 #include "lib/jxl/base/data_parallel.h"
 #include "lib/jxl/base/override.h"
 #include "lib/jxl/base/padded_bytes.h"
+#include "lib/jxl/base/random.h"
 #include "lib/jxl/cms/jxl_cms.h"
 #include "lib/jxl/color_encoding_internal.h"
+#include "lib/jxl/dct_util.h"
 #include "lib/jxl/enc_aux_out.h"
 #include "lib/jxl/enc_butteraugli_comparator.h"
 #include "lib/jxl/enc_cache.h"
 #include "lib/jxl/enc_file.h"
 #include "lib/jxl/enc_params.h"
+#include "lib/jxl/frame_dimensions.h"
 #include "lib/jxl/image_bundle.h"
 #include "lib/jxl/image_ops.h"
 #include "lib/jxl/test_utils.h"
@@ -403,5 +406,36 @@ TEST(PassesTest, RoundtripSmallNoGaborishPasses) {
               IsSlightlyBelow(1.2));
 }
 
+TEST(PassesTest, LazyCoefficientStorageRoundtrip) {
+  constexpr size_t kRowSize = kGroupDim * kGroupDim;
+  LazyACImageT<int32_t> coeffs(kRowSize, 3);
+  Rng rng(0);
+  std::vector<int32_t> expected(3 * kRowSize);
+  for (size_t pass = 0; pass < 4; pass++) {
+    // Sparse rows as after the first passes, then dense ones that stay
+    // uncompressed.
+    const float density = pass < 2 ? 0.02f : 0.9f;
+    for (size_t c = 0; c < 3; c++) {
+      int32_t* row = coeffs.PlaneRow(c, 1, 0).ptr32;
+      for (size_t i = 0; i < kRowSize; i++) {
+        if (rng.Bernoulli(density)) {
+          row[i] = rng.UniformI(-100000, 100000);
+        }
+        expected[c * kRowSize + i] = row[i];
+      }
+    }
+    coeffs.CompactRow(1);
+    for (size_t c = 0; c < 3; c++) {
+      const int32_t* row = coeffs.PlaneRow(c, 1, 0).ptr32;
+      for (size_t i = 0; i < kRowSize; i++) {
+        ASSERT_EQ(expected[c * kRowSize + i], row[i]);
+      }
+    }
+  }
+  coeffs.ReleaseRow(1);
+  EXPECT_EQ(0, coeffs.PlaneRow(2, 1, kRowSize - 1).ptr32[0]);
+  EXPECT_EQ(0, coeffs.PlaneRow(0, 2, 0).ptr32[0]);
+}
+
 }  // namespace
 }  // namespace jxl
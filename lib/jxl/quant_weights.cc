@@ -1179,6 +1179,20 @@ DequantMatrices::DequantMatrices() {
   }
 }
 
+void DequantMatrices::ResetToDefault() {
+  for (const QuantEncoding& encoding : encodings_) {
+    if (encoding.mode != QuantEncoding::kQuantModeLibrary ||
+        encoding.predefined != 0) {
+      *this = DequantMatrices();
+      return;
+    }
+  }
+  for (size_t c = 0; c < 3; c++) {
+    dc_quant_[c] = kDCQuant[c];
+    inv_dc_quant_[c] = kInvDCQuant[c];
+  }
+}
+
 Status DequantMatrices::EnsureComputed(uint32_t acs_mask) {
   const QuantEncoding* library = Library();
 
@@ -397,6 +397,10 @@ class DequantMatrices {
     computed_mask_ = 0;
   }
 
+  // For encoder. Restores the default (library) encodings and DC quants.
+  // Tables that were already computed for the default encodings are kept.
+  void ResetToDefault();
+
   // For encoder.
   void SetDCQuant(const float dc[3]) {
     for (size_t c = 0; c < 3; c++) {
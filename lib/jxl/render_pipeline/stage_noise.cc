@@ -151,12 +151,36 @@ void AddNoiseToRGB(const D d, const Vec<D> rnd_noise_r,
   StoreU(vb, d, out_b);
 }
 
+// Applies a 5x5 subtract-box-filter convolution to the noise input rows.
+template <class D>
+HWY_INLINE Vec<D> ConvolveNoise(const D d, const float* JXL_RESTRICT* rows,
+                                ssize_t x) {
+  const auto p00 = LoadU(d, rows[2] + x);
+  auto others = Zero(d);
+  // TODO(eustas): sum loaded values to reduce the calculation chain
+  for (ssize_t i = -2; i <= 2; i++) {
+    others = Add(others, LoadU(d, rows[0] + x + i));
+    others = Add(others, LoadU(d, rows[1] + x + i));
+    others = Add(others, LoadU(d, rows[3] + x + i));
+    others = Add(others, LoadU(d, rows[4] + x + i));
+  }
+  others = Add(others, LoadU(d, rows[2] + x - 2));
+  others = Add(others, LoadU(d, rows[2] + x - 1));
+  others = Add(others, LoadU(d, rows[2] + x + 1));
+  others = Add(others, LoadU(d, rows[2] + x + 2));
+  // 4 * (1 - box kernel)
+  return MulAdd(others, Set(d, 0.16), Mul(p00, Set(d, -3.84)));
+}
+
+// Convolves the random noise channels and adds the result to the color
+// channels in a single pass, so that the convolved noise never has to be
+// written out and read back by another stage.
 class AddNoiseStage : public RenderPipelineStage {
  public:
   AddNoiseStage(const NoiseParams& noise_params,
                 const ColorCorrelationMap& cmap, size_t first_c)
       : RenderPipelineStage(RenderPipelineStage::Settings::Symmetric(
-            /*shift=*/0, /*border=*/0)),
+            /*shift=*/0, /*border=*/2)),
         noise_params_(noise_params),
         cmap_(cmap),
         first_c_(first_c) {}
@@ -164,7 +188,6 @@ class AddNoiseStage : public RenderPipelineStage {
   void ProcessRow(const RowInfo& input_rows, const RowInfo& output_rows,
                   size_t xextra, size_t xsize, size_t xpos, size_t ypos,
                   size_t thread_id) const final {
-    if (!noise_params_.HasAny()) return;
     const StrengthEvalLut noise_model(noise_params_);
     D d;
     const auto half = Set(d, 0.5f);
@@ -182,28 +205,37 @@ class AddNoiseStage : public RenderPipelineStage {
     float* JXL_RESTRICT row_x = GetInputRow(input_rows, 0, 0);
     float* JXL_RESTRICT row_y = GetInputRow(input_rows, 1, 0);
     float* JXL_RESTRICT row_b = GetInputRow(input_rows, 2, 0);
-    const float* JXL_RESTRICT row_rnd_r =
-        GetInputRow(input_rows, first_c_ + 0, 0);
-    const float* JXL_RESTRICT row_rnd_g =
-        GetInputRow(input_rows, first_c_ + 1, 0);
-    const float* JXL_RESTRICT row_rnd_c =
-        GetInputRow(input_rows, first_c_ + 2, 0);
+    const float* JXL_RESTRICT rows_rnd[3][5];
+    float* JXL_RESTRICT rows_out[3];
+    for (size_t c = 0; c < 3; c++) {
+      for (size_t i = 0; i < 5; i++) {
+        rows_rnd[c][i] = GetInputRow(input_rows, first_c_ + c, i - 2);
+      }
+      rows_out[c] = GetOutputRow(output_rows, first_c_ + c, 0);
+    }
     // Needed by the calls to Floor() in StrengthEvalLut. Only arithmetic and
     // shuffles are otherwise done on the data, so this is safe.
     msan::UnpoisonMemory(row_x + xsize, (xsize_v - xsize) * sizeof(float));
     msan::UnpoisonMemory(row_y + xsize, (xsize_v - xsize) * sizeof(float));
     for (size_t x = 0; x < xsize_v; x += Lanes(d)) {
+      const auto rnd_r = ConvolveNoise(d, rows_rnd[0], x);
+      const auto rnd_g = ConvolveNoise(d, rows_rnd[1], x);
+      const auto rnd_c = ConvolveNoise(d, rows_rnd[2], x);
+      // The stage that saves frames for referencing before the color
+      // transform copies every channel, noise channels included, so their
+      // output is kept initialized.
+      StoreU(rnd_r, d, rows_out[0] + x);
+      StoreU(rnd_g, d, rows_out[1] + x);
+      StoreU(rnd_c, d, rows_out[2] + x);
       const auto vx = LoadU(d, row_x + x);
       const auto vy = LoadU(d, row_y + x);
       const auto in_g = Sub(vy, vx);
       const auto in_r = Add(vy, vx);
       const auto noise_strength_g = NoiseStrength(noise_model, Mul(in_g, half));
       const auto noise_strength_r = NoiseStrength(noise_model, Mul(in_r, half));
-      const auto addit_rnd_noise_red = Mul(LoadU(d, row_rnd_r + x), norm_const);
-      const auto addit_rnd_noise_green =
-          Mul(LoadU(d, row_rnd_g + x), norm_const);
-      const auto addit_rnd_noise_correlated =
-          Mul(LoadU(d, row_rnd_c + x), norm_const);
+      const auto addit_rnd_noise_red = Mul(rnd_r, norm_const);
+      const auto addit_rnd_noise_green = Mul(rnd_g, norm_const);
+      const auto addit_rnd_noise_correlated = Mul(rnd_c, norm_const);
       AddNoiseToRGB(D(), addit_rnd_noise_red, addit_rnd_noise_green,
                     addit_rnd_noise_correlated, noise_strength_g,
                     noise_strength_r, ytox, ytob, row_x + x, row_y + x,
@@ -214,8 +246,11 @@ class AddNoiseStage : public RenderPipelineStage {
     msan::PoisonMemory(row_b + xsize, (xsize_v - xsize) * sizeof(float));
   }
 
+  // The noise channels cannot be kInput: the pipelines only keep border rows
+  // and mirror the borders of kInOut channels, and the convolution needs the
+  // 5x5 neighbourhood of each pixel.
   RenderPipelineChannelMode GetChannelMode(size_t c) const final {
-    return c >= first_c_ ? RenderPipelineChannelMode::kInput
+    return c >= first_c_ ? RenderPipelineChannelMode::kInOut
            : c < 3       ? RenderPipelineChannelMode::kInPlace
                          : RenderPipelineChannelMode::kIgnored;
   }
@@ -234,61 +269,6 @@ std::unique_ptr<RenderPipelineStage> GetAddNoiseStage(
   return jxl::make_unique<AddNoiseStage>(noise_params, cmap, noise_c_start);
 }
 
-class ConvolveNoiseStage : public RenderPipelineStage {
- public:
-  explicit ConvolveNoiseStage(size_t first_c)
-      : RenderPipelineStage(RenderPipelineStage::Settings::Symmetric(
-            /*shift=*/0, /*border=*/2)),
-        first_c_(first_c) {}
-
-  void ProcessRow(const RowInfo& input_rows, const RowInfo& output_rows,
-                  size_t xextra, size_t xsize, size_t xpos, size_t ypos,
-                  size_t thread_id) const final {
-    const HWY_FULL(float) d;
-    for (size_t c = first_c_; c < first_c_ + 3; c++) {
-      float* JXL_RESTRICT rows[5];
-      for (size_t i = 0; i < 5; i++) {
-        rows[i] = GetInputRow(input_rows, c, i - 2);
-      }
-      float* JXL_RESTRICT row_out = GetOutputRow(output_rows, c, 0);
-      for (ssize_t x = -RoundUpTo(xextra, Lanes(d));
-           x < (ssize_t)(xsize + xextra); x += Lanes(d)) {
-        const auto p00 = LoadU(d, rows[2] + x);
-        auto others = Zero(d);
-        // TODO(eustas): sum loaded values to reduce the calculation chain
-        for (ssize_t i = -2; i <= 2; i++) {
-          others = Add(others, LoadU(d, rows[0] + x + i));
-          others = Add(others, LoadU(d, rows[1] + x + i));
-          others = Add(others, LoadU(d, rows[3] + x + i));
-          others = Add(others, LoadU(d, rows[4] + x + i));
-        }
-        others = Add(others, LoadU(d, rows[2] + x - 2));
-        others = Add(others, LoadU(d, rows[2] + x - 1));
-        others = Add(others, LoadU(d, rows[2] + x + 1));
-        others = Add(others, LoadU(d, rows[2] + x + 2));
-        // 4 * (1 - box kernel)
-        auto pixels = MulAdd(others, Set(d, 0.16), Mul(p00, Set(d, -3.84)));
-        StoreU(pixels, d, row_out + x);
-      }
-    }
-  }
-
-  RenderPipelineChannelMode GetChannelMode(size_t c) const final {
-    return c >= first_c_ ? RenderPipelineChannelMode::kInOut
-                         : RenderPipelineChannelMode::kIgnored;
-  }
-
-  const char* GetName() const override { return "ConvNoise"; }
-
- private:
-  size_t first_c_;
-};
-
-std::unique_ptr<RenderPipelineStage> GetConvolveNoiseStage(
-    size_t noise_c_start) {
-  return jxl::make_unique<ConvolveNoiseStage>(noise_c_start);
-}
-
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace jxl
@@ -298,7 +278,6 @@ HWY_AFTER_NAMESPACE();
 namespace jxl {
 
 HWY_EXPORT(GetAddNoiseStage);
-HWY_EXPORT(GetConvolveNoiseStage);
 
 std::unique_ptr<RenderPipelineStage> GetAddNoiseStage(
     const NoiseParams& noise_params, const ColorCorrelationMap& cmap,
@@ -307,10 +286,5 @@ std::unique_ptr<RenderPipelineStage> GetAddNoiseStage(
                                                 noise_c_start);
 }
 
-std::unique_ptr<RenderPipelineStage> GetConvolveNoiseStage(
-    size_t noise_c_start) {
-  return HWY_DYNAMIC_DISPATCH(GetConvolveNoiseStage)(noise_c_start);
-}
-
 }  // namespace jxl
 #endif
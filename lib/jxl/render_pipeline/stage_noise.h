@@ -18,15 +18,13 @@
 
 namespace jxl {
 
-// Adds noise to color channels.
+// Applies a 5x5 subtract-box-filter convolution to the three random noise
+// channels starting at `noise_c_start` and adds the resulting noise to the
+// color channels.
 std::unique_ptr<RenderPipelineStage> GetAddNoiseStage(
     const NoiseParams& noise_params, const ColorCorrelationMap& cmap,
     size_t noise_c_start);
 
-// Applies a 5x5 subtract-box-filter convolution to the noise input channels.
-std::unique_ptr<RenderPipelineStage> GetConvolveNoiseStage(
-    size_t noise_c_start);
-
 }  // namespace jxl
 
 #endif  // LIB_JXL_RENDER_PIPELINE_STAGE_NOISE_H_
@@ -23,14 +23,13 @@ class ToneMappingStage : public RenderPipelineStage {
   explicit ToneMappingStage(OutputEncodingInfo output_encoding_info)
       : RenderPipelineStage(RenderPipelineStage::Settings()),
         output_encoding_info_(std::move(output_encoding_info)) {
+    gamut_map_ = output_encoding_info_.gamut_mapping;
     if (output_encoding_info_.desired_intensity_target ==
         output_encoding_info_.orig_intensity_target) {
       // No tone mapping requested.
-      return;
-    }
-    if (output_encoding_info_.orig_color_encoding.tf.IsPQ() &&
-        output_encoding_info_.desired_intensity_target <
-            output_encoding_info_.orig_intensity_target) {
+    } else if (output_encoding_info_.orig_color_encoding.tf.IsPQ() &&
+               output_encoding_info_.desired_intensity_target <
+                   output_encoding_info_.orig_intensity_target) {
       tone_mapper_ = jxl::make_unique<ToneMapper>(
           /*source_range=*/std::pair<float, float>(
               0, output_encoding_info_.orig_intensity_target),
@@ -46,8 +45,7 @@ class ToneMappingStage : public RenderPipelineStage {
           output_encoding_info_.luminances);
     }
 
-    if (output_encoding_info_.color_encoding.tf.IsPQ() &&
-        (tone_mapper_ || hlg_ootf_)) {
+    if (output_encoding_info_.color_encoding.tf.IsPQ() && IsNeeded()) {
       to_intensity_target_ =
           10000.f / output_encoding_info_.orig_intensity_target;
       from_desired_intensity_target_ =
@@ -55,12 +53,12 @@ class ToneMappingStage : public RenderPipelineStage {
     }
   }
 
-  bool IsNeeded() const { return tone_mapper_ || hlg_ootf_; }
+  bool IsNeeded() const { return tone_mapper_ || hlg_ootf_ || gamut_map_; }
 
   void ProcessRow(const RowInfo& input_rows, const RowInfo& output_rows,
                   size_t xextra, size_t xsize, size_t xpos, size_t ypos,
                   size_t thread_id) const final {
-    if (!(tone_mapper_ || hlg_ootf_)) return;
+    if (!IsNeeded()) return;
 
     const HWY_FULL(float) d;
     const size_t xsize_v = RoundUpTo(xsize, Lanes(d));
@@ -77,23 +75,22 @@ class ToneMappingStage : public RenderPipelineStage {
       auto r = LoadU(d, row0 + x);
       auto g = LoadU(d, row1 + x);
       auto b = LoadU(d, row2 + x);
-      if (tone_mapper_ || hlg_ootf_) {
-        r = Mul(r, Set(d, to_intensity_target_));
-        g = Mul(g, Set(d, to_intensity_target_));
-        b = Mul(b, Set(d, to_intensity_target_));
-        if (tone_mapper_) {
-          tone_mapper_->ToneMap(&r, &g, &b);
-        } else {
-          JXL_ASSERT(hlg_ootf_);
-          hlg_ootf_->Apply(&r, &g, &b);
-        }
-        if (tone_mapper_ || hlg_ootf_->WarrantsGamutMapping()) {
-          GamutMap(&r, &g, &b, output_encoding_info_.luminances);
-        }
-        r = Mul(r, Set(d, from_desired_intensity_target_));
-        g = Mul(g, Set(d, from_desired_intensity_target_));
-        b = Mul(b, Set(d, from_desired_intensity_target_));
+      r = Mul(r, Set(d, to_intensity_target_));
+      g = Mul(g, Set(d, to_intensity_target_));
+      b = Mul(b, Set(d, to_intensity_target_));
+      if (tone_mapper_) {
+        tone_mapper_->ToneMap(&r, &g, &b);
+      } else if (hlg_ootf_) {
+        hlg_ootf_->Apply(&r, &g, &b);
+      }
+      if (gamut_map_ || tone_mapper_ ||
+          (hlg_ootf_ && hlg_ootf_->WarrantsGamutMapping())) {
+        GamutMap(&r, &g, &b, output_encoding_info_.luminances,
+                 output_encoding_info_.preserve_saturation);
       }
+      r = Mul(r, Set(d, from_desired_intensity_target_));
+      g = Mul(g, Set(d, from_desired_intensity_target_));
+      b = Mul(b, Set(d, from_desired_intensity_target_));
       StoreU(r, d, row0 + x);
       StoreU(g, d, row1 + x);
       StoreU(b, d, row2 + x);
@@ -115,6 +112,7 @@ class ToneMappingStage : public RenderPipelineStage {
   OutputEncodingInfo output_encoding_info_;
   std::unique_ptr<ToneMapper> tone_mapper_;
   std::unique_ptr<HlgOOTF> hlg_ootf_;
+  bool gamut_map_ = false;
   // When the target colorspace is PQ, 1 represents 10000 nits instead of
   // orig_intensity_target. This temporarily changes this if the tone mappers
   // require it.
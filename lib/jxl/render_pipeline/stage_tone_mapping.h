@@ -27,7 +27,10 @@ namespace jxl {
 // `output_encoding_info.desired_intensity_target` nits, except in the PQ
 // special case in which it remains 10000.
 //
-// If no tone mapping is necessary, this will return nullptr.
+// If `output_encoding_info.gamut_mapping` is set, out-of-gamut colors are
+// mapped into the gamut of those primaries even if no tone mapping is needed.
+//
+// If neither is necessary, this will return nullptr.
 std::unique_ptr<RenderPipelineStage> GetToneMappingStage(
     const OutputEncodingInfo& output_encoding_info);
 
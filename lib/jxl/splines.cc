@@ -6,8 +6,10 @@
 #include "lib/jxl/splines.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <mutex>
 
 #include "lib/jxl/base/common.h"
 #include "lib/jxl/base/printf_macros.h"
@@ -89,13 +91,20 @@ void DrawSegment(DF df, const SplineSegment& segment, const bool add,
   }
 }
 
-void DrawSegment(const SplineSegment& segment, const bool add, const size_t y,
-                 const ssize_t x0, ssize_t x1, float* JXL_RESTRICT rows[3]) {
-  ssize_t x =
+// Range of the pixels in [x0, x1) that `segment` draws.
+void SegmentRange(const SplineSegment& segment, const ssize_t x0,
+                  const ssize_t x1, ssize_t* begin, ssize_t* end) {
+  *begin =
       std::max<ssize_t>(x0, segment.center_x - segment.maximum_distance + 0.5f);
   // one-past-the-end
-  x1 =
+  *end =
       std::min<ssize_t>(x1, segment.center_x + segment.maximum_distance + 1.5f);
+}
+
+void DrawSegment(const SplineSegment& segment, const bool add, const size_t y,
+                 const ssize_t x0, ssize_t x1, float* JXL_RESTRICT rows[3]) {
+  ssize_t x;
+  SegmentRange(segment, x0, x1, &x, &x1);
   HWY_FULL(float) df;
   for (; x + static_cast<ssize_t>(Lanes(df)) <= x1; x += Lanes(df)) {
     DrawSegment(df, segment, add, y, x, rows);
@@ -105,8 +114,70 @@ void DrawSegment(const SplineSegment& segment, const bool add, const size_t y,
   }
 }
 
+// Segments narrower than a vector are drawn up to kMaxSegmentBatch at a time,
+// one per lane, as long as they all fit in kMaxSegmentBatchWidth pixels.
+constexpr size_t kMaxSegmentBatch = 8;
+constexpr ssize_t kMaxSegmentBatchWidth = 32;
+
+// Draws the `n` segments of `batch` one pixel at a time, evaluating all of them
+// at once. Each pixel gets the contributions in the order of the segments and
+// with the same operations as in DrawSegment, so the result is the same as
+// drawing the segments one after the other.
+template <typename DF>
+void DrawSegmentBatch(DF df, const SplineSegment* const* batch, const size_t n,
+                      const bool add, const size_t y, const ssize_t* begin,
+                      const ssize_t* end, float* JXL_RESTRICT rows[3]) {
+  HWY_ALIGN float center_x[kMaxSegmentBatch] = {};
+  HWY_ALIGN float center_y[kMaxSegmentBatch] = {};
+  HWY_ALIGN float inv_sigma[kMaxSegmentBatch] = {};
+  HWY_ALIGN float sigma_over_4_times_intensity[kMaxSegmentBatch] = {};
+  float color[3][kMaxSegmentBatch];
+  ssize_t x0 = begin[0];
+  ssize_t x1 = end[0];
+  for (size_t k = 0; k < n; ++k) {
+    const SplineSegment& segment = *batch[k];
+    center_x[k] = segment.center_x;
+    center_y[k] = segment.center_y;
+    inv_sigma[k] = segment.inv_sigma;
+    sigma_over_4_times_intensity[k] = segment.sigma_over_4_times_intensity;
+    for (size_t c = 0; c < 3; ++c) {
+      color[c][k] = add ? segment.color[c] : -segment.color[c];
+    }
+    x0 = std::min(x0, begin[k]);
+    x1 = std::max(x1, end[k]);
+  }
+  const auto half = Set(df, 0.5f);
+  const auto one_over_2s2 = Set(df, 0.353553391f);
+  const auto cx = Load(df, center_x);
+  const auto inv_sigmav = Load(df, inv_sigma);
+  const auto sigma_over_4_times_intensityv =
+      Load(df, sigma_over_4_times_intensity);
+  const auto dy = Sub(Set(df, static_cast<float>(y)), Load(df, center_y));
+  const auto dy2 = Mul(dy, dy);
+  const HWY_CAPPED(float, 1) d1;
+  HWY_ALIGN float local_intensity[kMaxSegmentBatch];
+  for (ssize_t x = x0; x < x1; ++x) {
+    const auto dx = Sub(Set(df, static_cast<float>(x)), cx);
+    const auto distance = Sqrt(MulAdd(dx, dx, dy2));
+    const auto one_dimensional_factor = Sub(
+        FastErff(df, Mul(MulAdd(distance, half, one_over_2s2), inv_sigmav)),
+        FastErff(df, Mul(MulSub(distance, half, one_over_2s2), inv_sigmav)));
+    Store(Mul(sigma_over_4_times_intensityv,
+              Mul(one_dimensional_factor, one_dimensional_factor)),
+          df, local_intensity);
+    for (size_t k = 0; k < n; ++k) {
+      if (x < begin[k] || x >= end[k]) continue;
+      const auto intensity = Set(d1, local_intensity[k]);
+      for (size_t c = 0; c < 3; ++c) {
+        const auto in = Set(d1, rows[c][x]);
+        rows[c][x] = GetLane(MulAdd(Set(d1, color[c][k]), intensity, in));
+      }
+    }
+  }
+}
+
 void ComputeSegments(const Spline::Point& center, const float intensity,
-                     const float color[3], const float sigma,
+                     const float color[3], const float sigma, const Rect& cell,
                      std::vector<SplineSegment>& segments,
                      std::vector<std::pair<size_t, size_t>>& segments_by_y) {
   // Sanity check sigma, inverse sigma and intensity
@@ -137,10 +208,17 @@ void ComputeSegments(const Spline::Point& center, const float intensity,
   segment.inv_sigma = 1.0f / sigma;
   segment.sigma_over_4_times_intensity = .25f * sigma * intensity;
   segment.maximum_distance = maximum_distance;
+  // Only keep the segments that draw something in the cell.
+  ssize_t x0, x1;
+  SegmentRange(segment, cell.x0(), cell.x0() + cell.xsize(), &x0, &x1);
+  if (x0 >= x1) return;
   ssize_t y0 = center.y - maximum_distance + .5f;
   ssize_t y1 = center.y + maximum_distance + 1.5f;  // one-past-the-end
-  for (ssize_t y = std::max<ssize_t>(y0, 0); y < y1; y++) {
-    segments_by_y.emplace_back(y, segments.size());
+  y0 = std::max<ssize_t>(y0, cell.y0());
+  y1 = std::min<ssize_t>(y1, cell.y0() + cell.ysize());
+  if (y0 >= y1) return;
+  for (ssize_t y = y0; y < y1; y++) {
+    segments_by_y.emplace_back(y - cell.y0(), segments.size());
   }
   segments.push_back(segment);
 }
@@ -148,32 +226,73 @@ void ComputeSegments(const Spline::Point& center, const float intensity,
 void DrawSegments(float* JXL_RESTRICT row_x, float* JXL_RESTRICT row_y,
                   float* JXL_RESTRICT row_b, const Rect& image_rect,
                   const bool add, const SplineSegment* segments,
-                  const size_t* segment_indices,
-                  const size_t* segment_y_start) {
+                  const size_t* segment_indices, const size_t num_segments) {
   JXL_ASSERT(image_rect.ysize() == 1);
   float* JXL_RESTRICT rows[3] = {row_x - image_rect.x0(),
                                  row_y - image_rect.x0(),
                                  row_b - image_rect.x0()};
-  size_t y = image_rect.y0();
-  for (size_t i = segment_y_start[y]; i < segment_y_start[y + 1]; i++) {
-    DrawSegment(segments[segment_indices[i]], add, y, image_rect.x0(),
-                image_rect.x0() + image_rect.xsize(), rows);
+  const size_t y = image_rect.y0();
+  const ssize_t x0 = image_rect.x0();
+  const ssize_t x1 = image_rect.x0() + image_rect.xsize();
+  const HWY_FULL(float) df;
+  const HWY_CAPPED(float, kMaxSegmentBatch) db;
+  const SplineSegment* batch[kMaxSegmentBatch];
+  ssize_t begin[kMaxSegmentBatch];
+  ssize_t end[kMaxSegmentBatch];
+  size_t i = 0;
+  while (i < num_segments) {
+    size_t n = 0;
+    ssize_t batch_x0 = x1;
+    ssize_t batch_x1 = x0;
+    for (; i < num_segments && n < Lanes(db); ++i) {
+      const SplineSegment& segment = segments[segment_indices[i]];
+      SegmentRange(segment, x0, x1, &begin[n], &end[n]);
+      if (begin[n] >= end[n]) continue;
+      if (end[n] - begin[n] >= static_cast<ssize_t>(Lanes(df))) break;
+      if (n > 0 && std::max(batch_x1, end[n]) - std::min(batch_x0, begin[n]) >
+                       kMaxSegmentBatchWidth) {
+        break;
+      }
+      batch_x0 = std::min(batch_x0, begin[n]);
+      batch_x1 = std::max(batch_x1, end[n]);
+      batch[n++] = &segment;
+    }
+    if (n == 1) {
+      DrawSegment(*batch[0], add, y, x0, x1, rows);
+    } else if (n > 1) {
+      DrawSegmentBatch(db, batch, n, add, y, begin, end, rows);
+    } else if (i < num_segments) {
+      // Wide segments are vectorized along x.
+      DrawSegment(segments[segment_indices[i]], add, y, x0, x1, rows);
+      ++i;
+    }
   }
 }
 
+// Creates the segments of `num_points` consecutive points of `spline`, the
+// first of which is its `first_point`-th one, that draw something in `cell`.
+// The segments of the points can reach at most `max_distance` pixels away.
 void SegmentsFromPoints(
-    const Spline& spline,
-    const std::vector<std::pair<Spline::Point, float>>& points_to_draw,
-    const float arc_length, std::vector<SplineSegment>& segments,
+    const Spline& spline, const std::pair<Spline::Point, float>* points,
+    const size_t num_points, const size_t first_point, const float arc_length,
+    const float max_distance, const Rect& cell,
+    std::vector<SplineSegment>& segments,
     std::vector<std::pair<size_t, size_t>>& segments_by_y) {
   const float inv_arc_length = 1.0f / arc_length;
-  int k = 0;
-  for (const auto& point_to_draw : points_to_draw) {
-    const Spline::Point& point = point_to_draw.first;
-    const float multiplier = point_to_draw.second;
+  const float x0 = cell.x0() - max_distance - 2;
+  const float x1 = cell.x0() + cell.xsize() + max_distance + 1;
+  const float y0 = cell.y0() - max_distance - 2;
+  const float y1 = cell.y0() + cell.ysize() + max_distance + 1;
+  for (size_t i = 0; i < num_points; ++i) {
+    const Spline::Point& point = points[i].first;
+    // Skip the IDCTs of the points that are too far from the cell.
+    if (point.x < x0 || point.x >= x1 || point.y < y0 || point.y >= y1) {
+      continue;
+    }
+    const float multiplier = points[i].second;
+    const size_t k = first_point + i;
     const float progress_along_arc =
         std::min(1.f, (k * kDesiredRenderingDistance) * inv_arc_length);
-    ++k;
     float color[3];
     for (size_t c = 0; c < 3; ++c) {
       color[c] =
@@ -181,7 +300,8 @@ void SegmentsFromPoints(
     }
     const float sigma =
         ContinuousIDCT(spline.sigma_dct, (32 - 1) * progress_along_arc);
-    ComputeSegments(point, multiplier, color, sigma, segments, segments_by_y);
+    ComputeSegments(point, multiplier, color, sigma, cell, segments,
+                    segments_by_y);
   }
 }
 }  // namespace
@@ -197,6 +317,102 @@ HWY_EXPORT(DrawSegments);
 
 namespace {
 
+// Rough operation counts for work estimates: creating a segment evaluates four
+// 32-coefficient ContinuousIDCTs, drawing it costs a few operations for each
+// pixel and channel of its bounding box.
+constexpr double kSegmentWork = 4 * 32;
+constexpr double kSplinePixelWork = 3;
+// Largest kDistanceExp of ComputeSegments, i.e. that of JXL_HIGH_PRECISION.
+constexpr double kMaxDistanceExp = 5;
+// Same as in ComputeSegments.
+#if JXL_HIGH_PRECISION
+constexpr double kDistanceExp = 5;
+#else
+constexpr double kDistanceExp = 3;
+#endif
+
+// The segments are created lazily for each cell of this size. A segment that
+// crosses several cells is created once for each of them.
+constexpr size_t kCellXSize = 256;
+constexpr size_t kCellYSize = 64;
+// Points of a spline are indexed in runs of this many consecutive points.
+constexpr size_t kPointsPerRun = 16;
+
+uint64_t SaturatedWork(double work) {
+  if (work >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  return static_cast<uint64_t>(work);
+}
+
+// Upper bound on the maximum_distance of the segments of `spline`, as computed
+// by ComputeSegments with `distance_exp`. ContinuousIDCT is bounded by sqrt(2)
+// times the sum of the absolute coefficients, and the multiplier of each point
+// by kDesiredRenderingDistance; the margin covers the approximation of the
+// cosines and float rounding.
+double MaxSegmentDistance(const Spline& spline, const double distance_exp) {
+  double max_sigma = 0;
+  double max_color = 0.01;
+  for (int k = 0; k < 32; ++k) {
+    max_sigma += std::abs(spline.sigma_dct[k]);
+  }
+  for (int c = 0; c < 3; ++c) {
+    double color = 0;
+    for (int k = 0; k < 32; ++k) color += std::abs(spline.color_dct[c][k]);
+    max_color =
+        std::max(max_color, color * kSqrt2 * kDesiredRenderingDistance);
+  }
+  max_sigma *= kSqrt2;
+  return 1.01 * max_sigma *
+             std::sqrt(2 * (distance_exp * std::log(10.0) +
+                            std::log(1.01 * max_color))) +
+         1;
+}
+
+// Bounding box [x0, x1) x [y0, y1) of the pixels that the segment of a point
+// at (x, y) may draw, if its segment reaches at most max_distance pixels away.
+struct SegmentBox {
+  SegmentBox(const Spline::Point& point, const double max_distance)
+      : x0(point.x - max_distance - 1),
+        x1(point.x + max_distance + 2),
+        y0(point.y - max_distance - 1),
+        y1(point.y + max_distance + 2) {}
+  void Add(const SegmentBox& other) {
+    x0 = std::min(x0, other.x0);
+    x1 = std::max(x1, other.x1);
+    y0 = std::min(y0, other.y0);
+    y1 = std::max(y1, other.y1);
+  }
+  double x0, x1, y0, y1;
+};
+
+// Range [*begin, *end) of the cells of size cell_size, among num_cells, that
+// intersect [x0, x1).
+void CellRange(const double x0, const double x1, const size_t cell_size,
+               const size_t num_cells, size_t* begin, size_t* end) {
+  *begin = x0 <= 0 ? 0 : std::min<double>(x0 / cell_size, num_cells);
+  *end = x1 <= 0 ? 0 : std::min<double>(x1 / cell_size + 1, num_cells);
+  *begin = std::min(*begin, *end);
+}
+
+// Work of creating the segment of a point in every cell that it may intersect,
+// and of drawing it.
+double PointWork(const SegmentBox& box, const size_t image_xsize,
+                 const size_t image_ysize) {
+  const double xsize =
+      std::min<double>(box.x1, image_xsize) - std::max(box.x0, 0.0);
+  const double ysize =
+      std::min<double>(box.y1, image_ysize) - std::max(box.y0, 0.0);
+  if (xsize <= 0 || ysize <= 0) return 0;
+  size_t cx0, cx1, cy0, cy1;
+  CellRange(box.x0, box.x1, kCellXSize, DivCeil(image_xsize, kCellXSize), &cx0,
+            &cx1);
+  CellRange(box.y0, box.y1, kCellYSize, DivCeil(image_ysize, kCellYSize), &cy0,
+            &cy1);
+  return kSegmentWork * (cx1 - cx0) * (cy1 - cy0) +
+         kSplinePixelWork * xsize * ysize;
+}
+
 // It is not in spec, but reasonable limit to avoid overflows.
 template <typename T>
 Status ValidateSplinePointPos(const T& x, const T& y) {
@@ -552,9 +768,8 @@ void Splines::Clear() {
   quantization_adjustment_ = 0;
   splines_.clear();
   starting_points_.clear();
-  segments_.clear();
-  segment_indices_.clear();
-  segment_y_start_.clear();
+  draw_cache_.reset();
+  draw_work_ = 0;
 }
 
 Status Splines::Decode(jxl::BitReader* br, const size_t num_pixels) {
@@ -608,15 +823,130 @@ void Splines::SubtractFrom(Image3F* const opsin) const {
   return Apply</*add=*/false>(opsin, Rect(*opsin), Rect(*opsin));
 }
 
+// Splines prepared for drawing, with a coarse spatial index of the bounding
+// boxes of runs of their points. The segments of each cell are created when a
+// row of the cell is first drawn.
+struct Splines::DrawCache {
+  // Segments that draw something in a cell, in the order of the splines and
+  // of their points.
+  struct Cell {
+    std::vector<SplineSegment> segments;
+    // Indices in `segments` of the segments that intersect each row of the
+    // cell, in drawing order; those of the i-th row of the cell are at
+    // [row_start[i], row_start[i + 1]).
+    std::vector<size_t> segment_indices;
+    std::vector<size_t> row_start;
+  };
+  // Consecutive points of a spline.
+  struct PointRun {
+    size_t spline;
+    size_t begin;  // Index in `points`.
+    size_t end;
+  };
+
+  Rect CellRect(size_t cx, size_t cy) const {
+    return Rect(cx * kCellXSize, cy * kCellYSize, kCellXSize, kCellYSize,
+                xsize, ysize);
+  }
+
+  const Cell& GetCell(size_t cx, size_t cy);
+
+  size_t xsize;
+  size_t ysize;
+  size_t xcells;
+  size_t ycells;
+  // Dequantized splines; only their DCTs are used.
+  std::vector<Spline> splines;
+  std::vector<float> arc_lengths;
+  // Upper bound on the maximum_distance of the segments of each spline.
+  std::vector<float> max_distances;
+  // Index in `points` of the first point of each spline.
+  std::vector<size_t> first_points;
+  std::vector<std::pair<Spline::Point, float>> points;
+  std::vector<PointRun> runs;
+  // Runs whose bounding box intersects each cell, in increasing order; those
+  // of the i-th cell are at [cell_run_start[i], cell_run_start[i + 1]).
+  std::vector<size_t> cell_run_start;
+  std::vector<size_t> cell_runs;
+  std::vector<Cell> cells;
+  std::unique_ptr<std::once_flag[]> cell_created;
+};
+
+const Splines::DrawCache::Cell& Splines::DrawCache::GetCell(size_t cx,
+                                                             size_t cy) {
+  const size_t idx = cy * xcells + cx;
+  Cell& cell = cells[idx];
+  std::call_once(cell_created[idx], [&]() {
+    const Rect rect = CellRect(cx, cy);
+    std::vector<std::pair<size_t, size_t>> segments_by_y;
+    for (size_t i = cell_run_start[idx]; i < cell_run_start[idx + 1]; ++i) {
+      const PointRun& run = runs[cell_runs[i]];
+      HWY_DYNAMIC_DISPATCH(SegmentsFromPoints)
+      (splines[run.spline], points.data() + run.begin, run.end - run.begin,
+       run.begin - first_points[run.spline], arc_lengths[run.spline],
+       max_distances[run.spline], rect, cell.segments, segments_by_y);
+    }
+    // The pairs are already in the order of the segments, so a counting sort
+    // by row keeps the drawing order of each row.
+    cell.row_start.assign(rect.ysize() + 1, 0);
+    for (const auto& segment_y : segments_by_y) {
+      cell.row_start[segment_y.first + 1]++;
+    }
+    for (size_t y = 0; y < rect.ysize(); ++y) {
+      cell.row_start[y + 1] += cell.row_start[y];
+    }
+    cell.segment_indices.resize(segments_by_y.size());
+    std::vector<size_t> next(cell.row_start.begin(), cell.row_start.end() - 1);
+    for (const auto& segment_y : segments_by_y) {
+      cell.segment_indices[next[segment_y.first]++] = segment_y.second;
+    }
+  });
+  return cell;
+}
+
+Status Splines::EstimateWork(const size_t image_xsize,
+                             const size_t image_ysize,
+                             const ColorCorrelationMap& cmap,
+                             uint64_t* work) const {
+  // Accumulate in double, since the control points can be far apart.
+  double total = 0;
+  uint64_t total_estimated_area_reached = 0;
+  for (size_t i = 0; i < splines_.size(); ++i) {
+    Spline spline;
+    JXL_RETURN_IF_ERROR(splines_[i].Dequantize(
+        starting_points_[i], quantization_adjustment_, cmap.YtoXRatio(0),
+        cmap.YtoBRatio(0), image_xsize * image_ysize,
+        &total_estimated_area_reached, spline));
+    double length = 0;
+    for (size_t k = 1; k < spline.control_points.size(); ++k) {
+      length += std::sqrt(
+          (spline.control_points[k] - spline.control_points[k - 1])
+              .SquaredNorm());
+    }
+    // The interpolated curve can be longer than its control polygon; twice
+    // the length is generous in practice, and InitializeDrawCache enforces
+    // the actual count anyway.
+    const double num_points = 2 * length / kDesiredRenderingDistance + 2;
+    const double side = 2 * MaxSegmentDistance(spline, kMaxDistanceExp) + 3;
+    const double cells =
+        std::min<double>(side / kCellXSize + 2,
+                         DivCeil(image_xsize, kCellXSize)) *
+        std::min<double>(side / kCellYSize + 2,
+                         DivCeil(image_ysize, kCellYSize));
+    const double area = std::min<double>(side, image_xsize) *
+                        std::min<double>(side, image_ysize);
+    total += num_points * (kSegmentWork * cells + kSplinePixelWork * area);
+  }
+  *work = SaturatedWork(total);
+  return true;
+}
+
 Status Splines::InitializeDrawCache(const size_t image_xsize,
                                     const size_t image_ysize,
-                                    const ColorCorrelationMap& cmap) {
-  // TODO(veluca): avoid storing segments that are entirely outside image
-  // boundaries.
-  segments_.clear();
-  segment_indices_.clear();
-  segment_y_start_.clear();
-  std::vector<std::pair<size_t, size_t>> segments_by_y;
+                                    const ColorCorrelationMap& cmap,
+                                    const uint64_t work_limit) {
+  draw_cache_.reset();
+  draw_work_ = 0;
   std::vector<Spline::Point> intermediate_points;
   uint64_t total_estimated_area_reached = 0;
   std::vector<Spline> splines;
@@ -648,6 +978,14 @@ Status Splines::InitializeDrawCache(const size_t image_xsize,
 #endif
   }
 
+  auto cache = std::make_shared<DrawCache>();
+  cache->xsize = image_xsize;
+  cache->ysize = image_ysize;
+  cache->xcells = DivCeil(image_xsize, kCellXSize);
+  cache->ycells = DivCeil(image_ysize, kCellYSize);
+  // Cell ranges of the bounding box of each run.
+  std::vector<std::array<size_t, 4>> run_cells;
+  double draw_work = 0;
   for (Spline& spline : splines) {
     std::vector<std::pair<Spline::Point, float>> points_to_draw;
     auto add_point = [&](const Spline::Point& point, const float multiplier) {
@@ -663,24 +1001,71 @@ Status Splines::InitializeDrawCache(const size_t image_xsize,
       // This spline wouldn't have any effect.
       continue;
     }
-    HWY_DYNAMIC_DISPATCH(SegmentsFromPoints)
-    (spline, points_to_draw, arc_length, segments_, segments_by_y);
-  }
-
-  // TODO(eustas): consider linear sorting here.
-  std::sort(segments_by_y.begin(), segments_by_y.end());
-  segment_indices_.resize(segments_by_y.size());
-  segment_y_start_.resize(image_ysize + 1);
-  for (size_t i = 0; i < segments_by_y.size(); i++) {
-    segment_indices_[i] = segments_by_y[i].second;
-    size_t y = segments_by_y[i].first;
-    if (y < image_ysize) {
-      segment_y_start_[y + 1]++;
+    const double max_distance = MaxSegmentDistance(spline, kDistanceExp);
+    const size_t first_point = cache->points.size();
+    for (size_t begin = 0; begin < points_to_draw.size();
+         begin += kPointsPerRun) {
+      const size_t end = std::min(begin + kPointsPerRun, points_to_draw.size());
+      SegmentBox box(points_to_draw[begin].first, max_distance);
+      for (size_t i = begin; i < end; ++i) {
+        const SegmentBox point_box(points_to_draw[i].first, max_distance);
+        draw_work += PointWork(point_box, image_xsize, image_ysize);
+        box.Add(point_box);
+      }
+      std::array<size_t, 4> cells;
+      CellRange(box.x0, box.x1, kCellXSize, cache->xcells, &cells[0],
+                &cells[1]);
+      CellRange(box.y0, box.y1, kCellYSize, cache->ycells, &cells[2],
+                &cells[3]);
+      if (cells[0] == cells[1] || cells[2] == cells[3]) {
+        // These points can't draw anything in the image.
+        continue;
+      }
+      cache->runs.push_back(DrawCache::PointRun{
+          cache->splines.size(), first_point + begin, first_point + end});
+      run_cells.push_back(cells);
+    }
+    draw_work_ = SaturatedWork(draw_work);
+    if (draw_work_ > work_limit) {
+      return JXL_STATUS(StatusCode::kWorkBudgetExceeded,
+                        "Splines need more than %" PRIu64 " operations",
+                        work_limit);
+    }
+    cache->points.insert(cache->points.end(), points_to_draw.begin(),
+                         points_to_draw.end());
+    cache->first_points.push_back(first_point);
+    cache->arc_lengths.push_back(arc_length);
+    cache->max_distances.push_back(max_distance);
+    cache->splines.push_back(std::move(spline));
+  }
+
+  // Counting sort of the runs by cell, which keeps them in order in each cell.
+  const size_t num_cells = cache->xcells * cache->ycells;
+  cache->cell_run_start.assign(num_cells + 1, 0);
+  for (const auto& cells : run_cells) {
+    for (size_t cy = cells[2]; cy < cells[3]; ++cy) {
+      for (size_t cx = cells[0]; cx < cells[1]; ++cx) {
+        cache->cell_run_start[cy * cache->xcells + cx + 1]++;
+      }
     }
   }
-  for (size_t y = 0; y < image_ysize; y++) {
-    segment_y_start_[y + 1] += segment_y_start_[y];
+  for (size_t i = 0; i < num_cells; ++i) {
+    cache->cell_run_start[i + 1] += cache->cell_run_start[i];
+  }
+  cache->cell_runs.resize(cache->cell_run_start[num_cells]);
+  std::vector<size_t> next(cache->cell_run_start.begin(),
+                           cache->cell_run_start.end() - 1);
+  for (size_t i = 0; i < run_cells.size(); ++i) {
+    const auto& cells = run_cells[i];
+    for (size_t cy = cells[2]; cy < cells[3]; ++cy) {
+      for (size_t cx = cells[0]; cx < cells[1]; ++cx) {
+        cache->cell_runs[next[cy * cache->xcells + cx]++] = i;
+      }
+    }
   }
+  cache->cells.resize(num_cells);
+  cache->cell_created.reset(new std::once_flag[num_cells]);
+  draw_cache_ = std::move(cache);
   return true;
 }
 
@@ -688,19 +1073,31 @@ template <bool add>
 void Splines::ApplyToRow(float* JXL_RESTRICT row_x, float* JXL_RESTRICT row_y,
                          float* JXL_RESTRICT row_b,
                          const Rect& image_row) const {
-  if (segments_.empty()) return;
+  if (!draw_cache_ || draw_cache_->runs.empty()) return;
   JXL_ASSERT(image_row.ysize() == 1);
-  for (size_t iy = 0; iy < image_row.ysize(); iy++) {
+  DrawCache& cache = *draw_cache_;
+  const size_t y = image_row.y0();
+  if (y >= cache.ysize) return;
+  const size_t cy = y / kCellYSize;
+  const size_t x1 = std::min(image_row.x0() + image_row.xsize(), cache.xsize);
+  for (size_t x0 = image_row.x0(); x0 < x1;) {
+    const size_t cx = x0 / kCellXSize;
+    const size_t cell_x1 = std::min((cx + 1) * kCellXSize, x1);
+    const DrawCache::Cell& cell = cache.GetCell(cx, cy);
+    const size_t* row_start = cell.row_start.data() + y - cy * kCellYSize;
+    const size_t offset = x0 - image_row.x0();
     HWY_DYNAMIC_DISPATCH(DrawSegments)
-    (row_x, row_y, row_b, image_row.Line(iy), add, segments_.data(),
-     segment_indices_.data(), segment_y_start_.data());
+    (row_x + offset, row_y + offset, row_b + offset,
+     Rect(x0, y, cell_x1 - x0, 1), add, cell.segments.data(),
+     cell.segment_indices.data() + row_start[0], row_start[1] - row_start[0]);
+    x0 = cell_x1;
   }
 }
 
 template <bool add>
 void Splines::Apply(Image3F* const opsin, const Rect& opsin_rect,
                     const Rect& image_rect) const {
-  if (segments_.empty()) return;
+  if (!draw_cache_) return;
   for (size_t iy = 0; iy < image_rect.ysize(); iy++) {
     const size_t y0 = opsin_rect.Line(iy).y0();
     const size_t x0 = opsin_rect.x0();
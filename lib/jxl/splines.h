@@ -9,6 +9,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -121,8 +123,24 @@ class Splines {
 
   int32_t GetQuantizationAdjustment() const { return quantization_adjustment_; }
 
-  Status InitializeDrawCache(size_t image_xsize, size_t image_ysize,
-                             const ColorCorrelationMap& cmap);
+  // Estimates the number of operations needed to initialize the draw cache
+  // and render the splines from the quantized control points alone, i.e.
+  // without creating any segment.
+  Status EstimateWork(size_t image_xsize, size_t image_ysize,
+                      const ColorCorrelationMap& cmap, uint64_t* work) const;
+
+  // Prepares the splines for drawing into an image of the given size. The
+  // segments of each cell of the image are only created when a row of that
+  // cell is first drawn, which may happen concurrently from several threads.
+  // Fails with StatusCode::kWorkBudgetExceeded as soon as the splines
+  // prepared so far need more than `work_limit` operations.
+  Status InitializeDrawCache(
+      size_t image_xsize, size_t image_ysize, const ColorCorrelationMap& cmap,
+      uint64_t work_limit = std::numeric_limits<uint64_t>::max());
+
+  // Upper bound on the number of operations needed to create and render the
+  // segments of the draw cache; only meaningful after InitializeDrawCache.
+  uint64_t DrawWork() const { return draw_work_; }
 
  private:
   template <bool>
@@ -138,9 +156,10 @@ class Splines {
   int32_t quantization_adjustment_ = 0;
   std::vector<QuantizedSpline> splines_;
   std::vector<Spline::Point> starting_points_;
-  std::vector<SplineSegment> segments_;
-  std::vector<size_t> segment_indices_;
-  std::vector<size_t> segment_y_start_;
+  // Copies of Splines share the draw cache.
+  struct DrawCache;
+  std::shared_ptr<DrawCache> draw_cache_;
+  uint64_t draw_work_ = 0;
 };
 
 }  // namespace jxl
@@ -321,6 +321,112 @@ TEST(SplinesTest, Drawing) {
       *io_expected.Main().color(), *io_actual.Main().color(), 1e-2f, 1e-1f, _));
 }
 
+TEST(SplinesTest, DrawingIsCroppable) {
+  std::vector<Spline::Point> control_points{{9, 54},  {118, 159}, {97, 3},
+                                            {10, 40}, {150, 25},  {120, 300},
+                                            {300, 70}};
+  const Spline spline{
+      control_points,
+      /*color_dct=*/
+      {{0.5f, 0.5f}, {0.5f, 0.f, 0.5f}, {0.f, 0.5f, 0.5f}},
+      /*sigma_dct=*/{1.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.5f}};
+  auto make_splines = [&]() {
+    std::vector<QuantizedSpline> quantized_splines;
+    quantized_splines.emplace_back(spline, kQuantizationAdjustment, kYToX,
+                                   kYToB);
+    std::vector<Spline::Point> starting_points{control_points.front()};
+    return Splines(kQuantizationAdjustment, std::move(quantized_splines),
+                   std::move(starting_points));
+  };
+  auto expect_same_pixels = [](const Image3F& expected, const Image3F& actual,
+                               const Rect& rect) {
+    for (size_t c = 0; c < 3; ++c) {
+      for (size_t y = 0; y < rect.ysize(); ++y) {
+        for (size_t x = 0; x < rect.xsize(); ++x) {
+          ASSERT_EQ(rect.ConstPlaneRow(expected, c, y)[x],
+                    rect.ConstPlaneRow(actual, c, y)[x]);
+        }
+      }
+    }
+  };
+
+  Splines splines = make_splines();
+  Image3F image(320, 320);
+  ZeroFillImage(&image);
+  ASSERT_TRUE(splines.InitializeDrawCache(image.xsize(), image.ysize(), *cmap));
+  splines.AddTo(&image, Rect(image), Rect(image));
+
+  // Segments are created for each cell of the image when it is first drawn.
+  // Drawing the rows bottom-up and in pieces that straddle the cells gives
+  // exactly the same pixels.
+  Splines piecewise_splines = make_splines();
+  Image3F piecewise(320, 320);
+  ZeroFillImage(&piecewise);
+  ASSERT_TRUE(piecewise_splines.InitializeDrawCache(piecewise.xsize(),
+                                                    piecewise.ysize(), *cmap));
+  const size_t cuts[] = {0, 3, 100, 250, 257, 320};
+  for (size_t y = piecewise.ysize(); y-- > 0;) {
+    for (size_t i = 0; i + 1 < sizeof(cuts) / sizeof(cuts[0]); ++i) {
+      const Rect piece(cuts[i], y, cuts[i + 1] - cuts[i], 1);
+      piecewise_splines.AddTo(&piecewise, piece, piece);
+    }
+  }
+  expect_same_pixels(image, piecewise, Rect(image));
+
+  // Segments outside of a smaller image are skipped; what remains must draw
+  // exactly the same pixels.
+  Splines small_splines = make_splines();
+  Image3F small_image(130, 70);
+  ZeroFillImage(&small_image);
+  ASSERT_TRUE(small_splines.InitializeDrawCache(small_image.xsize(),
+                                                small_image.ysize(), *cmap));
+  small_splines.AddTo(&small_image, Rect(small_image), Rect(small_image));
+  expect_same_pixels(image, small_image, Rect(small_image));
+
+  // Drawing only a crop of the image gives the same pixels in that crop.
+  Splines cropped_splines = make_splines();
+  Image3F cropped(320, 320);
+  ZeroFillImage(&cropped);
+  ASSERT_TRUE(
+      cropped_splines.InitializeDrawCache(cropped.xsize(), cropped.ysize(),
+                                          *cmap));
+  const Rect crop(237, 21, 60, 90);
+  cropped_splines.AddTo(&cropped, crop, crop);
+  expect_same_pixels(image, cropped, crop);
+}
+
+TEST(SplinesTest, WorkEstimateAndLimit) {
+  std::vector<Spline::Point> control_points{{9, 54},  {118, 159}, {97, 3},
+                                            {10, 40}, {150, 25},  {120, 300}};
+  const Spline spline{
+      control_points,
+      /*color_dct=*/
+      {{0.5f, 0.5f}, {0.5f, 0.f, 0.5f}, {0.f, 0.5f, 0.5f}},
+      /*sigma_dct=*/{1.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.5f}};
+  std::vector<QuantizedSpline> quantized_splines;
+  quantized_splines.emplace_back(spline, kQuantizationAdjustment, kYToX,
+                                 kYToB);
+  std::vector<Spline::Point> starting_points{control_points.front()};
+  Splines splines(kQuantizationAdjustment, std::move(quantized_splines),
+                  std::move(starting_points));
+
+  // The estimate only looks at the control points, but covers the segments
+  // that are actually created.
+  uint64_t estimate = 0;
+  ASSERT_TRUE(splines.EstimateWork(320, 320, *cmap, &estimate));
+  ASSERT_TRUE(splines.InitializeDrawCache(320, 320, *cmap));
+  const uint64_t work = splines.DrawWork();
+  EXPECT_GT(work, 0u);
+  EXPECT_GE(estimate, work);
+  EXPECT_LE(estimate, 16 * work);
+
+  ASSERT_TRUE(splines.InitializeDrawCache(320, 320, *cmap, work));
+  EXPECT_EQ(work, splines.DrawWork());
+  const Status status = splines.InitializeDrawCache(320, 320, *cmap, work - 1);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(StatusCode::kWorkBudgetExceeded, status.code());
+}
+
 TEST(SplinesTest, ClearedEveryFrame) {
   CodecInOut io_expected;
   const PaddedBytes bytes_expected =
@@ -19,6 +19,42 @@ size_t MaxBits(const size_t num_sizes) {
   return 1 + kBitsPerByte + entry_bits + kBitsPerByte;
 }
 
+namespace {
+
+// Decodes `num` kTocDist-coded entries. Equivalent to calling U32Coder::Read
+// for each of them, but while enough input remains, uses a single unchecked
+// refill and table lookups per entry.
+void ReadTocEntries(size_t num, BitReader* JXL_RESTRICT reader,
+                    uint32_t* JXL_RESTRICT sizes) {
+  // Every entry takes at most 2 selector bits and 30 extra bits.
+  constexpr size_t kMaxEntryBytes = 4;
+  uint32_t extra_bits[4];
+  uint32_t offsets[4];
+  for (uint32_t selector = 0; selector < 4; ++selector) {
+    const U32Distr d = kTocDist.GetDistr(selector);
+    JXL_DASSERT(!d.IsDirect());
+    extra_bits[selector] = d.ExtraBits();
+    offsets[selector] = d.Offset();
+  }
+  const size_t fast_bytes = reader->FastRefillBytes();
+  size_t num_fast = fast_bytes < 8 ? 0 : (fast_bytes - 8) / kMaxEntryBytes;
+  if (num_fast > num) num_fast = num;
+  size_t i = 0;
+  for (; i < num_fast; ++i) {
+    reader->RefillUnchecked();
+    const size_t selector = reader->PeekFixedBits<2>();
+    reader->Consume(2);
+    const size_t nbits = extra_bits[selector];
+    sizes[i] = reader->PeekBits(nbits) + offsets[selector];
+    reader->Consume(nbits);
+  }
+  for (; i < num; ++i) {
+    sizes[i] = U32Coder::Read(kTocDist, reader);
+  }
+}
+
+}  // namespace
+
 Status ReadToc(size_t toc_entries, BitReader* JXL_RESTRICT reader,
                std::vector<uint32_t>* JXL_RESTRICT sizes,
                std::vector<coeff_order_t>* JXL_RESTRICT permutation) {
@@ -56,9 +92,7 @@ Status ReadToc(size_t toc_entries, BitReader* JXL_RESTRICT reader,
   }
   JXL_RETURN_IF_ERROR(reader->JumpToByteBoundary());
   JXL_RETURN_IF_ERROR(check_bit_budget(toc_entries));
-  for (size_t i = 0; i < toc_entries; ++i) {
-    (*sizes)[i] = U32Coder::Read(kTocDist, reader);
-  }
+  ReadTocEntries(toc_entries, reader, sizes->data());
   JXL_RETURN_IF_ERROR(reader->JumpToByteBoundary());
   JXL_RETURN_IF_ERROR(check_bit_budget(0));
   return true;
@@ -0,0 +1,52 @@
+// Copyright (c) the JPEG XL Project Authors. All rights reserved.
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "lib/jxl/base/random.h"
+#include "lib/jxl/base/status.h"
+#include "lib/jxl/dec_bit_reader.h"
+#include "lib/jxl/enc_aux_out.h"
+#include "lib/jxl/enc_bit_writer.h"
+#include "lib/jxl/fields.h"
+#include "lib/jxl/toc.h"
+
+namespace jxl {
+namespace {
+
+// Writes a TOC of num_entries groups with sizes typical for AC groups.
+void WriteTestToc(size_t num_entries, BitWriter* writer) {
+  Rng rng(0);
+  BitWriter::Allotment allotment(writer, MaxBits(num_entries));
+  writer->Write(1, 0);  // no permutation
+  writer->ZeroPadToByte();
+  for (size_t i = 0; i < num_entries; ++i) {
+    JXL_CHECK(U32Coder::Write(kTocDist, rng.UniformU(64, 1 << 16), writer));
+  }
+  writer->ZeroPadToByte();
+  AuxOut aux_out;
+  allotment.ReclaimAndCharge(writer, 0, &aux_out);
+}
+
+void BM_ReadToc(benchmark::State& state) {
+  const size_t num_entries = state.range(0);
+  BitWriter writer;
+  WriteTestToc(num_entries, &writer);
+  std::vector<uint32_t> sizes;
+  std::vector<coeff_order_t> permutation;
+  for (auto _ : state) {
+    BitReader reader(writer.GetSpan());
+    JXL_CHECK(ReadToc(num_entries, &reader, &sizes, &permutation));
+    JXL_CHECK(reader.Close());
+    benchmark::DoNotOptimize(sizes.data());
+  }
+  state.SetItemsProcessed(num_entries * state.iterations());
+}
+
+BENCHMARK(BM_ReadToc)->Range(16, 1 << 16);
+
+}  // namespace
+}  // namespace jxl
@@ -10,6 +10,7 @@
 #include "lib/jxl/base/span.h"
 #include "lib/jxl/enc_aux_out.h"
 #include "lib/jxl/enc_toc.h"
+#include "lib/jxl/fields.h"
 #include "lib/jxl/testing.h"
 
 namespace jxl {
@@ -88,5 +89,37 @@ TEST(TocTest, Test) {
   }
 }
 
+TEST(TocTest, LargeTocAllSelectors) {
+  Rng rng(0);
+  // Enough entries for the unchecked fast path, with values of every
+  // kTocDist selector.
+  const uint32_t kMaxSize[4] = {1023, 17407, 4211711, 1u << 30};
+  for (size_t num_entries : {1, 5, 17, 5000}) {
+    std::vector<uint32_t> expected(num_entries);
+    for (uint32_t& size : expected) {
+      size = rng.UniformU(0, kMaxSize[rng.UniformU(0, 4)] + 1);
+    }
+    BitWriter writer;
+    BitWriter::Allotment allotment(&writer, MaxBits(num_entries));
+    writer.Write(1, 0);  // no permutation
+    writer.ZeroPadToByte();
+    for (uint32_t size : expected) {
+      ASSERT_TRUE(U32Coder::Write(kTocDist, size, &writer));
+    }
+    writer.ZeroPadToByte();
+    AuxOut aux_out;
+    allotment.ReclaimAndCharge(&writer, 0, &aux_out);
+
+    BitReader reader(writer.GetSpan());
+    std::vector<uint32_t> sizes;
+    std::vector<coeff_order_t> permutation;
+    ASSERT_TRUE(ReadToc(num_entries, &reader, &sizes, &permutation));
+    EXPECT_TRUE(permutation.empty());
+    EXPECT_EQ(expected, sizes);
+    EXPECT_EQ(writer.BitsWritten(), reader.TotalBitsConsumed());
+    EXPECT_TRUE(reader.Close());
+  }
+}
+
 }  // namespace
 }  // namespace jxl
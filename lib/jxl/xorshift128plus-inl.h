@@ -83,6 +83,35 @@ class Xorshift128Plus {
 #endif
   }
 
+  // Same output as `num_batches` consecutive calls to Fill, stored one batch
+  // after the other, but the state stays in registers in between.
+  // `random_bits` need not be aligned.
+  HWY_INLINE HWY_MAYBE_UNUSED void Fill(uint64_t* HWY_RESTRICT random_bits,
+                                        size_t num_batches) {
+#if HWY_CAP_INTEGER64
+    const HWY_FULL(uint64_t) d;
+    // The N generators are independent, so we can run each group of lanes
+    // through all batches before moving on to the next one.
+    for (size_t i = 0; i < N; i += Lanes(d)) {
+      auto s0 = Load(d, s0_ + i);
+      auto s1 = Load(d, s1_ + i);
+      for (size_t b = 0; b < num_batches; ++b) {
+        auto t = s0;
+        s0 = s1;
+        StoreU(Add(t, s1), d, random_bits + b * N + i);
+        t = Xor(t, ShiftLeft<23>(t));
+        s1 = Xor(t, Xor(s0, Xor(ShiftRight<18>(t), ShiftRight<5>(s0))));
+      }
+      Store(s0, d, s0_ + i);
+      Store(s1, d, s1_ + i);
+    }
+#else
+    for (size_t b = 0; b < num_batches; ++b) {
+      Fill(random_bits + b * N);
+    }
+#endif
+  }
+
  private:
   static uint64_t SplitMix64(uint64_t z) {
     z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
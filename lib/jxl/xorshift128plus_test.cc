@@ -262,6 +262,24 @@ void TestGolden() {
   }
 }
 
+#if !PRINT_RESULTS
+// Filling several batches at once matches consecutive calls to Fill.
+void TestGoldenBatches() {
+  HWY_ALIGN Xorshift128Plus rng(12345);
+  std::vector<uint64_t> lanes(kVectors * Xorshift128Plus::N + 1);
+  // Unaligned on purpose.
+  rng.Fill(lanes.data() + 1, kVectors / 2);
+  rng.Fill(lanes.data() + 1 + kVectors / 2 * Xorshift128Plus::N, kVectors / 2);
+  for (uint64_t vector = 0; vector < kVectors; ++vector) {
+    for (size_t i = 0; i < Xorshift128Plus::N; ++i) {
+      ASSERT_EQ(kExpected[vector][i],
+                lanes[1 + vector * Xorshift128Plus::N + i])
+          << "Where vector=" << vector << " i=" << i;
+    }
+  }
+}
+#endif  // PRINT_RESULTS
+
 // Output changes when given different seeds
 void TestSeedChanges() {
   HWY_ALIGN uint64_t lanes[Xorshift128Plus::N];
@@ -371,6 +389,9 @@ HWY_TARGET_INSTANTIATE_TEST_SUITE_P(Xorshift128Test);
 
 HWY_EXPORT_AND_TEST_P(Xorshift128Test, TestNotZero);
 HWY_EXPORT_AND_TEST_P(Xorshift128Test, TestGolden);
+#if !PRINT_RESULTS
+HWY_EXPORT_AND_TEST_P(Xorshift128Test, TestGoldenBatches);
+#endif
 HWY_EXPORT_AND_TEST_P(Xorshift128Test, TestSeedChanges);
 HWY_EXPORT_AND_TEST_P(Xorshift128Test, TestFloat);
 
@@ -29,6 +29,7 @@ if(benchmark_FOUND)
   target_link_libraries(jxl_gbench
     jxl_extras-static
     jxl-static
+    jxl_threads-static
     benchmark::benchmark
   )
 endif() # benchmark_FOUND
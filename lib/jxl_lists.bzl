@@ -19,6 +19,7 @@ libjxl_base_sources = [
     "jxl/base/fast_math-inl.h",
     "jxl/base/float.h",
     "jxl/base/iaca.h",
+    "jxl/base/jpeg_entropy.h",
     "jxl/base/matrix_ops.h",
     "jxl/base/os_macros.h",
     "jxl/base/override.h",
@@ -185,8 +186,6 @@ libjxl_dec_sources = [
     "jxl/epf.h",
     "jxl/exif.h",
     "jxl/fast_dct-inl.h",
-    "jxl/fast_dct.cc",
-    "jxl/fast_dct.h",
     "jxl/fast_dct128-inl.h",
     "jxl/fast_dct16-inl.h",
     "jxl/fast_dct256-inl.h",
@@ -393,6 +392,8 @@ libjxl_enc_sources = [
     "jxl/enc_xyb.h",
     "jxl/encode.cc",
     "jxl/encode_internal.h",
+    "jxl/jpeg/enc_jpeg_arith_decode.cc",
+    "jxl/jpeg/enc_jpeg_arith_decode.h",
     "jxl/jpeg/enc_jpeg_data.cc",
     "jxl/jpeg/enc_jpeg_data.h",
     "jxl/jpeg/enc_jpeg_data_reader.cc",
@@ -453,10 +454,15 @@ libjxl_extras_sources = [
 libjxl_gbench_sources = [
     "extras/tone_mapping_gbench.cc",
     "jxl/dec_external_image_gbench.cc",
+    "jxl/decode_gbench.cc",
     "jxl/enc_external_image_gbench.cc",
+    "jxl/enc_group_gbench.cc",
+    "jxl/fast_dct_gbench.cc",
     "jxl/gauss_blur_gbench.cc",
+    "jxl/large_image_gbench.cc",
     "jxl/splines_gbench.cc",
     "jxl/tf_gbench.cc",
+    "jxl/toc_gbench.cc",
 ]
 
 libjxl_jpegli_lib_version = 62
@@ -571,6 +577,9 @@ libjxl_testlib_files = [
     "jxl/dec_transforms_testonly.cc",
     "jxl/dec_transforms_testonly.h",
     "jxl/fake_parallel_runner_testonly.h",
+    "jxl/fast_dct.cc",
+    "jxl/fast_dct.h",
+    "jxl/fast_dct_testonly-inl.h",
     "jxl/image_test_utils.h",
     "jxl/render_pipeline/test_render_pipeline_stages.h",
     "jxl/test_image.cc",
@@ -602,6 +611,7 @@ libjxl_tests = [
     "jxl/decode_test.cc",
     "jxl/enc_external_image_test.cc",
     "jxl/enc_gaborish_test.cc",
+    "jxl/enc_group_test.cc",
     "jxl/enc_linalg_test.cc",
     "jxl/enc_optimize_test.cc",
     "jxl/enc_photon_noise_test.cc",
@@ -617,6 +627,7 @@ libjxl_tests = [
     "jxl/icc_codec_test.cc",
     "jxl/image_bundle_test.cc",
     "jxl/image_ops_test.cc",
+    "jxl/jpeg/enc_jpeg_data_reader_test.cc",
     "jxl/jxl_test.cc",
     "jxl/lehmer_code_test.cc",
     "jxl/modular_test.cc",
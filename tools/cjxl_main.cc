@@ -18,6 +18,7 @@
 #include <jxl/thread_parallel_runner_cxx.h>
 #include <jxl/types.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <cmath>
 #include <cstdlib>
@@ -588,6 +589,12 @@ bool IsJPG(const std::vector<uint8_t>& image_data) {
           image_data[1] == 0xD8);
 }
 
+bool IsPNG(const std::vector<uint8_t>& image_data) {
+  static const uint8_t kSignature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+  return (image_data.size() >= sizeof(kSignature) &&
+          memcmp(image_data.data(), kSignature, sizeof(kSignature)) == 0);
+}
+
 using flag_check_fn = std::function<std::string(int64_t)>;
 using flag_check_float_fn = std::function<std::string(float)>;
 
@@ -986,59 +993,6 @@ int main(int argc, char** argv) {
   if (!jpegxl::tools::IsJPG(image_data)) args.lossless_jpeg = 0;
   jxl::extras::JXLCompressParams params;
   ProcessFlags(codec, ppf, jpeg_bytes, &cmdline, &args, &params);
-  if (!args.lossless_jpeg) {
-    const double t0 = jxl::Now();
-    jxl::Status status = jxl::extras::DecodeBytes(
-        jxl::Span<const uint8_t>(image_data), args.color_hints_proxy.target,
-        &ppf, nullptr, &codec);
-
-    if (!status) {
-      std::cerr << "Getting pixel data failed." << std::endl;
-      exit(EXIT_FAILURE);
-    }
-    if (ppf.frames.empty()) {
-      std::cerr << "No frames on input file." << std::endl;
-      exit(EXIT_FAILURE);
-    }
-
-    const double t1 = jxl::Now();
-    pixels = ppf.info.xsize * ppf.info.ysize;
-    decode_mps = pixels * ppf.info.num_color_channels * 1E-6 / (t1 - t0);
-  }
-  if (args.lossless_jpeg && jpegxl::tools::IsJPG(image_data)) {
-    if (!cmdline.GetOption(args.opt_lossless_jpeg_id)->matched()) {
-      std::cerr << "Note: Implicit-default for JPEG is lossless-transcoding. "
-                << "To silence this message, set --lossless_jpeg=(1|0)."
-                << std::endl;
-    }
-    jpeg_bytes = &image_data;
-  }
-
-  ProcessFlags(codec, ppf, jpeg_bytes, &cmdline, &args, &params);
-
-  if (!ppf.metadata.exif.empty()) {
-    jxl::InterpretExif(ppf.metadata.exif, &ppf.info.orientation);
-  }
-
-  if (!ppf.metadata.exif.empty() || !ppf.metadata.xmp.empty() ||
-      !ppf.metadata.jumbf.empty() || !ppf.metadata.iptc.empty() ||
-      (args.lossless_jpeg && args.jpeg_store_metadata)) {
-    if (args.container == jxl::Override::kDefault) {
-      args.container = jxl::Override::kOn;
-    } else if (args.container == jxl::Override::kOff) {
-      cmdline.VerbosePrintf(
-          1, "Stripping all metadata due to explicit container=0\n");
-      ppf.metadata.exif.clear();
-      ppf.metadata.xmp.clear();
-      ppf.metadata.jumbf.clear();
-      ppf.metadata.iptc.clear();
-      args.jpeg_store_metadata = 0;
-    }
-  }
-
-  if (!args.quiet) {
-    PrintMode(ppf, decode_mps, image_data.size(), args, cmdline);
-  }
 
   size_t num_worker_threads = JxlThreadParallelRunnerDefaultNumWorkerThreads();
   int64_t flag_num_worker_threads = args.num_threads;
@@ -1047,20 +1001,127 @@ int main(int argc, char** argv) {
   }
   JxlThreadParallelRunnerPtr runner = JxlThreadParallelRunnerMake(
       /*memory_manager=*/nullptr, num_worker_threads);
-  params.runner = JxlThreadParallelRunner;
-  params.runner_opaque = runner.get();
+
+  // Applies the metadata of the decoded image to the encoding settings.
+  const auto process_metadata = [&](jxl::extras::PackedPixelFile* ppf) {
+    if (!ppf->metadata.exif.empty()) {
+      jxl::InterpretExif(ppf->metadata.exif, &ppf->info.orientation);
+    }
+
+    if (!ppf->metadata.exif.empty() || !ppf->metadata.xmp.empty() ||
+        !ppf->metadata.jumbf.empty() || !ppf->metadata.iptc.empty() ||
+        (args.lossless_jpeg && args.jpeg_store_metadata)) {
+      if (args.container == jxl::Override::kDefault) {
+        args.container = jxl::Override::kOn;
+      } else if (args.container == jxl::Override::kOff) {
+        cmdline.VerbosePrintf(
+            1, "Stripping all metadata due to explicit container=0\n");
+        ppf->metadata.exif.clear();
+        ppf->metadata.xmp.clear();
+        ppf->metadata.jumbf.clear();
+        ppf->metadata.iptc.clear();
+        args.jpeg_store_metadata = 0;
+      }
+    }
+
+    if (!args.quiet) {
+      PrintMode(*ppf, decode_mps, image_data.size(), args, cmdline);
+    }
+  };
 
   jpegxl::tools::SpeedStats stats;
   std::vector<uint8_t> compressed;
-  for (size_t num_rep = 0; num_rep < args.num_reps; ++num_rep) {
+  size_t num_frames = 0;
+  bool encoded = false;
+  // PNG and APNG input is encoded frame by frame while it is being decoded,
+  // so that the whole decoded image never has to be in memory at once.
+  if (!args.lossless_jpeg && args.num_reps == 1 &&
+      args.frame_indexing.empty() && jpegxl::tools::IsPNG(image_data) &&
+      jxl::extras::CanDecodeAPNG()) {
+    codec = jxl::extras::Codec::kPNG;
+    ProcessFlags(codec, ppf, jpeg_bytes, &cmdline, &args, &params);
+    params.runner = JxlThreadParallelRunner;
+    params.runner_opaque = runner.get();
     const double t0 = jxl::Now();
-    if (!EncodeImageJXL(params, ppf, jpeg_bytes, &compressed)) {
+    const auto decoder =
+        [&](jxl::extras::PackedPixelFile* decoded,
+            const std::function<jxl::Status(jxl::extras::PackedFrame&&)>&
+                frame_callback) -> jxl::Status {
+      bool first_frame = true;
+      return jxl::extras::DecodeImageAPNGFrames(
+          jxl::Span<const uint8_t>(image_data), args.color_hints_proxy.target,
+          decoded, nullptr,
+          [&](jxl::extras::PackedFrame&& frame) -> jxl::Status {
+            if (first_frame) {
+              first_frame = false;
+              pixels = decoded->info.xsize * decoded->info.ysize;
+              decode_mps = pixels * decoded->info.num_color_channels * 1E-6 /
+                           (jxl::Now() - t0);
+              process_metadata(decoded);
+            }
+            return frame_callback(std::move(frame));
+          });
+    };
+    encoded = EncodeImageJXLFrameByFrame(params, decoder, &ppf, &num_frames,
+                                         &compressed);
+    if (!encoded && num_frames != 0) {
       fprintf(stderr, "EncodeImageJXL() failed.\n");
       return EXIT_FAILURE;
     }
-    const double t1 = jxl::Now();
-    stats.NotifyElapsed(t1 - t0);
-    stats.SetImageSize(ppf.info.xsize, ppf.info.ysize);
+    // Otherwise nothing was decoded yet, e.g. because the image has metadata
+    // after its first frame; fall back to decoding the whole image.
+    if (encoded) {
+      stats.NotifyElapsed(jxl::Now() - t0);
+      stats.SetImageSize(ppf.info.xsize, ppf.info.ysize);
+    }
+  }
+
+  if (!encoded) {
+    if (!args.lossless_jpeg) {
+      const double t0 = jxl::Now();
+      jxl::Status status = jxl::extras::DecodeBytes(
+          jxl::Span<const uint8_t>(image_data), args.color_hints_proxy.target,
+          &ppf, nullptr, &codec);
+
+      if (!status) {
+        std::cerr << "Getting pixel data failed." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      if (ppf.frames.empty()) {
+        std::cerr << "No frames on input file." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+
+      const double t1 = jxl::Now();
+      pixels = ppf.info.xsize * ppf.info.ysize;
+      decode_mps = pixels * ppf.info.num_color_channels * 1E-6 / (t1 - t0);
+    }
+    if (args.lossless_jpeg && jpegxl::tools::IsJPG(image_data)) {
+      if (!cmdline.GetOption(args.opt_lossless_jpeg_id)->matched()) {
+        std::cerr << "Note: Implicit-default for JPEG is lossless-transcoding. "
+                  << "To silence this message, set --lossless_jpeg=(1|0)."
+                  << std::endl;
+      }
+      jpeg_bytes = &image_data;
+    }
+
+    ProcessFlags(codec, ppf, jpeg_bytes, &cmdline, &args, &params);
+    process_metadata(&ppf);
+    num_frames = ppf.frames.size();
+
+    params.runner = JxlThreadParallelRunner;
+    params.runner_opaque = runner.get();
+
+    for (size_t num_rep = 0; num_rep < args.num_reps; ++num_rep) {
+      const double t0 = jxl::Now();
+      if (!EncodeImageJXL(params, ppf, jpeg_bytes, &compressed)) {
+        fprintf(stderr, "EncodeImageJXL() failed.\n");
+        return EXIT_FAILURE;
+      }
+      const double t1 = jxl::Now();
+      stats.NotifyElapsed(t1 - t0);
+      stats.SetImageSize(ppf.info.xsize, ppf.info.ysize);
+    }
   }
 
   if (args.file_out && !args.disable_output) {
@@ -1085,8 +1146,8 @@ int main(int argc, char** argv) {
     if (!args.lossless_jpeg) {
       const double bpp =
           static_cast<double>(compressed.size() * jxl::kBitsPerByte) / pixels;
-      cmdline.VerbosePrintf(0, "(%.3f bpp%s).\n", bpp / ppf.frames.size(),
-                            ppf.frames.size() == 1 ? "" : "/frame");
+      cmdline.VerbosePrintf(0, "(%.3f bpp%s).\n", bpp / num_frames,
+                            num_frames == 1 ? "" : "/frame");
       JXL_CHECK(stats.Print(num_worker_threads));
     } else {
       cmdline.VerbosePrintf(0, "\n");
@@ -22,7 +22,9 @@
 
 #include "lib/extras/alpha_blend.h"
 #include "lib/extras/codec.h"
+#include "lib/extras/dec/color_hints.h"
 #include "lib/extras/dec/decode.h"
+#include "lib/extras/dec/jpg.h"
 #include "lib/extras/dec/jxl.h"
 #include "lib/extras/enc/apng.h"
 #include "lib/extras/enc/encode.h"
@@ -103,6 +105,12 @@ struct DecompressArgs {
                             "the given peak display luminance.",
                             &display_nits, &ParseDouble, 1);
 
+    cmdline->AddOptionValue('\0', "preserve_saturation", "0..1",
+                            "If set, maps out-of-gamut colors into the output "
+                            "color space instead of clipping them, preserving "
+                            "luminance (0) or saturation (1).",
+                            &preserve_saturation, &ParseDouble, 1);
+
     cmdline->AddOptionValue(
         '\0', "color_space", "COLORSPACE_DESC",
         "Sets the desired output color space of the image. For example:\n"
@@ -175,6 +183,22 @@ struct DecompressArgs {
                            "Disables rendering of spot colors.",
                            &render_spotcolors, &SetBooleanFalse, 2);
 
+    cmdline->AddOptionFlag('\0', "fast_idct",
+                           "Uses a faster, approximate inverse DCT. The output "
+                           "may differ slightly from a conformant decoder.",
+                           &fast_idct, &SetBooleanTrue, 2);
+
+    cmdline->AddOptionValue('\0', "downscale_jpeg", "1|2|4|8",
+                            "If the input is a recompressed JPEG, "
+                            "reconstructs the JPEG and decodes it\n"
+                            "    at 1/N of its size with the reduced-size "
+                            "inverse DCTs of the JPEG decoder.\n"
+                            "    Other inputs are decoded at full size. Can "
+                            "not be combined with the options\n"
+                            "    that change the decoded pixels, such as "
+                            "--color_space.",
+                            &downscale_jpeg, &ParseUint32, 2);
+
     cmdline->AddOptionValue('\0', "preview_out", "FILENAME",
                             "If specified, writes the preview image to this "
                             "file.",
@@ -223,6 +247,40 @@ struct DecompressArgs {
       fprintf(stderr, "Missing INPUT filename.\n");
       return false;
     }
+    if (downscale_jpeg != 1 && downscale_jpeg != 2 && downscale_jpeg != 4 &&
+        downscale_jpeg != 8) {
+      fprintf(stderr,
+              "Invalid flag value for --downscale_jpeg: must be 1, 2, 4 or "
+              "8.\n");
+      return false;
+    }
+    if (downscale_jpeg != 1) {
+      // The reconstructed JPEG is decoded by the JPEG library, which ignores
+      // all options of the JPEG XL decoder.
+      const char* conflict = nullptr;
+      if (!color_space.empty()) {
+        conflict = "--color_space";
+      } else if (cmdline.GetOption(opt_bits_per_sample_id)->matched()) {
+        conflict = "--bits_per_sample";
+      } else if (display_nits > 0.0) {
+        conflict = "--display_nits";
+      } else if (preserve_saturation >= 0.0) {
+        conflict = "--preserve_saturation";
+      } else if (downsampling != 0) {
+        conflict = "--downsampling";
+      } else if (allow_partial_files) {
+        conflict = "--allow_partial_files";
+      } else if (fast_idct) {
+        conflict = "--fast_idct";
+      } else if (!render_spotcolors) {
+        conflict = "--norender_spotcolors";
+      }
+      if (conflict != nullptr) {
+        fprintf(stderr, "--downscale_jpeg can not be used with %s.\n",
+                conflict);
+        return false;
+      }
+    }
     if (num_threads < -1) {
       fprintf(
           stderr,
@@ -241,6 +299,7 @@ struct DecompressArgs {
   int32_t num_threads = -1;
   int bits_per_sample = -1;
   double display_nits = 0.0;
+  double preserve_saturation = -1.0;
   std::string color_space;
   uint32_t downsampling = 0;
   bool allow_partial_files = false;
@@ -248,6 +307,8 @@ struct DecompressArgs {
   size_t jpeg_quality = 95;
   bool use_sjpeg = false;
   bool render_spotcolors = true;
+  bool fast_idct = false;
+  uint32_t downscale_jpeg = 1;
   bool output_extra_channels = false;
   bool output_frames = false;
   std::string preview_out;
@@ -318,6 +379,15 @@ void AddFormatsWithAlphaChannel(std::vector<JxlPixelFormat>* formats) {
   }
 }
 
+bool AcceptsDataType(const std::vector<JxlPixelFormat>& formats,
+                     JxlDataType data_type) {
+  if (formats.empty()) return true;
+  for (const auto& format : formats) {
+    if (format.data_type == data_type) return true;
+  }
+  return false;
+}
+
 bool ParseBackgroundColor(const std::string& background_desc,
                           float background[3]) {
   if (background_desc == "black") {
@@ -362,6 +432,49 @@ bool DecompressJxlReconstructJPEG(const jpegxl::tools::DecompressArgs& args,
   return true;
 }
 
+// Reconstructs the JPEG stored in a recompressed JPEG XL input and decodes it
+// at 1/args.downscale_jpeg of its size. Returns false without an error message
+// if the input can not be reconstructed to a JPEG with identity orientation.
+//
+// This is a stopgap that only exists in djxl: the library decoder has no
+// scaled IDCTs, so the JPEG bitstream is written out and entropy-decoded again
+// by the JPEG decoder. Scaled output of the JPEG-recompressed path of
+// JxlDecoder would avoid that round trip and make it available to library
+// users; once it exists, this function should be replaced with it.
+bool DecompressJxlToDownscaledJPEG(const jpegxl::tools::DecompressArgs& args,
+                                   const std::vector<uint8_t>& compressed,
+                                   void* runner,
+                                   jxl::extras::PackedPixelFile* ppf,
+                                   size_t* decoded_bytes,
+                                   jpegxl::tools::SpeedStats* stats) {
+  const double t0 = jxl::Now();
+  std::vector<uint8_t> jpeg_bytes;
+  jxl::extras::PackedPixelFile jxl_info;
+  jxl::extras::JXLDecompressParams dparams;
+  dparams.runner = JxlThreadParallelRunner;
+  dparams.runner_opaque = runner;
+  if (!jxl::extras::DecodeImageJXL(compressed.data(), compressed.size(),
+                                   dparams, decoded_bytes, &jxl_info,
+                                   &jpeg_bytes)) {
+    return false;
+  }
+  // The JPEG decoder does not apply the orientation of the JPEG XL image.
+  if (jxl_info.info.orientation != JXL_ORIENT_IDENTITY) return false;
+  jxl::extras::JPGDecompressParams jpg_dparams;
+  jpg_dparams.scale_denom = args.downscale_jpeg;
+  if (!jxl::extras::DecodeImageJPG(jxl::Span<const uint8_t>(jpeg_bytes),
+                                   jxl::extras::ColorHints(), ppf,
+                                   /*constraints=*/nullptr, &jpg_dparams)) {
+    return false;
+  }
+  const double t1 = jxl::Now();
+  if (stats) {
+    stats->NotifyElapsed(t1 - t0);
+    stats->SetImageSize(ppf->info.xsize, ppf->info.ysize);
+  }
+  return true;
+}
+
 bool DecompressJxlToPackedPixelFile(
     const jpegxl::tools::DecompressArgs& args,
     const std::vector<uint8_t>& compressed,
@@ -372,8 +485,10 @@ bool DecompressJxlToPackedPixelFile(
   dparams.max_downsampling = args.downsampling;
   dparams.accepted_formats = accepted_formats;
   dparams.display_nits = args.display_nits;
+  dparams.preserve_saturation = args.preserve_saturation;
   dparams.color_space = args.color_space;
   dparams.render_spotcolors = args.render_spotcolors;
+  dparams.fast_idct = args.fast_idct;
   dparams.runner = JxlThreadParallelRunner;
   dparams.runner_opaque = runner;
   dparams.allow_partial_input = args.allow_partial_files;
@@ -538,7 +653,22 @@ int main(int argc, const char* argv[]) {
     }
     jxl::extras::PackedPixelFile ppf;
     size_t decoded_bytes = 0;
-    for (size_t i = 0; i < num_reps; ++i) {
+    bool downscaled = false;
+    if (args.downscale_jpeg > 1 && jxl::extras::CanDecodeJPG() &&
+        AcceptsDataType(accepted_formats, JXL_TYPE_UINT8)) {
+      downscaled = DecompressJxlToDownscaledJPEG(
+          args, compressed, runner.get(), &ppf, &decoded_bytes, &stats);
+      for (size_t i = 1; downscaled && i < num_reps; ++i) {
+        downscaled = DecompressJxlToDownscaledJPEG(
+            args, compressed, runner.get(), &ppf, &decoded_bytes, &stats);
+      }
+      if (!downscaled && !args.quiet) {
+        fprintf(stderr,
+                "Warning: could not decode via JPEG reconstruction, "
+                "decoding at full size.\n");
+      }
+    }
+    for (size_t i = 0; !downscaled && i < num_reps; ++i) {
       if (!DecompressJxlToPackedPixelFile(args, compressed, accepted_formats,
                                           runner.get(), &ppf, &decoded_bytes,
                                           &stats)) {